@@ -83,6 +83,23 @@ typedef struct awbl_spi_flash_dev {
  */
 void awbl_spi_flash_drv_register (void);
 
+/**
+ * \brief erase whole blocks of a NVRAM segment
+ *
+ * awbl_nvram_set() erases a block only when a write starts on its boundary,
+ * use this to erase explicitly before programming pages.
+ *
+ * \param[in] p_name : segment name
+ * \param[in] unit   : segment unit
+ * \param[in] offset : offset in the segment, must align on block boundary
+ * \param[in] len    : bytes to erase, must be a multiple of block size
+ *
+ * \retval AW_OK      : success
+ * \retval -AW_EINVAL : not aligned or out of the segment
+ * \retval -ENXIO     : segment not found
+ */
+aw_err_t awbl_spi_flash_nvram_erase (char *p_name, int unit, int offset, int len);
+
 #ifdef __cplusplus
 }
 #endif	/* __cplusplus 	*/
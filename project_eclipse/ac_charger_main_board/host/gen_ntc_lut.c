@@ -0,0 +1,138 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 生成 ntc_lut.c 中的温度表
+ *
+ * 对每个12位码值按固件的换算（码值->mV->ntc_res_get()->ntc_res_to_temp()）计算
+ * 温度， 码值为0（0mV）时按-40℃。 16步压缩表取每16个码值的点， 最后一点为码值4095。
+ *
+ *   gen_ntc_lut             输出表格（从 "#if ACP1000_TEMP_LUT == 2" 到 "#endif"），
+ *                           替换 ntc_lut.c 中的相应部分
+ *   gen_ntc_lut <ntc_lut.c> 检查文件中的表格与生成结果一致， 不一致时返回1
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-18  xjc, first implementation
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ntc.h"
+#include "ntc_lut.h"
+
+#define __CODE_NUMS     (1 << NTC_LUT_BITS)
+#define __BUF_SIZE      (64 * 1024)
+
+static char   __g_buf[__BUF_SIZE];
+static size_t __g_len;
+
+static void __out (const char *p_fmt, ...)
+{
+    va_list ap;
+
+    va_start(ap, p_fmt);
+    __g_len += vsnprintf(&__g_buf[__g_len], __BUF_SIZE - __g_len, p_fmt, ap);
+    va_end(ap);
+}
+
+static int16_t __temp_get (uint16_t code)
+{
+    uint32_t mv = code * NTC_LUT_VREF_MV / (__CODE_NUMS - 1);
+
+    if (0 == mv) {
+        return -40 << 8;
+    }
+    return ntc_res_to_temp(ntc_res_get(mv));
+}
+
+static void __table_out (const char *p_comment,
+                         const char *p_name,
+                         int         nums,
+                         int         step)
+{
+    int i;
+    int code;
+
+    __out("%s\n", p_comment);
+    __out("static const int16_t %s[%d] = {\n", p_name, nums);
+    for (i = 0; i < nums; i++) {
+        code = i * step;
+        if (code > __CODE_NUMS - 1) {
+            code = __CODE_NUMS - 1;
+        }
+        __out("%s%6d%s",
+              (i % 8) ? " " : "    ",
+              __temp_get(code),
+              (i == nums - 1) ? "\n" : ((i % 8) == 7) ? ",\n" : ",");
+    }
+    __out("};\n");
+}
+
+/**
+ * \brief 检查文件中的表格
+ */
+static int __file_check (const char *p_path)
+{
+    FILE  *p_file = fopen(p_path, "rb");
+    char  *p_src;
+    char  *p_tab;
+    long   size;
+
+    if (NULL == p_file) {
+        printf("gen_ntc_lut: cannot open %s\n", p_path);
+        return 1;
+    }
+    fseek(p_file, 0, SEEK_END);
+    size  = ftell(p_file);
+    fseek(p_file, 0, SEEK_SET);
+    p_src = calloc(1, size + 1);
+    if ((NULL == p_src) || (fread(p_src, 1, size, p_file) != (size_t)size)) {
+        printf("gen_ntc_lut: cannot read %s\n", p_path);
+        fclose(p_file);
+        return 1;
+    }
+    fclose(p_file);
+
+    p_tab = strstr(p_src, "#if ACP1000_TEMP_LUT == 2\n");
+    if ((NULL == p_tab) || (0 != strncmp(p_tab, __g_buf, __g_len))) {
+        printf("gen_ntc_lut: table in %s differs from generated table\n", p_path);
+        free(p_src);
+        return 1;
+    }
+    printf("gen_ntc_lut: table in %s is up to date\n", p_path);
+    free(p_src);
+    return 0;
+}
+
+int main (int argc, char *argv[])
+{
+    __out("#if ACP1000_TEMP_LUT == 2\n");
+    __table_out("/* 每16个码值一个点， 共257点（最后一点为码值4095） */",
+                "g_ntc_lut_16",
+                __CODE_NUMS / 16 + 1,
+                16);
+    __out("#else\n");
+    __table_out("/* 每个码值一个点 */", "g_ntc_lut", __CODE_NUMS, 1);
+    __out("#endif\n");
+
+    if (argc > 1) {
+        return __file_check(argv[1]);
+    }
+    fwrite(__g_buf, 1, __g_len, stdout);
+    return 0;
+}
@@ -0,0 +1,347 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 主机构建的充电流程性能测试
+ *
+ * 控制台命令 .bench <次数> [充电时长ms] 按以下步骤驱动完整的充电过程，
+ * 经过充电机、 计费、 桩的状态机：
+ *  1. 插枪（CP 9V）， 跳过鉴权时由充电机自动启动， 否则发 charge_ctrl 1，
+ *     等待 CP 输出 PWM（允许充电）；
+ *  2. 车辆就绪（CP 6V）， 等待接触器闭合（DO_AC）；
+ *  3. 充电指定时长后发 charge_ctrl 0（人为停止）， 车辆模型在 PWM 变为 100%
+ *     后回到 9V， 等待接触器断开；
+ *  4. 使能计费任务时等待充电记录保存（perf_stat 的 history_save 计数增加）；
+ *  5. 拔枪（CP 12V）， 等待充电机回到空闲。
+ *
+ * 每一步的时间由主机时钟测量（包含 CP 检测、 周期作业调度的延迟）， 固件内部的
+ * 事件分发及 EEPROM/Flash 写入耗时由 perf_stat 统计， 各任务 CPU 占用由任务线程的
+ * CPU 时钟统计。结果每行以 "bench " 开头， 字段为 键=值， 时间单位 us， 例如：
+ * \code
+ * bench path=cp6_to_ac n=20 min_us=15210 avg_us=31877 p50_us=30480 p90_us=46002 max_us=46611
+ * bench evt=16 cnt=20 avg_ns=4210 max_ns=9870
+ * bench task=charger_task cpu_us=1520 load_pct=0.03
+ * \endcode
+ * 用 grep '^bench ' 提取后可以直接比较不同版本的构建。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-12  xjc, first implementation
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "aw_vdebug.h"
+#include "acp1000_dout.h"
+#include "perf_stat.h"
+#include "host_os.h"
+#include "host_sim.h"
+
+#define __CP_PWM_ID        7       /* CP PWM 编号（charger.c 中的 curr_pwm） */
+#define __WAIT_MS          15000   /* 每一步的最长等待时间 */
+#define __SAVE_WAIT_MS     3000    /* 接触器断开后等待保存充电记录的时间 */
+#define __IDLE_GAP_MS      500     /* 拔枪后回到空闲的时间， 需大于解锁延时（200ms） */
+#define __POLL_US          100     /* 轮询间隔 */
+#define __TASK_MAX         64
+
+/**
+ * 测量路径
+ */
+enum {
+    __PATH_PLUG_TO_PWM = 0,   /* 插枪到允许充电（CP 输出 PWM） */
+    __PATH_CP6_TO_AC,         /* CP 6V 到接触器闭合 */
+    __PATH_STOP_TO_AC_OPEN,   /* 停止请求到接触器断开 */
+    __PATH_AC_OPEN_TO_SAVED,  /* 接触器断开到充电记录保存 */
+    __PATH_SESSION,           /* 整个充电过程（不含充电时长） */
+    __PATH_NUMS
+};
+
+static const char *__g_path_name[__PATH_NUMS] = {
+    "plug_to_pwm",
+    "cp6_to_ac",
+    "stop_to_ac_open",
+    "ac_open_to_saved",
+    "session",
+};
+
+typedef struct __bench_path {
+    uint32_t *p_us;
+    int       n;
+}__bench_path_t;
+
+/* 条件 */
+typedef int (*__cond_t) (void);
+
+static int __pwm_on (void)
+{
+    uint32_t duty, period;
+
+    return host_pwm_get(__CP_PWM_ID, &duty, &period) && (duty < period);
+}
+
+static int __pwm_off (void)
+{
+    return !__pwm_on();
+}
+
+static int __ac_closed (void)
+{
+    return host_gpio_level_get(ACP1000_DOUT_AC);
+}
+
+static int __ac_open (void)
+{
+    return !host_gpio_level_get(ACP1000_DOUT_AC);
+}
+
+static uint32_t __history_saves (void)
+{
+#if ACP1000_PERF_STAT
+    perf_stat_item_t item;
+
+    if (AW_OK == perf_stat_pt_get(PERF_STAT_HISTORY_SAVE, &item)) {
+        return item.cnt;
+    }
+#endif
+    return 0;
+}
+
+static void __shell (const char *p_cmd)
+{
+    char line[64];
+
+    snprintf(line, sizeof(line), "%s", p_cmd);
+    host_shell_exec(line);
+}
+
+/**
+ * \brief 等待条件成立
+ * \return 成立的时刻（ns）， 超时返回 0
+ */
+static uint64_t __wait (__cond_t pfn_cond, uint32_t timeout_ms)
+{
+    uint64_t end = host_os_ns() + (uint64_t)timeout_ms * 1000000ull;
+    uint64_t now;
+
+    while ((now = host_os_ns()) < end) {
+        if (pfn_cond()) {
+            return now;
+        }
+        host_os_sleep_us(__POLL_US);
+    }
+    return 0;
+}
+
+static void __path_add (__bench_path_t *p_path, uint64_t t0, uint64_t t1)
+{
+    p_path->p_us[p_path->n++] = (uint32_t)((t1 - t0) / 1000ull);
+}
+
+static int __us_cmp (const void *p_a, const void *p_b)
+{
+    uint32_t a = *(const uint32_t *)p_a;
+    uint32_t b = *(const uint32_t *)p_b;
+
+    return (a > b) - (a < b);
+}
+
+static void __path_print (const char *p_name, __bench_path_t *p_path)
+{
+    uint64_t sum = 0;
+    int      n   = p_path->n;
+    int      i;
+
+    if (0 == n) {
+        aw_kprintf("bench path=%s n=0\r\n", p_name);
+        return;
+    }
+    qsort(p_path->p_us, n, sizeof(uint32_t), __us_cmp);
+    for (i = 0; i < n; i++) {
+        sum += p_path->p_us[i];
+    }
+    aw_kprintf("bench path=%s n=%d min_us=%u avg_us=%u p50_us=%u p90_us=%u max_us=%u\r\n",
+               p_name,
+               n,
+               p_path->p_us[0],
+               (uint32_t)(sum / n),
+               p_path->p_us[(n - 1) * 50 / 100],
+               p_path->p_us[(n - 1) * 90 / 100],
+               p_path->p_us[n - 1]);
+}
+
+/**
+ * \brief 运行一次充电过程
+ * \return 0： 完成  <0： 失败的步骤
+ */
+static int __session_run (__bench_path_t *p_path, int charge_ms)
+{
+    uint64_t t_plug, t_pwm, t_cp6, t_ac, t_stop, t_open, t_saved;
+    uint32_t saves;
+    int      ret = 0;
+
+    /* 1. 插枪， 等待允许充电 */
+    t_plug = host_os_ns();
+    host_board_cp_set(9);
+#if ACP1000_SKIP_AUTH
+    t_pwm = __wait(__pwm_on, __WAIT_MS);
+#else
+    t_pwm = 0;
+    while (host_os_ns() < t_plug + (uint64_t)__WAIT_MS * 1000000ull) {
+        __shell("charge_ctrl 1");
+        if (0 != (t_pwm = __wait(__pwm_on, 50))) {
+            break;
+        }
+    }
+#endif
+    if (0 == t_pwm) {
+        ret = -1;
+        goto __unplug;
+    }
+
+    /* 2. 车辆就绪， 等待接触器闭合 */
+    t_cp6 = host_os_ns();
+    host_board_cp_set(6);
+    if (0 == (t_ac = __wait(__ac_closed, __WAIT_MS))) {
+        ret = -2;
+        goto __unplug;
+    }
+
+    /* 3. 充电， 人为停止， 车辆在 PWM 停止后回到 9V */
+    host_os_sleep_ms(charge_ms);
+    saves  = __history_saves();
+    t_stop = host_os_ns();
+    __shell("charge_ctrl 0");
+    if (0 == __wait(__pwm_off, __WAIT_MS)) {
+        ret = -3;
+        goto __unplug;
+    }
+    host_board_cp_set(9);
+    if (0 == (t_open = __wait(__ac_open, __WAIT_MS))) {
+        ret = -3;
+        goto __unplug;
+    }
+
+    __path_add(&p_path[__PATH_PLUG_TO_PWM],     t_plug, t_pwm);
+    __path_add(&p_path[__PATH_CP6_TO_AC],       t_cp6,  t_ac);
+    __path_add(&p_path[__PATH_STOP_TO_AC_OPEN], t_stop, t_open);
+
+    /* 4. 结算并保存充电记录 */
+#if ACP1000_BILING_DETECT_TASK && ACP1000_PERF_STAT
+    t_saved = t_open;
+    while (host_os_ns() < t_open + (uint64_t)__SAVE_WAIT_MS * 1000000ull) {
+        if (__history_saves() != saves) {
+            t_saved = host_os_ns();
+            break;
+        }
+        host_os_sleep_us(__POLL_US);
+    }
+    if (t_saved == t_open) {
+        ret = -4;
+        goto __unplug;
+    }
+    __path_add(&p_path[__PATH_AC_OPEN_TO_SAVED], t_open, t_saved);
+#else
+    (void)saves;
+    t_saved = t_open;
+#endif
+
+    __path_add(&p_path[__PATH_SESSION],
+               t_plug,
+               t_saved - (uint64_t)charge_ms * 1000000ull);
+
+__unplug:
+    /* 5. 拔枪， 回到空闲 */
+    host_board_cp_set(12);
+    host_os_sleep_ms(__IDLE_GAP_MS);
+    return ret;
+}
+
+void host_bench_run (int sessions, int charge_ms)
+{
+    static uint64_t   cpu0[__TASK_MAX];
+    __bench_path_t    path[__PATH_NUMS];
+    perf_stat_item_t  item;
+    const char       *p_name;
+    uint64_t          cpu_ns, wall0, wall;
+    int               ok = 0, ret;
+    int               i;
+
+    if (sessions <= 0) {
+        return;
+    }
+    for (i = 0; i < __PATH_NUMS; i++) {
+        path[i].p_us = calloc(sessions, sizeof(uint32_t));
+        path[i].n    = 0;
+        if (NULL == path[i].p_us) {
+            host_sim_panic("bench: no memory");
+        }
+    }
+
+#if ACP1000_PERF_STAT
+    perf_stat_clr();
+#endif
+    for (i = 0; (i < __TASK_MAX) && (0 == host_task_cpu_get(i, &p_name, &cpu_ns)); i++) {
+        cpu0[i] = cpu_ns;
+    }
+    wall0 = host_os_ns();
+
+    for (i = 0; i < sessions; i++) {
+        ret = __session_run(path, charge_ms);
+        if (0 == ret) {
+            ok++;
+        } else {
+            aw_kprintf("bench: session %d failed at step %d\r\n", i, -ret);
+        }
+    }
+    wall = host_os_ns() - wall0;
+
+    aw_kprintf("bench sessions=%d ok=%d charge_ms=%d wall_ms=%u\r\n",
+               sessions, ok, charge_ms, (uint32_t)(wall / 1000000ull));
+    for (i = 0; i < __PATH_NUMS; i++) {
+        __path_print(__g_path_name[i], &path[i]);
+        free(path[i].p_us);
+    }
+
+#if ACP1000_PERF_STAT
+    for (i = 0; i < EVENT_NUMS; i++) {
+        if ((AW_OK == perf_stat_evt_get(i, &item)) && (item.cnt > 0)) {
+            aw_kprintf("bench evt=%d cnt=%u avg_ns=%u max_ns=%u\r\n",
+                       i, item.cnt, perf_stat_ns(item.sum / item.cnt), perf_stat_ns(item.max));
+        }
+    }
+    for (i = 0; i < PERF_STAT_PT_NUMS; i++) {
+        perf_stat_pt_get(i, &item);
+        aw_kprintf("bench pt=%s cnt=%u avg_ns=%u max_ns=%u\r\n",
+                   perf_stat_pt_name(i),
+                   item.cnt,
+                   item.cnt ? perf_stat_ns(item.sum / item.cnt) : 0,
+                   perf_stat_ns(item.max));
+    }
+#else
+    (void)item;
+#endif
+
+    for (i = 0; (i < __TASK_MAX) && (0 == host_task_cpu_get(i, &p_name, &cpu_ns)); i++) {
+        cpu_ns = (cpu_ns > cpu0[i]) ? (cpu_ns - cpu0[i]) : 0;
+        aw_kprintf("bench task=%s cpu_us=%u load_pct=%u.%02u\r\n",
+                   p_name,
+                   (uint32_t)(cpu_ns / 1000ull),
+                   (uint32_t)(cpu_ns * 100ull / wall),
+                   (uint32_t)(cpu_ns * 10000ull / wall % 100));
+    }
+}
+
+/* end of file */
@@ -0,0 +1,106 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 主机构建的板级模型
+ *
+ * 模拟主板外部电路：
+ *  - 检测点1比较器（CP_C0/C1/C2， 低电平有效， 同一时刻只有一个为低）；
+ *  - 交流接触器： DO_AC 变化后经过动作时间， 辅助触点 DI_AC1 跟随（闭合为低）；
+ *  - 枪锁： DO_INLOCK/DO_UNLOCK 脉冲改变锁检测 DI_INLOCK；
+ *  - 急停、 防雷、 枪在位、 FAC 为正常电平。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-08  xjc, first implementation
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include "rtk.h"
+#include "acp1000_din.h"
+#include "acp1000_dout.h"
+#include "host_sim.h"
+
+#define __CONTACTOR_MS_DEF     20      /* 接触器默认动作时间（ms） */
+
+static struct rtk_tick  __g_ac_tmr;
+static int              __g_ac_ms = __CONTACTOR_MS_DEF;
+static int              __g_ac_target;
+
+static void __ac_feedback (void *p_arg)
+{
+    /* DI_AC1 闭合为低 */
+    host_gpio_input_set(ACP1000_DIN_AC1, !__g_ac_target);
+}
+
+static void __dout_hook (int pin, int level, void *p_arg)
+{
+    switch (pin) {
+
+    case ACP1000_DOUT_AC:
+        __g_ac_target = level;
+        rtk_tick_down_counter_stop(&__g_ac_tmr);
+        if (0 == __g_ac_ms) {
+            __ac_feedback(NULL);
+        } else if (__g_ac_ms > 0) {
+            rtk_tick_down_counter_start(&__g_ac_tmr, __g_ac_ms);
+        }
+        break;
+
+    case ACP1000_DOUT_INLOCK:
+        if (level) {
+            host_gpio_input_set(ACP1000_DIN_INLOCK, 1);
+        }
+        break;
+
+    case ACP1000_DOUT_UNLOCK:
+        if (level) {
+            host_gpio_input_set(ACP1000_DIN_INLOCK, 0);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+void host_board_cp_set (int vol)
+{
+    host_gpio_input_set(ACP1000_DIN_CP_C0, 12 != vol);
+    host_gpio_input_set(ACP1000_DIN_CP_C1, 9  != vol);
+    host_gpio_input_set(ACP1000_DIN_CP_C2, 6  != vol);
+}
+
+void host_board_contactor_ms_set (int ms)
+{
+    __g_ac_ms = ms;
+}
+
+void host_board_init (void)
+{
+    host_gpio_input_set(ACP1000_DIN_SCREEM, 1);
+    host_gpio_input_set(ACP1000_DIN_LIGHT,  1);
+    host_gpio_input_set(ACP1000_DIN_AC1,    1);
+    host_gpio_input_set(ACP1000_DIN_INGUN,  1);
+    host_gpio_input_set(ACP1000_DIN_INLOCK, 0);
+    host_gpio_input_set(ACP1000_DIN_CC,     1);
+    host_gpio_input_set(ACP1000_DIN_FAC,    1);
+    host_board_cp_set(12);
+
+    rtk_tick_down_counter_init(&__g_ac_tmr);
+    rtk_tick_down_counter_set_func(&__g_ac_tmr, __ac_feedback, NULL);
+    host_gpio_hook_set(__dout_hook, NULL);
+}
+
+/* end of file */
@@ -0,0 +1,954 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 主机移植的 aw_* 外设及系统服务
+ *
+ * 系统节拍、 时间戳、 延时、 调试输出、 延迟作业、 GPIO、 ADC、 PWM、 硬件定时器、
+ * NVRAM（文件）、 RTC（主机时间加偏移）、 看门狗、 shell 命令表。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-08  xjc, first implementation
+ * - 1.01 16-10-12  xjc, 增加时间戳（aw_timestamp_*）
+ * - 1.02 16-10-13  xjc, aw_mdelay() 经 task_delay() 延时， 产生任务事件
+ * - 1.03 16-10-15  xjc, 增加看门狗（aw_wdt_*）， 超时时退出进程
+ * - 1.04 16-10-16  xjc, 复位时保存 .noinit 段， 启动时恢复
+ * - 1.05 16-10-18  xjc, 默认运行目录改为 ./acp1000_run（与程序名区分）
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include "rtk.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include "aw_system.h"
+#include "aw_timestamp.h"
+#include "aw_delay.h"
+#include "aw_vdebug.h"
+#include "aw_delayed_work.h"
+#include "aw_isr_defer.h"
+#include "aw_gpio.h"
+#include "aw_adc.h"
+#include "aw_pwm.h"
+#include "aw_hwtimer.h"
+#include "aw_nvram.h"
+#include "aw_rtc.h"
+#include "aw_time.h"
+#include "aw_shell.h"
+#include "aw_wdt.h"
+#include "am_gpio.h"
+#include "amhw_iap.h"
+#include "host_os.h"
+#include "host_sim.h"
+
+#define __HOST_GPIO_NUM      256
+#define __HOST_ADC_NUM       8
+#define __HOST_ADC_BITS      12
+#define __HOST_ADC_VREF      3300
+#define __HOST_PWM_NUM       16
+#define __HOST_HWTIMER_NUM   2
+#define __HOST_STAMP_FREQ    100000000    /* 时间戳频率， 与目标板内核时钟同量级 */
+
+static const char *__gp_dir;
+
+/*******************************************************************************
+  系统节拍、 延时、 调试输出
+*******************************************************************************/
+aw_tick_t aw_sys_tick_get (void)
+{
+    return host_os_ms();
+}
+
+unsigned long aw_sys_clkrate_get (void)
+{
+    return 1000;
+}
+
+aw_tick_t aw_ms_to_ticks (unsigned int ms)
+{
+    return ms;
+}
+
+unsigned int aw_ticks_to_ms (aw_tick_t ticks)
+{
+    return ticks;
+}
+
+uint64_t aw_timestamp_get64 (void)
+{
+    return host_os_ns() / (1000000000ull / __HOST_STAMP_FREQ);
+}
+
+uint32_t aw_timestamp_get (void)
+{
+    return (uint32_t)aw_timestamp_get64();
+}
+
+aw_timestamp_freq_t aw_timestamp_freq_get (void)
+{
+    return __HOST_STAMP_FREQ;
+}
+
+uint32_t aw_timestamps_to_us (uint32_t stamps)
+{
+    return stamps / (__HOST_STAMP_FREQ / 1000000);
+}
+
+void aw_mdelay (uint32_t ms)
+{
+    task_delay(ms);                 /* 节拍为 1ms */
+}
+
+int aw_kprintf (const char *fmt, ...)
+{
+    char    buf[512];
+    va_list args;
+    int     len;
+
+    va_start(args, fmt);
+    len = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+
+    if (len > (int)sizeof(buf) - 1) {
+        len = sizeof(buf) - 1;
+    }
+    if (len > 0) {
+        host_os_puts(buf, len);
+    }
+    return len;
+}
+
+/*******************************************************************************
+  中断延迟作业、 延迟作业
+*******************************************************************************/
+static struct aw_list_head    __g_defer_list = { &__g_defer_list, &__g_defer_list };
+static struct rtk_semaphore   __g_defer_sem;
+
+aw_err_t aw_isr_defer_job_add (struct aw_isr_defer_job *p_job)
+{
+    host_os_ilock();
+    if (!aw_list_empty(&p_job->node)) {
+        host_os_iunlock();
+        return -EEXIST;
+    }
+    aw_list_add_tail(&p_job->node, &__g_defer_list);
+    host_os_iunlock();
+
+    semc_give(&__g_defer_sem);
+    return AW_OK;
+}
+
+bool_t aw_isr_defer_job_is_usable (struct aw_isr_defer_job *p_job)
+{
+    return aw_list_empty(&p_job->node) ? TRUE : FALSE;
+}
+
+static void __defer_task_entry (void *p_arg1, void *p_arg2)
+{
+    struct aw_isr_defer_job *p_job;
+
+    while (1) {
+        semc_take(&__g_defer_sem, WAIT_FOREVER);
+
+        host_os_ilock();
+        if (aw_list_empty(&__g_defer_list)) {
+            host_os_iunlock();
+            continue;
+        }
+        /* aw_list_first_entry 经 rtk 的 container_of 按 int 计算地址， 不能在 64 位主机上使用 */
+        p_job = AW_CONTAINER_OF(__g_defer_list.next, struct aw_isr_defer_job, node);
+        aw_list_del_init(&p_job->node);
+        host_os_iunlock();
+
+        p_job->func(p_job->param);
+    }
+}
+
+static void __delayed_work_timeout (void *p_arg)
+{
+    struct aw_delayed_work *p_work = p_arg;
+
+    aw_isr_defer_job_add(&p_work->job);
+}
+
+void aw_delayed_work_init (struct aw_delayed_work *p_work,
+                           void                  (*pfunc_work)(void *p_arg),
+                           void                   *p_arg)
+{
+    AW_INIT_LIST_HEAD(&p_work->job.node);
+    p_work->job.func  = pfunc_work;
+    p_work->job.param = p_arg;
+    rtk_tick_down_counter_init(&p_work->tmr);
+    rtk_tick_down_counter_set_func(&p_work->tmr, __delayed_work_timeout, p_work);
+}
+
+void aw_delayed_work_start (struct aw_delayed_work *p_work, uint_t delay_ms)
+{
+    rtk_tick_down_counter_start(&p_work->tmr, aw_ms_to_ticks(delay_ms));
+}
+
+void aw_delayed_work_stop (struct aw_delayed_work *p_work)
+{
+    rtk_tick_down_counter_stop(&p_work->tmr);
+
+    host_os_ilock();
+    if (!aw_list_empty(&p_work->job.node)) {
+        aw_list_del_init(&p_work->job.node);
+    }
+    host_os_iunlock();
+}
+
+/*******************************************************************************
+  GPIO
+*******************************************************************************/
+static struct __host_gpio {
+    uint8_t           level;
+    uint8_t           is_out;
+    uint8_t           trig_flags;
+    uint8_t           trig_on;
+    aw_pfuncvoid_t    pfn_isr;
+    void             *p_isr_arg;
+} __g_gpio[__HOST_GPIO_NUM];
+
+static host_gpio_hook_t __gpfn_gpio_hook;
+static void            *__gp_gpio_hook_arg;
+
+static aw_err_t __gpio_cfg (int pin, uint32_t func)
+{
+    if ((pin < 0) || (pin >= __HOST_GPIO_NUM)) {
+        return -AW_EINVAL;
+    }
+    switch (func) {
+
+    case AW_GPIO_OUTPUT_VAL:
+        __g_gpio[pin].is_out = TRUE;
+        break;
+
+    case AW_GPIO_OUTPUT_INIT_HIGH_VAL:
+        __g_gpio[pin].is_out = TRUE;
+        __g_gpio[pin].level  = 1;
+        break;
+
+    case AW_GPIO_OUTPUT_INIT_LOW_VAL:
+        __g_gpio[pin].is_out = TRUE;
+        __g_gpio[pin].level  = 0;
+        break;
+
+    case AW_GPIO_INPUT_VAL:
+        __g_gpio[pin].is_out = FALSE;
+        break;
+
+    default:
+        break;
+    }
+    return AW_OK;
+}
+
+aw_err_t aw_gpio_pin_cfg (int pin, uint32_t flags)
+{
+    return __gpio_cfg(pin, AW_GPIO_FUNCBITS_GET(flags));
+}
+
+int am_gpio_pin_cfg (int pin, uint32_t flags)
+{
+    /* 两套接口的功能码取值相同 */
+    return __gpio_cfg(pin, AM_GPIO_COM_FUNC_GET(flags));
+}
+
+aw_err_t aw_gpio_get (int pin)
+{
+    if ((pin < 0) || (pin >= __HOST_GPIO_NUM)) {
+        return -AW_EINVAL;
+    }
+    return __g_gpio[pin].level;
+}
+
+int am_gpio_get (int pin)
+{
+    return aw_gpio_get(pin);
+}
+
+aw_err_t aw_gpio_set (int pin, int value)
+{
+    host_gpio_hook_t pfn_hook;
+    int              changed;
+
+    if ((pin < 0) || (pin >= __HOST_GPIO_NUM)) {
+        return -AW_EINVAL;
+    }
+    value = value ? 1 : 0;
+
+    host_os_ilock();
+    changed               = (__g_gpio[pin].level != value);
+    __g_gpio[pin].level   = value;
+    __g_gpio[pin].is_out  = TRUE;
+    pfn_hook              = __gpfn_gpio_hook;
+    host_os_iunlock();
+
+    if (changed && (NULL != pfn_hook)) {
+        pfn_hook(pin, value, __gp_gpio_hook_arg);
+    }
+    return AW_OK;
+}
+
+int am_gpio_set (int pin, int value)
+{
+    return aw_gpio_set(pin, value);
+}
+
+aw_err_t aw_gpio_toggle (int pin)
+{
+    if ((pin < 0) || (pin >= __HOST_GPIO_NUM)) {
+        return -AW_EINVAL;
+    }
+    return aw_gpio_set(pin, !__g_gpio[pin].level);
+}
+
+aw_err_t aw_gpio_trigger_cfg (int pin, uint32_t flags)
+{
+    if ((pin < 0) || (pin >= __HOST_GPIO_NUM)) {
+        return -AW_EINVAL;
+    }
+    __g_gpio[pin].trig_flags = flags;
+    return AW_OK;
+}
+
+aw_err_t aw_gpio_trigger_connect (int             pin,
+                                  aw_pfuncvoid_t  pfunc_callback,
+                                  void           *p_arg)
+{
+    if ((pin < 0) || (pin >= __HOST_GPIO_NUM)) {
+        return -AW_EINVAL;
+    }
+    host_os_ilock();
+    __g_gpio[pin].pfn_isr   = pfunc_callback;
+    __g_gpio[pin].p_isr_arg = p_arg;
+    host_os_iunlock();
+    return AW_OK;
+}
+
+aw_err_t aw_gpio_trigger_disconnect (int             pin,
+                                     aw_pfuncvoid_t  pfunc_callback,
+                                     void           *p_arg)
+{
+    if ((pin < 0) || (pin >= __HOST_GPIO_NUM)) {
+        return -AW_EINVAL;
+    }
+    host_os_ilock();
+    __g_gpio[pin].pfn_isr   = NULL;
+    __g_gpio[pin].p_isr_arg = NULL;
+    host_os_iunlock();
+    return AW_OK;
+}
+
+aw_err_t aw_gpio_trigger_on (int pin)
+{
+    if ((pin < 0) || (pin >= __HOST_GPIO_NUM)) {
+        return -AW_EINVAL;
+    }
+    __g_gpio[pin].trig_on = TRUE;
+    return AW_OK;
+}
+
+aw_err_t aw_gpio_trigger_off (int pin)
+{
+    if ((pin < 0) || (pin >= __HOST_GPIO_NUM)) {
+        return -AW_EINVAL;
+    }
+    __g_gpio[pin].trig_on = FALSE;
+    return AW_OK;
+}
+
+void host_gpio_input_set (int pin, int level)
+{
+    struct __host_gpio *p_gpio;
+    int                 old;
+    int                 fire = FALSE;
+
+    if ((pin < 0) || (pin >= __HOST_GPIO_NUM)) {
+        return;
+    }
+    p_gpio = &__g_gpio[pin];
+    level  = level ? 1 : 0;
+
+    enter_int_context();
+    old           = p_gpio->level;
+    p_gpio->level = level;
+    if (p_gpio->trig_on && (NULL != p_gpio->pfn_isr)) {
+        switch (p_gpio->trig_flags) {
+        case AW_GPIO_TRIGGER_HIGH:       fire = level;                     break;
+        case AW_GPIO_TRIGGER_LOW:        fire = !level;                    break;
+        case AW_GPIO_TRIGGER_RISE:       fire = !old && level;             break;
+        case AW_GPIO_TRIGGER_FALL:       fire = old && !level;             break;
+        case AW_GPIO_TRIGGER_BOTH_EDGES: fire = (old != level);            break;
+        default:                                                           break;
+        }
+    }
+    if (fire) {
+        p_gpio->pfn_isr(p_gpio->p_isr_arg);
+    }
+    exit_int_context();
+}
+
+int host_gpio_level_get (int pin)
+{
+    return ((pin < 0) || (pin >= __HOST_GPIO_NUM)) ? -1 : __g_gpio[pin].level;
+}
+
+void host_gpio_hook_set (host_gpio_hook_t pfn_hook, void *p_arg)
+{
+    host_os_ilock();
+    __gpfn_gpio_hook   = pfn_hook;
+    __gp_gpio_hook_arg = p_arg;
+    host_os_iunlock();
+}
+
+/*******************************************************************************
+  ADC（每次序列在下一个节拍完成）
+*******************************************************************************/
+static uint32_t __g_adc_mv[__HOST_ADC_NUM];
+static uint32_t __g_adc_seed = 1;
+
+static struct __host_adc_req {
+    aw_adc_client_t  *p_client;
+    struct rtk_tick   tmr;
+} __g_adc_req[__HOST_ADC_NUM];
+
+static void __adc_fill (aw_adc_client_t *p_client)
+{
+    uint32_t code;
+    uint32_t i, n;
+
+    for (n = 0; n < p_client->desc_num; n++) {
+        aw_adc_buf_desc_t *p_desc = &p_client->p_desc[n];
+
+        for (i = 0; i < p_desc->length; i++) {
+            /* 理想转换值加 ±1 LSB 噪声 */
+            __g_adc_seed = __g_adc_seed * 1103515245 + 12345;
+            code  = __g_adc_mv[p_client->channel] * ((1 << __HOST_ADC_BITS) - 1) / __HOST_ADC_VREF;
+            code += ((__g_adc_seed >> 16) % 3);
+            code  = (code > 0) ? code - 1 : 0;
+            if (code > (1 << __HOST_ADC_BITS) - 1) {
+                code = (1 << __HOST_ADC_BITS) - 1;
+            }
+            if (p_client->data_bits <= 8) {
+                ((uint8_t *)p_desc->p_buf)[i] = code;
+            } else if (p_client->data_bits <= 16) {
+                ((uint16_t *)p_desc->p_buf)[i] = code;
+            } else {
+                ((uint32_t *)p_desc->p_buf)[i] = code;
+            }
+        }
+    }
+}
+
+static void __adc_done (void *p_arg)
+{
+    struct __host_adc_req *p_req    = p_arg;
+    aw_adc_client_t       *p_client = p_req->p_client;
+    uint32_t               n;
+
+    if (NULL == p_client) {
+        return;
+    }
+    p_req->p_client = NULL;
+
+    __adc_fill(p_client);
+    p_client->stat = AW_OK;
+    for (n = 0; n < p_client->desc_num; n++) {
+        if (NULL != p_client->p_desc[n].pfn_complete) {
+            p_client->p_desc[n].pfn_complete(p_client->p_desc[n].p_arg, AW_OK);
+        }
+    }
+}
+
+int aw_adc_bits_get (aw_adc_channel_t ch)
+{
+    return (ch < __HOST_ADC_NUM) ? __HOST_ADC_BITS : -ENXIO;
+}
+
+int aw_adc_vref_get (aw_adc_channel_t ch)
+{
+    return (ch < __HOST_ADC_NUM) ? __HOST_ADC_VREF : -ENXIO;
+}
+
+aw_err_t aw_adc_rate_set (aw_adc_channel_t ch, uint32_t rate)
+{
+    return (ch < __HOST_ADC_NUM) ? AW_OK : -ENXIO;
+}
+
+aw_err_t aw_adc_client_init (aw_adc_client_t    *p_client,
+                             aw_adc_channel_t    ch,
+                             bool_t              urgent)
+{
+    if (ch >= __HOST_ADC_NUM) {
+        return -ENXIO;
+    }
+    memset(p_client, 0, sizeof(*p_client));
+    p_client->channel   = ch;
+    p_client->urgent    = urgent;
+    p_client->data_bits = __HOST_ADC_BITS;
+    return AW_OK;
+}
+
+aw_err_t aw_adc_client_start (aw_adc_client_t    *p_client,
+                              aw_adc_buf_desc_t  *p_desc,
+                              int                 desc_num,
+                              uint32_t            count)
+{
+    struct __host_adc_req *p_req = &__g_adc_req[p_client->channel];
+
+    if ((NULL == p_desc) || (desc_num <= 0)) {
+        return -AW_EINVAL;
+    }
+    p_client->p_desc   = p_desc;
+    p_client->desc_num = desc_num;
+    p_client->count    = count;
+    p_client->stat     = -EINPROGRESS;
+
+    host_os_ilock();
+    if (NULL != p_req->p_client) {
+        host_os_iunlock();
+        return -EBUSY;
+    }
+    p_req->p_client = p_client;
+    rtk_tick_down_counter_init(&p_req->tmr);
+    rtk_tick_down_counter_set_func(&p_req->tmr, __adc_done, p_req);
+    rtk_tick_down_counter_start(&p_req->tmr, 1);
+    host_os_iunlock();
+    return AW_OK;
+}
+
+aw_err_t aw_adc_client_cancel (aw_adc_client_t *p_client)
+{
+    struct __host_adc_req *p_req = &__g_adc_req[p_client->channel];
+
+    host_os_ilock();
+    if (p_client == p_req->p_client) {
+        rtk_tick_down_counter_stop(&p_req->tmr);
+        p_req->p_client = NULL;
+    }
+    host_os_iunlock();
+    return AW_OK;
+}
+
+void host_adc_set (int ch, uint32_t mv)
+{
+    if ((ch >= 0) && (ch < __HOST_ADC_NUM)) {
+        __g_adc_mv[ch] = (mv > __HOST_ADC_VREF) ? __HOST_ADC_VREF : mv;
+    }
+}
+
+/*******************************************************************************
+  PWM
+*******************************************************************************/
+static struct __host_pwm {
+    uint32_t duty_ns;
+    uint32_t period_ns;
+    int      enabled;
+} __g_pwm[__HOST_PWM_NUM];
+
+aw_err_t aw_pwm_config (int pid, unsigned long duty_ns, unsigned long period_ns)
+{
+    if ((pid < 0) || (pid >= __HOST_PWM_NUM) || (duty_ns > period_ns)) {
+        return -AW_EINVAL;
+    }
+    __g_pwm[pid].duty_ns   = duty_ns;
+    __g_pwm[pid].period_ns = period_ns;
+    return AW_OK;
+}
+
+aw_err_t aw_pwm_enable (int pid)
+{
+    if ((pid < 0) || (pid >= __HOST_PWM_NUM)) {
+        return -AW_EINVAL;
+    }
+    __g_pwm[pid].enabled = TRUE;
+    return AW_OK;
+}
+
+aw_err_t aw_pwm_disable (int pid)
+{
+    if ((pid < 0) || (pid >= __HOST_PWM_NUM)) {
+        return -AW_EINVAL;
+    }
+    __g_pwm[pid].enabled = FALSE;
+    return AW_OK;
+}
+
+int host_pwm_get (int pid, uint32_t *p_duty_ns, uint32_t *p_period_ns)
+{
+    if ((pid < 0) || (pid >= __HOST_PWM_NUM)) {
+        return 0;
+    }
+    if (p_duty_ns) {
+        *p_duty_ns = __g_pwm[pid].duty_ns;
+    }
+    if (p_period_ns) {
+        *p_period_ns = __g_pwm[pid].period_ns;
+    }
+    return __g_pwm[pid].enabled;
+}
+
+/*******************************************************************************
+  硬件定时器（独立的 timerfd 线程）
+*******************************************************************************/
+static struct __host_hwtimer {
+    int               used;
+    void            (*pfn_isr) (void *p_arg);
+    void             *p_arg;
+    uint32_t          min_freq;
+    uint32_t          max_freq;
+    void             *p_timer;
+} __g_hwtimer[__HOST_HWTIMER_NUM];
+
+static void __hwtimer_isr (void *p_arg)
+{
+    struct __host_hwtimer *p_tmr = p_arg;
+
+    enter_int_context();
+    p_tmr->pfn_isr(p_tmr->p_arg);
+    exit_int_context();
+}
+
+aw_hwtimer_handle_t aw_hwtimer_alloc (uint32_t  freq,
+                                      uint32_t  min_freq,
+                                      uint32_t  max_freq,
+                                      uint32_t  features,
+                                      void    (*pfunc_isr) (void *p_arg),
+                                      void     *p_arg)
+{
+    int i;
+
+    for (i = 0; i < __HOST_HWTIMER_NUM; i++) {
+        if (!__g_hwtimer[i].used) {
+            __g_hwtimer[i].used     = TRUE;
+            __g_hwtimer[i].pfn_isr  = pfunc_isr;
+            __g_hwtimer[i].p_arg    = p_arg;
+            __g_hwtimer[i].min_freq = min_freq;
+            __g_hwtimer[i].max_freq = max_freq;
+            return &__g_hwtimer[i];
+        }
+    }
+    return AW_HWTIMER_NULL;
+}
+
+aw_err_t aw_hwtimer_release (aw_hwtimer_handle_t timer)
+{
+    struct __host_hwtimer *p_tmr = timer;
+
+    aw_hwtimer_disable(timer);
+    p_tmr->used = FALSE;
+    return AW_OK;
+}
+
+aw_err_t aw_hwtimer_enable (aw_hwtimer_handle_t timer, uint32_t frequency_hz)
+{
+    struct __host_hwtimer *p_tmr = timer;
+
+    if ((0 == frequency_hz) || (frequency_hz > 100000)) {
+        return -AW_EINVAL;
+    }
+    aw_hwtimer_disable(timer);
+    p_tmr->p_timer = host_os_timer_start(1000000000u / frequency_hz, __hwtimer_isr, p_tmr);
+    return (NULL != p_tmr->p_timer) ? AW_OK : -ENOMEM;
+}
+
+aw_err_t aw_hwtimer_disable (aw_hwtimer_handle_t timer)
+{
+    struct __host_hwtimer *p_tmr = timer;
+
+    if (NULL != p_tmr->p_timer) {
+        host_os_timer_stop(p_tmr->p_timer);
+        p_tmr->p_timer = NULL;
+    }
+    return AW_OK;
+}
+
+/*******************************************************************************
+  NVRAM（每个存储段一个文件）
+*******************************************************************************/
+static void __nvram_path (char *p_path, int len, const char *p_name, int unit)
+{
+    snprintf(p_path, len, "%s/nvram/%s.%d", __gp_dir, p_name, unit);
+}
+
+aw_err_t aw_nvram_get (char *p_name, int unit, char *p_buf, int offset, int len)
+{
+    char path[256];
+
+    if ((NULL == p_name) || (NULL == p_buf) || (offset < 0) || (len < 0)) {
+        return -AW_EINVAL;
+    }
+    __nvram_path(path, sizeof(path), p_name, unit);
+    return (0 == host_os_file_read(path, offset, p_buf, len)) ? AW_OK : -EIO;
+}
+
+aw_err_t aw_nvram_set (char *p_name, int unit, char *p_buf, int offset, int len)
+{
+    char path[256];
+
+    if ((NULL == p_name) || (NULL == p_buf) || (offset < 0) || (len < 0)) {
+        return -AW_EINVAL;
+    }
+    __nvram_path(path, sizeof(path), p_name, unit);
+    return (0 == host_os_file_write(path, offset, p_buf, len)) ? AW_OK : -EIO;
+}
+
+aw_err_t awbl_spi_flash_nvram_erase (char *p_name, int unit, int offset, int len)
+{
+    char path[256];
+    char ff[4096];                      /* 擦除块大小， 同目标板SPI Flash */
+    int  n;
+
+    if ((NULL == p_name) || (offset < 0) || (len < 0) ||
+        (offset % sizeof(ff)) || (len % sizeof(ff))) {
+        return -AW_EINVAL;
+    }
+    __nvram_path(path, sizeof(path), p_name, unit);
+    memset(ff, 0xFF, sizeof(ff));
+    for (n = 0; n < len; n += sizeof(ff)) {
+        if (0 != host_os_file_write(path, offset + n, ff, sizeof(ff))) {
+            return -EIO;
+        }
+    }
+    return AW_OK;
+}
+
+/*******************************************************************************
+  看门狗（只模拟一个， 超时即复位）
+*******************************************************************************/
+static struct rtk_tick   __g_wdt_tmr;
+static struct awbl_wdt  *__gp_wdt;
+
+static void __wdt_timeout (void *p_arg)
+{
+    host_sim_reset("watchdog");
+}
+
+aw_err_t aw_wdt_add (struct awbl_wdt *p_wdt, uint32_t t_ms)
+{
+    if ((NULL == p_wdt) || (0 == t_ms)) {
+        return -AW_EINVAL;
+    }
+    if (NULL != __gp_wdt) {
+        return -AW_EPERM;
+    }
+    p_wdt->period_ms = t_ms;
+    __gp_wdt         = p_wdt;
+    rtk_tick_down_counter_init(&__g_wdt_tmr);
+    rtk_tick_down_counter_set_func(&__g_wdt_tmr, __wdt_timeout, NULL);
+    rtk_tick_down_counter_start(&__g_wdt_tmr, aw_ms_to_ticks(t_ms));
+    return AW_OK;
+}
+
+aw_err_t aw_wdt_feed (struct awbl_wdt *p_wdt)
+{
+    if ((NULL == p_wdt) || (p_wdt != __gp_wdt)) {
+        return -AW_EINVAL;
+    }
+    rtk_tick_down_counter_start(&__g_wdt_tmr, aw_ms_to_ticks(p_wdt->period_ms));
+    return AW_OK;
+}
+
+/*******************************************************************************
+  RTC、 时间
+*******************************************************************************/
+static int64_t __g_rtc_offset;      /* RTC 相对主机时间的偏移（s） */
+
+static void __tm_to_array (const aw_tm_t *p_tm, int tm[9])
+{
+    tm[0] = p_tm->tm_sec;
+    tm[1] = p_tm->tm_min;
+    tm[2] = p_tm->tm_hour;
+    tm[3] = p_tm->tm_mday;
+    tm[4] = p_tm->tm_mon;
+    tm[5] = p_tm->tm_year;
+    tm[6] = p_tm->tm_wday;
+    tm[7] = p_tm->tm_yday;
+    tm[8] = p_tm->tm_isdst;
+}
+
+static void __array_to_tm (const int tm[9], aw_tm_t *p_tm)
+{
+    p_tm->tm_sec   = tm[0];
+    p_tm->tm_min   = tm[1];
+    p_tm->tm_hour  = tm[2];
+    p_tm->tm_mday  = tm[3];
+    p_tm->tm_mon   = tm[4];
+    p_tm->tm_year  = tm[5];
+    p_tm->tm_wday  = tm[6];
+    p_tm->tm_yday  = tm[7];
+    p_tm->tm_isdst = tm[8];
+}
+
+aw_err_t aw_tm_to_time (aw_tm_t *p_tm, aw_time_t *p_time)
+{
+    int tm[9];
+
+    __tm_to_array(p_tm, tm);
+    *p_time = (aw_time_t)host_os_timegm(tm);
+    return AW_OK;
+}
+
+aw_err_t aw_time_to_tm (aw_time_t *p_time, aw_tm_t *p_tm)
+{
+    int tm[9];
+
+    host_os_gmtime((int64_t)*p_time, tm);
+    __array_to_tm(tm, p_tm);
+    return AW_OK;
+}
+
+aw_err_t aw_rtc_time_get (int rtc_id, aw_tm_t *p_tm)
+{
+    int tm[9];
+
+    host_os_gmtime(host_os_time() + __g_rtc_offset, tm);
+    __array_to_tm(tm, p_tm);
+    return AW_OK;
+}
+
+aw_err_t aw_rtc_time_set (int rtc_id, aw_tm_t *p_tm)
+{
+    int tm[9];
+
+    __tm_to_array(p_tm, tm);
+    __g_rtc_offset = host_os_timegm(tm) - host_os_time();
+    return AW_OK;
+}
+
+/*******************************************************************************
+  芯片唯一ID
+*******************************************************************************/
+amhw_iap_stat_t amhw_iap_unique_id_read (uint32_t uid[4])
+{
+    uid[0] = 0x484F5354;        /* "HOST" */
+    uid[1] = 0x41435031;        /* "ACP1" */
+    uid[2] = 0x30303000;
+    uid[3] = 0x00000001;
+    return AMHW_IAP_STAT_SUCCESS;
+}
+
+/*******************************************************************************
+  shell 命令表
+*******************************************************************************/
+static struct aw_shell_cmd_list *__gp_cmd_lists;
+
+aw_err_t aw_shell_register_cmds (struct aw_shell_cmd_list  *list,
+                                 const struct aw_shell_cmd *start,
+                                 const struct aw_shell_cmd *end)
+{
+    list->start    = start;
+    list->end      = end;
+    list->next     = __gp_cmd_lists;
+    __gp_cmd_lists = list;
+    return AW_OK;
+}
+
+int host_shell_exec (char *p_line)
+{
+    struct aw_shell_cmd_list  *p_list;
+    const struct aw_shell_cmd *p_cmd;
+    char                      *argv[16];
+    int                        argc = 0;
+    char                      *p    = p_line;
+
+    while ((argc < (int)AW_NELEMENTS(argv)) && ('\0' != *p)) {
+        while ((' ' == *p) || ('\t' == *p)) {
+            *p++ = '\0';
+        }
+        if ('\0' == *p) {
+            break;
+        }
+        argv[argc++] = p;
+        while (('\0' != *p) && (' ' != *p) && ('\t' != *p)) {
+            p++;
+        }
+    }
+    if (0 == argc) {
+        return 0;
+    }
+
+    for (p_list = __gp_cmd_lists; NULL != p_list; p_list = p_list->next) {
+        for (p_cmd = p_list->start; p_cmd < p_list->end; p_cmd++) {
+            if (0 == strcmp(p_cmd->name, argv[0])) {
+                return p_cmd->entry(argc - 1, &argv[1], NULL);
+            }
+        }
+    }
+    return -1;
+}
+
+/*******************************************************************************
+  初始化
+*******************************************************************************/
+static void __tick_isr (void)
+{
+    rtk_tick_down_counter_announce();
+}
+
+void host_sim_panic (const char *p_msg)
+{
+    aw_kprintf("host: %s\r\n", p_msg);
+    host_os_exit(1);
+}
+
+void host_sim_reset (const char *p_why)
+{
+    char path[256];
+
+    aw_kprintf("host: reset (%s)\r\n", p_why);
+    snprintf(path, sizeof(path), "%s/noinit", __gp_dir);
+    host_os_noinit_save(path);
+    host_os_exit(3);
+}
+
+const char *host_sim_dir (void)
+{
+    return __gp_dir;
+}
+
+void host_sim_init (void)
+{
+    static TASK_INFO_DEF(defer_task, 256);
+    char path[256];
+
+    host_os_init();
+
+    __gp_dir = host_os_getenv("ACP1000_HOST_DIR", "./acp1000_run");
+    snprintf(path, sizeof(path), "%s/nvram", __gp_dir);
+    if ((0 != host_os_mkdir(__gp_dir)) || (0 != host_os_mkdir(path))) {
+        host_sim_panic("cannot create run directory");
+    }
+
+    /* 上次为复位退出时恢复不清零的RAM */
+    snprintf(path, sizeof(path), "%s/noinit", __gp_dir);
+    if (0 == host_os_noinit_load(path)) {
+        aw_kprintf("host: warm start, .noinit restored\r\n");
+    }
+
+    semc_init(&__g_defer_sem, 0);
+    task_init(&defer_task.tcb, "isr_defer", 0, 0,
+              defer_task.stack, defer_task.stack + sizeof(defer_task.stack),
+              (void *)__defer_task_entry, NULL, NULL);
+    task_startup(&defer_task.tcb);
+
+    if (0 != host_os_tick_start(__tick_isr)) {
+        host_sim_panic("cannot start tick");
+    }
+}
+
+/* end of file */
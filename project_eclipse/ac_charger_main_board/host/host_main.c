@@ -0,0 +1,151 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 主机构建入口
+ *
+ * 在 Linux 上运行完整的应用（acp_main_startup）， 任务映射为线程， 串口映射为
+ * 伪终端， 外设由板级模型和控制台命令驱动。 用于不接目标板调试协议、 运行
+ * 电表/读卡器/后台仿真器和性能测试。
+ *
+ * 构建： 在 host 目录执行 make（见 Makefile）， 输出 build/acp1000_host 及电表、
+ * 后台、 读卡器仿真器。 运行目录默认为 ./acp1000_run（见 host_sim.h）。
+ *
+ * 控制台命令（其余输入交给应用注册的 shell 命令）：
+ *  - .cp <12|9|6|0>        设置检测点1电压
+ *  - .ac <ms>              设置接触器动作时间， -1 为不动作
+ *  - .pin <pin> [0|1]      读取/设置引脚（引脚号为 PIOn_m 的数值）
+ *  - .adc <ch> <mV>        设置 ADC 输入电压
+ *  - .pwm <pid>            读取 PWM 输出
+ *  - .bench <n> [ms]       运行 n 次充电流程性能测试， 每次充电 ms（默认 2000）
+ *  - .reset                复位（保存不清零的RAM， 下次启动时恢复）
+ *  - .fault                模拟硬件异常（黑匣子记录后复位）
+ *  - .quit                 退出
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-08  xjc, first implementation
+ * - 1.01 16-10-12  xjc, 增加 .bench 命令
+ * - 1.02 16-10-13  xjc, 等待命令行输入时产生任务切出、 切入事件
+ * - 1.03 16-10-16  xjc, 增加 .reset、 .fault 命令
+ * - 1.04 16-10-18  xjc, 改由 Makefile 构建（-Wall）
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include <stdlib.h>
+#include <string.h>
+#include "aw_delay.h"
+#include "aw_vdebug.h"
+#include "host_os.h"
+#include "host_sim.h"
+#include "blackbox.h"
+
+void acp_main_startup (void);
+
+static int __cmd_exec (char *p_line)
+{
+    char     *argv[4] = {NULL};
+    char     *p_save  = NULL;
+    int       argc    = 0;
+    uint32_t  duty, period;
+
+    if ('.' != p_line[0]) {
+        return host_shell_exec(p_line);
+    }
+
+    p_line = strtok_r(p_line, " \t", &p_save);
+    while ((NULL != p_line) && (argc < (int)AW_NELEMENTS(argv))) {
+        argv[argc++] = p_line;
+        p_line       = strtok_r(NULL, " \t", &p_save);
+    }
+
+    if ((0 == strcmp(argv[0], ".cp")) && (argc >= 2)) {
+        host_board_cp_set(atoi(argv[1]));
+
+    } else if ((0 == strcmp(argv[0], ".ac")) && (argc >= 2)) {
+        host_board_contactor_ms_set(atoi(argv[1]));
+
+    } else if ((0 == strcmp(argv[0], ".pin")) && (argc >= 2)) {
+        if (argc >= 3) {
+            host_gpio_input_set(atoi(argv[1]), atoi(argv[2]));
+        }
+        aw_kprintf("pin %d = %d\r\n", atoi(argv[1]), host_gpio_level_get(atoi(argv[1])));
+
+    } else if ((0 == strcmp(argv[0], ".adc")) && (argc >= 3)) {
+        host_adc_set(atoi(argv[1]), atoi(argv[2]));
+
+    } else if ((0 == strcmp(argv[0], ".pwm")) && (argc >= 2)) {
+        int en = host_pwm_get(atoi(argv[1]), &duty, &period);
+
+        aw_kprintf("pwm %d: %s duty %u ns period %u ns\r\n",
+                   atoi(argv[1]), en ? "on" : "off", duty, period);
+
+    } else if ((0 == strcmp(argv[0], ".bench")) && (argc >= 2)) {
+        host_bench_run(atoi(argv[1]), (argc >= 3) ? atoi(argv[2]) : 2000);
+
+    } else if (0 == strcmp(argv[0], ".reset")) {
+        host_sim_reset("console");
+
+#if ACP1000_BLACKBOX
+    } else if (0 == strcmp(argv[0], ".fault")) {
+        uint32_t frame[8] = {0};
+
+        /* 栈帧 r0 r1 r2 r3 r12 lr pc xpsr， pc 取本函数地址 */
+        frame[6] = (uint32_t)(uintptr_t)__cmd_exec;
+        frame[7] = 0x01000000;
+        blackbox_fault(frame, 0xFFFFFFFD);
+        host_sim_reset("hard fault");
+#endif
+
+    } else if (0 == strcmp(argv[0], ".quit")) {
+        host_os_exit(0);
+
+    } else {
+        return -1;
+    }
+    return 0;
+}
+
+int main (void)
+{
+    char line[256];
+
+    host_sim_init();
+    host_board_init();
+
+    aw_kprintf("Start up successful, host build!\r\n");
+    acp_main_startup();
+
+    while (1) {
+        host_task_block(1);
+        if (host_os_readline(line, sizeof(line)) < 0) {
+            host_task_block(0);
+            break;
+        }
+        host_task_block(0);
+        if ('\0' == line[0]) {
+            continue;
+        }
+        if (-1 == __cmd_exec(line)) {
+            aw_kprintf("unknown command: %s\r\n", line);
+        }
+    }
+
+    /* 标准输入结束后继续运行（后台运行时） */
+    AW_FOREVER {
+        aw_mdelay(1000);
+    }
+}
+
+/* end of file */
@@ -0,0 +1,391 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 主机移植的 Modbus-RTU 从站
+ *
+ * 目标板使用的 Modbus 库只有 ARM 二进制， 主机构建用本文件实现应用用到的
+ * 从站接口： 保持/输入寄存器（功能码 3、 4、 6、 16）经注册的回调处理，
+ * 其它功能码经 aw_mb_slave_register_handler 注册的处理函数处理。
+ * aw_mb_slave_poll 阻塞到收到一帧并应答后返回。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-08  xjc, first implementation
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include <string.h>
+#include "aw_serial.h"
+#include "aw_delay.h"
+#include "aw_sio_common.h"
+#include "aw_ioctl.h"
+#include "modbus/aw_mb_slave.h"
+#include "modbus/aw_mb_utils.h"
+#include "host_sim.h"
+
+#define __MB_SLAVE_NUM          2
+#define __MB_HANDLER_NUM        8
+#define __MB_ADU_SIZE_MAX       256
+#define __MB_RTU_GAP_MS         5       /* 帧间隔（伪终端上不按波特率计算） */
+
+struct __host_mb_slave {
+    int                             used;
+    int                             started;
+    uint8_t                         addr;
+    uint8_t                         port;
+    aw_mb_slave_fn_code_callback_t  pfn_hold_rd;
+    aw_mb_slave_fn_code_callback_t  pfn_hold_wr;
+    aw_mb_slave_fn_code_callback_t  pfn_input_rd;
+    struct {
+        uint8_t                     funcode;
+        aw_mb_fn_code_handler_t     pfn_handler;
+    } handlers[__MB_HANDLER_NUM];
+    uint8_t                         adu[__MB_ADU_SIZE_MAX];
+};
+
+static struct __host_mb_slave __g_mb_slave[__MB_SLAVE_NUM];
+
+/******************************************************************************/
+static uint16_t __mb_crc16 (const uint8_t *p_buf, int len)
+{
+    uint16_t crc = 0xFFFF;
+    int      i;
+
+    while (len-- > 0) {
+        crc ^= *p_buf++;
+        for (i = 0; i < 8; i++) {
+            crc = (crc & 1) ? ((crc >> 1) ^ 0xA001) : (crc >> 1);
+        }
+    }
+    return crc;
+}
+
+void aw_mb_regcpy (void *p_dst, const void *p_src, uint16_t num_reg)
+{
+    uint8_t       *p_d = p_dst;
+    const uint8_t *p_s = p_src;
+    uint8_t        tmp;
+
+    while (num_reg-- > 0) {
+        tmp    = p_s[0];        /* 允许原地转换 */
+        p_d[0] = p_s[1];
+        p_d[1] = tmp;
+        p_d   += 2;
+        p_s   += 2;
+    }
+}
+
+/******************************************************************************/
+aw_mb_slave_t aw_mb_slave_init (enum aw_mb_mode  mode,
+                                void            *p_param,
+                                aw_mb_err_t     *p_err)
+{
+    struct aw_mb_serial_param *p_ser = p_param;
+    struct __host_mb_slave    *p_slave = NULL;
+    aw_mb_err_t                err     = AW_MB_ERR_NOERR;
+    uint32_t                   opts    = CLOCAL | CREAD | CS8;
+    int                        i;
+
+    if (AW_MB_RTU != mode) {
+        err = AW_MB_ERR_MODE_NO_SUPPORT;
+        goto __exit;
+    }
+    if (NULL == p_ser) {
+        err = AW_MB_ERR_EINVAL;
+        goto __exit;
+    }
+    for (i = 0; i < __MB_SLAVE_NUM; i++) {
+        if (!__g_mb_slave[i].used) {
+            p_slave = &__g_mb_slave[i];
+            break;
+        }
+    }
+    if (NULL == p_slave) {
+        err = AW_MB_ERR_ALLOC_FAIL;
+        goto __exit;
+    }
+
+    if (AW_MB_PAR_EVEN == p_ser->parity) {
+        opts |= PARENB;
+    } else if (AW_MB_PAR_ODD == p_ser->parity) {
+        opts |= PARENB | PARODD;
+    }
+    if ((AW_OK != aw_serial_ioctl(p_ser->port,
+                                  SIO_BAUD_SET,
+                                  (void *)(unsigned long)p_ser->baud_rate)) ||
+        (AW_OK != aw_serial_ioctl(p_ser->port,
+                                  SIO_HW_OPTS_SET,
+                                  (void *)(unsigned long)opts))) {
+        err = AW_MB_ERR_EPORTERR;
+        p_slave = NULL;
+        goto __exit;
+    }
+
+    memset(p_slave, 0, sizeof(*p_slave));
+    p_slave->used = TRUE;
+    p_slave->addr = p_ser->slave_addr;
+    p_slave->port = p_ser->port;
+
+__exit:
+    if (NULL != p_err) {
+        *p_err = err;
+    }
+    return p_slave;
+}
+
+aw_mb_err_t aw_mb_slave_close (aw_mb_slave_t slave)
+{
+    struct __host_mb_slave *p_slave = slave;
+
+    if (NULL == p_slave) {
+        return AW_MB_ERR_EINVAL;
+    }
+    p_slave->used = FALSE;
+    return AW_MB_ERR_NOERR;
+}
+
+aw_mb_err_t aw_mb_slave_start (aw_mb_slave_t slave)
+{
+    struct __host_mb_slave *p_slave = slave;
+
+    if (NULL == p_slave) {
+        return AW_MB_ERR_EINVAL;
+    }
+    p_slave->started = TRUE;
+    return AW_MB_ERR_NOERR;
+}
+
+aw_mb_err_t aw_mb_slave_stop (aw_mb_slave_t slave)
+{
+    struct __host_mb_slave *p_slave = slave;
+
+    if (NULL == p_slave) {
+        return AW_MB_ERR_EINVAL;
+    }
+    p_slave->started = FALSE;
+    return AW_MB_ERR_NOERR;
+}
+
+aw_mb_err_t aw_mb_slave_set_addr (aw_mb_slave_t slave, uint8_t addr)
+{
+    struct __host_mb_slave *p_slave = slave;
+
+    if ((NULL == p_slave) ||
+        (addr < AW_MB_ADDRESS_MIN) || (addr > AW_MB_ADDRESS_MAX)) {
+        return AW_MB_ERR_EINVAL;
+    }
+    p_slave->addr = addr;
+    return AW_MB_ERR_NOERR;
+}
+
+aw_mb_err_t aw_mb_slave_register_callback (
+    aw_mb_slave_t                  slave,
+    enum aw_mb_func_cb_type        type,
+    enum aw_mb_func_cb_op          op,
+    aw_mb_slave_fn_code_callback_t callback)
+{
+    struct __host_mb_slave *p_slave = slave;
+
+    if (NULL == p_slave) {
+        return AW_MB_ERR_EINVAL;
+    }
+    if (AW_MB_FUNC_HOLDREGISTERS_CALLBACK == type) {
+        if (AW_MB_FUNC_CALLBACK_READ == op) {
+            p_slave->pfn_hold_rd = callback;
+        } else {
+            p_slave->pfn_hold_wr = callback;
+        }
+    } else if ((AW_MB_FUNC_INPUTREGISTERS_CALLBACK == type) &&
+               (AW_MB_FUNC_CALLBACK_READ == op)) {
+        p_slave->pfn_input_rd = callback;
+    } else {
+        return AW_MB_ERR_EINVAL;
+    }
+    return AW_MB_ERR_NOERR;
+}
+
+aw_mb_err_t aw_mb_slave_register_handler (aw_mb_slave_t            slave,
+                                          uint8_t                  funcode,
+                                          aw_mb_fn_code_handler_t  handler)
+{
+    struct __host_mb_slave *p_slave = slave;
+    int                     i, idle = -1;
+
+    if ((NULL == p_slave) || (0 == funcode)) {
+        return AW_MB_ERR_EINVAL;
+    }
+    for (i = 0; i < __MB_HANDLER_NUM; i++) {
+        if (funcode == p_slave->handlers[i].funcode) {
+            p_slave->handlers[i].pfn_handler = handler;
+            return AW_MB_ERR_NOERR;
+        }
+        if ((idle < 0) && (0 == p_slave->handlers[i].funcode)) {
+            idle = i;
+        }
+    }
+    if (idle < 0) {
+        return AW_MB_ERR_ENORES;
+    }
+    p_slave->handlers[idle].funcode     = funcode;
+    p_slave->handlers[idle].pfn_handler = handler;
+    return AW_MB_ERR_NOERR;
+}
+
+/******************************************************************************/
+static aw_mb_exception_t __mb_reg_read (struct __host_mb_slave         *p_slave,
+                                        aw_mb_slave_fn_code_callback_t  pfn_cb,
+                                        uint8_t                        *p_pdu,
+                                        uint16_t                       *p_len)
+{
+    uint16_t addr, num;
+
+    if (NULL == pfn_cb) {
+        return AW_MB_EXP_ILLEGAL_FUNCTION;
+    }
+    if (*p_len != 5) {
+        return AW_MB_EXP_ILLEGAL_DATA_VALUE;
+    }
+    addr = (p_pdu[1] << 8) | p_pdu[2];
+    num  = (p_pdu[3] << 8) | p_pdu[4];
+    if ((num < 1) || (num > 125)) {
+        return AW_MB_EXP_ILLEGAL_DATA_VALUE;
+    }
+    p_pdu[1] = num * 2;
+    *p_len   = 2 + num * 2;
+    return pfn_cb(p_slave, &p_pdu[2], addr, num);
+}
+
+static aw_mb_exception_t __mb_reg_write (struct __host_mb_slave *p_slave,
+                                         uint8_t                *p_pdu,
+                                         uint16_t               *p_len)
+{
+    uint16_t addr, num;
+
+    if (NULL == p_slave->pfn_hold_wr) {
+        return AW_MB_EXP_ILLEGAL_FUNCTION;
+    }
+    addr = (p_pdu[1] << 8) | p_pdu[2];
+
+    if (AW_MB_FUNC_WRITE_REGISTER == p_pdu[0]) {
+        uint8_t val[2];
+
+        if (*p_len != 5) {
+            return AW_MB_EXP_ILLEGAL_DATA_VALUE;
+        }
+        /* 应答与请求相同 */
+        val[0] = p_pdu[3];
+        val[1] = p_pdu[4];
+        return p_slave->pfn_hold_wr(p_slave, val, addr, 1);
+    }
+
+    num = (p_pdu[3] << 8) | p_pdu[4];
+    if ((num < 1) || (num > 123) ||
+        (p_pdu[5] != num * 2) || (*p_len != 6 + num * 2)) {
+        return AW_MB_EXP_ILLEGAL_DATA_VALUE;
+    }
+    *p_len = 5;
+    return p_slave->pfn_hold_wr(p_slave, &p_pdu[6], addr, num);
+}
+
+static aw_mb_exception_t __mb_pdu_process (struct __host_mb_slave *p_slave,
+                                           uint8_t                *p_pdu,
+                                           uint16_t               *p_len)
+{
+    int i;
+
+    for (i = 0; i < __MB_HANDLER_NUM; i++) {
+        if ((p_pdu[0] == p_slave->handlers[i].funcode) &&
+            (NULL != p_slave->handlers[i].pfn_handler)) {
+            return p_slave->handlers[i].pfn_handler(p_slave, p_pdu, p_len);
+        }
+    }
+
+    switch (p_pdu[0]) {
+
+    case AW_MB_FUNC_READ_HOLDING_REGISTER:
+        return __mb_reg_read(p_slave, p_slave->pfn_hold_rd, p_pdu, p_len);
+
+    case AW_MB_FUNC_READ_INPUT_REGISTER:
+        return __mb_reg_read(p_slave, p_slave->pfn_input_rd, p_pdu, p_len);
+
+    case AW_MB_FUNC_WRITE_REGISTER:
+    case AW_MB_FUNC_WRITE_MULTIPLE_REGISTERS:
+        return __mb_reg_write(p_slave, p_pdu, p_len);
+
+    default:
+        return AW_MB_EXP_ILLEGAL_FUNCTION;
+    }
+}
+
+aw_mb_err_t aw_mb_slave_poll (aw_mb_slave_t slave)
+{
+    struct __host_mb_slave *p_slave = slave;
+    uint8_t                *p_adu;
+    aw_mb_exception_t       exp;
+    uint16_t                pdu_len;
+    uint16_t                crc;
+    int                     len, n;
+
+    if ((NULL == p_slave) || !p_slave->started) {
+        aw_mdelay(10);
+        return AW_MB_ERR_EILLSTATE;
+    }
+    p_adu = p_slave->adu;
+
+    /* 等待帧的第一个字节， 之后以帧间隔判断帧结束 */
+    aw_serial_ioctl(p_slave->port, AW_TIOCRDTIMEOUT, (void *)0);
+    if (1 != aw_serial_read(p_slave->port, (char *)p_adu, 1)) {
+        aw_mdelay(10);
+        return AW_MB_ERR_EIO;
+    }
+    aw_serial_ioctl(p_slave->port, AW_TIOCRDTIMEOUT, (void *)__MB_RTU_GAP_MS);
+    n = aw_serial_read(p_slave->port, (char *)&p_adu[1], __MB_ADU_SIZE_MAX - 1);
+    len = 1 + ((n > 0) ? n : 0);
+
+    if (len < 4) {
+        return AW_MB_ERR_EFRAME_LEN;
+    }
+    crc = __mb_crc16(p_adu, len - 2);
+    if ((p_adu[len - 2] != (crc & 0xFF)) || (p_adu[len - 1] != (crc >> 8))) {
+        return AW_MB_ERR_ECRC;
+    }
+    if ((p_adu[0] != p_slave->addr) && (p_adu[0] != AW_MB_ADDRESS_BROADCAST)) {
+        return AW_MB_ERR_NOERR;
+    }
+
+    pdu_len = len - 3;
+    exp     = __mb_pdu_process(p_slave, &p_adu[1], &pdu_len);
+
+    /* 广播不应答 */
+    if (AW_MB_ADDRESS_BROADCAST == p_adu[0]) {
+        return AW_MB_ERR_NOERR;
+    }
+    if (AW_MB_EXP_NONE != exp) {
+        p_adu[1] |= AW_MB_FUNC_ERROR;
+        p_adu[2]  = exp;
+        pdu_len   = 2;
+    }
+    len = 1 + pdu_len;
+    crc = __mb_crc16(p_adu, len);
+    p_adu[len++] = crc & 0xFF;
+    p_adu[len++] = crc >> 8;
+
+    if (len != aw_serial_write(p_slave->port, (char *)p_adu, len)) {
+        return AW_MB_ERR_EIO;
+    }
+    return AW_MB_ERR_NOERR;
+}
+
+/* end of file */
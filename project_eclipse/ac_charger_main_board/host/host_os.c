@@ -0,0 +1,779 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 主机移植的操作系统接口（pthread、 timerfd、 终端、 文件）
+ *
+ * 本文件只包含系统头文件。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-08  xjc, first implementation
+ * - 1.01 16-10-12  xjc, 增加线程 CPU 时钟
+ * - 1.02 16-10-13  xjc, 线程使用涂色的堆栈， 可检查堆栈高水位
+ * - 1.03 16-10-16  xjc, 增加 .noinit 段的保存、 恢复
+ * \endinternal
+ */
+
+#define _GNU_SOURCE
+
+#include <elf.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <link.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/timerfd.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "host_os.h"
+
+static uint64_t          __g_start_ns;
+static pthread_mutex_t   __g_klock;
+static pthread_mutex_t   __g_ilock;
+static __thread void    *__gp_self;
+static __thread char    *__gp_stack_low;    /* 涂色区低端 */
+static __thread uint32_t __g_stack_size;    /* 涂色区大小 */
+
+static uint64_t __mono_ns (void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+void host_os_init (void)
+{
+    pthread_mutexattr_t attr;
+
+    __g_start_ns = __mono_ns();
+
+    pthread_mutex_init(&__g_klock, NULL);
+
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&__g_ilock, &attr);
+    pthread_mutexattr_destroy(&attr);
+
+    setvbuf(stdout, NULL, _IOLBF, 0);
+}
+
+uint64_t host_os_ns (void)
+{
+    return __mono_ns() - __g_start_ns;
+}
+
+uint32_t host_os_ms (void)
+{
+    return (uint32_t)(host_os_ns() / 1000000ull);
+}
+
+void host_os_sleep_ms (uint32_t ms)
+{
+    struct timespec ts;
+
+    ts.tv_sec  = ms / 1000;
+    ts.tv_nsec = (long)(ms % 1000) * 1000000l;
+    while ((0 != nanosleep(&ts, &ts)) && (EINTR == errno)) {
+    }
+}
+
+void host_os_sleep_us (uint32_t us)
+{
+    struct timespec ts;
+
+    ts.tv_sec  = us / 1000000;
+    ts.tv_nsec = (long)(us % 1000000) * 1000l;
+    while ((0 != nanosleep(&ts, &ts)) && (EINTR == errno)) {
+    }
+}
+
+/******************************************************************************/
+#define __STACK_SIZE    (512 * 1024)    /* 线程堆栈 */
+#define __STACK_GUARD   4096            /* 低端保护页 */
+#define __STACK_PAINT   0xA5
+
+struct __thread_start {
+    void  (*pfn_entry) (void *p_arg);
+    void   *p_arg;
+    char    name[16];
+    char   *p_stack;                    /* NULL： 系统分配的堆栈 */
+};
+
+static void *__thread_entry (void *p_arg)
+{
+    struct __thread_start start = *(struct __thread_start *)p_arg;
+
+    free(p_arg);
+    if (NULL != start.p_stack) {
+        __gp_stack_low = start.p_stack + __STACK_GUARD;
+        __g_stack_size = __STACK_SIZE - __STACK_GUARD;
+    }
+    pthread_setname_np(pthread_self(), start.name);
+    start.pfn_entry(start.p_arg);
+    return NULL;
+}
+
+/**
+ * \brief 分配并涂色线程堆栈， 失败时返回 NULL（使用系统分配的堆栈）
+ */
+static char *__stack_alloc (void)
+{
+    char *p_stack = mmap(NULL,
+                         __STACK_SIZE,
+                         PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK,
+                         -1,
+                         0);
+
+    if (MAP_FAILED == p_stack) {
+        return NULL;
+    }
+    mprotect(p_stack, __STACK_GUARD, PROT_NONE);
+    memset(p_stack + __STACK_GUARD, __STACK_PAINT, __STACK_SIZE - __STACK_GUARD);
+    return p_stack;
+}
+
+int host_os_thread_create (const char *name,
+                           void      (*pfn_entry) (void *p_arg),
+                           void       *p_arg)
+{
+    struct __thread_start *p_start = malloc(sizeof(*p_start));
+    pthread_t              tid;
+    pthread_attr_t         attr;
+    int                    ret;
+
+    if (NULL == p_start) {
+        return -1;
+    }
+    p_start->pfn_entry = pfn_entry;
+    p_start->p_arg     = p_arg;
+    snprintf(p_start->name, sizeof(p_start->name), "%s", name ? name : "task");
+
+    p_start->p_stack = __stack_alloc();
+
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    if (NULL != p_start->p_stack) {
+        pthread_attr_setstack(&attr, p_start->p_stack, __STACK_SIZE);
+    }
+    ret = pthread_create(&tid, &attr, __thread_entry, p_start);
+    pthread_attr_destroy(&attr);
+    if (0 != ret) {
+        if (NULL != p_start->p_stack) {
+            munmap(p_start->p_stack, __STACK_SIZE);
+        }
+        free(p_start);
+        return -1;
+    }
+    return 0;
+}
+
+int host_os_stack_self (void **pp_low, uint32_t *p_size)
+{
+    if (NULL == __gp_stack_low) {
+        return -1;
+    }
+    *pp_low = __gp_stack_low;
+    *p_size = __g_stack_size;
+    return 0;
+}
+
+/* 可能读到其它线程活动栈帧的 ASAN 保护区， 不做检查 */
+__attribute__((no_sanitize_address))
+uint32_t host_os_stack_free (const void *p_low, uint32_t size)
+{
+    const volatile uint8_t *p = p_low;
+    uint32_t                i;
+
+    for (i = 0; (i < size) && (__STACK_PAINT == p[i]); i++) {
+    }
+    return i;
+}
+
+int host_os_cpu_clock_self (int *p_clock)
+{
+    clockid_t clock;
+
+    if (0 != pthread_getcpuclockid(pthread_self(), &clock)) {
+        return -1;
+    }
+    *p_clock = (int)clock;
+    return 0;
+}
+
+uint64_t host_os_cpu_ns (int clock)
+{
+    struct timespec ts;
+
+    if (0 != clock_gettime((clockid_t)clock, &ts)) {
+        return 0;
+    }
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+void host_os_self_set (void *p_self)
+{
+    __gp_self = p_self;
+}
+
+void *host_os_self_get (void)
+{
+    return __gp_self;
+}
+
+/******************************************************************************/
+void host_os_klock (void)
+{
+    pthread_mutex_lock(&__g_klock);
+}
+
+void host_os_kunlock (void)
+{
+    pthread_mutex_unlock(&__g_klock);
+}
+
+void *host_os_cond_new (void)
+{
+    pthread_cond_t     *p_cond = malloc(sizeof(*p_cond));
+    pthread_condattr_t  attr;
+
+    if (NULL != p_cond) {
+        pthread_condattr_init(&attr);
+        pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+        pthread_cond_init(p_cond, &attr);
+        pthread_condattr_destroy(&attr);
+    }
+    return p_cond;
+}
+
+int host_os_cond_wait (void *p_cond, int timeout_ms, uint64_t start_ns)
+{
+    struct timespec ts;
+    uint64_t        end;
+
+    if (timeout_ms < 0) {
+        pthread_cond_wait(p_cond, &__g_klock);
+        return 0;
+    }
+
+    end        = __g_start_ns + start_ns + (uint64_t)timeout_ms * 1000000ull;
+    ts.tv_sec  = end / 1000000000ull;
+    ts.tv_nsec = end % 1000000000ull;
+    return (ETIMEDOUT == pthread_cond_timedwait(p_cond, &__g_klock, &ts)) ? 1 : 0;
+}
+
+void host_os_cond_broadcast (void *p_cond)
+{
+    pthread_cond_broadcast(p_cond);
+}
+
+void host_os_ilock (void)
+{
+    pthread_mutex_lock(&__g_ilock);
+}
+
+void host_os_iunlock (void)
+{
+    pthread_mutex_unlock(&__g_ilock);
+}
+
+/******************************************************************************/
+static void (*__gpfn_tick) (void);
+
+static void __tick_entry (void *p_arg)
+{
+    int               fd = (int)(intptr_t)p_arg;
+    uint64_t          expirations;
+
+    while (1) {
+        if (sizeof(expirations) != read(fd, &expirations, sizeof(expirations))) {
+            continue;
+        }
+        /* 节拍处理按时刻比较， 错过的节拍合并为一次 */
+        __gpfn_tick();
+    }
+}
+
+int host_os_tick_start (void (*pfn_tick) (void))
+{
+    struct itimerspec its;
+    int               fd;
+
+    fd = timerfd_create(CLOCK_MONOTONIC, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    its.it_interval.tv_sec  = 0;
+    its.it_interval.tv_nsec = 1000000;
+    its.it_value            = its.it_interval;
+    if (0 != timerfd_settime(fd, 0, &its, NULL)) {
+        close(fd);
+        return -1;
+    }
+
+    __gpfn_tick = pfn_tick;
+    return host_os_thread_create("tick", __tick_entry, (void *)(intptr_t)fd);
+}
+
+struct __timer {
+    int              fd;
+    void           (*pfn_isr) (void *p_arg);
+    void            *p_arg;
+    volatile int     running;
+};
+
+static void __timer_entry (void *p_arg)
+{
+    struct __timer *p_timer = p_arg;
+    uint64_t        expirations;
+
+    while (1) {
+        if (sizeof(expirations) != read(p_timer->fd, &expirations, sizeof(expirations))) {
+            continue;
+        }
+        if (p_timer->running) {
+            p_timer->pfn_isr(p_timer->p_arg);
+        }
+    }
+}
+
+void *host_os_timer_start (uint32_t period_ns, void (*pfn_isr) (void *p_arg), void *p_arg)
+{
+    struct __timer    *p_timer = calloc(1, sizeof(*p_timer));
+    struct itimerspec  its;
+
+    if (NULL == p_timer) {
+        return NULL;
+    }
+    p_timer->fd = timerfd_create(CLOCK_MONOTONIC, 0);
+    if (p_timer->fd < 0) {
+        free(p_timer);
+        return NULL;
+    }
+    p_timer->pfn_isr = pfn_isr;
+    p_timer->p_arg   = p_arg;
+    p_timer->running = 1;
+
+    its.it_interval.tv_sec  = period_ns / 1000000000u;
+    its.it_interval.tv_nsec = period_ns % 1000000000u;
+    its.it_value            = its.it_interval;
+    if ((0 != timerfd_settime(p_timer->fd, 0, &its, NULL)) ||
+        (0 != host_os_thread_create("hwtimer", __timer_entry, p_timer))) {
+        close(p_timer->fd);
+        free(p_timer);
+        return NULL;
+    }
+    return p_timer;
+}
+
+void host_os_timer_stop (void *p_timer)
+{
+    struct __timer    *p = p_timer;
+    struct itimerspec  its;
+
+    /* 线程保留， 再次启动时重新分配 */
+    memset(&its, 0, sizeof(its));
+    p->running = 0;
+    timerfd_settime(p->fd, 0, &its, NULL);
+}
+
+/******************************************************************************/
+static void __tty_raw (int fd)
+{
+    struct termios tio;
+
+    if (0 == tcgetattr(fd, &tio)) {
+        cfmakeraw(&tio);
+        tio.c_cc[VMIN]  = 1;
+        tio.c_cc[VTIME] = 0;
+        tcsetattr(fd, TCSANOW, &tio);
+    }
+}
+
+int host_os_pty_open (char *p_slave, int len)
+{
+    int   fd;
+    char *p_name;
+
+    fd = posix_openpt(O_RDWR | O_NOCTTY);
+    if (fd < 0) {
+        return -1;
+    }
+    if ((0 != grantpt(fd)) || (0 != unlockpt(fd)) || (NULL == (p_name = ptsname(fd)))) {
+        close(fd);
+        return -1;
+    }
+    snprintf(p_slave, len, "%s", p_name);
+
+    /*
+     * 自己保持从端打开： 对端程序未打开时主端读不会返回EIO， 且原始模式一直有效
+     */
+    __tty_raw(open(p_name, O_RDWR | O_NOCTTY));
+    __tty_raw(fd);
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    return fd;
+}
+
+int host_os_tty_open (const char *p_path)
+{
+    int fd = open(p_path, O_RDWR | O_NOCTTY);
+
+    if (fd >= 0) {
+        __tty_raw(fd);
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    }
+    return fd;
+}
+
+static speed_t __baud_to_speed (uint32_t baud)
+{
+    switch (baud) {
+    case 1200:   return B1200;
+    case 2400:   return B2400;
+    case 4800:   return B4800;
+    case 9600:   return B9600;
+    case 19200:  return B19200;
+    case 38400:  return B38400;
+    case 57600:  return B57600;
+    case 115200: return B115200;
+    default:     return B9600;
+    }
+}
+
+int host_os_tty_cfg (int fd, uint32_t baud, int bits, char parity, int stop_bits)
+{
+    struct termios tio;
+
+    if (0 != tcgetattr(fd, &tio)) {
+        return -1;
+    }
+    cfsetispeed(&tio, __baud_to_speed(baud));
+    cfsetospeed(&tio, __baud_to_speed(baud));
+
+    tio.c_cflag &= ~(CSIZE | PARENB | PARODD | CSTOPB);
+    tio.c_cflag |= CLOCAL | CREAD;
+    tio.c_cflag |= (bits == 7) ? CS7 : (bits == 6) ? CS6 : (bits == 5) ? CS5 : CS8;
+    if ('E' == parity) {
+        tio.c_cflag |= PARENB;
+    } else if ('O' == parity) {
+        tio.c_cflag |= PARENB | PARODD;
+    }
+    if (2 == stop_bits) {
+        tio.c_cflag |= CSTOPB;
+    }
+    return tcsetattr(fd, TCSANOW, &tio);
+}
+
+int host_os_fd_read (int fd, void *p_buf, int len, int timeout_ms)
+{
+    struct pollfd pfd;
+    int           ret;
+
+    pfd.fd     = fd;
+    pfd.events = POLLIN;
+    do {
+        ret = poll(&pfd, 1, timeout_ms);
+    } while ((ret < 0) && (EINTR == errno));
+
+    if (ret <= 0) {
+        return ret;
+    }
+    if (!(pfd.revents & POLLIN)) {
+        /* 对端挂断， 按超时处理 */
+        if (timeout_ms > 0) {
+            host_os_sleep_ms(timeout_ms);
+        }
+        return 0;
+    }
+    ret = read(fd, p_buf, len);
+    if ((ret < 0) && ((EAGAIN == errno) || (EIO == errno))) {
+        return 0;
+    }
+    return ret;
+}
+
+int host_os_fd_write (int fd, const void *p_buf, int len)
+{
+    const char *p = p_buf;
+    int         left = len;
+    int         ret;
+
+    while (left > 0) {
+        ret = write(fd, p, left);
+        if (ret > 0) {
+            p    += ret;
+            left -= ret;
+        } else if ((ret < 0) && (EINTR == errno)) {
+            continue;
+        } else {
+            break;      /* 对端未读取， 丢弃 */
+        }
+    }
+    return len;
+}
+
+int host_os_symlink (const char *p_target, const char *p_link)
+{
+    unlink(p_link);
+    return symlink(p_target, p_link);
+}
+
+int host_os_mkdir (const char *p_path)
+{
+    if ((0 != mkdir(p_path, 0755)) && (EEXIST != errno)) {
+        return -1;
+    }
+    return 0;
+}
+
+/******************************************************************************/
+int host_os_file_read (const char *p_path, int offset, void *p_buf, int len)
+{
+    int fd  = open(p_path, O_RDONLY);
+    int ret = 0;
+
+    memset(p_buf, 0xFF, len);
+    if (fd < 0) {
+        return (ENOENT == errno) ? 0 : -1;
+    }
+    if (pread(fd, p_buf, len, offset) < 0) {
+        ret = -1;
+    }
+    close(fd);
+    return ret;
+}
+
+int host_os_file_write (const char *p_path, int offset, const void *p_buf, int len)
+{
+    unsigned char ff[64];
+    struct stat   st;
+    int           fd = open(p_path, O_RDWR | O_CREAT, 0644);
+    int           ret = 0;
+    int           n;
+
+    if (fd < 0) {
+        return -1;
+    }
+
+    /* 文件空洞按擦除状态补 0xFF */
+    memset(ff, 0xFF, sizeof(ff));
+    if ((0 == fstat(fd, &st)) && (st.st_size < offset)) {
+        for (n = (int)st.st_size; n < offset; n += sizeof(ff)) {
+            if (pwrite(fd, ff, ((offset - n) < (int)sizeof(ff)) ? (offset - n) : (int)sizeof(ff), n) < 0) {
+                break;
+            }
+        }
+    }
+    if (len != pwrite(fd, p_buf, len, offset)) {
+        ret = -1;
+    }
+    fsync(fd);
+    close(fd);
+    return ret;
+}
+
+/******************************************************************************/
+int64_t host_os_time (void)
+{
+    return (int64_t)time(NULL);
+}
+
+void host_os_gmtime (int64_t t, int tm[9])
+{
+    time_t    tt = (time_t)t;
+    struct tm res;
+
+    gmtime_r(&tt, &res);
+    tm[0] = res.tm_sec;
+    tm[1] = res.tm_min;
+    tm[2] = res.tm_hour;
+    tm[3] = res.tm_mday;
+    tm[4] = res.tm_mon;
+    tm[5] = res.tm_year;
+    tm[6] = res.tm_wday;
+    tm[7] = res.tm_yday;
+    tm[8] = res.tm_isdst;
+}
+
+int64_t host_os_timegm (const int tm[9])
+{
+    struct tm res;
+
+    memset(&res, 0, sizeof(res));
+    res.tm_sec  = tm[0];
+    res.tm_min  = tm[1];
+    res.tm_hour = tm[2];
+    res.tm_mday = tm[3];
+    res.tm_mon  = tm[4];
+    res.tm_year = tm[5];
+    return (int64_t)timegm(&res);
+}
+
+/******************************************************************************/
+int host_os_readline (char *p_buf, int len)
+{
+    int n;
+
+    if (NULL == fgets(p_buf, len, stdin)) {
+        return -1;
+    }
+    n = (int)strlen(p_buf);
+    while ((n > 0) && (('\n' == p_buf[n - 1]) || ('\r' == p_buf[n - 1]))) {
+        p_buf[--n] = '\0';
+    }
+    return n;
+}
+
+void host_os_puts (const char *p_str, int len)
+{
+    fwrite(p_str, 1, len, stdout);
+}
+
+const char *host_os_getenv (const char *p_name, const char *p_def)
+{
+    const char *p_val = getenv(p_name);
+
+    return ((NULL != p_val) && ('\0' != p_val[0])) ? p_val : p_def;
+}
+
+/******************************************************************************/
+static int __exe_base_cb (struct dl_phdr_info *p_info, size_t size, void *p_data)
+{
+    *(uintptr_t *)p_data = p_info->dlpi_addr;
+    return 1;                               /* 第一个为可执行文件本身 */
+}
+
+/**
+ * \brief 由可执行文件的节头查找 .noinit 段
+ */
+static int __noinit_find (unsigned char **pp_addr, uint32_t *p_size)
+{
+    ElfW(Ehdr)  eh;
+    ElfW(Shdr) *p_sh   = NULL;
+    char       *p_strs = NULL;
+    uintptr_t   base   = 0;
+    size_t      len;
+    int         fd;
+    int         i;
+    int         ret    = -1;
+
+    fd = open("/proc/self/exe", O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    if ((sizeof(eh) != pread(fd, &eh, sizeof(eh), 0)) ||
+        (0 != memcmp(eh.e_ident, ELFMAG, SELFMAG)) ||
+        (sizeof(ElfW(Shdr)) != eh.e_shentsize) ||
+        (eh.e_shstrndx >= eh.e_shnum)) {
+        goto out;
+    }
+
+    len  = eh.e_shnum * sizeof(ElfW(Shdr));
+    p_sh = malloc(len);
+    if ((NULL == p_sh) || ((ssize_t)len != pread(fd, p_sh, len, eh.e_shoff))) {
+        goto out;
+    }
+    len    = p_sh[eh.e_shstrndx].sh_size;
+    p_strs = malloc(len + 1);
+    if ((NULL == p_strs) ||
+        ((ssize_t)len != pread(fd, p_strs, len, p_sh[eh.e_shstrndx].sh_offset))) {
+        goto out;
+    }
+    p_strs[len] = '\0';
+
+    for (i = 0; i < eh.e_shnum; i++) {
+        if ((p_sh[i].sh_name < len) && (0 == strcmp(p_strs + p_sh[i].sh_name, ".noinit"))) {
+            dl_iterate_phdr(__exe_base_cb, &base);
+            *pp_addr = (unsigned char *)(base + p_sh[i].sh_addr);
+            *p_size  = (uint32_t)p_sh[i].sh_size;
+            ret      = 0;
+            break;
+        }
+    }
+
+out:
+    free(p_strs);
+    free(p_sh);
+    close(fd);
+    return ret;
+}
+
+/* 逐字节复制， 不经 AddressSanitizer 的区间检查（段内可能有多个变量） */
+__attribute__((no_sanitize_address))
+static void __noinit_copy (volatile unsigned char *p_dst,
+                           volatile unsigned char *p_src,
+                           uint32_t                size)
+{
+    while (size--) {
+        *p_dst++ = *p_src++;
+    }
+}
+
+int host_os_noinit_load (const char *p_path)
+{
+    unsigned char *p_addr;
+    unsigned char *p_buf;
+    uint32_t       size;
+    struct stat    st;
+    int            ret = -1;
+
+    if ((0 != __noinit_find(&p_addr, &size)) ||
+        (0 != stat(p_path, &st)) || (st.st_size != (off_t)size)) {
+        return -1;
+    }
+    p_buf = malloc(size);
+    if ((NULL != p_buf) && (0 == host_os_file_read(p_path, 0, p_buf, size))) {
+        __noinit_copy(p_addr, p_buf, size);
+        ret = 0;
+    }
+    free(p_buf);
+    unlink(p_path);
+    return ret;
+}
+
+int host_os_noinit_save (const char *p_path)
+{
+    unsigned char *p_addr;
+    unsigned char *p_buf;
+    uint32_t       size;
+    int            ret = -1;
+
+    if (0 != __noinit_find(&p_addr, &size)) {
+        return -1;
+    }
+    p_buf = malloc(size);
+    if (NULL != p_buf) {
+        __noinit_copy(p_buf, p_addr, size);
+        unlink(p_path);
+        ret = host_os_file_write(p_path, 0, p_buf, size);
+    }
+    free(p_buf);
+    return ret;
+}
+
+void host_os_exit (int code)
+{
+    fflush(stdout);
+    exit(code);
+}
+
+/* end of file */
@@ -0,0 +1,225 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 主机移植的操作系统接口（pthread、 timerfd、 终端、 文件）
+ *
+ * 只使用基本C类型， 以便 host_os.c 单独包含系统头文件， 而实现 aw_* 接口的
+ * 文件只包含 apollo 头文件（两者的 termios、 errno 等定义互相冲突）。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-08  xjc, first implementation
+ * - 1.01 16-10-12  xjc, 增加线程 CPU 时钟
+ * - 1.02 16-10-13  xjc, 增加线程堆栈检查
+ * - 1.03 16-10-16  xjc, 增加 .noinit 段的保存、 恢复
+ * \endinternal
+ */
+
+#ifndef __HOST_OS_H
+#define __HOST_OS_H
+
+#include <stdint.h>
+
+/**
+ * \brief 初始化（记录启动时刻， 创建锁）
+ */
+void host_os_init (void);
+
+/**
+ * \brief 启动后经过的毫秒数（CLOCK_MONOTONIC）
+ */
+uint32_t host_os_ms (void);
+
+/**
+ * \brief 启动后经过的纳秒数（CLOCK_MONOTONIC）
+ */
+uint64_t host_os_ns (void);
+
+/**
+ * \brief 延时
+ */
+void host_os_sleep_ms (uint32_t ms);
+void host_os_sleep_us (uint32_t us);
+
+/**
+ * \brief 创建分离的线程
+ * \return 0： 成功  <0： 失败
+ */
+int host_os_thread_create (const char *name,
+                           void      (*pfn_entry) (void *p_arg),
+                           void       *p_arg);
+
+/**
+ * \brief 当前线程的 CPU 时钟（在线程中调用）， 用于统计任务的 CPU 时间
+ * \param[out] p_clock : 时钟标识（可能为负数）
+ * \return 0： 成功  <0： 失败
+ */
+int host_os_cpu_clock_self (int *p_clock);
+
+/**
+ * \brief 读取 CPU 时钟（ns）， 线程已退出时返回 0
+ */
+uint64_t host_os_cpu_ns (int clock);
+
+/**
+ * \brief 获取当前线程的堆栈（host_os_thread_create 创建的线程， 低端起）
+ * \return 0： 成功  <0： 其它线程
+ */
+int host_os_stack_self (void **pp_low, uint32_t *p_size);
+
+/**
+ * \brief 堆栈从低端起未被使用过的字节数（创建时涂色）
+ */
+uint32_t host_os_stack_free (const void *p_low, uint32_t size);
+
+/**
+ * \brief 当前线程的私有指针（用作当前任务）
+ */
+void  host_os_self_set (void *p_self);
+void *host_os_self_get (void);
+
+/**
+ * \brief 内核锁， 保护所有信号量、 互斥量的状态
+ */
+void host_os_klock (void);
+void host_os_kunlock (void);
+
+/**
+ * \brief 与内核锁配合的条件变量
+ */
+void *host_os_cond_new (void);
+
+/**
+ * \brief 等待条件变量（调用前已持有内核锁）
+ * \param[in] timeout_ms : 超时（ms）， <0 为永久等待
+ * \param[in] start_ns   : 开始等待的时刻（host_os_ns()）， 被唤醒后重新等待时保持原截止时刻
+ * \return 0： 被唤醒  1： 超时
+ */
+int host_os_cond_wait (void *p_cond, int timeout_ms, uint64_t start_ns);
+
+void host_os_cond_broadcast (void *p_cond);
+
+/**
+ * \brief 中断锁（可嵌套）， 持有时其它任务的中断锁和中断服务不能运行
+ */
+void host_os_ilock (void);
+void host_os_iunlock (void);
+
+/**
+ * \brief 启动1ms节拍线程， 每个节拍调用一次 pfn_tick
+ */
+int host_os_tick_start (void (*pfn_tick) (void));
+
+/**
+ * \brief 启动周期定时线程（模拟硬件定时器）， 每个周期调用一次 pfn_isr
+ * \return 定时器句柄， NULL 失败
+ */
+void *host_os_timer_start (uint32_t period_ns, void (*pfn_isr) (void *p_arg), void *p_arg);
+
+/**
+ * \brief 停止周期定时线程
+ */
+void host_os_timer_stop (void *p_timer);
+
+/**
+ * \brief 创建伪终端
+ * \param[out] p_slave : 从端设备名
+ * \return 主端文件描述符， <0 失败
+ */
+int host_os_pty_open (char *p_slave, int len);
+
+/**
+ * \brief 打开串口设备（原始模式）
+ */
+int host_os_tty_open (const char *p_path);
+
+/**
+ * \brief 配置串口
+ * \param[in] parity : 'N'、 'E'、 'O'
+ */
+int host_os_tty_cfg (int fd, uint32_t baud, int bits, char parity, int stop_bits);
+
+/**
+ * \brief 读取， 等待第一个字节最多 timeout_ms（<0 永久）
+ * \return >0： 读取的字节数  0： 超时  <0： 错误
+ */
+int host_os_fd_read (int fd, void *p_buf, int len, int timeout_ms);
+
+/**
+ * \brief 写入全部数据（对端未打开时丢弃）
+ */
+int host_os_fd_write (int fd, const void *p_buf, int len);
+
+/**
+ * \brief 建立符号链接（已存在时替换）
+ */
+int host_os_symlink (const char *p_target, const char *p_link);
+
+/**
+ * \brief 建立目录（已存在时成功）
+ */
+int host_os_mkdir (const char *p_path);
+
+/**
+ * \brief 文件读写， 读取超出文件长度的部分填 0xFF（与擦除后的EEPROM一致）
+ * \return 0： 成功  <0： 失败
+ */
+int host_os_file_read (const char *p_path, int offset, void *p_buf, int len);
+int host_os_file_write (const char *p_path, int offset, const void *p_buf, int len);
+
+/**
+ * \brief 日历时间（UTC秒）与分解时间互换
+ *
+ * 分解时间依次为秒、 分、 时、 日、 月(0~11)、 年(-1900)、 星期、 年内日、 夏令时，
+ * 与 aw_tm_t 的成员顺序相同。
+ */
+int64_t host_os_time (void);
+void    host_os_gmtime (int64_t t, int tm[9]);
+int64_t host_os_timegm (const int tm[9]);
+
+/**
+ * \brief 读取标准输入的一行（去掉行尾）， 结束时返回 <0
+ */
+int host_os_readline (char *p_buf, int len);
+
+/**
+ * \brief 写标准输出
+ */
+void host_os_puts (const char *p_str, int len);
+
+/**
+ * \brief 环境变量， 不存在时返回 p_def
+ */
+const char *host_os_getenv (const char *p_name, const char *p_def);
+
+/**
+ * \brief 从文件恢复可执行文件的 .noinit 段（模拟复位时RAM内容保持）， 恢复后删除文件
+ * \return 0： 已恢复  <0： 无文件、 大小不符或无该段
+ */
+int host_os_noinit_load (const char *p_path);
+
+/**
+ * \brief 保存 .noinit 段到文件
+ * \return 0： 成功  <0： 失败
+ */
+int host_os_noinit_save (const char *p_path);
+
+/**
+ * \brief 退出进程
+ */
+void host_os_exit (int code);
+
+#endif /* __HOST_OS_H */
+
+/* end of file */
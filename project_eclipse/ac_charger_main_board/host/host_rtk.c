@@ -0,0 +1,586 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 主机移植的 rtk 内核接口
+ *
+ * aw_psp_task.h、 aw_psp_sem.h、 aw_psp_int.h 中的宏直接调用 rtk 接口， 这里在
+ * host_os 之上实现这些接口：
+ *  - 任务为分离的线程， 任务控制块照常由应用静态分配， 声明的堆栈不使用；
+ *  - 信号量、 互斥量的状态仍保存在 rtk 结构中， 由一把内核锁保护，
+ *    每个对象对应一个条件变量；
+ *  - 中断锁为一把可嵌套的锁， 节拍线程和引脚中断持有它运行中断服务；
+ *  - 不模拟优先级抢占和优先级继承， 任务优先级只记录；
+ *  - 任务事件钩子只产生初始化、 退出， 以及阻塞等待（信号量、 互斥量、 延时、
+ *    串口读）前后的切出、 切入事件；
+ *  - task_stack_check() 检查线程实际使用的堆栈（64 位主机）， 只用于比较
+ *    修改前后的变化， 不能代替目标板上的测量。
+ *
+ * 节拍固定为 1ms（AW_CFG_TICKS_PER_SECOND 为 1000）。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-08  xjc, first implementation
+ * - 1.01 16-10-12  xjc, 记录任务线程的 CPU 时钟， 供性能测试统计
+ * - 1.02 16-10-13  xjc, 增加任务事件钩子及堆栈检查
+ * - 1.03 16-10-18  xjc, 去掉 task_event_hook_set（目标内核库中没有）
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include <stdarg.h>
+#include <string.h>
+#include "rtk.h"
+#include "host_os.h"
+#include "host_sim.h"
+
+int rtk_is_int_context;
+
+/*******************************************************************************
+  对象到条件变量的映射
+*******************************************************************************/
+#define __OBJ_MAX    512
+
+struct __obj {
+    const void *p_obj;
+    void       *p_cond;
+};
+
+static struct __obj __g_objs[__OBJ_MAX];   /* 开放寻址， 只增不删 */
+
+/**
+ * \brief 获取对象的条件变量（持有内核锁时调用）
+ */
+static void *__cond_get (const void *p_obj)
+{
+    uint32_t idx = ((uint32_t)(uintptr_t)p_obj >> 3) % __OBJ_MAX;
+    uint32_t i;
+
+    for (i = 0; i < __OBJ_MAX; i++) {
+        struct __obj *p = &__g_objs[(idx + i) % __OBJ_MAX];
+
+        if (p->p_obj == p_obj) {
+            return p->p_cond;
+        }
+        if (NULL == p->p_obj) {
+            p->p_obj  = p_obj;
+            p->p_cond = host_os_cond_new();
+            return p->p_cond;
+        }
+    }
+    host_sim_panic("rtk: too many semaphores");
+    return NULL;
+}
+
+/**
+ * \brief 等待（持有内核锁时调用）
+ * \return 0： 被唤醒  -ETIME： 超时
+ */
+static int __wait (const void *p_obj, unsigned int tick, uint64_t start_ns)
+{
+    int timeout = (WAIT_FOREVER == tick) ? -1 : (int)tick;
+
+    return host_os_cond_wait(__cond_get(p_obj), timeout, start_ns) ? -ETIME : 0;
+}
+
+static void __wakeup (const void *p_obj)
+{
+    host_os_cond_broadcast(__cond_get(p_obj));
+}
+
+/*******************************************************************************
+  任务
+*******************************************************************************/
+struct __task_entry {
+    void             (*pfunc) (void *arg1, void *arg2);
+    void              *arg1;
+    void              *arg2;
+    struct rtk_task   *task;
+    int                cpu_clock;   /* 线程 CPU 时钟 */
+    volatile int       cpu_valid;   /* 线程已运行并取得 CPU 时钟 */
+    void              *stack_low;
+    uint32_t           stack_size;
+    volatile int       stack_valid;
+};
+
+static struct __task_entry    __g_entries[64];
+static int                    __g_entry_cnt;
+static rtk_task_event_hook_t  __g_default_hook;
+
+static void __task_event (struct rtk_task *task, int event, ...)
+{
+    va_list va;
+
+    if ((NULL == task) || (NULL == task->task_event)) {
+        return;
+    }
+    va_start(va, event);
+    task->task_event(task, event, va);
+    va_end(va);
+}
+
+rtk_task_event_hook_t rtk_task_event_default_hook_set (rtk_task_event_hook_t hook)
+{
+    rtk_task_event_hook_t old = __g_default_hook;
+
+    __g_default_hook = hook;
+    return old;
+}
+
+void host_task_block (int block)
+{
+    __task_event(task_self(),
+                 block ? RTK_TASK_EVENT_ON_TASK_STOP_EXEC :
+                         RTK_TASK_EVENT_ON_TASK_START_EXEC);
+}
+
+static void __task_run (void *p_arg)
+{
+    struct rtk_task     *task    = p_arg;
+    struct __task_entry *p_entry = task->sp;
+
+    host_os_self_set(task);
+    p_entry->cpu_valid   = (0 == host_os_cpu_clock_self(&p_entry->cpu_clock));
+    p_entry->stack_valid = (0 == host_os_stack_self(&p_entry->stack_low,
+                                                    &p_entry->stack_size));
+    task->status = TASK_READY;
+    __task_event(task, RTK_TASK_EVENT_ON_TASK_START_EXEC);
+    p_entry->pfunc(p_entry->arg1, p_entry->arg2);
+    __task_event(task, RTK_TASK_EVENT_ON_TASK_STOP_EXEC);
+    __task_event(task, RTK_TASK_EVENT_ON_EXIT);
+    task->status = TASK_DEAD;
+}
+
+struct rtk_task *task_init (struct rtk_task *task,
+                            const char     *name,
+                            int             priority,
+                            int             option,
+                            char           *stack_low,
+                            char           *stack_high,
+                            void           *pfunc,
+                            void           *arg1,
+                            void           *arg2)
+{
+    struct __task_entry *p_entry;
+
+    host_os_klock();
+    p_entry = (__g_entry_cnt < (int)AW_NELEMENTS(__g_entries)) ?
+              &__g_entries[__g_entry_cnt++] : NULL;
+    host_os_kunlock();
+    if (NULL == p_entry) {
+        host_sim_panic("rtk: too many tasks");
+        return NULL;
+    }
+
+    p_entry->pfunc = (void (*) (void *, void *))pfunc;
+    p_entry->arg1  = arg1;
+    p_entry->arg2  = arg2;
+    p_entry->task        = task;
+    p_entry->cpu_valid   = FALSE;
+    p_entry->stack_valid = FALSE;
+
+    memset(task, 0, sizeof(*task));
+    task->sp               = p_entry;         /* 主机上保存入口 */
+    task->name             = name;
+    task->stack_low        = stack_low;
+    task->stack_high       = stack_high;
+    task->priority         = priority;
+    task->current_priority = priority;
+    task->option           = option;
+    task->status           = TASK_PREPARED;
+    task->tid              = __g_entry_cnt;
+    task->task_event       = __g_default_hook;
+    __task_event(task, RTK_TASK_EVENT_ON_TASK_INIT);
+    return task;
+}
+
+int task_stack_check (struct rtk_task *task, unsigned int *p_total, unsigned int *p_free)
+{
+    struct __task_entry *p_entry;
+
+    if ((NULL == task) || (NULL == task->sp)) {
+        return -EINVAL;                     /* 非任务线程 */
+    }
+    p_entry = task->sp;
+    if (!p_entry->stack_valid) {
+        return -EINVAL;
+    }
+    *p_total = p_entry->stack_size;
+    *p_free  = host_os_stack_free(p_entry->stack_low, p_entry->stack_size);
+    return 0;
+}
+
+int host_task_cpu_get (int idx, const char **pp_name, uint64_t *p_cpu_ns)
+{
+    if ((idx < 0) || (idx >= __g_entry_cnt)) {
+        return -1;
+    }
+    *pp_name  = __g_entries[idx].task->name;
+    *p_cpu_ns = __g_entries[idx].cpu_valid ?
+                host_os_cpu_ns(__g_entries[idx].cpu_clock) : 0;
+    return 0;
+}
+
+int task_startup (struct rtk_task *task)
+{
+    if ((NULL == task) || (TASK_PREPARED != task->status)) {
+        return -EPERM;
+    }
+    task->status = TASK_READY;
+    return (0 == host_os_thread_create(task->name, __task_run, task)) ? 0 : -ENOMEM;
+}
+
+struct rtk_task *task_self (void)
+{
+    struct rtk_task *task = host_os_self_get();
+    static struct rtk_task host_tasks[8];
+    static int             host_task_cnt;
+
+    /* 主线程、 节拍线程等非任务线程也需要互斥量持有者的身份 */
+    if (NULL == task) {
+        host_os_klock();
+        if (host_task_cnt < (int)AW_NELEMENTS(host_tasks)) {
+            task = &host_tasks[host_task_cnt++];
+            task->name   = "host";
+            task->status = TASK_READY;
+        }
+        host_os_kunlock();
+        host_os_self_set(task);
+    }
+    return task;
+}
+
+int task_priority_set (struct rtk_task *task, unsigned int priority)
+{
+    task->priority         = priority;
+    task->current_priority = priority;
+    return 0;
+}
+
+void task_delay (int tick)
+{
+    if (tick > 0) {
+        host_task_block(1);
+        host_os_sleep_ms((uint32_t)tick);
+        host_task_block(0);
+    } else {
+        host_os_sleep_ms(0);
+    }
+}
+
+void task_yield (void)
+{
+    host_os_sleep_ms(0);
+}
+
+unsigned int tick_get (void)
+{
+    return host_os_ms();
+}
+
+/*******************************************************************************
+  信号量
+*******************************************************************************/
+static int __sem_init (struct rtk_semaphore *semid, int type, int count)
+{
+    host_os_klock();
+    semid->u.count = count;
+    semid->type    = type;
+    INIT_LIST_HEAD(&semid->pending_tasks);
+    (void)__cond_get(semid);
+    host_os_kunlock();
+    return 0;
+}
+
+static int __sem_take (struct rtk_semaphore *semid, unsigned int tick)
+{
+    uint64_t start   = host_os_ns();
+    int      ret     = 0;
+    int      blocked = 0;
+
+    host_os_klock();
+    while (0 == semid->u.count) {
+        if (SEM_TYPE_NULL == semid->type) {
+            ret = -ENXIO;
+            break;
+        }
+        if (0 == tick) {
+            ret = -EAGAIN;
+            break;
+        }
+        if (!blocked) {
+            /* 钩子不能在内核锁内调用（中断锁在外层）， 放锁后重新判断 */
+            blocked = 1;
+            host_os_kunlock();
+            host_task_block(1);
+            host_os_klock();
+            continue;
+        }
+        if (0 != (ret = __wait(semid, tick, start))) {
+            break;
+        }
+    }
+    if (semid->u.count > 0) {
+        semid->u.count--;
+        ret = 0;
+    }
+    host_os_kunlock();
+    if (blocked) {
+        host_task_block(0);
+    }
+    return ret;
+}
+
+static int __sem_give (struct rtk_semaphore *semid, int binary)
+{
+    host_os_klock();
+    if (SEM_TYPE_NULL == semid->type) {
+        host_os_kunlock();
+        return -ENXIO;
+    }
+    if (binary) {
+        semid->u.count = 1;
+    } else {
+        semid->u.count++;
+    }
+    __wakeup(semid);
+    host_os_kunlock();
+    return 0;
+}
+
+static int __sem_terminate (struct rtk_semaphore *semid)
+{
+    host_os_klock();
+    semid->type    = SEM_TYPE_NULL;
+    semid->u.count = 0;
+    __wakeup(semid);
+    host_os_kunlock();
+    return 0;
+}
+
+int semb_init (struct rtk_semaphore *semid, int InitCount)
+{
+    return __sem_init(semid, SEM_TYPE_BINARY, InitCount ? 1 : 0);
+}
+
+int semb_take (struct rtk_semaphore *semid, unsigned int tick)
+{
+    return __sem_take(semid, tick);
+}
+
+int semb_give (struct rtk_semaphore *semid)
+{
+    return __sem_give(semid, 1);
+}
+
+int semb_terminate (struct rtk_semaphore *semid)
+{
+    return __sem_terminate(semid);
+}
+
+int semc_init (struct rtk_semaphore *semid, int InitCount)
+{
+    return __sem_init(semid, SEM_TYPE_COUNTER, InitCount);
+}
+
+int semc_take (struct rtk_semaphore *semid, unsigned int tick)
+{
+    return __sem_take(semid, tick);
+}
+
+int semc_give (struct rtk_semaphore *semid)
+{
+    return __sem_give(semid, 0);
+}
+
+int semc_terminate (struct rtk_semaphore *semid)
+{
+    return __sem_terminate(semid);
+}
+
+/*******************************************************************************
+  互斥量（可嵌套）
+*******************************************************************************/
+int mutex_init (struct rtk_mutex *semid)
+{
+    host_os_klock();
+    semid->s.u.owner           = NULL;
+    semid->s.type              = SEM_TYPE_MUTEX;
+    semid->mutex_recurse_count = 0;
+    INIT_LIST_HEAD(&semid->s.pending_tasks);
+    INIT_LIST_HEAD(&semid->sem_member_node);
+    (void)__cond_get(semid);
+    host_os_kunlock();
+    return 0;
+}
+
+int mutex_lock (struct rtk_mutex *semid, unsigned int tick)
+{
+    struct rtk_task *self    = task_self();
+    uint64_t         start   = host_os_ns();
+    int              ret     = 0;
+    int              blocked = 0;
+
+    host_os_klock();
+    while ((NULL != semid->s.u.owner) && (self != semid->s.u.owner)) {
+        if (SEM_TYPE_MUTEX != semid->s.type) {
+            ret = -ENXIO;
+            break;
+        }
+        if (0 == tick) {
+            ret = -EAGAIN;
+            break;
+        }
+        if (!blocked) {
+            blocked = 1;
+            host_os_kunlock();
+            host_task_block(1);
+            host_os_klock();
+            continue;
+        }
+        if (0 != (ret = __wait(semid, tick, start))) {
+            break;
+        }
+    }
+    if ((NULL == semid->s.u.owner) || (self == semid->s.u.owner)) {
+        semid->s.u.owner = self;
+        semid->mutex_recurse_count++;
+        ret = 0;
+    }
+    host_os_kunlock();
+    if (blocked) {
+        host_task_block(0);
+    }
+    return ret;
+}
+
+int mutex_unlock (struct rtk_mutex *semid)
+{
+    struct rtk_task *self = task_self();
+
+    host_os_klock();
+    if (self != semid->s.u.owner) {
+        host_os_kunlock();
+        return -EPERM;
+    }
+    if (0 == --semid->mutex_recurse_count) {
+        semid->s.u.owner = NULL;
+        __wakeup(semid);
+    }
+    host_os_kunlock();
+    return 0;
+}
+
+int mutex_terminate (struct rtk_mutex *mutex)
+{
+    host_os_klock();
+    mutex->s.type              = SEM_TYPE_NULL;
+    mutex->s.u.owner           = NULL;
+    mutex->mutex_recurse_count = 0;
+    __wakeup(mutex);
+    host_os_kunlock();
+    return 0;
+}
+
+/*******************************************************************************
+  中断锁及节拍
+*******************************************************************************/
+int arch_interrupt_disable (void)
+{
+    host_os_ilock();
+    return 0;
+}
+
+void arch_interrupt_enable (int old)
+{
+    (void)old;
+    host_os_iunlock();
+}
+
+void enter_int_context (void)
+{
+    host_os_ilock();
+    rtk_is_int_context++;
+}
+
+void exit_int_context (void)
+{
+    rtk_is_int_context--;
+    host_os_iunlock();
+}
+
+static struct list_head __g_tick_list = LIST_HEAD_INIT(__g_tick_list);
+
+void rtk_tick_down_counter_init (struct rtk_tick *_this)
+{
+    INIT_LIST_HEAD(&_this->node);
+    _this->tick             = 0;
+    _this->timeout_callback = NULL;
+    _this->arg              = NULL;
+}
+
+int rtk_tick_down_counter_set_func (struct rtk_tick *_this, void (*func)(void *), void *arg)
+{
+    _this->timeout_callback = func;
+    _this->arg              = arg;
+    return 0;
+}
+
+void rtk_tick_down_counter_start (struct rtk_tick *_this, unsigned int tick)
+{
+    host_os_ilock();
+    if (!list_empty(&_this->node)) {
+        list_del_init(&_this->node);
+    }
+    _this->tick = host_os_ms() + (tick ? tick : 1);   /* 主机上保存到期时刻 */
+    list_add_tail(&_this->node, &__g_tick_list);
+    host_os_iunlock();
+}
+
+void rtk_tick_down_counter_stop (struct rtk_tick *_this)
+{
+    host_os_ilock();
+    if (!list_empty(&_this->node)) {
+        list_del_init(&_this->node);
+    }
+    host_os_iunlock();
+}
+
+void rtk_tick_down_counter_announce (void)
+{
+    struct list_head *p_node;
+    struct rtk_tick  *p_tick;
+    uint32_t          now = host_os_ms();
+    int               again;
+
+    enter_int_context();
+    do {
+        /* 回调中可能重新启动或停止计数器， 每次回调后从头查找 */
+        again = 0;
+        list_for_each(p_node, &__g_tick_list) {
+            /* rtk 的 list_entry 按 int 计算地址， 64 位主机上会截断 */
+            p_tick = AW_CONTAINER_OF(p_node, struct rtk_tick, node);
+            if ((int32_t)(now - p_tick->tick) >= 0) {
+                list_del_init(&p_tick->node);
+                if (NULL != p_tick->timeout_callback) {
+                    p_tick->timeout_callback(p_tick->arg);
+                }
+                again = 1;
+                break;
+            }
+        }
+    } while (again);
+    exit_int_context();
+}
+
+/* end of file */
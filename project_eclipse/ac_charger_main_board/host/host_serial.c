@@ -0,0 +1,216 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 主机移植的串口（aw_serial_*）
+ *
+ * 串口 n 在第一次使用时打开：
+ *  - 环境变量 ACP1000_HOST_COM<n> 指定设备时打开该设备（如 USB 转 485）；
+ *  - 否则建立伪终端， 运行目录下的 com<n> 链接到从端， 供仿真器连接。
+ *
+ * 读取语义与 awbl_serial.c 相同： 读满 maxbytes 或字节间超过读超时
+ * （AW_TIOCRDTIMEOUT， 默认永久等待）时返回。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-08  xjc, first implementation
+ * - 1.01 16-10-13  xjc, 读等待时产生任务切出、 切入事件
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include <stdio.h>
+#include "aw_serial.h"
+#include "aw_vdebug.h"
+#include "aw_sio_common.h"
+#include "aw_ioctl.h"
+#include "am_uart.h"
+#include "host_os.h"
+#include "host_sim.h"
+
+static struct __host_com {
+    int         fd;             /**< \brief 文件描述符， <0 为未打开 */
+    int         rd_timeout;     /**< \brief 读超时（ms）， <0 为永久等待 */
+    uint32_t    baud;
+    uint32_t    hw_opts;
+} __g_com[AW_CFG_NUM_COM];
+
+static int __g_com_inited;
+
+static struct __host_com *__com_get (int com)
+{
+    struct __host_com *p_com;
+    char               name[32];
+    char               path[256];
+    char               slave[128];
+    const char        *p_dev;
+    int                i;
+
+    if ((com < 0) || (com >= AW_CFG_NUM_COM)) {
+        return NULL;
+    }
+
+    host_os_klock();
+    if (!__g_com_inited) {
+        for (i = 0; i < AW_CFG_NUM_COM; i++) {
+            __g_com[i].fd         = -1;
+            __g_com[i].rd_timeout = -1;
+            __g_com[i].baud       = 115200;
+            __g_com[i].hw_opts    = CLOCAL | CREAD | CS8;
+        }
+        __g_com_inited = TRUE;
+    }
+
+    p_com = &__g_com[com];
+    if (p_com->fd < 0) {
+        snprintf(name, sizeof(name), "ACP1000_HOST_COM%d", com);
+        p_dev = host_os_getenv(name, NULL);
+        if (NULL != p_dev) {
+            p_com->fd = host_os_tty_open(p_dev);
+        } else {
+            p_com->fd = host_os_pty_open(slave, sizeof(slave));
+            if (p_com->fd >= 0) {
+                snprintf(path, sizeof(path), "%s/com%d", host_sim_dir(), com);
+                host_os_symlink(slave, path);
+                aw_kprintf("host: COM%d -> %s (%s)\r\n", com, path, slave);
+            }
+        }
+        if (p_com->fd < 0) {
+            aw_kprintf("host: COM%d open failed\r\n", com);
+        }
+    }
+    host_os_kunlock();
+
+    return (p_com->fd >= 0) ? p_com : NULL;
+}
+
+static void __com_apply (struct __host_com *p_com)
+{
+    char parity = 'N';
+    int  bits   = ((p_com->hw_opts & CSIZE) == CS7) ? 7 : 8;
+
+    if (p_com->hw_opts & PARENB) {
+        parity = (p_com->hw_opts & PARODD) ? 'O' : 'E';
+    }
+    host_os_tty_cfg(p_com->fd,
+                    p_com->baud,
+                    bits,
+                    parity,
+                    (p_com->hw_opts & STOPB) ? 2 : 1);
+}
+
+/******************************************************************************/
+aw_err_t aw_serial_ioctl (int com, int request, void *p_arg)
+{
+    struct __host_com *p_com = __com_get(com);
+
+    if (NULL == p_com) {
+        return -ENODEV;
+    }
+
+    switch (request) {
+
+    case SIO_BAUD_SET:
+        p_com->baud = (uint32_t)(unsigned long)p_arg;
+        __com_apply(p_com);
+        break;
+
+    case SIO_HW_OPTS_SET:
+        p_com->hw_opts = (uint32_t)(unsigned long)p_arg;
+        __com_apply(p_com);
+        break;
+
+    case AW_TIOCRDTIMEOUT:
+        p_com->rd_timeout = (int)(long)p_arg;
+        if (0 == p_com->rd_timeout) {
+            p_com->rd_timeout = -1;
+        }
+        break;
+
+    case SIO_MODE_SET:
+    case AM_UART_RS485_ENABLE_SET:
+        break;
+
+    default:
+        return -ENOSYS;
+    }
+    return AW_OK;
+}
+
+/******************************************************************************/
+ssize_t aw_serial_write (int com, const char *p_buffer, size_t nbytes)
+{
+    struct __host_com *p_com = __com_get(com);
+
+    if (NULL == p_com) {
+        return -ENODEV;
+    }
+    return host_os_fd_write(p_com->fd, p_buffer, nbytes);
+}
+
+/******************************************************************************/
+ssize_t aw_serial_read (int com, char *p_buffer, size_t maxbytes)
+{
+    struct __host_com *p_com = __com_get(com);
+    ssize_t            idx   = 0;
+    int                len;
+
+    if (NULL == p_com) {
+        return -ENODEV;
+    }
+
+    host_task_block(1);
+    while (idx < (ssize_t)maxbytes) {
+        len = host_os_fd_read(p_com->fd,
+                              &p_buffer[idx],
+                              maxbytes - idx,
+                              p_com->rd_timeout);
+        if (len <= 0) {
+            break;
+        }
+        idx += len;
+    }
+    host_task_block(0);
+    return idx;
+}
+
+/******************************************************************************/
+ssize_t aw_serial_poll_write (int com, const char *p_buffer, size_t nbytes)
+{
+    return aw_serial_write(com, p_buffer, nbytes);
+}
+
+/******************************************************************************/
+ssize_t aw_serial_poll_read (int com, char *p_buffer, size_t maxbytes)
+{
+    struct __host_com *p_com = __com_get(com);
+    size_t             idx   = 0;
+    int                len;
+
+    if (NULL == p_com) {
+        return -ENODEV;
+    }
+
+    host_task_block(1);
+    while (idx < maxbytes) {
+        len = host_os_fd_read(p_com->fd, &p_buffer[idx], maxbytes - idx, -1);
+        if (len < 0) {
+            break;
+        }
+        idx += len;
+    }
+    host_task_block(0);
+    return idx;
+}
+
+/* end of file */
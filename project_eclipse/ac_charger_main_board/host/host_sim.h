@@ -0,0 +1,131 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 主机构建的仿真控制接口
+ *
+ * 主机构建（Linux 进程）中没有真实的外设， 引脚输入、 ADC 采样值等由本接口
+ * 设置， 输出引脚、 PWM 等由本接口读取。 串口映射到伪终端或真实串口设备，
+ * NVRAM 映射到文件， 见 host_serial.c、 host_bsp.c。
+ *
+ * 运行目录由环境变量 ACP1000_HOST_DIR 指定（默认 ./acp1000_run）：
+ *  - nvram/<名字>.<单元>  ： NVRAM 存储段
+ *  - com<n>               ： 指向串口 n 伪终端从端的符号链接
+ *  - noinit               ： 复位退出时保存的 .noinit 段， 下次启动时恢复后删除
+ *                            （直接结束进程相当于断电， RAM不保持）
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-08  xjc, first implementation
+ * - 1.01 16-10-12  xjc, 增加任务 CPU 时间和充电流程性能测试
+ * - 1.02 16-10-13  xjc, 增加任务阻塞事件
+ * - 1.03 16-10-16  xjc, 增加复位（保存 .noinit 段后退出）
+ * - 1.04 16-10-18  xjc, 默认运行目录改为 ./acp1000_run
+ * \endinternal
+ */
+
+#ifndef __HOST_SIM_H
+#define __HOST_SIM_H
+
+#include <stdint.h>
+
+/**
+ * \brief 初始化主机运行环境（节拍、 中断延迟作业任务、 运行目录）
+ */
+void host_sim_init (void);
+
+/**
+ * \brief 运行目录
+ */
+const char *host_sim_dir (void);
+
+/**
+ * \brief 致命错误， 打印后退出
+ */
+void host_sim_panic (const char *p_msg);
+
+/**
+ * \brief 复位： 保存 .noinit 段后以3退出， 由运行脚本重新启动
+ */
+void host_sim_reset (const char *p_why);
+
+/**
+ * \brief 设置输入引脚电平， 按触发配置调用引脚中断
+ */
+void host_gpio_input_set (int pin, int level);
+
+/**
+ * \brief 读取引脚电平（输出引脚为输出值）
+ */
+int host_gpio_level_get (int pin);
+
+/**
+ * \brief 输出引脚变化通知（在设置输出的任务中调用， 不能阻塞）
+ */
+typedef void (*host_gpio_hook_t) (int pin, int level, void *p_arg);
+void host_gpio_hook_set (host_gpio_hook_t pfn_hook, void *p_arg);
+
+/**
+ * \brief 设置 ADC 通道输入电压（mV）
+ */
+void host_adc_set (int ch, uint32_t mv);
+
+/**
+ * \brief 读取 PWM 输出
+ * \return 1： 已使能  0： 未使能
+ */
+int host_pwm_get (int pid, uint32_t *p_duty_ns, uint32_t *p_period_ns);
+
+/**
+ * \brief 执行一行 shell 命令（应用通过 aw_shell_register_cmds 注册的命令）
+ * \return 命令返回值， 未找到命令返回 -1
+ */
+int host_shell_exec (char *p_line);
+
+/**
+ * \brief 获取第 idx 个任务的名字和 CPU 时间（ns）
+ * \return 0： 成功  -1： 任务不存在
+ */
+int host_task_cpu_get (int idx, const char **pp_name, uint64_t *p_cpu_ns);
+
+/**
+ * \brief 当前任务进入（1）或退出（0）阻塞等待， 产生任务切出、 切入事件
+ */
+void host_task_block (int block);
+
+/**
+ * \brief 运行充电流程性能测试（见 host_bench.c）
+ * \param[in] sessions  : 充电次数
+ * \param[in] charge_ms : 每次充电的时长
+ */
+void host_bench_run (int sessions, int charge_ms);
+
+/**
+ * \brief 板级模型（主机构建的外部电路）
+ * @{
+ */
+
+/** \brief 初始化输入引脚的空闲电平， 启动接触器反馈模型 */
+void host_board_init (void);
+
+/** \brief 设置检测点1电压（12、 9、 6， 其它值为故障） */
+void host_board_cp_set (int vol);
+
+/** \brief 设置接触器动作时间（ms）， <0 为不动作（模拟反馈故障） */
+void host_board_contactor_ms_set (int ms);
+
+/** @} */
+
+#endif /* __HOST_SIM_H */
+
+/* end of file */
@@ -0,0 +1,70 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 主机测试的检查宏
+ *
+ * 每个测试为一个独立程序（test_*.c）， 只链接被测的模块， 由 make test 运行。
+ * 检查失败时输出位置和表达式， 继续执行； 结束时 HOST_TEST_END() 输出统计，
+ * 有失败时返回非0。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-18  xjc, first implementation
+ * \endinternal
+ */
+
+#ifndef __HOST_TEST_H
+#define __HOST_TEST_H
+
+#include <stdio.h>
+
+static int __g_test_checks;
+static int __g_test_fails;
+
+/**
+ * \brief 检查条件
+ */
+#define HOST_TEST_CHECK(cond)                                            \
+    do {                                                                 \
+        __g_test_checks++;                                               \
+        if (!(cond)) {                                                   \
+            __g_test_fails++;                                            \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+        }                                                                \
+    } while (0)
+
+/**
+ * \brief 检查两个整数相等， 不等时输出两者的值
+ */
+#define HOST_TEST_CHECK_EQ(a, b)                                         \
+    do {                                                                 \
+        long long __a = (long long)(a);                                  \
+        long long __b = (long long)(b);                                  \
+        __g_test_checks++;                                               \
+        if (__a != __b) {                                                \
+            __g_test_fails++;                                            \
+            printf("%s:%d: check failed: %s == %s (%lld != %lld)\n",     \
+                   __FILE__, __LINE__, #a, #b, __a, __b);                \
+        }                                                                \
+    } while (0)
+
+/**
+ * \brief 输出统计， 作为 main() 的返回值
+ */
+#define HOST_TEST_END(name)                                              \
+    (printf("test %s: %d checks, %d failed\n",                           \
+            (name), __g_test_checks, __g_test_fails),                    \
+     (__g_test_fails ? 1 : 0))
+
+#endif
@@ -0,0 +1,57 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 主机构建用的 CMSIS 内核寄存器访问（替代 CMSIS/Include/core_cmFunc.h）
+ *
+ * 特殊寄存器在主机上只是普通变量， 中断开关由 host_rtk.c 的中断锁实现。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-08  xjc, first implementation
+ * \endinternal
+ */
+
+#ifndef __CORE_CMFUNC_H
+#define __CORE_CMFUNC_H
+
+#include <stdint.h>
+
+static uint32_t __host_cm_regs[8] __attribute__((unused));
+
+static inline void     __enable_irq (void)               {}
+static inline void     __disable_irq (void)              {}
+static inline void     __enable_fault_irq (void)         {}
+static inline void     __disable_fault_irq (void)        {}
+
+static inline uint32_t __get_CONTROL (void)              { return __host_cm_regs[0]; }
+static inline void     __set_CONTROL (uint32_t control)  { __host_cm_regs[0] = control; }
+static inline uint32_t __get_IPSR (void)                 { return 0; }
+static inline uint32_t __get_APSR (void)                 { return 0; }
+static inline uint32_t __get_xPSR (void)                 { return 0; }
+static inline uint32_t __get_PSP (void)                  { return __host_cm_regs[1]; }
+static inline void     __set_PSP (uint32_t value)        { __host_cm_regs[1] = value; }
+static inline uint32_t __get_MSP (void)                  { return __host_cm_regs[2]; }
+static inline void     __set_MSP (uint32_t value)        { __host_cm_regs[2] = value; }
+static inline uint32_t __get_PRIMASK (void)              { return __host_cm_regs[3]; }
+static inline void     __set_PRIMASK (uint32_t value)    { __host_cm_regs[3] = value; }
+static inline uint32_t __get_BASEPRI (void)              { return __host_cm_regs[4]; }
+static inline void     __set_BASEPRI (uint32_t value)    { __host_cm_regs[4] = value; }
+static inline uint32_t __get_FAULTMASK (void)            { return __host_cm_regs[5]; }
+static inline void     __set_FAULTMASK (uint32_t value)  { __host_cm_regs[5] = value; }
+static inline uint32_t __get_FPSCR (void)                { return __host_cm_regs[6]; }
+static inline void     __set_FPSCR (uint32_t value)      { __host_cm_regs[6] = value; }
+
+#endif /* __CORE_CMFUNC_H */
+
+/* end of file */
@@ -0,0 +1,109 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 主机构建用的 CMSIS 内核指令（替代 CMSIS/Include/core_cmInstr.h）
+ *
+ * 主机构建时本目录排在包含路径最前， 芯片头文件照常包含， 但其中的 ARM 汇编指令
+ * 换成主机上的等价实现或空操作。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-08  xjc, first implementation
+ * \endinternal
+ */
+
+#ifndef __CORE_CMINSTR_H
+#define __CORE_CMINSTR_H
+
+#include <stdint.h>
+
+static inline void __NOP (void) {}
+static inline void __WFI (void) {}
+static inline void __WFE (void) {}
+static inline void __SEV (void) {}
+static inline void __ISB (void) { __sync_synchronize(); }
+static inline void __DSB (void) { __sync_synchronize(); }
+static inline void __DMB (void) { __sync_synchronize(); }
+static inline void __CLREX (void) {}
+
+#define __BKPT(value)        __builtin_trap()
+
+static inline uint32_t __REV (uint32_t value)
+{
+    return __builtin_bswap32(value);
+}
+
+static inline uint32_t __REV16 (uint32_t value)
+{
+    return ((value & 0xFF00FF00ul) >> 8) | ((value & 0x00FF00FFul) << 8);
+}
+
+static inline int32_t __REVSH (int32_t value)
+{
+    return (int16_t)(((value & 0xFF00) >> 8) | ((value & 0x00FF) << 8));
+}
+
+static inline uint32_t __ROR (uint32_t op1, uint32_t op2)
+{
+    op2 &= 31;
+    return (0 == op2) ? op1 : ((op1 >> op2) | (op1 << (32 - op2)));
+}
+
+static inline uint32_t __RBIT (uint32_t value)
+{
+    uint32_t result = 0;
+    int      i;
+
+    for (i = 0; i < 32; i++) {
+        result = (result << 1) | ((value >> i) & 1);
+    }
+    return result;
+}
+
+static inline uint8_t __CLZ (uint32_t value)
+{
+    return (0 == value) ? 32 : (uint8_t)__builtin_clz(value);
+}
+
+static inline uint32_t __RRX (uint32_t value)
+{
+    return value >> 1;
+}
+
+/* 主机上只有一个处理器核， 独占访问总是成功 */
+static inline uint8_t  __LDREXB (volatile uint8_t  *addr) { return *addr; }
+static inline uint16_t __LDREXH (volatile uint16_t *addr) { return *addr; }
+static inline uint32_t __LDREXW (volatile uint32_t *addr) { return *addr; }
+static inline uint32_t __STREXB (uint8_t  value, volatile uint8_t  *addr) { *addr = value; return 0; }
+static inline uint32_t __STREXH (uint16_t value, volatile uint16_t *addr) { *addr = value; return 0; }
+static inline uint32_t __STREXW (uint32_t value, volatile uint32_t *addr) { *addr = value; return 0; }
+
+static inline uint8_t  __LDRBT (volatile uint8_t  *addr) { return *addr; }
+static inline uint16_t __LDRHT (volatile uint16_t *addr) { return *addr; }
+static inline uint32_t __LDRT  (volatile uint32_t *addr) { return *addr; }
+static inline void     __STRBT (uint8_t  value, volatile uint8_t  *addr) { *addr = value; }
+static inline void     __STRHT (uint16_t value, volatile uint16_t *addr) { *addr = value; }
+static inline void     __STRT  (uint32_t value, volatile uint32_t *addr) { *addr = value; }
+
+#define __SSAT(val, sat)                                                     \
+    (((int32_t)(val) > ((1l << ((sat) - 1)) - 1)) ? ((1l << ((sat) - 1)) - 1) : \
+     ((int32_t)(val) < -(1l << ((sat) - 1))) ? -(1l << ((sat) - 1)) : (int32_t)(val))
+
+#define __USAT(val, sat)                                                     \
+    (((int32_t)(val) < 0) ? 0u :                                             \
+     ((uint32_t)(val) > ((1ul << (sat)) - 1)) ? ((1ul << (sat)) - 1) : (uint32_t)(val))
+
+#endif /* __CORE_CMINSTR_H */
+
+/* end of file */
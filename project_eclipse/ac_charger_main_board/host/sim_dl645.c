@@ -0,0 +1,702 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief DL/T645-2007 电表仿真器（独立程序）
+ *
+ * 连接主机构建的电表串口（acp1000_run/com1）或真实串口， 应答 aw_ammeter.c
+ * 使用的读数据命令（控制码 0x11）：
+ *  - 00010000  正向有功总电能   XXXXXX.XX kWh
+ *  - 0201xx00  A/B/C 相电压     XXX.X V
+ *  - 0202xx00  A/B/C 相电流     XXX.XXX A
+ *  - 0203xx00  总/A/B/C 有功功率 XX.XXXX kW
+ * 其余数据标识回异常应答（无请求数据）。 地址为本表地址或全 AA 时应答。
+ *
+ * 按波特率（11 位/字节， 2400 bps 约 4.6 ms）模拟线路速度： 请求最后一个
+ * 字节“到达”后经过应答延时开始回复， 回复逐字节按线路速度发送。
+ *
+ * 电压、 电流由曲线文件（每行 "<秒> <电压V> <电流A>"， # 开头为注释）或命令
+ * 设置， 电能按功率（功率因数 1）累计。
+ *
+ * 统计（stats 命令、 -t 运行结束时输出）：
+ *  - 每个数据标识的交互耗时（请求第一个字节到回复最后一个字节）、 轮询间隔；
+ *  - 注入故障后到下一次正常交互完成的恢复时间及期间的请求数；
+ *  - 错误帧、 非本表地址、 不支持的标识等计数。
+ *
+ * 构建： 在 host 目录执行 make（见 Makefile）。
+ *
+ * 用法： sim_dl645 [选项] [串口]， 不指定串口时建立伪终端并输出从端名称。
+ *  - -a <12位十六进制>  表地址（默认 000000000001）
+ *  - -b <bps>           线路速度， 0 为不限速（默认 2400）
+ *  - -d <ms>            应答延时（默认 20）
+ *  - -e <kWh>           初始电能
+ *  - -v <V> -i <A>      初始电压、 电流
+ *  - -p <文件>          电压电流曲线
+ *  - -r <%>             随机故障比例
+ *  - -t <s>             运行时间， 结束时输出统计并退出
+ *
+ * 运行命令（标准输入）：
+ *  - vol <V> / curr <A> / energy <kWh>
+ *  - delay <ms> [n]     之后 n 次应答额外延时
+ *  - csum [n]           之后 n 次应答校验和错误
+ *  - partial [n]        之后 n 次应答只发送一半
+ *  - drop [n]           之后 n 次请求不应答
+ *  - silent <ms>        指定时间内不应答
+ *  - rand <%>           随机故障比例
+ *  - stats / reset / quit
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-09  xjc, first implementation
+ * - 1.01 16-10-10  xjc, 线路速度模拟移到 sim_wire.c
+ * - 1.02 16-10-18  xjc, 运行目录改为 acp1000_run， 由 Makefile 构建
+ * \endinternal
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "host_os.h"
+#include "sim_stat.h"
+#include "sim_wire.h"
+
+#define __FRAME_GAP_MS      100     /* 字节间隔超过该值认为帧结束（同驱动） */
+#define __BUF_SIZE          256
+#define __PROFILE_MAX       256
+
+#define __CTRL_READ         0x11
+#define __CTRL_READ_ACK     0x91
+#define __CTRL_READ_NAK     0xD1
+#define __ERR_NO_DATA       0x02
+
+/** \brief 故障类型 */
+enum {
+    __FAULT_NONE = 0,
+    __FAULT_DELAY,
+    __FAULT_CSUM,
+    __FAULT_PARTIAL,
+    __FAULT_DROP,
+    __FAULT_SILENT,
+    __FAULT_NUM
+};
+
+static const char *__g_fault_name[__FAULT_NUM] = {
+    "none", "delay", "csum", "partial", "drop", "silent"
+};
+
+/** \brief 数据项 */
+enum {
+    __ITEM_ENERGY = 0,
+    __ITEM_VOL,
+    __ITEM_CURR,
+    __ITEM_POWER,
+    __ITEM_NUM
+};
+
+/** \brief 曲线点 */
+struct __profile_point {
+    uint32_t ms;
+    double   vol;
+    double   curr;
+};
+
+/** \brief 仿真器状态（命令线程与串口线程共用， 由 host_os_klock 保护） */
+static struct __dl645_sim {
+    uint8_t     addr[6];
+    uint32_t    baud;
+    uint32_t    delay_ms;
+
+    double      energy;             /**< \brief kWh */
+    double      vol;                /**< \brief V */
+    double      curr;               /**< \brief A */
+    uint32_t    last_ms;            /**< \brief 上次累计电能的时刻 */
+
+    struct __profile_point profile[__PROFILE_MAX];
+    int         profile_num;
+    int         profile_idx;
+
+    /* 故障注入 */
+    uint32_t    fault_cnt[__FAULT_NUM];     /**< \brief 待注入次数 */
+    uint32_t    fault_delay_ms;
+    uint32_t    silent_until_ms;
+    uint32_t    rand_pct;
+
+    /* 统计 */
+    sim_stat_t  exch[__ITEM_NUM];
+    sim_stat_t  period[__ITEM_NUM];
+    uint64_t    last_req_ns[__ITEM_NUM];
+    sim_stat_t  recover;
+    sim_stat_t  recover_req;        /**< \brief 恢复期间的请求数（按 us 字段记录） */
+    uint64_t    fault_ns;           /**< \brief 最近一次故障时刻， 0 为无 */
+    uint32_t    fault_req;
+    uint32_t    injected[__FAULT_NUM];
+    uint32_t    req;
+    uint32_t    ack;
+    uint32_t    nak;
+    uint32_t    bad_frame;
+    uint32_t    other_addr;
+} __g_sim;
+
+/******************************************************************************/
+static void __stats_reset (void)
+{
+    int i;
+
+    for (i = 0; i < __ITEM_NUM; i++) {
+        sim_stat_reset(&__g_sim.exch[i]);
+        sim_stat_reset(&__g_sim.period[i]);
+        __g_sim.last_req_ns[i] = 0;
+    }
+    sim_stat_reset(&__g_sim.recover);
+    sim_stat_reset(&__g_sim.recover_req);
+    memset(__g_sim.injected, 0, sizeof(__g_sim.injected));
+    __g_sim.fault_ns   = 0;
+    __g_sim.req        = 0;
+    __g_sim.ack        = 0;
+    __g_sim.nak        = 0;
+    __g_sim.bad_frame  = 0;
+    __g_sim.other_addr = 0;
+}
+
+static void __stats_print (void)
+{
+    int i;
+
+    host_os_klock();
+    printf("requests %u ack %u nak %u bad_frame %u other_addr %u\n",
+           __g_sim.req, __g_sim.ack, __g_sim.nak,
+           __g_sim.bad_frame, __g_sim.other_addr);
+    printf("faults:");
+    for (i = 1; i < __FAULT_NUM; i++) {
+        printf(" %s %u", __g_fault_name[i], __g_sim.injected[i]);
+    }
+    printf("\n");
+
+    sim_stat_title();
+    for (i = 0; i < __ITEM_NUM; i++) {
+        sim_stat_print(&__g_sim.exch[i]);
+    }
+    for (i = 0; i < __ITEM_NUM; i++) {
+        sim_stat_print(&__g_sim.period[i]);
+    }
+    sim_stat_print(&__g_sim.recover);
+
+    /* 恢复期间的请求数不是时间， 单独输出 */
+    printf("%-20s %8u %10u %10.1f %10u\n",
+           __g_sim.recover_req.name,
+           __g_sim.recover_req.cnt,
+           __g_sim.recover_req.min,
+           __g_sim.recover_req.cnt ?
+               (double)__g_sim.recover_req.sum / __g_sim.recover_req.cnt : 0.0,
+           __g_sim.recover_req.max);
+    host_os_kunlock();
+    fflush(stdout);
+}
+
+/******************************************************************************/
+/* 按曲线和当前电压电流更新电能（调用时已加锁） */
+static void __meter_update (void)
+{
+    uint32_t now = host_os_ms();
+    struct __profile_point *p_pt;
+
+    __g_sim.energy += __g_sim.vol * __g_sim.curr / 1000.0 *
+                      (now - __g_sim.last_ms) / 3600000.0;
+    __g_sim.last_ms = now;
+
+    while (__g_sim.profile_idx < __g_sim.profile_num) {
+        p_pt = &__g_sim.profile[__g_sim.profile_idx];
+        if (p_pt->ms > now) {
+            break;
+        }
+        __g_sim.vol  = p_pt->vol;
+        __g_sim.curr = p_pt->curr;
+        __g_sim.profile_idx++;
+    }
+}
+
+static int __profile_load (const char *p_path)
+{
+    FILE  *p_file = fopen(p_path, "r");
+    char   line[128];
+    double sec, vol, curr;
+
+    if (NULL == p_file) {
+        return -1;
+    }
+    while ((NULL != fgets(line, sizeof(line), p_file)) &&
+           (__g_sim.profile_num < __PROFILE_MAX)) {
+        if ('#' == line[0]) {
+            continue;
+        }
+        if (3 == sscanf(line, "%lf %lf %lf", &sec, &vol, &curr)) {
+            __g_sim.profile[__g_sim.profile_num].ms   = (uint32_t)(sec * 1000);
+            __g_sim.profile[__g_sim.profile_num].vol  = vol;
+            __g_sim.profile[__g_sim.profile_num].curr = curr;
+            __g_sim.profile_num++;
+        }
+    }
+    fclose(p_file);
+    return 0;
+}
+
+/******************************************************************************/
+/* 无符号数转 BCD， 低字节在前 */
+static void __to_bcd (uint8_t *p_buf, int nbytes, uint32_t val)
+{
+    int i;
+
+    for (i = 0; i < nbytes; i++) {
+        p_buf[i] = (uint8_t)((((val / 10) % 10) << 4) | (val % 10));
+        val /= 100;
+    }
+}
+
+/* 按数据标识填写数据， 返回数据长度， -1 为不支持 */
+static int __item_get (uint32_t di, uint8_t *p_buf, int *p_item)
+{
+    uint32_t type  = di & 0xFFFF00FFu;
+    uint32_t phase = (di >> 8) & 0xFF;
+
+    if ((0x00010000u == di) || (0x00000000u == di)) {
+        *p_item = __ITEM_ENERGY;
+        __to_bcd(p_buf, 4, (uint32_t)(__g_sim.energy * 100 + 0.5));
+        return 4;
+    }
+    if ((0x02010000u == type) && (phase >= 1) && (phase <= 3)) {
+        *p_item = __ITEM_VOL;
+        __to_bcd(p_buf, 2, (uint32_t)(__g_sim.vol * 10 + 0.5));
+        return 2;
+    }
+    if ((0x02020000u == type) && (phase >= 1) && (phase <= 3)) {
+        *p_item = __ITEM_CURR;
+        __to_bcd(p_buf, 3, (uint32_t)(__g_sim.curr * 1000 + 0.5));
+        return 3;
+    }
+    if ((0x02030000u == type) && (phase <= 3)) {
+        *p_item = __ITEM_POWER;
+        __to_bcd(p_buf, 3, (uint32_t)(__g_sim.vol * __g_sim.curr / 100 + 0.5));
+        return 3;
+    }
+    return -1;
+}
+
+/* 组帧（前导 FE×4）， 返回帧长度 */
+static int __frame_build (uint8_t *p_tx, uint8_t ctrl, const uint8_t *p_data, int len)
+{
+    uint8_t  sum = 0;
+    int      i, n = 0;
+
+    for (i = 0; i < 4; i++) {
+        p_tx[n++] = 0xFE;
+    }
+    p_tx[n++] = 0x68;
+    memcpy(&p_tx[n], __g_sim.addr, 6);
+    n += 6;
+    p_tx[n++] = 0x68;
+    p_tx[n++] = ctrl;
+    p_tx[n++] = (uint8_t)len;
+    for (i = 0; i < len; i++) {
+        p_tx[n++] = p_data[i] + 0x33;
+    }
+    for (i = 4; i < n; i++) {
+        sum += p_tx[i];
+    }
+    p_tx[n++] = sum;
+    p_tx[n++] = 0x16;
+    return n;
+}
+
+/* 选择本次应答的故障（调用时已加锁） */
+static int __fault_pick (void)
+{
+    int kind;
+
+    if (host_os_ms() < __g_sim.silent_until_ms) {
+        return __FAULT_SILENT;
+    }
+    for (kind = __FAULT_DELAY; kind < __FAULT_SILENT; kind++) {
+        if (__g_sim.fault_cnt[kind] > 0) {
+            __g_sim.fault_cnt[kind]--;
+            return kind;
+        }
+    }
+    if ((__g_sim.rand_pct > 0) && ((uint32_t)(rand() % 100) < __g_sim.rand_pct)) {
+        kind = __FAULT_DELAY + rand() % (__FAULT_SILENT - __FAULT_DELAY);
+        if (__FAULT_DELAY == kind) {
+            __g_sim.fault_delay_ms = 1500;      /* 超过驱动的帧超时 */
+        }
+        return kind;
+    }
+    return __FAULT_NONE;
+}
+
+/******************************************************************************/
+/* 处理一个完整的请求帧， p_rx 指向第一个 0x68 */
+static void __frame_process (int fd, const uint8_t *p_rx, uint64_t first_ns, int wire_len)
+{
+    static const uint8_t bcast[6] = {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA};
+    uint8_t   data[32];
+    uint8_t   tx[64];
+    uint8_t   ctrl = p_rx[8];
+    int       len  = p_rx[9];
+    int       dlen, tx_len, item = -1, fault, i;
+    uint32_t  di = 0, delay_ms, baud;
+    uint64_t  byte_ns, end_ns;
+
+    if ((0 != memcmp(&p_rx[1], __g_sim.addr, 6)) && (0 != memcmp(&p_rx[1], bcast, 6))) {
+        host_os_klock();
+        __g_sim.other_addr++;
+        host_os_kunlock();
+        return;
+    }
+
+    for (i = 0; (i < len) && (i < 4); i++) {
+        di |= (uint32_t)(uint8_t)(p_rx[10 + i] - 0x33) << (8 * i);
+    }
+
+    host_os_klock();
+    __g_sim.req++;
+    __meter_update();
+
+    dlen = -1;
+    if ((__CTRL_READ == ctrl) && (len >= 4)) {
+        memcpy(data, &p_rx[10], 4);
+        for (i = 0; i < 4; i++) {
+            data[i] -= 0x33;
+        }
+        dlen = __item_get(di, &data[4], &item);
+    }
+    if (dlen >= 0) {
+        tx_len = __frame_build(tx, __CTRL_READ_ACK, data, 4 + dlen);
+        __g_sim.ack++;
+    } else {
+        data[0] = __ERR_NO_DATA;
+        tx_len  = __frame_build(tx, (uint8_t)(ctrl | 0xC0), data, 1);
+        __g_sim.nak++;
+    }
+
+    if (item >= 0) {
+        if (0 != __g_sim.last_req_ns[item]) {
+            sim_stat_add(&__g_sim.period[item],
+                         (uint32_t)((first_ns - __g_sim.last_req_ns[item]) / 1000));
+        }
+        __g_sim.last_req_ns[item] = first_ns;
+    }
+
+    fault    = __fault_pick();
+    delay_ms = __g_sim.delay_ms;
+    baud     = __g_sim.baud;
+    if (__FAULT_DELAY == fault) {
+        delay_ms += __g_sim.fault_delay_ms;
+    }
+    if (__FAULT_NONE != fault) {
+        __g_sim.injected[fault]++;
+        if (0 == __g_sim.fault_ns) {
+            __g_sim.fault_ns  = first_ns;
+            __g_sim.fault_req = 0;
+        }
+    }
+    if (0 != __g_sim.fault_ns) {
+        __g_sim.fault_req++;
+    }
+    host_os_kunlock();
+
+    if ((__FAULT_DROP == fault) || (__FAULT_SILENT == fault)) {
+        return;
+    }
+    if (__FAULT_CSUM == fault) {
+        tx[tx_len - 2] ^= 0x5A;
+    }
+    if (__FAULT_PARTIAL == fault) {
+        tx_len /= 2;
+    }
+
+    /* 请求按线路速度到达后， 再经过应答延时 */
+    byte_ns = sim_wire_byte_ns(baud, 11);
+    sim_wire_wait_until(first_ns + byte_ns * wire_len + delay_ms * 1000000ull);
+    end_ns = sim_wire_send(fd, tx, tx_len, byte_ns);
+
+    host_os_klock();
+    if ((item >= 0) && (__FAULT_NONE == fault)) {
+        sim_stat_add(&__g_sim.exch[item], (uint32_t)((end_ns - first_ns) / 1000));
+    }
+    if ((__FAULT_NONE == fault) && (0 != __g_sim.fault_ns)) {
+        sim_stat_add(&__g_sim.recover, (uint32_t)((end_ns - __g_sim.fault_ns) / 1000));
+        sim_stat_add(&__g_sim.recover_req, __g_sim.fault_req);
+        __g_sim.fault_ns = 0;
+    }
+    host_os_kunlock();
+}
+
+/*
+ * 在缓冲区中查找完整帧
+ * \return >0： 帧已处理， 返回消耗的字节数  0： 不完整  <0： 丢弃 -ret 个字节
+ */
+static int __frame_scan (int fd, uint8_t *p_buf, int n, uint64_t first_ns)
+{
+    uint8_t sum = 0;
+    int     i, start, len;
+
+    for (start = 0; (start < n) && (0x68 != p_buf[start]); start++) {
+    }
+    if (start >= n) {
+        return -n;
+    }
+    if (n - start < 10) {
+        return 0;
+    }
+    if (0x68 != p_buf[start + 7]) {
+        return -(start + 1);
+    }
+    len = p_buf[start + 9];
+    if (n - start < 12 + len) {
+        return 0;
+    }
+    for (i = start; i < start + 10 + len; i++) {
+        sum += p_buf[i];
+    }
+    if ((sum != p_buf[start + 10 + len]) || (0x16 != p_buf[start + 11 + len])) {
+        return -(start + 1);
+    }
+    __frame_process(fd, &p_buf[start], first_ns, start + 12 + len);
+    return start + 12 + len;
+}
+
+static void __serial_loop (int fd)
+{
+    uint8_t  buf[__BUF_SIZE];
+    uint64_t first_ns = 0;
+    int      n = 0, len, ret;
+
+    for (;;) {
+        len = host_os_fd_read(fd, &buf[n], sizeof(buf) - n, n ? __FRAME_GAP_MS : 200);
+        if (len < 0) {
+            host_os_sleep_ms(100);
+            continue;
+        }
+
+        host_os_klock();
+        __meter_update();
+        host_os_kunlock();
+
+        if (0 == len) {
+            if (n > 0) {
+                /* 字节间隔超时， 剩余数据不成帧 */
+                host_os_klock();
+                __g_sim.bad_frame++;
+                host_os_kunlock();
+                n = 0;
+            }
+            continue;
+        }
+        if (0 == n) {
+            first_ns = host_os_ns();
+        }
+        n += len;
+
+        while (n > 0) {
+            ret = __frame_scan(fd, buf, n, first_ns);
+            if (0 == ret) {
+                break;
+            }
+            if ((ret < 0) && (0x68 == buf[0])) {
+                host_os_klock();
+                __g_sim.bad_frame++;
+                host_os_kunlock();
+            }
+            if (ret < 0) {
+                ret = -ret;
+            }
+            memmove(buf, &buf[ret], n - ret);
+            n -= ret;
+            first_ns = host_os_ns();
+        }
+        if (n >= (int)sizeof(buf)) {
+            n = 0;
+        }
+    }
+}
+
+/******************************************************************************/
+static void __cmd_exec (char *p_line)
+{
+    char     cmd[16];
+    double   val = 0;
+    uint32_t n   = 1;
+    int      argc;
+
+    argc = sscanf(p_line, "%15s %lf %u", cmd, &val, &n);
+    if (argc < 1) {
+        return;
+    }
+
+    host_os_klock();
+    __meter_update();
+    if ((0 == strcmp(cmd, "vol")) && (argc >= 2)) {
+        __g_sim.vol = val;
+    } else if ((0 == strcmp(cmd, "curr")) && (argc >= 2)) {
+        __g_sim.curr = val;
+    } else if ((0 == strcmp(cmd, "energy")) && (argc >= 2)) {
+        __g_sim.energy = val;
+    } else if ((0 == strcmp(cmd, "delay")) && (argc >= 2)) {
+        __g_sim.fault_delay_ms             = (uint32_t)val;
+        __g_sim.fault_cnt[__FAULT_DELAY]   = n;
+    } else if (0 == strcmp(cmd, "csum")) {
+        __g_sim.fault_cnt[__FAULT_CSUM]    = (argc >= 2) ? (uint32_t)val : 1;
+    } else if (0 == strcmp(cmd, "partial")) {
+        __g_sim.fault_cnt[__FAULT_PARTIAL] = (argc >= 2) ? (uint32_t)val : 1;
+    } else if (0 == strcmp(cmd, "drop")) {
+        __g_sim.fault_cnt[__FAULT_DROP]    = (argc >= 2) ? (uint32_t)val : 1;
+    } else if ((0 == strcmp(cmd, "silent")) && (argc >= 2)) {
+        __g_sim.silent_until_ms = host_os_ms() + (uint32_t)val;
+    } else if ((0 == strcmp(cmd, "rand")) && (argc >= 2)) {
+        __g_sim.rand_pct = (uint32_t)val;
+    } else if (0 == strcmp(cmd, "reset")) {
+        __stats_reset();
+    } else if (0 == strcmp(cmd, "stats")) {
+        host_os_kunlock();
+        __stats_print();
+        return;
+    } else if (0 == strcmp(cmd, "quit")) {
+        host_os_kunlock();
+        __stats_print();
+        host_os_exit(0);
+    } else {
+        printf("unknown command: %s\n", p_line);
+    }
+    printf("V %.1f  I %.3f  E %.2f kWh\n", __g_sim.vol, __g_sim.curr, __g_sim.energy);
+    host_os_kunlock();
+}
+
+static void __cmd_task (void *p_arg)
+{
+    char line[128];
+
+    while (host_os_readline(line, sizeof(line)) >= 0) {
+        __cmd_exec(line);
+    }
+}
+
+static void __timer_task (void *p_arg)
+{
+    host_os_sleep_ms((uint32_t)(unsigned long)p_arg * 1000);
+    __stats_print();
+    host_os_exit(0);
+}
+
+static int __addr_parse (const char *p_str)
+{
+    unsigned int b;
+    int          i;
+
+    if (12 != strlen(p_str)) {
+        return -1;
+    }
+
+    /* 地址在帧中低字节在前 */
+    for (i = 0; i < 6; i++) {
+        if (1 != sscanf(&p_str[(5 - i) * 2], "%2x", &b)) {
+            return -1;
+        }
+        __g_sim.addr[i] = (uint8_t)b;
+    }
+    return 0;
+}
+
+int main (int argc, char *argv[])
+{
+    const char *p_port = NULL;
+    char        slave[128];
+    uint32_t    run_s  = 0;
+    int         fd, opt;
+
+    host_os_init();
+
+    __g_sim.baud     = 2400;
+    __g_sim.delay_ms = 20;
+    __g_sim.vol      = 220.0;
+    __addr_parse("000000000001");
+
+    __g_sim.exch[__ITEM_ENERGY].name  = "exch_energy";
+    __g_sim.exch[__ITEM_VOL].name     = "exch_voltage";
+    __g_sim.exch[__ITEM_CURR].name    = "exch_current";
+    __g_sim.exch[__ITEM_POWER].name   = "exch_power";
+    __g_sim.period[__ITEM_ENERGY].name = "period_energy";
+    __g_sim.period[__ITEM_VOL].name    = "period_voltage";
+    __g_sim.period[__ITEM_CURR].name   = "period_current";
+    __g_sim.period[__ITEM_POWER].name  = "period_power";
+    __g_sim.recover.name     = "recover";
+    __g_sim.recover_req.name = "recover_requests";
+
+    while (-1 != (opt = getopt(argc, argv, "a:b:d:e:v:i:p:r:t:"))) {
+        switch (opt) {
+        case 'a':
+            if (0 != __addr_parse(optarg)) {
+                fprintf(stderr, "bad address: %s\n", optarg);
+                return 1;
+            }
+            break;
+        case 'b': __g_sim.baud     = (uint32_t)atoi(optarg); break;
+        case 'd': __g_sim.delay_ms = (uint32_t)atoi(optarg); break;
+        case 'e': __g_sim.energy   = atof(optarg);           break;
+        case 'v': __g_sim.vol      = atof(optarg);           break;
+        case 'i': __g_sim.curr     = atof(optarg);           break;
+        case 'r': __g_sim.rand_pct = (uint32_t)atoi(optarg); break;
+        case 't': run_s            = (uint32_t)atoi(optarg); break;
+        case 'p':
+            if (0 != __profile_load(optarg)) {
+                fprintf(stderr, "open %s failed\n", optarg);
+                return 1;
+            }
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-a addr] [-b bps] [-d ms] [-e kWh] "
+                            "[-v V] [-i A] [-p file] [-r %%] [-t s] [port]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (optind < argc) {
+        p_port = argv[optind];
+    }
+
+    if (NULL != p_port) {
+        fd = host_os_tty_open(p_port);
+    } else {
+        fd = host_os_pty_open(slave, sizeof(slave));
+        if (fd >= 0) {
+            printf("pty: %s\n", slave);
+        }
+    }
+    if (fd < 0) {
+        fprintf(stderr, "open %s failed\n", p_port ? p_port : "pty");
+        return 1;
+    }
+
+    /* 真实串口时设置 8E1， 伪终端忽略 */
+    host_os_tty_cfg(fd, __g_sim.baud ? __g_sim.baud : 2400, 8, 'E', 1);
+
+    __g_sim.last_ms = host_os_ms();
+    __meter_update();
+
+    host_os_thread_create("cmd", __cmd_task, NULL);
+    if (run_s > 0) {
+        host_os_thread_create("timer", __timer_task, (void *)(unsigned long)run_s);
+    }
+
+    __serial_loop(fd);
+    return 0;
+}
+
+/* end of file */
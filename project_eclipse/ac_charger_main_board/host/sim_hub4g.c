@@ -0,0 +1,514 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 集中器（Modbus-RTU 主站）压力测试工具（独立程序）
+ *
+ * 按权重随机选择操作， 连续轮询集中器串口上的 Modbus 从站（ac_modbus_hdl.c），
+ * 统计每种操作的应答时间百分位数、 超时、 CRC 错误和异常应答。 串口为主机
+ * 构建的伪终端（acp1000_run/com4）或接真实主板的串口。
+ * 主机构建的从站按 5 ms 字节间隔判断请求结束（host_mb_slave.c）， 应答时间
+ * 包含该间隔。
+ *
+ * 默认操作（寄存器数与 ac_modbus_reg_map.h 一致）：
+ *  - r1 / r100 / r180 / r200 / r2000   读遥信、 充电数据、 用户信息、 整桩数据、 卡数据
+ *  - r1200 / r1210 / r1220             读负荷、 预约、 卡名单控制
+ *  - ver                               0x61 读版本
+ *  - w1503                             写遥控 4G 通讯状态（集中器心跳）
+ * -w 时增加遥调写操作（会改变并保存主板参数， 接真实主板时注意）：
+ *  - w1000                             对时（当前时间）， 每次连写 3 帧
+ *  - w1006 / w1100                     写电价、 用户控制（数据为 0）
+ *  - upg                               0x60 非法地址（不进入升级）
+ *
+ * 操作文件（-m）每行：
+ *   <名称> <权重> <功能码> <地址> <数量> [x<连发次数>] [数据...|time]
+ * 数据为十六进制寄存器值， 不足时补 0； time 为当前时间（年月日时分秒）。
+ * 功能码 0x60/0x61 的地址、 数量按寄存器格式放入 PDU。
+ *
+ * 构建： 在 host 目录执行 make（见 Makefile）。
+ *
+ * 用法： sim_hub4g [选项] <串口>
+ *  - -a <地址>    从站地址（默认 1）
+ *  - -b <bps>     波特率（默认 19200）， -P <N|E|O> 校验（默认 N）
+ *  - -l           按线路速度发送请求（伪终端时模拟真实线路）
+ *  - -i <ms>      两次请求的间隔（默认 0， 即收到应答后立即发送）
+ *  - -T <ms>      应答超时（默认 500）
+ *  - -n <次数>    请求次数， -t <s> 运行时间（默认 10 s）
+ *  - -m <文件>    操作文件， -w 默认操作加入遥调写
+ *  - -c           以 CSV 输出结果
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-11  xjc, first implementation
+ * - 1.01 16-10-18  xjc, 运行目录改为 acp1000_run， 由 Makefile 构建
+ * \endinternal
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "host_os.h"
+#include "sim_stat.h"
+#include "sim_wire.h"
+
+#define __OP_MAX            32
+#define __REG_MAX           123     /* 写多个寄存器的最大数量 */
+#define __FRAME_MAX         256
+#define __GAP_MS            20      /* 应答内字节间隔超过该值认为帧结束 */
+
+/** \brief 操作 */
+struct __op {
+    char        name[16];
+    uint32_t    weight;
+    uint8_t     fc;
+    uint16_t    addr;
+    uint16_t    num;
+    uint32_t    burst;              /**< \brief 每次选中时连发的帧数 */
+    int         time;               /**< \brief 数据为当前时间 */
+    uint16_t    dat[__REG_MAX];
+
+    /* 统计 */
+    sim_stat_t  stat;               /**< \brief 正常应答的应答时间 */
+    uint32_t    sent;
+    uint32_t    ok;
+    uint32_t    exception;
+    uint32_t    timeout;
+    uint32_t    crc_err;
+    uint32_t    bad;                /**< \brief 地址、 功能码或长度不符 */
+};
+
+static struct __op  __g_op[__OP_MAX];
+static int          __g_op_num;
+static uint32_t     __g_weight_sum;
+static uint32_t     __g_stray;      /**< \brief 发送前收到的多余字节 */
+
+/** \brief 默认操作 */
+static const char *__g_def_ops[] = {
+    "r1    20 3 1    2",
+    "r100  20 3 100  34",
+    "r180  5  3 180  10",
+    "r200  10 3 200  10",
+    "r2000 2  3 2000 26",
+    "r1200 2  3 1200 8",
+    "r1210 2  3 1210 8",
+    "r1220 2  3 1220 8",
+    "ver   2  0x61 1 20",
+    "w1503 5  6 1503 1 AA",
+};
+
+static const char *__g_def_wr_ops[] = {
+    "w1000 2  16 1000 6  x3 time",
+    "w1006 1  16 1006 28",
+    "w1100 1  16 1100 23",
+    "upg   1  0x60 0 1",
+};
+
+/******************************************************************************/
+static uint16_t __crc16 (const uint8_t *p_buf, int len)
+{
+    uint16_t crc = 0xFFFF;
+    int      i;
+
+    while (len-- > 0) {
+        crc ^= *p_buf++;
+        for (i = 0; i < 8; i++) {
+            crc = (crc & 1) ? ((crc >> 1) ^ 0xA001) : (crc >> 1);
+        }
+    }
+    return crc;
+}
+
+/* 解析一行操作， 0： 成功 */
+static int __op_parse (const char *p_line)
+{
+    struct __op *p_op;
+    char         buf[256];
+    char        *argv[8 + __REG_MAX];
+    char        *p_save = NULL;
+    char        *p_tok;
+    int          argc = 0, i, n = 0;
+
+    if (__g_op_num >= __OP_MAX) {
+        return -1;
+    }
+    strncpy(buf, p_line, sizeof(buf) - 1);
+    buf[sizeof(buf) - 1] = '\0';
+    for (p_tok = strtok_r(buf, " \t\r\n", &p_save);
+         (NULL != p_tok) && (argc < (int)(sizeof(argv) / sizeof(argv[0])));
+         p_tok = strtok_r(NULL, " \t\r\n", &p_save)) {
+        argv[argc++] = p_tok;
+    }
+    if ((0 == argc) || ('#' == argv[0][0])) {
+        return 0;
+    }
+    if (argc < 5) {
+        return -1;
+    }
+
+    p_op = &__g_op[__g_op_num];
+    memset(p_op, 0, sizeof(*p_op));
+    strncpy(p_op->name, argv[0], sizeof(p_op->name) - 1);
+    p_op->weight = (uint32_t)strtoul(argv[1], NULL, 0);
+    p_op->fc     = (uint8_t)strtoul(argv[2], NULL, 0);
+    p_op->addr   = (uint16_t)strtoul(argv[3], NULL, 0);
+    p_op->num    = (uint16_t)strtoul(argv[4], NULL, 0);
+    p_op->burst  = 1;
+    if (p_op->num > __REG_MAX) {
+        return -1;
+    }
+
+    for (i = 5; i < argc; i++) {
+        if ('x' == argv[i][0]) {
+            p_op->burst = (uint32_t)atoi(&argv[i][1]);
+        } else if (0 == strcmp(argv[i], "time")) {
+            p_op->time = 1;
+        } else if (n < __REG_MAX) {
+            p_op->dat[n++] = (uint16_t)strtoul(argv[i], NULL, 16);
+        }
+    }
+
+    p_op->stat.name = p_op->name;
+    __g_weight_sum += p_op->weight;
+    __g_op_num++;
+    return 0;
+}
+
+static struct __op *__op_pick (void)
+{
+    uint32_t r;
+    int      i;
+
+    if (0 == __g_weight_sum) {
+        return NULL;
+    }
+    r = (uint32_t)rand() % __g_weight_sum;
+    for (i = 0; i < __g_op_num; i++) {
+        if (r < __g_op[i].weight) {
+            return &__g_op[i];
+        }
+        r -= __g_op[i].weight;
+    }
+    return NULL;
+}
+
+/******************************************************************************/
+/* 组请求帧， 返回帧长度 */
+static int __req_build (struct __op *p_op, uint8_t slave, uint8_t *p_tx)
+{
+    time_t    now;
+    struct tm tm;
+    uint16_t  crc;
+    int       n = 0, i;
+
+    if (p_op->time) {
+        now = time(NULL);
+        localtime_r(&now, &tm);
+        p_op->dat[0] = (uint16_t)(tm.tm_year + 1900);
+        p_op->dat[1] = (uint16_t)(tm.tm_mon + 1);
+        p_op->dat[2] = (uint16_t)tm.tm_mday;
+        p_op->dat[3] = (uint16_t)tm.tm_hour;
+        p_op->dat[4] = (uint16_t)tm.tm_min;
+        p_op->dat[5] = (uint16_t)tm.tm_sec;
+    }
+
+    p_tx[n++] = slave;
+    p_tx[n++] = p_op->fc;
+    p_tx[n++] = (uint8_t)(p_op->addr >> 8);
+    p_tx[n++] = (uint8_t)p_op->addr;
+
+    if (6 == p_op->fc) {
+        p_tx[n++] = (uint8_t)(p_op->dat[0] >> 8);
+        p_tx[n++] = (uint8_t)p_op->dat[0];
+    } else {
+        p_tx[n++] = (uint8_t)(p_op->num >> 8);
+        p_tx[n++] = (uint8_t)p_op->num;
+    }
+
+    if ((16 == p_op->fc) || (0x60 == p_op->fc)) {
+        p_tx[n++] = (uint8_t)(p_op->num * 2);
+        for (i = 0; i < p_op->num; i++) {
+            p_tx[n++] = (uint8_t)(p_op->dat[i] >> 8);
+            p_tx[n++] = (uint8_t)p_op->dat[i];
+        }
+    }
+
+    crc = __crc16(p_tx, n);
+    p_tx[n++] = (uint8_t)crc;
+    p_tx[n++] = (uint8_t)(crc >> 8);
+    return n;
+}
+
+/*
+ * 按已收到的字节推算应答帧长度
+ * \return >0： 帧长度  0： 还不能确定
+ */
+static int __rsp_len (const uint8_t *p_rx, int n)
+{
+    if (n < 3) {
+        return 0;
+    }
+    if (p_rx[1] & 0x80) {
+        return 5;
+    }
+    switch (p_rx[1]) {
+    case 3:
+    case 4:
+    case 0x61:
+        return 5 + p_rx[2];
+    case 6:
+    case 16:
+    case 0x60:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+/* 执行一次请求并统计 */
+static void __op_do (struct __op *p_op,
+                     int          fd,
+                     uint8_t      slave,
+                     uint64_t     byte_ns,
+                     int          timeout_ms)
+{
+    uint8_t  tx[__FRAME_MAX], rx[__FRAME_MAX];
+    int      tx_len, n = 0, want = 0, len, wait;
+    uint64_t start_ns, end_ns;
+    uint16_t crc;
+
+    /* 清除残留数据 */
+    while ((len = host_os_fd_read(fd, rx, sizeof(rx), 0)) > 0) {
+        __g_stray += len;
+    }
+
+    tx_len   = __req_build(p_op, slave, tx);
+    start_ns = host_os_ns();
+    end_ns   = sim_wire_send(fd, tx, tx_len, byte_ns);
+    p_op->sent++;
+
+    /* 第一个字节等待应答超时， 之后按字节间隔 */
+    for (;;) {
+        if (0 == n) {
+            wait = timeout_ms - (int)((host_os_ns() - end_ns) / 1000000);
+            if (wait <= 0) {
+                break;
+            }
+        } else {
+            wait = __GAP_MS;
+        }
+        len = host_os_fd_read(fd, &rx[n], sizeof(rx) - n, wait);
+        if (len <= 0) {
+            break;
+        }
+        n   += len;
+        want = __rsp_len(rx, n);
+        if ((want > 0) && (n >= want)) {
+            break;
+        }
+    }
+    end_ns = host_os_ns();
+
+    if (0 == n) {
+        p_op->timeout++;
+        return;
+    }
+    if ((want <= 0) || (n < want) || (n < 4)) {
+        p_op->bad++;
+        return;
+    }
+    crc = __crc16(rx, want - 2);
+    if ((rx[want - 2] != (uint8_t)crc) || (rx[want - 1] != (uint8_t)(crc >> 8))) {
+        p_op->crc_err++;
+        return;
+    }
+    if ((rx[0] != slave) || ((rx[1] & 0x7F) != p_op->fc)) {
+        p_op->bad++;
+        return;
+    }
+    if (rx[1] & 0x80) {
+        p_op->exception++;
+    } else {
+        p_op->ok++;
+    }
+    sim_stat_add(&p_op->stat, (uint32_t)((end_ns - start_ns) / 1000));
+}
+
+/******************************************************************************/
+static void __report (uint64_t run_ns, int csv)
+{
+    struct __op *p_op;
+    uint32_t     sent = 0;
+    int          i;
+
+    for (i = 0; i < __g_op_num; i++) {
+        sent += __g_op[i].sent;
+    }
+
+    if (csv) {
+        printf("op,fc,addr,num,sent,ok,exception,timeout,crc_err,bad,"
+               "min_us,avg_us,p50_us,p90_us,p99_us,max_us\n");
+    } else {
+        printf("requests %u in %.1f s (%.1f/s), stray bytes %u\n",
+               sent, run_ns / 1e9, run_ns ? sent * 1e9 / run_ns : 0.0, __g_stray);
+        printf("%-8s %8s %8s %8s %8s %8s %8s\n",
+               "op", "sent", "ok", "except", "timeout", "crc_err", "bad");
+    }
+
+    for (i = 0; i < __g_op_num; i++) {
+        p_op = &__g_op[i];
+        if (0 == p_op->sent) {
+            continue;
+        }
+        if (csv) {
+            printf("%s,0x%02X,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u\n",
+                   p_op->name, p_op->fc, p_op->addr, p_op->num,
+                   p_op->sent, p_op->ok, p_op->exception,
+                   p_op->timeout, p_op->crc_err, p_op->bad,
+                   p_op->stat.min,
+                   p_op->stat.cnt ? (uint32_t)(p_op->stat.sum / p_op->stat.cnt) : 0,
+                   sim_stat_pct(&p_op->stat, 50),
+                   sim_stat_pct(&p_op->stat, 90),
+                   sim_stat_pct(&p_op->stat, 99),
+                   p_op->stat.max);
+        } else {
+            printf("%-8s %8u %8u %8u %8u %8u %8u\n",
+                   p_op->name, p_op->sent, p_op->ok, p_op->exception,
+                   p_op->timeout, p_op->crc_err, p_op->bad);
+        }
+    }
+
+    if (!csv) {
+        sim_stat_title();
+        for (i = 0; i < __g_op_num; i++) {
+            if (__g_op[i].sent) {
+                sim_stat_print(&__g_op[i].stat);
+            }
+        }
+    }
+    fflush(stdout);
+}
+
+static int __ops_load (const char *p_path)
+{
+    FILE *p_file = fopen(p_path, "r");
+    char  line[256];
+
+    if (NULL == p_file) {
+        return -1;
+    }
+    while (NULL != fgets(line, sizeof(line), p_file)) {
+        if (0 != __op_parse(line)) {
+            fprintf(stderr, "bad op: %s", line);
+        }
+    }
+    fclose(p_file);
+    return 0;
+}
+
+static void __usage (const char *p_name)
+{
+    fprintf(stderr, "usage: %s [-a addr] [-b bps] [-P N|E|O] [-l] [-i ms] [-T ms] "
+                    "[-n count] [-t s] [-m file] [-w] [-c] <port>\n", p_name);
+}
+
+int main (int argc, char *argv[])
+{
+    const char  *p_ops     = NULL;
+    uint8_t      slave     = 1;
+    uint32_t     baud      = 19200;
+    char         parity    = 'N';
+    int          line      = 0;
+    uint32_t     interval  = 0;
+    int          timeout   = 500;
+    uint32_t     count     = 0;
+    uint32_t     run_s     = 10;
+    int          wr        = 0;
+    int          csv       = 0;
+    struct __op *p_op;
+    uint64_t     byte_ns   = 0, start_ns;
+    uint32_t     sent      = 0, i;
+    int          fd, opt;
+
+    host_os_init();
+
+    while (-1 != (opt = getopt(argc, argv, "a:b:P:li:T:n:t:m:wc"))) {
+        switch (opt) {
+        case 'a': slave    = (uint8_t)atoi(optarg);   break;
+        case 'b': baud     = (uint32_t)atoi(optarg);  break;
+        case 'P': parity   = optarg[0];               break;
+        case 'l': line     = 1;                       break;
+        case 'i': interval = (uint32_t)atoi(optarg);  break;
+        case 'T': timeout  = atoi(optarg);            break;
+        case 'n': count    = (uint32_t)atoi(optarg);  break;
+        case 't': run_s    = (uint32_t)atoi(optarg);  break;
+        case 'm': p_ops    = optarg;                  break;
+        case 'w': wr       = 1;                       break;
+        case 'c': csv      = 1;                       break;
+        default:
+            __usage(argv[0]);
+            return 1;
+        }
+    }
+    if (optind != argc - 1) {
+        __usage(argv[0]);
+        return 1;
+    }
+
+    if (NULL != p_ops) {
+        if (0 != __ops_load(p_ops)) {
+            fprintf(stderr, "open %s failed\n", p_ops);
+            return 1;
+        }
+    } else {
+        for (i = 0; i < sizeof(__g_def_ops) / sizeof(__g_def_ops[0]); i++) {
+            __op_parse(__g_def_ops[i]);
+        }
+        for (i = 0; wr && (i < sizeof(__g_def_wr_ops) / sizeof(__g_def_wr_ops[0])); i++) {
+            __op_parse(__g_def_wr_ops[i]);
+        }
+    }
+    if (0 == __g_weight_sum) {
+        fprintf(stderr, "no op\n");
+        return 1;
+    }
+
+    fd = host_os_tty_open(argv[optind]);
+    if (fd < 0) {
+        fprintf(stderr, "open %s failed\n", argv[optind]);
+        return 1;
+    }
+    host_os_tty_cfg(fd, baud, 8, parity, 1);
+    if (line) {
+        byte_ns = sim_wire_byte_ns(baud, ('N' == parity) ? 10 : 11);
+    }
+
+    start_ns = host_os_ns();
+    while (((0 != count) && (sent < count)) ||
+           ((0 == count) && (host_os_ns() - start_ns < run_s * 1000000000ull))) {
+        p_op = __op_pick();
+        for (i = 0; i < p_op->burst; i++) {
+            __op_do(p_op, fd, slave, byte_ns, timeout);
+            sent++;
+        }
+        if (interval) {
+            host_os_sleep_ms(interval);
+        }
+    }
+
+    __report(host_os_ns() - start_ns, csv);
+    return 0;
+}
+
+/* end of file */
@@ -0,0 +1,120 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 仿真器的耗时统计
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-09  xjc, first implementation
+ * - 1.01 16-10-11  xjc, 保存样本以计算百分位数
+ * \endinternal
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim_stat.h"
+
+static int __u32_cmp (const void *p_a, const void *p_b)
+{
+    uint32_t a = *(const uint32_t *)p_a;
+    uint32_t b = *(const uint32_t *)p_b;
+
+    return (a > b) - (a < b);
+}
+
+void sim_stat_reset (sim_stat_t *p_stat)
+{
+    p_stat->cnt = 0;
+    p_stat->min = 0;
+    p_stat->max = 0;
+    p_stat->sum = 0;
+
+    free(p_stat->p_samples);
+    p_stat->p_samples = NULL;
+    p_stat->size      = 0;
+}
+
+void sim_stat_add (sim_stat_t *p_stat, uint32_t us)
+{
+    uint32_t *p_new;
+
+    if (p_stat->cnt >= p_stat->size) {
+        p_new = realloc(p_stat->p_samples,
+                        (p_stat->size ? p_stat->size * 2 : 256) * sizeof(uint32_t));
+        if (NULL != p_new) {
+            p_stat->p_samples = p_new;
+            p_stat->size      = p_stat->size ? p_stat->size * 2 : 256;
+        }
+    }
+    if (p_stat->cnt < p_stat->size) {
+        p_stat->p_samples[p_stat->cnt] = us;
+    }
+
+    if ((0 == p_stat->cnt) || (us < p_stat->min)) {
+        p_stat->min = us;
+    }
+    if (us > p_stat->max) {
+        p_stat->max = us;
+    }
+    p_stat->sum += us;
+    p_stat->cnt++;
+}
+
+uint32_t sim_stat_pct (const sim_stat_t *p_stat, double pct)
+{
+    uint32_t  n = (p_stat->cnt < p_stat->size) ? p_stat->cnt : p_stat->size;
+    uint32_t *p_sort;
+    uint32_t  idx, val;
+
+    if (0 == n) {
+        return 0;
+    }
+    p_sort = malloc(n * sizeof(uint32_t));
+    if (NULL == p_sort) {
+        return 0;
+    }
+    memcpy(p_sort, p_stat->p_samples, n * sizeof(uint32_t));
+    qsort(p_sort, n, sizeof(uint32_t), __u32_cmp);
+
+    /* 最近秩法 */
+    idx = (uint32_t)(pct / 100.0 * n + 0.999999);
+    idx = (idx > 0) ? (idx - 1) : 0;
+    val = p_sort[(idx < n) ? idx : (n - 1)];
+    free(p_sort);
+    return val;
+}
+
+void sim_stat_title (void)
+{
+    printf("%-20s %8s %10s %10s %10s %10s %10s %10s\n",
+           "item", "count", "min(ms)", "avg(ms)", "p50(ms)", "p90(ms)", "p99(ms)", "max(ms)");
+}
+
+void sim_stat_print (const sim_stat_t *p_stat)
+{
+    uint32_t avg = p_stat->cnt ? (uint32_t)(p_stat->sum / p_stat->cnt) : 0;
+
+    printf("%-20s %8u %10.3f %10.3f %10.3f %10.3f %10.3f %10.3f\n",
+           p_stat->name,
+           p_stat->cnt,
+           p_stat->min / 1000.0,
+           avg / 1000.0,
+           sim_stat_pct(p_stat, 50) / 1000.0,
+           sim_stat_pct(p_stat, 90) / 1000.0,
+           sim_stat_pct(p_stat, 99) / 1000.0,
+           p_stat->max / 1000.0);
+}
+
+/* end of file */
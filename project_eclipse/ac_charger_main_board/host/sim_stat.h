@@ -0,0 +1,70 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 仿真器的耗时统计（次数、 最小、 平均、 最大、 百分位数）
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-09  xjc, first implementation
+ * - 1.01 16-10-11  xjc, 保存样本以计算百分位数
+ * \endinternal
+ */
+
+#ifndef __SIM_STAT_H
+#define __SIM_STAT_H
+
+#include <stdint.h>
+
+/**
+ * \brief 一项耗时统计（单位 us）
+ */
+typedef struct sim_stat {
+    const char *name;
+    uint32_t    cnt;
+    uint32_t    min;
+    uint32_t    max;
+    uint64_t    sum;
+    uint32_t   *p_samples;      /**< \brief 样本（按需扩大） */
+    uint32_t    size;
+} sim_stat_t;
+
+/**
+ * \brief 清零（保留名称）， 释放样本
+ */
+void sim_stat_reset (sim_stat_t *p_stat);
+
+/**
+ * \brief 加入一个样本
+ */
+void sim_stat_add (sim_stat_t *p_stat, uint32_t us);
+
+/**
+ * \brief 百分位数（us）
+ * \param[in] pct : 0~100
+ */
+uint32_t sim_stat_pct (const sim_stat_t *p_stat, double pct);
+
+/**
+ * \brief 输出表头
+ */
+void sim_stat_title (void);
+
+/**
+ * \brief 输出一行（时间以 ms 显示）
+ */
+void sim_stat_print (const sim_stat_t *p_stat);
+
+#endif /* __SIM_STAT_H */
+
+/* end of file */
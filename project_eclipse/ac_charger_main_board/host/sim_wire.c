@@ -0,0 +1,60 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 仿真器的线路速度模拟
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-10  xjc, first implementation
+ * \endinternal
+ */
+
+#include "host_os.h"
+#include "sim_wire.h"
+
+uint64_t sim_wire_byte_ns (uint32_t baud, int bits)
+{
+    return baud ? (1000000000ull * bits / baud) : 0;
+}
+
+void sim_wire_wait_until (uint64_t ns)
+{
+    uint64_t now = host_os_ns();
+
+    if (ns > now) {
+        host_os_sleep_us((uint32_t)((ns - now) / 1000));
+    }
+}
+
+uint64_t sim_wire_send (int fd, const uint8_t *p_buf, int len, uint64_t byte_ns)
+{
+    uint64_t t;
+    int      i;
+
+    if (0 == byte_ns) {
+        host_os_fd_write(fd, p_buf, len);
+        return host_os_ns();
+    }
+
+    /* 按绝对时刻排程， 休眠误差不累计 */
+    t = host_os_ns();
+    for (i = 0; i < len; i++) {
+        t += byte_ns;
+        sim_wire_wait_until(t);
+        host_os_fd_write(fd, &p_buf[i], 1);
+    }
+    return t;
+}
+
+/* end of file */
@@ -0,0 +1,52 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 仿真器的线路速度模拟
+ *
+ * 伪终端没有波特率， 仿真器按每字节时间逐字节发送， 并按请求长度推算
+ * 请求在真实线路上的到达时刻。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-10  xjc, first implementation
+ * \endinternal
+ */
+
+#ifndef __SIM_WIRE_H
+#define __SIM_WIRE_H
+
+#include <stdint.h>
+
+/**
+ * \brief 每字节时间（ns）
+ * \param[in] baud : 波特率， 0 为不限速
+ * \param[in] bits : 每字节位数（含起始、 校验、 停止位， 如 8N1 为 10）
+ */
+uint64_t sim_wire_byte_ns (uint32_t baud, int bits);
+
+/**
+ * \brief 等到指定时刻（host_os_ns 时间）
+ */
+void sim_wire_wait_until (uint64_t ns);
+
+/**
+ * \brief 按线路速度发送
+ * \param[in] byte_ns : 每字节时间， 0 为一次写入
+ * \return 最后一个字节发送完的时刻
+ */
+uint64_t sim_wire_send (int fd, const uint8_t *p_buf, int len, uint64_t byte_ns);
+
+#endif /* __SIM_WIRE_H */
+
+/* end of file */
@@ -0,0 +1,939 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief ZLG600A 读卡模块仿真器（独立程序）
+ *
+ * 连接主机构建的读卡器串口（acp1000_run/com3）或真实串口， 实现 aw_iccreader.c
+ * 使用的新帧格式：
+ *   02 | 长度(2) | 命令/状态(2) | 数据 | 异或校验 | 03
+ * 长度为命令（状态）与数据的字节数， 校验为命令（状态）与数据的异或。
+ *
+ * 支持的命令：
+ *  - 3224 激活卡， 回复 类型 | UID长度 | UID
+ *  - 0246 直接密钥验证（按卡的扇区尾块检查 A/B 密钥）
+ *  - 0247 / 0248 块读 / 块写（须先验证所在扇区）
+ *  - 024E 自动检测， 进入后卡进场时主动上报 ATQ | SAK | UID长度 | UID [| 数据块]，
+ *    上报后退出自动检测； 请求代码为 IDLE 时停留在场内的卡不重复上报
+ *  - 3190 / 3191 打开 / 关闭射频， 3001 / 3111 / 3113 / 3114 控制命令
+ *  - 接触卡命令回复失败状态
+ *
+ * 卡片为 S50 / S70， 数据块默认为 0， 扇区尾块密钥默认为 FF。 “放卡/拿走”
+ * 由命令或时间线文件（每行 "<秒> <命令>"）驱动。
+ *
+ * 统计（stats 命令、 -t 运行结束时输出）：
+ *  - 每类命令的交互耗时（请求第一个字节到回复最后一个字节）；
+ *  - 每次刷卡从放卡到送出 UID、 密钥验证成功、 读完 n 个数据块的时间；
+ *  - 状态失败、 错误帧、 上报次数、 未读完就拿走的刷卡次数。
+ *
+ * 构建： 在 host 目录执行 make（见 Makefile）。
+ *
+ * 用法： sim_zlg600a [选项] [串口]， 不指定串口时建立伪终端并输出从端名称。
+ *  - -b <bps>    线路速度， 0 为不限速（默认 57600）
+ *  - -d <ms>     命令执行时间（默认 5）
+ *  - -s <ms>     自动检测发现进场卡的时间（默认 30）
+ *  - -n <块数>   一次刷卡读完的块数（默认 3， 同 card_reader.c）
+ *  - -p <文件>   时间线
+ *  - -r <%>      随机故障比例
+ *  - -t <s>      运行时间， 结束时输出统计并退出
+ *
+ * 运行命令（标准输入或时间线）：
+ *  - card <uid> [s70]              定义卡（UID 为 8 位十六进制， 按帧中字节顺序）
+ *  - blk <uid> <块> <32位十六进制> 设置数据块
+ *  - key <uid> <扇区> <12位十六进制> 设置扇区密钥A
+ *  - tap <uid> [ms]                放卡指定时间后拿走（默认 500）
+ *  - place <uid> / remove          放卡 / 拿走
+ *  - corrupt [n] / partial [n] / drop [n] / slow <ms> [n] / rand <%>
+ *  - stats / reset / quit
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-10  xjc, first implementation
+ * - 1.01 16-10-18  xjc, 运行目录改为 acp1000_run， 由 Makefile 构建
+ * \endinternal
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "host_os.h"
+#include "sim_stat.h"
+#include "sim_wire.h"
+
+#define __START_CODE        0x02
+#define __END_CODE          0x03
+#define __INFO_MAX          265     /* 同 aw_iccreader.c */
+#define __BUF_SIZE          512
+#define __CARD_MAX          8
+#define __BLK_MAX           256     /* S70 */
+#define __LOOP_MS           5       /* 串口等待间隔， 兼作放卡/拿走的检查周期 */
+
+#define __CMD_KEY_AUTH      0x0246
+#define __CMD_BLK_READ      0x0247
+#define __CMD_BLK_WRITE     0x0248
+#define __CMD_AUTO_DETECT   0x024E
+#define __CMD_BAUD_SET      0x3001
+#define __CMD_INFO_GET      0x3111
+#define __CMD_BUZZER_SET    0x3113
+#define __CMD_LED_SET       0x3114
+#define __CMD_RF_OPEN       0x3190
+#define __CMD_RF_CLOSE      0x3191
+#define __CMD_CARD_ACTIVE   0x3224
+
+/* 失败状态（仿真器自定义， 驱动只区分是否为 0） */
+#define __ST_OK             0x0000
+#define __ST_NO_CARD        0x0101
+#define __ST_AUTH_FAIL      0x0102
+#define __ST_NOT_AUTH       0x0103
+#define __ST_PARAM          0x0104
+#define __ST_UNSUPPORT      0x0105
+
+/** \brief 故障类型 */
+enum {
+    __FAULT_NONE = 0,
+    __FAULT_SLOW,
+    __FAULT_CORRUPT,
+    __FAULT_PARTIAL,
+    __FAULT_DROP,
+    __FAULT_NUM
+};
+
+static const char *__g_fault_name[__FAULT_NUM] = {
+    "none", "slow", "corrupt", "partial", "drop"
+};
+
+/** \brief 命令统计分类 */
+enum {
+    __OP_ACTIVE = 0,
+    __OP_AUTH,
+    __OP_READ,
+    __OP_WRITE,
+    __OP_DETECT,
+    __OP_RF,
+    __OP_CTRL,
+    __OP_NUM
+};
+
+/** \brief 卡片 */
+struct __card {
+    int      used;
+    int      s70;
+    uint8_t  uid[4];
+    uint8_t  blk[__BLK_MAX][16];
+};
+
+/** \brief 仿真器状态（命令线程与串口线程共用， 由 host_os_klock 保护） */
+static struct __zlg600a_sim {
+    uint32_t      baud;
+    uint32_t      delay_ms;
+    uint32_t      detect_ms;
+    uint32_t      tap_blocks;
+
+    struct __card card[__CARD_MAX];
+
+    /* 场内的卡 */
+    int           present;          /**< \brief 卡序号， -1 为无卡 */
+    uint64_t      present_ns;       /**< \brief 放卡时刻 */
+    uint64_t      remove_ns;        /**< \brief 拿走时刻， 0 为不拿走 */
+    int           reported;         /**< \brief 已自动上报 */
+    int           auth_sector;      /**< \brief 已验证的扇区， -1 为无 */
+    int           rf_on;
+
+    /* 自动检测 */
+    int           auto_on;
+    uint8_t       auto_req;
+    int           auto_auth;
+    uint8_t       auto_key_type;
+    uint8_t       auto_key[6];
+    uint8_t       auto_block;
+
+    /* 本次刷卡的进度 */
+    int           tap_uid;          /**< \brief 已送出 UID */
+    int           tap_auth;         /**< \brief 已验证成功 */
+    uint32_t      tap_reads;        /**< \brief 已读块数 */
+
+    /* 故障注入 */
+    uint32_t      fault_cnt[__FAULT_NUM];
+    uint32_t      slow_ms;
+    uint32_t      rand_pct;
+
+    /* 统计 */
+    sim_stat_t    op[__OP_NUM];
+    sim_stat_t    tap_to_uid;
+    sim_stat_t    tap_to_auth;
+    sim_stat_t    tap_to_read;
+    uint32_t      injected[__FAULT_NUM];
+    uint32_t      req;
+    uint32_t      fail;
+    uint32_t      bad_frame;
+    uint32_t      reports;
+    uint32_t      taps;
+    uint32_t      tap_miss;
+} __g_sim;
+
+/******************************************************************************/
+static int __hex_parse (const char *p_str, uint8_t *p_buf, int len)
+{
+    unsigned int b;
+    int          i;
+
+    if ((NULL == p_str) || ((int)strlen(p_str) != len * 2)) {
+        return -1;
+    }
+    for (i = 0; i < len; i++) {
+        if (1 != sscanf(&p_str[i * 2], "%2x", &b)) {
+            return -1;
+        }
+        p_buf[i] = (uint8_t)b;
+    }
+    return 0;
+}
+
+/* 扇区号（同 aw_iccreader.c） */
+static int __sector_get (int blk)
+{
+    return (blk < 128) ? (blk >> 2) : (32 + ((blk - 128) >> 4));
+}
+
+/* 扇区尾块号 */
+static int __trailer_get (int sector)
+{
+    return (sector < 32) ? (sector * 4 + 3) : (128 + (sector - 32) * 16 + 15);
+}
+
+static int __blk_num (const struct __card *p_card)
+{
+    return p_card->s70 ? 256 : 64;
+}
+
+/* 查找卡， 不存在且 create 时新建， 返回序号 */
+static int __card_find (const uint8_t *p_uid, int create)
+{
+    struct __card *p_card;
+    int            i, blk;
+
+    for (i = 0; i < __CARD_MAX; i++) {
+        if (__g_sim.card[i].used && (0 == memcmp(__g_sim.card[i].uid, p_uid, 4))) {
+            return i;
+        }
+    }
+    if (!create) {
+        return -1;
+    }
+    for (i = 0; i < __CARD_MAX; i++) {
+        p_card = &__g_sim.card[i];
+        if (!p_card->used) {
+            memset(p_card, 0, sizeof(*p_card));
+            p_card->used = 1;
+            memcpy(p_card->uid, p_uid, 4);
+
+            /* 扇区尾块： 密钥A | 存取控制 FF078069 | 密钥B */
+            for (blk = 0; blk < __BLK_MAX; blk++) {
+                if (__trailer_get(__sector_get(blk)) == blk) {
+                    memset(p_card->blk[blk], 0xFF, 16);
+                    p_card->blk[blk][6] = 0xFF;
+                    p_card->blk[blk][7] = 0x07;
+                    p_card->blk[blk][8] = 0x80;
+                    p_card->blk[blk][9] = 0x69;
+                }
+            }
+            memcpy(p_card->blk[0], p_uid, 4);
+            return i;
+        }
+    }
+    return -1;
+}
+
+/******************************************************************************/
+/* 本次刷卡结束（调用时已加锁） */
+static void __tap_end (void)
+{
+    if ((__g_sim.present >= 0) && (__g_sim.tap_reads < __g_sim.tap_blocks)) {
+        __g_sim.tap_miss++;
+    }
+    __g_sim.present     = -1;
+    __g_sim.remove_ns   = 0;
+    __g_sim.auth_sector = -1;
+}
+
+static void __card_place (int idx, uint32_t ms)
+{
+    __tap_end();
+    __g_sim.present    = idx;
+    __g_sim.present_ns = host_os_ns();
+    __g_sim.remove_ns  = ms ? (__g_sim.present_ns + ms * 1000000ull) : 0;
+    __g_sim.reported   = 0;
+    __g_sim.tap_uid    = 0;
+    __g_sim.tap_auth   = 0;
+    __g_sim.tap_reads  = 0;
+    __g_sim.taps++;
+}
+
+/* 检查定时拿走（调用时已加锁） */
+static void __card_update (void)
+{
+    if ((__g_sim.present >= 0) &&
+        (0 != __g_sim.remove_ns) &&
+        (host_os_ns() >= __g_sim.remove_ns)) {
+        __tap_end();
+    }
+}
+
+/* 刷卡进度（调用时已加锁） */
+static void __tap_progress (int *p_flag, sim_stat_t *p_stat)
+{
+    if ((__g_sim.present >= 0) && !*p_flag) {
+        *p_flag = 1;
+        sim_stat_add(p_stat, (uint32_t)((host_os_ns() - __g_sim.present_ns) / 1000));
+    }
+}
+
+/******************************************************************************/
+static void __stats_reset (void)
+{
+    int i;
+
+    for (i = 0; i < __OP_NUM; i++) {
+        sim_stat_reset(&__g_sim.op[i]);
+    }
+    sim_stat_reset(&__g_sim.tap_to_uid);
+    sim_stat_reset(&__g_sim.tap_to_auth);
+    sim_stat_reset(&__g_sim.tap_to_read);
+    memset(__g_sim.injected, 0, sizeof(__g_sim.injected));
+    __g_sim.req       = 0;
+    __g_sim.fail      = 0;
+    __g_sim.bad_frame = 0;
+    __g_sim.reports   = 0;
+    __g_sim.taps      = 0;
+    __g_sim.tap_miss  = 0;
+}
+
+static void __stats_print (void)
+{
+    int i;
+
+    host_os_klock();
+    printf("requests %u fail %u bad_frame %u reports %u taps %u tap_miss %u\n",
+           __g_sim.req, __g_sim.fail, __g_sim.bad_frame,
+           __g_sim.reports, __g_sim.taps, __g_sim.tap_miss);
+    printf("faults:");
+    for (i = 1; i < __FAULT_NUM; i++) {
+        printf(" %s %u", __g_fault_name[i], __g_sim.injected[i]);
+    }
+    printf("\n");
+
+    sim_stat_title();
+    for (i = 0; i < __OP_NUM; i++) {
+        sim_stat_print(&__g_sim.op[i]);
+    }
+    sim_stat_print(&__g_sim.tap_to_uid);
+    sim_stat_print(&__g_sim.tap_to_auth);
+    sim_stat_print(&__g_sim.tap_to_read);
+    host_os_kunlock();
+    fflush(stdout);
+}
+
+/******************************************************************************/
+/* 组帧， 返回帧长度 */
+static int __frame_build (uint8_t *p_tx, uint16_t status, const uint8_t *p_data, int len)
+{
+    uint8_t sum;
+    int     i;
+
+    p_tx[0] = __START_CODE;
+    p_tx[1] = (uint8_t)((len + 2) >> 8);
+    p_tx[2] = (uint8_t)(len + 2);
+    p_tx[3] = (uint8_t)(status >> 8);
+    p_tx[4] = (uint8_t)status;
+    memcpy(&p_tx[5], p_data, len);
+
+    sum = p_tx[3] ^ p_tx[4];
+    for (i = 0; i < len; i++) {
+        sum ^= p_data[i];
+    }
+    p_tx[5 + len] = sum;
+    p_tx[6 + len] = __END_CODE;
+    return len + 7;
+}
+
+/* 选择本次应答的故障（调用时已加锁） */
+static int __fault_pick (void)
+{
+    int kind;
+
+    for (kind = __FAULT_SLOW; kind < __FAULT_NUM; kind++) {
+        if (__g_sim.fault_cnt[kind] > 0) {
+            __g_sim.fault_cnt[kind]--;
+            __g_sim.injected[kind]++;
+            return kind;
+        }
+    }
+    if ((__g_sim.rand_pct > 0) && ((uint32_t)(rand() % 100) < __g_sim.rand_pct)) {
+        kind = __FAULT_SLOW + rand() % (__FAULT_NUM - __FAULT_SLOW);
+        if (__FAULT_SLOW == kind) {
+            __g_sim.slow_ms = 1200;     /* 超过驱动的帧超时 */
+        }
+        __g_sim.injected[kind]++;
+        return kind;
+    }
+    return __FAULT_NONE;
+}
+
+/*
+ * 发送应答（不加锁调用）
+ * ready_ns 为可以开始发送的时刻， 返回发送完成时刻， 0 为未发送
+ */
+static uint64_t __reply_send (int      fd,
+                              uint8_t *p_tx,
+                              int      len,
+                              int      fault,
+                              uint64_t ready_ns,
+                              uint32_t slow_ms,
+                              uint64_t byte_ns)
+{
+    if (__FAULT_DROP == fault) {
+        return 0;
+    }
+    if (__FAULT_CORRUPT == fault) {
+        p_tx[len - 2] ^= 0x5A;
+    }
+    if (__FAULT_PARTIAL == fault) {
+        len /= 2;
+    }
+    if (__FAULT_SLOW == fault) {
+        ready_ns += slow_ms * 1000000ull;
+    }
+    sim_wire_wait_until(ready_ns);
+    return sim_wire_send(fd, p_tx, len, byte_ns);
+}
+
+/******************************************************************************/
+/* 执行命令（调用时已加锁）， 返回状态， 回复数据放入 p_out */
+static uint16_t __cmd_do (uint16_t       cmd,
+                          const uint8_t *p_in,
+                          int            in_len,
+                          uint8_t       *p_out,
+                          int           *p_out_len,
+                          int           *p_op)
+{
+    struct __card *p_card = (__g_sim.present >= 0) ?
+                            &__g_sim.card[__g_sim.present] : NULL;
+    const uint8_t *p_key;
+    int            blk, sector;
+
+    *p_out_len = 0;
+
+    switch (cmd) {
+
+    case __CMD_CARD_ACTIVE:
+        *p_op = __OP_ACTIVE;
+        __g_sim.auth_sector = -1;
+        if ((NULL == p_card) || !__g_sim.rf_on) {
+            return __ST_NO_CARD;
+        }
+        p_out[0] = p_card->s70 ? 0x18 : 0x08;
+        p_out[1] = 4;
+        memcpy(&p_out[2], p_card->uid, 4);
+        *p_out_len = 6;
+        __tap_progress(&__g_sim.tap_uid, &__g_sim.tap_to_uid);
+        return __ST_OK;
+
+    case __CMD_KEY_AUTH:
+        *p_op = __OP_AUTH;
+        if (in_len < 12) {
+            return __ST_PARAM;
+        }
+        if ((NULL == p_card) || !__g_sim.rf_on || (0 != memcmp(&p_in[1], p_card->uid, 4))) {
+            __g_sim.auth_sector = -1;
+            return __ST_NO_CARD;
+        }
+        blk = p_in[in_len - 1];
+        if (blk >= __blk_num(p_card)) {
+            return __ST_PARAM;
+        }
+        sector = __sector_get(blk);
+        p_key  = p_card->blk[__trailer_get(sector)];
+        if (0x61 == p_in[0]) {
+            p_key += 10;
+        }
+        if (0 != memcmp(&p_in[5], p_key, 6)) {
+            __g_sim.auth_sector = -1;
+            return __ST_AUTH_FAIL;
+        }
+        __g_sim.auth_sector = sector;
+        __tap_progress(&__g_sim.tap_auth, &__g_sim.tap_to_auth);
+        return __ST_OK;
+
+    case __CMD_BLK_READ:
+    case __CMD_BLK_WRITE:
+        *p_op = (__CMD_BLK_READ == cmd) ? __OP_READ : __OP_WRITE;
+        if (NULL == p_card) {
+            __g_sim.auth_sector = -1;
+            return __ST_NO_CARD;
+        }
+        if ((in_len < 1) ||
+            (p_in[0] >= __blk_num(p_card)) ||
+            ((__CMD_BLK_WRITE == cmd) && (in_len < 17))) {
+            return __ST_PARAM;
+        }
+        blk = p_in[0];
+        if (__sector_get(blk) != __g_sim.auth_sector) {
+            return __ST_NOT_AUTH;
+        }
+        if (__CMD_BLK_WRITE == cmd) {
+            memcpy(p_card->blk[blk], &p_in[1], 16);
+            return __ST_OK;
+        }
+        memcpy(p_out, p_card->blk[blk], 16);
+        if (__trailer_get(__sector_get(blk)) == blk) {
+            memset(p_out, 0, 6);        /* 密钥A 读出为 0 */
+        }
+        *p_out_len = 16;
+        if ((__g_sim.present >= 0) &&
+            (++__g_sim.tap_reads == __g_sim.tap_blocks)) {
+            sim_stat_add(&__g_sim.tap_to_read,
+                         (uint32_t)((host_os_ns() - __g_sim.present_ns) / 1000));
+        }
+        return __ST_OK;
+
+    case __CMD_AUTO_DETECT:
+        *p_op = __OP_DETECT;
+        if ((in_len < 1) || (0 == p_in[0])) {
+            __g_sim.auto_on = 0;
+            return __ST_OK;
+        }
+        if (in_len < 4) {
+            return __ST_PARAM;
+        }
+        __g_sim.auto_on   = 1;
+        __g_sim.auto_req  = p_in[2];
+        __g_sim.auto_auth = ('F' == p_in[3]) && (in_len >= 11);
+        __g_sim.rf_on     = 1;
+        if (__g_sim.auto_auth) {
+            __g_sim.auto_key_type = p_in[4];
+            memcpy(__g_sim.auto_key, &p_in[5], 6);
+            __g_sim.auto_block = p_in[10];
+        }
+        if (0x52 == __g_sim.auto_req) {
+            __g_sim.reported = 0;       /* ALL 请求， 场内的卡也上报 */
+        }
+        return __ST_OK;
+
+    case __CMD_RF_OPEN:
+    case __CMD_RF_CLOSE:
+        *p_op = __OP_RF;
+        __g_sim.rf_on       = (__CMD_RF_OPEN == cmd);
+        __g_sim.auth_sector = -1;
+        return __ST_OK;
+
+    case __CMD_INFO_GET:
+        *p_op = __OP_CTRL;
+        memset(p_out, 0, 40);
+        memcpy(p_out, "ZLG600A ", 8);
+        memcpy(&p_out[8], "HOST SIM", 8);
+        *p_out_len = 40;
+        return __ST_OK;
+
+    case __CMD_BAUD_SET:
+    case __CMD_BUZZER_SET:
+    case __CMD_LED_SET:
+        *p_op = __OP_CTRL;
+        return __ST_OK;
+
+    default:
+        *p_op = __OP_CTRL;
+        return __ST_UNSUPPORT;
+    }
+}
+
+/* 处理一个完整的请求帧 */
+static void __frame_process (int fd, const uint8_t *p_rx, uint64_t first_ns, int wire_len)
+{
+    uint8_t   out[__INFO_MAX];
+    uint8_t   tx[__INFO_MAX + 8];
+    uint16_t  cmd = (uint16_t)((p_rx[3] << 8) | p_rx[4]);
+    int       len = ((p_rx[1] << 8) | p_rx[2]) - 2;
+    int       out_len, tx_len, op = __OP_CTRL, fault;
+    uint16_t  status;
+    uint32_t  slow_ms;
+    uint64_t  byte_ns, end_ns;
+
+    host_os_klock();
+    __card_update();
+    __g_sim.req++;
+    status = __cmd_do(cmd, &p_rx[5], len, out, &out_len, &op);
+    if (__ST_OK != status) {
+        __g_sim.fail++;
+    }
+    fault   = __fault_pick();
+    slow_ms = __g_sim.slow_ms;
+    byte_ns = sim_wire_byte_ns(__g_sim.baud, 10);
+    tx_len  = __frame_build(tx, status, out, out_len);
+    end_ns  = first_ns + byte_ns * wire_len + __g_sim.delay_ms * 1000000ull;
+    host_os_kunlock();
+
+    end_ns = __reply_send(fd, tx, tx_len, fault, end_ns, slow_ms, byte_ns);
+
+    if ((0 != end_ns) && (__FAULT_NONE == fault)) {
+        host_os_klock();
+        sim_stat_add(&__g_sim.op[op], (uint32_t)((end_ns - first_ns) / 1000));
+        host_os_kunlock();
+    }
+}
+
+/* 自动检测模式下的主动上报 */
+static void __auto_report (int fd)
+{
+    struct __card *p_card;
+    const uint8_t *p_key;
+    uint8_t        out[4 + 4 + 16];
+    uint8_t        tx[sizeof(out) + 8];
+    int            out_len, tx_len, fault, blk;
+    uint32_t       slow_ms;
+    uint64_t       byte_ns;
+
+    host_os_klock();
+    __card_update();
+    if (!__g_sim.auto_on ||
+        (__g_sim.present < 0) ||
+        __g_sim.reported ||
+        (host_os_ns() < __g_sim.present_ns + __g_sim.detect_ms * 1000000ull)) {
+        host_os_kunlock();
+        return;
+    }
+
+    p_card = &__g_sim.card[__g_sim.present];
+    out[0] = 0x00;
+    out[1] = p_card->s70 ? 0x02 : 0x04;
+    out[2] = p_card->s70 ? 0x18 : 0x08;
+    out[3] = 4;
+    memcpy(&out[4], p_card->uid, 4);
+    out_len = 8;
+
+    if (__g_sim.auto_auth) {
+        blk   = __g_sim.auto_block;
+        p_key = p_card->blk[__trailer_get(__sector_get(blk))];
+        if (0x61 == __g_sim.auto_key_type) {
+            p_key += 10;
+        }
+        if ((blk < __blk_num(p_card)) && (0 == memcmp(__g_sim.auto_key, p_key, 6))) {
+            memcpy(&out[8], p_card->blk[blk], 16);
+            out_len += 16;
+        }
+    }
+
+    /* 上报后模块退出自动检测 */
+    __g_sim.reported = 1;
+    __g_sim.auto_on  = 0;
+    __g_sim.reports++;
+    __tap_progress(&__g_sim.tap_uid, &__g_sim.tap_to_uid);
+
+    fault   = __fault_pick();
+    slow_ms = __g_sim.slow_ms;
+    byte_ns = sim_wire_byte_ns(__g_sim.baud, 10);
+    tx_len  = __frame_build(tx, __ST_OK, out, out_len);
+    host_os_kunlock();
+
+    __reply_send(fd, tx, tx_len, fault, host_os_ns(), slow_ms, byte_ns);
+}
+
+/*
+ * 在缓冲区中查找完整帧
+ * \return >0： 帧已处理， 返回消耗的字节数  0： 不完整  <0： 丢弃 -ret 个字节
+ */
+static int __frame_scan (int fd, uint8_t *p_buf, int n, uint64_t first_ns)
+{
+    uint8_t sum = 0;
+    int     i, start, len;
+
+    for (start = 0; (start < n) && (__START_CODE != p_buf[start]); start++) {
+    }
+    if (start >= n) {
+        return -n;
+    }
+    if (n - start < 3) {
+        return 0;
+    }
+    len = (p_buf[start + 1] << 8) | p_buf[start + 2];
+    if ((len < 2) || (len > __INFO_MAX)) {
+        return -(start + 1);
+    }
+    if (n - start < len + 5) {
+        return 0;
+    }
+    for (i = 0; i < len; i++) {
+        sum ^= p_buf[start + 3 + i];
+    }
+    if ((sum != p_buf[start + 3 + len]) || (__END_CODE != p_buf[start + 4 + len])) {
+        return -(start + 1);
+    }
+    __frame_process(fd, &p_buf[start], first_ns, len + 5);
+    return start + len + 5;
+}
+
+static void __serial_loop (int fd)
+{
+    uint8_t  buf[__BUF_SIZE];
+    uint64_t first_ns = 0, last_ns = 0;
+    int      n = 0, len, ret;
+
+    for (;;) {
+        len = host_os_fd_read(fd, &buf[n], sizeof(buf) - n, __LOOP_MS);
+        if (len < 0) {
+            host_os_sleep_ms(100);
+            continue;
+        }
+        if (0 == len) {
+            /* 帧内字节间隔超过 50 ms 时丢弃 */
+            if ((n > 0) && (host_os_ns() - last_ns > 50000000ull)) {
+                host_os_klock();
+                __g_sim.bad_frame++;
+                host_os_kunlock();
+                n = 0;
+            }
+            __auto_report(fd);
+            continue;
+        }
+        last_ns = host_os_ns();
+        if (0 == n) {
+            first_ns = last_ns;
+        }
+        n += len;
+
+        while (n > 0) {
+            ret = __frame_scan(fd, buf, n, first_ns);
+            if (0 == ret) {
+                break;
+            }
+            if (ret < 0) {
+                if (__START_CODE == buf[0]) {
+                    host_os_klock();
+                    __g_sim.bad_frame++;
+                    host_os_kunlock();
+                }
+                ret = -ret;
+            }
+            memmove(buf, &buf[ret], n - ret);
+            n -= ret;
+            first_ns = host_os_ns();
+        }
+        if (n >= (int)sizeof(buf)) {
+            n = 0;
+        }
+    }
+}
+
+/******************************************************************************/
+static void __cmd_exec (char *p_line)
+{
+    char    *argv[5] = {NULL};
+    char    *p_save  = NULL;
+    char    *p_tok;
+    uint8_t  uid[4], dat[16];
+    int      argc = 0, idx, blk;
+    uint32_t n;
+
+    for (p_tok = strtok_r(p_line, " \t", &p_save);
+         (NULL != p_tok) && (argc < 5);
+         p_tok = strtok_r(NULL, " \t", &p_save)) {
+        argv[argc++] = p_tok;
+    }
+    if (0 == argc) {
+        return;
+    }
+    n = (argc >= 2) ? (uint32_t)atoi(argv[1]) : 1;
+
+    host_os_klock();
+    __card_update();
+
+    if ((0 == strcmp(argv[0], "card")) && (0 == __hex_parse(argv[1], uid, 4))) {
+        idx = __card_find(uid, 1);
+        if (idx >= 0) {
+            __g_sim.card[idx].s70 = (argc >= 3) && (0 == strcmp(argv[2], "s70"));
+        }
+
+    } else if ((0 == strcmp(argv[0], "blk")) && (argc >= 4) &&
+               (0 == __hex_parse(argv[1], uid, 4)) &&
+               (0 == __hex_parse(argv[3], dat, 16)) &&
+               ((idx = __card_find(uid, 1)) >= 0)) {
+        blk = atoi(argv[2]);
+        if ((blk >= 0) && (blk < __BLK_MAX)) {
+            memcpy(__g_sim.card[idx].blk[blk], dat, 16);
+        }
+
+    } else if ((0 == strcmp(argv[0], "key")) && (argc >= 4) &&
+               (0 == __hex_parse(argv[1], uid, 4)) &&
+               (0 == __hex_parse(argv[3], dat, 6)) &&
+               ((idx = __card_find(uid, 1)) >= 0)) {
+        blk = atoi(argv[2]);
+        if ((blk >= 0) && (blk < 40)) {
+            memcpy(__g_sim.card[idx].blk[__trailer_get(blk)], dat, 6);
+        }
+
+    } else if (((0 == strcmp(argv[0], "tap")) || (0 == strcmp(argv[0], "place"))) &&
+               (0 == __hex_parse(argv[1], uid, 4)) &&
+               ((idx = __card_find(uid, 1)) >= 0)) {
+        if (0 == strcmp(argv[0], "tap")) {
+            __card_place(idx, (argc >= 3) ? (uint32_t)atoi(argv[2]) : 500);
+        } else {
+            __card_place(idx, 0);
+        }
+
+    } else if (0 == strcmp(argv[0], "remove")) {
+        __tap_end();
+
+    } else if (0 == strcmp(argv[0], "corrupt")) {
+        __g_sim.fault_cnt[__FAULT_CORRUPT] = n;
+    } else if (0 == strcmp(argv[0], "partial")) {
+        __g_sim.fault_cnt[__FAULT_PARTIAL] = n;
+    } else if (0 == strcmp(argv[0], "drop")) {
+        __g_sim.fault_cnt[__FAULT_DROP] = n;
+    } else if ((0 == strcmp(argv[0], "slow")) && (argc >= 2)) {
+        __g_sim.slow_ms                 = n;
+        __g_sim.fault_cnt[__FAULT_SLOW] = (argc >= 3) ? (uint32_t)atoi(argv[2]) : 1;
+    } else if ((0 == strcmp(argv[0], "rand")) && (argc >= 2)) {
+        __g_sim.rand_pct = n;
+
+    } else if (0 == strcmp(argv[0], "reset")) {
+        __stats_reset();
+    } else if (0 == strcmp(argv[0], "stats")) {
+        host_os_kunlock();
+        __stats_print();
+        return;
+    } else if (0 == strcmp(argv[0], "quit")) {
+        host_os_kunlock();
+        __stats_print();
+        host_os_exit(0);
+    } else {
+        printf("unknown command: %s\n", argv[0]);
+    }
+    host_os_kunlock();
+}
+
+static void __cmd_task (void *p_arg)
+{
+    char line[128];
+
+    while (host_os_readline(line, sizeof(line)) >= 0) {
+        __cmd_exec(line);
+    }
+}
+
+/* 时间线： 每行 "<秒> <命令>" */
+static void __script_task (void *p_arg)
+{
+    FILE    *p_file = (FILE *)p_arg;
+    char     line[160];
+    double   sec;
+    int      pos;
+    uint32_t ms;
+
+    while (NULL != fgets(line, sizeof(line), p_file)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (('#' == line[0]) || (1 != sscanf(line, "%lf %n", &sec, &pos))) {
+            continue;
+        }
+        ms = (uint32_t)(sec * 1000);
+        if (ms > host_os_ms()) {
+            host_os_sleep_ms(ms - host_os_ms());
+        }
+        __cmd_exec(&line[pos]);
+    }
+    fclose(p_file);
+}
+
+static void __timer_task (void *p_arg)
+{
+    host_os_sleep_ms((uint32_t)(unsigned long)p_arg * 1000);
+    __stats_print();
+    host_os_exit(0);
+}
+
+int main (int argc, char *argv[])
+{
+    static const char *op_name[__OP_NUM] = {
+        "op_active", "op_auth", "op_read", "op_write", "op_detect", "op_rf", "op_ctrl"
+    };
+    const char *p_port   = NULL;
+    FILE       *p_script = NULL;
+    char        slave[128];
+    uint32_t    run_s    = 0;
+    int         fd, opt, i;
+
+    host_os_init();
+
+    __g_sim.baud        = 57600;
+    __g_sim.delay_ms    = 5;
+    __g_sim.detect_ms   = 30;
+    __g_sim.tap_blocks  = 3;
+    __g_sim.present     = -1;
+    __g_sim.auth_sector = -1;
+    for (i = 0; i < __OP_NUM; i++) {
+        __g_sim.op[i].name = op_name[i];
+    }
+    __g_sim.tap_to_uid.name  = "tap_to_uid";
+    __g_sim.tap_to_auth.name = "tap_to_auth";
+    __g_sim.tap_to_read.name = "tap_to_read";
+
+    while (-1 != (opt = getopt(argc, argv, "b:d:s:n:p:r:t:"))) {
+        switch (opt) {
+        case 'b': __g_sim.baud       = (uint32_t)atoi(optarg); break;
+        case 'd': __g_sim.delay_ms   = (uint32_t)atoi(optarg); break;
+        case 's': __g_sim.detect_ms  = (uint32_t)atoi(optarg); break;
+        case 'n': __g_sim.tap_blocks = (uint32_t)atoi(optarg); break;
+        case 'r': __g_sim.rand_pct   = (uint32_t)atoi(optarg); break;
+        case 't': run_s              = (uint32_t)atoi(optarg); break;
+        case 'p':
+            if (NULL == (p_script = fopen(optarg, "r"))) {
+                fprintf(stderr, "open %s failed\n", optarg);
+                return 1;
+            }
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-b bps] [-d ms] [-s ms] [-n blocks] "
+                            "[-p file] [-r %%] [-t s] [port]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (optind < argc) {
+        p_port = argv[optind];
+    }
+
+    if (NULL != p_port) {
+        fd = host_os_tty_open(p_port);
+    } else {
+        fd = host_os_pty_open(slave, sizeof(slave));
+        if (fd >= 0) {
+            printf("pty: %s\n", slave);
+        }
+    }
+    if (fd < 0) {
+        fprintf(stderr, "open %s failed\n", p_port ? p_port : "pty");
+        return 1;
+    }
+    host_os_tty_cfg(fd, __g_sim.baud ? __g_sim.baud : 57600, 8, 'N', 1);
+
+    host_os_thread_create("cmd", __cmd_task, NULL);
+    if (NULL != p_script) {
+        host_os_thread_create("script", __script_task, p_script);
+    }
+    if (run_s > 0) {
+        host_os_thread_create("timer", __timer_task, (void *)(unsigned long)run_s);
+    }
+
+    __serial_loop(fd);
+    return 0;
+}
+
+/* end of file */
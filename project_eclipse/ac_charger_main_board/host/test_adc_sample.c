@@ -0,0 +1,321 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief ADC块采样滤波（adc_sample.c）测试
+ *
+ * ADC驱动由本文件模拟： 启动时把预置的一块合成采样拷入缓冲并立即回调。 检查：
+ *  - 恒定输入时首个输出即为输入， 之后保持不变；
+ *  - 少于半块的尖峰（接触器动作）被中值剔除， 输出不变， 原算法均值受影响；
+ *  - 加噪声时滤波输出在输入附近， 波动小于原算法；
+ *  - 阶跃响应与一阶IIR（系数1/2^ACP1000_TEMP_IIR_SHIFT）一致， 无过冲，
+ *    上升和下降都收敛到输入；
+ *  - 偶数个采样的中值取中间两个的平均；
+ *  - 启动失败、 等待超时、 驱动报错时返回错误， 计入errs， 滤波状态不变。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-18  xjc, first implementation
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include <string.h>
+#include "rtk.h"
+#include "aw_adc.h"
+#include "adc_sample.h"
+#include "host_test.h"
+
+#define __N         ACP1000_TEMP_ADC_SAMPLES
+
+/*******************************************************************************
+  模拟
+*******************************************************************************/
+static uint16_t __g_block[__N];     /* 下一块的采样 */
+static aw_err_t __g_start_ret;      /* aw_adc_client_start() 的返回值 */
+static bool_t   __g_complete;       /* 是否回调（否则等待超时） */
+static aw_err_t __g_state;          /* 回调的转换结果 */
+static int      __g_cancels;
+static int      __g_sem;
+
+aw_err_t aw_adc_rate_set (aw_adc_channel_t ch, uint32_t rate)
+{
+    return AW_OK;
+}
+
+aw_err_t aw_adc_client_init (aw_adc_client_t  *p_client,
+                             aw_adc_channel_t  ch,
+                             bool_t            urgent)
+{
+    return AW_OK;
+}
+
+aw_err_t aw_adc_client_start (aw_adc_client_t   *p_client,
+                              aw_adc_buf_desc_t *p_desc,
+                              int                desc_num,
+                              uint32_t           count)
+{
+    if (AW_OK != __g_start_ret) {
+        return __g_start_ret;
+    }
+    memcpy(p_desc->p_buf, __g_block, p_desc->length * sizeof(uint16_t));
+    if (__g_complete) {
+        p_desc->pfn_complete(p_desc->p_arg, __g_state);
+    }
+    return AW_OK;
+}
+
+aw_err_t aw_adc_client_cancel (aw_adc_client_t *p_client)
+{
+    __g_cancels++;
+    return AW_OK;
+}
+
+int semb_init (struct rtk_semaphore *semid, int InitCount)
+{
+    __g_sem = InitCount;
+    return 0;
+}
+
+int semb_take (struct rtk_semaphore *semid, unsigned int tick)
+{
+    if (__g_sem) {
+        __g_sem = 0;
+        return 0;
+    }
+    return -AW_ETIME;
+}
+
+int semb_give (struct rtk_semaphore *semid)
+{
+    __g_sem = 1;
+    return 0;
+}
+
+aw_tick_t aw_ms_to_ticks (unsigned int ms)
+{
+    return ms;
+}
+
+/*******************************************************************************
+  测试
+*******************************************************************************/
+static adc_sample_t __g_adc;
+static uint32_t     __g_seed = 1;
+
+static uint32_t __rand (void)
+{
+    __g_seed = __g_seed * 1103515245 + 12345;
+    return (__g_seed >> 16) & 0x7FFF;
+}
+
+static void __fill (uint16_t code)
+{
+    int i;
+
+    for (i = 0; i < __N; i++) {
+        __g_block[i] = code;
+    }
+}
+
+/**
+ * \brief 采集一块， 返回滤波输出
+ */
+static int __get (void)
+{
+    uint16_t code = 0;
+
+    HOST_TEST_CHECK_EQ(adc_sample_get(&__g_adc, &code, 100), AW_OK);
+    return code;
+}
+
+static void __init (void)
+{
+    HOST_TEST_CHECK_EQ(adc_sample_init(&__g_adc, 0, ACP1000_TEMP_ADC_RATE), AW_OK);
+    __g_start_ret = AW_OK;
+    __g_complete  = TRUE;
+    __g_state     = AW_OK;
+}
+
+static void __test_constant (void)
+{
+    int i;
+
+    __init();
+    __fill(2000);
+    for (i = 0; i < 10; i++) {
+        HOST_TEST_CHECK_EQ(__get(), 2000);
+    }
+    HOST_TEST_CHECK_EQ(__g_adc.stat.cycles, 10);
+    HOST_TEST_CHECK_EQ(__g_adc.stat.mean, 2000);
+    HOST_TEST_CHECK_EQ(__g_adc.stat.median, 2000);
+    HOST_TEST_CHECK_EQ(__g_adc.stat.raw_pp, 0);
+}
+
+static void __test_spike (void)
+{
+    int spikes = 0;
+    int pos;
+    int i;
+
+    /* 接着恒定输入， 每块在不同位置有 __N/2-1 个满量程尖峰 */
+    for (i = 0; i < 20; i++) {
+        __fill(2000);
+        for (spikes = 0; spikes < __N / 2 - 1; ) {
+            pos = __rand() % __N;
+            if (2000 == __g_block[pos]) {
+                __g_block[pos] = (spikes & 1) ? 0 : 4095;
+                spikes++;
+            }
+        }
+        __g_block[0] = 4095;        /* 原算法的10个采样中必有尖峰 */
+        HOST_TEST_CHECK_EQ(__get(), 2000);
+        HOST_TEST_CHECK(__g_adc.stat.mean != 2000);
+        HOST_TEST_CHECK_EQ(__g_adc.stat.raw_pp, 4095);
+    }
+}
+
+static void __test_noise (void)
+{
+    int mean_min = 4095, mean_max = 0;
+    int filt_min = 4095, filt_max = 0;
+    int out;
+    int i, j;
+
+    /* 均匀噪声 ±40码 */
+    for (i = 0; i < 200; i++) {
+        for (j = 0; j < __N; j++) {
+            __g_block[j] = 2000 - 40 + __rand() % 81;
+        }
+        out = __get();
+        HOST_TEST_CHECK((out >= 2000 - 12) && (out <= 2000 + 12));
+        if (__g_adc.stat.mean < mean_min) {
+            mean_min = __g_adc.stat.mean;
+        }
+        if (__g_adc.stat.mean > mean_max) {
+            mean_max = __g_adc.stat.mean;
+        }
+        if (out < filt_min) {
+            filt_min = out;
+        }
+        if (out > filt_max) {
+            filt_max = out;
+        }
+    }
+    HOST_TEST_CHECK(filt_max - filt_min < mean_max - mean_min);
+}
+
+static void __test_step (void)
+{
+    double expect = 2000;
+    int    last   = 2000;
+    int    outs[2];
+    int    out;
+    int    bad    = 0;
+    int    i;
+
+    __init();
+    __fill(2000);
+    __get();
+
+    /* 2000 -> 2400 */
+    __fill(2400);
+    for (i = 0; i < 40; i++) {
+        out     = __get();
+        expect += (2400 - expect) / (1 << ACP1000_TEMP_IIR_SHIFT);
+        if (i < 2) {
+            outs[i] = out;
+        }
+        bad    += (out < last) || (out > 2400);
+        bad    += (out - expect > 1) || (expect - out > 1);
+        last    = out;
+    }
+    HOST_TEST_CHECK_EQ(bad, 0);
+    HOST_TEST_CHECK_EQ(last, 2400);
+#if ACP1000_TEMP_IIR_SHIFT == 2
+    HOST_TEST_CHECK_EQ(outs[0], 2100);
+    HOST_TEST_CHECK_EQ(outs[1], 2175);
+#endif
+
+    /* 2400 -> 1600， 下降时同样收敛到输入 */
+    __fill(1600);
+    expect = 2400;
+    for (i = 0; i < 40; i++) {
+        out     = __get();
+        expect += (1600 - expect) / (1 << ACP1000_TEMP_IIR_SHIFT);
+        bad    += (out > last) || (out < 1600);
+        bad    += (out - expect > 1) || (expect - out > 1);
+        last    = out;
+    }
+    HOST_TEST_CHECK_EQ(bad, 0);
+    HOST_TEST_CHECK_EQ(last, 1600);
+}
+
+static void __test_median_even (void)
+{
+    int i;
+
+    __init();
+    for (i = 0; i < __N; i++) {
+        __g_block[i] = (i & 1) ? 1000 : 1002;
+    }
+    HOST_TEST_CHECK_EQ(__get(), 1001);
+    HOST_TEST_CHECK_EQ(__g_adc.stat.median, 1001);
+    HOST_TEST_CHECK_EQ(__g_adc.stat.raw_pp, 2);
+}
+
+static void __test_errors (void)
+{
+    uint16_t code = 0xFFFF;
+    uint32_t iir;
+
+    __init();
+    __fill(3000);
+    HOST_TEST_CHECK_EQ(__get(), 3000);
+    iir = __g_adc.iir;
+
+    __fill(100);
+    __g_start_ret = -AW_EBUSY;
+    HOST_TEST_CHECK_EQ(adc_sample_get(&__g_adc, &code, 100), -AW_EBUSY);
+
+    __g_start_ret = AW_OK;
+    __g_complete  = FALSE;
+    HOST_TEST_CHECK_EQ(adc_sample_get(&__g_adc, &code, 100), -AW_ETIME);
+    HOST_TEST_CHECK_EQ(__g_cancels, 1);
+
+    __g_complete = TRUE;
+    __g_state    = -AW_EIO;
+    HOST_TEST_CHECK_EQ(adc_sample_get(&__g_adc, &code, 100), -AW_EIO);
+
+    HOST_TEST_CHECK_EQ(code, 0xFFFF);
+    HOST_TEST_CHECK_EQ(__g_adc.stat.errs, 3);
+    HOST_TEST_CHECK_EQ(__g_adc.stat.cycles, 1);
+    HOST_TEST_CHECK_EQ(__g_adc.iir, iir);
+
+    /* 恢复后从原状态继续 */
+    __g_state = AW_OK;
+    __fill(3000);
+    HOST_TEST_CHECK_EQ(__get(), 3000);
+}
+
+int main (void)
+{
+    __test_constant();
+    __test_spike();
+    __test_noise();
+    __test_step();
+    __test_median_even();
+    __test_errors();
+
+    return HOST_TEST_END("adc_sample");
+}
@@ -0,0 +1,353 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief AES-128 的已知答案测试及卡密钥存储（card_key.c）测试
+ *
+ * - FIPS 197 附录C.1， SP 800-38A F.1.1（ECB）、 F.2.1/F.2.2（CBC）、
+ *   F.5.1/F.5.2（CTR）， 分两次调用时检查IV的延续；
+ * - card_key： 旧格式（DES）记录加载后迁移为 ACP1000_CARD_KEY_CIPHER，
+ *   重新加载得到相同的卡密钥； 再次写入时IV不重复； 篡改头、 IV、 密文
+ *   或使用其他UID时加载失败。
+ *   EEPROM单元6、 系统节拍及互斥锁由本文件模拟， 并检查加锁、 解锁成对。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-18  xjc, first implementation
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include <stdio.h>
+#include <string.h>
+#include "aw_nvram.h"
+#include "aw_system.h"
+#include "des/des.h"
+#include "aes/aes.h"
+#include "acp1000/card_key.h"
+#include "host_test.h"
+
+#define __NVRAM_UNIT_SIZE  72   /* 单元6大小 */
+
+/*******************************************************************************
+  模拟
+*******************************************************************************/
+static uint8_t   __g_nvram[__NVRAM_UNIT_SIZE];
+static int       __g_nvram_sets;
+static aw_tick_t __g_tick = 1000;
+static int       __g_lock_depth;
+
+aw_err_t aw_nvram_get (char *p_name, int unit, char *p_buf, int offset, int len)
+{
+    if ((6 != unit) || (offset < 0) || (offset + len > __NVRAM_UNIT_SIZE)) {
+        return -AW_EINVAL;
+    }
+    memcpy(p_buf, &__g_nvram[offset], len);
+    return AW_OK;
+}
+
+aw_err_t aw_nvram_set (char *p_name, int unit, char *p_buf, int offset, int len)
+{
+    if ((6 != unit) || (offset < 0) || (offset + len > __NVRAM_UNIT_SIZE)) {
+        return -AW_EINVAL;
+    }
+    memcpy(&__g_nvram[offset], p_buf, len);
+    __g_nvram_sets++;
+    return AW_OK;
+}
+
+aw_tick_t aw_sys_tick_get (void)
+{
+    return __g_tick;
+}
+
+int mutex_init (struct rtk_mutex *semid)
+{
+    return 0;
+}
+
+int mutex_lock (struct rtk_mutex *semid, unsigned int tick)
+{
+    __g_lock_depth++;
+    return 0;
+}
+
+int mutex_unlock (struct rtk_mutex *semid)
+{
+    __g_lock_depth--;
+    return 0;
+}
+
+/*******************************************************************************
+  AES 已知答案
+*******************************************************************************/
+static const uint8_t __g_fips_key[16] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+static const uint8_t __g_fips_plain[16] = {
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+    0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff
+};
+static const uint8_t __g_fips_cipher[16] = {
+    0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+    0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a
+};
+
+/* SP 800-38A */
+static const uint8_t __g_sp_key[16] = {
+    0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+    0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+};
+static const uint8_t __g_sp_plain[64] = {
+    0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96,
+    0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+    0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c,
+    0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+    0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11,
+    0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+    0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17,
+    0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10
+};
+static const uint8_t __g_sp_ecb[64] = {
+    0x3a, 0xd7, 0x7b, 0xb4, 0x0d, 0x7a, 0x36, 0x60,
+    0xa8, 0x9e, 0xca, 0xf3, 0x24, 0x66, 0xef, 0x97,
+    0xf5, 0xd3, 0xd5, 0x85, 0x03, 0xb9, 0x69, 0x9d,
+    0xe7, 0x85, 0x89, 0x5a, 0x96, 0xfd, 0xba, 0xaf,
+    0x43, 0xb1, 0xcd, 0x7f, 0x59, 0x8e, 0xce, 0x23,
+    0x88, 0x1b, 0x00, 0xe3, 0xed, 0x03, 0x06, 0x88,
+    0x7b, 0x0c, 0x78, 0x5e, 0x27, 0xe8, 0xad, 0x3f,
+    0x82, 0x23, 0x20, 0x71, 0x04, 0x72, 0x5d, 0xd4
+};
+static const uint8_t __g_sp_cbc_iv[16] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+static const uint8_t __g_sp_cbc[64] = {
+    0x76, 0x49, 0xab, 0xac, 0x81, 0x19, 0xb2, 0x46,
+    0xce, 0xe9, 0x8e, 0x9b, 0x12, 0xe9, 0x19, 0x7d,
+    0x50, 0x86, 0xcb, 0x9b, 0x50, 0x72, 0x19, 0xee,
+    0x95, 0xdb, 0x11, 0x3a, 0x91, 0x76, 0x78, 0xb2,
+    0x73, 0xbe, 0xd6, 0xb8, 0xe3, 0xc1, 0x74, 0x3b,
+    0x71, 0x16, 0xe6, 0x9e, 0x22, 0x22, 0x95, 0x16,
+    0x3f, 0xf1, 0xca, 0xa1, 0x68, 0x1f, 0xac, 0x09,
+    0x12, 0x0e, 0xca, 0x30, 0x75, 0x86, 0xe1, 0xa7
+};
+static const uint8_t __g_sp_ctr_iv[16] = {
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
+};
+static const uint8_t __g_sp_ctr[64] = {
+    0x87, 0x4d, 0x61, 0x91, 0xb6, 0x20, 0xe3, 0x26,
+    0x1b, 0xef, 0x68, 0x64, 0x99, 0x0d, 0xb6, 0xce,
+    0x98, 0x06, 0xf6, 0x6b, 0x79, 0x70, 0xfd, 0xff,
+    0x86, 0x17, 0x18, 0x7b, 0xb9, 0xff, 0xfd, 0xff,
+    0x5a, 0xe4, 0xdf, 0x3e, 0xdb, 0xd5, 0xd3, 0x5e,
+    0x5b, 0x4f, 0x09, 0x02, 0x0d, 0xb0, 0x3e, 0xab,
+    0x1e, 0x03, 0x1d, 0xda, 0x2f, 0xbe, 0x03, 0xd1,
+    0x79, 0x21, 0x70, 0xa0, 0xf3, 0x00, 0x9c, 0xee
+};
+
+static void __test_block (void)
+{
+    aes128_ctx ctx;
+    uint8_t    out[16];
+
+    aes128_key_setup(&ctx, __g_fips_key);
+    aes128_block_encrypt(&ctx, __g_fips_plain, out);
+    HOST_TEST_CHECK(0 == memcmp(out, __g_fips_cipher, 16));
+    aes128_block_decrypt(&ctx, out, out);
+    HOST_TEST_CHECK(0 == memcmp(out, __g_fips_plain, 16));
+}
+
+static void __test_ecb (void)
+{
+    aes128_ctx ctx;
+    uint8_t    out[16];
+    int        i;
+
+    aes128_key_setup(&ctx, __g_sp_key);
+    for (i = 0; i < 64; i += 16) {
+        aes128_block_encrypt(&ctx, &__g_sp_plain[i], out);
+        HOST_TEST_CHECK(0 == memcmp(out, &__g_sp_ecb[i], 16));
+        aes128_block_decrypt(&ctx, &__g_sp_ecb[i], out);
+        HOST_TEST_CHECK(0 == memcmp(out, &__g_sp_plain[i], 16));
+    }
+}
+
+static void __test_cbc (void)
+{
+    aes128_ctx ctx;
+    uint8_t    iv[16];
+    uint8_t    out[64];
+
+    aes128_key_setup(&ctx, __g_sp_key);
+
+    memcpy(iv, __g_sp_cbc_iv, 16);
+    aes128_cbc_encrypt(&ctx, iv, __g_sp_plain, out, 64);
+    HOST_TEST_CHECK(0 == memcmp(out, __g_sp_cbc, 64));
+    HOST_TEST_CHECK(0 == memcmp(iv, &__g_sp_cbc[48], 16));
+
+    /* 分两次， IV延续 */
+    memcpy(iv, __g_sp_cbc_iv, 16);
+    aes128_cbc_decrypt(&ctx, iv, __g_sp_cbc, out, 16);
+    aes128_cbc_decrypt(&ctx, iv, &__g_sp_cbc[16], &out[16], 48);
+    HOST_TEST_CHECK(0 == memcmp(out, __g_sp_plain, 64));
+    HOST_TEST_CHECK(0 == memcmp(iv, &__g_sp_cbc[48], 16));
+}
+
+static void __test_ctr (void)
+{
+    aes128_ctx ctx;
+    uint8_t    iv[16];
+    uint8_t    out[64];
+
+    aes128_key_setup(&ctx, __g_sp_key);
+
+    memcpy(iv, __g_sp_ctr_iv, 16);
+    aes128_ctr_crypt(&ctx, iv, __g_sp_plain, out, 64);
+    HOST_TEST_CHECK(0 == memcmp(out, __g_sp_ctr, 64));
+
+    /* 低32位计数 0xfcfdfeff + 4 */
+    HOST_TEST_CHECK(0 == memcmp(iv, __g_sp_ctr_iv, 12));
+    HOST_TEST_CHECK_EQ(iv[12], 0xfc);
+    HOST_TEST_CHECK_EQ(iv[13], 0xfd);
+    HOST_TEST_CHECK_EQ(iv[14], 0xff);
+    HOST_TEST_CHECK_EQ(iv[15], 0x03);
+
+    /* 解密（分两次） */
+    memcpy(iv, __g_sp_ctr_iv, 16);
+    aes128_ctr_crypt(&ctx, iv, __g_sp_ctr, out, 16);
+    aes128_ctr_crypt(&ctx, iv, &__g_sp_ctr[16], &out[16], 48);
+    HOST_TEST_CHECK(0 == memcmp(out, __g_sp_plain, 64));
+}
+
+/*******************************************************************************
+  card_key
+*******************************************************************************/
+static const uint8_t __g_uid[CARD_KEY_UID_LEN] = {
+    0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde, 0xf0,
+    0x0f, 0x1e, 0x2d, 0x3c, 0x4b, 0x5a, 0x69, 0x78
+};
+static const uint8_t __g_key[CARD_KEY_LEN] = {
+    0xa1, 0xb2, 0xc3, 0xd4, 0xe5, 0xf6
+};
+
+/**
+ * \brief 写入旧格式（DES， 8字节）记录
+ */
+static void __legacy_write (const uint8_t *p_key)
+{
+    des_ctx ctx;
+    uint8_t plain[8];
+
+    memset(__g_nvram, 0xFF, sizeof(__g_nvram));
+    memset(plain, 0, sizeof(plain));
+    plain[0] = 0x55;
+    memcpy(&plain[1], p_key, CARD_KEY_LEN);
+    des_key_setup(&ctx, __g_uid);
+    des_block_process(&ctx, plain, __g_nvram, ENCRYPTION_MODE);
+}
+
+/**
+ * \brief 篡改第offset字节后加载应失败
+ */
+static void __tamper_check (int offset)
+{
+    uint8_t save[__NVRAM_UNIT_SIZE];
+    uint8_t key[CARD_KEY_LEN];
+
+    memcpy(save, __g_nvram, sizeof(save));
+    __g_nvram[offset] ^= 0x01;
+    HOST_TEST_CHECK(!card_key_load(key, __g_uid));
+    HOST_TEST_CHECK_EQ(card_key_cipher_get(__g_uid), -1);
+    memcpy(__g_nvram, save, sizeof(save));
+}
+
+static void __test_card_key (void)
+{
+    uint8_t key[CARD_KEY_LEN];
+    uint8_t uid[CARD_KEY_UID_LEN];
+    uint8_t first[__NVRAM_UNIT_SIZE];
+    int     sets;
+
+    card_key_init();
+
+    /* 空EEPROM */
+    memset(__g_nvram, 0xFF, sizeof(__g_nvram));
+    HOST_TEST_CHECK(!card_key_load(key, __g_uid));
+    HOST_TEST_CHECK_EQ(__g_nvram_sets, 0);
+
+    /* 旧格式加载并迁移 */
+    __legacy_write(__g_key);
+    HOST_TEST_CHECK_EQ(card_key_cipher_get(__g_uid), CARD_KEY_CIPHER_DES);
+    memset(key, 0, sizeof(key));
+    HOST_TEST_CHECK(card_key_load(key, __g_uid));
+    HOST_TEST_CHECK(0 == memcmp(key, __g_key, CARD_KEY_LEN));
+    HOST_TEST_CHECK_EQ(card_key_cipher_get(__g_uid), ACP1000_CARD_KEY_CIPHER);
+#if ACP1000_CARD_KEY_CIPHER != CARD_KEY_CIPHER_DES
+    HOST_TEST_CHECK_EQ(__g_nvram_sets, 1);
+#endif
+
+    /* 已是配置的格式， 重新加载不再写入 */
+    sets = __g_nvram_sets;
+    memset(key, 0, sizeof(key));
+    HOST_TEST_CHECK(card_key_load(key, __g_uid));
+    HOST_TEST_CHECK(0 == memcmp(key, __g_key, CARD_KEY_LEN));
+    HOST_TEST_CHECK_EQ(__g_nvram_sets, sets);
+
+#if ACP1000_CARD_KEY_CIPHER != CARD_KEY_CIPHER_DES
+    /* 相同节拍再次写入， 序号保证IV及密文不同 */
+    memcpy(first, __g_nvram, sizeof(first));
+    HOST_TEST_CHECK(card_key_save(__g_key, __g_uid));
+    HOST_TEST_CHECK(0 != memcmp(&first[4], &__g_nvram[4], 16));
+    HOST_TEST_CHECK(0 != memcmp(&first[20], &__g_nvram[20], 16));
+    memset(key, 0, sizeof(key));
+    HOST_TEST_CHECK(card_key_load(key, __g_uid));
+    HOST_TEST_CHECK(0 == memcmp(key, __g_key, CARD_KEY_LEN));
+
+    /* 篡改： 头、 校验、 IV（序号、 节拍）、 密文首尾 */
+    __tamper_check(0);
+    __tamper_check(2);
+    __tamper_check(3);
+    __tamper_check(4 + 3);
+    __tamper_check(4 + 7);
+    __tamper_check(20);
+    __tamper_check(20 + 15);
+#else
+    (void)first;
+#endif
+
+    /* 其他UID */
+    memcpy(uid, __g_uid, sizeof(uid));
+    uid[0] ^= 0x80;
+    HOST_TEST_CHECK(!card_key_load(key, uid));
+
+    /* 原记录不受失败的加载影响 */
+    memset(key, 0, sizeof(key));
+    HOST_TEST_CHECK(card_key_load(key, __g_uid));
+    HOST_TEST_CHECK(0 == memcmp(key, __g_key, CARD_KEY_LEN));
+
+    HOST_TEST_CHECK_EQ(__g_lock_depth, 0);
+}
+
+int main (void)
+{
+    __test_block();
+    __test_ecb();
+    __test_cbc();
+    __test_ctr();
+    __test_card_key();
+
+    return HOST_TEST_END("aes");
+}
@@ -0,0 +1,329 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 离线卡名单（card_wl.c）测试
+ *
+ * SPI Flash按NOR特性模拟： 写入只能把位由1变为0， 只有擦除能恢复为0xFF， 且不模拟
+ * 驱动在块起始写入时的擦除， 名单须显式擦除每块后才能写入。
+ * - 增加、 撤销、 清空只更新索引， card_wl_flush() 之前不访问Flash；
+ * - 待写入的记录满时返回 -AW_EBUSY， 索引不变；
+ * - 多次写满整理（回到已写过的第一块）后重新加载， 与模型一致；
+ * - 擦除失败后下一次写入按索引整理重写。
+ * 互斥锁、 信号量、 任务由本文件模拟。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-18  xjc, first implementation
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include "rtk.h"
+#include "aw_nvram.h"
+#include "boot/boot_cfg.h"
+#include "acp1000/card_wl.h"
+#include "host_test.h"
+
+#define __BLOCK_SIZE     4096
+#define __REC_MAX        (CARD_WL_NVRAM_SIZE / 16)
+#define __CARDS          100      /* 反复增加、 撤销的卡数 */
+
+/*******************************************************************************
+  模拟
+*******************************************************************************/
+static uint8_t  __g_flash[CARD_WL_NVRAM_SIZE];
+static int      __g_writes;
+static int      __g_erases;
+static int      __g_erase_fail;      /* 大于0时擦除失败的次数 */
+static int      __g_lock_depth;
+
+aw_err_t aw_nvram_get (char *p_name, int unit, char *p_buf, int offset, int len)
+{
+    if ((offset < 0) || (offset + len > CARD_WL_NVRAM_SIZE)) {
+        return -AW_EINVAL;
+    }
+    memcpy(p_buf, &__g_flash[offset], len);
+    return AW_OK;
+}
+
+aw_err_t aw_nvram_set (char *p_name, int unit, char *p_buf, int offset, int len)
+{
+    int i;
+
+    if ((offset < 0) || (offset + len > CARD_WL_NVRAM_SIZE)) {
+        return -AW_EINVAL;
+    }
+    for (i = 0; i < len; i++) {
+        __g_flash[offset + i] &= (uint8_t)p_buf[i];
+    }
+    __g_writes++;
+    return AW_OK;
+}
+
+aw_err_t awbl_spi_flash_nvram_erase (char *p_name, int unit, int offset, int len)
+{
+    if ((offset % __BLOCK_SIZE) || (len % __BLOCK_SIZE) ||
+        (offset + len > CARD_WL_NVRAM_SIZE)) {
+        return -AW_EINVAL;
+    }
+    if (__g_erase_fail > 0) {
+        __g_erase_fail--;
+        return -AW_EIO;
+    }
+    memset(&__g_flash[offset], 0xFF, len);
+    __g_erases++;
+    return AW_OK;
+}
+
+int mutex_init (struct rtk_mutex *semid)
+{
+    return 0;
+}
+
+int mutex_lock (struct rtk_mutex *semid, unsigned int tick)
+{
+    __g_lock_depth++;
+    return 0;
+}
+
+int mutex_unlock (struct rtk_mutex *semid)
+{
+    __g_lock_depth--;
+    return 0;
+}
+
+int semb_init (struct rtk_semaphore *semid, int InitCount)
+{
+    return 0;
+}
+
+int semb_take (struct rtk_semaphore *semid, unsigned int tick)
+{
+    return 0;
+}
+
+int semb_give (struct rtk_semaphore *semid)
+{
+    return 0;
+}
+
+struct rtk_task *task_init (struct rtk_task *task,
+                            const char      *name,
+                            int              priority,
+                            int              option,
+                            char            *stack_low,
+                            char            *stack_high,
+                            void            *pfunc,
+                            void            *arg1,
+                            void            *arg2)
+{
+    return task;
+}
+
+int task_startup (struct rtk_task *task)
+{
+    return 0;
+}
+
+aw_tick_t aw_ms_to_ticks (unsigned int ms)
+{
+    return ms;
+}
+
+uint32_t aw_timestamp_get (void)
+{
+    return 0;
+}
+
+void perf_stat_pt_add (int id, uint32_t ts)
+{
+}
+
+int aw_kprintf (const char *fmt, ...)
+{
+    va_list ap;
+    int     ret;
+
+    va_start(ap, fmt);
+    ret = vprintf(fmt, ap);
+    va_end(ap);
+    return ret;
+}
+
+/*******************************************************************************
+  测试
+*******************************************************************************/
+static card_wl_t __g_wl;
+static card_wl_t __g_reload;
+static uint8_t   __g_model[__CARDS];    /* 各卡的状态 */
+
+static void __uid_make (uint8_t *p_uid, int card)
+{
+    p_uid[0] = 0x10 + card;
+    p_uid[1] = 0xA5;
+    p_uid[2] = card * 7;
+    p_uid[3] = 0xC3;
+}
+
+/**
+ * \brief 从Flash重新加载， 与模型比较
+ */
+static void __reload_check (uint32_t version)
+{
+    uint8_t uid[4];
+    int     bad = 0;
+    int     allow = 0;
+    int     i;
+
+    HOST_TEST_CHECK_EQ(card_wl_init(&__g_reload), AW_OK);
+    for (i = 0; i < __CARDS; i++) {
+        __uid_make(uid, i);
+        bad   += (card_wl_lookup(&__g_reload, uid) != __g_model[i]);
+        allow += (CARD_WL_STATE_ALLOW == __g_model[i]);
+    }
+    HOST_TEST_CHECK_EQ(bad, 0);
+    HOST_TEST_CHECK_EQ(__g_reload.allow_nums, allow);
+    HOST_TEST_CHECK_EQ(__g_reload.version, version);
+}
+
+static void __test_deferred (void)
+{
+    uint8_t  uid[4];
+    uint32_t version;
+    uint16_t nums;
+    int      i;
+
+    memset(__g_flash, 0xFF, sizeof(__g_flash));
+    memset(__g_model, 0, sizeof(__g_model));
+    HOST_TEST_CHECK_EQ(card_wl_init(&__g_wl), AW_OK);
+    HOST_TEST_CHECK_EQ(__g_wl.nums, 0);
+
+    for (i = 0; i < 10; i++) {
+        __uid_make(uid, i);
+        HOST_TEST_CHECK_EQ(card_wl_update(&__g_wl, uid, CARD_WL_STATE_ALLOW, i + 1), AW_OK);
+        __g_model[i] = CARD_WL_STATE_ALLOW;
+    }
+    __uid_make(uid, 3);
+    HOST_TEST_CHECK_EQ(card_wl_update(&__g_wl, uid, CARD_WL_STATE_DENY, 11), AW_OK);
+    __g_model[3] = CARD_WL_STATE_DENY;
+
+    /* 索引已更新， Flash未访问 */
+    HOST_TEST_CHECK_EQ(card_wl_lookup(&__g_wl, uid), CARD_WL_STATE_DENY);
+    card_wl_info_get(&__g_wl, &version, &nums);
+    HOST_TEST_CHECK_EQ(version, 11);
+    HOST_TEST_CHECK_EQ(nums, 9);
+    HOST_TEST_CHECK_EQ(__g_writes, 0);
+    HOST_TEST_CHECK_EQ(__g_erases, 0);
+
+    HOST_TEST_CHECK_EQ(card_wl_flush(&__g_wl), AW_OK);
+    HOST_TEST_CHECK_EQ(__g_wl.pend_nums, 0);
+    HOST_TEST_CHECK_EQ(__g_erases, 1);
+    __reload_check(11);
+
+    /* 待写入的记录满 */
+    for (i = 0; i < ACP1000_CARD_WL_PEND_NUMS; i++) {
+        __uid_make(uid, i);
+        HOST_TEST_CHECK_EQ(card_wl_update(&__g_wl, uid, CARD_WL_STATE_ALLOW, 12), AW_OK);
+        __g_model[i] = CARD_WL_STATE_ALLOW;
+    }
+    __uid_make(uid, ACP1000_CARD_WL_PEND_NUMS);
+    HOST_TEST_CHECK_EQ(card_wl_update(&__g_wl, uid, CARD_WL_STATE_ALLOW, 13), -AW_EBUSY);
+    HOST_TEST_CHECK_EQ(card_wl_lookup(&__g_wl, uid), CARD_WL_STATE_NONE);
+    card_wl_info_get(&__g_wl, &version, &nums);
+    HOST_TEST_CHECK_EQ(version, 12);
+    HOST_TEST_CHECK_EQ(card_wl_flush(&__g_wl), AW_OK);
+    __reload_check(12);
+}
+
+static void __test_compact (void)
+{
+    uint8_t uid[4];
+    uint8_t state;
+    int     erases = __g_erases;
+    int     i;
+
+    /* 写满 __REC_MAX 两遍以上， 整理时回到已写过的第一块 */
+    for (i = 0; i < __REC_MAX * 2 + 100; i++) {
+        state = ((i / __CARDS) & 1) ? CARD_WL_STATE_DENY : CARD_WL_STATE_ALLOW;
+        __uid_make(uid, i % __CARDS);
+        HOST_TEST_CHECK_EQ(card_wl_update(&__g_wl, uid, state, 100 + i), AW_OK);
+        __g_model[i % __CARDS] = state;
+        if (0 == (i % 7)) {
+            HOST_TEST_CHECK_EQ(card_wl_flush(&__g_wl), AW_OK);
+        }
+    }
+    HOST_TEST_CHECK_EQ(card_wl_flush(&__g_wl), AW_OK);
+    HOST_TEST_CHECK(__g_erases > erases + 2 * (CARD_WL_NVRAM_SIZE / __BLOCK_SIZE));
+    __reload_check(100 + i - 1);
+}
+
+static void __test_clear (void)
+{
+    uint8_t uid[4];
+
+    /* 清空前待写入的记录丢弃 */
+    __uid_make(uid, 1);
+    HOST_TEST_CHECK_EQ(card_wl_update(&__g_wl, uid, CARD_WL_STATE_ALLOW, 5000), AW_OK);
+    HOST_TEST_CHECK_EQ(card_wl_clear(&__g_wl, 6000), AW_OK);
+    HOST_TEST_CHECK_EQ(card_wl_lookup(&__g_wl, uid), CARD_WL_STATE_NONE);
+    memset(__g_model, 0, sizeof(__g_model));
+
+    __uid_make(uid, 2);
+    HOST_TEST_CHECK_EQ(card_wl_update(&__g_wl, uid, CARD_WL_STATE_ALLOW, 6001), AW_OK);
+    __g_model[2] = CARD_WL_STATE_ALLOW;
+
+    HOST_TEST_CHECK_EQ(card_wl_flush(&__g_wl), AW_OK);
+    __reload_check(6001);
+}
+
+static void __test_erase_fail (void)
+{
+    uint8_t uid[4];
+    int     i;
+
+    /* 写到下一块的起始处时擦除失败 */
+    i = 0;
+    while (0 != ((__g_wl.rec_nums * 16) % __BLOCK_SIZE)) {
+        __uid_make(uid, i % __CARDS);
+        HOST_TEST_CHECK_EQ(card_wl_update(&__g_wl, uid, CARD_WL_STATE_ALLOW, 7000 + i), AW_OK);
+        __g_model[i % __CARDS] = CARD_WL_STATE_ALLOW;
+        HOST_TEST_CHECK_EQ(card_wl_flush(&__g_wl), AW_OK);
+        i++;
+    }
+    __uid_make(uid, 50);
+    __g_erase_fail = 1;
+    HOST_TEST_CHECK_EQ(card_wl_update(&__g_wl, uid, CARD_WL_STATE_DENY, 8000), AW_OK);
+    __g_model[50] = CARD_WL_STATE_DENY;
+    HOST_TEST_CHECK(AW_OK != card_wl_flush(&__g_wl));
+
+    /* 无新记录时也整理重写 */
+    HOST_TEST_CHECK_EQ(card_wl_flush(&__g_wl), AW_OK);
+    HOST_TEST_CHECK(!__g_wl.rewrite);
+    __reload_check(8000);
+}
+
+int main (void)
+{
+    __test_deferred();
+    __test_compact();
+    __test_clear();
+    __test_erase_fail();
+
+    HOST_TEST_CHECK_EQ(__g_lock_depth, 0);
+
+    return HOST_TEST_END("card_wl");
+}
@@ -0,0 +1,280 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 负荷管理（charge_load）的多桩仿真测试
+ *
+ * 4个桩共用站内限流， 集中器每5s按接入的桩平均分配电流， 各桩每100ms按
+ * charger_load_curr_update() 的方式调整CP电流。 仿真时间内检查：
+ *  - 上调不超过上升速率， 首次下发从最小电流开始， 下调立即生效；
+ *  - 分配电流低于最小电流时保持最小电流；
+ *  - 某桩与集中器失联超过 ACP1000_LOAD_LINK_TIMEOUT 后退回安全电流， 恢复后重新上升；
+ *  - 各桩电流之和不超过站内限流（限流不低于各桩最小电流之和时）。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-18  xjc, first implementation
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include <string.h>
+#include "charge_load.h"
+#include "host_test.h"
+
+#define __PILE_NUMS      4
+#define __PILE_MAX       3200    /* 桩额定电流 32A */
+#define __RAMP_RATE      200     /* 2A/s */
+#define __MIN_CURR       600
+#define __FAILSAFE       1000
+#define __TICK_MS        100     /* 桩调整周期 */
+#define __HUB_MS         5000    /* 集中器分配周期 */
+
+typedef struct __pile {
+    charge_load_t cfg;
+    bool_t        connected;     /* 已接入车辆 */
+    bool_t        online;        /* 集中器能否访问 */
+    bool_t        link_lost;
+    uint32_t      now_curr;
+    uint32_t      update_ms;     /* 最近一次收到分配电流的时间 */
+    uint32_t      ramp_ms;       /* 最近一次调整电流的时间 */
+}__pile_t;
+
+static __pile_t __g_pile[__PILE_NUMS];
+static uint32_t __g_site;        /* 站内限流 */
+static uint32_t __g_ms;          /* 仿真时间 */
+
+/**
+ * \brief 集中器： 按接入的桩平均分配站内限流
+ */
+static void __hub_run (void)
+{
+    charge_load_t cfg;
+    int           nums = 0;
+    int           i;
+
+    for (i = 0; i < __PILE_NUMS; i++) {
+        nums += __g_pile[i].connected;
+    }
+    for (i = 0; i < __PILE_NUMS; i++) {
+        if (!__g_pile[i].connected || !__g_pile[i].online) {
+            continue;
+        }
+        cfg.enable        = TRUE;
+        cfg.curr_limit    = __g_site / nums;
+        cfg.ramp_rate     = __RAMP_RATE;
+        cfg.min_curr      = 0;                  /* 由 charge_load_cfg_check() 修正 */
+        cfg.failsafe_curr = __FAILSAFE;
+
+        /* 同 charger_load_cfg_set() */
+        __g_pile[i].cfg = cfg;
+        charge_load_cfg_check(&__g_pile[i].cfg);
+        __g_pile[i].update_ms = __g_ms;
+        __g_pile[i].link_lost = FALSE;
+    }
+}
+
+/**
+ * \brief 桩： 同 charger_load_curr_update()， 并检查每次调整
+ */
+static void __pile_run (__pile_t *p_pile)
+{
+    uint32_t target;
+    uint32_t curr;
+    bool_t   link_lost;
+
+    target = charge_load_target(&p_pile->cfg,
+                                __PILE_MAX,
+                                __g_ms - p_pile->update_ms,
+                                &link_lost);
+    if (link_lost) {
+        p_pile->link_lost = TRUE;
+    }
+    curr = charge_load_step(&p_pile->cfg,
+                            p_pile->now_curr,
+                            target,
+                            __g_ms - p_pile->ramp_ms);
+    if ((curr == p_pile->now_curr) && (curr < target)) {
+        return;
+    }
+
+    if (curr != p_pile->now_curr) {
+        HOST_TEST_CHECK(curr >= p_pile->cfg.min_curr);
+        HOST_TEST_CHECK(curr <= target);
+        if (p_pile->now_curr == 0) {
+            HOST_TEST_CHECK_EQ(curr, p_pile->cfg.min_curr);
+        } else if (curr > p_pile->now_curr) {
+            HOST_TEST_CHECK(curr - p_pile->now_curr <=
+                            __RAMP_RATE * (__g_ms - p_pile->ramp_ms) / 1000);
+        }
+        p_pile->now_curr = curr;
+    }
+    p_pile->ramp_ms = __g_ms;
+}
+
+/**
+ * \brief 运行仿真到指定时间（ms）
+ */
+static void __run_until (uint32_t end_ms)
+{
+    uint32_t sum;
+    int      nums;
+    int      i;
+
+    while (__g_ms < end_ms) {
+        __g_ms += __TICK_MS;
+        if (0 == __g_ms % __HUB_MS) {
+            __hub_run();
+        }
+
+        sum  = 0;
+        nums = 0;
+        for (i = 0; i < __PILE_NUMS; i++) {
+            if (__g_pile[i].connected) {
+                __pile_run(&__g_pile[i]);
+                sum += __g_pile[i].now_curr;
+                nums++;
+            }
+        }
+        if (__g_site >= nums * __MIN_CURR) {
+            HOST_TEST_CHECK(sum <= __g_site);
+        }
+    }
+}
+
+static void __pile_connect (int i)
+{
+    __g_pile[i].connected = TRUE;
+    __g_pile[i].online    = TRUE;
+    __g_pile[i].now_curr  = 0;
+    __g_pile[i].update_ms = __g_ms;
+    __g_pile[i].ramp_ms   = __g_ms;
+}
+
+static void __test_sim (void)
+{
+    int i;
+
+    memset(__g_pile, 0, sizeof(__g_pile));
+    __g_ms   = 0;
+    __g_site = 8000;
+
+    /* 2个桩： 各分配40A， 受桩额定电流限制为32A， 从6A按2A/s上升 */
+    __pile_connect(0);
+    __pile_connect(1);
+    __hub_run();
+    __run_until(12900);
+    HOST_TEST_CHECK(__g_pile[0].now_curr < __PILE_MAX);
+    __run_until(14000);
+    HOST_TEST_CHECK_EQ(__g_pile[0].now_curr, __PILE_MAX);
+    HOST_TEST_CHECK_EQ(__g_pile[1].now_curr, __PILE_MAX);
+
+    /* 4个桩： 各20A， 原有的桩立即下调， 新接入的桩从6A上升 */
+    __run_until(19900);
+    __pile_connect(2);
+    __pile_connect(3);
+    __run_until(20000);
+    HOST_TEST_CHECK_EQ(__g_pile[0].now_curr, 2000);
+    HOST_TEST_CHECK_EQ(__g_pile[1].now_curr, 2000);
+    HOST_TEST_CHECK_EQ(__g_pile[2].now_curr, __MIN_CURR);
+    __run_until(30000);
+    for (i = 0; i < __PILE_NUMS; i++) {
+        HOST_TEST_CHECK_EQ(__g_pile[i].now_curr, 2000);
+    }
+
+    /* 站内限流降到16A， 每桩4A低于最小电流， 保持6A */
+    __g_site = 1600;
+    __run_until(45000);
+    for (i = 0; i < __PILE_NUMS; i++) {
+        HOST_TEST_CHECK_EQ(__g_pile[i].now_curr, __MIN_CURR);
+    }
+
+    /* 恢复到80A */
+    __g_site = 8000;
+    __run_until(60000);
+    for (i = 0; i < __PILE_NUMS; i++) {
+        HOST_TEST_CHECK_EQ(__g_pile[i].now_curr, 2000);
+    }
+
+    /* 桩3在65s收到最后一次分配后失联， 95s后退回安全电流 */
+    __run_until(69900);
+    __g_pile[3].online = FALSE;
+    __run_until(95000);
+    HOST_TEST_CHECK(!__g_pile[3].link_lost);
+    HOST_TEST_CHECK_EQ(__g_pile[3].now_curr, 2000);
+    __run_until(95100);
+    HOST_TEST_CHECK(__g_pile[3].link_lost);
+    HOST_TEST_CHECK_EQ(__g_pile[3].now_curr, __FAILSAFE);
+    __run_until(120000);
+    HOST_TEST_CHECK_EQ(__g_pile[3].now_curr, __FAILSAFE);
+    for (i = 0; i < 3; i++) {
+        HOST_TEST_CHECK(!__g_pile[i].link_lost);
+        HOST_TEST_CHECK_EQ(__g_pile[i].now_curr, 2000);
+    }
+
+    /* 恢复通信后从安全电流上升到分配电流 */
+    __g_pile[3].online = TRUE;
+    __run_until(127000);
+    HOST_TEST_CHECK(!__g_pile[3].link_lost);
+    HOST_TEST_CHECK(__g_pile[3].now_curr > __FAILSAFE);
+    HOST_TEST_CHECK(__g_pile[3].now_curr < 2000);
+    __run_until(131000);
+    HOST_TEST_CHECK_EQ(__g_pile[3].now_curr, 2000);
+}
+
+/**
+ * \brief 参数修正及非负荷管理模式
+ */
+static void __test_cfg (void)
+{
+    charge_load_t cfg;
+    bool_t        link_lost;
+
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.min_curr      = 100;
+    cfg.failsafe_curr = 300;
+    charge_load_cfg_check(&cfg);
+    HOST_TEST_CHECK_EQ(cfg.min_curr, ACP1000_LOAD_MIN_CURR);
+    HOST_TEST_CHECK_EQ(cfg.failsafe_curr, ACP1000_LOAD_MIN_CURR);
+
+    /* 非负荷管理模式： 桩额定电流， 立即生效 */
+    cfg.enable     = FALSE;
+    cfg.curr_limit = 1000;
+    cfg.ramp_rate  = __RAMP_RATE;
+    HOST_TEST_CHECK_EQ(charge_load_target(&cfg, __PILE_MAX, 100000, &link_lost), __PILE_MAX);
+    HOST_TEST_CHECK(!link_lost);
+    HOST_TEST_CHECK_EQ(charge_load_step(&cfg, 0, __PILE_MAX, 0), __PILE_MAX);
+    HOST_TEST_CHECK_EQ(charge_load_step(&cfg, 1000, __PILE_MAX, 0), __PILE_MAX);
+
+    /* 分配电流高于桩额定电流 */
+    cfg.enable     = TRUE;
+    cfg.curr_limit = 5000;
+    HOST_TEST_CHECK_EQ(charge_load_target(&cfg, __PILE_MAX, 0, &link_lost), __PILE_MAX);
+
+    /* 上升速率为0： 不限制 */
+    cfg.ramp_rate = 0;
+    HOST_TEST_CHECK_EQ(charge_load_step(&cfg, 1000, __PILE_MAX, 0), __PILE_MAX);
+
+    /* 累积时间不足一个步进 */
+    cfg.ramp_rate = __RAMP_RATE;
+    HOST_TEST_CHECK_EQ(charge_load_step(&cfg, 1000, __PILE_MAX, 4), 1000);
+    HOST_TEST_CHECK_EQ(charge_load_step(&cfg, 1000, __PILE_MAX, 5), 1001);
+}
+
+int main (void)
+{
+    __test_sim();
+    __test_cfg();
+
+    return HOST_TEST_END("charge_load");
+}
@@ -0,0 +1,258 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 智能充电规划（charge_sched_plan）的主机测试
+ *
+ * 固定电价表下检查：
+ *  - 推迟到低价时段开始， 之前电流为0， 电费全部按低价计；
+ *  - 离开前无法充满时从现在起以最大电流充电；
+ *  - 已开始充电时不推迟、 不暂停， 额外电量只放在低价时段；
+ *  - 参数错误、 0个时段、 时段数超过上限；
+ *  - 相同输入得到相同的规划。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-18  xjc, first implementation
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include <string.h>
+#include "charge_sched.h"
+#include "host_test.h"
+
+#define __VOL         2200    /* 220.0V */
+#define __MAX_CURR    3200    /* 32A， 每时段 1760Wh */
+#define __MIN_CURR    600     /* 6A， 每时段 330Wh */
+#define __CHEAP       10000
+#define __DEAR        30000
+
+static uint16_t __g_price[CHARGE_SCHED_PRICE_NUM];
+
+/**
+ * \brief 0~5点低价， 其余高价
+ */
+static void __price_night (void)
+{
+    int h;
+
+    for (h = 0; h < CHARGE_SCHED_PRICE_NUM; h++) {
+        __g_price[h] = (h < 6) ? __CHEAP : __DEAR;
+    }
+}
+
+static uint16_t __slot_price (const charge_sched_param_t *p_param, int slot)
+{
+    return __g_price[((p_param->start_minute + slot * CHARGE_SCHED_SLOT_MIN) / 60) %
+                     CHARGE_SCHED_PRICE_NUM];
+}
+
+static void __param_init (charge_sched_param_t *p_param,
+                          uint32_t              energy,
+                          uint16_t              slot_nums,
+                          uint16_t              start_minute)
+{
+    memset(p_param, 0, sizeof(*p_param));
+    p_param->energy       = energy;
+    p_param->slot_nums    = slot_nums;
+    p_param->start_minute = start_minute;
+    p_param->vol          = __VOL;
+    p_param->max_curr     = __MAX_CURR;
+    p_param->min_curr     = __MIN_CURR;
+}
+
+/**
+ * \brief 检查规划的一般性质： 开始前电流为0， 之后在最小、 最大电流之间，
+ *        电量、 电费与各时段电流一致
+ */
+static void __plan_check (const charge_sched_param_t *p_param,
+                          const charge_sched_plan_t  *p_plan)
+{
+    uint32_t e_min  = charge_sched_slot_energy(p_param->min_curr, p_param->vol);
+    uint32_t energy = 0;
+    uint32_t cost   = 0;
+    uint32_t e;
+    int      slot;
+
+    for (slot = 0; slot < p_plan->slot_nums; slot++) {
+        if (slot < p_plan->start_slot) {
+            HOST_TEST_CHECK_EQ(p_plan->curr[slot], 0);
+            continue;
+        }
+        HOST_TEST_CHECK(p_plan->curr[slot] >= p_param->min_curr);
+        HOST_TEST_CHECK(p_plan->curr[slot] <= p_param->max_curr);
+
+        e       = charge_sched_slot_energy(p_plan->curr[slot], p_param->vol);
+        energy += e;
+        if (p_plan->reachable) {
+            /* 最小电流部分与追加部分分别计费 */
+            cost += (__slot_price(p_param, slot) * e_min) / 1000 +
+                    (__slot_price(p_param, slot) * (e - e_min)) / 1000;
+        } else {
+            cost += (__slot_price(p_param, slot) * e) / 1000;
+        }
+    }
+    HOST_TEST_CHECK_EQ(p_plan->energy, energy);
+    HOST_TEST_CHECK_EQ(p_plan->cost, cost);
+    HOST_TEST_CHECK_EQ(p_plan->reachable, energy >= p_param->energy);
+}
+
+/**
+ * \brief 20:00 插枪， 06:00 离开， 推迟到 00:00 后的低价时段
+ */
+static void __test_defer (void)
+{
+    charge_sched_param_t param;
+    charge_sched_plan_t  plan, again;
+    int                  slot;
+
+    __price_night();
+    __param_init(&param, 7000, 40, 20 * 60);
+
+    HOST_TEST_CHECK_EQ(charge_sched_plan(&param, __g_price, &plan), AW_OK);
+    __plan_check(&param, &plan);
+    HOST_TEST_CHECK(plan.reachable);
+    HOST_TEST_CHECK_EQ(plan.slot_nums, 40);
+    HOST_TEST_CHECK(plan.start_slot >= 16);
+    HOST_TEST_CHECK(plan.energy >= 7000);
+    HOST_TEST_CHECK(plan.energy < 7000 + charge_sched_slot_energy(__MAX_CURR, __VOL));
+    for (slot = 0; slot < 16; slot++) {
+        HOST_TEST_CHECK_EQ(plan.curr[slot], 0);
+    }
+    /* 全部按低价计 */
+    HOST_TEST_CHECK_EQ(plan.cost, plan.energy * __CHEAP / 1000);
+
+    /* 相同输入得到相同的规划 */
+    HOST_TEST_CHECK_EQ(charge_sched_plan(&param, __g_price, &again), AW_OK);
+    HOST_TEST_CHECK(0 == memcmp(&plan, &again, sizeof(plan)));
+}
+
+/**
+ * \brief 电价相同时不推迟
+ */
+static void __test_flat (void)
+{
+    charge_sched_param_t param;
+    charge_sched_plan_t  plan;
+    int                  h;
+
+    for (h = 0; h < CHARGE_SCHED_PRICE_NUM; h++) {
+        __g_price[h] = 20000;
+    }
+    __param_init(&param, 3000, 16, 8 * 60 + 30);
+
+    HOST_TEST_CHECK_EQ(charge_sched_plan(&param, __g_price, &plan), AW_OK);
+    __plan_check(&param, &plan);
+    HOST_TEST_CHECK(plan.reachable);
+    HOST_TEST_CHECK(plan.energy >= 3000);
+    HOST_TEST_CHECK(plan.energy < 3000 + charge_sched_slot_energy(__MAX_CURR, __VOL));
+}
+
+/**
+ * \brief 离开前无法充满： 从现在起以最大电流充电
+ */
+static void __test_unreachable (void)
+{
+    charge_sched_param_t param;
+    charge_sched_plan_t  plan;
+    uint32_t             cost = 0;
+    int                  slot;
+
+    __price_night();
+    __param_init(&param, 100000, 8, 22 * 60);
+
+    HOST_TEST_CHECK_EQ(charge_sched_plan(&param, __g_price, &plan), AW_OK);
+    __plan_check(&param, &plan);
+    HOST_TEST_CHECK(!plan.reachable);
+    HOST_TEST_CHECK_EQ(plan.start_slot, 0);
+    for (slot = 0; slot < 8; slot++) {
+        HOST_TEST_CHECK_EQ(plan.curr[slot], __MAX_CURR);
+        cost += __slot_price(&param, slot) * charge_sched_slot_energy(__MAX_CURR, __VOL) / 1000;
+    }
+    HOST_TEST_CHECK_EQ(plan.energy, 8 * charge_sched_slot_energy(__MAX_CURR, __VOL));
+    HOST_TEST_CHECK_EQ(plan.cost, cost);
+}
+
+/**
+ * \brief 已开始充电： 从当前时段起不低于最小电流， 额外电量放在低价时段
+ */
+static void __test_started (void)
+{
+    charge_sched_param_t param;
+    charge_sched_plan_t  plan;
+    charge_sched_plan_t  defer;
+    int                  slot;
+
+    __price_night();
+    __param_init(&param, 7000, 40, 20 * 60);
+    HOST_TEST_CHECK_EQ(charge_sched_plan(&param, __g_price, &defer), AW_OK);
+
+    param.started = TRUE;
+    HOST_TEST_CHECK_EQ(charge_sched_plan(&param, __g_price, &plan), AW_OK);
+    __plan_check(&param, &plan);
+    HOST_TEST_CHECK(plan.reachable);
+    HOST_TEST_CHECK_EQ(plan.start_slot, 0);
+    for (slot = 0; slot < 16; slot++) {
+        HOST_TEST_CHECK_EQ(plan.curr[slot], __MIN_CURR);    /* 高价时段只保持最小电流 */
+    }
+    HOST_TEST_CHECK(plan.cost >= defer.cost);
+}
+
+/**
+ * \brief 参数错误及边界
+ */
+static void __test_param (void)
+{
+    charge_sched_param_t param;
+    charge_sched_plan_t  plan;
+
+    __price_night();
+
+    __param_init(&param, 1000, 8, 0);
+    HOST_TEST_CHECK_EQ(charge_sched_plan(NULL, __g_price, &plan), -AW_EINVAL);
+    HOST_TEST_CHECK_EQ(charge_sched_plan(&param, NULL, &plan), -AW_EINVAL);
+    HOST_TEST_CHECK_EQ(charge_sched_plan(&param, __g_price, NULL), -AW_EINVAL);
+
+    param.min_curr = __MAX_CURR + 1;
+    HOST_TEST_CHECK_EQ(charge_sched_plan(&param, __g_price, &plan), -AW_EINVAL);
+
+    __param_init(&param, 1000, 8, 0);
+    param.vol = 0;
+    HOST_TEST_CHECK_EQ(charge_sched_plan(&param, __g_price, &plan), -AW_EINVAL);
+
+    /* 0个时段： 只有无需充电时能完成 */
+    __param_init(&param, 0, 0, 0);
+    HOST_TEST_CHECK_EQ(charge_sched_plan(&param, __g_price, &plan), AW_OK);
+    HOST_TEST_CHECK(plan.reachable);
+    __param_init(&param, 10, 0, 0);
+    HOST_TEST_CHECK_EQ(charge_sched_plan(&param, __g_price, &plan), AW_OK);
+    HOST_TEST_CHECK(!plan.reachable);
+
+    /* 时段数超过上限时只规划 CHARGE_SCHED_SLOT_MAX 个 */
+    __param_init(&param, 5000, CHARGE_SCHED_SLOT_MAX + 20, 0);
+    HOST_TEST_CHECK_EQ(charge_sched_plan(&param, __g_price, &plan), AW_OK);
+    HOST_TEST_CHECK_EQ(plan.slot_nums, CHARGE_SCHED_SLOT_MAX);
+    __plan_check(&param, &plan);
+}
+
+int main (void)
+{
+    __test_defer();
+    __test_flat();
+    __test_unreachable();
+    __test_started();
+    __test_param();
+
+    return HOST_TEST_END("charge_sched");
+}
@@ -0,0 +1,211 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief DES（查表实现）的已知答案测试及基准
+ *
+ * - FIPS 81 及常用的标准向量；
+ * - 与原逐位置换实现（16-10 之前的 des.c）的结果比较： 前4组为原实现输出，
+ *   其余20000组随机密钥、 数据块（xorshift32， 种子 0x2016A5C3）的加密、 解密结果
+ *   按字节折叠为64位摘要， 摘要值由原实现计算（原实现把子密钥或入调用者的
+ *   key_set 数组而不清零， 每换一个密钥须先清零， 固件中密钥固定， 不受影响）；
+ * - 解密还原、 密钥调度缓存；
+ * - 基准： 每次重新扩展密钥及使用缓存密钥时每块的时间， 上下文占用的RAM。
+ *   查表均为const， 位于Flash， des.o 无 .data/.bss。 同一主机上原实现每块
+ *   （含密钥扩展）约10.2us， 并占用约3.3KB的 .data。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-18  xjc, first implementation
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "des/des.h"
+#include "host_test.h"
+
+#define __RAND_NUMS      20000
+#define __RAND_SEED      0x2016A5C3
+#define __OLD_ENC_DIGEST 0x2F2E988B917DF4CEULL   /* 原实现加密结果的摘要 */
+#define __OLD_DEC_DIGEST 0xC5568579FD48812AULL   /* 原实现解密结果的摘要 */
+
+#define __BENCH_NUMS     200000
+
+typedef struct __vector {
+    unsigned char key[8];
+    unsigned char plain[8];
+    unsigned char cipher[8];
+}__vector_t;
+
+static const __vector_t __g_vectors[] = {
+    /* FIPS 81 */
+    {{0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF},
+     {0x4E, 0x6F, 0x77, 0x20, 0x69, 0x73, 0x20, 0x74},
+     {0x3F, 0xA4, 0x0E, 0x8A, 0x98, 0x4D, 0x48, 0x15}},
+    {{0x13, 0x34, 0x57, 0x79, 0x9B, 0xBC, 0xDF, 0xF1},
+     {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF},
+     {0x85, 0xE8, 0x13, 0x54, 0x0F, 0x0A, 0xB4, 0x05}},
+
+    /* 原实现的输出 */
+    {{0x14, 0x59, 0x0F, 0xE3, 0x64, 0x36, 0x3D, 0xA3},
+     {0xFC, 0x6A, 0x74, 0xA9, 0x2A, 0x2B, 0xCE, 0x59},
+     {0x38, 0x99, 0xC5, 0x70, 0xD9, 0x7A, 0x81, 0x3D}},
+    {{0x1A, 0xEE, 0x8E, 0xAA, 0x9C, 0x2D, 0x50, 0x84},
+     {0x75, 0x40, 0x73, 0xDD, 0x20, 0x04, 0xAE, 0xA0},
+     {0x9D, 0x61, 0xEE, 0x22, 0xC7, 0xA3, 0xB8, 0x32}},
+    {{0xAF, 0x08, 0x61, 0xD3, 0xD3, 0xF5, 0xE0, 0x54},
+     {0xC2, 0x68, 0x06, 0x6D, 0x8A, 0xE4, 0x47, 0x6D},
+     {0x43, 0x4E, 0x65, 0xE3, 0x83, 0xAD, 0xB8, 0xE7}},
+    {{0x98, 0x62, 0xC0, 0xF3, 0xB2, 0x46, 0x63, 0x71},
+     {0x0A, 0x55, 0x8C, 0xB4, 0xEB, 0xC0, 0xE3, 0x4F},
+     {0x4D, 0x44, 0xD3, 0x63, 0x8E, 0x6C, 0x7F, 0x34}},
+};
+
+static uint32_t __g_rand = __RAND_SEED;
+
+static uint32_t __rand (void)
+{
+    __g_rand ^= __g_rand << 13;
+    __g_rand ^= __g_rand >> 17;
+    __g_rand ^= __g_rand << 5;
+    return __g_rand;
+}
+
+static uint64_t __digest (uint64_t digest, const unsigned char *p_blk)
+{
+    int i;
+
+    for (i = 0; i < 8; i++) {
+        digest = ((digest << 8) | (digest >> 56)) ^ p_blk[i];
+    }
+    return digest;
+}
+
+static uint64_t __ns_get (void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void __test_vectors (void)
+{
+    des_ctx       ctx;
+    unsigned char out[8];
+    unsigned int  i;
+
+    for (i = 0; i < AW_NELEMENTS(__g_vectors); i++) {
+        des_key_setup(&ctx, __g_vectors[i].key);
+        des_block_process(&ctx, __g_vectors[i].plain, out, ENCRYPTION_MODE);
+        HOST_TEST_CHECK(0 == memcmp(out, __g_vectors[i].cipher, 8));
+        des_block_process(&ctx, out, out, DECRYPTION_MODE);
+        HOST_TEST_CHECK(0 == memcmp(out, __g_vectors[i].plain, 8));
+    }
+}
+
+/**
+ * \brief 随机密钥、 数据块与原实现比较
+ */
+static void __test_old (void)
+{
+    des_ctx       ctx;
+    unsigned char key[8];
+    unsigned char in[8];
+    unsigned char out[8];
+    unsigned char back[8];
+    uint64_t      enc = 0;
+    uint64_t      dec = 0;
+    int           bad = 0;
+    int           i, j;
+
+    for (i = 0; i < __RAND_NUMS; i++) {
+        for (j = 0; j < 8; j++) {
+            key[j] = __rand();
+        }
+        for (j = 0; j < 8; j++) {
+            in[j] = __rand();
+        }
+        des_key_setup(&ctx, key);
+        des_block_process(&ctx, in, out, ENCRYPTION_MODE);
+        des_block_process(&ctx, out, back, DECRYPTION_MODE);
+        bad += (0 != memcmp(in, back, 8));
+        enc  = __digest(enc, out);
+        des_block_process(&ctx, in, out, DECRYPTION_MODE);
+        dec  = __digest(dec, out);
+    }
+    HOST_TEST_CHECK_EQ(bad, 0);
+    HOST_TEST_CHECK(__OLD_ENC_DIGEST == enc);
+    HOST_TEST_CHECK(__OLD_DEC_DIGEST == dec);
+}
+
+static void __test_cached (void)
+{
+    des_ctx       ctx;
+    unsigned char key[8];
+    unsigned char out[8];
+
+    memset(&ctx, 0, sizeof(ctx));
+    memcpy(key, __g_vectors[0].key, 8);
+    HOST_TEST_CHECK_EQ(des_key_setup_cached(&ctx, key), 0);
+    HOST_TEST_CHECK_EQ(des_key_setup_cached(&ctx, key), 1);
+    des_block_process(&ctx, __g_vectors[0].plain, out, ENCRYPTION_MODE);
+    HOST_TEST_CHECK(0 == memcmp(out, __g_vectors[0].cipher, 8));
+
+    /* 密钥改变时重新扩展 */
+    key[7] ^= 0x10;
+    HOST_TEST_CHECK_EQ(des_key_setup_cached(&ctx, key), 0);
+    des_block_process(&ctx, __g_vectors[0].plain, out, ENCRYPTION_MODE);
+    HOST_TEST_CHECK(0 != memcmp(out, __g_vectors[0].cipher, 8));
+}
+
+static void __bench (void)
+{
+    des_ctx       ctx;
+    unsigned char blk[8];
+    uint64_t      t0, t1, t2;
+    int           i;
+
+    memcpy(blk, __g_vectors[0].plain, 8);
+    memset(&ctx, 0, sizeof(ctx));
+
+    t0 = __ns_get();
+    for (i = 0; i < __BENCH_NUMS; i++) {
+        des_key_setup(&ctx, __g_vectors[i & 1].key);
+        des_block_process(&ctx, blk, blk, ENCRYPTION_MODE);
+    }
+    t1 = __ns_get();
+    for (i = 0; i < __BENCH_NUMS; i++) {
+        des_key_setup_cached(&ctx, __g_vectors[0].key);
+        des_block_process(&ctx, blk, blk, ENCRYPTION_MODE);
+    }
+    t2 = __ns_get();
+
+    printf("bench des: key+block %u ns, block (cached key) %u ns, ctx %u bytes\n",
+           (unsigned)((t1 - t0) / __BENCH_NUMS),
+           (unsigned)((t2 - t1) / __BENCH_NUMS),
+           (unsigned)sizeof(des_ctx));
+}
+
+int main (void)
+{
+    __test_vectors();
+    __test_old();
+    __test_cached();
+    __bench();
+
+    return HOST_TEST_END("des");
+}
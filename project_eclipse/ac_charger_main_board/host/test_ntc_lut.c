@@ -0,0 +1,168 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief NTC温度查表（ntc_lut）与原换算（ntc）的比较
+ *
+ * 两种表格（ACP1000_TEMP_LUT 为1、 2）均编译进本测试， 与 ac_charge_prj_cfg.h
+ * 的选择无关。 检查：
+ *  - 整表与原换算在全部4096个码值上一致；
+ *  - 16步压缩表在每16个码值的点上一致， 高于-40℃至85℃内误差不超过 26/256℃，
+ *    取整到1℃时最多相差1；
+ *  - 低于-40℃及码值0时为-40℃。
+ * 并输出两种方式每次换算的时间。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-18  xjc, first implementation
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "ac_charge_prj_cfg.h"
+#include "ntc.h"
+#include "ntc_lut.h"
+#include "host_test.h"
+
+/* 两种表格分别编译 */
+#undef  ACP1000_TEMP_LUT
+#define ACP1000_TEMP_LUT    1
+#define ntc_lut_temp_get    __lut_full_get
+#include "ntc_lut.c"
+#undef  ntc_lut_temp_get
+#undef  ACP1000_TEMP_LUT
+#define ACP1000_TEMP_LUT    2
+#define ntc_lut_temp_get    __lut_16_get
+#include "ntc_lut.c"
+#undef  ntc_lut_temp_get
+
+#define __CODE_NUMS     (1 << NTC_LUT_BITS)
+#define __MAX_DIFF      26          /* 16步压缩表的最大误差， 单位1/256℃ */
+#define __BENCH_LOOPS   200
+
+/**
+ * \brief 原换算（同 pile_temp_task.c 的计算方式， 码值0按-40℃）
+ */
+static int16_t __temp_get (uint16_t code)
+{
+    uint32_t mv = code * NTC_LUT_VREF_MV / (__CODE_NUMS - 1);
+
+    if (0 == mv) {
+        return -40 << 8;
+    }
+    return ntc_res_to_temp(ntc_res_get(mv));
+}
+
+static uint64_t __ns_get (void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void __test_full (void)
+{
+    int code;
+    int bad = 0;
+
+    for (code = 0; code < __CODE_NUMS; code++) {
+        bad += (__lut_full_get(code) != __temp_get(code));
+    }
+    HOST_TEST_CHECK_EQ(bad, 0);
+}
+
+static void __test_16 (void)
+{
+    int     code;
+    int     nums     = 0;
+    int     max_diff = 0;
+    int     max_deg  = 0;
+    int16_t ref;
+    int16_t lut;
+
+    for (code = 0; code < __CODE_NUMS; code += 16) {
+        HOST_TEST_CHECK_EQ(__lut_16_get(code), __temp_get(code));
+    }
+
+    for (code = 0; code < __CODE_NUMS; code++) {
+        ref = __temp_get(code);
+        if ((ref <= (-40 << 8)) || (ref > (85 << 8))) {
+            continue;
+        }
+        lut = __lut_16_get(code);
+        nums++;
+        if (abs(lut - ref) > max_diff) {
+            max_diff = abs(lut - ref);
+        }
+        if (abs(lut / 256 - ref / 256) > max_deg) {
+            max_deg = abs(lut / 256 - ref / 256);
+        }
+    }
+    HOST_TEST_CHECK(nums > 3000);
+    HOST_TEST_CHECK(max_diff <= __MAX_DIFF);
+    HOST_TEST_CHECK(max_deg <= 1);
+    printf("ntc_lut: %d codes in -40..85 C, 16-step table max diff %d/256 C\n",
+           nums, max_diff);
+}
+
+static void __test_clamp (void)
+{
+    HOST_TEST_CHECK_EQ(__temp_get(0), -40 << 8);
+    HOST_TEST_CHECK_EQ(__lut_full_get(0), -40 << 8);
+    HOST_TEST_CHECK_EQ(__lut_16_get(0), -40 << 8);
+
+    /* 阻值高于-39℃、 -40℃的阻值 */
+    HOST_TEST_CHECK_EQ(ntc_res_to_temp(240000), -40 << 8);
+    HOST_TEST_CHECK_EQ(ntc_res_to_temp(300000), -40 << 8);
+    HOST_TEST_CHECK_EQ(ntc_res_to_temp(10000), 25 << 8);
+}
+
+static void __bench (void)
+{
+    volatile int16_t sum = 0;
+    uint64_t         t0, t1, t2;
+    int              i;
+    int              code;
+
+    t0 = __ns_get();
+    for (i = 0; i < __BENCH_LOOPS; i++) {
+        for (code = 1; code < __CODE_NUMS; code++) {
+            sum += ntc_res_to_temp(ntc_res_get(code * NTC_LUT_VREF_MV / (__CODE_NUMS - 1) + 1));
+        }
+    }
+    t1 = __ns_get();
+    for (i = 0; i < __BENCH_LOOPS; i++) {
+        for (code = 1; code < __CODE_NUMS; code++) {
+            sum += __lut_16_get(code);
+        }
+    }
+    t2 = __ns_get();
+
+    printf("bench ntc: calc %u ns, 16-step table %u ns\n",
+           (unsigned)((t1 - t0) / (__BENCH_LOOPS * (__CODE_NUMS - 1))),
+           (unsigned)((t2 - t1) / (__BENCH_LOOPS * (__CODE_NUMS - 1))));
+}
+
+int main (void)
+{
+    __test_full();
+    __test_16();
+    __test_clamp();
+    __bench();
+
+    return HOST_TEST_END("ntc_lut");
+}
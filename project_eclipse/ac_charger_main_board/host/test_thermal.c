@@ -0,0 +1,346 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 温度监测（thermal.c）测试
+ *
+ * 按 pile_temp_task.c 的测温点配置， 每 ACP1000_THERMAL_PERIOD 更新一次两个通道
+ * 并发布事件， 环境温度保持25℃。 检查：
+ *  - 缓慢升温： 降额点前不降额， 降额点到跳闸点之间电流按线性比例下降，
+ *    到达跳闸点后按最小电流并发布一次ERR_TEMP(1)；
+ *  - 降温： 降到跳闸点减回差以下才发布ERR_TEMP(0)， 降额电流按温度加回差计算，
+ *    退出降额时发布TEMP_DERATE(0)；
+ *  - 阶跃： 温升速率超限时立即按最小电流， 阶跃移出历史窗口后恢复；
+ *  - 温升速率回差： 超过限值进入， 降到一半以下才退出；
+ *  - 每次更新后已发布的TEMP_DERATE与当前电流上限相差不足一个步进，
+ *    进出降额及最小电流总是发布。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-18  xjc, first implementation
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include <string.h>
+#include "aw_system.h"
+#include "thermal.h"
+#include "host_test.h"
+
+#define __DEG(t)         ((int32_t)(t) << 8)
+#define __MAX_CURR       (ACP1000_PILE_MAX_CURR / 10)
+#define __MIN_CURR       ACP1000_LOAD_MIN_CURR
+
+#define __AMBIENT        __DEG(25)
+
+/* 与pile_temp_task.c的插座测温点相同 */
+#define __SOCKET_DERATE  70
+#define __SOCKET_TRIP    90
+#define __SOCKET_HYST    5
+#define __SOCKET_ROR     10
+
+static const thermal_chan_cfg_t __g_cfg[ACP1000_THERMAL_CHANS] = {
+    {"ambient", 0, 0, 1024, 65,             100,           -30,            3,             0},
+    {"socket",  1, 0, 1024, __SOCKET_DERATE, __SOCKET_TRIP, THERMAL_NO_LOW, __SOCKET_HYST, __SOCKET_ROR},
+};
+
+/*******************************************************************************
+  模拟
+*******************************************************************************/
+static uint32_t __g_ms;
+
+static int      __g_derate_nums;     /* 已发布的TEMP_DERATE个数 */
+static uint32_t __g_derate_last;
+static int      __g_err_nums;        /* 已发布的ERR_TEMP个数 */
+static int      __g_err_last;
+static int      __g_temp_bad;        /* 与环境温度不符的PILE_TEMP个数 */
+
+aw_tick_t aw_sys_tick_get (void)
+{
+    return __g_ms;
+}
+
+unsigned int aw_ticks_to_ms (aw_tick_t ticks)
+{
+    return ticks;
+}
+
+void event_node_tell_all (struct event_node *p_this, event_t event, void *p_arg)
+{
+    switch (event) {
+
+    case TEMP_DERATE:
+        __g_derate_nums++;
+        __g_derate_last = (uint32_t)p_arg;
+        break;
+
+    case ERR_TEMP:
+        __g_err_nums++;
+        __g_err_last = (int)p_arg;
+        break;
+
+    case PILE_TEMP:
+        __g_temp_bad += ((int)p_arg != __AMBIENT / 256);
+        break;
+
+    default:
+        break;
+    }
+}
+
+/*******************************************************************************
+  测试
+*******************************************************************************/
+static thermal_t    __g_th;
+static event_node_t __g_node;
+
+static void __reset (void)
+{
+    thermal_init(&__g_th, __g_cfg);
+    __g_derate_nums = 0;
+    __g_derate_last = 0;
+    __g_err_nums    = 0;
+    __g_err_last    = 0;
+}
+
+/**
+ * \brief 降额用温度为t（1/256℃）时插座通道的电流上限
+ */
+static uint32_t __derate_curr (int32_t t)
+{
+    int32_t  over = t - __DEG(__SOCKET_DERATE);
+    uint32_t limit;
+
+    if (over <= 0) {
+        return 0;
+    }
+    limit = __MAX_CURR - over * (__MAX_CURR - __MIN_CURR) /
+                         __DEG(__SOCKET_TRIP - __SOCKET_DERATE);
+    return (limit < __MIN_CURR) ? __MIN_CURR : limit;
+}
+
+/**
+ * \brief 一个采样周期： 更新并发布， 检查已发布的TEMP_DERATE
+ */
+static void __step (int32_t socket)
+{
+    thermal_chan_t *p_chan = &__g_th.chan[1];
+    uint32_t        pub;
+    uint32_t        limit;
+
+    __g_ms += ACP1000_THERMAL_PERIOD;
+    thermal_chan_update(&__g_th, 0, __AMBIENT);
+    thermal_chan_update(&__g_th, 1, socket);
+    thermal_publish(&__g_th, &__g_node);
+
+    /* 环境温度不降额， 电流上限即插座通道的上限 */
+    HOST_TEST_CHECK_EQ(__g_th.chan[0].limit, 0);
+    limit = p_chan->limit;
+    pub   = __g_derate_last;
+    if (pub != limit) {
+        HOST_TEST_CHECK((0 != pub) && (0 != limit));
+        HOST_TEST_CHECK(limit != __MIN_CURR);
+        HOST_TEST_CHECK(((pub > limit) ? pub - limit : limit - pub) <
+                        ACP1000_THERMAL_CURR_STEP);
+    }
+}
+
+/**
+ * \brief 保持温度n个周期（填满温升速率历史）
+ */
+static void __hold (int32_t socket, int n)
+{
+    while (n--) {
+        __step(socket);
+    }
+}
+
+static void __test_ramp_cool (void)
+{
+    thermal_chan_t *p_chan = &__g_th.chan[1];
+    uint32_t        last   = 0;
+    int             bad    = 0;
+    int32_t         t;
+    int32_t         expect;
+
+    __reset();
+    __hold(__DEG(25), THERMAL_ROR_NUMS);
+    HOST_TEST_CHECK_EQ(p_chan->state, THERMAL_STATE_NORMAL);
+    HOST_TEST_CHECK_EQ(__g_derate_nums, 0);
+    HOST_TEST_CHECK_EQ(__g_err_nums, 0);
+
+    /* 每周期升0.25℃（7.5℃/min， 低于温升速率限值） */
+    for (t = __DEG(25) + 64; t <= __DEG(95); t += 64) {
+        __step(t);
+        if (t <= __DEG(__SOCKET_DERATE)) {
+            bad += (THERMAL_STATE_NORMAL != p_chan->state) || (0 != p_chan->limit);
+        } else if (t < __DEG(__SOCKET_TRIP)) {
+            bad += (THERMAL_STATE_DERATE != p_chan->state) ||
+                   (__derate_curr(t) != p_chan->limit);
+        } else {
+            bad += (THERMAL_STATE_TRIP != p_chan->state) || (__MIN_CURR != p_chan->limit);
+        }
+
+        /* 升温时发布的电流只减不增 */
+        if (last && (__g_derate_last > last)) {
+            bad++;
+        }
+        last = __g_derate_last;
+
+        /* 到达跳闸点时只发布一次过温 */
+        HOST_TEST_CHECK_EQ(__g_err_nums, (t >= __DEG(__SOCKET_TRIP)) ? 1 : 0);
+    }
+    HOST_TEST_CHECK_EQ(bad, 0);
+    HOST_TEST_CHECK_EQ(__g_err_last, 1);
+    HOST_TEST_CHECK_EQ(__g_derate_last, __MIN_CURR);
+
+    /* 固定温度点的电流（单位0.01A） */
+    HOST_TEST_CHECK_EQ(__derate_curr(__DEG(80)), 2050);
+    HOST_TEST_CHECK_EQ(__derate_curr(__DEG(89)), 745);
+
+    /* 每周期降0.25℃ */
+    for (t = __DEG(95) - 64; t >= __DEG(25); t -= 64) {
+        __step(t);
+
+        /* 降额用温度为温度加回差（不超过最高温度） */
+        expect = t + __DEG(__SOCKET_HYST);
+        if (expect > __DEG(95)) {
+            expect = __DEG(95);
+        }
+        if (t > __DEG(__SOCKET_TRIP - __SOCKET_HYST)) {
+            bad += (THERMAL_STATE_TRIP != p_chan->state);
+            HOST_TEST_CHECK_EQ(__g_err_nums, 1);
+        } else {
+            bad += (p_chan->derate_temp != expect);
+            bad += (__derate_curr(expect) != p_chan->limit);
+            bad += (p_chan->state != (p_chan->limit ? THERMAL_STATE_DERATE :
+                                                      THERMAL_STATE_NORMAL));
+            HOST_TEST_CHECK_EQ(__g_err_nums, 2);
+        }
+    }
+    HOST_TEST_CHECK_EQ(bad, 0);
+    HOST_TEST_CHECK_EQ(__g_err_last, 0);
+    HOST_TEST_CHECK_EQ(p_chan->state, THERMAL_STATE_NORMAL);
+    HOST_TEST_CHECK_EQ(__g_derate_last, 0);
+
+    /* 65℃（降额点减回差）以下才退出降额 */
+    __reset();
+    __hold(__DEG(75), THERMAL_ROR_NUMS);
+    HOST_TEST_CHECK_EQ(p_chan->state, THERMAL_STATE_DERATE);
+    __hold(__DEG(66), 1);
+    HOST_TEST_CHECK_EQ(p_chan->state, THERMAL_STATE_DERATE);
+    HOST_TEST_CHECK_EQ(__g_derate_last, __derate_curr(__DEG(71)));
+    __hold(__DEG(64), 1);
+    HOST_TEST_CHECK_EQ(p_chan->state, THERMAL_STATE_NORMAL);
+    HOST_TEST_CHECK_EQ(__g_derate_last, 0);
+}
+
+static void __test_spike (void)
+{
+    thermal_chan_t *p_chan = &__g_th.chan[1];
+    int             derates;
+    int             i;
+
+    __reset();
+    __hold(__DEG(30), THERMAL_ROR_NUMS);
+
+    /* 阶跃15℃： 30℃/min， 远低于降额点也按最小电流 */
+    __step(__DEG(45));
+    HOST_TEST_CHECK_EQ(p_chan->ror, __DEG(30));
+    HOST_TEST_CHECK_EQ(p_chan->state, THERMAL_STATE_ROR);
+    HOST_TEST_CHECK_EQ(__g_derate_nums, 1);
+    HOST_TEST_CHECK_EQ(__g_derate_last, __MIN_CURR);
+
+    /* 阶跃前的点移出历史窗口前保持最小电流， 不重复发布 */
+    for (i = 2; i < THERMAL_ROR_NUMS; i++) {
+        __step(__DEG(45));
+        HOST_TEST_CHECK_EQ(p_chan->state, THERMAL_STATE_ROR);
+    }
+    HOST_TEST_CHECK_EQ(__g_derate_nums, 1);
+
+    __step(__DEG(45));
+    HOST_TEST_CHECK_EQ(p_chan->ror, 0);
+    HOST_TEST_CHECK_EQ(p_chan->state, THERMAL_STATE_NORMAL);
+    HOST_TEST_CHECK_EQ(__g_derate_nums, 2);
+    HOST_TEST_CHECK_EQ(__g_derate_last, 0);
+    HOST_TEST_CHECK_EQ(__g_err_nums, 0);
+
+    /* 单点尖峰到跳闸点： 过温一次， 回落到跳闸点减回差以下即恢复 */
+    __step(__DEG(92));
+    HOST_TEST_CHECK_EQ(p_chan->state, THERMAL_STATE_TRIP);
+    HOST_TEST_CHECK_EQ(__g_err_nums, 1);
+    HOST_TEST_CHECK_EQ(__g_err_last, 1);
+    derates = __g_derate_nums;
+    __step(__DEG(45));
+    HOST_TEST_CHECK(THERMAL_STATE_TRIP != p_chan->state);
+    HOST_TEST_CHECK_EQ(__g_err_nums, 2);
+    HOST_TEST_CHECK_EQ(__g_err_last, 0);
+
+    /* 降额用温度按回差跟随， 尖峰后仍降额， 降到阶跃前的温度后恢复 */
+    HOST_TEST_CHECK_EQ(p_chan->derate_temp, __DEG(45 + __SOCKET_HYST));
+    HOST_TEST_CHECK(__g_derate_nums > derates);
+    __hold(__DEG(45), THERMAL_ROR_NUMS);
+    HOST_TEST_CHECK_EQ(p_chan->state, THERMAL_STATE_NORMAL);
+    HOST_TEST_CHECK_EQ(__g_derate_last, 0);
+}
+
+static void __test_ror_hyst (void)
+{
+    thermal_chan_t *p_chan = &__g_th.chan[1];
+    int32_t         t      = __DEG(30);
+    int             i;
+
+    /* 6℃/min（限值10℃/min）不进入 */
+    __reset();
+    __hold(t, THERMAL_ROR_NUMS);
+    for (i = 0; i < 20; i++) {
+        __step(t += 51);
+        HOST_TEST_CHECK_EQ(p_chan->state, THERMAL_STATE_NORMAL);
+    }
+
+    /* 12℃/min进入 */
+    __reset();
+    __hold(t = __DEG(30), THERMAL_ROR_NUMS);
+    for (i = 0; i < 20; i++) {
+        __step(t += 103);
+    }
+    HOST_TEST_CHECK(p_chan->ror > __DEG(__SOCKET_ROR));
+    HOST_TEST_CHECK_EQ(p_chan->state, THERMAL_STATE_ROR);
+    HOST_TEST_CHECK_EQ(__g_derate_last, __MIN_CURR);
+
+    /* 降到6℃/min（高于限值一半）保持 */
+    for (i = 0; i < 20; i++) {
+        __step(t += 51);
+        HOST_TEST_CHECK_EQ(p_chan->state, THERMAL_STATE_ROR);
+    }
+
+    /* 降到3℃/min退出 */
+    for (i = 0; i < 20; i++) {
+        __step(t += 25);
+    }
+    HOST_TEST_CHECK(p_chan->ror < __DEG(__SOCKET_ROR) / 2);
+    HOST_TEST_CHECK_EQ(p_chan->state, THERMAL_STATE_NORMAL);
+    HOST_TEST_CHECK_EQ(__g_derate_last, 0);
+    HOST_TEST_CHECK(t < __DEG(__SOCKET_DERATE));
+}
+
+int main (void)
+{
+    __test_ramp_cool();
+    __test_spike();
+    __test_ror_hyst();
+
+    HOST_TEST_CHECK_EQ(__g_temp_bad, 0);
+
+    return HOST_TEST_END("thermal");
+}
@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief ACP1000 ȫ
+ * \brief ACP1000 工程全局配置
  *
  * \internal
  * \par modification history:
@@ -25,96 +25,202 @@
 #include "aw_serial.h"
 
 /******************************************************************************
- *  汾
+ *  软件版本定义
  ******************************************************************************/
-#define ACP1000_VERSION_MAJOR  0  /* 汾 */
-#define ACP1000_VERSION_MINOR  9  /* ΰ汾 */
-#define ACP1000_VERSION_STRING "LPC1778 : V0.90" /* 汾ַ20ֽڣ*/
+#define ACP1000_VERSION_MAJOR  0  /* 主版本号 */
+#define ACP1000_VERSION_MINOR  9  /* 次版本号 */
+#define ACP1000_VERSION_STRING "LPC1778 : V0.90" /* 版本号字符串（必须少于20个字节）*/
 /******************************************************************************
- *  EEPROM洢(ڡawbl_hwconf_lpc17xx_eeprom.h)
+ *  EEPROM存储定义(真正定义在“awbl_hwconf_lpc17xx_eeprom.h”)
  ******************************************************************************/
-#define ACP1000_EEPROM_NAME   "lpc17_eeprom"  /* 洢 */
-#define ACP1000_EEPROM_PILE_ID            0   /* ׮IDƫ */
-#define ACP1000_EEPROM_HUB4G_ADDR         8   /* ַƫ */
-#define ACP1000_EEPROM_PRICE              9   /* ۵ַƫ */
-#define ACP1000_EEPROM_CHARGE_TOTAL       62  /* Ŀ */
-#define ACP1000_EEPROM_CHARGE_LAST        63  /* һγĿƫ */
-#define ACP1000_EEPROM_CHARGE_DAT_START   64  /* Ŀʼƫ */
-#define ACP1000_EEPROM_CHARGE_MAX_NUMS    90  /* 洢ĳĿ */
-#define ACP1000_EEPROM_CHARGE_SIZE        44  /* ÿĿֽ */
-#define ACP1000_EEPROM_CARD_KEY           8   /* 濨Կֽ */
+#define ACP1000_EEPROM_NAME   "lpc17_eeprom"  /* 存储器名称 */
+#define ACP1000_EEPROM_PILE_ID            0   /* 桩ID偏移 */
+#define ACP1000_EEPROM_HUB4G_ADDR         8   /* 集中器地址偏移 */
+#define ACP1000_EEPROM_PRICE              9   /* 电价地址偏移 */
+#define ACP1000_EEPROM_CHARGE_TOTAL       62  /* 充电总条目 */
+#define ACP1000_EEPROM_CHARGE_LAST        63  /* 最近一次充电总条目偏移 */
+#define ACP1000_EEPROM_CHARGE_DAT_START   64  /* 充电数据条目起始偏移 */
+#define ACP1000_EEPROM_CHARGE_MAX_NUMS    90  /* 最大允许存储的充电条目数 */
+#define ACP1000_EEPROM_CHARGE_SIZE        44  /* 每条充电条目字节数 */
+#define ACP1000_EEPROM_CARD_KEY           8   /* 保存卡密钥字节 */
 
-#define ACP1000_EEPROM_PILE_ID_SET        1   /* ׮ID */
-#define ACP1000_EEPROM_PILE_ID_GET        1   /* ׮IDȡ */
-#define ACP1000_EEPROM_PRICE_SET          1   /* ۸ */
-#define ACP1000_EEPROM_PRICE_GET          1   /* ۸ȡ */
-#define ACP1000_EEPROM_HUB4G_ADDR_SET     1   /* ַ */
-#define ACP1000_EEPROM_HUB4G_ADDR_GET     1   /* ַȡ */
-#define ACP1000_EEPROM_CHARGE_DAT_SET     1   /*  */
-#define ACP1000_EEPROM_CHARGE_DAT_GET     1   /* ݻȡ */
-/******************************************************************************
- *  ʱʱ䶨
- ******************************************************************************/
-#define ACP1000_WAIT_KEY_TIMEOUT 10000   /* ȴ·keyʱ䣬 ʱԤˢ־㣨λms */
-#define ACP1000_AUTH_TIMEOUT     10000   /* Ȩʱ䣬 ʱΪȨʧ λms */
-#define ACP1000_BILLING_TIMEOUT  10000   /* ·ʱ䣬 ʱ- */
-#define ACP1000_SCARM_TIMEOUT    30000   /* 쳣ʱʱ  */
-#define ACP1000_DUGS_ERR_TIMEOUT 10000   /* 󴮿ͨųʱʱ  */
-#define ACP1000_HUB4G_ERR_TIMEOUT 10000   /* ͨųʱʱ  */
-/******************************************************************************
- *  Դ
- ******************************************************************************/
-#define ACP1000_CARDREADER_COM   COM3 /*  */
-#define ACP1000_DBUGS_COM        COM2 /*  */
-#define ACP1000_AMMETER_COM      COM1 /*  */
-#define ACP1000_HUB4G_COM        COM4 /*  */
-#define ACP1000_RTC_NUM          1     /* ʱRTC */
-#define ACP1000_PILE_MAX_CURR    35000 /* ׮ λ0.001A*/
-/******************************************************************************
- *  ԵԺ
- ******************************************************************************/
-#define ACP1000_CARD_VALID_DETECT     0  /* Ƿ⿨ǷЧ ʹ  0 (ǵʱ1)*/
-#define ACP1000_CARD_AMOUNT_ADD       0  /* ǷµһʱԶʼ ã*/
-#define ACP1000_ENERGY_AUTO_ADD       0  /* ʱʹõǷԶӣã*/
-#define ACP1000_ERR_INFO_PRINT        0  /* Ƿӡ쳣Ϣ */
-/******************************************************************************
- *  쳣 ӦģʱģԳҵûӰ죩
+#define ACP1000_EEPROM_PILE_ID_SET        1   /* 开启桩ID设置 */
+#define ACP1000_EEPROM_PILE_ID_GET        1   /* 开启桩ID获取 */
+#define ACP1000_EEPROM_PRICE_SET          1   /* 价格设置 */
+#define ACP1000_EEPROM_PRICE_GET          1   /* 价格获取 */
+#define ACP1000_EEPROM_HUB4G_ADDR_SET     1   /* 开启集中器地址设置 */
+#define ACP1000_EEPROM_HUB4G_ADDR_GET     1   /* 开启集中器地址获取 */
+#define ACP1000_EEPROM_CHARGE_DAT_SET     1   /* 开启充电数据设置 */
+#define ACP1000_EEPROM_CHARGE_DAT_GET     1   /* 开启充电数据获取 */
+/******************************************************************************
+ *  超时时间定义
+ ******************************************************************************/
+#define ACP1000_WAIT_KEY_TIMEOUT 10000   /* 最大等待集中器下发key的时间， 超时不做其他处理，并将预刷卡标志清零（单位ms） */
+#define ACP1000_AUTH_TIMEOUT     10000   /* 最大鉴权时间， 超时认为鉴权失败 （单位ms） */
+#define ACP1000_BILLING_TIMEOUT  10000   /* 最大结算余额下发时间， 若超时- */
+#define ACP1000_SCARM_TIMEOUT    30000   /* 紧急开关异常延时时间  */
+#define ACP1000_DUGS_ERR_TIMEOUT 10000   /* 最大串口屏通信超时时间  */
+#define ACP1000_HUB4G_ERR_TIMEOUT 10000   /* 最大集中器通信超时时间  */
+/******************************************************************************
+ *  串口资源分配
+ ******************************************************************************/
+#define ACP1000_CARDREADER_COM   COM3 /* 读卡器串口 */
+#define ACP1000_DBUGS_COM        COM2 /* 串口屏串口 */
+#define ACP1000_AMMETER_COM      COM1 /* 电表串口 */
+#define ACP1000_HUB4G_COM        COM4 /* 集中器串口 */
+#define ACP1000_RTC_NUM          1     /* 计时的RTC编号 */
+#define ACP1000_PILE_MAX_CURR    35000 /* 桩输出的最大电流 单位0.001A*/
+/******************************************************************************
+ *  负荷管理（集中器通过遥调寄存器动态分配每个桩的充电电流）
+ ******************************************************************************/
+#define ACP1000_LOAD_MANAGE           1      /* 是否使能负荷管理  1： 使能  0： 禁能 */
+#define ACP1000_LOAD_DEFAULT_EN       0      /* 上电后是否默认进入负荷管理模式 */
+#define ACP1000_LOAD_MIN_CURR         600    /* 最小充电电流 单位0.01A（国标最小6A）*/
+#define ACP1000_LOAD_FAILSAFE_CURR    1000   /* 与集中器失联后的安全电流 单位0.01A */
+#define ACP1000_LOAD_RAMP_RATE        200    /* 电流上升速率 单位0.01A/s， 0：不限制 */
+#define ACP1000_LOAD_LINK_TIMEOUT     30000  /* 集中器未刷新分配电流的最大时间，超时认为失联（ms）*/
+/******************************************************************************
+ *  智能充电规划（按分时电价及用户离开时间安排充电电流）
+ ******************************************************************************/
+#define ACP1000_SCHED_CHARGE          1      /* 是否使能智能充电规划  1： 使能  0： 禁能 */
+#define ACP1000_SCHED_NOMINAL_VOL     2200   /* 电表未测得电压时规划使用的电压， 单位0.1V */
+#define ACP1000_SCHED_CURR_DEV        200    /* 车辆实际电流低于下发电流超过该值时按实际电流重新规划， 单位0.01A */
+/******************************************************************************
+ *  离线卡名单（本地鉴权， 无需等待集中器应答）
+ ******************************************************************************/
+#define ACP1000_CARD_WL               1      /* 是否使能离线卡名单  1： 使能  0： 禁能 */
+#define ACP1000_CARD_WL_MAX           384    /* 名单最多的卡数（含已撤销的卡） */
+#define ACP1000_CARD_WL_HASH_SIZE     512    /* 哈希索引大小， 必须为2的幂且大于名单卡数 */
+#define ACP1000_CARD_WL_PEND_NUMS     32     /* 等待写入Flash的名单记录数 */
+#define ACP1000_CARD_WL_OFFLINE_ALLOW 0      /* 集中器通信异常时名单外的卡  1： 允许充电  0： 鉴权失败 */
+/******************************************************************************
+ *  读卡器自动检测（读卡模块自行寻卡并主动上报， 空闲时无需轮询）
+ ******************************************************************************/
+#define ACP1000_CARD_AUTO_DETECT      1      /* 是否使用读卡模块自动检测模式  1： 使能  0： 定时轮询 */
+#define ACP1000_CARD_AUTO_WAIT        5000   /* 单次等待上报的时间， 超时后检查读卡器通信， 单位ms */
+/******************************************************************************
+ *  卡密钥存储加密（以MCU UID为密钥， 旧DES格式上电后自动迁移）
+ ******************************************************************************/
+#define ACP1000_CARD_KEY_CIPHER       1      /* 加密方式  0： DES（旧格式）  1： AES-128-CTR  2： AES-128-CBC */
+/******************************************************************************
+ *  温度采样滤波（每周期采集一块， 中值去尖峰后一阶IIR低通）
+ ******************************************************************************/
+#define ACP1000_TEMP_ADC_SAMPLES      32     /* 每块采样个数（不小于10） */
+#define ACP1000_TEMP_ADC_RATE         1600   /* 采样率（次/秒）， 一块约覆盖1个工频周期， 0：驱动默认 */
+#define ACP1000_TEMP_IIR_SHIFT        2      /* IIR系数 1/2^n （不小于1）， 温度每2s更新 */
+#define ACP1000_TEMP_LUT              2      /* 码值转温度  0： 计算阻值后二分查表  1： 整表（8KB）  2： 16步压缩表插值（514B） */
+/******************************************************************************
+ *  多通道温度监测（测温点配置在pile_temp_task.c）
+ ******************************************************************************/
+#define ACP1000_THERMAL_CHANS         2      /* 测温点个数， 0号为环境温度 */
+#define ACP1000_THERMAL_PERIOD        2000   /* 采样周期（ms） */
+#define ACP1000_THERMAL_DERATE        1      /* 过温前是否通过CP降额  1： 使能  0： 禁能 */
+#define ACP1000_THERMAL_CURR_STEP     100    /* 降额电流变化超过该值才下发， 单位0.01A */
+#define ACP1000_THERMAL_PUB_DELTA     1      /* 环境温度变化超过该值才发布， 单位℃ */
+/******************************************************************************
+ *  周期遥测按变化发布（电表、计费、环境温度）
+ ******************************************************************************/
+#define ACP1000_PUB_ON_CHANGE         1      /* 1： 变化达到死区或保活到期才广播  0： 每周期广播 */
+#define ACP1000_PUB_AMMETER_KEEP      10000  /* 电表数据保活周期（ms） */
+#define ACP1000_PUB_AMMETER_VOL_DB    5      /* 电压死区， 单位0.1V */
+#define ACP1000_PUB_AMMETER_CURR_DB   100    /* 电流死区， 单位0.001A */
+#define ACP1000_PUB_BILLING_KEEP      5000   /* 计费数据保活周期（ms） */
+#define ACP1000_PUB_TEMP_KEEP         60000  /* 环境温度保活周期（ms） */
+/******************************************************************************
+ *  串口屏读寄存器变化跟踪（状态块地址0x1100， 见aw_mb_dgus_regmap.h）
+ ******************************************************************************/
+#define ACP1000_DGUS_DIRTY            1      /* 1： 解锁时提交修改， 读寄存器拷贝大端镜像  0： 每次读取时转换 */
+#define ACP1000_DGUS_COMM_KICK        1000   /* 通信正常后重启超时检测的最小间隔（ms） */
+/******************************************************************************
+ *  指示灯及蜂鸣器模式引擎（按步骤单次定时， 模式定义在indicator.c）
+ ******************************************************************************/
+#define ACP1000_INDICATOR             1      /* 1： 定时器驱动  0： 由LED任务及蜂鸣器延时工作驱动 */
+#define ACP1000_IND_BEEP_PWM          8      /* 蜂鸣器PWM编号（PWM1.2， P2.1） */
+#define ACP1000_IND_BEEP_PERIOD       1000000 /* 蜂鸣器音调周期（ns）， PWM1各通道共用周期， 须与CP PWM相同 */
+/******************************************************************************
+ *  交流接触器反馈监测（DI_AC1边沿中断， 见contactor.c）
+ ******************************************************************************/
+#define ACP1000_CONTACTOR_MON         1      /* 1： 边沿触发监测  0： LED任务每秒轮询（受ACP1000_AC1_ERR_DETECT控制） */
+#define ACP1000_CONTACTOR_CONFIRM_MS  30     /* 反馈确认窗口（ms）， 需大于触点抖动时间 */
+#define ACP1000_CONTACTOR_ACT_MS      1000   /* 动作超时（ms）， 母排电磁继电器一般为0.3-0.5s */
+/******************************************************************************
+ *  周期作业调度（充电控制、 CP检测、 急停防雷检测、 指示灯监控共用一个任务， 见periodic.c）
+ ******************************************************************************/
+#define ACP1000_PERIODIC              1      /* 1： 共用调度任务  0： 各自独立任务 */
+#define ACP1000_PERIODIC_TICK_MS      15     /* 调度时隙（ms）， 作业周期和相位按其取整 */
+/******************************************************************************
+ *  运行耗时统计（事件分发、 EEPROM/Flash写入， 见perf_stat.c）
+ ******************************************************************************/
+#define ACP1000_PERF_STAT             1      /* 是否使能耗时统计  1： 使能  0： 禁能 */
+/******************************************************************************
+ *  任务运行剖析（各任务CPU占用、 单次最长运行时间、 堆栈高水位， 见task_prof.c）
+ ******************************************************************************/
+#define ACP1000_TASK_PROF             1      /* 是否使能任务剖析  1： 使能  0： 禁能 */
+#define ACP1000_TASK_PROF_MB          1      /* 是否在遥测寄存器（2100起）上送剖析结果， 需使能ACP1000_HUB4G_TASK */
+/******************************************************************************
+ *  关键路径延迟直方图（CP到角色切换、 急停到接触器断开、 刷卡鉴权、 Modbus、 计费上送， 见lat_hist.c）
+ ******************************************************************************/
+#define ACP1000_LAT_HIST              1      /* 是否使能延迟直方图  1： 使能  0： 禁能 */
+#define ACP1000_LAT_HIST_MB           1      /* 是否在遥测寄存器（2300起）上送直方图， 需使能ACP1000_HUB4G_TASK */
+/******************************************************************************
+ *  任务心跳监视（各周期性任务按期限心跳， 全部正常时才喂看门狗， 见task_wdt.c）
+ ******************************************************************************/
+#define ACP1000_TASK_WDT              1      /* 是否使能任务心跳监视  1： 使能  0： 禁能 */
+/******************************************************************************
+ *  黑匣子（硬件异常、 心跳超时、 热复位前的现场， 上电后写入SPI Flash， 见blackbox.c）
+ ******************************************************************************/
+#define ACP1000_BLACKBOX              1      /* 是否使能黑匣子  1： 使能  0： 禁能 */
+#define ACP1000_BLACKBOX_MB           1      /* 是否在遥测寄存器（2500起）上送最新记录， 需使能ACP1000_HUB4G_TASK */
+/******************************************************************************
+ *  延迟格式化日志（调用处只记录格式串和参数， 由低优先级任务输出， 见slog.c）
+ ******************************************************************************/
+#define ACP1000_SLOG                  1      /* 是否使能延迟格式化日志  1： 使能  0： 禁能（直接输出） */
+#define ACP1000_SLOG_LEVEL            2      /* 各模块的默认级别  0： 关闭  1： 错误  2： 警告  3： 信息  4： 调试 */
+/******************************************************************************
+ *  测试调试宏
+ ******************************************************************************/
+#define ACP1000_CARD_VALID_DETECT     0  /* 是否检测卡是否有效： 使能  0： 禁能(非调试时置1)*/
+#define ACP1000_CARD_AMOUNT_ADD       0  /* 是否新的一张时，自动初始化余额 （调试用）*/
+#define ACP1000_ENERGY_AUTO_ADD       0  /* 充电时使用电量是否自动增加（调试用）*/
+#define ACP1000_ERR_INFO_PRINT        0  /* 是否打印异常信息 */
+/******************************************************************************
+ *  异常检测 （对应模块禁能时，模块对充电业务流程没有影响）
  ******************************************************************************/
 
-#define ACP1000_AMMETER_ERR_DETECT    1  /* Ƿʹܵģ쳣, 1 ʹ  0  */
-#define ACP1000_CURR_ERR_DETECT       1  /* Ƿʹܵģ쳣, 1 ʹ  0  */
-#define ACP1000_VOL_ERR_DETECT        1  /* Ƿʹܵѹģ쳣, 1 ʹ  0  */
-#define ACP1000_CARD_ERR_DETECT       0  /* Ƿʹܶģ쳣, 1 ʹ  0  */
-#define ACP1000_AC1_ERR_DETECT        1  /* Ƿʹܽĸż  1 ʹ  0 */
-#define ACP1000_LIGHT_ERR_DETECT      1  /* Ƿʹܷ쳣  1 ʹ  0 */
-#define ACP1000_TEMP_ERR_DETECT       1  /* Ƿʹ¶쳣  1 ʹ  0 */
-#define ACP1000_DUGS_ERR_DETECT       0  /* Ƿʹܴͨ쳣  1 ʹ  0 */
-#define ACP1000_HUB4G_ERR_DETECT      0  /* Ƿʹܼͨ쳣  1 ʹ  0 */
+#define ACP1000_AMMETER_ERR_DETECT    1  /* 是否使能电表模块异常检测, 1： 使能  0： 禁能 */
+#define ACP1000_CURR_ERR_DETECT       1  /* 是否使能电流模块异常检测, 1： 使能  0： 禁能 */
+#define ACP1000_VOL_ERR_DETECT        1  /* 是否使能电压模块异常检测, 1： 使能  0： 禁能 */
+#define ACP1000_CARD_ERR_DETECT       0  /* 是否使能读卡模块异常检测, 1： 使能  0： 禁能 */
+#define ACP1000_AC1_ERR_DETECT        1  /* 是否使能交流母排检测  1： 使能  0： 禁能*/
+#define ACP1000_LIGHT_ERR_DETECT      1  /* 是否使能防雷器异常检测  1： 使能  0： 禁能*/
+#define ACP1000_TEMP_ERR_DETECT       1  /* 是否使能温度异常检测  1： 使能  0： 禁能*/
+#define ACP1000_DUGS_ERR_DETECT       0  /* 是否使能串口屏通信异常检测  1： 使能  0： 禁能*/
+#define ACP1000_HUB4G_ERR_DETECT      0  /* 是否使能集中器通信异常检测  1： 使能  0： 禁能*/
 
-#define ACP1000_HUB4G_AUTH            0  /* ǷȨ 1 ʹ  0 */
-#define ACP1000_HUB4G_BILLING         0  /* Ƿ񰴼 1 ʹ  0 */
-#define ACP1000_OVERTIME_DETECT       0  /* ǷȨ޲  1 ʹ  0 */
-#define ACP1000_SCRAM_DETECT          1  /* Ƿؼ  1 ʹ  0 */
-#define ACP1000_VTP1_DETECT           1  /* ǷVTP1ѹ  1 ʹ  0 */
-#define ACP1000_CARD_DETECT           0  /* ǷʹܿƬ 1 ʹ  0 */
-#define ACP1000_BILING_MONITOR        0  /* ƷѵԪǷƳ  1 ʹ  0   */
-#define ACP1000_SKIP_AUTH             1  /* ߼ǷԼȨʵֲǹ  1 ʹ  0   */
-/******************************************************************************
- *  
- ******************************************************************************/
-#define ACP1000_VOL_TASK                 1  /* Ƿʹܵѹ쳣  1 ʹ  0 ܣ룩*/
-#define ACP1000_INLOCK_TASK              0  /* Ƿʹǹλ  1 ʹ  0 ܣѡ*/
-#define ACP1000_LEDLOCK_TASK             1  /* ǷLED  ѡ*/
-#define ACP1000_HUB4G_TASK               1  /* Ƿ 룩*/
-#define ACP1000_DUGS_TASK                0  /* Ƿ񣨳ҵѡ */
-#define ACP1000_CARD_DETECT_TASK         0  /* ǷƬ ҵѡ*/
-#define ACP1000_VTP1_DETECT_TASK         1  /* ǷVTP1ѹ񣨱룩 */
-#define ACP1000_CURR_DETECT_TASK         1  /* Ƿ񣨷ѡ */
-#define ACP1000_PILE_ERR_DETECT_TASK     1  /* Ƿ׮쳣񣨷룩 */
-#define ACP1000_BUZZER_TASK              1  /* Ƿ ѡ*/
-#define ACP1000_PILE_TEMP_TASK           1  /* Ƿ׮¶ȼ ѡ*/
-#define ACP1000_AMMETER_DETECT_TASK      1  /* Ƿȡ񣨼Ʒѱ룩 */
-#define ACP1000_BILING_DETECT_TASK       0  /* ǷƷ񣨳ҵ룩 */
-#define ACP1000_CHARGE_TASK              1  /* Ƿ  룩*/
-#define ACP1000_DUBUG_SHELL_TASK         1  /* ǷʹܲԿ  Կѡ*/
+#define ACP1000_HUB4G_AUTH            0  /* 是否开启集中器鉴权 1： 使能  0： 禁能*/
+#define ACP1000_HUB4G_BILLING         0  /* 是否按集中器结算 1： 使能  0： 禁能*/
+#define ACP1000_OVERTIME_DETECT       0  /* 是否鉴权后无操作检测  1： 使能  0： 禁能*/
+#define ACP1000_SCRAM_DETECT          1  /* 是否紧急开关检测  1： 使能  0： 禁能*/
+#define ACP1000_VTP1_DETECT           1  /* 是否VTP1电压检测  1： 使能  0： 禁能*/
+#define ACP1000_CARD_DETECT           0  /* 是否使能卡片检测 1： 使能  0： 禁能*/
+#define ACP1000_BILING_MONITOR        0  /* 计费单元是否限制充电  1： 使能  0： 禁能  */
+#define ACP1000_SKIP_AUTH             1  /* 充电逻辑是否忽略鉴权，实现插枪即充  1： 使能  0： 禁能  */
+/******************************************************************************
+ *  任务控制
+ ******************************************************************************/
+#define ACP1000_VOL_TASK                 1  /* 是否使能电压异常检测  1： 使能  0： 禁能（必须）*/
+#define ACP1000_INLOCK_TASK              0  /* 是否使能枪在位检测  1： 使能  0： 禁能（可选）*/
+#define ACP1000_LEDLOCK_TASK             1  /* 是否启动LED和锁检测任务  （可选）*/
+#define ACP1000_HUB4G_TASK               1  /* 是否启动集中器任务 （升级必须）*/
+#define ACP1000_DUGS_TASK                0  /* 是否启动串口屏任务（充电业务可选） */
+#define ACP1000_CARD_DETECT_TASK         0  /* 是否卡片检测任务 （充电业务可选）*/
+#define ACP1000_VTP1_DETECT_TASK         1  /* 是否VTP1电压检测任务（必须） */
+#define ACP1000_CURR_DETECT_TASK         1  /* 是否启动电流检测任务（防护可选） */
+#define ACP1000_PILE_ERR_DETECT_TASK     1  /* 是否启动桩异常检测任务（防护必须） */
+#define ACP1000_BUZZER_TASK              1  /* 是否启动蜂鸣器任务 （可选）*/
+#define ACP1000_PILE_TEMP_TASK           1  /* 是否启动桩温度检测任务 （防护可选）*/
+#define ACP1000_AMMETER_DETECT_TASK      1  /* 是否电表读取任务（计费必须） */
+#define ACP1000_BILING_DETECT_TASK       0  /* 是否启动计费任务（充电业务必须） */
+#define ACP1000_CHARGE_TASK              1  /* 是否启动充电任务  （必须）*/
+#define ACP1000_DUBUG_SHELL_TASK         1  /* 是否使能测试壳  （调试可选）*/
 #endif
@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief ACP1000 ӿʵ
+ * \brief ACP1000 数字输入检测接口实现
  *
  * \internal
  * \par modification history:
@@ -26,23 +26,26 @@
 #include "ac_charge_prj_cfg.h"
 #include "aw_delay.h"
 #include "charger.h"
+#include "periodic.h"
+#include "lat_hist.h"
+#include "task_wdt.h"
+#include "slog.h"
 
 #define TP1_VOL_DETECT_TASK_PRIO    1
 #define TP1_VOL_DETECT_TACK_SIZE    (1024)
-AW_TASK_DECL_STATIC(tp1_vol_detect_task, TP1_VOL_DETECT_TACK_SIZE);
 
-#define TP1_DETECT_PERIOD_MS   15  /* TP1  , λms*/
-#define TP1_DETECT_SKIP_MS     25  /* TP1 , λms*/
+#define TP1_DETECT_PERIOD_MS   15  /* TP1 检测周期 , 单位ms*/
+#define TP1_DETECT_SKIP_MS     25  /* TP1 消抖检测, 单位ms*/
 
 uint32_t skip_time = 4;
 
 /**
- * \brief ȡ1ĵѹ
- * \param[in] p_acp1000:  ʵ
- * \return    1ĵѹֵ¿ܣ
- *            - 12 : Ϊ12V
- *            - 9  : Ϊ9V
- *            - 6  : Ϊ6V
+ * \brief 获取检测点1的电压
+ * \param[in] p_acp1000:  交流充电机实例
+ * \return    检测点1的电压值，有如下可能：
+ *            - 12 : 检测点为12V
+ *            - 9  : 检测点为9V
+ *            - 6  : 检测点为6V
  */
 aw_local uint32_t acp1000_tp1_raw_vol_get ()
 {
@@ -55,7 +58,7 @@ aw_local uint32_t acp1000_tp1_raw_vol_get ()
     vol[1] = aw_gpio_get(ACP1000_DIN_CP_C1);
     vol[2] = aw_gpio_get(ACP1000_DIN_CP_C2);
 
-//    AW_INFOF(("CP0 = %d\r\nCP1 = %d\r\nCP2 = %d\r\n", vol[0], vol[1], vol[2]));
+    SLOG(SLOG_MOD_CP, SLOG_DBG, "CP0 = %d CP1 = %d CP2 = %d", vol[0], vol[1], vol[2]);
 
     if ((vol[0] == 0) && (vol[1] == 1) && (vol[2] == 1)) {
         tp1_vol  = 12;
@@ -72,96 +75,121 @@ aw_local uint32_t acp1000_tp1_raw_vol_get ()
     } else {
         err_cnt++;
         if (err_cnt > skip_time) {
-            tp1_vol = 0; /* Ϊ12Vд */
+            tp1_vol = 0; /* 检测出错认为是12V，并进行错误处理 */
             last_vol = tp1_vol;
         }
-        /*   */
+        /* 错误  */
     }
 
-//    AW_INFOF(("Vtp1 = %dV\r\n", tp1_vol));
+    SLOG(SLOG_MOD_CP, SLOG_DBG, "Vtp1 = %dV", last_vol);
     return last_vol;
 }
 
+#define __TP1_VOL_DETECT_GET  0  /* 获取电压值 */
+#define __TP1_VOL_DETECT_SURE 1  /* 确认  */
+
 /**
- * ѹ
+ * 检测电压（每个检测周期执行一次， 电压变化后隔防抖时间再确认， 不阻塞）
  */
-aw_local void charger_tp1_vol_detect_task (void *p_arg)
+aw_local void charger_tp1_vol_detect_job (void *p_arg)
 {
-#define __TP1_VOL_DETECT_GET  0  /* ȡѹֵ */
-#define __TP1_VOL_DETECT_SURE 1  /* ȷ  */
-
     charger_t *p_this = (charger_t *)p_arg;
-    uint8_t    state        = __TP1_VOL_DETECT_GET;
+    static uint8_t state    = __TP1_VOL_DETECT_GET;
+    static uint8_t last_vol = 0;
+    static uint8_t skip     = 0;   /* 确认前剩余的检测周期数 */
+    uint8_t        now_vol;
+
+    switch (state) {
+
+    case __TP1_VOL_DETECT_GET:
+        now_vol = acp1000_tp1_raw_vol_get();
+        if (last_vol != now_vol) {
+            LAT_HIST_START(LAT_HIST_CP_ROLE);
+            state = __TP1_VOL_DETECT_SURE;
+            skip  = (TP1_DETECT_SKIP_MS + TP1_DETECT_PERIOD_MS - 1) / TP1_DETECT_PERIOD_MS;
+        }
+        break;
+
+    case __TP1_VOL_DETECT_SURE:
+        if ((skip > 0) && (--skip > 0)) {
+            break;                          /* 防抖延时 */
+        }
+        now_vol = acp1000_tp1_raw_vol_get();
+        state   = __TP1_VOL_DETECT_GET;
+        if (last_vol == now_vol) {
+            LAT_HIST_CANCEL(LAT_HIST_CP_ROLE);  /* 干扰， 防抖未确认 */
+        } else {
+            SLOG(SLOG_MOD_CP, SLOG_INFO, "Vtp1 %dV -> %dV", last_vol, now_vol);
+            last_vol = now_vol;
+#if ACP1000_VTP1_DETECT
+            charger_dev_lock(p_this);
+            p_this->dat.tp1_vol = now_vol;
+            charger_dev_unlock(p_this);
+#endif
+        }
+        break;
 
-    uint8_t now_vol, last_vol;
-    static  int cnt = 0;
+    default: break;
+    }
+}
 
+#if ACP1000_PERIODIC
+static periodic_job_t __g_tp1_vol_detect_job;
+#else
+AW_TASK_DECL_STATIC(tp1_vol_detect_task, TP1_VOL_DETECT_TACK_SIZE);
+TASK_WDT_DECL(__g_tp1_wdt);
 
-    if (NULL == p_this) {
+/**
+ * 检测电压任务
+ */
+aw_local void charger_tp1_vol_detect_task (void *p_arg)
+{
+    if (NULL == p_arg) {
         return ;
     }
-    last_vol = 0;
 
     while  (1) {
-        cnt--;
-        if (cnt <= 0) {
-            cnt = 0;
-        }
-
-        switch (state) {
-
-        case __TP1_VOL_DETECT_GET:
-            now_vol = acp1000_tp1_raw_vol_get();
-            if (last_vol != now_vol) {
-                state = __TP1_VOL_DETECT_SURE;
-                aw_mdelay(TP1_DETECT_SKIP_MS); /* ʱ */
-            } else {
-                break;
-            }
-
-        case __TP1_VOL_DETECT_SURE:
-            now_vol = acp1000_tp1_raw_vol_get();
-            if (last_vol != now_vol) {
-                last_vol = now_vol;
-                state = __TP1_VOL_DETECT_GET;
-#if ACP1000_VTP1_DETECT
-                charger_dev_lock(p_this);
-                p_this->dat.tp1_vol = now_vol;
-                charger_dev_unlock(p_this);
-#endif
-            }
-            break;
-
-        default: break;
-        }
-        aw_mdelay(TP1_DETECT_PERIOD_MS); /* ʱ */
+        TASK_WDT_BEAT(__g_tp1_wdt);
+        charger_tp1_vol_detect_job(p_arg);
+        aw_mdelay(TP1_DETECT_PERIOD_MS); /* 检测延时 */
     }
 }
+#endif
 
 /**
- * \brief TP1 ѹ
- * \param[in] p_this : ʵ
+ * \brief 启动TP1 电压检测任务
+ * \param[in] p_this : 充电机实例
  */
 void acp1000_tp1_vol_detect_task_startup (charger_t *p_this)
 {
-
-    /* ʼled_task */
-    AW_TASK_INIT(tp1_vol_detect_task,              /* ʵ */
-                 "Vtp1_detect_task",               /*  */
-                 TP1_VOL_DETECT_TASK_PRIO,         /* ȼ */
-                 TP1_VOL_DETECT_TACK_SIZE,         /* ջС */
-                 charger_tp1_vol_detect_task,      /* ں */
-                 (void *)p_this);    /* ڲ */
-    /*  */
+#if ACP1000_PERIODIC
+    periodic_job_init(&__g_tp1_vol_detect_job,
+                      "Vtp1",
+                      charger_tp1_vol_detect_job,
+                      (void *)p_this,
+                      TP1_DETECT_PERIOD_MS,
+                      0,
+                      TP1_VOL_DETECT_TACK_SIZE);
+    periodic_job_add(&__g_tp1_vol_detect_job);
+#else
+    TASK_WDT_ADD(__g_tp1_wdt, "Vtp1_detect_task", TP1_DETECT_PERIOD_MS + TASK_WDT_SLACK_MS);
+    /* 初始化任务led_task */
+    AW_TASK_INIT(tp1_vol_detect_task,              /* 任务实体 */
+                 "Vtp1_detect_task",               /* 任务名字 */
+                 TP1_VOL_DETECT_TASK_PRIO,         /* 任务优先级 */
+                 TP1_VOL_DETECT_TACK_SIZE,         /* 任务堆栈大小 */
+                 charger_tp1_vol_detect_task,      /* 任务入口函数 */
+                 (void *)p_this);    /* 任务入口参数 */
+    /* 启动任务 */
     AW_TASK_STARTUP(tp1_vol_detect_task);
-
+#endif
 
 }
 
 /**
- * \brief ʼ
- * \return AW_OK : ʼɹ
- * \return AW_ERR: ʼʧ
+ * \brief 初始化数字输入引脚
+ * \return AW_OK : 初始化成功
+ * \return AW_ERR: 初始化失败
  */
 aw_err_t acp1000_din_init (void)
 {
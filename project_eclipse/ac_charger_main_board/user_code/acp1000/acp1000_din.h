@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief ACP1000 ӿ
+ * \brief ACP1000 数字输入检测接口声明
  *
  * \internal
  * \par modification history:
@@ -27,8 +27,8 @@
 #define ACP1000_DIN_SCREEM    PIO0_3  /* DI_SCREEM */
 #define ACP1000_DIN_LIGHT     PIO0_2  /* DI_LIGHT */
 #define ACP1000_DIN_AC1       PIO3_1  /* DI_AC1 */
-#define ACP1000_DIN_INGUN     PIO5_4  /* DI_INLOCK ǹ ǹλ */
-#define ACP1000_DIN_INLOCK    PIO3_2  /* DI_INLOCK2  */
+#define ACP1000_DIN_INGUN     PIO5_4  /* DI_INLOCK 内置枪套锁 枪在位检测 */
+#define ACP1000_DIN_INLOCK    PIO3_2  /* DI_INLOCK2 锁检测 */
 #define ACP1000_DIN_CP_C0     PIO1_22 /* DI_CP_C0 12V */
 #define ACP1000_DIN_CP_C1     PIO1_21 /* DI_CP_C1 9V */
 #define ACP1000_DIN_CP_C2     PIO1_20 /* DI_CP_C2 6V */
@@ -37,15 +37,15 @@
 
 
 /**
- * \brief ʼ
- * \return AW_OK : ʼɹ
- * \return AW_ERR: ʼʧ
+ * \brief 初始化数字输入引脚
+ * \return AW_OK : 初始化成功
+ * \return AW_ERR: 初始化失败
  */
 aw_err_t acp1000_din_init (void);
 
 /**
- * \brief TP1 ѹ
- * \param[in] p_acp1000_work_state : ״̬ʵ
+ * \brief 启动TP1 电压检测任务
+ * \param[in] p_acp1000_work_state : 充电机状态实例
  */
 void acp1000_tp1_vol_detect_task_startup (charger_t *p_this);
 #endif /* __ACP1000_DIN_H */
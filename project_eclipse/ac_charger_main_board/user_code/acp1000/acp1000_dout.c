@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief ACP1000 ӿʵ
+ * \brief ACP1000 数字输出检测接口实现
  *
  * \internal
  * \par modification history:
@@ -25,9 +25,9 @@
 #include "lpc177x_8x_pin.h"
 
 /**
- * \brief ʼ
- * \return AW_OK : ʼɹ
- * \return AW_ERR: ʼʧ
+ * \brief 初始化数字输出引脚
+ * \return AW_OK : 初始化成功
+ * \return AW_ERR: 初始化失败
  */
 aw_err_t acp1000_dout_init (void)
 {
@@ -52,13 +52,13 @@ aw_err_t acp1000_dout_init (void)
         am_gpio_pin_cfg(acp_dout[i], AM_GPIO_OUTPUT);
         aw_gpio_set(acp_dout[i], 0);
     }
-    aw_gpio_set(ACP1000_GREEN_LED,  1); /* ϵĬϳ̵ */
+    aw_gpio_set(ACP1000_GREEN_LED,  1); /* 上电默认常亮绿灯 */
     return AW_OK;
 }
 
 
 /**
- * LEDȵ״̬
+ * 设置LED等的状态
  */
 void acp1000_state_led_set(int state, bool_t is_charging)
 {
@@ -0,0 +1,166 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief ADC块采样及中值+IIR滤波
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-09-28  xjc, first implementation
+ * - 1.01 16-10-18  xjc, IIR状态按四舍五入更新， 输入下降时不再多1个码值
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include "string.h"
+#include "aw_adc.h"
+#include "aw_sem.h"
+#include "aw_system.h"
+#include "adc_sample.h"
+
+#define __MEAN_NUMS   10    /* 原算法的采样个数， 用于噪声对比 */
+
+#if (ACP1000_TEMP_ADC_SAMPLES < __MEAN_NUMS) || (ACP1000_TEMP_IIR_SHIFT < 1)
+#error "ACP1000_TEMP_ADC_SAMPLES must be >= 10 and ACP1000_TEMP_IIR_SHIFT >= 1"
+#endif
+
+/**
+ * 驱动回调（中断级）， 只记录结果并唤醒任务
+ */
+static void __adc_complete (void *p_arg, int state)
+{
+    adc_sample_t *p_this = (adc_sample_t *)p_arg;
+
+    p_this->state = state;
+    AW_SEMB_GIVE(p_this->done_sem);
+}
+
+/**
+ * 插入排序（块很小， 且排序后原地取中值）
+ */
+static void __sort (uint16_t *p_buf, uint32_t len)
+{
+    uint32_t i, j;
+    uint16_t v;
+
+    for (i = 1; i < len; i++) {
+        v = p_buf[i];
+        for (j = i; (j > 0) && (p_buf[j - 1] > v); j--) {
+            p_buf[j] = p_buf[j - 1];
+        }
+        p_buf[j] = v;
+    }
+}
+
+/**
+ * 原算法： 前10个采样求平均（用于噪声对比， 需在排序前调用）
+ */
+static uint16_t __mean_get (const uint16_t *p_buf)
+{
+    uint32_t sum = 0;
+    uint32_t i;
+
+    for (i = 0; i < __MEAN_NUMS; i++) {
+        sum += p_buf[i];
+    }
+    return sum / __MEAN_NUMS;
+}
+
+static void __stat_update (adc_sample_stat_t *p_stat,
+                           uint16_t           mean,
+                           uint16_t           median,
+                           uint16_t           filtered)
+{
+    uint32_t i = p_stat->cycles % ADC_SAMPLE_HIST_NUM;
+
+    p_stat->mean         = mean;
+    p_stat->median       = median;
+    p_stat->filtered     = filtered;
+    p_stat->mean_hist[i] = mean;
+    p_stat->filt_hist[i] = filtered;
+    p_stat->cycles++;
+}
+
+/******************************************************************************/
+aw_err_t adc_sample_init (adc_sample_t *p_this, aw_adc_channel_t ch, uint32_t rate)
+{
+    aw_err_t ret;
+
+    memset(p_this, 0, sizeof(*p_this));
+    AW_SEMB_INIT(p_this->done_sem, AW_SEM_EMPTY, AW_SEM_Q_PRIORITY);
+
+    if (rate) {
+        /* 采样率只影响一块数据覆盖的时间窗口， 设置失败仍可使用 */
+        aw_adc_rate_set(ch, rate);
+    }
+
+    aw_adc_mkbufdesc(&p_this->desc,
+                     p_this->buf,
+                     ACP1000_TEMP_ADC_SAMPLES,
+                     __adc_complete,
+                     (void *)p_this);
+
+    ret = aw_adc_client_init(&p_this->client, ch, FALSE);
+    return ret;
+}
+
+aw_err_t adc_sample_get (adc_sample_t *p_this, uint16_t *p_code, uint32_t timeout)
+{
+    uint16_t mean;
+    uint16_t median;
+    aw_err_t ret;
+
+    AW_SEMB_TAKE(p_this->done_sem, AW_SEM_NO_WAIT);
+
+    /* 单次序列： 驱动采满一块后回调， 期间不占用任务 */
+    ret = aw_adc_client_start(&p_this->client, &p_this->desc, 1, 1);
+    if (AW_OK != ret) {
+        p_this->stat.errs++;
+        return ret;
+    }
+
+    ret = AW_SEMB_TAKE(p_this->done_sem, aw_ms_to_ticks(timeout));
+    if (AW_OK != ret) {
+        aw_adc_client_cancel(&p_this->client);
+        p_this->stat.errs++;
+        return ret;
+    }
+    if (AW_OK != p_this->state) {
+        p_this->stat.errs++;
+        return p_this->state;
+    }
+
+    mean = __mean_get(p_this->buf);
+    __sort(p_this->buf, ACP1000_TEMP_ADC_SAMPLES);
+    median = (p_this->buf[(ACP1000_TEMP_ADC_SAMPLES - 1) / 2] +
+              p_this->buf[ACP1000_TEMP_ADC_SAMPLES / 2]) / 2;
+    p_this->stat.raw_pp = p_this->buf[ACP1000_TEMP_ADC_SAMPLES - 1] - p_this->buf[0];
+
+    /**
+     * 一阶IIR： y += (x - y) / 2^k， 状态保留小数位
+     * y按四舍五入参与更新， 输入下降时才能收敛到x（截断时稳定在x + 1）
+     */
+    if (!p_this->iir_valid) {
+        p_this->iir       = (uint32_t)median << ACP1000_TEMP_IIR_SHIFT;
+        p_this->iir_valid = TRUE;
+    } else {
+        p_this->iir = p_this->iir -
+                      ((p_this->iir + (1 << (ACP1000_TEMP_IIR_SHIFT - 1))) >> ACP1000_TEMP_IIR_SHIFT) +
+                      median;
+    }
+    *p_code = (p_this->iir + (1 << (ACP1000_TEMP_IIR_SHIFT - 1))) >> ACP1000_TEMP_IIR_SHIFT;
+
+    __stat_update(&p_this->stat, mean, median, *p_code);
+
+    return AW_OK;
+}
@@ -0,0 +1,78 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief ADC块采样及中值+IIR滤波
+ *
+ * 每个周期由ADC驱动在中断中连续采集一块数据， 任务只在整块完成后被唤醒，
+ * 对整块取中值剔除接触器动作等引起的尖峰， 再经一阶IIR低通输出一个滤波值。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-09-28  xjc, first implementation
+ * \endinternal
+ */
+
+#ifndef __ADC_SAMPLE_H
+#define __ADC_SAMPLE_H
+
+#include "apollo.h"
+#include "aw_adc.h"
+#include "aw_sem.h"
+#include "ac_charge_prj_cfg.h"
+
+#define ADC_SAMPLE_HIST_NUM   16    /* 噪声统计的历史输出个数 */
+
+/**
+ * 采样统计（调试用， 单位均为ADC码值）
+ */
+typedef struct adc_sample_stat {
+    uint32_t cycles;                        /* 已完成的采样周期数 */
+    uint32_t errs;                          /* 采样失败次数 */
+    uint16_t raw_pp;                        /* 最近一块原始数据的峰峰值 */
+    uint16_t mean;                          /* 最近一块前10个采样的均值（原算法） */
+    uint16_t median;                        /* 最近一块的中值 */
+    uint16_t filtered;                      /* 最近一次滤波输出 */
+    uint16_t mean_hist[ADC_SAMPLE_HIST_NUM];    /* 原算法输出历史 */
+    uint16_t filt_hist[ADC_SAMPLE_HIST_NUM];    /* 滤波输出历史 */
+}adc_sample_stat_t;
+
+/**
+ * ADC块采样
+ */
+typedef struct adc_sample {
+    aw_adc_client_t     client;
+    aw_adc_buf_desc_t   desc;
+    uint16_t            buf[ACP1000_TEMP_ADC_SAMPLES];
+    AW_SEMB_DECL(done_sem);             /* 整块采样完成 */
+    volatile int        state;          /* 驱动回调的转换结果 */
+    uint32_t            iir;            /* IIR状态， 码值左移ACP1000_TEMP_IIR_SHIFT位 */
+    bool_t              iir_valid;      /* IIR是否已用首个中值初始化 */
+    adc_sample_stat_t   stat;
+}adc_sample_t;
+
+/**
+ * \brief 初始化块采样
+ * \param[in] ch   : ADC通道
+ * \param[in] rate : 采样率（每秒采样数）， 0为驱动默认
+ */
+aw_err_t adc_sample_init (adc_sample_t *p_this, aw_adc_channel_t ch, uint32_t rate);
+
+/**
+ * \brief 采集一块并返回滤波后的码值
+ * \param[out] p_code  : 滤波后的ADC码值
+ * \param[in]  timeout : 最长等待时间（ms）
+ */
+aw_err_t adc_sample_get (adc_sample_t *p_this, uint16_t *p_code, uint32_t timeout);
+
+#endif
@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief ʵ
+ * \brief 电表实例
  *
  * \internal
  * \par modification history:
@@ -29,6 +29,8 @@
 #include "ammeter.h"
 #include "ammeter/aw_ammeter.h"
 #include "ac_charge_prj_cfg.h"
+#include "task_wdt.h"
+#include "slog.h"
 
 #define VOL_TO_AMMETER(p_this, pp_role) \
     struct ammeter *p_this = AW_CONTAINER_OF(pp_role, struct ammeter, p_ammeter_vol)
@@ -41,26 +43,33 @@
     struct ammeter *p_this = AW_CONTAINER_OF(p_evt, struct ammeter, evt_node)
 
 static void event_driver(struct event_node *p_evt, event_t event, void *p_arg);
-static role_ret play(role_t **pp_role, void *p_arg);  /*  */
+static role_ret play(role_t **pp_role, void *p_arg);  /* 扮演 */
 
 static role_ret ammeter_vol_do (struct role **pp_role, void *p_arg);
 
 
-#define PILE_OVER_VOL_VAL    2500  /* ѹֵ  λ0.1V */
-#define PILE_UNDER_VOL_VAL   1700  /* Ƿѹֵ  λ0.1V */
+#define PILE_OVER_VOL_VAL    2500  /* 过压值  单位0.1V */
+#define PILE_UNDER_VOL_VAL   1700  /* 欠压值  单位0.1V */
 
-#define PILE_CURR_POINT       20000        /* ص  20A*/
-#define PILE_CURR_TIMEOUT     5000         /* 쳣ʱʱ 쳣ʱڸʱȷΪ쳣 */
-#define PILE_CURR_MIN_TIMEOUT 60000        /* صʱ  */
-#define PILE_CURR_MIN         3000         /* УС  3A */
+#define PILE_CURR_POINT       20000        /* 电流监控点  20A*/
+#define PILE_CURR_TIMEOUT     5000         /* 电流异常最大超时时间 ，异常时间大于该时间确认为异常 */
+#define PILE_CURR_MIN_TIMEOUT 60000        /* 最大允许空载的时间  */
+#define PILE_CURR_MIN         3000         /* 充电过程中，允许的最小电流  3A */
+
+/* 电量任何变化都发布（计费依赖）， 电压电流按死区发布 */
+static const evt_pub_field_t __g_ammeter_pub_fields[] = {
+    EVT_PUB_FIELD(ammeter_dat_t, now_energy, FALSE, 0),
+    EVT_PUB_FIELD(ammeter_dat_t, now_vol,    TRUE,  ACP1000_PUB_AMMETER_VOL_DB),
+    EVT_PUB_FIELD(ammeter_dat_t, now_curr,   FALSE, ACP1000_PUB_AMMETER_CURR_DB),
+};
 
 /**
- *  \brief ģʵʼ
- *  param [in]   p_this        : ģʵ
+ *  \brief 充电模块实例初始化
+ *  param [in]   p_this        : 充电模块实例
  *  */
 void ammeter_inst_init(ammeter_t *p_this, aw_ammeter_t *p_ammeter_driver, uint32_t max_curr)
 {
-    static role_t ammeter_vol    = {ammeter_vol_do};  /* ɰݵĽɫ - ѹ */
+    static role_t ammeter_vol    = {ammeter_vol_do};  /* 可扮演的角色 - 电压监控器 */
     p_this->player.pfn_play      = play;
     p_this->evt_node.pfunc_event = event_driver;
     p_this->p_ammeter_driver     = p_ammeter_driver;
@@ -70,24 +79,31 @@ void ammeter_inst_init(ammeter_t *p_this, aw_ammeter_t *p_ammeter_driver, uint32
     p_this->start_ticks          = 0;
     p_this->abnormal_state       = FALSE;
     p_this->enable_curr_check    = TRUE;
+    evt_pub_init(&p_this->pub,
+                 "ammeter",
+                 AMETER_MEASURE,
+                 __g_ammeter_pub_fields,
+                 AW_NELEMENTS(__g_ammeter_pub_fields),
+                 sizeof(ammeter_dat_t),
+                 ACP1000_PUB_AMMETER_KEEP);
     AW_MUTEX_INIT(p_this->dev_lock, AW_SEM_Q_PRIORITY);
     AW_MUTEX_INIT(p_this->role_lock, AW_SEM_Q_PRIORITY);
 }
 
-/* ===============================ɫ===================================  */
-static role_ret play(role_t **pp_role, void *p_arg)  /*  */
+/* ===============================扮演者与角色===================================  */
+static role_ret play(role_t **pp_role, void *p_arg)  /* 扮演 */
 {
     if ((*pp_role)->pfn_role_do) {
         return (*pp_role)->pfn_role_do(pp_role, p_arg);
     }
     return -AW_EINVAL;
 }
-/* ѹؽɫ */
+/* 电压监控角色 */
 static role_ret ammeter_vol_do (struct role **pp_role, void *p_arg)
 {
-#define VOL_DETECT_STEP_IDLE   0  /* ѹ״̬  */
-#define VOL_DETECT_STEP_UNDER  1  /* Ƿѹȷ״̬  */
-#define VOL_DETECT_STEP_OVER   2  /* ѹȷ״̬  */
+#define VOL_DETECT_STEP_IDLE   0  /* 电压检测空闲状态  */
+#define VOL_DETECT_STEP_UNDER  1  /* 欠压确认状态  */
+#define VOL_DETECT_STEP_OVER   2  /* 过压确认状态  */
 
     VOL_TO_AMMETER(p_this, pp_role);
     int32_t  vol = (int32_t)p_arg;
@@ -96,15 +112,15 @@ static role_ret ammeter_vol_do (struct role **pp_role, void *p_arg)
 
     case  VOL_DETECT_STEP_IDLE:
         if (PILE_UNDER_VOL_VAL >= vol) {
-            /* Ƿѹ */
+            /* 欠压 */
             p_this->vol_step = VOL_DETECT_STEP_UNDER;
         } else if (PILE_OVER_VOL_VAL <= vol) {
-            /* ѹ */
+            /* 过压 */
             p_this->vol_step = VOL_DETECT_STEP_OVER;
         } else {
            if ( p_this->vol_state != AMMETER_VOL_STATE_NORMAL) {
                p_this->vol_state = AMMETER_VOL_STATE_NORMAL;
-               /* todo ѹ¼ */
+               /* todo 发起电压正常事件 */
                event_node_tell_all(&p_this->evt_node, ERR_AMMETER_VOL, p_this->vol_state);
            }
         }
@@ -113,10 +129,10 @@ static role_ret ammeter_vol_do (struct role **pp_role, void *p_arg)
 
     case  VOL_DETECT_STEP_UNDER:
         if (PILE_UNDER_VOL_VAL >= vol) {
-            /* Ƿѹ */
+            /* 欠压 */
             if ( p_this->vol_state != AMMETER_VOL_STATE_UNDER) {
                 p_this->vol_state = AMMETER_VOL_STATE_UNDER;
-                /* todo Ƿѹ쳣¼ */
+                /* todo 发起欠压异常事件 */
                 event_node_tell_all(&p_this->evt_node, ERR_AMMETER_VOL, p_this->vol_state);
             }
         } else {
@@ -127,10 +143,10 @@ static role_ret ammeter_vol_do (struct role **pp_role, void *p_arg)
 
     case VOL_DETECT_STEP_OVER:
         if (PILE_OVER_VOL_VAL <= vol) {
-            /* ѹ */
+            /* 过压 */
             if ( p_this->vol_state != AMMETER_VOL_STATE_OVER) {
                 p_this->vol_state = AMMETER_VOL_STATE_OVER;
-                /* todo ѹ쳣¼ */
+                /* todo 发起过压异常事件 */
                 event_node_tell_all(&p_this->evt_node, ERR_AMMETER_VOL, p_this->vol_state);
             }
         } else {
@@ -142,7 +158,7 @@ static role_ret ammeter_vol_do (struct role **pp_role, void *p_arg)
     return AW_OK;
 }
 
-/* ؽɫ */
+/* 电流监控角色 */
 static role_ret ammeter_curr_do (struct role **pp_role, void *p_arg)
 {
     CURR_TO_AMMETER(p_this, pp_role);
@@ -151,16 +167,16 @@ static role_ret ammeter_curr_do (struct role **pp_role, void *p_arg)
     uint32_t   timeout_ms;
 
     if (curr <= PILE_CURR_MIN) {
-        /* 쳣*/
+        /* 电流异常*/
         if (0 == p_this->start_ticks) {
             p_this->start_ticks = aw_sys_tick_get() + 1;
         } else {
             end_ticks  = aw_sys_tick_get();
             timeout_ms = aw_ticks_to_ms(end_ticks - p_this->start_ticks);
             if (timeout_ms > PILE_CURR_MIN_TIMEOUT) {
-                 /* ͵쳣ź 쳣 */
+                 /* 发送电流异常信号 （空载异常 ）*/
                 if (p_this->curr_state != AMMETER_CURR_STATE_UNDER) {
-                    /* todo Ƿ¼*/
+                    /* todo 发送欠流事件*/
                     p_this->curr_state = AMMETER_CURR_STATE_UNDER;
                     event_node_tell_all(&p_this->evt_node, ERR_AMMETER_CURR, p_this->curr_state);
                 }
@@ -170,33 +186,33 @@ static role_ret ammeter_curr_do (struct role **pp_role, void *p_arg)
     } else if (p_this->max_curr <= PILE_CURR_POINT) {
 
         if (curr > ( p_this->max_curr + 2000)) {
-            /* 쳣*/
+            /* 电流异常*/
             if (0 == p_this->start_ticks) {
                 p_this->start_ticks = aw_sys_tick_get();
             } else {
                 end_ticks  = aw_sys_tick_get();
                 timeout_ms = aw_ticks_to_ms(end_ticks - p_this->start_ticks);
                 if (timeout_ms > PILE_CURR_TIMEOUT) {
-                     /* ͵쳣ź 쳣 */
+                     /* 发送电流异常信号 （过流异常 ）*/
                     if (p_this->curr_state != AMMETER_CURR_STATE_OVER) {
-                        /* todo ͹¼*/
+                        /* todo 发送过流事件*/
                         p_this->curr_state = AMMETER_CURR_STATE_OVER;
                         event_node_tell_all(&p_this->evt_node, ERR_AMMETER_CURR, p_this->curr_state);
                     }
                 }
             }
         } else  {
-            /* todo  */
+            /* todo 电流正常 */
             p_this->start_ticks = 0;
             if (p_this->curr_state != AMMETER_CURR_STATE_NORMAL) {
-                /* todo ͵¼*/
+                /* todo 发送电流正常事件*/
                 event_node_tell_all(&p_this->evt_node, ERR_AMMETER_CURR, p_this->curr_state);
             }
             p_this->curr_state = AMMETER_CURR_STATE_NORMAL;
         }
     } else {
         if (curr > ((uint32_t)(p_this->max_curr * 1.1))) {
-            /* 쳣*/
+            /* 电流异常*/
             if (0 == p_this->start_ticks) {
                 p_this->start_ticks = aw_sys_tick_get();
             } else {
@@ -205,7 +221,7 @@ static role_ret ammeter_curr_do (struct role **pp_role, void *p_arg)
                 if (timeout_ms > PILE_CURR_TIMEOUT) {
 
                     if (p_this->curr_state != AMMETER_CURR_STATE_OVER) {
-                        /* todo ͹¼*/
+                        /* todo 发送过流事件*/
                         p_this->curr_state = AMMETER_CURR_STATE_OVER;
                         event_node_tell_all(&p_this->evt_node, ERR_AMMETER_CURR, p_this->curr_state);
                     }
@@ -213,10 +229,10 @@ static role_ret ammeter_curr_do (struct role **pp_role, void *p_arg)
                 }
             }
         } else {
-            /* todo  */
+            /* todo 电流正常 */
             p_this->start_ticks = 0;
             if (p_this->curr_state != AMMETER_CURR_STATE_NORMAL) {
-                /* todo ͵¼*/
+                /* todo 发送电流正常事件*/
                 event_node_tell_all(&p_this->evt_node, ERR_AMMETER_CURR, p_this->curr_state);
             }
             p_this->curr_state = AMMETER_CURR_STATE_NORMAL;
@@ -259,10 +275,12 @@ static void event_driver(struct event_node *p_evt, event_t event, void *p_arg)
 #define AMMETER_TASK_PRIO       4
 #define AMMETER_TACK_SIZE       2048
 #define AMMETER_DETECT_PERIOD   1000
+#define AMMETER_WDT_MS          (3 * 1100 + AMMETER_DETECT_PERIOD)  /* 一轮读3项， 每项最长约1.1s */
 AW_TASK_DECL_STATIC(ammeter_task, AMMETER_TACK_SIZE);
+TASK_WDT_DECL(__g_ammeter_wdt);
 
 /**
- * ̽
+ * 卡探测任务
  */
 static void ammeter_task_entry (void *p_arg)
 {
@@ -281,12 +299,13 @@ static void ammeter_task_entry (void *p_arg)
     aw_ammeter_dc_inst_init(p_this->p_ammeter_driver);
 
     while (1) {
+        TASK_WDT_BEAT(__g_ammeter_wdt);
 
         scnt++;
-        /* ȡ */
+        /* 获取电量 */
         if ((AW_OK == aw_ammeter_active_energy_get(p_this->p_ammeter_driver, &energy))) {
             state = 0;
-//            aw_kprintf("eng: %06d (0.01KWh)     Err: %d - %d\r\n", energy, scnt, cnt);
+            SLOG(SLOG_MOD_METER, SLOG_DBG, "eng: %06d (0.01KWh)     Err: %d - %d", energy, scnt, cnt);
 #if ACP1000_AMMETER_ERR_DETECT
             cnt = 0;
             if (TRUE == p_this->abnormal_state) {
@@ -299,7 +318,7 @@ static void ammeter_task_entry (void *p_arg)
 #if ACP1000_AMMETER_ERR_DETECT
             cnt++;
             if (cnt >= 2) {
-                /* ͨ3ʧܣΪ쳣 */
+                /* 通信3次失败，认为电表有异常 */
                 if (FALSE == p_this->abnormal_state) {
                     p_this->abnormal_state = TRUE;
                     event_node_tell_all(&p_this->evt_node, ERR_AMMETER, TRUE);
@@ -308,14 +327,14 @@ static void ammeter_task_entry (void *p_arg)
 #endif
         }
         aw_mdelay(30);
-        /* ȡѹ */
+        /* 获取电压 */
         if (AW_OK == aw_ammeter_voltage_get(p_this->p_ammeter_driver, 0, &vol)) {
             state &= ~0x2;
         } else {
             state |=  0x2;
         }
         aw_mdelay(30);
-        /* ȡ */
+        /* 获取电流 */
         if (AW_OK == aw_ammeter_current_get(p_this->p_ammeter_driver, 0, &curr)) {
             state &= ~0x4;
         } else {
@@ -329,8 +348,8 @@ static void ammeter_task_entry (void *p_arg)
             p_this->dat.now_energy = energy;
             ammeter_dev_unlock(p_this);
 
-            /* ͵ */
-            event_node_tell_all(&p_this->evt_node, AMETER_MEASURE, &p_this->dat);
+            /* 发送电量数据 */
+            evt_pub_tell(&p_this->pub, &p_this->evt_node, &p_this->dat);
         }
 
 #if ACP1000_VOL_ERR_DETECT
@@ -338,7 +357,7 @@ static void ammeter_task_entry (void *p_arg)
         p_role[0] = p_this->p_ammeter_vol;
         AW_MUTEX_UNLOCK(p_this->role_lock);
 
-        /* صѹ */
+        /* 监控电压 */
         if (NULL != p_role[0]) {
             p_this->player.pfn_play(&p_this->p_ammeter_vol, vol);
         }
@@ -350,11 +369,11 @@ static void ammeter_task_entry (void *p_arg)
             p_role[1] = p_this->p_ammeter_curr;
             AW_MUTEX_UNLOCK(p_this->role_lock);
 
-            /* ص*/
+            /* 监控电流*/
             if (NULL != p_role[1]) {
                 p_this->player.pfn_play(&p_this->p_ammeter_curr, curr);
             } else {
-                /* صʱ Ϊ */
+                /* 无需监控电流时 ，认为电流正常 */
                 if (p_this->curr_state != AMMETER_CURR_STATE_NORMAL) {
                     p_this->curr_state     = AMMETER_CURR_STATE_NORMAL;
                     event_node_tell_all(&p_this->evt_node, ERR_AMMETER_CURR, p_this->curr_state);
@@ -368,13 +387,14 @@ static void ammeter_task_entry (void *p_arg)
 
 void ammeter_task_startup (ammeter_t *p_this)
 {
-    AW_TASK_INIT(ammeter_task,           /* ʵ */
-                 "ammeter_task",            /*  */
-                 AMMETER_TASK_PRIO,      /* ȼ */
-                 AMMETER_TACK_SIZE,      /* ջС */
-                 ammeter_task_entry,     /* ں */
-                 (void *)p_this);        /* ڲ */
-    /*  */
+    TASK_WDT_ADD(__g_ammeter_wdt, "ammeter_task", AMMETER_WDT_MS + TASK_WDT_SLACK_MS);
+    AW_TASK_INIT(ammeter_task,           /* 任务实体 */
+                 "ammeter_task",            /* 任务名字 */
+                 AMMETER_TASK_PRIO,      /* 任务优先级 */
+                 AMMETER_TACK_SIZE,      /* 任务堆栈大小 */
+                 ammeter_task_entry,     /* 任务入口函数 */
+                 (void *)p_this);        /* 任务入口参数 */
+    /* 启动任务 */
     AW_TASK_STARTUP(ammeter_task);
 }
 
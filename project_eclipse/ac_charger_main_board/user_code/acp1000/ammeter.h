@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief ʵ
+ * \brief 电表实例声明
  *
  * \internal
  * \par modification history:
@@ -27,47 +27,48 @@
 #include "player.h"
 #include "event_node.h"
 #include "ammeter/aw_ammeter.h"
-#include "ammeter.h"
+#include "evt_pub.h"
 /**
- * 
+ * 电表数据
  */
 typedef struct ammeter_dat {
-    uint32_t now_energy;  /* ǰ λ0.01  */
-    int32_t now_vol;      /* ǰѹλ0.1V   */
-    uint32_t now_curr;    /* ǰ. λ0.001A */
+    uint32_t now_energy;  /* 当前电量 ，单位0.01 度 */
+    int32_t now_vol;      /* 当前电压，单位0.1V   */
+    uint32_t now_curr;    /* 当前电流. 单位0.001A */
 }ammeter_dat_t;
 
 
 /**
- * ƷѵԪʵ
+ * 计费单元实例声明
  */
 typedef struct ammeter {
-    player_t          player;              /*  */
-    event_node_t      evt_node;            /* ¼ӿ */
-    ammeter_dat_t     dat;                 /* Ƭ */
-    aw_ammeter_t      *p_ammeter_driver;   /* 豸 */
+    player_t          player;              /* 扮演者 */
+    event_node_t      evt_node;            /* 事件接口 */
+    ammeter_dat_t     dat;                 /* 卡片数据 */
+    aw_ammeter_t      *p_ammeter_driver;   /* 电表驱动设备 */
 
-    role_t           *p_ammeter_vol;       /* ɰݵĽɫ  - ѹ */
-    role_t           *p_ammeter_curr;      /* ɰݵĽɫ  -  */
-    AW_MUTEX_DECL(role_lock);              /**< \brief ɫ  */
-    AW_MUTEX_DECL(dev_lock);               /**< \brief 豸  */
+    role_t           *p_ammeter_vol;       /* 可扮演的角色  - 电压监控器 */
+    role_t           *p_ammeter_curr;      /* 可扮演的角色  - 电流监控器 */
+    AW_MUTEX_DECL(role_lock);              /**< \brief 角色锁  */
+    AW_MUTEX_DECL(dev_lock);               /**< \brief 设备锁  */
 
-    uint32_t          max_curr;           /*  λ0.01A */
-    uint8_t           vol_state;          /* ѹ״̬0 , 1; Ƿѹ 2 ѹ  */
-    uint8_t           curr_state;         /* Ƿ쳣 0 1 С  2   */
-    uint32_t          vol_step;           /* ڲ״̬ */
-    aw_tick_t         start_ticks;        /* ڲ */
-    bool_t            abnormal_state;     /*  , FALSE: TRUE: 쳣*/
-    bool_t            enable_curr_check;  /* Ƿʹܵ */
+    uint32_t          max_curr;           /* 充电机最大输出电流 （单位0.01A） */
+    uint8_t           vol_state;          /* 电压状态，0正常 , 1; 欠压； 2： 过压；  */
+    uint8_t           curr_state;         /* 电流是否异常： 0：正常； 1： 电流过小 ； 2： 过流  */
+    uint32_t          vol_step;           /* 内部状态机 */
+    aw_tick_t         start_ticks;        /* 内部变量 */
+    bool_t            abnormal_state;     /* 电表运行情况 , FALSE: 正常，TRUE: 异常*/
+    bool_t            enable_curr_check;  /* 是否使能电流测量 */
+    evt_pub_t         pub;                /* AMETER_MEASURE按变化发布 */
 }ammeter_t;
 
-#define AMMETER_VOL_STATE_NORMAL    0     /* ѹ */
-#define AMMETER_VOL_STATE_UNDER     1     /* Ƿѹ */
-#define AMMETER_VOL_STATE_OVER      2     /* ѹ */
+#define AMMETER_VOL_STATE_NORMAL    0     /* 电压正常 */
+#define AMMETER_VOL_STATE_UNDER     1     /* 欠压 */
+#define AMMETER_VOL_STATE_OVER      2     /* 过压 */
 
-#define AMMETER_CURR_STATE_NORMAL    0     /*  */
-#define AMMETER_CURR_STATE_UNDER     1     /* С */
-#define AMMETER_CURR_STATE_OVER      2     /*  */
+#define AMMETER_CURR_STATE_NORMAL    0     /* 电流正常 */
+#define AMMETER_CURR_STATE_UNDER     1     /* 电流过小 */
+#define AMMETER_CURR_STATE_OVER      2     /* 过流 */
 
 
 static inline void ammeter_dev_lock(ammeter_t *p_this)
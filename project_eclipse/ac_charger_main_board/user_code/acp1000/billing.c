@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief ƷѵԪʵ
+ * \brief 计费单元实例
  *
  * \internal
  * \par modification history:
@@ -33,6 +33,9 @@
 #include "ammeter.h"
 #include "pile.h"
 #include "aw_nvram.h"
+#include "perf_stat.h"
+#include "lat_hist.h"
+#include "task_wdt.h"
 
 #include "mb/aw_mb_dgus_regmap.h"
 #include "ac_charge_prj_cfg.h"
@@ -52,13 +55,23 @@
 #define EVT_TO_BILLING(p_this, p_evt) \
     struct billing *p_this = AW_CONTAINER_OF(p_evt, struct billing, evt_node)
 
-static role_ret play(role_t **pp_role, void *p_arg);  /*  */
+static role_ret play(role_t **pp_role, void *p_arg);  /* 扮演 */
 static void  event_driver(struct event_node *p_evt, event_t event, void *p_arg);
 static role_ret billing_idle_do (struct role **pp_role, void *p_arg);
 
+/* 计费数据每100ms计算一次， 大部分时间不变 */
+static const evt_pub_field_t __g_billing_pub_fields[] = {
+    EVT_PUB_FIELD(billing_dat_t, used_time,   FALSE, 0),
+    EVT_PUB_FIELD(billing_dat_t, used_amount, FALSE, 0),
+    EVT_PUB_FIELD(billing_dat_t, used_energy, FALSE, 0),
+    EVT_PUB_FIELD(billing_dat_t, now_price,   FALSE, 0),
+    EVT_PUB_FIELD(billing_dat_t, usr_balance, FALSE, 0),
+    EVT_PUB_FIELD(billing_dat_t, stop_reason, FALSE, 0),
+};
+
 /**
- *  \brief ģʵʼ
- *  param [in]   p_this        : ģʵ
+ *  \brief 充电模块实例初始化
+ *  param [in]   p_this        : 充电模块实例
  *  */
 void billing_inst_init(billing_t  *p_this,
                        uint8_t     rtc_id,
@@ -75,6 +88,13 @@ void billing_inst_init(billing_t  *p_this,
     p_this->p_pile_sem           = p_pile_sem;
     p_this->p_pile               = p_pile;
     p_this->enough               = TRUE;
+    evt_pub_init(&p_this->pub,
+                 "billing",
+                 BILLING_ING,
+                 __g_billing_pub_fields,
+                 AW_NELEMENTS(__g_billing_pub_fields),
+                 sizeof(billing_dat_t),
+                 ACP1000_PUB_BILLING_KEEP);
     AW_MUTEX_INIT(p_this->dev_lock, AW_SEM_Q_PRIORITY);
     AW_MUTEX_INIT(p_this->role_lock, AW_SEM_Q_PRIORITY);
 
@@ -82,11 +102,11 @@ void billing_inst_init(billing_t  *p_this,
 
 
 /**
- * Ʒģʽ
+ * 计费模式监控
  */
 static void billing_mode_monitor (billing_t *p_this)
 {
-    uint32_t price;  /*  λ0.0001Ԫ */
+    uint32_t price;  /* 电价 单位0.0001元 */
     billing_dat_t *p_dat = &p_this->dat;
 
     billing_dev_lock(p_this);
@@ -122,12 +142,12 @@ static void billing_mode_monitor (billing_t *p_this)
         break;
     }
 
-    /* ʵʱ */
+    /* 实时结算 */
     if (p_dat->used_amount >= p_dat->usr_balance ) {
 
         p_dat->used_amount  = p_dat->usr_balance;
         if (p_dat->stop_reason == AW_MB_DGUS_CHARGE_NONE) {
-            /* todo ¼*/
+            /* todo 发起余额不足事件*/
             p_dat->stop_reason = AW_MB_DGUS_CHARGE_BALANCE_UNDER;
         }
     }
@@ -135,7 +155,7 @@ static void billing_mode_monitor (billing_t *p_this)
 }
 
 /**
- * ǰϸڱEEPROM
+ * 将当前消费细节保存在EEPROM里
  */
 //static
 aw_err_t billing_info_eeprom_save (billing_dat_t  *p_billing_dat,
@@ -143,11 +163,11 @@ aw_err_t billing_info_eeprom_save (billing_dat_t  *p_billing_dat,
 {
 
 #if ACP1000_EEPROM_CHARGE_DAT_SET
-    /* ȡϴεļ¼λ */
-    uint8_t total = 0;  /* eepromĿǰЧļ¼ */
-    int16_t last  = 0;  /* һμ¼ƫλ */
+    /* 获取到上次的记录位置 */
+    uint8_t total = 0;  /* eeprom目前有效的记录数 */
+    int16_t last  = 0;  /* 上一次记录的偏移位置 */
     uint8_t buf[ACP1000_EEPROM_CHARGE_SIZE];
-    uint8_t offset = 0; /* ƫƵַ */
+    uint8_t offset = 0; /* 偏移地址 */
 
     if(AW_OK != aw_nvram_get(ACP1000_EEPROM_NAME, 4, buf, 0, 2)) {
         return AW_ERROR;
@@ -155,13 +175,13 @@ aw_err_t billing_info_eeprom_save (billing_dat_t  *p_billing_dat,
     total = buf[0];
     if ((total > ACP1000_EEPROM_CHARGE_MAX_NUMS) ||
         (total == 0)) {
-        /* ݣЧһEEPROM ʹ0xFF */
+        /* 错误的数据，任务无效，一般EEPROM 出厂即使0xFF */
         last  = -1;
         total = 0;
     } else {
         last  = buf[1];
     }
-    /* ¼ */
+    /* 保存记录 */
     memcpy(&buf[0], p_billing_mode->usr_id, 16);
     memcpy(&buf[16], &p_billing_mode->usr_balance, 4);
     memcpy(&buf[20], &p_billing_dat->start_time, sizeof(time_t));
@@ -194,8 +214,8 @@ aw_err_t billing_info_eeprom_save (billing_dat_t  *p_billing_dat,
 
     return AW_OK;
 }
-/* ===============================ɫ===================================  */
-static role_ret play(role_t **pp_role, void *p_arg)  /*  */
+/* ===============================扮演者与角色===================================  */
+static role_ret play(role_t **pp_role, void *p_arg)  /* 扮演 */
 {
     if ((*pp_role)->pfn_role_do) {
         return (*pp_role)->pfn_role_do(pp_role, p_arg);
@@ -204,7 +224,7 @@ static role_ret play(role_t **pp_role, void *p_arg)  /* 
 }
 
 /**
- * ƷѿУȨɹ󣬼Ƿ㣬ӦõĽģʽ
+ * 计费空闲，鉴权成功后，检测余额是否充足，对应设置的金额模式
  */
 static role_ret billing_idle_do (struct role **pp_role, void *p_arg)
 {
@@ -214,7 +234,7 @@ static role_ret billing_idle_do (struct role **pp_role, void *p_arg)
     billing_dev_lock(p_this);
     if (p_this->mode.usr_balance == 0){
         if (TRUE == p_this->enough) {
-            /*  */
+            /* 发送余额不足 */
             p_this->enough = FALSE;
             billing_dev_unlock(p_this);
 //            event_node_tell_all(&p_this->evt_node, BILLING_BALANCE, FALSE);
@@ -229,18 +249,18 @@ static role_ret billing_idle_do (struct role **pp_role, void *p_arg)
 }
 
 /**
- * Ʒѿʼ
+ * 计费开始
  */
 static role_ret billing_start_do (struct role **pp_role, void *p_arg)
 {
     START_TO_BILLING(p_this, pp_role);
     aw_tm_t  tm;
     time_t   now_time;
-    /* ȡʼʱ */
+    /* 获取起始时间 */
     aw_rtc_time_get(p_this->rtc_id, &tm);
     aw_tm_to_time(&tm, &now_time);
 
-    /* ȡģʽ */
+    /* 获取充电模式 */
     event_node_tell_all(&p_this->evt_node, BILLING_MODE_GET, &p_this->mode);
 
     billing_dev_lock(p_this);
@@ -248,26 +268,29 @@ static role_ret billing_start_do (struct role **pp_role, void *p_arg)
     p_this->dat.used_amount = 0;
     p_this->dat.used_energy = 0;
     p_this->dat.start_energy= p_this->dat.now_energy;
-    p_this->dat.usr_balance = p_this->mode.usr_balance; /* ȡû */
+    p_this->dat.usr_balance = p_this->mode.usr_balance; /* 获取用户余额 */
     p_this->dat.start_time  = now_time;
     p_this->dat.stop_reason = AW_MB_DGUS_CHARGE_NONE;
     billing_dev_unlock(p_this);
 
-    /* Ʒѿʼ */
+    /* 新的充电， 第一份计费数据总是发布 */
+    evt_pub_reset(&p_this->pub);
+
+    /* 计费开始 */
     event_node_tell(&p_this->evt_node, BILLING_START, TRUE);
     AW_SEMB_INIT(p_this->p_pile_sem->charge_gun_sem, AW_SEM_EMPTY, AW_SEM_Q_PRIORITY);
     return AW_OK;
 }
 
 /**
- * Ʒ
+ * 计费中
  */
 static role_ret billing_ing_do (struct role **pp_role, void *p_arg)
 {
     ING_TO_BILLING(p_this, pp_role);
     time_t  now_time;
     aw_tm_t tm;
-    uint16_t price /* λ0.0001Ԫ ÿ */;
+    uint16_t price /* 单位0.0001元 每度 */;
 
     aw_rtc_time_get (p_this->rtc_id, &tm);
     aw_tm_to_time(&tm, &now_time);
@@ -292,28 +315,32 @@ static role_ret billing_ing_do (struct role **pp_role, void *p_arg)
     billing_mode_monitor(p_this);
 #endif
 
-    event_node_tell_all(&p_this->evt_node, BILLING_ING, &p_this->dat);
+    LAT_HIST_START(LAT_HIST_BILL_MB);   /* 未广播时由下次覆盖 */
+    evt_pub_tell(&p_this->pub, &p_this->evt_node, &p_this->dat);
     if (p_this->dat.stop_reason != AW_MB_DGUS_CHARGE_NONE) {
-        /* ƷѵԪֹ磬 ƷѵԪֹƷ¼  */
+        /* 计费单元终止充电， 发起计费单元终止计费事件  */
         event_node_tell_all(&p_this->evt_node, BILLING_STOP, p_this->dat.stop_reason);
     }
     return AW_OK;
 }
 
 /**
- * Ʒѽ
+ * 计费结束
  */
 static role_ret billing_end_do (struct role **pp_role, void *p_arg)
 {
     END_TO_BILLING(p_this, pp_role);
     aw_err_t ret;
+    PERF_STAT_DECL(t0);
 
-    /*  ˴Ϣ   */
+    /*  此处保存充电信息   */
+    PERF_STAT_BEGIN(t0);
     billing_info_eeprom_save(&p_this->dat, &p_this->mode);
+    PERF_STAT_END(PERF_STAT_HISTORY_SAVE, t0);
 
 #if ACP1000_HUB4G_BILLING
     event_node_tell_all(&p_this->evt_node, BILLING_ENDING, TRUE);
-    // todo ȴ·
+    // todo 等待结算结果下发
     ret = AW_SEMB_TAKE(p_this->p_pile_sem->hub4g_billing_sem,
                        aw_ms_to_ticks(ACP1000_BILLING_TIMEOUT));
     AW_SEMB_TAKE(p_this->p_pile_sem->charge_gun_sem, AW_SEM_WAIT_FOREVER);
@@ -323,7 +350,7 @@ static role_ret billing_end_do (struct role **pp_role, void *p_arg)
         return AW_ERROR;
     }
 #endif
-    /* TRUEΪɹFALSEΪ쳣  */
+    /* 发起结算结果，TRUE为结算成功，FALSE为结算异常  */
     event_node_tell_all(&p_this->evt_node, BILLING_END, TRUE);
 
     return AW_OK;
@@ -383,7 +410,7 @@ static void event_driver(struct event_node *p_evt, event_t event, void *p_arg)
         AW_MUTEX_UNLOCK(p_this->role_lock);
         break;
 
-    /* յ  */
+    /* 接收电表的数据  */
     case AMETER_MEASURE:
         p_ammeter_dat = (ammeter_dat_t *)p_arg;
         billing_dev_lock(p_this);
@@ -419,9 +446,10 @@ static void event_driver(struct event_node *p_evt, event_t event, void *p_arg)
 #define BILLING_TACK_SIZE       2048
 #define BILLING_DETECT_PERIOD   100
 AW_TASK_DECL_STATIC(billing_task, BILLING_TACK_SIZE);
+TASK_WDT_DECL(__g_billing_wdt);
 
 /**
- * ̽
+ * 卡探测任务
  */
 static void billing_task_entry (void *p_arg)
 {
@@ -429,6 +457,7 @@ static void billing_task_entry (void *p_arg)
     role_t     *p_role[4];
 
     while (1) {
+        TASK_WDT_BEAT(__g_billing_wdt);
 
         AW_MUTEX_LOCK(p_this->role_lock, AW_SEM_WAIT_FOREVER);
         memcpy(&p_role[0], &p_this->p_billing_idle, sizeof(role_t*) * 4);
@@ -452,13 +481,14 @@ static void billing_task_entry (void *p_arg)
 
 void billing_task_startup (billing_t *p_this)
 {
-    AW_TASK_INIT(billing_task,           /* ʵ */
-                 "billing_task",            /*  */
-                 BILLING_TASK_PRIO,      /* ȼ */
-                 BILLING_TACK_SIZE,      /* ջС */
-                 billing_task_entry,     /* ں */
-                 (void *)p_this);        /* ڲ */
-    /*  */
+    TASK_WDT_ADD(__g_billing_wdt, "billing_task", BILLING_DETECT_PERIOD + TASK_WDT_SLACK_MS);
+    AW_TASK_INIT(billing_task,           /* 任务实体 */
+                 "billing_task",            /* 任务名字 */
+                 BILLING_TASK_PRIO,      /* 任务优先级 */
+                 BILLING_TACK_SIZE,      /* 任务堆栈大小 */
+                 billing_task_entry,     /* 任务入口函数 */
+                 (void *)p_this);        /* 任务入口参数 */
+    /* 启动任务 */
     AW_TASK_STARTUP(billing_task);
 }
 
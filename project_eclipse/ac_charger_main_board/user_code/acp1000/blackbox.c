@@ -0,0 +1,583 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 黑匣子（异常、 复位前的现场记录）
+ *
+ * 现场记录和事件环放在 .noinit 段（启动代码不清零）， 记录以魔数和校验判断
+ * 是否有效。 Flash中每条记录占一个擦除块的第一页， 写入第一页时驱动擦除整块，
+ * 写满后覆盖序号最小的记录。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-16  xjc, first implementation
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include "string.h"
+#include "stddef.h"
+#include "ac_charge_prj_cfg.h"
+
+#if ACP1000_BLACKBOX
+
+#include "aw_int.h"
+#include "aw_task.h"
+#include "aw_sem.h"
+#include "aw_delay.h"
+#include "aw_nvram.h"
+#include "aw_vdebug.h"
+#include "boot/boot_cfg.h"
+#include "blackbox.h"
+#include "charger.h"
+#include "billing.h"
+#include "ammeter.h"
+#if ACP1000_BLACKBOX_MB
+#include "mb/ac_modbus_reg_map.h"
+#endif
+
+#define __REC_MAGIC            0x42425831   /* "BBX1" */
+#define __RING_MAGIC           0x42425245   /* "BBRE" */
+#define __PAGE_SIZE            256          /* Flash写入页大小 */
+#define __BLOCK_SIZE           4096         /* Flash擦除块大小 */
+
+#if (BLACKBOX_NVRAM_SIZE / __BLOCK_SIZE) < BLACKBOX_FLASH_SLOTS
+#error "BLACKBOX_NVRAM_SIZE must hold BLACKBOX_FLASH_SLOTS blocks"
+#endif
+
+/* 记录须在一页内 */
+typedef char __rec_size_check[(sizeof(blackbox_rec_t) <= __PAGE_SIZE) ? 1 : -1];
+
+#define BLACKBOX_TASK_PRIO     6       /* 低于各应用任务 */
+#define BLACKBOX_TACK_SIZE     1024
+#define BLACKBOX_SAVE_DELAY_MS 3000    /* 上电后延迟保存， 避开各模块初始化时的Flash读写 */
+AW_TASK_DECL_STATIC(blackbox_task, BLACKBOX_TACK_SIZE);
+
+/* LPC177x 复位源（RSID） */
+#define __RSID_POR             (1u << 0)
+#define __RSID_BODR            (1u << 3)
+#define __RSID_SYSRESET        (1u << 4)
+
+#ifdef __arm__
+#define __SCB_AIRCR            (*(volatile uint32_t *)0xE000ED0C)
+#define __SCB_CFSR             (*(volatile uint32_t *)0xE000ED28)
+#define __SCB_HFSR             (*(volatile uint32_t *)0xE000ED2C)
+#define __SCB_MMFAR            (*(volatile uint32_t *)0xE000ED34)
+#define __SCB_BFAR             (*(volatile uint32_t *)0xE000ED38)
+#define __LPC_RSID             (*(volatile uint32_t *)0x400FC180)
+#endif
+
+#define __CFSR_MMARVALID       (1u << 7)
+#define __CFSR_BFARVALID       (1u << 15)
+
+#define __CHARGER_ROLE_NUMS    6
+#define __BILLING_ROLE_NUMS    4
+
+blackbox_ring_t             g_blackbox_ring __attribute__((section(".noinit")));
+static blackbox_rec_t       __g_snap        __attribute__((section(".noinit")));
+
+static charger_t           *__gp_charger;
+static billing_t           *__gp_billing;
+static ammeter_t           *__gp_ammeter;
+
+static blackbox_rec_t       __g_last;           /* 上次复位前的记录 */
+static bool_t               __g_last_valid;
+
+AW_MUTEX_DECL_STATIC(__g_lock);                 /* 保护Flash读写及以下缓存 */
+static blackbox_rec_t       __g_buf;
+static uint8_t              __g_page[__PAGE_SIZE];
+
+#if ACP1000_BLACKBOX_MB
+static struct modbus_reg_map *__gp_mb_map;
+#endif
+
+static uint32_t __rec_check (const blackbox_rec_t *p_rec)
+{
+    const uint32_t *p   = (const uint32_t *)p_rec;
+    uint32_t        sum = 0x5AA5C33C;
+    int             i;
+
+    for (i = 0; i < (int)(offsetof(blackbox_rec_t, check) / 4); i++) {
+        sum = (sum << 1 | sum >> 31) ^ p[i];
+    }
+    return sum;
+}
+
+static bool_t __rec_valid (const blackbox_rec_t *p_rec)
+{
+    return (__REC_MAGIC == p_rec->magic) && (__rec_check(p_rec) == p_rec->check);
+}
+
+static uint32_t __reset_src_get (void)
+{
+#ifdef __arm__
+    uint32_t rsid = __LPC_RSID;
+
+    __LPC_RSID = rsid;              /* 写1清除 */
+    return rsid;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * \brief 当前角色（第一个非空角色）
+ */
+static uint8_t __role_get (role_t *const *pp_role, int nums)
+{
+    int i;
+
+    for (i = 0; i < nums; i++) {
+        if (NULL != pp_role[i]) {
+            return i;
+        }
+    }
+    return BLACKBOX_ROLE_NONE;
+}
+
+/**
+ * \brief 复制事件环， 时间换算为距now的ms
+ */
+static void __evt_copy (blackbox_rec_t *p_rec, uint32_t now)
+{
+    uint32_t idx  = g_blackbox_ring.idx;
+    uint32_t nums = (idx < BLACKBOX_EVT_NUMS) ? idx : BLACKBOX_EVT_NUMS;
+    uint32_t i, age;
+    const blackbox_evt_t *p_evt;
+
+    for (i = 0; i < nums; i++) {
+        p_evt = &g_blackbox_ring.evt[(idx - nums + i) & (BLACKBOX_EVT_NUMS - 1)];
+        age   = now - p_evt->ticks;
+        p_rec->evt[i].ticks = ((int32_t)age > 0) ? aw_ticks_to_ms(age) : 0;
+        p_rec->evt[i].event = p_evt->event;
+    }
+    p_rec->evt_nums = nums;
+}
+
+/**
+ * \brief 记录现场（不含异常寄存器）
+ */
+static void __snap_fill (blackbox_rec_t *p_rec, int cause, const char *p_task)
+{
+    uint32_t now = aw_sys_tick_get();
+
+    memset(p_rec, 0, sizeof(*p_rec));
+    p_rec->magic     = __REC_MAGIC;
+    p_rec->cause     = cause;
+    p_rec->uptime_ms = aw_ticks_to_ms(now);
+    if (NULL != p_task) {
+        strncpy(p_rec->task, p_task, sizeof(p_rec->task) - 1);
+    }
+
+    p_rec->charger_role = (NULL != __gp_charger) ?
+                          __role_get(&__gp_charger->p_charge_idle, __CHARGER_ROLE_NUMS) :
+                          BLACKBOX_ROLE_NONE;
+    p_rec->billing_role = (NULL != __gp_billing) ?
+                          __role_get(&__gp_billing->p_billing_idle, __BILLING_ROLE_NUMS) :
+                          BLACKBOX_ROLE_NONE;
+    if (NULL != __gp_ammeter) {
+        p_rec->meter_vol    = __gp_ammeter->dat.now_vol;
+        p_rec->meter_curr   = __gp_ammeter->dat.now_curr;
+        p_rec->meter_energy = __gp_ammeter->dat.now_energy;
+    }
+    __evt_copy(p_rec, now);
+}
+
+/**
+ * \brief 热复位前没有现场记录时， 由事件环生成记录（时间以最后一个事件为准）
+ */
+static void __ring_rec (blackbox_rec_t *p_rec)
+{
+    uint32_t last = 0;
+
+    memset(p_rec, 0, sizeof(*p_rec));
+    p_rec->magic        = __REC_MAGIC;
+    p_rec->cause        = BLACKBOX_CAUSE_RESET;
+    p_rec->charger_role = BLACKBOX_ROLE_NONE;
+    p_rec->billing_role = BLACKBOX_ROLE_NONE;
+    if (0 != g_blackbox_ring.idx) {
+        last = g_blackbox_ring.evt[(g_blackbox_ring.idx - 1) & (BLACKBOX_EVT_NUMS - 1)].ticks;
+    }
+    p_rec->uptime_ms = aw_ticks_to_ms(last);
+    __evt_copy(p_rec, last);
+}
+
+/******************************************************************************/
+/* 以下持有 __g_lock 时调用 */
+
+static aw_err_t __slot_read (int slot, blackbox_rec_t *p_rec)
+{
+    return aw_nvram_get(BLACKBOX_NVRAM_NAME,
+                        0,
+                        (char *)p_rec,
+                        slot * __BLOCK_SIZE,
+                        sizeof(*p_rec));
+}
+
+static aw_err_t __slot_write (int slot, const blackbox_rec_t *p_rec)
+{
+    memset(__g_page, 0xFF, sizeof(__g_page));
+    if (NULL != p_rec) {
+        memcpy(__g_page, p_rec, sizeof(*p_rec));
+    }
+
+    /* 写入块的第一页时会擦除整块 */
+    return aw_nvram_set(BLACKBOX_NVRAM_NAME,
+                        0,
+                        (char *)__g_page,
+                        slot * __BLOCK_SIZE,
+                        sizeof(__g_page));
+}
+
+/**
+ * \brief 读取各槽的序号（无效为0）
+ * \return 有效记录数， 读取失败返回负数
+ */
+static int __slots_scan (uint32_t seq[BLACKBOX_FLASH_SLOTS])
+{
+    aw_err_t ret;
+    int      slot;
+    int      nums = 0;
+
+    for (slot = 0; slot < BLACKBOX_FLASH_SLOTS; slot++) {
+        seq[slot] = 0;
+        ret = __slot_read(slot, &__g_buf);
+        if (AW_OK != ret) {
+            return ret;
+        }
+        if (__rec_valid(&__g_buf) && (0 != __g_buf.seq)) {
+            seq[slot] = __g_buf.seq;
+            nums++;
+        }
+    }
+    return nums;
+}
+
+/**
+ * \brief 第idx新的记录所在的槽， 不存在返回-1
+ */
+static int __slot_find (const uint32_t seq[BLACKBOX_FLASH_SLOTS], int idx)
+{
+    uint32_t below = 0xFFFFFFFF;
+    int      best  = -1;
+    int      slot;
+
+    while (idx-- >= 0) {
+        best = -1;
+        for (slot = 0; slot < BLACKBOX_FLASH_SLOTS; slot++) {
+            if ((0 != seq[slot]) && (seq[slot] < below) &&
+                ((best < 0) || (seq[slot] > seq[best]))) {
+                best = slot;
+            }
+        }
+        if (best < 0) {
+            return -1;
+        }
+        below = seq[best];
+    }
+    return best;
+}
+
+/**
+ * \brief 写入记录（覆盖空槽或最旧的记录）
+ */
+static aw_err_t __save (blackbox_rec_t *p_rec)
+{
+    uint32_t seq[BLACKBOX_FLASH_SLOTS];
+    uint32_t seq_max = 0;
+    int      slot    = -1;
+    int      i;
+    int      ret;
+
+    ret = __slots_scan(seq);
+    if (ret < 0) {
+        return ret;
+    }
+    for (i = 0; i < BLACKBOX_FLASH_SLOTS; i++) {
+        if (seq[i] > seq_max) {
+            seq_max = seq[i];
+        }
+        if ((slot < 0) || (seq[i] < seq[slot])) {
+            slot = i;
+        }
+    }
+
+    p_rec->seq   = seq_max + 1;
+    p_rec->check = __rec_check(p_rec);
+    return __slot_write(slot, p_rec);
+}
+
+#if ACP1000_BLACKBOX_MB
+static void __reg32_set (uint16_t *p_reg, uint32_t val)
+{
+    p_reg[0] = val >> 16;
+    p_reg[1] = val & 0xFFFF;
+}
+
+/**
+ * \brief 以最新记录更新寄存器表
+ */
+static void __mb_update (void)
+{
+    struct aw_remote_measure_blackbox *p_reg;
+    uint32_t seq[BLACKBOX_FLASH_SLOTS];
+    int      nums;
+    int      slot;
+    int      i;
+
+    if (NULL == __gp_mb_map) {
+        return;
+    }
+
+    nums = __slots_scan(seq);
+    slot = (nums > 0) ? __slot_find(seq, 0) : -1;
+    if ((slot < 0) || (AW_OK != __slot_read(slot, &__g_buf))) {
+        nums = 0;
+    }
+
+    modbus_reg_map_lock(__gp_mb_map);
+    p_reg = &__gp_mb_map->rm_measure_reg.blackbox;
+    memset(p_reg, 0, sizeof(*p_reg));
+    p_reg->rec_nums = nums;
+    if (nums > 0) {
+        __reg32_set(p_reg->seq, __g_buf.seq);
+        p_reg->cause     = __g_buf.cause;
+        p_reg->reset_src = __g_buf.reset_src;
+        __reg32_set(p_reg->uptime_s, __g_buf.uptime_ms / 1000);
+        for (i = 0; (i < (int)sizeof(__g_buf.task)) && __g_buf.task[i]; i++) {
+            p_reg->task[i >> 1] |= (uint8_t)__g_buf.task[i] << ((i & 1) ? 0 : 8);
+        }
+        __reg32_set(p_reg->pc,   __g_buf.frame[6]);
+        __reg32_set(p_reg->lr,   __g_buf.frame[5]);
+        __reg32_set(p_reg->cfsr, __g_buf.cfsr);
+        __reg32_set(p_reg->hfsr, __g_buf.hfsr);
+        __reg32_set(p_reg->fault_addr,
+                    (__g_buf.cfsr & __CFSR_MMARVALID) ? __g_buf.mmfar :
+                    (__g_buf.cfsr & __CFSR_BFARVALID) ? __g_buf.bfar  : 0);
+        p_reg->role      = (__g_buf.charger_role << 8) | __g_buf.billing_role;
+        p_reg->meter_vol = (uint16_t)__g_buf.meter_vol;
+        __reg32_set(p_reg->meter_curr,   __g_buf.meter_curr);
+        __reg32_set(p_reg->meter_energy, __g_buf.meter_energy);
+        p_reg->evt_nums  = __g_buf.evt_nums;
+        for (i = 0; (i < __g_buf.evt_nums) && (i < RM_MEASURE_BLACKBOX_EVTS); i++) {
+            p_reg->evt[i].event  = __g_buf.evt[i].event;
+            p_reg->evt[i].age_ms = (__g_buf.evt[i].ticks > 0xFFFF) ? 0xFFFF : __g_buf.evt[i].ticks;
+        }
+    }
+    modbus_reg_map_unlock(__gp_mb_map);
+}
+
+void blackbox_mb_bind (struct modbus_reg_map *p_map)
+{
+    __gp_mb_map = p_map;
+}
+#endif /* ACP1000_BLACKBOX_MB */
+
+/******************************************************************************/
+static void __task_entry (void *p_arg)
+{
+    aw_err_t ret;
+
+    aw_mdelay(BLACKBOX_SAVE_DELAY_MS);
+
+    AW_MUTEX_LOCK(__g_lock, AW_SEM_WAIT_FOREVER);
+    if (__g_last_valid) {
+        ret = __save(&__g_last);
+        if (AW_OK == ret) {
+            aw_kprintf("blackbox: saved as seq %u\r\n", __g_last.seq);
+        } else {
+            aw_kprintf("blackbox: save failed %d\r\n", ret);
+        }
+    }
+#if ACP1000_BLACKBOX_MB
+    __mb_update();
+#endif
+    AW_MUTEX_UNLOCK(__g_lock);
+
+    /* 保存后任务结束 */
+}
+
+#ifdef __arm__
+static void __fault_entry (uint32_t *p_frame, uint32_t exc_return) __attribute__((used, noreturn));
+
+/**
+ * \brief HardFault处理（替代启动代码中的弱定义）， 由EXC_RETURN的位2判断异常前使用的栈
+ */
+void armv7m_exc_hardfault_handler (void) __attribute__((naked));
+void armv7m_exc_hardfault_handler (void)
+{
+    __asm volatile (
+        "tst    lr, #4              \n"
+        "ite    eq                  \n"
+        "mrseq  r0, msp             \n"
+        "mrsne  r0, psp             \n"
+        "mov    r1, lr              \n"
+        "b      __fault_entry       \n");
+}
+
+static void __fault_entry (uint32_t *p_frame, uint32_t exc_return)
+{
+    blackbox_fault(p_frame, exc_return);
+
+    /* 软件复位 */
+    __SCB_AIRCR = (0x05FAul << 16) | (1ul << 2);
+    while (1) {
+    }
+}
+#endif
+
+/******************************************************************************/
+void blackbox_init (void)
+{
+    uint32_t rsid = __reset_src_get();
+
+    AW_MUTEX_INIT(__g_lock, AW_SEM_Q_PRIORITY);
+
+    if (__rec_valid(&__g_snap)) {
+        __g_last       = __g_snap;
+        __g_last_valid = TRUE;
+    } else if ((__RING_MAGIC == g_blackbox_ring.magic) &&
+               !(rsid & (__RSID_POR | __RSID_BODR | __RSID_SYSRESET))) {
+        /* 外部看门狗、 复位引脚等， 复位前没有记录现场 */
+        __ring_rec(&__g_last);
+        __g_last_valid = TRUE;
+    }
+
+    if (__g_last_valid) {
+        __g_last.reset_src = rsid;
+        aw_kprintf("blackbox: last reset by %s, task %s, pc 0x%08x, uptime %u ms\r\n",
+                   blackbox_cause_name(__g_last.cause),
+                   __g_last.task[0] ? __g_last.task : "-",
+                   __g_last.frame[6],
+                   __g_last.uptime_ms);
+    }
+
+    memset(&__g_snap, 0, sizeof(__g_snap));
+    memset(&g_blackbox_ring, 0, sizeof(g_blackbox_ring));
+    g_blackbox_ring.magic = __RING_MAGIC;
+}
+
+void blackbox_bind (struct charge  *p_charger,
+                    struct billing *p_billing,
+                    struct ammeter *p_ammeter)
+{
+    __gp_charger = p_charger;
+    __gp_billing = p_billing;
+    __gp_ammeter = p_ammeter;
+}
+
+void blackbox_snap (int cause, const char *p_task)
+{
+    AW_INT_CPU_LOCK_DECL(key);
+
+    AW_INT_CPU_LOCK(key);
+    __snap_fill(&__g_snap, cause, p_task);
+    __g_snap.check = __rec_check(&__g_snap);
+    AW_INT_CPU_UNLOCK(key);
+}
+
+void blackbox_fault (uint32_t *p_frame, uint32_t exc_return)
+{
+    __snap_fill(&__g_snap, BLACKBOX_CAUSE_FAULT, aw_task_name_get(aw_task_id_self()));
+    memcpy(__g_snap.frame, p_frame, sizeof(__g_snap.frame));
+    __g_snap.sp         = (uint32_t)(uintptr_t)p_frame;
+    __g_snap.exc_return = exc_return;
+#ifdef __arm__
+    __g_snap.cfsr       = __SCB_CFSR;
+    __g_snap.hfsr       = __SCB_HFSR;
+    __g_snap.mmfar      = __SCB_MMFAR;
+    __g_snap.bfar       = __SCB_BFAR;
+#endif
+    __g_snap.check      = __rec_check(&__g_snap);
+}
+
+void blackbox_startup (void)
+{
+    AW_TASK_INIT(blackbox_task,          /* 任务实体 */
+                 "blackbox_task",        /* 任务名字 */
+                 BLACKBOX_TASK_PRIO,     /* 任务优先级 */
+                 BLACKBOX_TACK_SIZE,     /* 任务堆栈大小 */
+                 __task_entry,           /* 任务入口函数 */
+                 NULL);                  /* 任务入口参数 */
+    AW_TASK_STARTUP(blackbox_task);
+}
+
+aw_err_t blackbox_get (int idx, blackbox_rec_t *p_rec)
+{
+    uint32_t seq[BLACKBOX_FLASH_SLOTS];
+    int      slot;
+    int      ret;
+
+    AW_MUTEX_LOCK(__g_lock, AW_SEM_WAIT_FOREVER);
+    ret = __slots_scan(seq);
+    if (ret >= 0) {
+        slot = __slot_find(seq, idx);
+        ret  = (slot < 0) ? -AW_ENOENT : __slot_read(slot, p_rec);
+    }
+    AW_MUTEX_UNLOCK(__g_lock);
+    return ret;
+}
+
+aw_err_t blackbox_clr (void)
+{
+    aw_err_t ret = AW_OK;
+    int      slot;
+
+    AW_MUTEX_LOCK(__g_lock, AW_SEM_WAIT_FOREVER);
+    for (slot = 0; (slot < BLACKBOX_FLASH_SLOTS) && (AW_OK == ret); slot++) {
+        ret = __slot_write(slot, NULL);
+    }
+#if ACP1000_BLACKBOX_MB
+    __mb_update();
+#endif
+    AW_MUTEX_UNLOCK(__g_lock);
+    return ret;
+}
+
+const char *blackbox_cause_name (int cause)
+{
+    switch (cause) {
+
+    case BLACKBOX_CAUSE_FAULT:
+        return "fault";
+
+    case BLACKBOX_CAUSE_TASK_WDT:
+        return "task_wdt";
+
+    case BLACKBOX_CAUSE_RESET:
+        return "reset";
+
+    default:
+        return "?";
+    }
+}
+
+const char *blackbox_charger_role_name (int role)
+{
+    static const char *names[__CHARGER_ROLE_NUMS] = {
+        "idle", "allow", "start", "charging", "stop", "err",
+    };
+
+    return (role < __CHARGER_ROLE_NUMS) ? names[role] : "-";
+}
+
+const char *blackbox_billing_role_name (int role)
+{
+    static const char *names[__BILLING_ROLE_NUMS] = {
+        "idle", "start", "billing", "end",
+    };
+
+    return (role < __BILLING_ROLE_NUMS) ? names[role] : "-";
+}
+
+#endif /* ACP1000_BLACKBOX */
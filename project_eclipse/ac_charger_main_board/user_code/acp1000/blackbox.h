@@ -0,0 +1,188 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 黑匣子（异常、 复位前的现场记录）
+ *
+ * 记录保存在复位不清除的RAM（.noinit 段）中， 下次上电由低优先级任务写入
+ * SPI Flash（BLACKBOX段， 保留最近 BLACKBOX_FLASH_SLOTS 条）：
+ *  - 硬件异常： HardFault（MemManage/BusFault/UsageFault 未单独使能， 升级为
+ *    HardFault）的栈帧、 故障状态寄存器和运行的任务， 记录后软件复位；
+ *  - 任务心跳超时： 由 task_wdt 在停止喂狗前记录超时的任务；
+ *  - 其它热复位（外部看门狗、 复位引脚等）： 上电时只有事件记录有效。
+ *
+ * 每条记录还包括最近 BLACKBOX_EVT_NUMS 个总线事件、 充电控制和计费的当前角色、
+ * 最近的电表数据。 角色和电表数据在记录时直接读取， 正常运行时只有事件分发
+ * 会写入事件环（几次存储， 已在分发锁内）。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-16  xjc, first implementation
+ * \endinternal
+ */
+
+#ifndef __BLACKBOX_H
+#define __BLACKBOX_H
+
+#include "apollo.h"
+#include "aw_system.h"
+#include "ac_charge_prj_cfg.h"
+
+#define BLACKBOX_EVT_NUMS       16      /* 保留的最近事件数（2的幂） */
+#define BLACKBOX_FLASH_SLOTS    4       /* Flash中保存的记录数（每条占一个擦除块） */
+
+/**
+ * \brief 记录原因
+ * @{
+ */
+#define BLACKBOX_CAUSE_FAULT     1      /**< \brief 硬件异常 */
+#define BLACKBOX_CAUSE_TASK_WDT  2      /**< \brief 任务心跳超时 */
+#define BLACKBOX_CAUSE_RESET     3      /**< \brief 无现场记录的热复位 */
+/** @} */
+
+#define BLACKBOX_ROLE_NONE      0xFF    /* 无角色或未绑定 */
+
+/**
+ * 事件（事件环中ticks为分发时的节拍， 记录中为距记录时刻的ms）
+ */
+typedef struct blackbox_evt {
+    uint32_t ticks;
+    uint16_t event;
+    uint16_t reserved;
+}blackbox_evt_t;
+
+/**
+ * 记录（不超过一个Flash页， 256字节）
+ */
+typedef struct blackbox_rec {
+    uint32_t        magic;
+    uint32_t        seq;            /* 写入Flash的序号， 越大越新 */
+    uint8_t         cause;          /* 记录原因 */
+    uint8_t         charger_role;   /* 充电控制角色： 0~5 空闲、 允许、 启动、 充电中、 停止、 异常 */
+    uint8_t         billing_role;   /* 计费角色： 0~3 空闲、 启动、 计费中、 结算 */
+    uint8_t         evt_nums;       /* 有效事件数 */
+    uint32_t        uptime_ms;      /* 记录时的运行时间（热复位为最后一个事件的时刻） */
+    uint32_t        reset_src;      /* 记录后那次复位的复位源（LPC177x RSID）， 主机构建为0 */
+    char            task[16];       /* 异常时运行的任务， 或心跳超时的任务 */
+
+    uint32_t        frame[8];       /* 异常栈帧： r0 r1 r2 r3 r12 lr pc xpsr */
+    uint32_t        sp;             /* 栈帧地址 */
+    uint32_t        exc_return;
+    uint32_t        cfsr;
+    uint32_t        hfsr;
+    uint32_t        mmfar;
+    uint32_t        bfar;
+
+    int32_t         meter_vol;      /* 电压， 单位0.1V */
+    uint32_t        meter_curr;     /* 电流， 单位0.001A */
+    uint32_t        meter_energy;   /* 电量， 单位0.01度 */
+
+    blackbox_evt_t  evt[BLACKBOX_EVT_NUMS];  /* 由旧到新 */
+    uint32_t        check;
+}blackbox_rec_t;
+
+/**
+ * 事件环（在 .noinit 段）
+ */
+typedef struct blackbox_ring {
+    uint32_t        magic;
+    uint32_t        idx;            /* 下一个写入位置（不回绕） */
+    blackbox_evt_t  evt[BLACKBOX_EVT_NUMS];
+}blackbox_ring_t;
+
+#if ACP1000_BLACKBOX
+
+extern blackbox_ring_t g_blackbox_ring;
+
+#define BLACKBOX_EVT(event)     blackbox_evt(event)
+
+/**
+ * \brief 记入一个分发的事件（调用者已互斥）
+ */
+static inline void blackbox_evt (int event)
+{
+    blackbox_evt_t *p_evt = &g_blackbox_ring.evt[g_blackbox_ring.idx++ & (BLACKBOX_EVT_NUMS - 1)];
+
+    p_evt->ticks = aw_sys_tick_get();
+    p_evt->event = event;
+}
+
+#else
+
+#define BLACKBOX_EVT(event)
+
+#endif
+
+struct charge;
+struct billing;
+struct ammeter;
+
+/**
+ * \brief 取出上次复位前的记录， 重置事件环， 在 acp_main_startup() 开始时调用
+ */
+void blackbox_init (void);
+
+/**
+ * \brief 绑定记录角色和电表数据的实例（可为NULL）
+ */
+void blackbox_bind (struct charge  *p_charger,
+                    struct billing *p_billing,
+                    struct ammeter *p_ammeter);
+
+/**
+ * \brief 在任务中记录现场（如任务心跳超时）， 复位后保存
+ * \param[in] p_task : 相关的任务名
+ */
+void blackbox_snap (int cause, const char *p_task);
+
+/**
+ * \brief 记录硬件异常现场（由HardFault处理调用， 主机构建由控制台模拟）
+ * \param[in] p_frame    : 异常栈帧
+ * \param[in] exc_return : 进入异常时的LR
+ */
+void blackbox_fault (uint32_t *p_frame, uint32_t exc_return);
+
+/**
+ * \brief 启动保存任务（上次的记录写入Flash， 之后任务结束）
+ */
+void blackbox_startup (void);
+
+/**
+ * \brief 读取Flash中的记录
+ * \param[in] idx : 0为最新
+ * \return AW_OK： 成功  -AW_ENOENT： 无该记录  其它： Flash读取失败
+ */
+aw_err_t blackbox_get (int idx, blackbox_rec_t *p_rec);
+
+/**
+ * \brief 擦除Flash中的记录
+ */
+aw_err_t blackbox_clr (void);
+
+/**
+ * \brief 名字（原因、 充电控制角色、 计费角色）
+ */
+const char *blackbox_cause_name (int cause);
+const char *blackbox_charger_role_name (int role);
+const char *blackbox_billing_role_name (int role);
+
+#if ACP1000_BLACKBOX_MB
+struct modbus_reg_map;
+
+/**
+ * \brief 绑定Modbus寄存器表， 保存任务结束前和擦除后更新最新记录的寄存器
+ */
+void blackbox_mb_bind (struct modbus_reg_map *p_map);
+#endif
+
+#endif
@@ -12,11 +12,12 @@
 *******************************************************************************/
 /**
  * \file
- * \brief 
+ * \brief 蜂鸣器任务
  *
  * \internal
  * \par modification history:
  * - 1.00 16-05-24  xjc, first implementation
+ * - 1.01 16-10-04  xjc, 使用模式引擎时由定时器中断鸣响
  * \endinternal
  */
 
@@ -24,16 +25,19 @@
 #include "aw_gpio.h"
 #include "aw_delay.h"
 #include "ac_charge_prj_cfg.h"
+#include "indicator.h"
+
+#if !ACP1000_INDICATOR
 
 #define BUZZER_PIN     PIO2_1
 #define BUZZER_TIME    50
 
-static struct aw_delayed_work g_buzzer_work; /* acĸż⹤  */
+static struct aw_delayed_work g_buzzer_work; /* ac母排检测工作  */
 
-static uint32_t time = 0;                    /* ÿʱΪ12ms  */
+static uint32_t time = 0;                    /* 持续次数，每次时间为12ms  */
 
 /**
- * ׮쳣
+ * 桩异常检测任务
  */
 static void buzzer_detect_work (void *p_arg)
 {
@@ -54,27 +58,34 @@ static void buzzer_detect_work (void *p_arg)
     }
 }
 
+#endif /* !ACP1000_INDICATOR */
+
 /**
- * 
+ * 蜂鸣器鸣响
  */
 void acp1000_buzzer_on (void)
 {
-#if ACP1000_BUZZER_TASK
+#if ACP1000_INDICATOR
+    indicator_play(IND_CHAN_BUZZER, IND_PRIO_CHARGE, &g_ind_beep);
+#elif ACP1000_BUZZER_TASK
     aw_delayed_work_stop(&g_buzzer_work);
     aw_delayed_work_start(&g_buzzer_work, 10);
 #endif
 }
 
 /**
-  * \brief ׮쳣
+  * \brief 桩异常检测
   */
 void buzzer_task_startup(void)
 {
+#if ACP1000_INDICATOR
+    /* 蜂鸣器引脚由模式引擎管理， 仅保留上电提示音 */
+    acp1000_buzzer_on();
+#else
     aw_gpio_pin_cfg(BUZZER_PIN, AW_GPIO_OUTPUT);
     aw_delayed_work_init(&g_buzzer_work,
                           buzzer_detect_work,
                           (void *)BUZZER_PIN);
     aw_delayed_work_start(&g_buzzer_work, 100);
-
-
+#endif
 }
@@ -0,0 +1,276 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 卡密钥加密存储（EEPROM单元6）
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-09-26  xjc, first implementation
+ * - 1.01 16-10-18  xjc, 记录及明文缓冲改为局部变量， 密钥缓存及EEPROM访问加锁
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include "string.h"
+#include "aw_nvram.h"
+#include "aw_system.h"
+#include "aw_sem.h"
+#include "des/des.h"
+#include "aes/aes.h"
+#include "card_key.h"
+
+#if (ACP1000_CARD_KEY_CIPHER != CARD_KEY_CIPHER_DES) && \
+    (ACP1000_CARD_KEY_CIPHER != CARD_KEY_CIPHER_AES_CTR) && \
+    (ACP1000_CARD_KEY_CIPHER != CARD_KEY_CIPHER_AES_CBC)
+#error "ACP1000_CARD_KEY_CIPHER invalid"
+#endif
+
+#define __KEY_UNIT        6     /* EEPROM单元 */
+#define __KEY_VALID       0x55  /* 明文首字节 */
+
+#define __FMT_MAGIC       0x4B  /* 新格式标识 */
+#define __FMT_VERSION     0x02  /* 新格式版本号 */
+
+/**
+ * 新格式存储内容（共36字节， 单元6大小为72字节）
+ */
+typedef struct card_key_rec {
+    uint8_t magic;                      /* 格式标识 */
+    uint8_t version;                    /* 格式版本号 */
+    uint8_t cipher;                     /* 加密方式 \ref grp_card_key_cipher */
+    uint8_t check;                      /* 头及IV校验 */
+    uint8_t iv[AES128_BLOCK_SIZE];      /* IV（CTR模式为初始计数块） */
+    uint8_t dat[AES128_BLOCK_SIZE];     /* 密文 */
+}card_key_rec_t;
+
+static des_ctx        g_des_ctx;        /* DES密钥扩展缓存 */
+static aes128_ctx     g_aes_ctx;        /* AES轮密钥缓存 */
+static uint8_t        g_aes_uid[CARD_KEY_UID_LEN];
+static bool_t         g_aes_valid = FALSE;
+static uint32_t       g_save_seq  = 0;  /* 写入次数， 保证CTR模式IV不重复 */
+
+AW_MUTEX_DECL_STATIC(__g_lock);         /* 保护以上缓存及EEPROM单元6 */
+
+static uint8_t __sum_check (const uint8_t *p, uint32_t len)
+{
+    uint8_t sum = 0;
+
+    while (len--) {
+        sum += *p++;
+    }
+    return ~sum;
+}
+
+static void __aes_key_setup (const uint8_t *p_uid_key)
+{
+    if (g_aes_valid && (0 == memcmp(g_aes_uid, p_uid_key, CARD_KEY_UID_LEN))) {
+        return;
+    }
+    aes128_key_setup(&g_aes_ctx, p_uid_key);
+    memcpy(g_aes_uid, p_uid_key, CARD_KEY_UID_LEN);
+    g_aes_valid = TRUE;
+}
+
+/**
+ * 按新格式解析， 成功返回加密方式， 失败返回-1
+ */
+static int __rec_decode (card_key_rec_t *p_rec,
+                         uint8_t        *p_key,
+                         const uint8_t  *p_uid_key)
+{
+    uint8_t iv[AES128_BLOCK_SIZE];
+    uint8_t plain[AES128_BLOCK_SIZE];
+    uint8_t check = p_rec->check;
+
+    if ((__FMT_MAGIC != p_rec->magic) || (__FMT_VERSION != p_rec->version)) {
+        return -1;
+    }
+    /* 校验时check按0计算， 完成后恢复（失败时还要按旧格式解析） */
+    p_rec->check = 0;
+    if (check != __sum_check(&p_rec->magic, AW_OFFSET(card_key_rec_t, dat))) {
+        p_rec->check = check;
+        return -1;
+    }
+    p_rec->check = check;
+
+    __aes_key_setup(p_uid_key);
+    memcpy(iv, p_rec->iv, sizeof(iv));
+    if (CARD_KEY_CIPHER_AES_CTR == p_rec->cipher) {
+        aes128_ctr_crypt(&g_aes_ctx, iv, p_rec->dat, plain, AES128_BLOCK_SIZE);
+    } else if (CARD_KEY_CIPHER_AES_CBC == p_rec->cipher) {
+        aes128_cbc_decrypt(&g_aes_ctx, iv, p_rec->dat, plain, AES128_BLOCK_SIZE);
+    } else {
+        return -1;
+    }
+
+    /* 0x55 + 卡密钥 + 填充0 + 校验 */
+    if ((__KEY_VALID != plain[0]) ||
+        (plain[AES128_BLOCK_SIZE - 1] !=
+         __sum_check(plain, AES128_BLOCK_SIZE - 1))) {
+        return -1;
+    }
+    memcpy(p_key, &plain[1], CARD_KEY_LEN);
+
+    /* 写入序号延续上次， 避免重复IV */
+    g_save_seq = ((uint32_t)p_rec->iv[0] << 24) | ((uint32_t)p_rec->iv[1] << 16) |
+                 ((uint32_t)p_rec->iv[2] << 8)  |  (uint32_t)p_rec->iv[3];
+    return p_rec->cipher;
+}
+
+/**
+ * 按旧格式（DES）解析
+ */
+static int __des_decode (const card_key_rec_t *p_rec,
+                         uint8_t              *p_key,
+                         const uint8_t        *p_uid_key)
+{
+    uint8_t plain[8];
+
+    des_key_setup_cached(&g_des_ctx, p_uid_key);
+    des_block_process(&g_des_ctx, (uint8_t *)p_rec, plain, DECRYPTION_MODE);
+    if (__KEY_VALID != plain[0]) {
+        return -1;
+    }
+    memcpy(p_key, &plain[1], CARD_KEY_LEN);
+    return CARD_KEY_CIPHER_DES;
+}
+
+/**
+ * 读取并解析， 调用者需持有__g_lock
+ */
+static int __load (uint8_t *p_key, const uint8_t *p_uid_key)
+{
+    card_key_rec_t rec;
+    int            cipher;
+
+    if (AW_OK != aw_nvram_get(ACP1000_EEPROM_NAME, __KEY_UNIT,
+                              (char *)&rec, 0, sizeof(rec))) {
+        return -1;
+    }
+
+    /* 旧格式的DES密文可能恰好具有新格式的头， 新格式解析失败时再按旧格式解析 */
+    cipher = __rec_decode(&rec, p_key, p_uid_key);
+    if (cipher < 0) {
+        cipher = __des_decode(&rec, p_key, p_uid_key);
+    }
+    return cipher;
+}
+
+/**
+ * 加密并写入， 调用者需持有__g_lock
+ */
+static bool_t __save (const uint8_t *p_key, const uint8_t *p_uid_key)
+{
+    card_key_rec_t rec;
+    uint8_t        plain[AES128_BLOCK_SIZE];
+    uint32_t       len;
+
+#if ACP1000_CARD_KEY_CIPHER == CARD_KEY_CIPHER_DES
+    memset(plain, 0, sizeof(plain));
+    plain[0] = __KEY_VALID;
+    memcpy(&plain[1], p_key, CARD_KEY_LEN);
+
+    des_key_setup_cached(&g_des_ctx, p_uid_key);
+    des_block_process(&g_des_ctx, plain, (uint8_t *)&rec, ENCRYPTION_MODE);
+    len = 8;
+#else
+    uint8_t   iv[AES128_BLOCK_SIZE];
+    aw_tick_t tick = aw_sys_tick_get();
+
+    memset(plain, 0, sizeof(plain));
+    plain[0] = __KEY_VALID;
+    memcpy(&plain[1], p_key, CARD_KEY_LEN);
+    plain[AES128_BLOCK_SIZE - 1] = __sum_check(plain, AES128_BLOCK_SIZE - 1);
+
+    /**
+     * IV: 写入序号(4) + 系统节拍(4) + 0(8)
+     * CTR模式只加密一块， 低位计数不会进位到序号
+     */
+    g_save_seq++;
+    memset(rec.iv, 0, sizeof(rec.iv));
+    rec.iv[0] = (g_save_seq >> 24) & 0xFF;
+    rec.iv[1] = (g_save_seq >> 16) & 0xFF;
+    rec.iv[2] = (g_save_seq >> 8) & 0xFF;
+    rec.iv[3] = g_save_seq & 0xFF;
+    rec.iv[4] = (tick >> 24) & 0xFF;
+    rec.iv[5] = (tick >> 16) & 0xFF;
+    rec.iv[6] = (tick >> 8) & 0xFF;
+    rec.iv[7] = tick & 0xFF;
+
+    rec.magic   = __FMT_MAGIC;
+    rec.version = __FMT_VERSION;
+    rec.cipher  = ACP1000_CARD_KEY_CIPHER;
+    rec.check   = 0;
+    rec.check   = __sum_check(&rec.magic, AW_OFFSET(card_key_rec_t, dat));
+
+    __aes_key_setup(p_uid_key);
+    memcpy(iv, rec.iv, sizeof(iv));
+#if ACP1000_CARD_KEY_CIPHER == CARD_KEY_CIPHER_AES_CTR
+    aes128_ctr_crypt(&g_aes_ctx, iv, plain, rec.dat, AES128_BLOCK_SIZE);
+#else
+    aes128_cbc_encrypt(&g_aes_ctx, iv, plain, rec.dat, AES128_BLOCK_SIZE);
+#endif
+    len = sizeof(rec);
+#endif
+
+    if (AW_OK == aw_nvram_set(ACP1000_EEPROM_NAME, __KEY_UNIT,
+                              (char *)&rec, 0, len)) {
+        return TRUE;
+    }
+    return FALSE;
+}
+
+/******************************************************************************/
+void card_key_init (void)
+{
+    AW_MUTEX_INIT(__g_lock, AW_SEM_Q_PRIORITY);
+}
+
+bool_t card_key_load (uint8_t *p_key, const uint8_t *p_uid_key)
+{
+    int cipher;
+
+    AW_MUTEX_LOCK(__g_lock, AW_SEM_WAIT_FOREVER);
+    cipher = __load(p_key, p_uid_key);
+    if ((cipher >= 0) && (ACP1000_CARD_KEY_CIPHER != cipher)) {
+        /* 迁移为当前配置的格式， 失败时下次上电重试 */
+        __save(p_key, p_uid_key);
+    }
+    AW_MUTEX_UNLOCK(__g_lock);
+
+    return (cipher >= 0) ? TRUE : FALSE;
+}
+
+bool_t card_key_save (const uint8_t *p_key, const uint8_t *p_uid_key)
+{
+    bool_t ret;
+
+    AW_MUTEX_LOCK(__g_lock, AW_SEM_WAIT_FOREVER);
+    ret = __save(p_key, p_uid_key);
+    AW_MUTEX_UNLOCK(__g_lock);
+
+    return ret;
+}
+
+int card_key_cipher_get (const uint8_t *p_uid_key)
+{
+    uint8_t key[CARD_KEY_LEN];
+    int     cipher;
+
+    AW_MUTEX_LOCK(__g_lock, AW_SEM_WAIT_FOREVER);
+    cipher = __load(key, p_uid_key);
+    AW_MUTEX_UNLOCK(__g_lock);
+
+    return cipher;
+}
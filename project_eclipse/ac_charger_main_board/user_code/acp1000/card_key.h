@@ -0,0 +1,74 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 卡密钥加密存储（EEPROM单元6）
+ *
+ * 卡密钥以MCU UID为密钥加密后保存。存储格式带版本号：
+ * - 旧格式： 前8字节为DES密文（0x55 + 6字节卡密钥 + 填充）
+ * - 新格式： 4字节头 + 16字节IV + 16字节AES-128密文
+ *
+ * 加载时先按新格式解析， 失败再按旧格式解析， 旧格式加载成功后按当前配置的
+ * 加密方式重新写入， 实现上电透明迁移。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-09-26  xjc, first implementation
+ * \endinternal
+ */
+
+#ifndef __CARD_KEY_H
+#define __CARD_KEY_H
+
+#include "apollo.h"
+#include "ac_charge_prj_cfg.h"
+
+/**
+ * \brief 卡密钥加密方式（ACP1000_CARD_KEY_CIPHER）
+ * \anchor grp_card_key_cipher
+ * @{
+ */
+#define CARD_KEY_CIPHER_DES       0   /**< \brief DES（旧格式）    */
+#define CARD_KEY_CIPHER_AES_CTR   1   /**< \brief AES-128-CTR    */
+#define CARD_KEY_CIPHER_AES_CBC   2   /**< \brief AES-128-CBC    */
+/** @} */
+
+#define CARD_KEY_LEN              6   /* 卡密钥字节数 */
+#define CARD_KEY_UID_LEN          16  /* MCU UID字节数（AES使用全部， DES使用前8字节） */
+
+/**
+ * \brief 初始化（在其他接口之前调用一次）
+ */
+void card_key_init (void);
+
+/**
+ * \brief 从EEPROM加载卡密钥（旧格式自动迁移）
+ * \param[out] p_key     : 卡密钥
+ * \param[in]  p_uid_key : MCU UID
+ * \retval TRUE  : 加载成功
+ * \retval FALSE : 没有有效的卡密钥
+ */
+bool_t card_key_load (uint8_t *p_key, const uint8_t *p_uid_key);
+
+/**
+ * \brief 按ACP1000_CARD_KEY_CIPHER配置的方式加密并写入卡密钥
+ */
+bool_t card_key_save (const uint8_t *p_key, const uint8_t *p_uid_key);
+
+/**
+ * \brief 获取EEPROM中卡密钥的加密方式
+ * \return \ref grp_card_key_cipher， 无有效密钥时返回-1
+ */
+int card_key_cipher_get (const uint8_t *p_uid_key);
+
+#endif
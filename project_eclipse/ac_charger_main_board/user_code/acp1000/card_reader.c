@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief ʵ
+ * \brief 读卡器实例
  *
  * \internal
  * \par modification history:
@@ -30,8 +30,10 @@
 #include "aw_vdebug.h"
 #include "cardreader/aw_iccreader.h"
 #include "ac_charge_prj_cfg.h"
-#include "des/des.h"
+#include "card_key.h"
 #include "aw_nvram.h"
+#include "lat_hist.h"
+#include "task_wdt.h"
 
 #define LOCK_TO_CARD(p_this, p_role) \
     struct card_reader *p_this = AW_CONTAINER_OF(p_role, struct card_reader, p_card_lock)
@@ -52,7 +54,18 @@ extern void acp1000_overtime_check_restart();
 extern void acp1000_buzzer_on (void);
 /* =======================================================================  */
 /**
- * ȡ
+ * 卡数据所在的块（扇区0的块1 - 3）
+ */
+static const uint8_t g_card_blocks[] = {1, 2, 3};
+
+/**
+ * 卡读取统计（调试用）
+ */
+aw_iccreader_read_stat_t g_card_read_stat;
+
+/**
+ * 读取卡扇区数据
+ * 射频在刷卡处理完成后由卡探测任务关闭
  */
 static aw_err_t card_data_read (card_reader_t        *p_this,
                                 uint8_t              *p_id_buf,
@@ -60,82 +73,22 @@ static aw_err_t card_data_read (card_reader_t        *p_this,
                                 uint8_t              *p_key,
                                 uint8_t              *p_blk_dat)
 {
-#define STATE_CARD_ACTIVE   0  /*  */
-#define STATE_CARD_KEYAUTH  1  /* ֤Կ */
-#define STATE_CARD_BLKREAD  2  /* ȡ */
-
-
-    int      retry = 0, i = 1;
-    uint8_t  state = 1;
-    uint8_t  buf[32], len;   /* Ϊ30 */
-
-    aw_iccreader_s50s70_ci_t ci;
-
-
     aw_iccreader_rf_open(p_this->dat.p_card_driver);
 
-    while (retry <= 3) {
-
-        switch (state) {
-
-        /*  */
-        case STATE_CARD_ACTIVE:
-            if (AW_OK != aw_iccreader_s50s70_active (p_this->dat.p_card_driver, &ci)) {
-                retry++;
-            } else {
-                state = STATE_CARD_KEYAUTH;
-
-            }
-            break;
-
-        case STATE_CARD_KEYAUTH:
-            if (AW_OK !=
-                  aw_iccreader_key_auth(p_this->dat.p_card_driver,
-                                        AW_ICCREADER_KEY_AUTH_KEYTYPE_KEYA,
-                                        p_id_buf,
-                                        id_len,
-                                        p_key,
-                                        6,
-                                        0)) {
-
-
-                state = STATE_CARD_ACTIVE; /* ֤ʧ¼ */
-                retry++;
-            } else {
-                state = STATE_CARD_BLKREAD;
-                i     = 1;
-            }
-            break;
-
-        case STATE_CARD_BLKREAD:
-//            aw_iccreader_block_write(p_this->dat.p_card_driver,
-//                                       g_admin_buf,
-//                                       4);
-            if (AW_OK != aw_iccreader_block_read(p_this->dat.p_card_driver,
-                                                   &p_blk_dat[(i-1) * 16],
-                                                   i)) {
-                state = STATE_CARD_ACTIVE; /* ֤ʧ¼ */
-                retry++;
-            } else {
-                i++;
-                if (i >= 4) {
-                    aw_iccreader_rf_close(p_this->dat.p_card_driver);
-                    return AW_OK;
-                }
-            }
-            break;
-
-        default :
-            break;
-        }
-    }
-    aw_iccreader_rf_close(p_this->dat.p_card_driver);
-    return AW_ERROR;
+    return aw_iccreader_s50s70_blocks_read(p_this->dat.p_card_driver,
+                                           AW_ICCREADER_KEY_AUTH_KEYTYPE_KEYA,
+                                           p_id_buf,
+                                           p_key,
+                                           g_card_blocks,
+                                           sizeof(g_card_blocks),
+                                           p_blk_dat,
+                                           3,
+                                           &g_card_read_stat);
 }
 
-/* ===============================ɫ===================================  */
+/* ===============================扮演者与角色===================================  */
 
-static role_ret play(role_t **pp_role, void *p_arg)  /*  */
+static role_ret play(role_t **pp_role, void *p_arg)  /* 扮演 */
 {
     if ((*pp_role)->pfn_role_do) {
         return (*pp_role)->pfn_role_do(pp_role, p_arg);
@@ -144,8 +97,8 @@ static role_ret play(role_t **pp_role, void *p_arg)  /* 
 }
 
 /**
- * Ƭʶ
- * p_arg : ĿƬID
+ * 卡片识别器
+ * p_arg : 传入的卡片ID
  */
 static role_ret card_reco_do (struct role **pp_role, void *p_arg)
 {
@@ -156,7 +109,7 @@ static role_ret card_reco_do (struct role **pp_role, void *p_arg)
 
 
     if (0 == memcmp(&p_this->dat.id, p_id_buf, 4)) {
-        /*  Ƚ */
+        /* 读卡数据 并比较 */
         if (AW_OK != card_data_read(p_this,
                                     p_id_buf,
                                     4,
@@ -171,15 +124,15 @@ static role_ret card_reco_do (struct role **pp_role, void *p_arg)
         aw_mdelay(200);
         return CARD_RECO_SAME;
     } else {
-        /* ͬĿ */
+        /* 不相同的卡 */
         event_node_tell_all(&p_this->evt_node, CARD_AUTH_ING, NULL);
         return CARD_RECO_DIFF;
     }
 }
 
 /**
- * Ƭ
- * p_arg : ĿƬʶ
+ * 卡片解锁器
+ * p_arg : 传入的卡片识别器处理结果
  */
 static role_ret card_lock_do (struct role **pp_role, void *p_arg)
 {
@@ -189,17 +142,17 @@ static role_ret card_lock_do (struct role **pp_role, void *p_arg)
     switch (result) {
 
     case CARD_RECO_SAME:
-        /* ¼ */
+        /* 发出解锁事件 */
         event_node_tell_all(&p_this->evt_node, SCREEN_UNLOCK, NULL);
 
-        /* ˢɹ𿨣ˢµˢ¼ */
+        /* 刷卡成功，挂起卡，须重新刷卡方能启动新的刷卡事件 */
         aw_iccreader_halt(p_this->dat.p_card_driver);
 #if ACP1000_OVERTIME_DETECT
        acp1000_overtime_check_restart();
 #endif
         break;
 
-    /* ЧͲͬ */
+    /* 无效卡和不相同卡，无做其他处理 */
     case CARD_RECO_DIFF   :
     case CARD_RECO_INVAID :
         break;
@@ -207,11 +160,68 @@ static role_ret card_lock_do (struct role **pp_role, void *p_arg)
 }
 
 
+#if ACP1000_HUB4G_AUTH
+/**
+ * 等待集中器鉴权结果
+ */
+static aw_err_t card_hub4g_auth_wait (card_reader_t *p_this)
+{
+    aw_err_t ret;
+
+    ret = AW_SEMB_TAKE(p_this->p_pile_sem->hub4g_auth_sem,
+                       aw_ms_to_ticks(ACP1000_WAIT_KEY_TIMEOUT));
+    if (ret == -ETIME) {
+       return AW_ERROR;
+    }
+    ret = AW_SEMB_TAKE(p_this->p_pile_sem->hub4g_cctrl_sem,
+                       aw_ms_to_ticks(ACP1000_WAIT_KEY_TIMEOUT));
+    if (ret == -ETIME) {
+        return AW_ERROR;
+    }
+    /* 判断是否允许充电 */
+    card_reader_dev_lock(p_this);
+    if (!(p_this->dat.allow_charge)) {
+        card_reader_dev_unlock(p_this);
+        return AW_ERROR;
+    }
+    card_reader_dev_unlock(p_this);
+    return AW_OK;
+}
+
+#if ACP1000_CARD_WL
+/**
+ * 按离线卡名单鉴权
+ * 返回AW_OK： 允许充电； -AW_EPERM： 不允许充电； -AW_ENOENT： 需等待集中器鉴权
+ */
+static aw_err_t card_wl_auth (card_reader_t *p_this, uint8_t *p_id_buf)
+{
+    uint8_t state;
+    bool_t  lost;
+
+    card_reader_dev_lock(p_this);
+    state = card_wl_lookup(&p_this->wl, p_id_buf);
+    lost  = p_this->hub4g_lost;
+    card_reader_dev_unlock(p_this);
+
+    if (CARD_WL_STATE_ALLOW == state) {
+        return AW_OK;
+    }
+    if (CARD_WL_STATE_DENY == state) {
+        return -AW_EPERM;
+    }
+    if (lost) {
+        return ACP1000_CARD_WL_OFFLINE_ALLOW ? AW_OK : -AW_EPERM;
+    }
+    return -AW_ENOENT;
+}
+#endif
+#endif
+
 /**
- * ƬȨ
- * ڣʱ
- * ȨƬ ͬߵǰȨЧ⿨Ƭ
- * p_arg : ĿƬID
+ * 卡片鉴权器
+ * 生命周期：充电空闲时
+ * 鉴权卡片： 不相同卡或者当前鉴权无效的其他任意卡片
+ * p_arg : 传入的卡片ID
  */
 static role_ret card_auth_do (struct role **pp_role, void *p_arg)
 {
@@ -224,9 +234,9 @@ static role_ret card_auth_do (struct role **pp_role, void *p_arg)
 
 #if ACP1000_HUB4G_AUTH
     if (!(p_this->dat.key_vaild)) {
-        // todo 濨ƬID
+        // todo 保存卡片ID
         event_node_tell_all(&p_this->evt_node, CARD_WAIT_KEY, p_arg);
-        // todo ȴԿ·
+        // todo 等待密钥下发
         ret = AW_SEMB_TAKE(p_this->p_pile_sem->hub4g_key_sem,
                            aw_ms_to_ticks(ACP1000_WAIT_KEY_TIMEOUT));
         if (ret == -ETIME) {
@@ -234,45 +244,38 @@ static role_ret card_auth_do (struct role **pp_role, void *p_arg)
            return AW_ERROR;
         }
     } else {
-        /* ȴԿֱӷID */
+        /* 无需等待卡密钥，直接发送ID */
         event_node_tell_all(&p_this->evt_node, CARD_AUTH_ID, p_arg);
     }
 #else
     memcpy(p_this->dat.key, key, 6);
 #endif
-    // todo Ƭ
+    // todo 读卡片数据
     if (AW_OK != card_data_read(p_this, p_id_buf, 4, p_this->dat.key, blk_dat)) {
         event_node_tell_all(&p_this->evt_node, CARD_AUTH_FAIL, NULL);
         return AW_ERROR;
     }
-    // todo Ȩ¼
+    // todo 发起鉴权中事件
     event_node_tell_all(&p_this->evt_node, CARD_AUTH_ING, NULL);
 
-    // todo Ƭˢɹ¼
+    // todo 发起卡片刷卡成功事件
     event_node_tell_all(&p_this->evt_node, CARD_SWING_OK, blk_dat);
 
-    // todo ȴȨ
+    // todo 等待鉴权结果
 #if ACP1000_HUB4G_AUTH
-    ret = AW_SEMB_TAKE(p_this->p_pile_sem->hub4g_auth_sem,
-                       aw_ms_to_ticks(ACP1000_WAIT_KEY_TIMEOUT));
-    if (ret == -ETIME) {
-        event_node_tell_all(&p_this->evt_node, CARD_AUTH_FAIL, NULL);
-       return AW_ERROR;
+#if ACP1000_CARD_WL
+    /* 名单中的卡直接鉴权， 不等待集中器应答 */
+    ret = card_wl_auth(p_this, p_id_buf);
+    if (-AW_ENOENT == ret) {
+        ret = card_hub4g_auth_wait(p_this);
     }
-    ret = AW_SEMB_TAKE(p_this->p_pile_sem->hub4g_cctrl_sem,
-                       aw_ms_to_ticks(ACP1000_WAIT_KEY_TIMEOUT));
-    if (ret == -ETIME) {
-        event_node_tell_all(&p_this->evt_node, CARD_AUTH_FAIL, NULL);
-        return AW_ERROR;
-    }
-    /* жǷ */
-    card_reader_dev_lock(p_this);
-    if (!(p_this->dat.allow_charge)) {
-        card_reader_dev_unlock(p_this);
+#else
+    ret = card_hub4g_auth_wait(p_this);
+#endif
+    if (AW_OK != ret) {
         event_node_tell_all(&p_this->evt_node, CARD_AUTH_FAIL, NULL);
         return AW_ERROR;
     }
-    card_reader_dev_unlock(p_this);
 #endif
     card_reader_dev_lock(p_this);
     if (p_this->pile_order) {
@@ -287,14 +290,14 @@ static role_ret card_auth_do (struct role **pp_role, void *p_arg)
     memcpy(p_this->dat.blk_dat, blk_dat, sizeof(blk_dat));
 
 //    if (0 == strcmp(g_admin_buf, blk_dat)) {
-//        /* Ա */
+//        /* 管理员卡 */
 //        event_node_tell_all(&p_this->evt_node, CARD_ADMIN_MODE, (void *)TRUE);
 //        aw_mdelay(300);
 //    }
 
     event_node_tell_all(&p_this->evt_node, CARD_AUTH_SUS, NULL);
 //    aw_card_reader_detect_enable(p_this->dat.p_card_driver, TRUE);
-//    /* ˢɹ𿨣ˢµˢ¼ */
+//    /* 刷卡成功，挂起卡，须重新刷卡方能启动新的刷卡事件 */
 //    aw_card_reader_halt(p_this->dat.p_card_driver);
 //    aw_card_reader_detect_enable(p_this->dat.p_card_driver, FALSE);
 
@@ -306,49 +309,38 @@ static role_ret card_auth_do (struct role **pp_role, void *p_arg)
 
 void static event_driver(struct event_node *p_evt, event_t event, void *p_arg);
 
-static uint8_t g_sample_buf[1+ACP1000_EEPROM_CARD_KEY] = {0}; /* ܻܵ*/
-static uint8_t g_des_buf[8] = {0};                     /* ݻ*/
-static key_set g_key_sets[17];                         /* Կ */
+#if ACP1000_CARD_WL
 /**
- * EEPROMؿԿ
- * ûпɼؿԿʧܣFALSE
- * سɹTRUE
+ * 离线卡名单操作（只更新索引， Flash由名单写入任务写入）
  */
-static bool_t card_key_load_from_eeprom(uint8_t *p_key, uint8_t *p_des_key)
+static void card_wl_op_do (card_reader_t *p_this, card_wl_op_t *p_op)
 {
-    if(AW_OK == aw_nvram_get(ACP1000_EEPROM_NAME, 6, (char *)g_sample_buf, 0, 8)) {
-        des_sub_keys_generate(p_des_key, g_key_sets);
-        des_message_process(&g_sample_buf[0], g_des_buf, g_key_sets, 0);
-        if (0x55 == g_des_buf[0]) {
-            /* ԿЧ */
-            memcpy(p_key, &g_des_buf[1], 6);
-            return TRUE;
-        }
-    }
-    return FALSE;
-}
+    switch (p_op->cmd) {
 
-/**
- * EEPROMд뿨Կ
- * ʧܣFALSE
- *   ɹTRUE
- */
-static bool_t card_key_save_to_eeprom(uint8_t *p_key, uint8_t *p_des_key)
-{
-    g_sample_buf[0] = 0x55;
-    memcpy(&g_sample_buf[1], p_key, 6);
+    case CARD_WL_CMD_ADD:
+        p_op->result = card_wl_update(&p_this->wl, p_op->uid,
+                                      CARD_WL_STATE_ALLOW, p_op->version);
+        break;
 
-    des_sub_keys_generate(p_des_key, g_key_sets);
-    des_message_process(g_sample_buf, g_des_buf, g_key_sets, 1);
+    case CARD_WL_CMD_DEL:
+        p_op->result = card_wl_update(&p_this->wl, p_op->uid,
+                                      CARD_WL_STATE_DENY, p_op->version);
+        break;
+
+    case CARD_WL_CMD_CLR:
+        p_op->result = card_wl_clear(&p_this->wl, p_op->version);
+        break;
 
-    if(AW_OK == aw_nvram_set(ACP1000_EEPROM_NAME, 6, (char *)g_des_buf, 0, 8)) {
-        return TRUE;
+    default:
+        p_op->result = AW_OK;
+        break;
     }
-    return FALSE;
+    card_wl_info_get(&p_this->wl, &p_op->wl_version, &p_op->wl_nums);
 }
+#endif
 
 /**
- * ʵʼ
+ * 读卡器实例初始化
  */
 void card_reader_inst_init (card_reader_t                 *p_this,
                             aw_iccreader_t                *p_card_driver,
@@ -372,17 +364,27 @@ void card_reader_inst_init (card_reader_t                 *p_this,
     p_this->pile_order        = FALSE;
     p_this->dat.p_des_key     = (uint8_t *)(p_pile->pile_dat.mcu_uid);
     /**
-     * ȡԿ
+     * 读取密钥
      */
-    if (card_key_load_from_eeprom(p_this->dat.key, p_this->dat.p_des_key)) {
+    card_key_init();
+    if (card_key_load(p_this->dat.key, p_this->dat.p_des_key)) {
         p_this->dat.key_vaild = TRUE;
     }
-    /* ʼ */
+#if ACP1000_CARD_WL
+    /**
+     * 加载离线卡名单
+     */
+    p_this->hub4g_lost = FALSE;
+    if (AW_OK != card_wl_init(&p_this->wl)) {
+        AW_INFOF(("card white list load failed\r\n"));
+    }
+#endif
+    /* 初始化读卡器 */
 //    aw_card_reader_zlg_inst_init(p_card_driver);
     aw_iccreader_inst_init(p_card_driver, p_card_transfer);
 }
 
-/*=============================¼==========================================*/
+/*=============================事件驱动==========================================*/
 void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
 {
     EVT_TO_CARD(p_this, p_evt);
@@ -394,7 +396,8 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
     switch (event) {
 
     case CARD_AUTH_SUS:
-        /* Ȩɹ */
+        /* 鉴权成功 */
+        LAT_HIST_END(LAT_HIST_CARD_AUTH);
         AW_MUTEX_LOCK(p_this->role_lock,AW_SEM_WAIT_FOREVER);
         p_this->p_card_reco = &card_reco;
         p_this->p_card_auth = &card_auth;
@@ -404,7 +407,8 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
         break;
 
     case CARD_AUTH_FAIL:
-        /* Ȩʧ */
+        /* 鉴权失败 */
+       LAT_HIST_END(LAT_HIST_CARD_AUTH);
        AW_MUTEX_LOCK(p_this->role_lock, AW_SEM_WAIT_FOREVER);
        p_this->p_card_reco = NULL;
        p_this->p_card_auth = &card_auth;
@@ -412,11 +416,16 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
        AW_MUTEX_UNLOCK(p_this->role_lock);
         break;
 
+    case CARD_AUTH_SUS_ORDER:
+        /* 预约桩鉴权成功 */
+        LAT_HIST_END(LAT_HIST_CARD_AUTH);
+        break;
+
     case CHARGE_MAN_START:
         acp1000_overtime_check_cancle();
 
     case CHARGE_PIEL_START:
-        /* 翪ʼ */
+        /* 充电开始 */
         AW_MUTEX_LOCK(p_this->role_lock, AW_SEM_WAIT_FOREVER);
         p_this->p_card_reco = &card_reco;
         p_this->p_card_auth = NULL;
@@ -426,7 +435,7 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
         break;
 
     case CHARGE_PILE_STOP:
-        /* 翪ʼ */
+        /* 充电开始 */
         AW_MUTEX_LOCK(p_this->role_lock, AW_SEM_WAIT_FOREVER);
         p_this->p_card_reco = NULL;
         p_this->p_card_auth = &card_auth;
@@ -440,7 +449,7 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
         p_this->dat.key_vaild = TRUE;
         card_reader_dev_unlock(p_this);
 
-        card_key_save_to_eeprom(p_this->dat.key, p_this->dat.p_des_key);
+        card_key_save((const uint8_t *)p_arg, p_this->dat.p_des_key);
         break;
 
     case HUB4G_ALLOW_CHARGE:
@@ -449,6 +458,18 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
         card_reader_dev_unlock(p_this);
         break;
 
+#if ACP1000_CARD_WL
+    case HUB4G_CARD_WL:
+        card_wl_op_do(p_this, (card_wl_op_t *)p_arg);
+        break;
+
+    case ERR_HUB4G_COMM:
+        card_reader_dev_lock(p_this);
+        p_this->hub4g_lost = arg ? TRUE : FALSE;
+        card_reader_dev_unlock(p_this);
+        break;
+#endif
+
     case HUB4G_PILE_ORDER:
         if (arg) {
             card_reader_dev_lock(p_this);
@@ -467,7 +488,7 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
 }
 
 
-/*=========================================================================*/
+/*=============================任务============================================*/
 
 static void card_swing_event (card_reader_t    *p_this,
                               uint8_t          *p_id_buf,
@@ -477,29 +498,30 @@ static void card_swing_event (card_reader_t    *p_this,
     role_t *p_auth = NULL;
     role_ret  ret;
 
+    LAT_HIST_START(LAT_HIST_CARD_AUTH);
     AW_MUTEX_LOCK(p_this->role_lock, AW_SEM_WAIT_FOREVER);
     p_reco = p_this->p_card_reco;
     p_auth = p_this->p_card_auth;
     AW_MUTEX_UNLOCK(p_this->role_lock);
 
     if (NULL != p_reco) {
-        /* пƬЧ  */
+        /* 有卡片有效  */
         ret = p_this->player.pfn_play(&p_this->p_card_reco, p_id_buf);
         if (NULL != p_auth) {
-            /* ǰ */
+            /* 充电前 */
             if (ret == CARD_RECO_DIFF) {
-                /* ͬĿҪ¼Ȩ */
+                /* 不相同的卡，需要重新鉴权 */
                 ret = p_this->player.pfn_play(&p_this->p_card_auth, p_id_buf);
             } else {
-                /* ͬĿƬҪȨֱӽ */
+                /* 相同的卡片不需要鉴权，直接解锁 */
                 ret = p_this->player.pfn_play(&p_this->p_card_lock, ret);
             }
         } else {
-            /*  */
+            /* 充电后 */
             ret = p_this->player.pfn_play(&p_this->p_card_lock, ret);
         }
     } else {
-        /* ޿ƬЧ  */
+        /* 无卡片有效  */
         ret = p_this->player.pfn_play(&p_this->p_card_auth, p_id_buf);
     }
 }
@@ -511,18 +533,104 @@ bool_t g_card_detect = TRUE;
 #define CARD_DETECT_PERIOD 500
 AW_TASK_DECL_STATIC(card_task, CARD_TACK_SIZE);
 
+/* 一轮最长为等待上报（或检测周期）加一次鉴权（等待密钥、 等待集中器应答） */
+#define CARD_WDT_MS     (ACP1000_CARD_AUTO_WAIT + ACP1000_WAIT_KEY_TIMEOUT + ACP1000_AUTH_TIMEOUT)
+TASK_WDT_DECL(__g_card_wdt);
+
 uint32_t g_card_detect_period = CARD_DETECT_PERIOD;
 
 /**
- * ̽
+ * 卡探测任务
  */
 #define TEST_TITLE "[Test IC Card] "
 #define TEST_CARD_UID_STR   TEST_TITLE"Card UID: "
 
+#if ACP1000_CARD_AUTO_DETECT
+/**
+ * 自动检测模式的卡探测
+ * 读卡模块检测到卡后主动上报， 任务阻塞在串口接收上； 每次等待超时时退出并重新进入
+ * 自动检测模式， 兼作读卡器通信检查。
+ */
+static void card_auto_detect_task (card_reader_t *p_this)
+{
+    aw_iccreader_t                  *p_card_reader = p_this->dat.p_card_driver;
+    aw_iccreader_auto_detect_cfg_t   cfg;
+    aw_iccreader_auto_detect_info_t  info;
+    bool_t                           running = FALSE;
+    int                              cnt     = 0;
+    aw_err_t                         ret;
+
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.req_code = 0x26;    /* IDLE请求， 停留在场内的卡不重复上报 */
+    cfg.auth_en  = FALSE;   /* 密钥可能更新， 验证及读块仍由鉴权器完成 */
+
+    while (1) {
+        TASK_WDT_BEAT(__g_card_wdt);
+        if (!g_card_detect) {
+            if (running) {
+                aw_iccreader_auto_detect_stop(p_card_reader);
+                running = FALSE;
+            }
+            aw_mdelay(g_card_detect_period);
+            continue;
+        }
+
+        if (!running) {
+            if (AW_OK != aw_iccreader_auto_detect_start(p_card_reader, &cfg)) {
+                if (++cnt >= 5) {
+                    /* 发起读卡器通信故障事件 */
+                    event_node_tell_all(&p_this->evt_node, ERR_CARD_READER, (void *)TRUE);
+                }
+                aw_mdelay(g_card_detect_period);
+                continue;
+            }
+            if (cnt >= 5) {
+                /* 发起读卡器通信正常事件 */
+                event_node_tell_all(&p_this->evt_node, ERR_CARD_READER, (void *)FALSE);
+            }
+            cnt     = 0;
+            running = TRUE;
+        }
+
+        ret = aw_iccreader_auto_detect_wait(p_card_reader,
+                                            &info,
+                                            ACP1000_CARD_AUTO_WAIT);
+        if (AW_OK == ret) {
+            /* 模块上报后已退出自动检测， 刷卡处理完成后重新进入 */
+            running = FALSE;
+            AW_INFOF((TEST_CARD_UID_STR"%02X%02X%02X%02X\r\n",
+                      info.ci.uid[3], info.ci.uid[2], info.ci.uid[1], info.ci.uid[0]));
+            card_swing_event(p_this, info.ci.uid, 4);
+            aw_iccreader_rf_close(p_card_reader);
+        } else if (-AW_ETIMEDOUT == ret) {
+            /* 无卡， 退出后重新进入以检查通信 */
+            aw_iccreader_auto_detect_stop(p_card_reader);
+            running = FALSE;
+        } else {
+            /* 帧错误， 重新进入自动检测 */
+            aw_iccreader_auto_detect_stop(p_card_reader);
+            running = FALSE;
+        }
+    }
+}
+
+static void card_detect_task (void *p_arg)
+{
+    card_reader_t *p_this = (card_reader_t *)p_arg;
+
+    if ((NULL == p_this) ||
+        (NULL == p_this->dat.p_card_driver)) {
+        return;
+    }
+
+    card_auto_detect_task(p_this);
+}
+#else
+
 static void card_detect_task (void *p_arg)
 {
-#define CARD_READER_STATE_INFO_GET      0 /* ȡϢ */
-#define CARD_READER_STATE_ACTIVE        4 /*  */
+#define CARD_READER_STATE_INFO_GET      0 /* 获取读卡器信息 */
+#define CARD_READER_STATE_ACTIVE        4 /* 卡激活 */
 
     int check = 0, cnt = 0, tick = 0;
     uint8_t  state = CARD_READER_STATE_ACTIVE;
@@ -541,31 +649,32 @@ static void card_detect_task (void *p_arg)
     p_card_reader = p_this->dat.p_card_driver;
 
     while (1) {
+        TASK_WDT_BEAT(__g_card_wdt);
         switch (state) {
 
-        case CARD_READER_STATE_INFO_GET: /* ȡϢ */
+        case CARD_READER_STATE_INFO_GET: /* 获取读卡器信息 */
             led_state = !led_state;
 //            if (AW_OK != aw_iccreader_info_get(p_card_reader, &info, 8+8+1+23)) {
             if (AW_OK != aw_iccreader_led_set(p_card_reader, led_state, TRUE)) {
                 cnt++;
                 if (cnt >= 5) {
-                /* ͨŹ¼ */
+                /* 发起读卡器通信故障事件 */
                     event_node_tell_all(&p_this->evt_node, ERR_CARD_READER, TRUE);
                 }
             } else {
-                /* ͨ¼ */
+                /* 发起读卡器通信正常事件 */
                 event_node_tell_all(&p_this->evt_node, ERR_CARD_READER, FALSE);
                 cnt   = 0;
                 state = CARD_READER_STATE_ACTIVE;
             }
             break;
 
-        case CARD_READER_STATE_ACTIVE :      /* ƬȡUID */
+        case CARD_READER_STATE_ACTIVE :      /* 激活卡片获取UID */
             if (g_card_detect) {
                   aw_iccreader_rf_open(p_card_reader);
                   if (AW_OK == aw_iccreader_s50s70_active (p_card_reader, &ci)) {
-                    aw_iccreader_rf_close(p_card_reader);
-                    /* ӡUID */
+                    /* 射频保持打开， 鉴权器读卡时无需重新打开 */
+                    /* 打印卡的UID */
                     AW_INFOF((TEST_CARD_UID_STR));
                     for(cnt = 0; (cnt < ci.uid_len) && (cnt < 4); cnt++) {
                          AW_INFOF(("%X", ci.uid[ci.uid_len-cnt-1]));
@@ -574,11 +683,11 @@ static void card_detect_task (void *p_arg)
 
                     uint8_t admin_id[] = {0x20, 0x8E, 0x83, 0xE0};
                     //if (0 == memcmp(admin_id, ci.uid, 4)) {
-                        /* Ա */
+                        /* 管理员卡 */
                    //     event_node_tell_all(&p_this->evt_node, CARD_ADMIN_MODE, (void *)TRUE);
                    //     aw_mdelay(300);
                    // } else {
-                        /* ˢ¼ */
+                        /* 刷卡事件发生 */
                         card_swing_event(p_this, ci.uid, 4);
                    // }
                 }
@@ -596,18 +705,24 @@ static void card_detect_task (void *p_arg)
         aw_mdelay(g_card_detect_period);
     }
 }
+#endif /* ACP1000_CARD_AUTO_DETECT */
 
 void card_reader_task_startup (card_reader_t *p_this)
 {
-    /* ʼled_task */
-    AW_TASK_INIT(card_task,              /* ʵ */
-                 "card_task",            /*  */
-                 CARD_TASK_PRIO,         /* ȼ */
-                 CARD_TACK_SIZE,         /* ջС */
-                 card_detect_task,       /* ں */
-                 (void *)p_this);        /* ڲ */
-    /*  */
+    TASK_WDT_ADD(__g_card_wdt, "card_task", CARD_WDT_MS + TASK_WDT_SLACK_MS);
+    /* 初始化任务led_task */
+    AW_TASK_INIT(card_task,              /* 任务实体 */
+                 "card_task",            /* 任务名字 */
+                 CARD_TASK_PRIO,         /* 任务优先级 */
+                 CARD_TACK_SIZE,         /* 任务堆栈大小 */
+                 card_detect_task,       /* 任务入口函数 */
+                 (void *)p_this);        /* 任务入口参数 */
+    /* 启动任务 */
     AW_TASK_STARTUP(card_task);
+
+#if ACP1000_CARD_WL
+    card_wl_task_startup(&p_this->wl);
+#endif
 }
 
 
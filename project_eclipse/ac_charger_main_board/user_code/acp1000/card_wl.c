@@ -0,0 +1,460 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 离线卡名单（SPI Flash存储， RAM哈希索引）
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-09-20  xjc, first implementation
+ * - 1.01 16-10-18  xjc, Flash写入移到名单写入任务， 写入块前显式擦除
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include "string.h"
+#include "aw_nvram.h"
+#include "aw_sem.h"
+#include "aw_task.h"
+#include "aw_system.h"
+#include "aw_vdebug.h"
+#include "aw_spinlock.h"
+#include "awbus_lite.h"
+#include "driver/norflash/awbl_spi_flash.h"
+#include "boot/boot_cfg.h"
+#include "card_wl.h"
+#include "perf_stat.h"
+
+/**
+ * Flash中的名单记录
+ */
+typedef struct card_wl_rec {
+    uint8_t   uid[4];       /* 卡ID */
+    uint32_t  version;      /* 名单版本号 */
+    uint8_t   state;        /* 卡状态， CARD_WL_STATE_NONE为仅记录版本号， 0xFF为空记录 */
+    uint8_t   reserved[6];  /* 保留 */
+    uint8_t   check;        /* 校验 */
+}card_wl_rec_t;
+
+#define __REC_SIZE      sizeof(card_wl_rec_t)
+#define __REC_PER_PAGE  (CARD_WL_PAGE_SIZE / __REC_SIZE)
+#define __REC_MAX       (CARD_WL_NVRAM_SIZE / __REC_SIZE)
+#define __BLOCK_SIZE    4096   /* Flash擦除块大小 */
+#define __HASH_MASK     (ACP1000_CARD_WL_HASH_SIZE - 1)
+
+#define CARD_WL_TASK_PRIO     6       /* 低于各应用任务 */
+#define CARD_WL_TACK_SIZE     1024
+#define CARD_WL_RETRY_MS      10000   /* 写入失败后重试的间隔 */
+AW_TASK_DECL_STATIC(card_wl_task, CARD_WL_TACK_SIZE);
+
+#if (ACP1000_CARD_WL_HASH_SIZE & __HASH_MASK) || \
+    (ACP1000_CARD_WL_HASH_SIZE <= ACP1000_CARD_WL_MAX)
+#error "ACP1000_CARD_WL_HASH_SIZE must be a power of 2 and larger than ACP1000_CARD_WL_MAX"
+#endif
+
+static inline uint32_t __uid_get (const uint8_t *p_uid)
+{
+    return  (uint32_t)p_uid[0]        | ((uint32_t)p_uid[1] << 8) |
+           ((uint32_t)p_uid[2] << 16) | ((uint32_t)p_uid[3] << 24);
+}
+
+static uint8_t __rec_check (const card_wl_rec_t *p_rec)
+{
+    const uint8_t *p   = (const uint8_t *)p_rec;
+    uint8_t        sum = 0;
+    uint8_t        i;
+
+    for (i = 0; i < __REC_SIZE - 1; i++) {
+        sum += p[i];
+    }
+    return ~sum;
+}
+
+/**
+ * \brief 哈希查找（线性探测）
+ * \return 卡所在的槽， 不存在时为可插入的空槽， 表满返回-1
+ */
+static int __slot_find (card_wl_t *p_this, uint32_t uid)
+{
+    uint32_t idx = uid * 2654435761UL;
+    uint32_t i;
+
+    idx = (idx ^ (idx >> 16)) & __HASH_MASK;
+    for (i = 0; i < ACP1000_CARD_WL_HASH_SIZE; i++) {
+        if ((CARD_WL_STATE_NONE == p_this->state[idx]) ||
+            (p_this->uid[idx] == uid)) {
+            return idx;
+        }
+        idx = (idx + 1) & __HASH_MASK;
+    }
+    return -1;
+}
+
+/**
+ * \brief 更新索引
+ */
+static aw_err_t __index_set (card_wl_t *p_this, uint32_t uid, uint8_t state)
+{
+    int slot = __slot_find(p_this, uid);
+
+    if (slot < 0) {
+        return -AW_ENOSPC;
+    }
+
+    if (CARD_WL_STATE_NONE == p_this->state[slot]) {
+        /* 撤销不在名单中的卡也须记录， 否则离线时该卡按名单外的卡处理 */
+        if (p_this->nums >= ACP1000_CARD_WL_MAX) {
+            return -AW_ENOSPC;
+        }
+        p_this->uid[slot] = uid;
+        p_this->nums++;
+    }
+
+    if ((CARD_WL_STATE_ALLOW == p_this->state[slot]) &&
+        (CARD_WL_STATE_ALLOW != state)) {
+        p_this->allow_nums--;
+    } else if ((CARD_WL_STATE_ALLOW != p_this->state[slot]) &&
+               (CARD_WL_STATE_ALLOW == state)) {
+        p_this->allow_nums++;
+    }
+    p_this->state[slot] = state;
+
+    return AW_OK;
+}
+
+/**
+ * \brief 追加一条记录（重写当前页， NOR Flash对已写入的相同内容重写无影响）
+ */
+static aw_err_t __rec_append (card_wl_t *p_this, const card_wl_rec_t *p_rec)
+{
+    uint32_t page = p_this->rec_nums / __REC_PER_PAGE;
+    uint32_t pos  = p_this->rec_nums % __REC_PER_PAGE;
+    aw_err_t ret;
+    PERF_STAT_DECL(t0);
+
+    PERF_STAT_BEGIN(t0);
+    if (0 == pos) {
+        /* 进入新的块时先擦除整块 */
+        if (0 == (page * CARD_WL_PAGE_SIZE) % __BLOCK_SIZE) {
+            ret = awbl_spi_flash_nvram_erase(CARD_WL_NVRAM_NAME,
+                                             0,
+                                             page * CARD_WL_PAGE_SIZE,
+                                             __BLOCK_SIZE);
+            if (AW_OK != ret) {
+                return ret;
+            }
+        }
+        memset(p_this->page_buf, 0xFF, sizeof(p_this->page_buf));
+    }
+    memcpy(&p_this->page_buf[pos * __REC_SIZE], p_rec, __REC_SIZE);
+
+    ret = aw_nvram_set(CARD_WL_NVRAM_NAME,
+                       0,
+                       (char *)p_this->page_buf,
+                       page * CARD_WL_PAGE_SIZE,
+                       CARD_WL_PAGE_SIZE);
+    PERF_STAT_END(PERF_STAT_CARD_WL_WRITE, t0);
+    if (AW_OK == ret) {
+        p_this->rec_nums++;
+    }
+    return ret;
+}
+
+static void __rec_make (card_wl_rec_t *p_rec,
+                        uint32_t       uid,
+                        uint8_t        state,
+                        uint32_t       version)
+{
+    memset(p_rec, 0, sizeof(*p_rec));
+    p_rec->uid[0]  = uid & 0xFF;
+    p_rec->uid[1]  = (uid >> 8) & 0xFF;
+    p_rec->uid[2]  = (uid >> 16) & 0xFF;
+    p_rec->uid[3]  = (uid >> 24) & 0xFF;
+    p_rec->version = version;
+    p_rec->state   = state;
+    p_rec->check   = __rec_check(p_rec);
+}
+
+/**
+ * \brief 重新开始写入名单， 第一条记录为版本号
+ *
+ * 先擦除第一块之后的块， 第一块在写入第一页前擦除。 加载时读到空记录结束，
+ * 后面的块中不能留有旧记录。
+ */
+static aw_err_t __restart (card_wl_t *p_this, uint32_t version)
+{
+    card_wl_rec_t rec;
+    aw_err_t      ret;
+
+    p_this->rec_nums = 0;
+    ret = awbl_spi_flash_nvram_erase(CARD_WL_NVRAM_NAME,
+                                     0,
+                                     __BLOCK_SIZE,
+                                     CARD_WL_NVRAM_SIZE - __BLOCK_SIZE);
+    if (AW_OK != ret) {
+        return ret;
+    }
+
+    __rec_make(&rec, 0, CARD_WL_STATE_NONE, version);
+    return __rec_append(p_this, &rec);
+}
+
+/**
+ * \brief 记录写满后按索引重写名单（掉电时名单可能丢失， 由集中器按版本号0重新下发）
+ *
+ * 逐个槽加锁读取， 整理期间的更新同时登记在待写入队列中， 随后追加写入。
+ */
+static aw_err_t __compact (card_wl_t *p_this)
+{
+    card_wl_rec_t rec;
+    aw_err_t      ret;
+    uint32_t      version;
+    uint32_t      uid;
+    uint8_t       state;
+    uint32_t      i;
+
+    AW_MUTEX_LOCK(p_this->lock, AW_SEM_WAIT_FOREVER);
+    version = p_this->version;
+    AW_MUTEX_UNLOCK(p_this->lock);
+
+    ret = __restart(p_this, version);
+
+    for (i = 0; (AW_OK == ret) && (i < ACP1000_CARD_WL_HASH_SIZE); i++) {
+        AW_MUTEX_LOCK(p_this->lock, AW_SEM_WAIT_FOREVER);
+        uid   = p_this->uid[i];
+        state = p_this->state[i];
+        AW_MUTEX_UNLOCK(p_this->lock);
+
+        if (CARD_WL_STATE_NONE != state) {
+            __rec_make(&rec, uid, state, version);
+            ret = __rec_append(p_this, &rec);
+        }
+    }
+    return ret;
+}
+
+/**
+ * \brief 登记待写入的记录， 调用者需持有lock
+ */
+static void __pend_add (card_wl_t *p_this,
+                        uint32_t   uid,
+                        uint8_t    state,
+                        uint32_t   version)
+{
+    card_wl_pend_t *p_pend;
+
+    p_pend = &p_this->pend[(p_this->pend_head + p_this->pend_nums) %
+                           ACP1000_CARD_WL_PEND_NUMS];
+    p_pend->uid     = uid;
+    p_pend->state   = state;
+    p_pend->version = version;
+    p_this->pend_nums++;
+}
+
+/**
+ * \brief 名单写入任务
+ */
+static void __task_entry (void *p_arg)
+{
+    card_wl_t *p_this = (card_wl_t *)p_arg;
+    aw_err_t   ret    = AW_OK;
+
+    while (1) {
+        AW_SEMB_TAKE(p_this->flush_sem,
+                     (AW_OK == ret) ? AW_SEM_WAIT_FOREVER :
+                                      aw_ms_to_ticks(CARD_WL_RETRY_MS));
+        ret = card_wl_flush(p_this);
+        if (AW_OK != ret) {
+            AW_INFOF(("card white list write failed: %d\r\n", ret));
+        }
+    }
+}
+
+/******************************************************************************/
+aw_err_t card_wl_init (card_wl_t *p_this)
+{
+    card_wl_rec_t rec;
+    uint32_t      page;
+    uint32_t      pos;
+    aw_err_t      ret;
+
+    memset(p_this, 0, sizeof(*p_this));
+    AW_MUTEX_INIT(p_this->lock, AW_SEM_Q_PRIORITY);
+    AW_SEMB_INIT(p_this->flush_sem, AW_SEM_EMPTY, AW_SEM_Q_PRIORITY);
+
+    for (page = 0; page < (CARD_WL_NVRAM_SIZE / CARD_WL_PAGE_SIZE); page++) {
+        ret = aw_nvram_get(CARD_WL_NVRAM_NAME,
+                           0,
+                           (char *)p_this->page_buf,
+                           page * CARD_WL_PAGE_SIZE,
+                           CARD_WL_PAGE_SIZE);
+        if (AW_OK != ret) {
+            /* 读取失败时写满处理，下一次写入将整理重写 */
+            p_this->rec_nums = __REC_MAX;
+            return ret;
+        }
+
+        for (pos = 0; pos < __REC_PER_PAGE; pos++) {
+            memcpy(&rec, &p_this->page_buf[pos * __REC_SIZE], __REC_SIZE);
+            if (0xFF == rec.state) {
+                /* 空记录， 名单结束 */
+                return AW_OK;
+            }
+
+            /* 校验错误的记录（如写入时掉电）跳过 */
+            if (rec.check == __rec_check(&rec)) {
+                if (rec.version > p_this->version) {
+                    p_this->version = rec.version;
+                }
+                if (CARD_WL_STATE_NONE != rec.state) {
+                    __index_set(p_this, __uid_get(rec.uid), rec.state);
+                }
+            }
+            p_this->rec_nums++;
+        }
+    }
+
+    return AW_OK;
+}
+
+void card_wl_task_startup (card_wl_t *p_this)
+{
+    AW_TASK_INIT(card_wl_task,           /* 任务实体 */
+                 "card_wl_task",         /* 任务名字 */
+                 CARD_WL_TASK_PRIO,      /* 任务优先级 */
+                 CARD_WL_TACK_SIZE,      /* 任务堆栈大小 */
+                 __task_entry,           /* 任务入口函数 */
+                 (void *)p_this);        /* 任务入口参数 */
+    AW_TASK_STARTUP(card_wl_task);
+}
+
+uint8_t card_wl_lookup (card_wl_t *p_this, const uint8_t *p_uid)
+{
+    uint8_t state = CARD_WL_STATE_NONE;
+    int     slot;
+
+    AW_MUTEX_LOCK(p_this->lock, AW_SEM_WAIT_FOREVER);
+    slot = __slot_find(p_this, __uid_get(p_uid));
+    if (slot >= 0) {
+        state = p_this->state[slot];
+    }
+    AW_MUTEX_UNLOCK(p_this->lock);
+
+    return state;
+}
+
+aw_err_t card_wl_update (card_wl_t     *p_this,
+                         const uint8_t *p_uid,
+                         uint8_t        state,
+                         uint32_t       version)
+{
+    uint32_t uid;
+    aw_err_t ret;
+
+    if ((NULL == p_uid) ||
+        ((CARD_WL_STATE_ALLOW != state) && (CARD_WL_STATE_DENY != state))) {
+        return -AW_EINVAL;
+    }
+
+    uid = __uid_get(p_uid);
+
+    AW_MUTEX_LOCK(p_this->lock, AW_SEM_WAIT_FOREVER);
+    if (p_this->pend_nums >= ACP1000_CARD_WL_PEND_NUMS) {
+        /* 集中器收到错误应答后重发 */
+        ret = -AW_EBUSY;
+    } else {
+        ret = __index_set(p_this, uid, state);
+    }
+    if (AW_OK == ret) {
+        if (version > p_this->version) {
+            p_this->version = version;
+        }
+        __pend_add(p_this, uid, state, version);
+    }
+    AW_MUTEX_UNLOCK(p_this->lock);
+
+    if (AW_OK == ret) {
+        AW_SEMB_GIVE(p_this->flush_sem);
+    }
+    return ret;
+}
+
+aw_err_t card_wl_clear (card_wl_t *p_this, uint32_t version)
+{
+    AW_MUTEX_LOCK(p_this->lock, AW_SEM_WAIT_FOREVER);
+    memset(p_this->uid, 0, sizeof(p_this->uid));
+    memset(p_this->state, 0, sizeof(p_this->state));
+    p_this->nums       = 0;
+    p_this->allow_nums = 0;
+    p_this->version    = version;
+
+    /* 之前待写入的记录已无意义 */
+    p_this->pend_nums  = 0;
+    p_this->clr_pend   = TRUE;
+    AW_MUTEX_UNLOCK(p_this->lock);
+
+    AW_SEMB_GIVE(p_this->flush_sem);
+    return AW_OK;
+}
+
+void card_wl_info_get (card_wl_t *p_this, uint32_t *p_version, uint16_t *p_nums)
+{
+    AW_MUTEX_LOCK(p_this->lock, AW_SEM_WAIT_FOREVER);
+    *p_version = p_this->version;
+    *p_nums    = p_this->allow_nums;
+    AW_MUTEX_UNLOCK(p_this->lock);
+}
+
+aw_err_t card_wl_flush (card_wl_t *p_this)
+{
+    card_wl_rec_t  rec;
+    card_wl_pend_t pend;
+    bool_t         clr;
+    uint32_t       version;
+    aw_err_t       ret;
+
+    memset(&pend, 0, sizeof(pend));
+    while (1) {
+        /* 每次取一项， 擦除、 写入时不持有锁 */
+        AW_MUTEX_LOCK(p_this->lock, AW_SEM_WAIT_FOREVER);
+        clr     = p_this->clr_pend;
+        version = p_this->version;
+        if (clr) {
+            p_this->clr_pend = FALSE;
+        } else if (p_this->pend_nums > 0) {
+            pend = p_this->pend[p_this->pend_head];
+            p_this->pend_head = (p_this->pend_head + 1) % ACP1000_CARD_WL_PEND_NUMS;
+            p_this->pend_nums--;
+        } else if (!p_this->rewrite) {
+            AW_MUTEX_UNLOCK(p_this->lock);
+            return AW_OK;
+        }
+        AW_MUTEX_UNLOCK(p_this->lock);
+
+        if (clr) {
+            ret = __restart(p_this, version);
+        } else if (p_this->rewrite || (p_this->rec_nums >= __REC_MAX)) {
+            /* 整理时已按索引写入当前卡 */
+            ret = __compact(p_this);
+        } else {
+            __rec_make(&rec, pend.uid, pend.state, pend.version);
+            ret = __rec_append(p_this, &rec);
+        }
+
+        /* 失败的记录已在索引中， 下次整理重写 */
+        p_this->rewrite = (AW_OK != ret);
+        if (AW_OK != ret) {
+            return ret;
+        }
+    }
+}
@@ -0,0 +1,157 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 离线卡名单（SPI Flash存储， RAM哈希索引）
+ *
+ * 名单以16字节记录追加写入SPI Flash， 上电时回放到RAM中的开放寻址哈希表，
+ * 刷卡时直接查表而无需等待集中器应答。写满后按索引内容整理重写。
+ * 增加、 撤销、 清空只更新索引并登记待写入的记录， 由名单写入任务写入Flash，
+ * 调用者（集中器Modbus回调）无需等待擦除及写入。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-09-20  xjc, first implementation
+ * - 1.01 16-10-18  xjc, Flash写入移到名单写入任务， 写入块前显式擦除
+ * \endinternal
+ */
+
+#ifndef __CARD_WL_H
+#define __CARD_WL_H
+
+#include "apollo.h"
+#include "aw_sem.h"
+#include "ac_charge_prj_cfg.h"
+
+/**
+ * \brief 名单中卡的状态
+ * \anchor grp_card_wl_state
+ * @{
+ */
+#define CARD_WL_STATE_NONE    0x00  /**< \brief 名单中无该卡    */
+#define CARD_WL_STATE_ALLOW   0x01  /**< \brief 允许充电    */
+#define CARD_WL_STATE_DENY    0x02  /**< \brief 已撤销    */
+/** @} */
+
+#define CARD_WL_PAGE_SIZE     256   /* Flash写入页大小 */
+
+/**
+ * \brief 名单操作命令
+ * \anchor grp_card_wl_cmd
+ * @{
+ */
+#define CARD_WL_CMD_GET       0     /**< \brief 仅查询版本号及卡数    */
+#define CARD_WL_CMD_ADD       1     /**< \brief 增加卡    */
+#define CARD_WL_CMD_DEL       2     /**< \brief 撤销卡    */
+#define CARD_WL_CMD_CLR       3     /**< \brief 清空名单    */
+/** @} */
+
+/**
+ * 名单操作（HUB4G_CARD_WL事件参数）
+ */
+typedef struct card_wl_op {
+    uint8_t   cmd;          /* 操作命令 \ref grp_card_wl_cmd */
+    uint8_t   uid[4];       /* 卡ID */
+    uint32_t  version;      /* 操作后的名单版本号 */
+
+    aw_err_t  result;       /* 输出： 操作结果 */
+    uint32_t  wl_version;   /* 输出： 当前名单版本号 */
+    uint16_t  wl_nums;      /* 输出： 当前允许充电的卡数 */
+}card_wl_op_t;
+
+/**
+ * 待写入Flash的名单记录
+ */
+typedef struct card_wl_pend {
+    uint32_t  uid;          /* 卡ID */
+    uint32_t  version;      /* 名单版本号 */
+    uint8_t   state;        /* 卡状态 */
+}card_wl_pend_t;
+
+/**
+ * 离线卡名单
+ */
+typedef struct card_wl {
+    /* 以下受lock保护 */
+    uint32_t  uid[ACP1000_CARD_WL_HASH_SIZE];    /* 哈希索引 卡ID */
+    uint8_t   state[ACP1000_CARD_WL_HASH_SIZE];  /* 哈希索引 状态 \ref grp_card_wl_state */
+    uint16_t  nums;                              /* 索引中的卡数（含已撤销） */
+    uint16_t  allow_nums;                        /* 允许充电的卡数 */
+    uint32_t  version;                           /* 名单版本号， 集中器据此增量下发 */
+    card_wl_pend_t pend[ACP1000_CARD_WL_PEND_NUMS];  /* 待写入的记录（环形队列） */
+    uint16_t  pend_head;                         /* 队列头 */
+    uint16_t  pend_nums;                         /* 队列中的记录数 */
+    bool_t    clr_pend;                          /* 待清空Flash中的名单 */
+    AW_MUTEX_DECL(lock);
+
+    AW_SEMB_DECL(flush_sem);                     /* 唤醒名单写入任务 */
+
+    /* 以下只由名单写入任务访问 */
+    bool_t    rewrite;                           /* 上次写入失败， 须按索引整理重写 */
+    uint32_t  rec_nums;                          /* Flash中已写入的记录数 */
+    uint8_t   page_buf[CARD_WL_PAGE_SIZE];       /* 当前写入页的内容 */
+}card_wl_t;
+
+/**
+ * \brief 从Flash加载名单并建立索引
+ * \retval AW_OK : 加载成功（Flash中无名单时为空名单）
+ * \retval 其他  : Flash读取失败， 名单为空
+ */
+aw_err_t card_wl_init (card_wl_t *p_this);
+
+/**
+ * \brief 启动名单写入任务（card_wl_init() 之后调用）
+ */
+void card_wl_task_startup (card_wl_t *p_this);
+
+/**
+ * \brief 查询卡在名单中的状态
+ * \param[in] p_uid : 4字节卡ID
+ * \return 卡状态 \ref grp_card_wl_state
+ */
+uint8_t card_wl_lookup (card_wl_t *p_this, const uint8_t *p_uid);
+
+/**
+ * \brief 增加或撤销一张卡
+ * \param[in] p_uid   : 4字节卡ID
+ * \param[in] state   : CARD_WL_STATE_ALLOW 或 CARD_WL_STATE_DENY
+ * \param[in] version : 本条记录的名单版本号
+ * \retval AW_OK       : 成功（已登记写入Flash）
+ * \retval -AW_EINVAL  : 参数错误
+ * \retval -AW_ENOSPC  : 名单已满
+ * \retval -AW_EBUSY   : 待写入的记录已满， 稍后重试
+ */
+aw_err_t card_wl_update (card_wl_t     *p_this,
+                         const uint8_t *p_uid,
+                         uint8_t        state,
+                         uint32_t       version);
+
+/**
+ * \brief 清空名单
+ * \param[in] version : 清空后的名单版本号
+ */
+aw_err_t card_wl_clear (card_wl_t *p_this, uint32_t version);
+
+/**
+ * \brief 获取名单版本号及允许充电的卡数
+ */
+void card_wl_info_get (card_wl_t *p_this, uint32_t *p_version, uint16_t *p_nums);
+
+/**
+ * \brief 把待写入的记录写入Flash（由名单写入任务调用）
+ * \retval AW_OK : 已全部写入
+ * \retval 其他  : Flash擦除或写入失败， 下次调用时按索引整理重写
+ */
+aw_err_t card_wl_flush (card_wl_t *p_this);
+
+#endif
@@ -0,0 +1,89 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 负荷管理（集中器分配电流下的CP电流调整）
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-18  xjc, first implementation
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include "charge_load.h"
+
+/******************************************************************************/
+void charge_load_cfg_check (charge_load_t *p_cfg)
+{
+    if (p_cfg->min_curr < ACP1000_LOAD_MIN_CURR) {
+        p_cfg->min_curr = ACP1000_LOAD_MIN_CURR;
+    }
+    if (p_cfg->failsafe_curr < p_cfg->min_curr) {
+        p_cfg->failsafe_curr = p_cfg->min_curr;
+    }
+}
+
+/******************************************************************************/
+uint32_t charge_load_target (const charge_load_t *p_cfg,
+                             uint32_t             max_curr,
+                             uint32_t             update_ms,
+                             bool_t              *p_link_lost)
+{
+    uint32_t target;
+
+    *p_link_lost = FALSE;
+    if (!p_cfg->enable) {
+        return max_curr;
+    }
+
+    /* 集中器超时未刷新分配电流，则退回到安全电流 */
+    if (update_ms > ACP1000_LOAD_LINK_TIMEOUT) {
+        *p_link_lost = TRUE;
+        target       = p_cfg->failsafe_curr;
+    } else {
+        target       = p_cfg->curr_limit;
+    }
+
+    /* 不低于最小充电电流（低于6A车辆会停止充电，停在9V会被认为充满），不高于桩额定电流 */
+    if (target < p_cfg->min_curr) {
+        target = p_cfg->min_curr;
+    }
+    if (target > max_curr) {
+        target = max_curr;
+    }
+
+    return target;
+}
+
+/******************************************************************************/
+uint32_t charge_load_step (const charge_load_t *p_cfg,
+                           uint32_t             now_curr,
+                           uint32_t             target,
+                           uint32_t             ramp_ms)
+{
+    uint32_t step;
+
+    if ((now_curr == 0) && p_cfg->enable) {
+        /* 启动时从最小电流开始上升 */
+        return target > p_cfg->min_curr ? p_cfg->min_curr : target;
+    }
+
+    if ((target <= now_curr) || (0 == p_cfg->ramp_rate) || (!p_cfg->enable)) {
+        return target;
+    }
+
+    step = p_cfg->ramp_rate * ramp_ms / 1000;
+
+    return (now_curr + step) > target ? target : (now_curr + step);
+}
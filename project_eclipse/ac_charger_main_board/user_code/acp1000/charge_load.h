@@ -0,0 +1,82 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 负荷管理（集中器分配电流下的CP电流调整）
+ *
+ * 只依赖传入的参数与经过的时间，不访问节拍、PWM等，可直接在主机上编译验证。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-18  xjc, first implementation
+ * \endinternal
+ */
+
+#ifndef __CHARGE_LOAD_H
+#define __CHARGE_LOAD_H
+
+#include "apollo.h"
+#include "ac_charge_prj_cfg.h"
+
+/**
+ * 负荷管理参数（电流单位均为0.01A）
+ */
+typedef struct charge_load {
+    bool_t    enable;        /* 是否处于负荷管理模式 */
+    uint32_t  curr_limit;    /* 集中器分配的充电电流 */
+    uint32_t  ramp_rate;     /* 电流上升速率，单位0.01A/s，0：不限制 */
+    uint32_t  min_curr;      /* 最小充电电流 */
+    uint32_t  failsafe_curr; /* 失联后的安全电流 */
+}charge_load_t;
+
+/**
+ * \brief 修正集中器下发的参数（最小电流不低于 ACP1000_LOAD_MIN_CURR，
+ *        安全电流不低于最小电流）
+ */
+void charge_load_cfg_check (charge_load_t *p_cfg);
+
+/**
+ * \brief 计算目标电流
+ *
+ * 超过 ACP1000_LOAD_LINK_TIMEOUT 未收到分配电流时取安全电流，结果不低于最小电流、
+ * 不高于桩额定电流。未处于负荷管理模式时为桩额定电流。
+ *
+ * \param[in]  p_cfg       : 负荷管理参数
+ * \param[in]  max_curr    : 桩额定电流，单位0.01A
+ * \param[in]  update_ms   : 距最近一次收到分配电流的时间（ms）
+ * \param[out] p_link_lost : 是否与集中器失联
+ * \return 目标电流，单位0.01A
+ */
+uint32_t charge_load_target (const charge_load_t *p_cfg,
+                             uint32_t             max_curr,
+                             uint32_t             update_ms,
+                             bool_t              *p_link_lost);
+
+/**
+ * \brief 计算下一步下发的电流
+ *
+ * 下调立即生效，上调按上升速率逐步增加；首次下发（当前电流为0）从最小电流开始。
+ * 返回值等于当前电流且小于目标电流时，为累积时间不足一个步进，调用者不应重新计时。
+ *
+ * \param[in] p_cfg    : 负荷管理参数
+ * \param[in] now_curr : 当前下发的电流，0：未下发
+ * \param[in] target   : 目标电流
+ * \param[in] ramp_ms  : 距上次调整电流的时间（ms）
+ * \return 应下发的电流，单位0.01A
+ */
+uint32_t charge_load_step (const charge_load_t *p_cfg,
+                           uint32_t             now_curr,
+                           uint32_t             target,
+                           uint32_t             ramp_ms);
+
+#endif
@@ -0,0 +1,221 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 智能充电规划（按分时电价安排充电电流）
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-09-12  xjc, first implementation
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include "string.h"
+#include "charge_sched.h"
+
+/**
+ * \brief 获取时段对应的电价
+ */
+static uint16_t __slot_price_get (const charge_sched_param_t *p_param,
+                                  const uint16_t             *p_price,
+                                  uint16_t                    slot)
+{
+    uint32_t minute = p_param->start_minute + slot * CHARGE_SCHED_SLOT_MIN;
+
+    return p_price[(minute / 60) % CHARGE_SCHED_PRICE_NUM];
+}
+
+/**
+ * \brief 时段电费， 单位0.0001元
+ */
+static inline uint32_t __slot_cost_get (uint16_t price, uint32_t energy)
+{
+    return ((uint32_t)price * energy) / 1000;
+}
+
+/**
+ * \brief 电量换算为一个时段内的充电电流（向上取整）
+ */
+static inline uint32_t __slot_curr_get (uint32_t energy, uint32_t vol)
+{
+    uint32_t div = vol * CHARGE_SCHED_SLOT_MIN;
+
+    return (energy * 60000 + div - 1) / div;
+}
+
+/**
+ * \brief 按电价从低到高排列时段， 电价相同时较早的时段在前
+ */
+static void __slot_sort (uint8_t        *p_order,
+                         const uint16_t *p_slot_price,
+                         uint16_t        nums)
+{
+    uint16_t i;
+    int16_t  j;
+    uint8_t  slot;
+
+    for (i = 0; i < nums; i++) {
+        slot = i;
+        for (j = i - 1; j >= 0; j--) {
+            if (p_slot_price[p_order[j]] <= p_slot_price[slot]) {
+                break;
+            }
+            p_order[j + 1] = p_order[j];
+        }
+        p_order[j + 1] = slot;
+    }
+}
+
+/**
+ * \brief 从指定时段开始充电时的规划
+ *
+ * \param[in]  start    : 开始充电的时段
+ * \param[out] p_curr   : 各时段电流，为NULL时只计算电费
+ * \param[out] p_cost   : 电费
+ * \param[out] p_energy : 可充入的电量
+ *
+ * \return TRUE: 离开前能充入所需电量
+ */
+static bool_t __plan_fill (const charge_sched_param_t *p_param,
+                           const uint16_t             *p_slot_price,
+                           const uint8_t              *p_order,
+                           uint16_t                    nums,
+                           uint16_t                    start,
+                           uint16_t                   *p_curr,
+                           uint32_t                   *p_cost,
+                           uint32_t                   *p_energy)
+{
+    uint32_t e_min  = charge_sched_slot_energy(p_param->min_curr, p_param->vol);
+    uint32_t e_max  = charge_sched_slot_energy(p_param->max_curr, p_param->vol);
+    uint32_t cost   = 0;
+    uint32_t energy = 0;
+    uint32_t e;
+    uint32_t curr;
+    uint16_t i;
+    uint16_t slot;
+
+    /* 开始后各时段至少以最小电流充电 */
+    for (slot = start; slot < nums; slot++) {
+        if (p_curr) {
+            p_curr[slot] = p_param->min_curr;
+        }
+        cost   += __slot_cost_get(p_slot_price[slot], e_min);
+        energy += e_min;
+    }
+
+    /* 剩余电量依次分配到最便宜的时段 */
+    for (i = 0; (i < nums) && (energy < p_param->energy); i++) {
+        slot = p_order[i];
+        if (slot < start) {
+            continue;
+        }
+
+        e = p_param->energy - energy;
+        if (e >= (e_max - e_min)) {
+            curr = p_param->max_curr;
+        } else {
+            curr = __slot_curr_get(e_min + e, p_param->vol);
+            curr = curr > p_param->max_curr ? p_param->max_curr : curr;
+        }
+        e = charge_sched_slot_energy(curr, p_param->vol) - e_min;
+
+        if (p_curr) {
+            p_curr[slot] = curr;
+        }
+        cost   += __slot_cost_get(p_slot_price[slot], e);
+        energy += e;
+    }
+
+    *p_cost   = cost;
+    *p_energy = energy;
+
+    return (energy >= p_param->energy) ? TRUE : FALSE;
+}
+
+/**
+ * \brief 按电价表生成电费最低的充电规划
+ */
+aw_err_t charge_sched_plan (const charge_sched_param_t *p_param,
+                            const uint16_t             *p_price,
+                            charge_sched_plan_t        *p_plan)
+{
+    uint16_t slot_price[CHARGE_SCHED_SLOT_MAX];
+    uint8_t  order[CHARGE_SCHED_SLOT_MAX];
+    uint16_t nums;
+    uint16_t last;
+    uint16_t start;
+    uint16_t best      = 0;
+    uint32_t best_cost = 0;
+    bool_t   found     = FALSE;
+    uint32_t cost;
+    uint32_t energy;
+
+    if ((NULL == p_param) || (NULL == p_price) || (NULL == p_plan)) {
+        return -AW_EINVAL;
+    }
+    if ((0 == p_param->vol) || (0 == p_param->max_curr) ||
+        (p_param->min_curr > p_param->max_curr)) {
+        return -AW_EINVAL;
+    }
+
+    nums = p_param->slot_nums > CHARGE_SCHED_SLOT_MAX ?
+           CHARGE_SCHED_SLOT_MAX : p_param->slot_nums;
+
+    memset(p_plan, 0, sizeof(*p_plan));
+    p_plan->slot_nums = nums;
+    if (0 == nums) {
+        p_plan->reachable = (0 == p_param->energy) ? TRUE : FALSE;
+        return AW_OK;
+    }
+
+    for (start = 0; start < nums; start++) {
+        slot_price[start] = __slot_price_get(p_param, p_price, start);
+    }
+    __slot_sort(order, slot_price, nums);
+
+    /* 逐个尝试开始时段，越晚开始可用的时段越少，一旦无法充满即可停止 */
+    last = p_param->started ? 0 : nums - 1;
+    for (start = 0; start <= last; start++) {
+        if (!__plan_fill(p_param, slot_price, order, nums, start,
+                         NULL, &cost, &energy)) {
+            break;
+        }
+        if ((!found) || (cost < best_cost)) {
+            found     = TRUE;
+            best      = start;
+            best_cost = cost;
+        }
+    }
+
+    if (found) {
+        p_plan->start_slot = best;
+        p_plan->reachable  = __plan_fill(p_param, slot_price, order, nums, best,
+                                         p_plan->curr,
+                                         &p_plan->cost,
+                                         &p_plan->energy);
+        return AW_OK;
+    }
+
+    /* 离开前无法充满，从现在起以最大电流充电 */
+    p_plan->start_slot = 0;
+    p_plan->reachable  = FALSE;
+    energy = charge_sched_slot_energy(p_param->max_curr, p_param->vol);
+    for (start = 0; start < nums; start++) {
+        p_plan->curr[start] = p_param->max_curr;
+        p_plan->cost       += __slot_cost_get(slot_price[start], energy);
+        p_plan->energy     += energy;
+    }
+
+    return AW_OK;
+}
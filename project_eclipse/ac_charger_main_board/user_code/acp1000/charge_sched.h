@@ -0,0 +1,89 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 智能充电规划（按分时电价安排充电电流）
+ *
+ * 规划只依赖传入的参数与电价表，不访问RTC、电表等外设，相同输入得到相同的规划，
+ * 可直接在主机上编译验证。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-09-12  xjc, first implementation
+ * \endinternal
+ */
+
+#ifndef __CHARGE_SCHED_H
+#define __CHARGE_SCHED_H
+
+#include "apollo.h"
+
+#define CHARGE_SCHED_SLOT_MIN    15  /* 每个规划时段的分钟数 */
+#define CHARGE_SCHED_SLOT_MAX    96  /* 最多规划的时段数（24小时） */
+#define CHARGE_SCHED_PRICE_NUM   24  /* 电价表时段数， 每小时一个电价 */
+
+/**
+ * 规划输入参数
+ */
+typedef struct charge_sched_param {
+    uint32_t  energy;       /* 尚需充入的电量，单位Wh */
+    uint16_t  slot_nums;    /* 距离离开时间的时段数 */
+    uint16_t  start_minute; /* 规划起点在一天中的分钟数 0 - 1439 */
+    uint32_t  vol;          /* 供电电压，单位0.1V */
+    uint32_t  max_curr;     /* 可用的最大充电电流，单位0.01A */
+    uint32_t  min_curr;     /* 最小充电电流，单位0.01A */
+    bool_t    started;      /* 已开始充电，不可再推迟（暂停会被车辆视为充满） */
+}charge_sched_param_t;
+
+/**
+ * 规划结果
+ */
+typedef struct charge_sched_plan {
+    uint16_t  slot_nums;                     /* 有效时段数 */
+    uint16_t  start_slot;                    /* 开始充电的时段，此前电流为0 */
+    uint16_t  curr[CHARGE_SCHED_SLOT_MAX];   /* 各时段的充电电流，单位0.01A */
+    uint32_t  energy;                        /* 规划可充入的电量，单位Wh */
+    uint32_t  cost;                          /* 预计电费，单位0.0001元 */
+    bool_t    reachable;                     /* 离开前能否充入所需电量 */
+}charge_sched_plan_t;
+
+/**
+ * \brief 计算某电流下一个时段可充入的电量
+ * \param[in] curr : 充电电流，单位0.01A
+ * \param[in] vol  : 供电电压，单位0.1V
+ * \return 电量，单位Wh
+ */
+static inline uint32_t charge_sched_slot_energy (uint32_t curr, uint32_t vol)
+{
+    return (curr * vol * CHARGE_SCHED_SLOT_MIN) / 60000;
+}
+
+/**
+ * \brief 按电价表生成电费最低的充电规划
+ *
+ * 在离开前的各个时段内，先选定开始充电的时段（之后每个时段至少为最小电流，
+ * 避免中途暂停），再把剩余电量依次分配到最便宜的时段。所有开始时段中电费最低者
+ * 为最终规划；若离开前无法充满，则从现在起以最大电流充电。
+ *
+ * \param[in]  p_param : 规划参数
+ * \param[in]  p_price : 24个小时的电价，单位0.0001元/kWh
+ * \param[out] p_plan  : 规划结果
+ *
+ * \retval AW_OK      : 规划成功（是否能充满见 p_plan->reachable）
+ * \retval -AW_EINVAL : 参数错误
+ */
+aw_err_t charge_sched_plan (const charge_sched_param_t *p_param,
+                            const uint16_t             *p_price,
+                            charge_sched_plan_t        *p_plan);
+
+#endif
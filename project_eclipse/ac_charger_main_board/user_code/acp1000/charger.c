@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief ʵ
+ * \brief 充电机实例
  *
  * \internal
  * \par modification history:
@@ -35,6 +35,13 @@
 #include "ac_charge_prj_cfg.h"
 #include "aw_delayed_work.h"
 #include "mb/aw_mb_dgus_regmap.h"
+#include "aw_rtc.h"
+#include "ammeter.h"
+#include "contactor.h"
+#include "periodic.h"
+#include "lat_hist.h"
+#include "task_wdt.h"
+#include "slog.h"
 
 #define IDLE_TO_CHARGER(p_this, pp_role) \
     struct charge *p_this = AW_CONTAINER_OF(pp_role, struct charge, p_charge_idle)
@@ -57,21 +64,21 @@
 #define EVT_TO_CHARGER(p_this, p_evt) \
     struct charge *p_this = AW_CONTAINER_OF(p_evt, struct charge, evt_node)
 
-static role_ret play(role_t **pp_role, void *p_arg);  /*  */
+static role_ret play(role_t **pp_role, void *p_arg);  /* 扮演 */
 static void event_driver(struct event_node *p_evt, event_t event, void *p_arg);
 static role_ret charger_idle_do (struct role **pp_role, void *p_arg);
 
-#define CHARGER_9V_TIMEOUT_MS      10000 /* δʱ쳣⣨ʼһֱ9Vʱ  */
-#define CHARGER_UNLOCK_TIMEOUT_MS  200   /* Ͽ󵽽ʱ䣨ms*/
-#define CHARGER_ERR_TIMEOUT_MS     3000  /* 쳣жϽʱ䣨ms*/
+#define CHARGER_9V_TIMEOUT_MS      10000 /* 汽车未就绪超时异常检测（开始充电后一直在9V的最大持续时间 ） */
+#define CHARGER_UNLOCK_TIMEOUT_MS  200   /* 断开交流输出后到解锁的时间（ms）*/
+#define CHARGER_ERR_TIMEOUT_MS     3000  /* 自异常发生到切断交流输出的最大容忍时间（ms）*/
 
 /**
- * \brief 趨
- * \param[in] p_this :  ׮ʵ
- * \param[in] islock :  ǷסTRUEFALSE ⿪
- * \return AW_OK    : ɹ
- * \return AW_ERROR : ʧ
- * \note ûе뷵AW_OKκ
+ * \brief 充电机电子锁设定
+ * \param[in] p_this :  充电桩实例
+ * \param[in] islock :  是否锁住电子锁，TRUE：锁定电子锁；FALSE： 解开电子锁
+ * \return AW_OK    : 操作成功
+ * \return AW_ERROR : 操作失败
+ * \note 若充电机没有电子锁，请返回AW_OK，而不做任何事情
  */
 static inline aw_err_t charger_elock_lock (charger_t *p_this, bool_t islock)
 {
@@ -83,14 +90,17 @@ static inline aw_err_t charger_elock_lock (charger_t *p_this, bool_t islock)
 
 extern bool_t g_need_ac_check;
 /**
-  * \brief ACѹ
-  * \param[in] p_this : ׮ʵ
-  * \param[in] enable :  TRUE : ACѹ   FALSEֹACѹ
+  * \brief 设置AC电压输出
+  * \param[in] p_this : 充电桩实例
+  * \param[in] enable :  TRUE : 输出AC电压  ， FALSE：禁止AC电压输出
   */
 //static
 inline void charger_ac_output_enable(charger_t *p_this, bool_t enable)
 {
     aw_gpio_set(ACP1000_DOUT_AC, enable ? 1 : 0);
+#if ACP1000_CONTACTOR_MON
+    contactor_cmd(enable);
+#endif
 
     g_need_ac_check = FALSE;
 
@@ -100,27 +110,46 @@ inline void charger_ac_output_enable(charger_t *p_this, bool_t enable)
 
 
 
-#if ACP1000_AC1_ERR_DETECT
+#if ACP1000_AC1_ERR_DETECT && !ACP1000_CONTACTOR_MON
     aw_delayed_work_stop(&(p_this->ac_detect_dk));
-    aw_delayed_work_start(&(p_this->ac_detect_dk), 1000); /* ĸŵż̵һΪ0.3-0.5s */
+    aw_delayed_work_start(&(p_this->ac_detect_dk), 1000); /* 母排电磁继电器一般为0.3-0.5s */
 #endif
 }
 
-#define ACP1000_CURR_PWM_PERIOD    (1000000UL) /* ָʾPWM 1ms 1KHz */
+/**
+ * \brief 非充电角色中保持AC输出断开（不改变记录的输出状态）
+ */
+static void charger_ac_output_off (void)
+{
+    aw_gpio_set(ACP1000_DOUT_AC, 0);
+#if ACP1000_CONTACTOR_MON
+    contactor_cmd(FALSE);
+#endif
+}
+
+#define ACP1000_CURR_PWM_PERIOD    (1000000UL) /* 电流指示PWM周期 1ms 即1KHz */
 
 /**
- * \brief ÿ
- * \param[in] p_this   :  ʵ
- * \param[in] current  :  λ0.01A
- * \note ֵƳһռձȣΪcurrentΪ0ʱռձռ100%(Ե112V)
+ * \brief 设置可输出的最大电流
+ * \param[in] p_this   :  交流充电机实例
+ * \param[in] current  :  充电机可输出的最大电流，单位0.01A
+ * \note 电流值被调制成一定的占空比，当为current为0时，占空比占100%(测试点1接12V)
  */
 static void charger_current_limit(charger_t *p_this, uint32_t current)
 {
-    uint32_t duty = 0; /* ռձ */
+    uint32_t duty = 0; /* 占空比 */
     uint32_t curr_pwm_id = p_this->dat.curr_pwm;
+    bool_t   changed;
+
+    /* 记录当前下发的电流，作为负荷管理调整的起点 */
+    charger_dev_lock(p_this);
+    changed = (p_this->load.now_curr != current);
+    p_this->load.now_curr   = current;
+    p_this->load.ramp_ticks = aw_sys_tick_get();
+    charger_dev_unlock(p_this);
 
     if (current < 600) {
-        /* 100%ռձ */
+        /* 其他电流输出100%占空比 */
         duty =  ACP1000_CURR_PWM_PERIOD;
     } else if (current == 600) {
         duty = (ACP1000_CURR_PWM_PERIOD / 100) * 9;
@@ -133,10 +162,282 @@ static void charger_current_limit(charger_t *p_this, uint32_t current)
     }
     aw_pwm_config(curr_pwm_id, duty, ACP1000_CURR_PWM_PERIOD);
     aw_pwm_enable(curr_pwm_id);
+
+    if (changed) {
+        event_node_tell_all(&p_this->evt_node, CHARGE_CURR_LIMIT, (void *)current);
+    }
+}
+
+/**
+ * \brief 计算负荷管理下当前应下发的电流
+ * \param[in] p_this   :  交流充电机实例
+ * \return 目标电流，单位0.01A
+ * \note 调用前需持有设备锁
+ */
+static uint32_t charger_load_target_get(charger_t *p_this)
+{
+    charge_load_state_t *p_load = &p_this->load;
+    uint32_t             target = p_this->dat.max_curr;
+#if ACP1000_LOAD_MANAGE
+    bool_t               link_lost;
+
+    target = charge_load_target(&p_load->cfg,
+                                p_this->dat.max_curr,
+                                aw_ticks_to_ms(aw_sys_tick_get() - p_load->update_ticks),
+                                &link_lost);
+    if (link_lost) {
+        if (!p_load->link_lost) {
+            SLOG(SLOG_MOD_CHARGER, SLOG_WARN, "Load manage link lost, failsafe curr: %d",
+                 p_load->cfg.failsafe_curr);
+        }
+        p_load->link_lost = TRUE;
+    }
+#endif
+
+    return target;
+}
+
+#if ACP1000_SCHED_CHARGE
+/**
+ * \brief 获取规划在当前时段的电流
+ * \param[in] p_this   :  交流充电机实例
+ * \return 0: 无规划或规划推迟充电； 其他: 规划电流，单位0.01A
+ * \note 调用前需持有设备锁
+ */
+static uint32_t charger_sched_curr_get (charger_t *p_this)
+{
+    charge_sched_state_t *p_sched = &p_this->sched;
+    uint32_t              slot;
+
+    if ((!p_sched->cfg.enable) ||
+        (CHARGE_SCHED_STATE_OFF  == p_sched->info.state) ||
+        (CHARGE_SCHED_STATE_ASAP == p_sched->info.state)) {
+        return 0;
+    }
+
+    /* 已达到目标电量，以最小电流维持到车辆充满 */
+    if (CHARGE_SCHED_STATE_DONE == p_sched->info.state) {
+        return p_this->load.cfg.min_curr;
+    }
+
+    slot = aw_ticks_to_ms(aw_sys_tick_get() - p_sched->plan_ticks) /
+           (CHARGE_SCHED_SLOT_MIN * 60000);
+    if (slot >= p_sched->plan.slot_nums) {
+        /* 已过离开时间 */
+        return 0;
+    }
+
+    return p_sched->plan.curr[slot];
+}
+
+/**
+ * \brief 按规划限制目标电流
+ * \note 调用前需持有设备锁
+ */
+static uint32_t charger_sched_curr_limit (charger_t *p_this, uint32_t target)
+{
+    uint32_t curr = charger_sched_curr_get(p_this);
+
+    return ((curr != 0) && (curr < target)) ? curr : target;
+}
+
+/**
+ * \brief 是否需要推迟充电（等待低价时段）
+ */
+static bool_t charger_sched_defer (charger_t *p_this)
+{
+    bool_t defer;
+
+    charger_dev_lock(p_this);
+    defer = (p_this->sched.cfg.enable) &&
+            (!p_this->sched.started) &&
+            (CHARGE_SCHED_STATE_WAIT == p_this->sched.info.state) &&
+            (0 == charger_sched_curr_get(p_this));
+    charger_dev_unlock(p_this);
+
+    return defer;
+}
+
+/**
+ * \brief 智能充电规划更新
+ *
+ * 参数或电价表变化、车辆实际电流偏离下发电流以及每个规划时段开始时重新规划，
+ * 规划结果以 CHARGE_SCHED_INFO 事件发布。
+ *
+ * \param[in] p_this   :  交流充电机实例
+ */
+static void charger_sched_update (charger_t *p_this)
+{
+    charge_sched_state_t *p_sched = &p_this->sched;
+    charge_sched_param_t  param;
+    charge_sched_cfg_t    cfg;
+    charge_sched_info_t   info;
+    uint16_t              price[CHARGE_SCHED_PRICE_NUM];
+    static charge_sched_plan_t plan;  /* 规划结果较大，不放在任务栈上 */
+    uint32_t              done = 0;
+    uint32_t              now_min;
+    uint32_t              depart_min;
+    aw_tm_t               tm;
+
+    charger_dev_lock(p_this);
+    if (p_sched->started && (p_sched->now_energy > p_sched->start_energy)) {
+        done = p_sched->now_energy - p_sched->start_energy;
+    }
+
+    if (p_sched->cfg.enable && p_sched->started) {
+        if ((done >= p_sched->cfg.energy) &&
+            (CHARGE_SCHED_STATE_DONE != p_sched->info.state)) {
+            p_sched->replan = TRUE;
+        }
+
+        /* 每个时段开始时， 按车辆实际可接受的电流修正规划 */
+        if (aw_ticks_to_ms(aw_sys_tick_get() - p_sched->plan_ticks) >=
+            (CHARGE_SCHED_SLOT_MIN * 60000)) {
+            if ((p_this->dat.ac_enable) &&
+                (p_sched->meas_curr + ACP1000_SCHED_CURR_DEV < p_this->load.now_curr)) {
+                p_sched->curr_cap = p_sched->meas_curr + ACP1000_SCHED_CURR_DEV;
+            } else {
+                p_sched->curr_cap = 0;
+            }
+            p_sched->replan = TRUE;
+        }
+    } else if (p_sched->cfg.enable &&
+               (aw_ticks_to_ms(aw_sys_tick_get() - p_sched->plan_ticks) >=
+                (CHARGE_SCHED_SLOT_MIN * 60000))) {
+        p_sched->replan = TRUE;
+    }
+
+    if (!p_sched->replan) {
+        charger_dev_unlock(p_this);
+        return;
+    }
+    p_sched->replan = FALSE;
+
+    cfg                = p_sched->cfg;
+    param.started      = p_sched->started;
+    param.vol          = p_sched->vol ? p_sched->vol : ACP1000_SCHED_NOMINAL_VOL;
+    param.min_curr     = p_this->load.cfg.min_curr;
+    param.max_curr     = charger_load_target_get(p_this);
+    if ((p_sched->curr_cap != 0) && (p_sched->curr_cap < param.max_curr)) {
+        param.max_curr = p_sched->curr_cap;
+    }
+    if (param.max_curr < param.min_curr) {
+        param.max_curr = param.min_curr;
+    }
+    param.energy       = (cfg.energy > done) ? (cfg.energy - done) * 10 : 0;
+    charger_dev_unlock(p_this);
+
+    memset(&info, 0, sizeof(info));
+    memset(&plan, 0, sizeof(plan));
+    info.state = CHARGE_SCHED_STATE_OFF;
+
+    if (!cfg.enable) {
+        /* 未启用 */
+    } else if (0 == param.energy) {
+        info.state     = CHARGE_SCHED_STATE_DONE;
+        info.plan_curr = param.min_curr;
+
+    } else if (AW_OK != aw_rtc_time_get(ACP1000_RTC_NUM, &tm)) {
+        /* 无法获知当前时间，不做规划 */
+        info.state = CHARGE_SCHED_STATE_ASAP;
+
+    } else {
+        memset(price, 0, sizeof(price));
+        event_node_tell_all(&p_this->evt_node, SCHED_PRICE_GET, (void *)price);
+
+        now_min            = tm.tm_hour * 60 + tm.tm_min;
+        depart_min         = cfg.depart_hour * 60 + cfg.depart_min;
+        param.start_minute = now_min;
+        param.slot_nums    = ((depart_min + 1440 - now_min) % 1440) /
+                             CHARGE_SCHED_SLOT_MIN;
+
+        if ((AW_OK != charge_sched_plan(&param, price, &plan)) ||
+            (!plan.reachable)) {
+            info.state = CHARGE_SCHED_STATE_ASAP;
+        } else {
+            info.state = (plan.start_slot > 0) ? CHARGE_SCHED_STATE_WAIT :
+                                                 CHARGE_SCHED_STATE_RUN;
+        }
+        info.start_delay = plan.start_slot * CHARGE_SCHED_SLOT_MIN;
+        info.plan_curr   = plan.curr[0];
+        info.cost        = plan.cost / 100;
+    }
+
+    charger_dev_lock(p_this);
+    p_sched->plan       = plan;
+    p_sched->info       = info;
+    p_sched->plan_ticks = aw_sys_tick_get();
+    charger_dev_unlock(p_this);
+
+    event_node_tell_all(&p_this->evt_node, CHARGE_SCHED_INFO, (void *)&info);
+}
+#endif
+
+/**
+ * \brief 按负荷管理调整CP电流 （仅在电流变化时重新配置PWM）
+ * \param[in] p_this   :  交流充电机实例
+ * \note 电流下调立即生效，上调按上升速率逐步增加，以免站内馈线瞬时过载
+ */
+static void charger_load_curr_update(charger_t *p_this)
+{
+    charge_load_state_t *p_load = &p_this->load;
+    uint32_t             target;
+    uint32_t             now_curr;
+
+    charger_dev_lock(p_this);
+    target   = charger_load_target_get(p_this);
+#if ACP1000_SCHED_CHARGE
+    target   = charger_sched_curr_limit(p_this, target);
+#endif
+#if ACP1000_THERMAL_DERATE
+    /* 过温降额优先于负荷管理及充电规划 */
+    if (p_load->temp_limit && (target > p_load->temp_limit)) {
+        target = p_load->temp_limit;
+    }
+#endif
+    now_curr = charge_load_step(&p_load->cfg,
+                                p_load->now_curr,
+                                target,
+                                aw_ticks_to_ms(aw_sys_tick_get() - p_load->ramp_ticks));
+
+    if ((now_curr == p_load->now_curr) && (now_curr < target)) {
+        /* 累积时间不足一个步进 */
+        charger_dev_unlock(p_this);
+        return;
+    }
+
+    if (now_curr == p_load->now_curr) {
+        p_load->ramp_ticks = aw_sys_tick_get();
+        charger_dev_unlock(p_this);
+        return;
+    }
+    charger_dev_unlock(p_this);
+
+    charger_current_limit(p_this, now_curr);
+}
+
+#if ACP1000_LOAD_MANAGE
+/**
+ * \brief 更新负荷管理参数
+ * \param[in] p_this   :  交流充电机实例
+ * \param[in] p_cfg    :  负荷管理参数
+ */
+static void charger_load_cfg_set(charger_t *p_this, charge_load_t *p_cfg)
+{
+    charge_load_state_t *p_load = &p_this->load;
+
+    charger_dev_lock(p_this);
+    p_load->cfg = *p_cfg;
+    charge_load_cfg_check(&p_load->cfg);
+    p_load->update_ticks = aw_sys_tick_get();
+    p_load->link_lost    = FALSE;
+    charger_dev_unlock(p_this);
 }
+#endif
 
+#if ACP1000_AC1_ERR_DETECT && !ACP1000_CONTACTOR_MON
 /**
- * ĸż
+ * 交流母排检测任务
  */
 static void ac_detect_work_entry (void *p_arg)
 {
@@ -150,13 +451,13 @@ static void ac_detect_work_entry (void *p_arg)
 //    if (aw_gpio_get(ACP1000_DIN_AC1)) {
 //        if (ac_enable == TRUE) {
 //            event_node_tell_all(&p_this->evt_node, ERR_AC, TRUE);
-//            /* todo ACӴ쳣 */
+//            /* todo 发送AC接触器异常警报 */
 //        } else {
 //            event_node_tell_all(&p_this->evt_node, ERR_AC, FALSE);
 //        }
 //    } else {
 //        if (ac_enable == FALSE) {
-//            /* todo ACӴ쳣 */
+//            /* todo 发送AC接触器异常警报 */
 //            event_node_tell_all(&p_this->evt_node, ERR_AC, TRUE);
 //        } else {
 //            event_node_tell_all(&p_this->evt_node, ERR_AC, FALSE);
@@ -167,14 +468,15 @@ static void ac_detect_work_entry (void *p_arg)
     g_need_ac_check = TRUE;
 
 }
+#endif
 
 /**
- *  \brief ģʵʼ
- *  param [in]   p_this        : ģʵ
+ *  \brief 充电模块实例初始化
+ *  param [in]   p_this        : 充电模块实例
  *  */
 void charger_inst_init(charger_t *p_this, pile_sem_t *p_pile_sem)
 {
-    static role_t charger_idle  = {charger_idle_do};  /* ɰݵĽɫ -  */
+    static role_t charger_idle  = {charger_idle_do};  /* 可扮演的角色 - 充电空闲期 */
     p_this->player.pfn_play      = play;
     p_this->evt_node.pfunc_event = event_driver;
     p_this->p_charge_idle        = &charger_idle;
@@ -191,12 +493,26 @@ void charger_inst_init(charger_t *p_this, pile_sem_t *p_pile_sem)
     p_this->dat.max_curr    = (ACP1000_PILE_MAX_CURR /  10);
     p_this->dat.tp1_vol     = 0;
     p_this->dat.start_ticks = 0;
-#if ACP1000_AC1_ERR_DETECT
+
+    memset(&p_this->load, 0, sizeof(p_this->load));
+    p_this->load.cfg.enable        = (ACP1000_LOAD_MANAGE && ACP1000_LOAD_DEFAULT_EN);
+    p_this->load.cfg.curr_limit    = ACP1000_LOAD_FAILSAFE_CURR;
+    p_this->load.cfg.ramp_rate     = ACP1000_LOAD_RAMP_RATE;
+    p_this->load.cfg.min_curr      = ACP1000_LOAD_MIN_CURR;
+    p_this->load.cfg.failsafe_curr = ACP1000_LOAD_FAILSAFE_CURR;
+    p_this->load.update_ticks      = aw_sys_tick_get();
+
+    memset(&p_this->sched, 0, sizeof(p_this->sched));
+    p_this->sched.info.state = CHARGE_SCHED_STATE_OFF;
+#if ACP1000_AC1_ERR_DETECT && !ACP1000_CONTACTOR_MON
     aw_delayed_work_init(&(p_this->ac_detect_dk), ac_detect_work_entry, p_this);
 #endif
+#if ACP1000_CONTACTOR_MON
+    contactor_init(&p_this->evt_node);
+#endif
 }
-/* ===============================ɫ===================================  */
-static role_ret play(role_t **pp_role, void *p_arg)  /*  */
+/* ===============================扮演者与角色===================================  */
+static role_ret play(role_t **pp_role, void *p_arg)  /* 扮演 */
 {
     if ((*pp_role)->pfn_role_do) {
         return (*pp_role)->pfn_role_do(pp_role, p_arg);
@@ -205,27 +521,27 @@ static role_ret play(role_t **pp_role, void *p_arg)  /* 
 }
 
 /**
- * 
- * p_arg : ĿƬID
+ * 充电空闲
+ * p_arg : 传入的卡片ID
  */
 static role_ret charger_idle_do (struct role **pp_role, void *p_arg)
 {
     IDLE_TO_CHARGER(p_this, pp_role);
     uint8_t vol = (uint8_t)p_arg;
-    static int cnt = 0; /* ǹ */
+    static int cnt = 0; /* 插枪防抖计数 */
 
-    /* ״̬϶ǲ */
+    /* 该状态肯定是不充电的 */
 //    charger_ac_output_enable(p_this, FALSE);
-    aw_gpio_set(ACP1000_DOUT_AC, 0);
+    charger_ac_output_off();
 
     if ((6 == vol) || (9 == vol)) {
         cnt++;
         if (cnt > 20) {
             cnt = 0;
-            /* ס */
+            /* 锁住电子锁 */
             charger_elock_lock(p_this, TRUE);
 
-            /* ǹ¼ */
+            /* 发起枪插上事件 */
             event_node_tell_all(&p_this->evt_node, GUN_INSERT, NULL);
 
             charger_dev_lock(p_this);
@@ -243,9 +559,9 @@ static role_ret charger_idle_do (struct role **pp_role, void *p_arg)
         }
     } else {
        cnt = 0;
-       /* ס */
+       /* 锁住电子锁 */
        charger_elock_lock(p_this, FALSE);
-       /* ǹ¼ */
+       /* 发起枪插上事件 */
        event_node_tell_all(&p_this->evt_node, GUN_EXTRACT, NULL);
 
        charger_dev_lock(p_this);
@@ -257,29 +573,65 @@ static role_ret charger_idle_do (struct role **pp_role, void *p_arg)
 }
 
 /**
- * 
- * ǹǹɷǹ¼
- * p_arg : ĿƬID
+ * 充电允许
+ * 检测插枪，插枪完成发起插枪完成事件
+ * p_arg : 传入的卡片ID
  */
 static role_ret charger_allow_do (struct role **pp_role, void *p_arg)
 {
     ALLOW_TO_CHARGER(p_this, pp_role);
     uint8_t vol = (uint8_t)p_arg;
+    bool_t  cancel;
 
-    /* ״̬϶ǲ */
+    /* 该状态肯定是不充电的 */
 //    charger_ac_output_enable(p_this, FALSE);
-    aw_gpio_set(ACP1000_DOUT_AC, 0);
+    charger_ac_output_off();
+
+    charger_dev_lock(p_this);
+    cancel = p_this->dat.cancel;
+    p_this->dat.cancel = FALSE;
+    charger_dev_unlock(p_this);
+
+    if (12 == vol) {
+        /* 开始前拔枪（如推迟等待低价时段时）， 解锁并结束本次充电 */
+        charger_current_limit(p_this, 0);
+        charger_elock_lock(p_this, FALSE);
+        event_node_tell_all(&p_this->evt_node, CHARGE_PILE_STOP, NULL);
+        event_node_tell_all(&p_this->evt_node, GUN_EXTRACT, NULL);
+        p_this->dat.start_ticks = aw_sys_tick_get();
+#if ACP1000_HUB4G_BILLING
+        AW_SEMB_GIVE(p_this->p_pile_sem->charge_gun_sem);
+#endif
+        return AW_OK;
+    }
 
-    /* ֪ͨ */
+    if (cancel) {
+        /* 开始前人为或后台停止， 解锁后进入停止， 等待拔枪 */
+        charger_current_limit(p_this, 0);
+        charger_elock_lock(p_this, FALSE);
+        event_node_tell_all(&p_this->evt_node, CHARGE_PILE_STOP, NULL);
+        event_node_tell_all(&p_this->evt_node, ERR_CHAGER, (void *)p_this->dat.exit_code);
+        p_this->dat.start_ticks = aw_sys_tick_get();
+        return AW_OK;
+    }
+
+    /* 通知车辆充电机的最大输出电流 */
     if ((6 == vol) || (9 == vol)) {
-        /* ס */
+        /* 锁住电子锁 */
         charger_elock_lock(p_this, TRUE);
 
-        /* ǹ¼ */
+#if ACP1000_SCHED_CHARGE
+        /* 等待低价时段， CP不输出PWM，汽车保持在9V */
+        if (charger_sched_defer(p_this)) {
+            return AW_OK;
+        }
+#endif
+
+        /* 发起枪插上事件 */
         event_node_tell_all(&p_this->evt_node, CHARGE_PIEL_WAIT, NULL);
 
-        /* ֪ͨ */
-        charger_current_limit(p_this, p_this->dat.max_curr);
+        /* 通知车辆充电机的最大输出电流 */
+        charger_load_curr_update(p_this);
 
         p_this->dat.start_ticks = aw_sys_tick_get();
     }
@@ -288,8 +640,8 @@ static role_ret charger_allow_do (struct role **pp_role, void *p_arg)
 
 
 /**
- * 
- * p_arg : ĿƬID
+ * 充电启动
+ * p_arg : 传入的卡片ID
  */
 static role_ret charger_start_do (struct role **pp_role, void *p_arg)
 {
@@ -300,15 +652,15 @@ static role_ret charger_start_do (struct role **pp_role, void *p_arg)
 
     if (vol != 6) {
 //      charger_ac_output_enable(p_this, FALSE);
-        aw_gpio_set(ACP1000_DOUT_AC, 0);
+        charger_ac_output_off();
     }
 
     switch (vol) {
 
     case 6:
-        /*  */
+        /* 启动 */
         charger_ac_output_enable(p_this, TRUE);
-        /* ׼ʼ¼ */
+        /* 充电准备就绪，发起机身开始充电事件 */
         event_node_tell_all(&p_this->evt_node, CHARGE_PIEL_START, NULL);
         p_this->dat.start_ticks  = 0;
         break;
@@ -318,16 +670,16 @@ static role_ret charger_start_do (struct role **pp_role, void *p_arg)
         timeout_ms = aw_ticks_to_ms(end_ticks - p_this->dat.start_ticks);
         if (timeout_ms > CHARGER_9V_TIMEOUT_MS) {
             charger_current_limit(p_this, 0); // todo add by anu
-            /* ס */
+            /* 锁住电子锁 */
             charger_elock_lock(p_this, FALSE);
-            /* 쳣 */
+            /* 汽车充电就绪异常 */
             event_node_tell_all(&p_this->evt_node, ERR_CAR_READY, NULL);
             p_this->dat.start_ticks = aw_sys_tick_get();
         }
         break;
 
     case 12:
-        /* ǹγ */
+        /* 枪拔出，解锁 */
         charger_elock_lock(p_this, FALSE);
         event_node_tell_all(&p_this->evt_node, GUN_EXTRACT, NULL);
         event_node_tell_all(&p_this->evt_node, CHARGE_FULL, NULL);
@@ -346,8 +698,8 @@ static role_ret charger_start_do (struct role **pp_role, void *p_arg)
 }
 
 /**
- * 
- * p_arg : ĿƬID
+ * 充电中
+ * p_arg : 传入的卡片ID
  */
 static role_ret charger_ing_do (struct role **pp_role, void *p_arg)
 {
@@ -361,9 +713,9 @@ static role_ret charger_ing_do (struct role **pp_role, void *p_arg)
     exit_now = p_this->dat.exit_now;
     charger_dev_unlock(p_this);
     if (exit_now) {
-        /* ֹͣ */
+        /* 紧急停止充电 */
         charger_ac_output_enable(p_this, FALSE);
-        /* ׼ʼ¼ */
+        /* 充电准备就绪，发起机身开始充电事件 */
         event_node_tell_all(&p_this->evt_node, CHARGE_PILE_STOP, NULL);
         event_node_tell_all(&p_this->evt_node, ERR_CHAGER, p_this->dat.exit_code);
         charger_current_limit(p_this, 0);
@@ -378,29 +730,31 @@ static role_ret charger_ing_do (struct role **pp_role, void *p_arg)
     switch (vol) {
 
     case 6:
-        /*  */
+        /* 充电中 */
         if (!(p_this->dat.ac_enable)) {
             charger_ac_output_enable(p_this, TRUE);
         }
+        /* 跟随负荷管理分配的电流 */
+        charger_load_curr_update(p_this);
         break;
 
     case 9:
-        /* رAC */
+        /* 关闭AC输出，但仍输出脉冲 */
         charger_ac_output_enable(p_this, FALSE);
 
-        /* 쳣һʱرճ ⳬʱ */
+        /* 异常一时关闭充电 ，检测超时 */
         if ( 0 == p_this->dat.start_ticks) {
             p_this->dat.start_ticks = aw_sys_tick_get();
         }
 
-        /* ʱΪ */
+        /* 超时认为汽车充满 */
         end_ticks = aw_sys_tick_get();
         timeout_ms = aw_ticks_to_ms(end_ticks - p_this->dat.start_ticks);
         if (timeout_ms > CHARGER_UNLOCK_TIMEOUT_MS) {
-            /* ס */
+            /* 锁住电子锁 */
             charger_elock_lock(p_this, FALSE);
             event_node_tell_all(&p_this->evt_node, CHARGE_PILE_STOP, NULL);
-            /* 쳣 */
+            /* 汽车充电就绪异常 */
             event_node_tell_all(&p_this->evt_node, CHARGE_FULL, NULL);
             charger_current_limit(p_this, 0);
             p_this->dat.start_ticks = aw_sys_tick_get();
@@ -409,9 +763,9 @@ static role_ret charger_ing_do (struct role **pp_role, void *p_arg)
 
     case 12:
     default:
-        /* Ѿ */
+        /* 汽车已经充满 */
         charger_ac_output_enable(p_this, FALSE);
-        /* ׼ʼ¼ */
+        /* 充电准备就绪，发起机身开始充电事件 */
         event_node_tell_all(&p_this->evt_node, CHARGE_FULL, NULL);
         event_node_tell_all(&p_this->evt_node, CHARGE_PILE_STOP, NULL);
         charger_current_limit(p_this, 0);
@@ -423,8 +777,8 @@ static role_ret charger_ing_do (struct role **pp_role, void *p_arg)
 }
 
 /**
- * 쳣ֹͣ
- * p_arg : ĿƬID
+ * 异常充电停止
+ * p_arg : 传入的卡片ID
  */
 static role_ret charger_err_do (struct role **pp_role, void *p_arg)
 {
@@ -445,13 +799,13 @@ static role_ret charger_err_do (struct role **pp_role, void *p_arg)
 
     case 1:
         if (vol == 6) {
-           /* 쳣ʱδӦ ǿƹر */
+           /* 异常时汽车未作出反应 ，强制关闭 */
            end_ticks = aw_sys_tick_get();
            timeout_ms = aw_ticks_to_ms(end_ticks - p_this->dat.start_ticks);
            if (timeout_ms > CHARGER_ERR_TIMEOUT_MS) {
-               /* رյԴ  */
+               /* 关闭电源  */
                charger_ac_output_enable(p_this, FALSE);
-               /* ǹγ¼ */
+               /* 发起枪拔出事件 */
                event_node_tell_all(&p_this->evt_node, CHARGE_PILE_STOP, NULL);
                event_node_tell_all(&p_this->evt_node, ERR_CHAGER, p_this->dat.exit_code);
                p_this->dat.start_ticks = aw_sys_tick_get();
@@ -463,7 +817,7 @@ static role_ret charger_err_do (struct role **pp_role, void *p_arg)
     }
 
     if (vol != 6) {
-        /* رյԴ  */
+        /* 关闭电源  */
         charger_ac_output_enable(p_this, FALSE);
         event_node_tell_all(&p_this->evt_node, CHARGE_PILE_STOP, NULL);
         event_node_tell_all(&p_this->evt_node, ERR_CHAGER, p_this->dat.exit_code);
@@ -474,7 +828,7 @@ static role_ret charger_err_do (struct role **pp_role, void *p_arg)
 }
 
 /**
- * ֹͣ
+ * 停止充电
  */
 static role_ret charger_stop_do (struct role **pp_role, void *p_arg)
 {
@@ -484,14 +838,14 @@ static role_ret charger_stop_do (struct role **pp_role, void *p_arg)
     aw_tick_t   end_ticks;
     uint32_t    timeout_ms;
 
-    /* ״̬϶ǲ */
+    /* 该状态肯定是不充电的 */
 //    charger_ac_output_enable(p_this, FALSE);
-    aw_gpio_set(ACP1000_DOUT_AC, 0);
+    charger_ac_output_off();
 
     switch (vol) {
 
     case 6:
-        /*  */
+        /* 充电中 */
         break;
 
     case 9:
@@ -499,13 +853,13 @@ static role_ret charger_stop_do (struct role **pp_role, void *p_arg)
 
     case 12:
         charger_current_limit(p_this, 0); // todo add by anu
-        /* ʱΪ */
+        /* 超时认为汽车充满 */
        end_ticks = aw_sys_tick_get();
        timeout_ms = aw_ticks_to_ms(end_ticks - p_this->dat.start_ticks);
        if (timeout_ms > CHARGER_UNLOCK_TIMEOUT_MS) {
-           /*  */
+           /* 解除电子锁 */
            charger_elock_lock(p_this, FALSE);
-           /* ǹγ¼ */
+           /* 发起枪拔出事件 */
            event_node_tell_all(&p_this->evt_node, GUN_EXTRACT, NULL);
 #if ACP1000_HUB4G_BILLING
            AW_SEMB_GIVE(p_this->p_pile_sem->charge_gun_sem);
@@ -522,16 +876,16 @@ static role_ret charger_stop_do (struct role **pp_role, void *p_arg)
 
 
 
-/*=============================¼==========================================*/
+/*=============================事件驱动==========================================*/
 void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
 {
     EVT_TO_CHARGER(p_this, p_evt);
-    static role_t charger_idle  = {charger_idle_do};  /* ɰݵĽɫ -  */
-    static role_t charger_allow = {charger_allow_do}; /* ɰݵĽɫ  - ö */
-    static role_t charger_start = {charger_start_do}; /* ɰݵĽɫ  - ö */
-    static role_t charger_ing   = {charger_ing_do};   /* ɰݵĽɫ  - п */
-    static role_t charger_stop  = {charger_stop_do};  /* ɰݵĽɫ  - ֹͣ */
-    static role_t charger_err   = {charger_err_do};   /* ɰݵĽɫ  - 쳣 */
+    static role_t charger_idle  = {charger_idle_do};  /* 可扮演的角色 - 充电空闲期 */
+    static role_t charger_allow = {charger_allow_do}; /* 可扮演的角色  - 允许充电裁定器 */
+    static role_t charger_start = {charger_start_do}; /* 可扮演的角色  - 启动充电裁定器 */
+    static role_t charger_ing   = {charger_ing_do};   /* 可扮演的角色  - 启动中控制器 */
+    static role_t charger_stop  = {charger_stop_do};  /* 可扮演的角色  - 充电停止控制器 */
+    static role_t charger_err   = {charger_err_do};   /* 可扮演的角色  - 充电异常控制器 */
 
     uint32_t arg = (uint32_t)p_arg;
     bool_t   allow_charge;
@@ -544,11 +898,11 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
         allow_charge = p_this->dat.allow_charge;
         charger_dev_unlock(p_this);
 
-        /* Ϊʼ */
+        /* 人为开始充电 */
         AW_MUTEX_LOCK(p_this->role_lock, AW_SEM_WAIT_FOREVER);
         if ((p_this->p_charge_idle == NULL) ||
              (allow_charge != TRUE)) {
-            /* ڿУΪ */
+            /* 不在空闲中，不允许人为启动充电 */
             AW_MUTEX_UNLOCK(p_this->role_lock);
             return;
         }
@@ -559,10 +913,14 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
         p_this->p_charge_stop  = NULL;
         p_this->p_charge_err   = NULL;
         AW_MUTEX_UNLOCK(p_this->role_lock);
+
+        charger_dev_lock(p_this);
+        p_this->dat.cancel = FALSE;
+        charger_dev_unlock(p_this);
         break;
 
     case CHARGE_PIEL_START:
-        /* 翪ʼ */
+        /* 充电开始 */
         AW_MUTEX_LOCK(p_this->role_lock, AW_SEM_WAIT_FOREVER);
         p_this->p_charge_idle  = NULL;
         p_this->p_charge_allow = NULL;
@@ -571,13 +929,21 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
         p_this->p_charge_stop  = NULL;
         p_this->p_charge_err   = NULL;
         AW_MUTEX_UNLOCK(p_this->role_lock);
+
+        /* 开始后不可再推迟，按已开始重新规划 */
+        charger_dev_lock(p_this);
+        p_this->sched.started      = TRUE;
+        p_this->sched.start_energy = p_this->sched.now_energy;
+        p_this->sched.curr_cap     = 0;
+        p_this->sched.replan       = TRUE;
+        charger_dev_unlock(p_this);
         break;
 
     case CARD_AUTH_FAIL:
     case CHARGE_PILE_STOP:
     case ERR_CAR_READY:
     case ERR_CHAGER:
-        /*  */
+        /* 充电结束 */
         AW_MUTEX_LOCK(p_this->role_lock, AW_SEM_WAIT_FOREVER);
         p_this->p_charge_idle  = NULL;
         p_this->p_charge_allow = NULL;
@@ -589,6 +955,10 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
 
         charger_dev_lock(p_this);
         p_this->dat.allow_charge = FALSE;
+        /* 规划只对本次充电有效， 任何原因结束都清除 */
+        memset(&p_this->sched.cfg, 0, sizeof(p_this->sched.cfg));
+        p_this->sched.started = FALSE;
+        p_this->sched.replan  = TRUE;
         charger_dev_unlock(p_this);
         break;
 
@@ -614,10 +984,19 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
         AW_MUTEX_UNLOCK(p_this->role_lock);
         break;
 
-    case CHARGE_BG_STOP:  /* ֹ̨ */
+    case CHARGE_BG_STOP:  /* 后台终止充电 */
         AW_MUTEX_LOCK(p_this->role_lock, AW_SEM_WAIT_FOREVER);
+        if (p_this->p_charge_allow != NULL) {
+            /* 尚未开始（如推迟等待低价时段）， 由允许角色解锁后停止 */
+            AW_MUTEX_UNLOCK(p_this->role_lock);
+            charger_dev_lock(p_this);
+            p_this->dat.exit_code = AW_MB_DGUS_CHARGE_BG_EXIT;
+            p_this->dat.cancel    = TRUE;
+            charger_dev_unlock(p_this);
+            return;
+        }
         if (p_this->p_charge_ing == NULL) {
-            /* ڳУ */
+            /* 不在充电中，无作用 */
             AW_MUTEX_UNLOCK(p_this->role_lock);
             return;
         }
@@ -633,8 +1012,17 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
 
     case CHARGE_MAN_STOP:
         AW_MUTEX_LOCK(p_this->role_lock, AW_SEM_WAIT_FOREVER);
+        if (p_this->p_charge_allow != NULL) {
+            /* 尚未开始（如推迟等待低价时段）， 由允许角色解锁后停止 */
+            AW_MUTEX_UNLOCK(p_this->role_lock);
+            charger_dev_lock(p_this);
+            p_this->dat.exit_code = AW_MB_DGUS_CHARGE_MAN_EXIT;
+            p_this->dat.cancel    = TRUE;
+            charger_dev_unlock(p_this);
+            return;
+        }
         if (p_this->p_charge_ing == NULL) {
-            /* ڳУ */
+            /* 不在充电中，无作用 */
             AW_MUTEX_UNLOCK(p_this->role_lock);
             return;
         }
@@ -656,7 +1044,7 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
     case ERR_DUGS:
     case ERR_HUB4G_COMM:
         if (arg == 0) {
-            /* ߵ˳쳣ɫ  */
+            /* 读卡器或者电表正常，退出，否则进入异常处理角色  */
             return;
         }
         if (ERR_AMMETER == event) {
@@ -676,7 +1064,7 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
     case BILLING_STOP:
         AW_MUTEX_LOCK(p_this->role_lock, AW_SEM_WAIT_FOREVER);
         if (p_this->p_charge_ing == NULL) {
-            /* ڳУ */
+            /* 不在充电中，无作用 */
             AW_MUTEX_UNLOCK(p_this->role_lock);
             return;
         }
@@ -705,7 +1093,7 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
             } else if (ERR_SCRAM == event) {
                 stop_reason = AW_MB_DGUS_CHARGE_SCRAM;
             }
-            /* 쳣 ͬϿԴ */
+            /* 异常 ，同步断开电源 */
 //            p_this->dat.exit_code = AW_MB_DGUS_CHARGE_ERR_EXIT;
             p_this->dat.exit_code = stop_reason;
             charger_dev_lock(p_this);
@@ -714,12 +1102,55 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
         }
         break;
 
-    case PILE_ALARM: /* 澯 */
+    case PILE_ALARM: /* 保存告警情况 */
          charger_dev_lock(p_this);
          p_this->dat.pile_alarm  = arg;
          charger_dev_unlock(p_this);
          break;
 
+#if ACP1000_THERMAL_DERATE
+    case TEMP_DERATE: /* 过温降额，于充电任务下一周期生效 */
+         charger_dev_lock(p_this);
+         p_this->load.temp_limit = arg;
+         charger_dev_unlock(p_this);
+         break;
+#endif
+
+#if ACP1000_LOAD_MANAGE
+    case HUB4G_LOAD_CTRL: /* 负荷管理参数，于充电任务下一周期生效 */
+         if (NULL != p_arg) {
+             charger_load_cfg_set(p_this, (charge_load_t *)p_arg);
+         }
+         break;
+#endif
+
+#if ACP1000_SCHED_CHARGE
+    case HUB4G_SCHED_CTRL: /* 智能充电规划参数，于充电任务下一周期重新规划 */
+         if (NULL != p_arg) {
+             charger_dev_lock(p_this);
+             p_this->sched.cfg      = *(charge_sched_cfg_t *)p_arg;
+             p_this->sched.curr_cap = 0;
+             p_this->sched.replan   = TRUE;
+             charger_dev_unlock(p_this);
+         }
+         break;
+
+    case HUB4G_PRICE_UPDATE:
+         charger_dev_lock(p_this);
+         p_this->sched.replan = TRUE;
+         charger_dev_unlock(p_this);
+         break;
+
+    case AMETER_MEASURE:
+         charger_dev_lock(p_this);
+         p_this->sched.now_energy = ((ammeter_dat_t *)p_arg)->now_energy;
+         p_this->sched.vol        = ((ammeter_dat_t *)p_arg)->now_vol > 0 ?
+                                    ((ammeter_dat_t *)p_arg)->now_vol : 0;
+         p_this->sched.meas_curr  = ((ammeter_dat_t *)p_arg)->now_curr / 10;
+         charger_dev_unlock(p_this);
+         break;
+#endif
+
     default: break;
     }
 }
@@ -727,58 +1158,107 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
 #define CHARGER_TASK_PRIO       2
 #define CHARGER_TACK_SIZE       4096
 #define CHARGER_DETECT_PERIOD   30
-AW_TASK_DECL_STATIC(charger_task, CHARGER_TACK_SIZE);
 
 /**
- * ̽
+ * 充电控制（每周期执行一次）
  */
-static void charger_task_entry (void *p_arg)
+static void charger_job (void *p_arg)
 {
     charger_t *p_this = (charger_t *)p_arg;
     uint8_t    vol    = 0;
     role_t     *p_role[6];
 
-    while (1) {
-        charger_dev_lock(p_this);
-        vol = p_this->dat.tp1_vol;
-        charger_dev_unlock(p_this);
+#if ACP1000_SCHED_CHARGE
+    charger_sched_update(p_this);
+#endif
+    charger_dev_lock(p_this);
+    vol = p_this->dat.tp1_vol;
+    charger_dev_unlock(p_this);
 
-        AW_MUTEX_LOCK(p_this->role_lock, AW_SEM_WAIT_FOREVER);
-        memcpy(&p_role[0], &p_this->p_charge_idle, sizeof(role_t*) * 6);
-        AW_MUTEX_UNLOCK(p_this->role_lock);
+    AW_MUTEX_LOCK(p_this->role_lock, AW_SEM_WAIT_FOREVER);
+    memcpy(&p_role[0], &p_this->p_charge_idle, sizeof(role_t*) * 6);
+    AW_MUTEX_UNLOCK(p_this->role_lock);
 
-        if (NULL != p_role[0]) {
-            p_this->player.pfn_play(&p_this->p_charge_idle, (void *)vol);
+    if (NULL != p_role[0]) {
+        p_this->player.pfn_play(&p_this->p_charge_idle, (void *)vol);
 
-        } else if (NULL != p_role[1]) {
-            p_this->player.pfn_play(&p_this->p_charge_allow, (void *)vol);
+    } else if (NULL != p_role[1]) {
+        p_this->player.pfn_play(&p_this->p_charge_allow, (void *)vol);
 
-        } else if (NULL != p_role[2]) {
-            p_this->player.pfn_play(&p_this->p_charge_start, (void *)vol);
+    } else if (NULL != p_role[2]) {
+        p_this->player.pfn_play(&p_this->p_charge_start, (void *)vol);
 
-        } else if (NULL != p_role[3]) {
-            p_this->player.pfn_play(&p_this->p_charge_ing, (void *)vol);
+    } else if (NULL != p_role[3]) {
+        p_this->player.pfn_play(&p_this->p_charge_ing, (void *)vol);
 
-        } else if (NULL != p_role[4]) {
-            p_this->player.pfn_play(&p_this->p_charge_stop, (void *)vol);
+    } else if (NULL != p_role[4]) {
+        p_this->player.pfn_play(&p_this->p_charge_stop, (void *)vol);
 
-        }  else if (NULL != p_role[5]) {
-            p_this->player.pfn_play(&p_this->p_charge_err, (void *)vol);
+    }  else if (NULL != p_role[5]) {
+        p_this->player.pfn_play(&p_this->p_charge_err, (void *)vol);
+    }
+
+#if ACP1000_LAT_HIST
+    {
+        /* 当前角色（第一个非空角色）变化时结束CP路径， 其它任务引起的变化在下一周期发现 */
+        static int last_idx = -1;
+        int        idx;
+
+        AW_MUTEX_LOCK(p_this->role_lock, AW_SEM_WAIT_FOREVER);
+        memcpy(&p_role[0], &p_this->p_charge_idle, sizeof(role_t*) * 6);
+        AW_MUTEX_UNLOCK(p_this->role_lock);
+        for (idx = 0; (idx < 6) && (NULL == p_role[idx]); idx++) {
+            ;
         }
+        if (idx != last_idx) {
+            if (last_idx >= 0) {
+                LAT_HIST_END(LAT_HIST_CP_ROLE);
+            }
+            last_idx = idx;
+        }
+    }
+#endif
+}
 
+#if ACP1000_PERIODIC
+static periodic_job_t __g_charger_job;
+#else
+AW_TASK_DECL_STATIC(charger_task, CHARGER_TACK_SIZE);
+TASK_WDT_DECL(__g_charger_wdt);
 
+/**
+ * 充电控制任务
+ */
+static void charger_task_entry (void *p_arg)
+{
+    while (1) {
+        TASK_WDT_BEAT(__g_charger_wdt);
+        charger_job(p_arg);
         aw_mdelay(CHARGER_DETECT_PERIOD);
     }
 }
+#endif
 
 void charger_task_startup (charger_t *p_this)
 {
-    AW_TASK_INIT(charger_task,           /* ʵ */
-                 "charger_task",            /*  */
-                 CHARGER_TASK_PRIO,      /* ȼ */
-                 CHARGER_TACK_SIZE,      /* ջС */
-                 charger_task_entry,     /* ں */
-                 (void *)p_this);        /* ڲ */
-    /*  */
+#if ACP1000_PERIODIC
+    periodic_job_init(&__g_charger_job,
+                      "charger",
+                      charger_job,
+                      (void *)p_this,
+                      CHARGER_DETECT_PERIOD,
+                      0,
+                      CHARGER_TACK_SIZE);
+    periodic_job_add(&__g_charger_job);
+#else
+    TASK_WDT_ADD(__g_charger_wdt, "charger_task", CHARGER_DETECT_PERIOD + TASK_WDT_SLACK_MS);
+    AW_TASK_INIT(charger_task,           /* 任务实体 */
+                 "charger_task",            /* 任务名字 */
+                 CHARGER_TASK_PRIO,      /* 任务优先级 */
+                 CHARGER_TACK_SIZE,      /* 任务堆栈大小 */
+                 charger_task_entry,     /* 任务入口函数 */
+                 (void *)p_this);        /* 任务入口参数 */
+    /* 启动任务 */
     AW_TASK_STARTUP(charger_task);
+#endif
 }
@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief 
+ * \brief 充电机声明
  *
  * \internal
  * \par modification history:
@@ -30,43 +30,109 @@
 #include "ac_charge_prj_cfg.h"
 #include "aw_delayed_work.h"
 #include "pile.h"
+#include "charge_sched.h"
+#include "charge_load.h"
 /**
- * 
+ * 充电数据
  */
 typedef struct charge_dat {
-    uint32_t  max_curr;    /*  */
-    uint32_t  curr_pwm;    /* CP PWM */
-    uint8_t   tp1_vol;      /* CPѹ */
-    uint8_t   ac_enable;   /* ACTRUE: FALSE: û */
-    aw_tick_t start_ticks; /* ʱticks */
-    uint32_t  exit_code;   /* ˳ \ref grp_charge_stop_reason */
-    bool_t    exit_now;    /* ǷҪ˳ ⲿ쳣 */
-    bool_t    allow_charge; /* жǷԳ */
-    uint32_t  pile_alarm;   /* ׮澯 */
+    uint32_t  max_curr;    /* 最大电流 */
+    uint32_t  curr_pwm;    /* CP PWM编号 */
+    uint8_t   tp1_vol;      /* CP电压 */
+    uint8_t   ac_enable;   /* AC输出情况，TRUE: 输出，FALSE: 没有输出 */
+    aw_tick_t start_ticks; /* 超时检测ticks */
+    uint32_t  exit_code;   /* 充电退出代码 \ref grp_charge_stop_reason */
+    bool_t    exit_now;    /* 是否需要马上退出（ 由外部紧急异常触发） */
+    bool_t    cancel;      /* 开始充电前取消（人为或后台停止， 如推迟等待低价时段时） */
+    bool_t    allow_charge; /* 充电机判断是否可以充电 */
+    uint32_t  pile_alarm;   /* 桩告警情况 */
 }charge_dat_t;
 
+/**
+ * 负荷管理运行情况
+ */
+typedef struct charge_load_state {
+    charge_load_t cfg;          /* 负荷管理参数 */
+    uint32_t      now_curr;     /* 当前CP下发的电流，0：未下发 */
+    aw_tick_t     update_ticks; /* 最近一次收到分配电流的ticks */
+    aw_tick_t     ramp_ticks;   /* 最近一次调整电流的ticks */
+    bool_t        link_lost;    /* 是否与集中器失联 */
+    uint32_t      temp_limit;   /* 过温降额电流，0：不降额 */
+}charge_load_state_t;
+
+/**
+ * 智能充电规划参数
+ */
+typedef struct charge_sched_cfg {
+    bool_t    enable;       /* 是否按规划充电（仅对本次充电有效） */
+    uint32_t  energy;       /* 目标充电量，单位0.01kWh */
+    uint8_t   depart_hour;  /* 离开时间 时 0 - 23 */
+    uint8_t   depart_min;   /* 离开时间 分 0 - 59 */
+}charge_sched_cfg_t;
+
+/**
+ * \brief 智能充电规划状态
+ * \anchor grp_charge_sched_state
+ * @{
+ */
+#define CHARGE_SCHED_STATE_OFF    0  /**< \brief 未启用    */
+#define CHARGE_SCHED_STATE_WAIT   1  /**< \brief 等待低价时段    */
+#define CHARGE_SCHED_STATE_RUN    2  /**< \brief 按规划充电    */
+#define CHARGE_SCHED_STATE_DONE   3  /**< \brief 已达到目标充电量    */
+#define CHARGE_SCHED_STATE_ASAP   4  /**< \brief 离开前无法充满， 全速充电    */
+/** @} */
+
+/**
+ * 智能充电规划发布信息
+ */
+typedef struct charge_sched_info {
+    uint16_t  state;        /* 规划状态 \ref grp_charge_sched_state */
+    uint16_t  start_delay;  /* 距离开始充电的分钟数 */
+    uint16_t  plan_curr;    /* 当前时段的规划电流，单位0.01A */
+    uint32_t  cost;         /* 预计电费，单位0.01元 */
+}charge_sched_info_t;
+
+/**
+ * 智能充电规划运行情况
+ */
+typedef struct charge_sched_state {
+    charge_sched_cfg_t   cfg;          /* 规划参数 */
+    charge_sched_plan_t  plan;         /* 当前规划 */
+    charge_sched_info_t  info;         /* 发布信息 */
+    aw_tick_t            plan_ticks;   /* 规划起点ticks */
+    uint32_t             start_energy; /* 开始充电时的电表电量，单位0.01kWh */
+    uint32_t             now_energy;   /* 电表电量，单位0.01kWh */
+    uint32_t             vol;          /* 电表电压，单位0.1V */
+    uint32_t             meas_curr;    /* 电表电流，单位0.01A */
+    uint32_t             curr_cap;     /* 车辆实际可接受的电流，单位0.01A，0：不限制 */
+    bool_t               started;      /* 本次充电是否已开始 */
+    bool_t               replan;       /* 是否需要重新规划 */
+}charge_sched_state_t;
+
 
 /**
- * 
+ * 充电控制器
  */
 typedef struct charge {
-    player_t          player;    /*  */
-    event_node_t      evt_node;  /* ¼ӿ */
+    player_t          player;    /* 扮演者 */
+    event_node_t      evt_node;  /* 事件接口 */
 
-    role_t           *p_charge_idle;  /* ɰݵĽɫ -  */
-    role_t           *p_charge_allow; /* ɰݵĽɫ  - ö */
-    role_t           *p_charge_start; /* ɰݵĽɫ  - ö */
-    role_t           *p_charge_ing;   /* ɰݵĽɫ  - п */
-    role_t           *p_charge_stop;  /* ɰݵĽɫ  - ֹͣ */
-    role_t           *p_charge_err;   /* ɰݵĽɫ  - 쳣 */
-    AW_MUTEX_DECL(role_lock);         /**< \brief ɫ  */
+    role_t           *p_charge_idle;  /* 可扮演的角色 - 充电空闲期 */
+    role_t           *p_charge_allow; /* 可扮演的角色  - 允许充电裁定器 */
+    role_t           *p_charge_start; /* 可扮演的角色  - 启动充电裁定器 */
+    role_t           *p_charge_ing;   /* 可扮演的角色  - 启动中控制器 */
+    role_t           *p_charge_stop;  /* 可扮演的角色  - 充电停止控制器 */
+    role_t           *p_charge_err;   /* 可扮演的角色  - 充电异常控制器 */
+    AW_MUTEX_DECL(role_lock);         /**< \brief 角色锁  */
 
-    charge_dat_t      dat;            /* Ƭ */
-    AW_MUTEX_DECL(dev_lock);          /**< \brief 豸  */
+    charge_dat_t      dat;            /* 卡片数据 */
+    charge_load_state_t load;         /* 负荷管理 （受设备锁保护） */
+    charge_sched_state_t sched;       /* 智能充电规划 （受设备锁保护） */
+    AW_MUTEX_DECL(dev_lock);          /**< \brief 设备锁  */
 
-    pile_sem_t       *p_pile_sem;     /* źͬ */
+    pile_sem_t       *p_pile_sem;     /* 信号量同步 */
 
-#if ACP1000_AC1_ERR_DETECT
+#if ACP1000_AC1_ERR_DETECT && !ACP1000_CONTACTOR_MON
     struct aw_delayed_work  ac_detect_dk;
 #endif
 
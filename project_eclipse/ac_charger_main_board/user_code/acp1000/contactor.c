@@ -0,0 +1,305 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 交流接触器反馈监测
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-06  xjc, first implementation
+ * - 1.01 16-10-15  xjc, 登记心跳监视， 反馈稳定时也定时唤醒
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include "string.h"
+#include "ac_charge_prj_cfg.h"
+
+#if ACP1000_CONTACTOR_MON
+
+#include "aw_gpio.h"
+#include "aw_int.h"
+#include "aw_sem.h"
+#include "aw_task.h"
+#include "aw_system.h"
+#include "aw_vdebug.h"
+#include "acp1000_din.h"
+#include "event_node.h"
+#include "contactor.h"
+#include "lat_hist.h"
+#include "task_wdt.h"
+
+#define CONTACTOR_TASK_PRIO     1
+#define CONTACTOR_TACK_SIZE     1024
+AW_TASK_DECL_STATIC(contactor_task, CONTACTOR_TACK_SIZE);
+
+extern bool_t g_ac_check_en;
+
+static event_node_t       *__gp_node;
+AW_SEMB_DECL_STATIC(__g_wake_sem);        /* 边沿或命令唤醒 */
+AW_MUTEX_DECL_STATIC(__g_lock);           /* 保护命令及统计 */
+
+/* 中断中更新 */
+static volatile uint32_t   __g_edge_cnt;
+static volatile uint32_t   __g_edge_ticks;
+
+/* 以下受 __g_lock 保护 */
+static contactor_stat_t    __g_stat;
+static uint32_t            __g_cmd_ticks;     /* 命令下发时刻 */
+static bool_t              __g_err_raised;    /* 已上报接触器异常 */
+
+/* 以下仅在监测任务中访问 */
+static uint32_t            __g_seen_edges;
+static uint8_t             __g_level;         /* 最近一次读取的反馈  TRUE： 闭合 */
+static uint32_t            __g_change_ticks;  /* 反馈最近一次变化时刻 */
+static uint32_t            __g_confirm_ticks;
+static uint32_t            __g_act_ticks;
+
+/**
+ * \brief 读取反馈（DI_AC1 低电平为闭合）
+ */
+static uint8_t __fb_get (void)
+{
+    return (0 == aw_gpio_get(ACP1000_DIN_AC1)) ? TRUE : FALSE;
+}
+
+/**
+ * \brief 反馈边沿中断， 只记录时刻并唤醒任务
+ */
+static void __edge_isr (void *p_arg)
+{
+    __g_edge_ticks = aw_sys_tick_get();
+    __g_edge_cnt++;
+#if ACP1000_LAT_HIST
+    if (!__fb_get()) {
+        LAT_HIST_END(LAT_HIST_SCRAM_AC);
+    }
+#endif
+    AW_SEMB_GIVE(__g_wake_sem);
+}
+
+static void __act_record (contactor_act_t *p_act, uint32_t ms)
+{
+    if ((0 == p_act->ops) || (ms < p_act->min)) {
+        p_act->min = ms;
+    }
+    if (ms > p_act->max) {
+        p_act->max = ms;
+    }
+    p_act->last  = ms;
+    p_act->sum  += ms;
+    p_act->ops++;
+}
+
+static uint32_t __min (uint32_t a, uint32_t b)
+{
+    return (a < b) ? a : b;
+}
+
+/**
+ * \brief 检查一次反馈
+ * \return 下次检查前最多等待的节拍数
+ */
+static int __check (void)
+{
+    uint32_t now   = aw_sys_tick_get();
+    uint8_t  level = __fb_get();
+    uint32_t edges, edge_ticks;
+    uint32_t stable_left = 0;
+    uint32_t wait        = (uint32_t)-1;
+    int      tell_ac     = -1;
+    int      tell_err    = -1;
+
+    AW_INT_CPU_LOCK_DECL(key);
+
+    AW_INT_CPU_LOCK(key);
+    edges      = __g_edge_cnt;
+    edge_ticks = __g_edge_ticks;
+    AW_INT_CPU_UNLOCK(key);
+
+    /* 每个边沿都重新开始确认窗口， 触点抖动期间不做判断 */
+    if (edges != __g_seen_edges) {
+        __g_seen_edges   = edges;
+        __g_change_ticks = edge_ticks;
+    } else if (level != __g_level) {
+        __g_change_ticks = now;     /* 轮询发现的变化 */
+    }
+    if (!level && (level != __g_level)) {
+        LAT_HIST_END(LAT_HIST_SCRAM_AC);    /* 无边沿中断时在此结束 */
+    }
+    __g_level = level;
+
+    if ((now - __g_change_ticks) < __g_confirm_ticks) {
+        stable_left = __g_confirm_ticks - (now - __g_change_ticks);
+        wait        = stable_left;
+    }
+
+    AW_MUTEX_LOCK(__g_lock, AW_SEM_WAIT_FOREVER);
+    __g_stat.edges = edges;
+    if (0 == stable_left) {
+        __g_stat.fb = level;
+    }
+    switch (__g_stat.state) {
+
+    case CONTACTOR_STATE_WAIT:
+        if ((0 == stable_left) && (level == __g_stat.cmd)) {
+            /* 动作到位， 动作时间取命令到反馈最后一次变化 */
+            __act_record(&__g_stat.act[__g_stat.cmd],
+                         ((int32_t)(__g_change_ticks - __g_cmd_ticks) > 0) ?
+                         aw_ticks_to_ms(__g_change_ticks - __g_cmd_ticks) : 0);
+            __g_stat.state = CONTACTOR_STATE_OK;
+            tell_ac        = __g_stat.cmd;
+        } else if ((now - __g_cmd_ticks) >= __g_act_ticks) {
+            __g_stat.act[__g_stat.cmd].timeouts++;
+            __g_stat.detect_ms = aw_ticks_to_ms(now - __g_cmd_ticks);
+            __g_stat.state     = CONTACTOR_STATE_FAULT;
+            tell_ac            = __g_stat.cmd;
+        } else {
+            wait = __min(wait, __g_act_ticks - (now - __g_cmd_ticks));
+        }
+        break;
+
+    case CONTACTOR_STATE_OK:
+        if ((0 == stable_left) && (level != __g_stat.cmd)) {
+            /* 粘连或脱落 */
+            __g_stat.faults++;
+            __g_stat.detect_ms = aw_ticks_to_ms(now - __g_change_ticks);
+            __g_stat.state     = CONTACTOR_STATE_FAULT;
+        }
+        break;
+
+    case CONTACTOR_STATE_FAULT:
+        if ((0 == stable_left) && (level == __g_stat.cmd)) {
+            __g_stat.state = CONTACTOR_STATE_OK;
+        }
+        break;
+
+    default: break;
+    }
+
+    if ((CONTACTOR_STATE_FAULT == __g_stat.state) && !__g_err_raised && g_ac_check_en) {
+        __g_err_raised = TRUE;
+        tell_err       = TRUE;
+    } else if ((CONTACTOR_STATE_OK == __g_stat.state) && __g_err_raised) {
+        __g_err_raised = FALSE;
+        tell_err       = FALSE;
+    }
+    if (!__g_stat.irq) {
+        wait = __min(wait, __g_confirm_ticks);
+    }
+    AW_MUTEX_UNLOCK(__g_lock);
+
+    /* 在锁外上报， 避免与充电控制器下发命令互锁 */
+    if (tell_ac >= 0) {
+        event_node_tell_all(__gp_node, CHARGE_AC_STATE, (void *)tell_ac);
+    }
+    if (tell_err >= 0) {
+        event_node_tell_all(__gp_node, ERR_AC, (void *)tell_err);
+    }
+
+    return ((uint32_t)-1 == wait) ? AW_SEM_WAIT_FOREVER : (int)wait;
+}
+
+#define CONTACTOR_WDT_MS        500     /* 心跳间隔， 反馈稳定时也按此唤醒 */
+TASK_WDT_DECL(__g_wdt_node);
+
+static void __task_entry (void *p_arg)
+{
+    int wait;
+
+    while (1) {
+        wait = __check();
+        TASK_WDT_BEAT(__g_wdt_node);
+#if ACP1000_TASK_WDT
+        if ((AW_SEM_WAIT_FOREVER == wait) || (wait > (int)aw_ms_to_ticks(CONTACTOR_WDT_MS))) {
+            wait = aw_ms_to_ticks(CONTACTOR_WDT_MS);
+        }
+#endif
+        AW_SEMB_TAKE(__g_wake_sem, wait);
+    }
+}
+
+/******************************************************************************/
+void contactor_init (event_node_t *p_node)
+{
+    __gp_node = p_node;
+    AW_SEMB_INIT(__g_wake_sem, AW_SEM_EMPTY, AW_SEM_Q_PRIORITY);
+    AW_MUTEX_INIT(__g_lock, AW_SEM_Q_PRIORITY);
+
+    __g_confirm_ticks = aw_ms_to_ticks(ACP1000_CONTACTOR_CONFIRM_MS);
+    __g_act_ticks     = aw_ms_to_ticks(ACP1000_CONTACTOR_ACT_MS);
+    if (0 == __g_confirm_ticks) {
+        __g_confirm_ticks = 1;
+    }
+
+    /* 上电时命令为断开且视为已到位， 上电即粘连在确认窗口后检出 */
+    memset(&__g_stat, 0, sizeof(__g_stat));
+    __g_stat.cmd      = FALSE;
+    __g_stat.state    = CONTACTOR_STATE_OK;
+    __g_err_raised    = FALSE;
+    __g_cmd_ticks     = aw_sys_tick_get();
+    __g_level         = __fb_get();
+    __g_change_ticks  = __g_cmd_ticks;
+    __g_seen_edges    = 0;
+    __g_edge_cnt      = 0;
+
+    if ((AW_OK == aw_gpio_trigger_connect(ACP1000_DIN_AC1, __edge_isr, NULL)) &&
+        (AW_OK == aw_gpio_trigger_cfg(ACP1000_DIN_AC1, AW_GPIO_TRIGGER_BOTH_EDGES)) &&
+        (AW_OK == aw_gpio_trigger_on(ACP1000_DIN_AC1))) {
+        __g_stat.irq = TRUE;
+    } else {
+        /* 引脚不支持中断时按确认窗口周期轮询 */
+        AW_INFOF(("contactor: no pin trigger, polling\r\n"));
+        __g_stat.irq = FALSE;
+    }
+}
+
+void contactor_task_startup (void)
+{
+    TASK_WDT_ADD(__g_wdt_node, "contactor_task", CONTACTOR_WDT_MS + TASK_WDT_SLACK_MS);
+    AW_TASK_INIT(contactor_task,      /* 任务实体 */
+                 "contactor_task",    /* 任务名字 */
+                 CONTACTOR_TASK_PRIO, /* 任务优先级 */
+                 CONTACTOR_TACK_SIZE, /* 任务堆栈大小 */
+                 __task_entry,        /* 任务入口函数 */
+                 NULL);               /* 任务入口参数 */
+    /* 启动任务 */
+    AW_TASK_STARTUP(contactor_task);
+}
+
+void contactor_cmd (bool_t close)
+{
+    close = close ? TRUE : FALSE;
+
+    AW_MUTEX_LOCK(__g_lock, AW_SEM_WAIT_FOREVER);
+    if (close == __g_stat.cmd) {
+        AW_MUTEX_UNLOCK(__g_lock);
+        return;
+    }
+    /* 已上报的异常在新动作到位后解除 */
+    __g_stat.cmd   = close;
+    __g_stat.state = CONTACTOR_STATE_WAIT;
+    __g_cmd_ticks  = aw_sys_tick_get();
+    AW_MUTEX_UNLOCK(__g_lock);
+
+    AW_SEMB_GIVE(__g_wake_sem);
+}
+
+void contactor_stat_get (contactor_stat_t *p_stat)
+{
+    AW_MUTEX_LOCK(__g_lock, AW_SEM_WAIT_FOREVER);
+    memcpy(p_stat, &__g_stat, sizeof(*p_stat));
+    AW_MUTEX_UNLOCK(__g_lock);
+}
+
+#endif /* ACP1000_CONTACTOR_MON */
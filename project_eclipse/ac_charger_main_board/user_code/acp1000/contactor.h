@@ -0,0 +1,92 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 交流接触器反馈监测
+ *
+ * 接触器辅助触点（DI_AC1， 闭合为低电平）以双边沿中断唤醒监测任务，
+ * 反馈电平在确认窗口内保持不变才认为有效：
+ *  - 下发命令后， 反馈到位即记录动作时间（命令到反馈）， 超时未到位报接触器异常；
+ *  - 反馈到位后， 反馈与命令不一致（粘连、 脱落）超过确认窗口即报接触器异常。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-06  xjc, first implementation
+ * \endinternal
+ */
+
+#ifndef __CONTACTOR_H
+#define __CONTACTOR_H
+
+#include "apollo.h"
+#include "event_node.h"
+#include "ac_charge_prj_cfg.h"
+
+/**
+ * \brief 监测状态
+ * @{
+ */
+#define CONTACTOR_STATE_WAIT    0       /**< \brief 已下发命令， 等待反馈 */
+#define CONTACTOR_STATE_OK      1       /**< \brief 反馈与命令一致 */
+#define CONTACTOR_STATE_FAULT   2       /**< \brief 接触器异常 */
+/** @} */
+
+/**
+ * 单个方向（断开或闭合）的动作统计， 时间单位ms
+ */
+typedef struct contactor_act {
+    uint32_t ops;           /* 动作到位次数 */
+    uint32_t timeouts;      /* 动作超时次数 */
+    uint32_t last;          /* 最近一次动作时间 */
+    uint32_t min;
+    uint32_t max;
+    uint32_t sum;           /* 动作时间累计， 用于求平均 */
+}contactor_act_t;
+
+/**
+ * 监测统计
+ */
+typedef struct contactor_stat {
+    uint8_t         cmd;            /* 当前命令  TRUE： 闭合 */
+    uint8_t         fb;             /* 当前确认的反馈  TRUE： 闭合 */
+    uint8_t         state;          /* 监测状态 */
+    bool_t          irq;            /* 是否使用边沿中断（否则轮询） */
+    uint32_t        edges;          /* 反馈边沿次数 */
+    uint32_t        faults;         /* 到位后反馈异常变化次数 */
+    uint32_t        detect_ms;      /* 最近一次异常从反馈变化到上报的时间 */
+    contactor_act_t act[2];         /* [0] 断开  [1] 闭合 */
+}contactor_stat_t;
+
+/**
+ * \brief 初始化（连接反馈引脚中断， 需在充电控制器下发命令前调用）
+ * \param[in] p_node : 上报 CHARGE_AC_STATE、 ERR_AC 事件使用的事件节点
+ */
+void contactor_init (event_node_t *p_node);
+
+/**
+ * \brief 启动监测任务（事件节点加入事件管理器后调用）
+ */
+void contactor_task_startup (void);
+
+/**
+ * \brief 接触器命令已下发（命令与当前命令相同时不作为新动作）
+ * \param[in] close : TRUE： 闭合  FALSE： 断开
+ */
+void contactor_cmd (bool_t close);
+
+/**
+ * \brief 获取监测统计
+ */
+void contactor_stat_get (contactor_stat_t *p_stat);
+
+#endif
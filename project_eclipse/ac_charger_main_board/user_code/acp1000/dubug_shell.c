@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief Կʵ
+ * \brief 调试壳实例
  *
  * \internal
  * \par modification history:
@@ -29,6 +29,19 @@
 #include "acp1000_dout.h"
 #include "aw_nvram.h"
 #include "des/des.h"
+#include "aes/aes.h"
+#include "card_key.h"
+#include "adc_sample.h"
+#include "thermal.h"
+#include "evt_pub.h"
+#include "contactor.h"
+#include "periodic.h"
+#include "perf_stat.h"
+#include "task_prof.h"
+#include "lat_hist.h"
+#include "task_wdt.h"
+#include "blackbox.h"
+#include "slog.h"
 
 static dubug_shell_t *gp_dubug_shell = NULL;
 
@@ -76,6 +89,22 @@ static void charger_info_printf(charger_t *p_this)
     AW_INFOF(("Max   curr  : %d\r\n",  p_this->dat.max_curr));
     AW_INFOF(("Pile  alarm : %d\r\n",  p_this->dat.pile_alarm));
     AW_INFOF(("Vtp1        : %d\r\n\r\n",  p_this->dat.tp1_vol));
+
+    AW_INFOF(("Load  enable: %d\r\n",  p_this->load.cfg.enable));
+    AW_INFOF(("Load  limit : %d\r\n",  p_this->load.cfg.curr_limit));
+    AW_INFOF(("Load  ramp  : %d\r\n",  p_this->load.cfg.ramp_rate));
+    AW_INFOF(("Load  min   : %d\r\n",  p_this->load.cfg.min_curr));
+    AW_INFOF(("Load  safe  : %d\r\n",  p_this->load.cfg.failsafe_curr));
+    AW_INFOF(("Load  lost  : %d\r\n",  p_this->load.link_lost));
+    AW_INFOF(("Now   curr  : %d\r\n\r\n",  p_this->load.now_curr));
+
+    AW_INFOF(("Sched enable: %d\r\n",  p_this->sched.cfg.enable));
+    AW_INFOF(("Sched energy: %d\r\n",  p_this->sched.cfg.energy));
+    AW_INFOF(("Sched depart: %02d:%02d\r\n",  p_this->sched.cfg.depart_hour,
+                                             p_this->sched.cfg.depart_min));
+    AW_INFOF(("Sched state : %d\r\n",  p_this->sched.info.state));
+    AW_INFOF(("Sched delay : %d\r\n",  p_this->sched.info.start_delay));
+    AW_INFOF(("Sched cost  : %d\r\n\r\n",  p_this->sched.info.cost));
     charger_dev_unlock(p_this);
 }
 
@@ -130,7 +159,7 @@ static void billing_info_printf(billing_t *p_this)
 
 
 /**
- * ӡ״̬
+ * 打印充电机状态
  */
 static int charger_info(int argc, char *argv[])
 {
@@ -210,15 +239,15 @@ static int set_pile_id(int argc, char *argv[])
         return AW_ERROR;
     }
 #if 0
-    if(AW_OK == aw_nvram_set(ACP1000_EEPROM_NAME, 1, argv[0], 0, 8)) {    // ÷ʧ"׮ID"
-        AW_INFOF(("д׮ID%s\r\n", argv[0]));
-        if(AW_OK == aw_nvram_get(ACP1000_EEPROM_NAME, 1, pile_id, 0, 8)) {    // ÷ʧ"׮ID"
-            AW_INFOF(("׮ID %s\r\n", pile_id));
+    if(AW_OK == aw_nvram_set(ACP1000_EEPROM_NAME, 1, argv[0], 0, 8)) {    // 设置非易失性数据"桩ID"
+        AW_INFOF(("写入桩ID：%s\r\n", argv[0]));
+        if(AW_OK == aw_nvram_get(ACP1000_EEPROM_NAME, 1, pile_id, 0, 8)) {    // 设置非易失性数据"桩ID"
+            AW_INFOF(("读出桩ID： %s\r\n", pile_id));
         } else {
-            AW_INFOF(("׮IDʧܣ\r\n"));
+            AW_INFOF(("读出桩ID失败！\r\n"));
         }
     } else {
-        AW_INFOF(("д׮IDʧܣ\r\n"));
+        AW_INFOF(("写入桩ID失败！\r\n"));
     }
 #endif
     event_node_tell(&(gp_dubug_shell->p_hub4g->evt_node), HUB4G_PILE_ID, (void *)argv[0]);
@@ -235,16 +264,16 @@ static int set_hub4g_addr(int argc, char *argv[])
     }
     addr = strtol(argv[0], NULL , 0);
 #if 0
-    if(AW_OK == aw_nvram_set(ACP1000_EEPROM_NAME, 2, &addr, 0, 1)) {    // ÷ʧ"׮ID"
-        AW_INFOF(("д뼯ַ0x%02X\r\n", addr));
+    if(AW_OK == aw_nvram_set(ACP1000_EEPROM_NAME, 2, &addr, 0, 1)) {    // 设置非易失性数据"桩ID"
+        AW_INFOF(("写入集中器地址：0x%02X\r\n", addr));
         addr = 0;
-        if(AW_OK == aw_nvram_get(ACP1000_EEPROM_NAME, 2, &addr, 0, 1)) {    // ÷ʧ"׮ID"
-            AW_INFOF(("ַ0x%02X\r\n", addr));
+        if(AW_OK == aw_nvram_get(ACP1000_EEPROM_NAME, 2, &addr, 0, 1)) {    // 设置非易失性数据"桩ID"
+            AW_INFOF(("读出集中器地址：0x%02X\r\n", addr));
         } else {
-            AW_INFOF(("ַʧܣ\r\n"));
+            AW_INFOF(("读出集中器地址失败！\r\n"));
         }
     } else {
-        AW_INFOF(("д뼯ַʧܣ\r\n"));
+        AW_INFOF(("写入集中器地址失败！\r\n"));
     }
 #endif
     event_node_tell_all(&(gp_dubug_shell->p_dugs->evt_node), DUGS_HUB4G_ADDR, (void *)addr);
@@ -289,10 +318,10 @@ static void charge_history_printf(uint8_t *p_buf)
 static int charge_history(int argc, char *argv[])
 {
     uint8_t nums  = 1;
-    uint8_t total = 0;  /* eepromĿǰЧļ¼ */
-    int16_t last  = 0;  /* һμ¼ƫλ */
+    uint8_t total = 0;  /* eeprom目前有效的记录数 */
+    int16_t last  = 0;  /* 上一次记录的偏移位置 */
     uint8_t buf[44];
-    uint8_t offset = 0; /* ƫƵַ */
+    uint8_t offset = 0; /* 偏移地址 */
 
     if (argc == 1) {
         nums = strtol(argv[0], NULL , 0);
@@ -301,7 +330,7 @@ static int charge_history(int argc, char *argv[])
     }
 
 #if ACP1000_EEPROM_CHARGE_DAT_GET
-    /* ȡϴεļ¼λ */
+    /* 获取到上次的记录位置 */
     if(AW_OK != aw_nvram_get(ACP1000_EEPROM_NAME, 4, (char *)buf, 0, 2)) {
         AW_INFOF(("Get charge history failed!\r\n"));
         return AW_OK;
@@ -309,7 +338,7 @@ static int charge_history(int argc, char *argv[])
     total = buf[0];
     if ((total > ACP1000_EEPROM_CHARGE_MAX_NUMS) ||
         (total == 0)) {
-        /* ݣЧһEEPROM ʹ0xFF */
+        /* 错误的数据，任务无效，一般EEPROM 出厂即使0xFF */
         AW_INFOF(("There is no charge history\r\n"));
         return AW_OK;
     } else {
@@ -324,7 +353,7 @@ static int charge_history(int argc, char *argv[])
             return AW_OK;
         }
 
-        /* ӡ¼ */
+        /* 打印记录 */
         charge_history_printf(buf);
 
         if (0 == last) {
@@ -358,7 +387,7 @@ static int history_add (int argc, char *argv[])
 
     memcpy(billing_mode.usr_id, argv[0], strlen(argv[0]) + 1);
     billing_mode.usr_balance = 10000;
-    /* ȡʼʱ */
+    /* 获取起始时间 */
     aw_rtc_time_get(ACP1000_RTC_NUM, &tm);
     aw_tm_to_time(&tm, &now_time);
     memcpy(&billing_dat.start_time, &now_time, sizeof(now_time));
@@ -517,6 +546,29 @@ static int card_period(int argc, char *argv[])
     g_card_detect_period = strtol(argv[0], NULL , 500);
     return AW_OK;
 }
+
+extern aw_iccreader_read_stat_t g_card_read_stat;
+
+/**
+ * 卡读取统计， 参数为1时清零
+ */
+static int card_stat(int argc, char *argv[])
+{
+    aw_iccreader_read_stat_t *p_stat = &g_card_read_stat;
+    uint32_t                  reads  = p_stat->reads ? p_stat->reads : 1;
+
+    AW_INFOF(("reads: %d fails: %d retries: %d frames/read: %d.%02d\r\n",
+              p_stat->reads, p_stat->fails, p_stat->retries,
+              p_stat->frames / reads, (p_stat->frames * 100 / reads) % 100));
+    AW_INFOF(("avg ms  active: %d auth: %d read: %d\r\n",
+              p_stat->active_ms / reads,
+              p_stat->auth_ms / reads,
+              p_stat->read_ms / reads));
+    if ((argc > 0) && strtol(argv[0], NULL , 0)) {
+        memset(p_stat, 0, sizeof(*p_stat));
+    }
+    return AW_OK;
+}
 //
 //extern uint32_t g_card_rx_timeout;
 //
@@ -545,7 +597,7 @@ static int card_period(int argc, char *argv[])
 static uint8_t key[8]       = {0};
 static uint8_t sample[8]    = {0};
 static uint8_t encrypt[8]   = {0};
-static key_set key_sets[17];
+static des_ctx des_ctx_shell;
 static int des_encrypt(int argc, char *argv[])
 {
 
@@ -585,8 +637,8 @@ static int des_encrypt(int argc, char *argv[])
         sample[i] = (argv[1][i*2] << 4) | (argv[1][i*2+1] << 0);
     }
     start_ticks = aw_sys_tick_get();
-    des_sub_keys_generate(key, key_sets);
-    des_message_process(sample, encrypt, key_sets, 1);
+    des_key_setup(&des_ctx_shell, key);
+    des_block_process(&des_ctx_shell, sample, encrypt, ENCRYPTION_MODE);
     end_ticks = aw_sys_tick_get();
 
 
@@ -654,8 +706,8 @@ static int des_decrypt(int argc, char *argv[])
         encrypt[i] = (argv[1][i*2] << 4) | (argv[1][i*2+1] << 0);
     }
     start_ticks = aw_sys_tick_get();
-    des_sub_keys_generate(key, key_sets);
-    des_message_process(encrypt, sample, key_sets, 0);
+    des_key_setup(&des_ctx_shell, key);
+    des_block_process(&des_ctx_shell, encrypt, sample, DECRYPTION_MODE);
     end_ticks = aw_sys_tick_get();
 
     AW_INFOF(("Sample: "));
@@ -672,7 +724,7 @@ static int des_decrypt(int argc, char *argv[])
 }
 
 /**
- * Աģʽ
+ * 管理员模式调试
  */
 static int admin_mode(int argc, char *argv[])
 {
@@ -691,18 +743,678 @@ static int admin_mode(int argc, char *argv[])
 }
 
 /**
- * Կ
+ * 负荷管理参数设置（模拟集中器下发，用于多桩联调）
+ */
+static int load_set(int argc, char *argv[])
+{
+    charge_load_t load;
+
+    if ((argc < 1) || (argc > 5)) {
+        return AW_ERROR;
+    }
+    charger_dev_lock(gp_dubug_shell->p_charger);
+    load = gp_dubug_shell->p_charger->load.cfg;
+    charger_dev_unlock(gp_dubug_shell->p_charger);
+
+    load.enable = strtol(argv[0], NULL , 0) ? TRUE : FALSE;
+    if (argc > 1) {
+        load.curr_limit = strtol(argv[1], NULL , 0);
+    }
+    if (argc > 2) {
+        load.ramp_rate = strtol(argv[2], NULL , 0);
+    }
+    if (argc > 3) {
+        load.min_curr = strtol(argv[3], NULL , 0);
+    }
+    if (argc > 4) {
+        load.failsafe_curr = strtol(argv[4], NULL , 0);
+    }
+    event_node_tell_all(&(gp_dubug_shell->p_charger->evt_node), HUB4G_LOAD_CTRL, (void *)&load);
+
+    return AW_OK;
+}
+
+/**
+ * 智能充电规划设置（模拟集中器下发）
+ */
+static int sched_set(int argc, char *argv[])
+{
+    charge_sched_cfg_t sched;
+
+    if ((argc < 1) || (argc > 4)) {
+        return AW_ERROR;
+    }
+    charger_dev_lock(gp_dubug_shell->p_charger);
+    sched = gp_dubug_shell->p_charger->sched.cfg;
+    charger_dev_unlock(gp_dubug_shell->p_charger);
+
+    sched.enable = strtol(argv[0], NULL , 0) ? TRUE : FALSE;
+    if (argc > 1) {
+        sched.energy = strtol(argv[1], NULL , 0);
+    }
+    if (argc > 2) {
+        sched.depart_hour = strtol(argv[2], NULL , 0) % 24;
+    }
+    if (argc > 3) {
+        sched.depart_min = strtol(argv[3], NULL , 0) % 60;
+    }
+    event_node_tell_all(&(gp_dubug_shell->p_charger->evt_node), HUB4G_SCHED_CTRL, (void *)&sched);
+
+    return AW_OK;
+}
+
+/**
+ * 打印当前智能充电规划的各时段电流
+ */
+static int sched_show(int argc, char *argv[])
+{
+    charger_t *p_charger = gp_dubug_shell->p_charger;
+    uint16_t   i;
+
+    charger_dev_lock(p_charger);
+    AW_INFOF(("slots: %d start: %d reachable: %d energy: %dWh cost: %d\r\n",
+              p_charger->sched.plan.slot_nums,
+              p_charger->sched.plan.start_slot,
+              p_charger->sched.plan.reachable,
+              p_charger->sched.plan.energy,
+              p_charger->sched.plan.cost));
+    for (i = 0; i < p_charger->sched.plan.slot_nums; i++) {
+        AW_INFOF(("%4d", p_charger->sched.plan.curr[i]));
+        if ((i % 8) == 7) {
+            AW_INFOF(("\r\n"));
+        }
+    }
+    AW_INFOF(("\r\n"));
+    charger_dev_unlock(p_charger);
+
+    return AW_OK;
+}
+
+#if ACP1000_CARD_WL
+/**
+ * 离线卡名单操作（模拟集中器下发）
+ */
+static int card_wl(int argc, char *argv[])
+{
+    card_wl_op_t op;
+    uint32_t     uid = 0;
+
+    if (argc < 1) {
+        return AW_ERROR;
+    }
+    memset(&op, 0, sizeof(op));
+    if (0 == strcmp(argv[0], "add")) {
+        op.cmd = CARD_WL_CMD_ADD;
+    } else if (0 == strcmp(argv[0], "del")) {
+        op.cmd = CARD_WL_CMD_DEL;
+    } else if (0 == strcmp(argv[0], "clr")) {
+        op.cmd = CARD_WL_CMD_CLR;
+    } else if (0 == strcmp(argv[0], "show")) {
+        op.cmd = CARD_WL_CMD_GET;
+    } else {
+        return AW_ERROR;
+    }
+
+    if ((CARD_WL_CMD_ADD == op.cmd) || (CARD_WL_CMD_DEL == op.cmd)) {
+        if (argc < 2) {
+            return AW_ERROR;
+        }
+        uid = strtoul(argv[1], NULL , 16);
+        op.uid[0] = uid & 0xFF;
+        op.uid[1] = (uid >> 8) & 0xFF;
+        op.uid[2] = (uid >> 16) & 0xFF;
+        op.uid[3] = (uid >> 24) & 0xFF;
+        if (argc > 2) {
+            op.version = strtoul(argv[2], NULL , 0);
+        }
+    } else if ((CARD_WL_CMD_CLR == op.cmd) && (argc > 1)) {
+        op.version = strtoul(argv[1], NULL , 0);
+    }
+
+    op.result = -AW_ENODEV;
+    event_node_tell_all(&(gp_dubug_shell->p_charger->evt_node), HUB4G_CARD_WL, (void *)&op);
+    AW_INFOF(("result: %d version: %d nums: %d\r\n",
+              op.result, op.wl_version, op.wl_nums));
+
+    return AW_OK;
+}
+#endif
+
+/**
+ * 清除卡密钥密文
  */
 static int clen_key(int argc, char *argv[])
 {
-    uint8_t  buf[8]= {0};
+    uint8_t  buf[72]= {0};
+
+    if(AW_OK != aw_nvram_set(ACP1000_EEPROM_NAME, 6, (char *)buf, 0, sizeof(buf))) {
+        return AW_ERROR;
+    }
+    return AW_OK;
+}
+
+/**
+ * 卡密钥存储格式及DES/AES加解密速度对比
+ */
+static int key_cipher(int argc, char *argv[])
+{
+    static des_ctx    des;
+    static aes128_ctx aes;
+    static uint8_t    buf[64];
+    uint8_t           iv[AES128_BLOCK_SIZE] = {0};
+    uint8_t          *p_uid;
+    uint32_t          nums = 1000;
+    uint32_t          i;
+    aw_tick_t         ticks;
+
+    if (argc > 0) {
+        nums = strtol(argv[0], NULL, 0);
+    }
+    if (0 == nums) {
+        return AW_ERROR;
+    }
+
+    p_uid = (uint8_t *)gp_dubug_shell->p_pile->pile_dat.mcu_uid;
+    AW_INFOF(("Config cipher : %d (0/DES 1/AES-CTR 2/AES-CBC)\r\n", ACP1000_CARD_KEY_CIPHER));
+    AW_INFOF(("Stored cipher : %d\r\n", card_key_cipher_get(p_uid)));
+
+    /* 每次重新扩展密钥， 与上电加载一次的实际开销一致 */
+    ticks = aw_sys_tick_get();
+    for (i = 0; i < nums; i++) {
+        des_key_setup(&des, p_uid);
+        des_block_process(&des, buf, buf, ENCRYPTION_MODE);
+    }
+    ticks = aw_sys_tick_get() - ticks;
+    AW_INFOF(("DES     key+8B  x%d : %d ms\r\n", nums, aw_ticks_to_ms(ticks)));
+
+    ticks = aw_sys_tick_get();
+    for (i = 0; i < nums; i++) {
+        aes128_key_setup(&aes, p_uid);
+        aes128_ctr_crypt(&aes, iv, buf, buf, AES128_BLOCK_SIZE);
+    }
+    ticks = aw_sys_tick_get() - ticks;
+    AW_INFOF(("AES-CTR key+16B x%d : %d ms\r\n", nums, aw_ticks_to_ms(ticks)));
+
+    /* 批量数据吞吐量（密钥已扩展） */
+    ticks = aw_sys_tick_get();
+    for (i = 0; i < nums; i++) {
+        des_block_process(&des, buf, buf, ENCRYPTION_MODE);
+        des_block_process(&des, buf + 8, buf + 8, ENCRYPTION_MODE);
+    }
+    ticks = aw_sys_tick_get() - ticks;
+    AW_INFOF(("DES     16B     x%d : %d ms\r\n", nums, aw_ticks_to_ms(ticks)));
+
+    ticks = aw_sys_tick_get();
+    for (i = 0; i < nums; i++) {
+        aes128_ctr_crypt(&aes, iv, buf, buf, AES128_BLOCK_SIZE);
+    }
+    ticks = aw_sys_tick_get() - ticks;
+    AW_INFOF(("AES-CTR 16B     x%d : %d ms\r\n", nums, aw_ticks_to_ms(ticks)));
+
+    ticks = aw_sys_tick_get();
+    for (i = 0; i < nums; i++) {
+        aes128_cbc_decrypt(&aes, iv, buf, buf, AES128_BLOCK_SIZE);
+    }
+    ticks = aw_sys_tick_get() - ticks;
+    AW_INFOF(("AES-CBC 16B dec x%d : %d ms\r\n", nums, aw_ticks_to_ms(ticks)));
+
+    return AW_OK;
+}
+
+/**
+ * 温度采样统计： 原算法（10点平均）与中值+IIR滤波的噪声对比
+ */
+extern adc_sample_t g_temp_adc[ACP1000_THERMAL_CHANS];
+static int temp_adc(int argc, char *argv[])
+{
+    adc_sample_stat_t *p_stat;
+    uint16_t           mean_min = 0xFFFF, mean_max = 0;
+    uint16_t           filt_min = 0xFFFF, filt_max = 0;
+    uint32_t           nums, i;
+    uint32_t           ch = 0;
+
+    if (argc > 0) {
+        ch = strtol(argv[0], NULL, 0);
+    }
+    if (ch >= ACP1000_THERMAL_CHANS) {
+        return AW_ERROR;
+    }
+    p_stat = &g_temp_adc[ch].stat;
+
+    nums = (p_stat->cycles < ADC_SAMPLE_HIST_NUM) ? p_stat->cycles : ADC_SAMPLE_HIST_NUM;
+    for (i = 0; i < nums; i++) {
+        if (p_stat->mean_hist[i] < mean_min) mean_min = p_stat->mean_hist[i];
+        if (p_stat->mean_hist[i] > mean_max) mean_max = p_stat->mean_hist[i];
+        if (p_stat->filt_hist[i] < filt_min) filt_min = p_stat->filt_hist[i];
+        if (p_stat->filt_hist[i] > filt_max) filt_max = p_stat->filt_hist[i];
+    }
+
+    AW_INFOF(("Cycles / errs : %d / %d\r\n", p_stat->cycles, p_stat->errs));
+    AW_INFOF(("Block raw p-p : %d\r\n", p_stat->raw_pp));
+    AW_INFOF(("Mean10 / median / filtered : %d / %d / %d\r\n",
+              p_stat->mean, p_stat->median, p_stat->filtered));
+    if (nums) {
+        AW_INFOF(("Last %d outputs p-p  mean10: %d  filtered: %d\r\n",
+                  nums, mean_max - mean_min, filt_max - filt_min));
+    }
+    return AW_OK;
+}
+
+/**
+ * 各测温点温度及降额情况
+ */
+extern thermal_t g_thermal;
+static int thermal_show(int argc, char *argv[])
+{
+    static const char *state_str[] = {"normal", "derate", "ror", "trip", "low"};
+    thermal_chan_t    *p_chan;
+    int                i;
+
+    for (i = 0; i < g_thermal.nums; i++) {
+        p_chan = &g_thermal.chan[i];
+        if (!p_chan->valid) {
+            AW_INFOF(("%-8s : no data\r\n", p_chan->p_cfg->name));
+            continue;
+        }
+        AW_INFOF(("%-8s : %d.%02d C  ror %d C/min  %s  limit %d\r\n",
+                  p_chan->p_cfg->name,
+                  p_chan->temp / 256, ((p_chan->temp < 0 ? -p_chan->temp : p_chan->temp) & 0xFF) * 100 / 256,
+                  p_chan->ror / 256,
+                  state_str[p_chan->state],
+                  p_chan->limit));
+    }
+    AW_INFOF(("Published: temp %d C  derate %d  err %d\r\n",
+              g_thermal.pub_temp / 256, g_thermal.pub_limit, g_thermal.pub_err));
+    return AW_OK;
+}
+
+/**
+ * 按变化发布的统计
+ */
+static int pub_stat(int argc, char *argv[])
+{
+    evt_pub_t *p_pub;
+    int        i;
+
+    AW_INFOF(("name       total     sent      keep      saved     last_hour avg/hour\r\n"));
+    for (i = 0; NULL != (p_pub = evt_pub_get(i)); i++) {
+        AW_INFOF(("%-10s %-9u %-9u %-9u %-9u %-9u %u\r\n",
+                  p_pub->name,
+                  p_pub->stat.total,
+                  p_pub->stat.sent,
+                  p_pub->stat.keepalive,
+                  p_pub->stat.saved,
+                  p_pub->stat.last_hour,
+                  evt_pub_saved_per_hour(p_pub)));
+    }
+    return AW_OK;
+}
+
+#if ACP1000_DGUS_DIRTY
+/**
+ * 串口屏读寄存器变化跟踪情况
+ */
+static int dgus_stat(int argc, char *argv[])
+{
+    struct aw_mb_dgus_reg_map *p_map = &gp_dubug_shell->p_dugs->super;
+
+    AW_INFOF(("change cnt : %d\r\n", p_map->change_cnt));
+    AW_INFOF(("dirty      : %08X %08X\r\n", p_map->dirty[1], p_map->dirty[0]));
+    AW_INFOF(("commit     : %d\r\n", p_map->commit_cnt));
+    AW_INFOF(("map read   : %d\r\n", p_map->rd_cnt));
+    AW_INFOF(("stat read  : %d\r\n", p_map->stat_cnt));
+    return AW_OK;
+}
+#endif
+
+#if ACP1000_CONTACTOR_MON
+/**
+ * 接触器反馈监测统计
+ */
+static int contactor_show(int argc, char *argv[])
+{
+    static const char *state_str[] = {"wait", "ok", "fault"};
+    contactor_stat_t   stat;
+    int                i;
+
+    contactor_stat_get(&stat);
+    AW_INFOF(("cmd: %d  fb: %d  state: %s  irq: %d\r\n",
+              stat.cmd, stat.fb, state_str[stat.state % 3], stat.irq));
+    AW_INFOF(("edges: %d  faults: %d  detect: %dms\r\n",
+              stat.edges, stat.faults, stat.detect_ms));
+    AW_INFOF(("op    ops       timeout   last(ms)  min(ms)   max(ms)   avg(ms)\r\n"));
+    for (i = 1; i >= 0; i--) {
+        AW_INFOF(("%-5s %-9u %-9u %-9u %-9u %-9u %u\r\n",
+                  i ? "close" : "open",
+                  stat.act[i].ops,
+                  stat.act[i].timeouts,
+                  stat.act[i].last,
+                  stat.act[i].min,
+                  stat.act[i].max,
+                  stat.act[i].ops ? (stat.act[i].sum / stat.act[i].ops) : 0));
+    }
+    return AW_OK;
+}
+#endif
+
+#if ACP1000_PERIODIC
+/**
+ * 周期作业调度统计
+ */
+static int periodic_show(int argc, char *argv[])
+{
+    periodic_job_t  *p_job;
+    periodic_stat_t  stat;
+    int              i;
+
+    periodic_stat_get(&stat);
+    AW_INFOF(("name       period(ms) runs      misses    skips     max(ms)\r\n"));
+    for (i = 0; NULL != (p_job = periodic_job_get(i)); i++) {
+        AW_INFOF(("%-10s %-10u %-9u %-9u %-9u %u\r\n",
+                  p_job->name,
+                  p_job->period * ACP1000_PERIODIC_TICK_MS,
+                  p_job->runs,
+                  p_job->misses,
+                  p_job->skips,
+                  p_job->exec_max));
+    }
+    AW_INFOF(("wakeups/s  : %d.%d (separate tasks, estimated: %d.%d)\r\n",
+              stat.wakeups_x10 / 10, stat.wakeups_x10 % 10,
+              stat.task_wakeups_x10 / 10, stat.task_wakeups_x10 % 10));
+    AW_INFOF(("overruns   : %d\r\n", stat.overruns));
+    AW_INFOF(("stack saved: %d bytes (%d jobs, estimated from task stack sizes)\r\n",
+              stat.stack_saved, stat.jobs));
+    return AW_OK;
+}
+#endif
 
-    if(AW_OK != aw_nvram_set(ACP1000_EEPROM_NAME, 6, (char *)buf, 0, 8)) {
+/**
+ * 人为启动/停止充电（同串口屏按键）
+ */
+static int charge_ctrl(int argc, char *argv[])
+{
+    if (argc < 1) {
         return AW_ERROR;
     }
+    if (strtol(argv[0], NULL , 0)) {
+        event_node_tell_all(&(gp_dubug_shell->p_charger->evt_node), CHARGE_MAN_START, NULL);
+    } else {
+        event_node_tell_all(&(gp_dubug_shell->p_charger->evt_node), CHARGE_MAN_STOP, NULL);
+    }
+    return AW_OK;
+}
+
+#if ACP1000_PERF_STAT
+/**
+ * 运行耗时统计， 每行为 "类型 名字 键=值"， 便于脚本比较
+ */
+static int perf_stat_show(int argc, char *argv[])
+{
+    perf_stat_item_t item;
+    int              i;
+
+    for (i = 0; i < EVENT_NUMS; i++) {
+        perf_stat_evt_get(i, &item);
+        if (0 == item.cnt) {
+            continue;
+        }
+        AW_INFOF(("evt %d cnt=%u avg_ns=%u max_ns=%u\r\n",
+                  i,
+                  item.cnt,
+                  perf_stat_ns(item.sum / item.cnt),
+                  perf_stat_ns(item.max)));
+    }
+    for (i = 0; i < PERF_STAT_PT_NUMS; i++) {
+        perf_stat_pt_get(i, &item);
+        AW_INFOF(("pt %s cnt=%u avg_ns=%u max_ns=%u\r\n",
+                  perf_stat_pt_name(i),
+                  item.cnt,
+                  item.cnt ? perf_stat_ns(item.sum / item.cnt) : 0,
+                  perf_stat_ns(item.max)));
+    }
+
+    if ((argc > 0) && strtol(argv[0], NULL , 0)) {
+        perf_stat_clr();
+    }
+    return AW_OK;
+}
+#endif
+
+#if ACP1000_TASK_PROF
+/**
+ * 任务剖析： CPU占用（上一窗口/峰值）、 单次最长运行时间、 堆栈高水位
+ */
+static int task_prof_show(int argc, char *argv[])
+{
+    task_prof_info_t info;
+    task_prof_stat_t stat;
+    int              i;
+
+    task_prof_stat_get(&stat);
+    AW_INFOF(("name             prio cpu%%   peak%%  runs       max(us)  stack used/total\r\n"));
+    for (i = 0; AW_OK == task_prof_get(i, &info); i++) {
+        AW_INFOF(("%-16.16s %-4u %3u.%u  %3u.%u  %-10u %-8u %u/%u\r\n",
+                  info.name,
+                  info.prio,
+                  info.cpu_x10 / 10, info.cpu_x10 % 10,
+                  info.cpu_peak_x10 / 10, info.cpu_peak_x10 % 10,
+                  info.runs,
+                  info.run_max_us,
+                  info.stack_used,
+                  info.stack_total));
+    }
+    AW_INFOF(("windows: %u  tasks: %u  lost: %u  cpu: %u.%u%%  other(idle, isr...): %u.%u%%\r\n",
+              stat.windows,
+              stat.tasks,
+              stat.lost,
+              stat.cpu_x10 / 10, stat.cpu_x10 % 10,
+              (stat.cpu_x10 < 1000) ? (1000 - stat.cpu_x10) / 10 : 0,
+              (stat.cpu_x10 < 1000) ? (1000 - stat.cpu_x10) % 10 : 0));
+
+    if ((argc > 0) && strtol(argv[0], NULL , 0)) {
+        task_prof_clr();
+    }
+    return AW_OK;
+}
+#endif
+
+#if ACP1000_LAT_HIST
+/**
+ * 关键路径延迟： 次数、 最小/平均/最大值、 按桶估计的百分位数及各桶计数
+ */
+static int lat_hist_show(int argc, char *argv[])
+{
+    lat_hist_t hist;
+    int        i, k;
+
+    AW_INFOF(("path       cnt        stale  min(us)   avg(us)   p50       p90       p99       max(us)\r\n"));
+    for (i = 0; i < LAT_HIST_PATH_NUMS; i++) {
+        lat_hist_get(i, &hist);
+        AW_INFOF(("%-10s %-10u %-6u %-9u %-9u %-9u %-9u %-9u %u\r\n",
+                  lat_hist_name(i),
+                  hist.cnt,
+                  hist.stale,
+                  hist.min_us,
+                  hist.cnt ? (uint32_t)(hist.sum_us / hist.cnt) : 0,
+                  lat_hist_pct_us(&hist, 50),
+                  lat_hist_pct_us(&hist, 90),
+                  lat_hist_pct_us(&hist, 99),
+                  hist.max_us));
+        if (0 == hist.cnt) {
+            continue;
+        }
+        AW_INFOF(("  "));
+        for (k = 0; k < LAT_HIST_BUCKETS; k++) {
+            if (0 == hist.bucket[k]) {
+                continue;
+            }
+            if (k < LAT_HIST_BUCKETS - 1) {
+                AW_INFOF(("<%u:%u ", lat_hist_bucket_us(k), hist.bucket[k]));
+            } else {
+                AW_INFOF((">=%u:%u ", lat_hist_bucket_us(k - 1), hist.bucket[k]));
+            }
+        }
+        AW_INFOF(("\r\n"));
+    }
+
+    if ((argc > 0) && strtol(argv[0], NULL , 0)) {
+        lat_hist_clr();
+    }
+    return AW_OK;
+}
+#endif
+
+#if ACP1000_TASK_WDT
+/**
+ * 任务心跳监视： 各任务的期限、 当前及最长心跳间隔， 上次监视复位的记录
+ */
+static int task_wdt_show(int argc, char *argv[])
+{
+    task_wdt_node_t *p_node;
+    task_wdt_rec_t   rec;
+    uint32_t         age;
+    int              i;
+
+    AW_INFOF(("task              deadline(ms) age(ms)   max(ms)   where\r\n"));
+    for (i = 0; NULL != (p_node = task_wdt_node_get(i)); i++) {
+        age = aw_sys_tick_get() - p_node->last_ticks;
+        age = ((int32_t)age > 0) ? aw_ticks_to_ms(age) : 0;
+        AW_INFOF(("%-17s %-12u %-9u %-9u %s\r\n",
+                  p_node->name,
+                  p_node->deadline_ms,
+                  age,
+                  p_node->age_max_ms,
+                  p_node->p_where ? p_node->p_where : "-"));
+        if ((argc > 0) && strtol(argv[0], NULL , 0)) {
+            p_node->age_max_ms = 0;
+        }
+    }
+
+    if (task_wdt_last_get(&rec)) {
+        AW_INFOF(("last reset: %s %u ms over %u ms (in %s), uptime %u s, resets %u\r\n",
+                  rec.name,
+                  rec.overrun_ms,
+                  rec.deadline_ms,
+                  rec.where[0] ? rec.where : "-",
+                  rec.uptime_s,
+                  rec.resets));
+    } else {
+        AW_INFOF(("last reset: none\r\n"));
+    }
     return AW_OK;
 }
+#endif
 
+#if ACP1000_BLACKBOX
+/**
+ * 黑匣子： 无参数列出Flash中的记录， <idx> 显示第idx条（0为最新）， clr 擦除
+ */
+static int blackbox_show(int argc, char *argv[])
+{
+    blackbox_rec_t rec;
+    aw_err_t       ret;
+    int            i;
+
+    if ((argc > 0) && (0 == strcmp(argv[0], "clr"))) {
+        ret = blackbox_clr();
+        AW_INFOF(("blackbox clear %s\r\n", (AW_OK == ret) ? "ok" : "failed"));
+        return ret;
+    }
+
+    if (0 == argc) {
+        AW_INFOF(("idx seq    cause     uptime(s)  task             pc\r\n"));
+        for (i = 0; AW_OK == blackbox_get(i, &rec); i++) {
+            AW_INFOF(("%-3d %-6u %-9s %-10u %-16s 0x%08x\r\n",
+                      i,
+                      rec.seq,
+                      blackbox_cause_name(rec.cause),
+                      rec.uptime_ms / 1000,
+                      rec.task[0] ? rec.task : "-",
+                      rec.frame[6]));
+        }
+        if (0 == i) {
+            AW_INFOF(("no record\r\n"));
+        }
+        return AW_OK;
+    }
+
+    ret = blackbox_get(strtol(argv[0], NULL , 0), &rec);
+    if (AW_OK != ret) {
+        AW_INFOF(("no record\r\n"));
+        return ret;
+    }
+    AW_INFOF(("seq %u, cause %s, uptime %u ms, reset source 0x%02x\r\n",
+              rec.seq, blackbox_cause_name(rec.cause), rec.uptime_ms, rec.reset_src));
+    AW_INFOF(("task %s, charger %s, billing %s\r\n",
+              rec.task[0] ? rec.task : "-",
+              blackbox_charger_role_name(rec.charger_role),
+              blackbox_billing_role_name(rec.billing_role)));
+    if (BLACKBOX_CAUSE_FAULT == rec.cause) {
+        AW_INFOF(("r0 0x%08x r1 0x%08x r2 0x%08x r3 0x%08x\r\n",
+                  rec.frame[0], rec.frame[1], rec.frame[2], rec.frame[3]));
+        AW_INFOF(("r12 0x%08x lr 0x%08x pc 0x%08x xpsr 0x%08x\r\n",
+                  rec.frame[4], rec.frame[5], rec.frame[6], rec.frame[7]));
+        AW_INFOF(("sp 0x%08x exc_return 0x%08x cfsr 0x%08x hfsr 0x%08x mmfar 0x%08x bfar 0x%08x\r\n",
+                  rec.sp, rec.exc_return, rec.cfsr, rec.hfsr, rec.mmfar, rec.bfar));
+    }
+    AW_INFOF(("meter %d.%d V, %u.%03u A, %u.%02u kWh\r\n",
+              rec.meter_vol / 10, rec.meter_vol % 10,
+              rec.meter_curr / 1000, rec.meter_curr % 1000,
+              rec.meter_energy / 100, rec.meter_energy % 100));
+    AW_INFOF(("events (event:ms before, old to new):"));
+    for (i = 0; (i < rec.evt_nums) && (i < BLACKBOX_EVT_NUMS); i++) {
+        AW_INFOF((" %u:%u", rec.evt[i].event, rec.evt[i].ticks));
+    }
+    AW_INFOF(("\r\n"));
+    return AW_OK;
+}
+#endif
+
+#if ACP1000_SLOG
+/**
+ * 日志级别： 无参数列出各模块的级别， <mod|all> <lvl> 设置（级别为数字或名字）
+ */
+static int slog_set(int argc, char *argv[])
+{
+    uint32_t    written, lost;
+    const char *p_name;
+    char       *p_end;
+    int         mod, lvl;
+    int         cnt = 0;
+
+    if (argc >= 2) {
+        lvl = strtol(argv[1], &p_end, 0);
+        if ('\0' != *p_end) {
+            for (lvl = SLOG_OFF; NULL != (p_name = slog_lvl_name(lvl)); lvl++) {
+                if (0 == strcmp(argv[1], p_name)) {
+                    break;
+                }
+            }
+        }
+        for (mod = 0; NULL != (p_name = slog_mod_name(mod)); mod++) {
+            if ((0 == strcmp(argv[0], "all")) || (0 == strcmp(argv[0], p_name))) {
+                if (AW_OK != slog_level_set(mod, lvl)) {
+                    AW_INFOF(("invalid level: %s\r\n", argv[1]));
+                    return -AW_EINVAL;
+                }
+                cnt++;
+            }
+        }
+        if (0 == cnt) {
+            AW_INFOF(("invalid module: %s\r\n", argv[0]));
+            return -AW_EINVAL;
+        }
+    }
+
+    AW_INFOF(("module    level\r\n"));
+    for (mod = 0; NULL != (p_name = slog_mod_name(mod)); mod++) {
+        AW_INFOF(("%-9s %s\r\n", p_name, slog_lvl_name(slog_level_get(mod))));
+    }
+    slog_stat_get(&written, &lost);
+    AW_INFOF(("written %u, lost %u\r\n", written, lost));
+    return AW_OK;
+}
+#endif
 
 static const struct aw_shell_cmd __g_dubug_shell_cmds[] = {
     {charger_info,   "charger_info",  "NULL  - ACP state get"},
@@ -719,14 +1431,53 @@ static const struct aw_shell_cmd __g_dubug_shell_cmds[] = {
     {charge_way,       "charge_way",    "[way] [arg]- way: 1/auto 2/amount 3/energy 4/time 5/app"},
     {set_skip,          "set_skip",     "[times] each skip is 15ms "},
     {check_ac,          "check_ac",     "[en] enable/disable ac switch err check"},
+#if ACP1000_CONTACTOR_MON
+    {contactor_show,    "contactor",    "NULL - ac contactor actuation time and faults"},
+#endif
     {card_detect,   "card_detect",  "[en]  - enable/disable card detect"},
     {card_period,   "card_period",  "[period]  - set card detect period"},
+    {card_stat,     "card_stat",    "<clr>  - card read statistics, 1/clear after show"},
 //    {card_timeout,   "card_timeout",  "[timeout]  - set card rx timeout"},
 //    {card_timeout_ch,   "card_timeout_ch",  "[timeout]  - set card byte rx timeout"},
     {des_encrypt,   "des_encrypt",  "[key] [sample]  - des_encrypt"},
     {des_decrypt,   "des_decrypt",  "[key] [encrypt] - des_encrypt"},
     {admin_mode,    "admin_mode",  "[en] 1/enter mode  0/exit mode"},
     {clen_key,      "clen_key",  "clean up the auth key"},
+    {key_cipher,    "key_cipher", "<nums> - card key format and DES/AES speed"},
+    {temp_adc,      "temp_adc",   "<chan> - temperature ADC filter statistics"},
+    {thermal_show,  "thermal",    "NULL - temperature points, derating and alarms"},
+    {pub_stat,      "pub_stat",   "NULL - event-on-change publish statistics"},
+#if ACP1000_PERIODIC
+    {periodic_show, "periodic",   "NULL - periodic jobs, wakeups and deadline misses"},
+#endif
+#if ACP1000_DGUS_DIRTY
+    {dgus_stat,     "dgus_stat",  "NULL - screen register change tracking"},
+#endif
+    {load_set,      "load_set",  "[en] <curr> <ramp> <min> <failsafe> - load manage, unit 0.01A"},
+    {sched_set,     "sched_set", "[en] <energy> <hour> <min> - smart charge, energy unit 0.01kWh"},
+    {sched_show,    "sched_show", "NULL - show smart charge current profile"},
+#if ACP1000_CARD_WL
+    {card_wl,       "card_wl",   "[add|del|clr|show] <uid hex> <version> - offline card white list"},
+#endif
+    {charge_ctrl,   "charge_ctrl", "[start] - 1/start charge 0/stop charge"},
+#if ACP1000_PERF_STAT
+    {perf_stat_show, "perf_stat", "<clr> - event dispatch and nvram write time, 1/clear after show"},
+#endif
+#if ACP1000_TASK_PROF
+    {task_prof_show, "task_prof", "<clr> - task cpu share, max run time and stack high-water, 1/clear after show"},
+#endif
+#if ACP1000_LAT_HIST
+    {lat_hist_show, "lat_hist", "<clr> - latency histograms of cp/scram/card/modbus/billing paths, 1/clear after show"},
+#endif
+#if ACP1000_TASK_WDT
+    {task_wdt_show, "task_wdt", "<clr> - task heartbeat deadlines and last supervisor reset, 1/clear max after show"},
+#endif
+#if ACP1000_BLACKBOX
+    {blackbox_show, "blackbox", "<idx|clr> - crash records in flash, idx/show one (0 newest), clr/erase"},
+#endif
+#if ACP1000_SLOG
+    {slog_set,      "slog",     "<mod|all> <lvl> - deferred log levels, lvl 0/off 1/err 2/warn 3/info 4/dbg"},
+#endif
 };
 
 
@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief Կʵ
+ * \brief 调试壳实例声明
  *
  * \internal
  * \par modification history:
@@ -32,20 +32,20 @@
 #include "hub4g.h"
 
 /**
- * Կǵ
+ * 调试壳的类
  */
 typedef struct dubug_shell {
-    card_reader_t *p_card_reader; /* ʵ */
-    billing_t     *p_billing;     /* ƷѵԪʵ */
-    charger_t     *p_charger;     /* ƷѵԪʵ */
-    dugs_t        *p_dugs;        /* ʵ */
-    hub4g_t       *p_hub4g;       /* ʵ */
-    pile_t        *p_pile;        /* ׮ʵ */
+    card_reader_t *p_card_reader; /* 读卡器实例 */
+    billing_t     *p_billing;     /* 计费单元实例 */
+    charger_t     *p_charger;     /* 计费单元实例 */
+    dugs_t        *p_dugs;        /* 串口屏实例 */
+    hub4g_t       *p_hub4g;       /* 集中器实例 */
+    pile_t        *p_pile;        /* 桩数据实例 */
 }dubug_shell_t;
 
 
 /**
- * ʵʼ
+ * 调试类实例初始化
  */
 void dubug_shell_inst_init(dubug_shell_t *p_this,
                            card_reader_t *p_card_reader,
@@ -12,11 +12,12 @@
 *******************************************************************************/
 /**
  * \file
- * \brief ʵ
+ * \brief 串口屏实例
  *
  * \internal
  * \par modification history:
  * - 1.00 16-05-24  xjc, first implementation
+ * - 1.01 16-10-03  xjc, 桩ID未变化时不重新格式化， 通信检测限频
  * \endinternal
  */
 
@@ -36,6 +37,7 @@
 #include "aw_delayed_work.h"
 #include "modbus/aw_mb_utils.h"
 #include "aw_nvram.h"
+#include "aw_system.h"
 
 #define BILLING_TO_DUGS(p_this, p_role) \
     struct dugs *p_this = AW_CONTAINER_OF(p_role, struct dugs, p_dugs_billing_ctrl)
@@ -51,12 +53,12 @@
     struct dugs *p_this = AW_CONTAINER_OF(p_evt, struct dugs, evt_node)
 
 
-static role_ret play(role_t **pp_role, void *p_arg);  /*  */
+static role_ret play(role_t **pp_role, void *p_arg);  /* 扮演 */
 static void event_driver(struct event_node *p_evt, event_t event, void *p_arg);
 
 
 /**
- * Ȩʧ
+ * 鉴权失败
  */
 void card_fail (dugs_t *p_this)
 {
@@ -67,7 +69,7 @@ void card_fail (dugs_t *p_this)
 
 
 /**
- * Ȩɹ
+ * 鉴权成功
  */
 void auth_sus (dugs_t *p_this)
 {
@@ -84,10 +86,10 @@ void auth_sus (dugs_t *p_this)
     p_this->super.rd_reg.used_time    = 0;
     p_this->super.rd_reg.used_amount  = 0;
     dugs_unlock(p_this);
-//    acp1000_buzzer_on();/*  */
+//    acp1000_buzzer_on();/* 响蜂鸣器 */
 }
 
-/* ˢ¼ (Ļ)*/
+/* 多次刷卡事件 (解锁屏幕)*/
 void unlock_sus (dugs_t *p_this)
 {
     dugs_lock(p_this);
@@ -103,7 +105,7 @@ void unlock_sus (dugs_t *p_this)
 
 
 /**
- * ƻص
+ * 充电控制回调函数
  */
 aw_local int dugs_charge_ctrl_action (void *p_arg, uint16_t val)
 {
@@ -122,7 +124,7 @@ aw_local int dugs_charge_ctrl_action (void *p_arg, uint16_t val)
 }
 
 /**
- * ״̬
+ * 清除卡状态
  */
 aw_local int dugs_card_state_clr_action (void *p_arg, uint16_t val)
 {
@@ -136,7 +138,7 @@ aw_local int dugs_card_state_clr_action (void *p_arg, uint16_t val)
 }
 
 /**
- * ״̬
+ * 清除余额不足状态
  */
 aw_local int dugs_amount_state_clr_action (void *p_arg, uint16_t val)
 {
@@ -150,14 +152,14 @@ aw_local int dugs_amount_state_clr_action (void *p_arg, uint16_t val)
 }
 
 /**
- * ó
+ * 设置充电金恩
  */
 aw_local int dugs_charge_amount_action (void *p_arg, uint16_t val)
 {
     dugs_t *p_this  = (dugs_t *)p_arg;
-    uint32_t usr_balance = 0; /* λ0.1Ԫ */
+    uint32_t usr_balance = 0; /* 单位0.1元 */
 
-    /* ȽϵǰǷ񳬹õĽ */
+    /* 比较当前余额是否超过设置的金额 */
     dugs_lock(p_this);
     usr_balance = (p_this->super.rd_reg.usr_balance[0]) << 16 |
                    p_this->super.rd_reg.usr_balance[1] ;
@@ -177,15 +179,15 @@ aw_local int dugs_charge_amount_action (void *p_arg, uint16_t val)
 }
 
 /**
- * ó
+ * 设置充电电量
  */
 aw_local int dugs_charge_energy_action (void *p_arg, uint16_t val)
 {
     dugs_t *p_this  = (dugs_t *)p_arg;
-    uint32_t usr_balance   = 0; /* λ0.1Ԫ */
-    uint32_t charge_amount = 0; /* λ0.1Ԫ */
-    uint32_t price         = 0; /* λ0.0001Ԫÿ */
-    /* ȽϵǰǷ񳬹õĽ */
+    uint32_t usr_balance   = 0; /* 单位0.1元 */
+    uint32_t charge_amount = 0; /* 单位0.1元 */
+    uint32_t price         = 0; /* 单位0.0001元每度 */
+    /* 比较当前余额是否超过设置的金额 */
     dugs_lock(p_this);
     usr_balance = (p_this->super.rd_reg.usr_balance[0]) << 16 |
                    p_this->super.rd_reg.usr_balance[1] ;
@@ -210,7 +212,7 @@ aw_local int dugs_charge_energy_action (void *p_arg, uint16_t val)
 
 
 /**
- * ״̬
+ * 清除卡状态
  */
 aw_local int dugs_charge_way_ctrl_action (void *p_arg, uint16_t val)
 {
@@ -219,11 +221,14 @@ aw_local int dugs_charge_way_ctrl_action (void *p_arg, uint16_t val)
 }
 
 
-static struct aw_delayed_work g_dugs_comm_work; /* ͨ쳣ʱ  */
-static bool_t g_comm_err_state = FALSE;         /* 쳣 */
+static struct aw_delayed_work g_dugs_comm_work; /* 串口屏通信异常延时处理工作  */
+static bool_t g_comm_err_state = FALSE;         /* 串口屏异常情况 */
+#if ACP1000_DUGS_ERR_DETECT
+static aw_tick_t g_comm_kick_ticks = 0;         /* 上次重启超时检测的时间 */
+#endif
 
 /**
- * ͨ쳣
+ * 串口屏通信异常处理
  */
 static void dugs_comm_dly_work (void *p_arg)
 {
@@ -234,12 +239,20 @@ static void dugs_comm_dly_work (void *p_arg)
 }
 
 /**
- * ͨص
+ * 串口屏通信正常回调
  */
 aw_local int dugs_comm_state_action (void *p_arg, uint16_t val)
 {
 #if ACP1000_DUGS_ERR_DETECT
-    dugs_t *p_this        = (dugs_t *)p_arg;
+    dugs_t   *p_this = (dugs_t *)p_arg;
+    aw_tick_t now    = aw_sys_tick_get();
+
+    /* 屏每次读寄存器都会回调， 超时时间远大于读取周期， 无需每次重启 */
+    if ((!g_comm_err_state) &&
+        (aw_ticks_to_ms(now - g_comm_kick_ticks) < ACP1000_DGUS_COMM_KICK)) {
+        return AW_OK;
+    }
+    g_comm_kick_ticks = now;
 
     aw_delayed_work_stop(&g_dugs_comm_work);
     aw_delayed_work_start(&g_dugs_comm_work, ACP1000_DUGS_ERR_TIMEOUT);
@@ -252,7 +265,7 @@ aw_local int dugs_comm_state_action (void *p_arg, uint16_t val)
 }
 
 /**
- * ˳˺
+ * 退出账号命令
  */
 aw_local int dugs_accout_exit_action (void *p_arg, uint16_t val)
 {
@@ -262,7 +275,7 @@ aw_local int dugs_accout_exit_action (void *p_arg, uint16_t val)
 }
 
 /**
- * ˳Աģʽ
+ * 退出管理员模式
  */
 aw_local int dugs_admin_exit_action (void *p_arg, uint16_t val)
 {
@@ -274,7 +287,7 @@ aw_local int dugs_admin_exit_action (void *p_arg, uint16_t val)
 }
 
 /**
- * ڼͨŵַ
+ * 设置于集中器通信地址
  */
 aw_local int dugs_hub4g_addr_action (void *p_arg, uint16_t val)
 {
@@ -286,11 +299,12 @@ aw_local int dugs_hub4g_addr_action (void *p_arg, uint16_t val)
     return AW_OK;
 }
 /**
- * ׮ID
+ * 设置桩ID
  */
 aw_local void dugs_pile_id_set (dugs_t *p_this, void *p_arg)
 {
-    int i = 0;
+    static uint16_t last_id[4];
+    static bool_t   last_valid = FALSE;
     uint16_t *p_dat = (uint16_t *)p_arg;
     uint8_t  buf[18];
     uint8_t *p_pile_id = p_this->super.rd_reg.pile_id;
@@ -299,13 +313,20 @@ aw_local void dugs_pile_id_set (dugs_t *p_this, void *p_arg)
         return ;
     }
 
+    /* 集中器会周期写入桩ID， 未变化时无需重新格式化 */
+    if (last_valid && (0 == memcmp(last_id, p_dat, sizeof(last_id)))) {
+        return;
+    }
+    memcpy(last_id, p_dat, sizeof(last_id));
+    last_valid = TRUE;
+
     sprintf((void *)buf, "%04X%04X%04X%04X", p_dat[0], p_dat[1], p_dat[2], p_dat[3]);
     aw_mb_regcpy(p_pile_id, buf, 8);
 }
 /**
- *  \brief ʼ
- *  param [in]   p_this        : ʵ
- *  param [in]   p_dgus_info   : dugsϢ
+ *  \brief 串口屏初始化
+ *  param [in]   p_this        : 串口屏实例
+ *  param [in]   p_dgus_info   : dugs串口屏配置信息
  *  */
 void dugs_inst_init(dugs_t *p_this, modbus_info_t *p_dugs_info)
 {
@@ -321,44 +342,46 @@ void dugs_inst_init(dugs_t *p_this, modbus_info_t *p_dugs_info)
 
     aw_mb_dgus_reg_map_init(&p_this->super);
 
+    dugs_lock(p_this);
     p_this->super.rd_reg.gun_stat = AW_MB_DGUS_GUN_IDLE;
     p_this->super.rd_reg.upgrade_flag =  AW_MB_DGUS_UPGRADE_IDLE;
+    dugs_unlock(p_this);
 
-    /* עƻص */
+    /* 注册控制回调函数 */
     aw_mb_dgus_func_cb_register (&(p_this->super),
                                  FUNC_CHARGE_CTRL,
                                  dugs_charge_ctrl_action,
                                  (void *)p_this);
-    /* עƻص */
+    /* 注册控制回调函数 */
     aw_mb_dgus_func_cb_register (&(p_this->super),
                                  FUNC_CHARGE_WAY,
                                  dugs_charge_way_ctrl_action,
                                  (void *)p_this);
 
-    /* עƻص */
+    /* 注册控制回调函数 */
     aw_mb_dgus_func_cb_register (&(p_this->super),
                                FUNC_CARD_STATE_CLR,
                                dugs_card_state_clr_action,
                               (void *)p_this);
 
-    /* עƻص */
+    /* 注册控制回调函数 */
     aw_mb_dgus_func_cb_register (&(p_this->super),
                                 FUNC_CHARGE_AMOUNT,
                                 dugs_charge_amount_action,
                                (void *)p_this);
-    /* עƻص */
+    /* 注册控制回调函数 */
     aw_mb_dgus_func_cb_register (&(p_this->super),
                                  FUNC_CHARGE_ENERGY,
                                  dugs_charge_energy_action,
                                 (void *)p_this);
 
-    /* עƻص */
+    /* 注册控制回调函数 */
     aw_mb_dgus_func_cb_register (&(p_this->super),
                                   FUNC_AMOUNT_STATE_CLR,
                                   dugs_amount_state_clr_action,
                                  (void *)p_this);
 
-    /* עƻص */
+    /* 注册控制回调函数 */
     aw_mb_dgus_func_cb_register (&(p_this->super),
                                  FUNC_DUGS_COMM_STATE,
                                  dugs_comm_state_action,
@@ -379,7 +402,7 @@ void dugs_inst_init(dugs_t *p_this, modbus_info_t *p_dugs_info)
                                   dugs_hub4g_addr_action,
                                  (void *)p_this);
 
-    /* ʼdgus modbus slave*/
+    /* 初始化dgus modbus slave*/
     aw_mb_dgus_slave_hdl_init (&p_this->super,
                                 p_dugs_info->addr,
                                 p_dugs_info->com,
@@ -402,8 +425,8 @@ void dugs_inst_init(dugs_t *p_this, modbus_info_t *p_dugs_info)
 #endif
 }
 
-/* ===============================ɫ===================================  */
-static role_ret play(role_t **pp_role, void *p_arg)  /*  */
+/* ===============================扮演者与角色===================================  */
+static role_ret play(role_t **pp_role, void *p_arg)  /* 扮演 */
 {
     if ((*pp_role)->pfn_role_do) {
         return (*pp_role)->pfn_role_do(pp_role, p_arg);
@@ -412,8 +435,8 @@ static role_ret play(role_t **pp_role, void *p_arg)  /* 
 }
 
 /**
- * Ʒģʽ
- * p_arg : ĿƬID
+ * 计费模式设计
+ * p_arg : 传入的卡片ID
  */
 static role_ret dugs_billing_do (struct role **pp_role, void *p_arg)
 {
@@ -421,8 +444,8 @@ static role_ret dugs_billing_do (struct role **pp_role, void *p_arg)
 }
 
 /**
- * ɫ
- * p_arg : ĿƬID
+ * 充电角色控制
+ * p_arg : 传入的卡片ID
  */
 static role_ret dugs_charger_do (struct role **pp_role, void *p_arg)
 {
@@ -430,13 +453,13 @@ static role_ret dugs_charger_do (struct role **pp_role, void *p_arg)
     uint32_t ctrl = (uint32_t )p_arg;
 
     if (AW_MB_DGUS_CHARGE_CTRL_START == ctrl) {
-        /* Ϊʼ */
+        /* 人为开始充电 */
         dugs_lock(p_this);
         p_this->super.rd_reg.stop_reason = AW_MB_DGUS_CHARGE_NONE;
         dugs_unlock(p_this);
         event_node_tell_all(&p_this->evt_node, CHARGE_MAN_START, NULL);
     } else {
-        /* Ϊ˳ */
+        /* 人为退出充电 */
         event_node_tell_all(&p_this->evt_node, CHARGE_MAN_STOP, NULL);
     }
     return AW_OK;
@@ -444,8 +467,8 @@ static role_ret dugs_charger_do (struct role **pp_role, void *p_arg)
 
 
 /**
- * ɫ
- * p_arg : ĿƬID
+ * 充电角色控制
+ * p_arg : 传入的卡片ID
  */
 static role_ret dugs_settings_do (struct role **pp_role, void *p_arg)
 {
@@ -454,7 +477,7 @@ static role_ret dugs_settings_do (struct role **pp_role, void *p_arg)
 }
 
 
-/*=============================¼==========================================*/
+/*=============================事件驱动==========================================*/
 void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
 {
     EVT_TO_DUGS(p_this, p_evt);
@@ -474,7 +497,7 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
     switch (event) {
 
     case CARD_AUTH_SUS:
-        /* Ȩɹ */
+        /* 鉴权成功 */
         AW_MUTEX_LOCK(p_this->role_lock,AW_SEM_WAIT_FOREVER);
         p_this->p_dugs_billing_ctrl = &dugs_billing;
         p_this->p_dugs_settings     = &dugs_setting;
@@ -486,7 +509,7 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
 
     case CHARGE_MAN_START:
     case CHARGE_PIEL_START:
-        /* 翪ʼ */
+        /* 充电开始 */
         AW_MUTEX_LOCK(p_this->role_lock, AW_SEM_WAIT_FOREVER);
         p_this->p_dugs_billing_ctrl = NULL;
         p_this->p_dugs_settings     = NULL;
@@ -502,7 +525,7 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
 
     case CARD_AUTH_FAIL:
     case CHARGE_PILE_STOP:
-        /* 翪ʼ */
+        /* 充电开始 */
         AW_MUTEX_LOCK(p_this->role_lock, AW_SEM_WAIT_FOREVER);
         p_this->p_dugs_billing_ctrl = NULL;
         p_this->p_dugs_settings     = NULL;
@@ -557,7 +580,7 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
         break;
 
     case ERR_CHAGER:
-        /* 쳣˳ */
+        /* 异常退出充电 */
         dugs_lock(p_this);
         if (arg == AW_MB_DGUS_CHARGE_BG_EXIT) {
             p_this->stop_reason = AW_MB_DGUS_CHARGE_MAN_EXIT;
@@ -581,10 +604,10 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
     case BILLING_END:
         dugs_lock(p_this);
         if (arg) {
-            /* ɹ */
+            /* 结算成功 */
             p_this->super.rd_reg.stop_reason = p_this->stop_reason;
         } else {
-            /* ʧ*/
+            /* 结算失败*/
             p_this->super.rd_reg.stop_reason = AW_MB_DGUS_CHARGE_ERR_BILLING;
         }
         p_this->super.rd_reg.work_stat = AW_MB_DGUS_WORK_STAT_IDLE;
@@ -592,7 +615,7 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
         dugs_unlock(p_this);
         break;
 
-    case BILLING_ING: /* Ʒ */
+    case BILLING_ING: /* 计费中 */
         p_billing_dat = (billing_t  *)p_arg;
         dugs_lock(p_this);
         p_this->super.rd_reg.used_energy = p_billing_dat->used_energy / 10;
@@ -615,7 +638,7 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
 //        p_billing_mod->charge_time   = 1;
 //        p_billing_mod->charge_energy =  10;
 //        p_billing_mod->charge_amount =  10;
-//        p_billing_mod->usr_balance   =  10000; /* todo Ӽȡ */
+//        p_billing_mod->usr_balance   =  10000; /* todo 从集中器获取余额 */
         dugs_unlock(p_this);
         break;
 
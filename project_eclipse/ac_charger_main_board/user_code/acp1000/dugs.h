@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief ʵ
+ * \brief 串口屏实例声明
  *
  * \internal
  * \par modification history:
@@ -29,46 +29,46 @@
 #include "mb/aw_mb_dgus_regmap.h"
 
 /**
- * modbusЭͨϢ
+ * modbus协议通信信息
  */
 typedef struct modbus_info {
-    uint32_t  addr;  /* modbusַ */
-    uint32_t  com;   /* modbusʹôں */
-    uint32_t  baud;  /* ʹò */
-    uint32_t  par;   /* ʹУ鷽ʽ*/
+    uint32_t  addr;  /* modbus地址 */
+    uint32_t  com;   /* modbus使用串口号 */
+    uint32_t  baud;  /* 使用波特率 */
+    uint32_t  par;   /* 使用校验方式*/
 }modbus_info_t;
 
 
 /**
- * ʵ
+ * 串口屏实例声明
  */
 typedef struct dugs {
-    struct aw_mb_dgus_reg_map  super;      /*  */
-    player_t          player;              /*  */
-    event_node_t      evt_node;            /* ¼ӿ */
+    struct aw_mb_dgus_reg_map  super;      /* 串口屏数据 */
+    player_t          player;              /* 扮演者 */
+    event_node_t      evt_node;            /* 事件接口 */
 
-    role_t           *p_dugs_display;      /* ɰݵĽɫ - ʾ */
-    role_t           *p_dugs_billing_ctrl; /* ɰݵĽɫ  - Ʒѿ */
-    role_t           *p_dugs_charge_ctrl;  /* ɰݵĽɫ  -  */
-    role_t           *p_dugs_settings;     /* ɰݵĽɫ  -  */
-    AW_MUTEX_DECL(role_lock);              /**< \brief ɫ  */
+    role_t           *p_dugs_display;      /* 可扮演的角色 - 显示器 */
+    role_t           *p_dugs_billing_ctrl; /* 可扮演的角色  - 计费控制器 */
+    role_t           *p_dugs_charge_ctrl;  /* 可扮演的角色  - 充电控制器 */
+    role_t           *p_dugs_settings;     /* 可扮演的角色  - 参数设置器 */
+    AW_MUTEX_DECL(role_lock);              /**< \brief 角色锁  */
 
-    uint16_t          stop_reason;         /* ֹͣԭ */
+    uint16_t          stop_reason;         /* 停止充电原因 */
 }dugs_t;
 /**
- *  \brief ʼ
- *  param [in]   p_this        : ʵ
- *  param [in]   p_dgus_info   : dugsϢ
+ *  \brief 串口屏初始化
+ *  param [in]   p_this        : 串口屏实例
+ *  param [in]   p_dgus_info   : dugs串口屏配置信息
  *  */
 void dugs_inst_init(dugs_t *p_this, modbus_info_t *p_dugs_info);
 
-/** \brief д  */
+/** \brief 串口屏读写操作上锁  */
 aw_static_inline void dugs_lock(dugs_t *p_this)
 {
     aw_mb_dugs_reg_map_lock(&(p_this->super));
 }
 
-/** \brief д  */
+/** \brief 串口屏读写操作解锁  */
 aw_static_inline void dugs_unlock(dugs_t *p_this)
 {
     aw_mb_dugs_reg_map_unlock(&(p_this->super));
@@ -76,7 +76,7 @@ aw_static_inline void dugs_unlock(dugs_t *p_this)
 
 
 #if 1
-/** \brief ô  */
+/** \brief 设置串口屏  */
 #define dugs_super_set(p_this, state_name, state) \
                     do {                                    \
                            dugs_lock(p_this); \
@@ -84,13 +84,13 @@ aw_static_inline void dugs_unlock(dugs_t *p_this)
                            dugs_unlock(p_this);\
                        }while (0)
 
-/** \brief ô  */
+/** \brief 设置串口屏  */
 #define dugs_super_unsafe_set(p_this, state_name, state) \
                     do {                                    \
                            (p_this)->super.state_name = state; \
                        }while (0)
 
-/** \brief ȡ  */
+/** \brief 获取串口屏  */
 #define dugs_super_get(p_this, state_name, state)  \
                     do {                                    \
                             dugs_lock(p_this); \
@@ -98,7 +98,7 @@ aw_static_inline void dugs_unlock(dugs_t *p_this)
                             dugs_unlock(p_this);\
                         }while (0)
 
-/** \brief ȡ  */
+/** \brief 获取串口屏  */
 #define dugs_super_unsafe_get(p_this, state_name, state)  \
                     do {                                    \
                             state = (p_this)->super.state_name;  \
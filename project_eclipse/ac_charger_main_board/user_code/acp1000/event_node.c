@@ -12,15 +12,21 @@
 *******************************************************************************/
 /**
  * \file
- * \brief ¼ʵ
+ * \brief 事件实例
  *
  * \internal
  * \par modification history:
  * - 1.00 16-05-24  xjc, first implementation
+ * - 1.01 16-10-12  xjc, 统计事件分发耗时
+ * - 1.02 16-10-16  xjc, 分发的事件记入黑匣子
+ * - 1.03 16-10-17  xjc, 分发的事件记入日志（调试级别）
  * \endinternal
  */
 #include <string.h>
 #include "event_node.h"
+#include "perf_stat.h"
+#include "blackbox.h"
+#include "slog.h"
 
 static void event_manager_foreach( struct event_manager *p_this,
                                    event_t               event,
@@ -82,15 +88,21 @@ static void event_manager_foreach( struct event_manager *p_this,
                                    void                 *p_arg)
 {
     struct event_node *p;
+    PERF_STAT_DECL(t0);
+
     if (!p_this){
         return ;
     }
     p = p_this->p_event_nodes;
     AW_MUTEX_LOCK(p_this->lock, AW_SEM_WAIT_FOREVER);
+    BLACKBOX_EVT(event);
+    SLOG(SLOG_MOD_EVT, SLOG_DBG, "event %d", event);
+    PERF_STAT_BEGIN(t0);
     while (p) {
         p->pfunc_event(p, event, p_arg);
         p = p->next;
     }
+    PERF_STAT_EVT_END(event, t0);
     AW_MUTEX_UNLOCK(p_this->lock);
 }
 
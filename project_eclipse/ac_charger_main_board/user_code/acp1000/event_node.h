@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief ¼ʵ
+ * \brief 事件实例声明
  *
  * \internal
  * \par modification history:
@@ -25,76 +25,86 @@
 #include "apollo.h"
 #include "aw_sem.h"
 
-/* ¼ */
+/* 事件 */
 typedef enum event
 {
-   CARD_AUTH_SUS,  /* Ȩɹ¼ */
-   CARD_AUTH_ING,  /* Ȩ¼ */
-   CARD_AUTH_FAIL, /* Ȩʧ */
-   CARD_WAIT_KEY,  /* ȴԿź */
-   CARD_SWING_OK,  /* ݳɹ */
-   CARD_AUTH_ID,   /* ID */
-   CARD_AUTH_SUS_ORDER,  /* ȨɹѱԤԼ¼ */
-   CARD_ADMIN_MODE,     /* Աģʽ  1Աģʽ 0: ˳Աģʽ*/
-   SCREEN_UNLOCK,  /* ¼ */
-
-   CHARGE_MAN_START,  /* Ϊ¼ */
-   CHARGE_MAN_STOP,   /* Ϊֹͣ¼ */
-   CHARGE_BG_STOP,    /* ֹ̨ͣ¼ */
-
-   CHARGE_PIEL_WAIT,   /* ȴ¼ */
-   CHARGE_PIEL_START,  /* ¼ */
-   CHARGE_PILE_STOP,   /* ¼ */
-   CHARGE_FULL,        /*  */
-   CHARGE_AC_STATE,    /* Ӵ״̬ */
-
-   GUN_INSERT,          /* ǹ */
-   GUN_EXTRACT,         /* ǹγ */
-
-   BILLING_START,       /* Ʒѿʼ */
-   BILLING_ING,         /* Ʒ */
-   BILLING_STOP,        /* Ʒֹͣ¼ */
-   BILLING_END,         /* Ʒѽ */
-   BILLING_ENDING,      /* Ʒѽ */
-
-   BILLING_MODE_GET,    /* ڳģʽ */
-   BILLING_BALANCE,     /*  */
-
-   AMETER_MEASURE,      /*  */
-
-   PILE_ALARM,          /* ׮ */
-   PILE_TIME,           /* ʱ */
-   PILE_TEMP,           /* ¶ */
-   PILE_DUGS_INFO,      /* ׮Ϣ(Ա) */
-
-   HUB4G_AUTH_KEY,      /* ·Կ */
-   HUB4G_AUTH_USR,      /* Ȩ· */
-   HUB4G_ALLOW_CHARGE,  /* ¼ */
-   HUB4G_BILLING,       /* ¼ */
-   HUB4G_PILE_ORDER,    /* ׮ԤԼ */
-   HUB4G_USR_INFO,      /* ·ûID  */
-   HUB4G_PILE_ID,       /* ׮ID */
-   HUB4G_PRICE,         /* ׮ID */
-   HUB4G_UPGRADE,       /* ׮ */
-
-   DUGS_HUB4G_ADDR,     /* ַ */
-   DUGS_PRICE_GET,      /* ȡ */
+   CARD_AUTH_SUS,  /* 鉴权成功事件 */
+   CARD_AUTH_ING,  /* 鉴权中事件 */
+   CARD_AUTH_FAIL, /* 鉴权中失败 */
+   CARD_WAIT_KEY,  /* 等待密钥信号 */
+   CARD_SWING_OK,  /* 读卡数据成功 */
+   CARD_AUTH_ID,   /* 卡ID */
+   CARD_AUTH_SUS_ORDER,  /* 鉴权成功但已被预约事件 */
+   CARD_ADMIN_MODE,     /* 管理员模式  1：进入管理员模式 0: 退出管理员模式*/
+   SCREEN_UNLOCK,  /* 命名解锁事件 */
+
+   CHARGE_MAN_START,  /* 人为启动充电事件 */
+   CHARGE_MAN_STOP,   /* 人为停止充电事件 */
+   CHARGE_BG_STOP,    /* 后台停止充电事件 */
+
+   CHARGE_PIEL_WAIT,   /* 等待汽车充电就绪事件 */
+   CHARGE_PIEL_START,  /* 机身启动充电事件 */
+   CHARGE_PILE_STOP,   /* 机身启动充电事件 */
+   CHARGE_FULL,        /* 汽车充电充满 */
+   CHARGE_AC_STATE,    /* 接触器状态 */
+   CHARGE_CURR_LIMIT,  /* CP下发的充电电流变化， 单位0.01A */
+   CHARGE_SCHED_INFO,  /* 智能充电规划更新  p_arg为charge_sched_info_t */
+
+   GUN_INSERT,          /* 枪插上 */
+   GUN_EXTRACT,         /* 枪拔出 */
+
+   BILLING_START,       /* 计费开始 */
+   BILLING_ING,         /* 计费中 */
+   BILLING_STOP,        /* 计费停止事件 */
+   BILLING_END,         /* 计费结束 */
+   BILLING_ENDING,      /* 计费结束中 */
+
+   BILLING_MODE_GET,    /* 后期充电的模式和数据 */
+   BILLING_BALANCE,     /* 余额情况 */
+
+   AMETER_MEASURE,      /* 电表测量完成 */
+
+   PILE_ALARM,          /* 桩警报数据 */
+   PILE_TIME,           /* 时间数据 */
+   PILE_TEMP,           /* 温度数据 */
+   TEMP_DERATE,         /* 过温降额电流， 单位0.01A， 0： 不降额 */
+   PILE_DUGS_INFO,      /* 桩信息数据(管理员界面) */
+
+   HUB4G_AUTH_KEY,      /* 集中器下发密钥 */
+   HUB4G_AUTH_USR,      /* 集中器鉴权中下发余额 */
+   HUB4G_ALLOW_CHARGE,  /* 允许充电事件 */
+   HUB4G_BILLING,       /* 结算事件 */
+   HUB4G_PILE_ORDER,    /* 桩预约情况 */
+   HUB4G_USR_INFO,      /* 集中器下发用户ID余额数据  */
+   HUB4G_PILE_ID,       /* 桩ID */
+   HUB4G_PRICE,         /* 桩ID */
+   HUB4G_UPGRADE,       /* 桩升级 */
+   HUB4G_LOAD_CTRL,     /* 集中器下发负荷管理参数  p_arg为charge_load_t */
+   HUB4G_SCHED_CTRL,    /* 下发智能充电规划参数  p_arg为charge_sched_cfg_t */
+   HUB4G_PRICE_UPDATE,  /* 集中器下发的电价表变化 */
+   SCHED_PRICE_GET,     /* 获取24小时电价表  p_arg为uint16_t[24]，单位0.0001元 */
+   HUB4G_CARD_WL,       /* 离线卡名单操作  p_arg为card_wl_op_t */
+
+   DUGS_HUB4G_ADDR,     /* 集中器地址 */
+   DUGS_PRICE_GET,      /* 获取电价 */
    /*---------------------------------------------------*/
-   ERR_CARD_READER,     /* ͨѶ쳣 */
-   ERR_AMMETER,         /* ͨѶ쳣 */
-   ERR_CAR_READY,       /* 쳣 */
-   ERR_CHAGER,          /* һ쳣˳ */
-   ERR_AMMETER_VOL,     /* ѹ */
-   ERR_AMMETER_CURR,    /*   */
-   ERR_SCRAM,           /*   */
-   ERR_LIGHT,           /* 쳣 */
-   ERR_AC,              /* ACĸſ쳣 */
-   ERR_TEMP,            /* ¶쳣 0  1 ߣ 2  */
-   ERR_PILE_GUN_CONN,   /* ǹӴ쳣  */
-   ERR_PILE_GUN_LOCK,   /* ǹ쳣 */
-   ERR_HUB4G,           /* 4Gͨ 0  1쳣 */
-   ERR_DUGS,            /* 쳣 0  1쳣 */
-   ERR_HUB4G_COMM,      /* ͨ쳣 */
+   ERR_CARD_READER,     /* 读卡器通讯异常 */
+   ERR_AMMETER,         /* 电表通讯异常 */
+   ERR_CAR_READY,       /* 汽车就绪异常 */
+   ERR_CHAGER,          /* 一般异常退出 */
+   ERR_AMMETER_VOL,     /* 电压情况 */
+   ERR_AMMETER_CURR,    /* 电流情况  */
+   ERR_SCRAM,           /* 紧急开关情况  */
+   ERR_LIGHT,           /* 防雷器异常情况 */
+   ERR_AC,              /* AC母排开关异常情况 */
+   ERR_TEMP,            /* 温度异常情况， 0： 正常； 1： 过高； 2： 过低 */
+   ERR_PILE_GUN_CONN,   /* 枪接触异常情况  */
+   ERR_PILE_GUN_LOCK,   /* 枪锁异常情况 */
+   ERR_HUB4G,           /* 4G通信情况， 0： 正常； 1：异常 */
+   ERR_DUGS,            /* 串口屏异常情况， 0： 正常； 1：异常 */
+   ERR_HUB4G_COMM,      /* 集中器通信异常 */
+
+   EVENT_NUMS,          /* 事件个数（必须在最后） */
 }event_t;
 
 struct event_manager;
@@ -0,0 +1,194 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 周期遥测数据按变化发布
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-02  xjc, first implementation
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include "string.h"
+#include "evt_pub.h"
+
+#define __HOUR_MS   3600000UL
+
+static evt_pub_t *__g_pub_list[EVT_PUB_INST_MAX];
+static int        __g_pub_nums = 0;
+
+static int32_t __field_get (const uint8_t *p_dat, const evt_pub_field_t *p_field)
+{
+    switch (p_field->size) {
+
+    case 1:
+        return p_field->sign ? (int32_t)*(int8_t *)p_dat : (int32_t)*p_dat;
+
+    case 2:
+    {
+        uint16_t v;
+        memcpy(&v, p_dat, 2);
+        return p_field->sign ? (int32_t)(int16_t)v : (int32_t)v;
+    }
+
+    default:
+    {
+        uint32_t v;
+        memcpy(&v, p_dat, 4);
+        return (int32_t)v;
+    }
+    }
+}
+
+/**
+ * \brief 是否有字段的变化达到死区
+ */
+static bool_t __changed (evt_pub_t *p_this, const uint8_t *p_dat)
+{
+    const evt_pub_field_t *p_field;
+    int32_t                now, last;
+    uint32_t               diff;
+    uint8_t                i;
+
+    for (i = 0; i < p_this->field_nums; i++) {
+        p_field = &p_this->p_fields[i];
+        now     = __field_get(&p_dat[p_field->offset], p_field);
+        last    = __field_get(&p_this->last[p_field->offset], p_field);
+        if (now == last) {
+            continue;
+        }
+
+        /* 无符号字段（如电量）按模差计算， 回绕时也能正确比较 */
+        if (p_field->sign) {
+            diff = (now > last) ? (uint32_t)(now - last) : (uint32_t)(last - now);
+        } else {
+            diff = ((uint32_t)now > (uint32_t)last) ? ((uint32_t)now - (uint32_t)last) :
+                                                      ((uint32_t)last - (uint32_t)now);
+        }
+        if (diff >= p_field->deadband) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/**
+ * \brief 判断是否需要广播， 需要时记录本次内容
+ */
+static bool_t __pub_check (evt_pub_t *p_this, const uint8_t *p_dat)
+{
+    evt_pub_stat_t *p_stat = &p_this->stat;
+    aw_tick_t       now    = aw_sys_tick_get();
+    bool_t          send   = TRUE;
+
+    p_stat->total++;
+
+#if ACP1000_PUB_ON_CHANGE
+    if (p_this->valid && !__changed(p_this, p_dat)) {
+        if (p_this->keepalive &&
+            (aw_ticks_to_ms(now - p_this->pub_ticks) >= p_this->keepalive)) {
+            p_stat->keepalive++;
+        } else {
+            send = FALSE;
+        }
+    }
+#endif
+
+    if (send) {
+        memcpy(p_this->last, p_dat, p_this->size);
+        p_this->valid     = TRUE;
+        p_this->pub_ticks = now;
+        p_stat->sent++;
+    } else {
+        p_stat->saved++;
+    }
+
+    /* 每小时统计一次抑制的广播数 */
+    if (aw_ticks_to_ms(now - p_stat->hour_ticks) >= __HOUR_MS) {
+        p_stat->last_hour  = p_stat->saved - p_stat->hour_saved;
+        p_stat->hour_saved = p_stat->saved;
+        p_stat->hour_ticks = now;
+    }
+    return send;
+}
+
+/******************************************************************************/
+void evt_pub_init (evt_pub_t             *p_this,
+                   const char            *name,
+                   event_t                event,
+                   const evt_pub_field_t *p_fields,
+                   uint8_t                field_nums,
+                   uint8_t                size,
+                   uint32_t               keepalive)
+{
+    int i;
+
+    memset(p_this, 0, sizeof(*p_this));
+    p_this->name       = name;
+    p_this->event      = event;
+    p_this->p_fields   = p_fields;
+    p_this->field_nums = field_nums;
+    p_this->size       = (size > EVT_PUB_DAT_MAX) ? EVT_PUB_DAT_MAX : size;
+    p_this->keepalive  = keepalive;
+    p_this->stat.start_ticks = aw_sys_tick_get();
+    p_this->stat.hour_ticks  = p_this->stat.start_ticks;
+
+    for (i = 0; i < __g_pub_nums; i++) {
+        if (__g_pub_list[i] == p_this) {
+            return;
+        }
+    }
+    if (__g_pub_nums < EVT_PUB_INST_MAX) {
+        __g_pub_list[__g_pub_nums++] = p_this;
+    }
+}
+
+bool_t evt_pub_tell (evt_pub_t *p_this, event_node_t *p_node, void *p_dat)
+{
+    bool_t send = __pub_check(p_this, (uint8_t *)p_dat);
+
+    if (send) {
+        event_node_tell_all(p_node, p_this->event, p_dat);
+    }
+    return send;
+}
+
+bool_t evt_pub_tell_val (evt_pub_t *p_this, event_node_t *p_node, int32_t val)
+{
+    bool_t send = __pub_check(p_this, (uint8_t *)&val);
+
+    if (send) {
+        event_node_tell_all(p_node, p_this->event, (void *)val);
+    }
+    return send;
+}
+
+evt_pub_t *evt_pub_get (int idx)
+{
+    if ((idx < 0) || (idx >= __g_pub_nums)) {
+        return NULL;
+    }
+    return __g_pub_list[idx];
+}
+
+uint32_t evt_pub_saved_per_hour (evt_pub_t *p_this)
+{
+    uint32_t sec = aw_ticks_to_ms(aw_sys_tick_get() - p_this->stat.start_ticks) / 1000;
+
+    if (0 == sec) {
+        return 0;
+    }
+    return (uint32_t)(((uint64_t)p_this->stat.saved * 3600) / sec);
+}
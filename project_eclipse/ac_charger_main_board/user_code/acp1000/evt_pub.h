@@ -0,0 +1,132 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 周期遥测数据按变化发布
+ *
+ * 周期性的测量任务（电表、计费、温度）每周期都会产生一份数据， 但大部分时间
+ * 与上次发布的内容相同。发布前按字段与上次发布的内容比较， 变化达到死区才广播，
+ * 长时间无变化时按保活周期补发一次， 以便订阅者确认数据源仍在运行。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-02  xjc, first implementation
+ * \endinternal
+ */
+
+#ifndef __EVT_PUB_H
+#define __EVT_PUB_H
+
+#include "apollo.h"
+#include "aw_system.h"
+#include "event_node.h"
+#include "ac_charge_prj_cfg.h"
+
+#define EVT_PUB_DAT_MAX     48     /* 可比较的数据最大字节数 */
+#define EVT_PUB_INST_MAX    8      /* 可统计的发布者个数 */
+
+/**
+ * 字段描述
+ */
+typedef struct evt_pub_field {
+    uint16_t  offset;       /* 字段在数据中的偏移 */
+    uint8_t   size;         /* 字段大小： 1、 2、 4 */
+    bool_t    sign;         /* 是否为有符号数 */
+    uint32_t  deadband;     /* 变化达到该值才发布， 0、 1为任何变化 */
+}evt_pub_field_t;
+
+#define EVT_PUB_FIELD(type, member, is_sign, db) \
+    {AW_OFFSET(type, member), sizeof(((type *)0)->member), is_sign, db}
+
+/**
+ * 发布统计
+ */
+typedef struct evt_pub_stat {
+    uint32_t  total;        /* 产生的数据份数 */
+    uint32_t  sent;         /* 已广播（含保活） */
+    uint32_t  keepalive;    /* 其中因保活广播 */
+    uint32_t  saved;        /* 被抑制的广播 */
+
+    aw_tick_t start_ticks;  /* 统计开始时间 */
+    aw_tick_t hour_ticks;   /* 本小时开始时间 */
+    uint32_t  hour_saved;   /* 本小时开始时的saved */
+    uint32_t  last_hour;    /* 上一小时抑制的广播数 */
+}evt_pub_stat_t;
+
+/**
+ * 发布者
+ */
+typedef struct evt_pub {
+    const char             *name;
+    event_t                 event;          /* 发布的事件 */
+    const evt_pub_field_t  *p_fields;
+    uint8_t                 field_nums;
+    uint8_t                 size;           /* 数据大小 */
+    uint32_t                keepalive;      /* 保活周期（ms）， 0为不保活 */
+
+    bool_t                  valid;          /* 是否已发布过 */
+    aw_tick_t               pub_ticks;      /* 上次广播时间 */
+    uint8_t                 last[EVT_PUB_DAT_MAX];  /* 上次广播的内容 */
+
+    evt_pub_stat_t          stat;
+}evt_pub_t;
+
+/**
+ * \brief 初始化发布者（同时登记到统计列表）
+ *
+ * \param[in] p_fields   : 参与比较的字段， 未列出的字段变化不触发广播
+ * \param[in] field_nums : 字段个数
+ * \param[in] size       : 数据大小（不大于EVT_PUB_DAT_MAX）
+ * \param[in] keepalive  : 保活周期（ms）， 0为不保活
+ */
+void evt_pub_init (evt_pub_t             *p_this,
+                   const char            *name,
+                   event_t                event,
+                   const evt_pub_field_t *p_fields,
+                   uint8_t                field_nums,
+                   uint8_t                size,
+                   uint32_t               keepalive);
+
+/**
+ * \brief 下一份数据无条件广播（如开始充电时）
+ */
+static inline void evt_pub_reset (evt_pub_t *p_this)
+{
+    p_this->valid = FALSE;
+}
+
+/**
+ * \brief 按需广播数据， 订阅者收到的参数为p_dat
+ * \return 是否已广播
+ */
+bool_t evt_pub_tell (evt_pub_t *p_this, event_node_t *p_node, void *p_dat);
+
+/**
+ * \brief 按需广播数值（参数直接为数值的事件， 如PILE_TEMP）
+ * \note 初始化时字段应为偏移0的int32_t
+ * \return 是否已广播
+ */
+bool_t evt_pub_tell_val (evt_pub_t *p_this, event_node_t *p_node, int32_t val);
+
+/**
+ * \brief 获取已登记的发布者
+ * \return 不存在返回NULL
+ */
+evt_pub_t *evt_pub_get (int idx);
+
+/**
+ * \brief 平均每小时抑制的广播数（自统计开始）
+ */
+uint32_t evt_pub_saved_per_hour (evt_pub_t *p_this);
+
+#endif
@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief ʵ
+ * \brief 集中器实例
  *
  * \internal
  * \par modification history:
@@ -32,9 +32,12 @@
 #include "dugs.h"
 #include "billing.h"
 #include "ammeter.h"
+#include "charger.h"
+#include "card_wl.h"
 #include "modbus/aw_mb_utils.h"
 #include "aw_nvram.h"
 #include "aw_delayed_work.h"
+#include "lat_hist.h"
 
 #define UNLOCK_TO_HUB4G(p_this, pp_role) \
     struct hub4g *p_this = AW_CONTAINER_OF(pp_role, struct hub4g, p_hub4g_unlock)
@@ -75,7 +78,7 @@ int hub4g_card_key_recevied (void *p_arg, void *p_reg, uint8_t gun_num, void *va
 
     hub4g_dev_lock(p_this);
     p_this->super.rm_signal_reg.charger_stat[0].charger_stat1.stat1_bit.key_store_ok = 1;
-    /* ˢ־λΪ1ʼȴ·key */
+    /* 置刷卡标志位为1，起始等待集中器下发key */
     p_this->super.rm_signal_reg.charger_stat[0].charging_stop_cause.cause_bit.card_swing_ok1 = 0;
     hub4g_dev_unlock(p_this);
 
@@ -88,8 +91,8 @@ int hub4g_card_key_recevied (void *p_arg, void *p_reg, uint8_t gun_num, void *va
     if (NULL != p_role) {
         p_this->player.pfn_play(&p_this->p_hub4g_auth_key, val);
     }
-    //todo Կ·ź
-//#if ACP1000_HUB4G_AUTH /* ǷȨ */
+    //todo 发起密钥下发信号量
+//#if ACP1000_HUB4G_AUTH /* 是否开启集中器鉴权 */
 //    AW_SEMB_GIVE(p_this->super_key_sem);
 //#endif
     return AW_OK;
@@ -105,6 +108,7 @@ int hub4g_charge_price_recevied (void *p_arg, void *p_reg, uint8_t gun_num, void
     hub4g_dev_unlock(p_this);
 
     event_node_tell(&p_this->evt_node, HUB4G_PRICE, val);
+    event_node_tell_all(&p_this->evt_node, HUB4G_PRICE_UPDATE, NULL);
 
     return AW_OK;
 }
@@ -119,7 +123,7 @@ int hub4g_usr_id_recevied (void *p_arg, void *p_reg, uint8_t gun_num, void *val)
     aw_mb_regcpy(p_hub4g->rm_measure_reg.usr_info.user_id, val, RM_ADJ_USR_ID_NUM);
     hub4g_dev_unlock(p_this);
 
-    //todo ûID
+    //todo 发起用户ID数据
 //    acp1000_work_state_lock(p_ws);
 //    aw_mb_regcpy(p_ws->super.rd_reg.usr_id, val, RM_ADJ_USR_ID_NUM);
 //    acp1000_work_state_unlock(p_ws);
@@ -150,9 +154,9 @@ int hub4g_usr_balance_recevied (void *p_arg, void *p_reg, uint8_t gun_num, void
     role_t  *p_role = NULL;
 
 #if ACP1000_CARD_AMOUNT_ADD
-    /*  100000*/
-    (*(uint16_t *)val)         = (100000 & 0xFFFF0000) >> 16; /* ȡ */
-    (*(((uint16_t *)val) + 1)) = (100000 & 0xFFFF);           /* ȡ */
+    /* 测试余额 100000*/
+    (*(uint16_t *)val)         = (100000 & 0xFFFF0000) >> 16; /* 读取卡余额 */
+    (*(((uint16_t *)val) + 1)) = (100000 & 0xFFFF);           /* 读取卡余额 */
 #endif
     hub4g_dev_lock(p_this);
     aw_mb_regcpy(p_hub4g->rm_measure_reg.usr_info.user_balance, val, RM_ADJ_USR_BALANCE_NUM);
@@ -162,7 +166,7 @@ int hub4g_usr_balance_recevied (void *p_arg, void *p_reg, uint8_t gun_num, void
     p_role = p_this->p_hub4g_auth_usr;
     AW_MUTEX_UNLOCK(p_this->role_lock);
 
-    //todo ûIDû
+    //todo 发送用户ID和用户余额
     event_node_tell_all(&p_this->evt_node,
                          HUB4G_USR_INFO,
                         &(p_hub4g->rm_measure_reg.usr_info));
@@ -215,7 +219,7 @@ int hub4g_auth_fail_reason_recevied (void *p_arg, void *p_reg, uint8_t gun_num,
     return AW_OK;
 }
 
-/** û λ0.01Ԫ */
+/** 返回用户余额 单位0.01元 */
 static uint32_t hub4g_usr_balance_get (hub4g_t *p_this)
 {
     struct modbus_reg_map *p_hub4g = &(p_this->super);
@@ -233,8 +237,8 @@ static uint32_t hub4g_usr_balance_get (hub4g_t *p_this)
 }
 
 /**
- * ȡγ
- * صλ 0.01Ԫ
+ * 获取本次充电金额
+ * 返回电量单位 0.01元
  */
 static uint16_t hub4g_charge_amout_get (hub4g_t *p_this)
 {
@@ -248,8 +252,8 @@ static uint16_t hub4g_charge_amout_get (hub4g_t *p_this)
 }
 
 /**
- * ȡγ
- * صλ 0.01
+ * 获取本次充电电量
+ * 返回电量单位 0.01度
  */
 static uint16_t hub4g_charge_energy_get (hub4g_t *p_this)
 {
@@ -263,10 +267,10 @@ static uint16_t hub4g_charge_energy_get (hub4g_t *p_this)
 }
 
 /**
- * 
- * enery : 32λ
- * vol   : ѹ  λ0.1V
- * curr  :   λ0.1A
+ * 保存测量参数
+ * enery : 32位电表读数
+ * vol   : 电压 ， 单位0.1V
+ * curr  : 电流 ， 单位0.1A
  */
 static void hub4g_ammeter_data_set (hub4g_t  *p_this,
                                     uint32_t  energy,
@@ -285,10 +289,10 @@ static void hub4g_ammeter_data_set (hub4g_t  *p_this,
 }
 
 /**
- * 
- * enery :   λ 0.01
- * amout  :   λ0.01Ԫ
- * time  :  ʱ  λ
+ * 保存充电参数
+ * enery :  充电电量 单位 0.01度
+ * amout  : 充电金额  单位：0.01元
+ * time  :  充电时间  单位，分
  */
 static void hub4g_charge_data_set (hub4g_t *p_this,
                                    uint16_t energy,
@@ -306,8 +310,8 @@ static void hub4g_charge_data_set (hub4g_t *p_this,
 }
 
 /**
- * ÿID
- * p_id_bufΪNULLʱΪȫ0
+ * 设置卡ID
+ * p_id_buf为NULL时，设置为全0
  */
 static void hub4g_card_id_set (hub4g_t *p_this,
                                uint8_t *p_id_buf,
@@ -331,8 +335,8 @@ static void hub4g_card_id_set (hub4g_t *p_this,
 }
 
 /**
- * 
- * p_blk_datΪNULLʱΪȫ0
+ * 设置扇区数据
+ * p_blk_dat为NULL时，设置为全0
  */
 static void hub4g_card_blk_dat_set (hub4g_t *p_this,
                                     uint8_t *p_blk_dat,
@@ -359,12 +363,12 @@ static void hub4g_card_blk_dat_set (hub4g_t *p_this,
 
 
 /**
- * ȡγ
+ * 获取本次充电电量
  */
 
 
 /**
- * Ƿ
+ * 是否允许充电
  */
 static bool_t hub4g_charge_allow_get (hub4g_t *p_this)
 {
@@ -382,7 +386,7 @@ static bool_t hub4g_charge_allow_get (hub4g_t *p_this)
 }
 
 /**
- * Ƿʼ
+ * 是否开始充电
  */
 static bool_t hub4g_charge_allow_ctrl (hub4g_t *p_this)
 {
@@ -403,7 +407,7 @@ static bool_t hub4g_charge_allow_ctrl (hub4g_t *p_this)
 
 
 /**
- * ȡûID
+ * 获取用户ID
  */
 static void hub4g_usr_id_get (hub4g_t *p_this, uint16_t *p_buf)
 {
@@ -415,11 +419,11 @@ static void hub4g_usr_id_get (hub4g_t *p_this, uint16_t *p_buf)
 }
 
 /**
- * \brief ȡĳСʱĵ
- * \param[in] p_this : ʵ
+ * \brief 获取某小时的电价
+ * \param[in] p_this : 集中器实例
  * \param[in] hour : 0 - 23
  *
- * \return  λ0.0001Ԫ
+ * \return 电价 单位0.0001元
  */
 static uint16_t hub4g_charge_price_get (hub4g_t *p_this, uint8_t hour)
 {
@@ -435,8 +439,8 @@ static uint16_t hub4g_charge_price_get (hub4g_t *p_this, uint8_t hour)
     return price;
 }
 /**
- * ȡǰ5Сʱڵĳƽֵ
- * ڶԳĹ
+ * 获取当前5个小时以内的充电电价平均值
+ * 有助于对充电电量的估算
  */
 static uint16_t hub4g_charge_price_avg (hub4g_t *p_this)
 {
@@ -448,7 +452,7 @@ static uint16_t hub4g_charge_price_avg (hub4g_t *p_this)
     uint8_t   hour    = 12;
 
     aw_tm_t  tm;
-    /* ȡʼʱ */
+    /* 获取起始时间 */
     if (AW_OK != aw_rtc_time_get(ACP1000_RTC_NUM, &tm)) {
         hour = 12;
     } else {
@@ -466,12 +470,12 @@ static uint16_t hub4g_charge_price_avg (hub4g_t *p_this)
     return price;
 }
 /**
- * ʱ
+ * 调整时间
  */
 static int hub4g_time_adjust (void *p_arg, void *p_reg, uint8_t gun_num, void *val)
 {
     aw_tm_t tm;
-    /* ʱ  */
+    /* 设置时间  */
     struct aw_charger_time *p_time = (struct aw_charger_time *)val;
 
     tm.tm_year = p_time->year - 1900;
@@ -485,7 +489,7 @@ static int hub4g_time_adjust (void *p_arg, void *p_reg, uint8_t gun_num, void *v
     return AW_OK;
 }
 /**
- * ңʱ
+ * 设置遥测时间
  */
 static void hub4g_rm_time_set (hub4g_t *p_this, aw_tm_t *p_tm)
 {
@@ -503,18 +507,18 @@ static void hub4g_rm_time_set (hub4g_t *p_this, aw_tm_t *p_tm)
 }
 
 
-/* ңػص  */
+/* 遥控回调  */
 
-/* Ƿص */
+/* 是否允许充电回调 */
 static int hub4g_rm_ctrl_charge_allow (void *p_arg, void *p_reg, uint8_t gun_num, void *val)
 {
     hub4g_t *p_this = (hub4g_t *)p_arg;
     bool_t  state = 0;
     role_t  *p_role = NULL;
 
-#if ACP1000_HUB4G_AUTH /* ǷȨ */
+#if ACP1000_HUB4G_AUTH /* 是否开启集中器鉴权 */
     hub4g_dev_lock(p_this);
-    /* todo ¼źӵʵּȨ */
+    /* todo 发起允许充电事件信号量，已拥有实现鉴权 */
 //    if (state == 0) {
 //        AW_SEMB_GIVE(p_this->super_cctrl_sem);
 //    }
@@ -540,7 +544,7 @@ static int hub4g_rm_ctrl_charge_allow (void *p_arg, void *p_reg, uint8_t gun_num
     return AW_OK;
 }
 
-/* ֹͣʼ */
+/* 停止或开始充电 */
 static int hub4g_rm_ctrl_charge_ctl (void *p_arg, void *p_reg, uint8_t gun_num, void *val)
 {
     hub4g_t *p_this = (hub4g_t *)p_arg;
@@ -559,13 +563,13 @@ static int hub4g_rm_ctrl_charge_ctl (void *p_arg, void *p_reg, uint8_t gun_num,
 
 extern void acp1000_overtime_check_restart();
 
-/*   */
+/* 锁屏  */
 static int hub4g_rm_ctrl_scren_lock (void *p_arg, void *p_reg, uint8_t gun_num, void *val)
 {
     hub4g_t *p_this = (hub4g_t *)p_arg;
     struct aw_charger_stat_bit *p_rm_signal = \
             &p_this->super.rm_signal_reg.charger_stat[0].charger_stat1.stat1_bit;
-    uint8_t state = 0; /* 0 κβ 12Ȩ */
+    uint8_t state = 0; /* 0 不做任何操作； 1，紧紧解锁锁屏；2，鉴权结果 */
     role_t  *p_role = NULL;
 
     AW_MUTEX_LOCK(p_this->role_lock, AW_SEM_WAIT_FOREVER);
@@ -573,19 +577,19 @@ static int hub4g_rm_ctrl_scren_lock (void *p_arg, void *p_reg, uint8_t gun_num,
     AW_MUTEX_UNLOCK(p_this->role_lock);
 
     hub4g_dev_lock(p_this);
-    if ((uint8_t)val == 0xAA) { /* Ļ */
+    if ((uint8_t)val == 0xAA) { /* 解锁屏幕 */
 
         if (NULL != p_role) {
-            /* УǽĻ  */
+            /* 充电中，仅仅是解锁屏幕  */
             state = 1;
         } else {
-            /* ǳУԽĻСǹҳ */
+            /* 非充电中，可以解锁屏幕，进行“插枪”页面 */
             p_rm_signal->card_swing_ok2 = 0;
             state = 2;
         }
         p_rm_signal->screen_lock_stat = 1;
         p_rm_signal->pile_order_stat = 0;
-        /* ĻҪȡ׮ԤԼ */
+        /* 解锁屏幕，均要取消桩预约 */
 
 
     } else {
@@ -598,19 +602,19 @@ static int hub4g_rm_ctrl_scren_lock (void *p_arg, void *p_reg, uint8_t gun_num,
         return AW_OK;
     }
 
-    /* todo Ļ ȡԤԼ */
+    /* todo 发起解锁屏幕 取消预约 */
     event_node_tell_all(&p_this->evt_node, HUB4G_PILE_ORDER, FALSE);
-    /* todo Ȩ¼  */
+    /* todo 发起鉴权中事件  */
     event_node_tell_all(&p_this->evt_node, CARD_AUTH_ING, p_arg);
     aw_mdelay(200);
     switch (state) {
     case 1:
-        /* todo ¼  */
+        /* todo 解锁事件  */
         p_this->player.pfn_play(&p_this->p_hub4g_unlock, NULL);
         break;
 
     case 2:
-        /* todo Ȩɹ  */
+        /* todo 发起鉴权成功  */
         event_node_tell_all(&p_this->evt_node, CARD_AUTH_SUS, p_arg);
 
 #if ACP1000_OVERTIME_DETECT
@@ -625,7 +629,7 @@ static int hub4g_rm_ctrl_scren_lock (void *p_arg, void *p_reg, uint8_t gun_num,
     return AW_OK;
 }
 
-/* 4Gͨ״̬ */
+/* 4G通信状态 */
 static int hub4g_rm_ctrl_comm_state (void *p_arg, void *p_reg, uint8_t gun_num, void *val)
 {
     hub4g_t *p_this = (hub4g_t *)p_arg;
@@ -645,7 +649,7 @@ static int hub4g_rm_ctrl_comm_state (void *p_arg, void *p_reg, uint8_t gun_num,
     return AW_OK;
 }
 
-/* ԤԼ  */
+/* 预约充电  */
 static int hub4g_rm_ctrl_charge_order (void *p_arg, void *p_reg, uint8_t gun_num, void *val)
 {
     hub4g_t *p_this = (hub4g_t *)p_arg;
@@ -660,7 +664,7 @@ static int hub4g_rm_ctrl_charge_order (void *p_arg, void *p_reg, uint8_t gun_num
     }
     hub4g_dev_unlock(p_this);
 
-    /* todo ԤԼ¼ */
+    /* todo 预约事件控制 */
     event_node_tell_all(&p_this->evt_node,
                         HUB4G_PILE_ORDER,
                        (((uint32_t)val == 0xAA) ? TRUE : FALSE));
@@ -671,7 +675,7 @@ static int hub4g_rm_ctrl_charge_order (void *p_arg, void *p_reg, uint8_t gun_num
 #define NONALARM  0
 
 /**
- * ʾ
+ * 报警情况汇总显示
  */
 static void hub4g_alarm_status_set (hub4g_t *p_this, uint16_t err)
 {
@@ -802,19 +806,19 @@ static int upgrade_callback (void *p_arg)
         return -AW_EINVAL;
     }
 
-    /* ֪ */
+    /* 告知串口屏正在升级 */
     event_node_tell_all(&p_this->evt_node, HUB4G_UPGRADE, TRUE);
 
-    /* ʱ200Ա㴮ѯñ־λ*/
+    /* 延时200以便串口屏能轮询到该标志位*/
     aw_mdelay(975);
 }
 
 
-static struct aw_delayed_work g_hub4g_comm_work; /* ͨ쳣ʱ  */
-static bool_t g_comm_err_state = FALSE;          /* 쳣 */
+static struct aw_delayed_work g_hub4g_comm_work; /* 集中器通信异常延时处理工作  */
+static bool_t g_comm_err_state = FALSE;          /* 集中器异常情况 */
 
 /**
- * ͨ쳣
+ * 集中器通信异常处理
  */
 static void hub4g_comm_dly_work (void *p_arg)
 {
@@ -824,8 +828,122 @@ static void hub4g_comm_dly_work (void *p_arg)
     g_comm_err_state = TRUE;
 }
 
+#if ACP1000_LOAD_MANAGE
 /**
- * ͨص
+ * 负荷管理参数下发  p_reg 为 struct aw_remote_adjust_load_ctrl
+ */
+static int hub4g_load_ctrl_recevied (void *p_arg, void *p_reg, uint8_t gun_num, void *val)
+{
+    hub4g_t                           *p_this     = (hub4g_t *)p_arg;
+    struct aw_remote_adjust_load_ctrl *p_load_reg = (struct aw_remote_adjust_load_ctrl *)p_reg;
+    charge_load_t                      load;
+
+    if (NULL == p_load_reg) {
+        return -AW_EINVAL;
+    }
+
+    load.enable        = (p_load_reg->load_enable == RM_CTRL_DATA_VAL_SET) ? TRUE : FALSE;
+    load.curr_limit    = p_load_reg->curr_limit;
+    load.ramp_rate     = p_load_reg->ramp_rate;
+    load.min_curr      = p_load_reg->min_curr;
+    load.failsafe_curr = p_load_reg->failsafe_curr;
+
+    event_node_tell_all(&p_this->evt_node, HUB4G_LOAD_CTRL, (void *)&load);
+
+    return AW_OK;
+}
+#endif
+
+#if ACP1000_SCHED_CHARGE
+/**
+ * 智能充电规划参数下发  p_reg 为 struct aw_remote_adjust_sched_ctrl
+ */
+static int hub4g_sched_ctrl_recevied (void *p_arg, void *p_reg, uint8_t gun_num, void *val)
+{
+    hub4g_t                            *p_this      = (hub4g_t *)p_arg;
+    struct aw_remote_adjust_sched_ctrl *p_sched_reg = (struct aw_remote_adjust_sched_ctrl *)p_reg;
+    charge_sched_cfg_t                  sched;
+
+    if (NULL == p_sched_reg) {
+        return -AW_EINVAL;
+    }
+
+    sched.enable      = (p_sched_reg->sched_enable == RM_CTRL_DATA_VAL_SET) ? TRUE : FALSE;
+    sched.energy      = p_sched_reg->energy;
+    sched.depart_hour = p_sched_reg->depart_hour;
+    sched.depart_min  = p_sched_reg->depart_min;
+
+    event_node_tell_all(&p_this->evt_node, HUB4G_SCHED_CTRL, (void *)&sched);
+
+    return AW_OK;
+}
+#endif
+
+#if ACP1000_CARD_WL
+/**
+ * 离线卡名单操作， 并更新名单版本号及卡数寄存器
+ */
+static aw_err_t hub4g_card_wl_do (hub4g_t *p_this, card_wl_op_t *p_op)
+{
+    p_op->result     = -AW_ENODEV;
+    p_op->wl_version = 0;
+    p_op->wl_nums    = 0;
+    event_node_tell_all(&p_this->evt_node, HUB4G_CARD_WL, (void *)p_op);
+
+    hub4g_dev_lock(p_this);
+    p_this->super.rm_adjust_reg.card_wl.wl_version[0] = p_op->wl_version >> 16;
+    p_this->super.rm_adjust_reg.card_wl.wl_version[1] = p_op->wl_version & 0xFFFF;
+    p_this->super.rm_adjust_reg.card_wl.wl_nums       = p_op->wl_nums;
+    hub4g_dev_unlock(p_this);
+
+    return p_op->result;
+}
+
+/**
+ * 离线卡名单下发  p_reg 为 struct aw_remote_adjust_card_wl
+ */
+static int hub4g_card_wl_recevied (void *p_arg, void *p_reg, uint8_t gun_num, void *val)
+{
+    hub4g_t                         *p_this   = (hub4g_t *)p_arg;
+    struct aw_remote_adjust_card_wl *p_wl_reg = (struct aw_remote_adjust_card_wl *)p_reg;
+    card_wl_op_t                     op;
+
+    if (NULL == p_wl_reg) {
+        return -AW_EINVAL;
+    }
+
+    switch (p_wl_reg->wl_cmd) {
+    case RM_CARD_WL_CMD_ADD: op.cmd = CARD_WL_CMD_ADD; break;
+    case RM_CARD_WL_CMD_DEL: op.cmd = CARD_WL_CMD_DEL; break;
+    case RM_CARD_WL_CMD_CLR: op.cmd = CARD_WL_CMD_CLR; break;
+    default: return -AW_EINVAL;
+    }
+
+    /* 卡ID寄存器格式同 hub4g_card_id_set() */
+    op.uid[3]  = p_wl_reg->card_id[0] >> 8;
+    op.uid[2]  = p_wl_reg->card_id[0] & 0xFF;
+    op.uid[1]  = p_wl_reg->card_id[1] >> 8;
+    op.uid[0]  = p_wl_reg->card_id[1] & 0xFF;
+    op.version = ((uint32_t)p_wl_reg->version[0] << 16) | p_wl_reg->version[1];
+
+    return hub4g_card_wl_do(p_this, &op);
+}
+
+/**
+ * 同步名单版本号及卡数寄存器（事件注册完成后调用）
+ */
+void hub4g_card_wl_sync (hub4g_t *p_this)
+{
+    card_wl_op_t op;
+
+    memset(&op, 0, sizeof(op));
+    op.cmd = CARD_WL_CMD_GET;
+    hub4g_card_wl_do(p_this, &op);
+}
+#endif
+
+/**
+ * 集中器通信正常回调
  */
 aw_local int hub4g_comm_state_action (void *p_arg, uint16_t val)
 {
@@ -860,7 +978,7 @@ void hub4g_inst_init(hub4g_t      *p_hub4g,
     p_hub4g->p_pile_sem = p_pile_sem;
     modbus_reg_map_init(p_this);
 
-    /* ң */
+    /* 遥调 */
     modbus_func_cb_register(p_this, PILE_ID_FUNC, hub4g_pile_id_recevied, p_hub4g);
     modbus_func_cb_register(p_this, CARD_KEY_LOAD_FUNC, hub4g_card_key_recevied, p_hub4g);
     modbus_func_cb_register(p_this, USR_ID_SAVE_FUNC, hub4g_usr_id_recevied, p_hub4g);
@@ -871,19 +989,42 @@ void hub4g_inst_init(hub4g_t      *p_hub4g,
     modbus_func_cb_register(p_this, CHARGE_ENERGY_FUNC, hub4g_charge_energy_recevied, p_hub4g);
     modbus_func_cb_register(p_this, AUTH_FAILE_REASON, hub4g_auth_fail_reason_recevied, p_hub4g);
 
-    /* ңػص */
+    /* 遥控回调 */
     modbus_func_cb_register(p_this, ALLOW_CHARGING_FUNC, hub4g_rm_ctrl_charge_allow, p_hub4g);
     modbus_func_cb_register(p_this, CHARGING_STARTUP_FUNC, hub4g_rm_ctrl_charge_ctl, p_hub4g);
     modbus_func_cb_register(p_this, UNLOCK_SCREEN_FUNC, hub4g_rm_ctrl_scren_lock, p_hub4g);
     modbus_func_cb_register(p_this, COMM_4G_STAT_FUNC, hub4g_rm_ctrl_comm_state, p_hub4g);
     modbus_func_cb_register(p_this, ORDER_CHARGING_FUNC, hub4g_rm_ctrl_charge_order, p_hub4g);
 
-    /* ͨص */
+    /* 集中器通信正常回调 */
     modbus_func_cb_register(p_this, HUB4G_COMM_STATE, hub4g_comm_state_action, p_hub4g);
 
+#if ACP1000_LOAD_MANAGE
+    /* 负荷管理 */
+    modbus_func_cb_register(p_this, LOAD_CTRL_FUNC, hub4g_load_ctrl_recevied, p_hub4g);
+    p_this->rm_adjust_reg.load_ctrl.load_enable   = ACP1000_LOAD_DEFAULT_EN ?
+                                                    RM_CTRL_DATA_VAL_SET :
+                                                    RM_CTRL_DATA_VAL_RESET;
+    p_this->rm_adjust_reg.load_ctrl.curr_limit    = ACP1000_LOAD_FAILSAFE_CURR;
+    p_this->rm_adjust_reg.load_ctrl.ramp_rate     = ACP1000_LOAD_RAMP_RATE;
+    p_this->rm_adjust_reg.load_ctrl.min_curr      = ACP1000_LOAD_MIN_CURR;
+    p_this->rm_adjust_reg.load_ctrl.failsafe_curr = ACP1000_LOAD_FAILSAFE_CURR;
+#endif
+
+#if ACP1000_SCHED_CHARGE
+    /* 智能充电规划 */
+    modbus_func_cb_register(p_this, SCHED_CTRL_FUNC, hub4g_sched_ctrl_recevied, p_hub4g);
+    p_this->rm_adjust_reg.sched_ctrl.sched_enable = RM_CTRL_DATA_VAL_RESET;
+#endif
+
+#if ACP1000_CARD_WL
+    /* 离线卡名单 */
+    modbus_func_cb_register(p_this, CARD_WL_FUNC, hub4g_card_wl_recevied, p_hub4g);
+#endif
+
 #if ACP1000_EEPROM_PILE_ID_GET
     if(AW_OK == aw_nvram_get(ACP1000_EEPROM_NAME, 1, &pile_id, 0, 8)) {
-        // ÷ʧ"׮ID"
+        // 设置非易失性数据"桩ID"
         aw_mb_regcpy(p_this->rm_measure_reg.charger_data.pile_id, pile_id, RM_ADJ_PILE_ID_NUM);
     } else {
         p_pile->pile_alarm.alarm_mask |= PILE_ALARM_EEPROM;
@@ -898,10 +1039,10 @@ void hub4g_inst_init(hub4g_t      *p_hub4g,
     aw_mb_regcpy(p_this->rm_measure_reg.charger_data.time_invl_price, price, RM_ADJ_CHARGE_PRICE_NUM);
 #endif
 
-    /* ӿڱ־Խ׮Ϊ 0 */
+    /* 接口标志对交流桩恒为 0 */
     p_this->rm_measure_reg.charger_wdata.charger_interface = 0;
 
-    /* ʼdgus modbus slave*/
+    /* 初始化dgus modbus slave*/
      ac_modbus_slave_hdl_init (p_this,
                                p_mb_info->addr,
                                p_mb_info->com,
@@ -928,7 +1069,7 @@ void hub4g_inst_init(hub4g_t      *p_hub4g,
 #endif
 }
 
-static role_ret play(role_t **pp_role, void *p_arg)  /*  */
+static role_ret play(role_t **pp_role, void *p_arg)  /* 扮演 */
 {
     if ((*pp_role)->pfn_role_do) {
         return (*pp_role)->pfn_role_do(pp_role, p_arg);
@@ -937,26 +1078,26 @@ static role_ret play(role_t **pp_role, void *p_arg)  /* 
 }
 
 /**
- * û
+ * 用户余额控制
  */
 static role_ret hub4g_auth_usr_do (struct role **pp_role, void *p_arg)
 {
     AUTH_USR_TO_HUB4G(p_this, pp_role);
 
     event_node_tell(&p_this->evt_node, HUB4G_AUTH_USR, p_arg);
-    /* ͼȨɹ */
+    /* 发送鉴权成功 */
     AW_SEMB_GIVE(p_this->p_pile_sem->hub4g_auth_sem);
     return AW_OK;
 }
 
 /**
- * 
+ * 允许充电控制
  */
 static role_ret hub4g_allow_charge_do (struct role **pp_role, void *p_arg)
 {
     ALLOW_CHARGER_TO_HUB4G(p_this, pp_role);
 
-    /* ¼ */
+    /* 发送允许充电事件 */
     event_node_tell_all(&p_this->evt_node, HUB4G_ALLOW_CHARGE, p_arg);
     AW_SEMB_GIVE(p_this->p_pile_sem->hub4g_cctrl_sem);
 
@@ -964,13 +1105,13 @@ static role_ret hub4g_allow_charge_do (struct role **pp_role, void *p_arg)
 }
 
 /**
- * 
+ * 允许充电控制
  */
 static role_ret hub4g_billing_do (struct role **pp_role, void *p_arg)
 {
     BILLING_TO_HUB4G(p_this, pp_role);
 
-    /* ¼ */
+    /* 发送允许充电事件 */
     event_node_tell_all(&p_this->evt_node, HUB4G_BILLING, &(p_this->super.rm_adjust_reg.usr_ctrl));
     AW_SEMB_GIVE(p_this->p_pile_sem->hub4g_billing_sem);
 
@@ -979,22 +1120,22 @@ static role_ret hub4g_billing_do (struct role **pp_role, void *p_arg)
 
 
 /**
- * Կ·
- * p_arg Կ
+ * 密钥下发控制
+ * p_arg： 密钥
  */
 static role_ret hub4g_auth_key_do (struct role **pp_role, void *p_arg)
 {
     AUTH_KEY_TO_HUB4G(p_this, pp_role);
 
-    /* Կ·¼ */
+    /* 发送密钥下发事件 */
 //    event_node_tell_all(&p_this->evt_node, HUB4G_AUTH_KEY, p_arg);
     AW_SEMB_GIVE(p_this->p_pile_sem->hub4g_key_sem);
     return AW_OK;
 }
 
 /**
- * Կ·
- * p_arg TRUE: ʼ磬FALSE: ֹͣ
+ * 密钥下发控制
+ * p_arg： TRUE: 开始充电，FALSE: 停止充电
  */
 static role_ret hub4g_charge_ctrl_do (struct role **pp_role, void *p_arg)
 {
@@ -1010,7 +1151,7 @@ static role_ret hub4g_charge_ctrl_do (struct role **pp_role, void *p_arg)
 }
 
 /**
- * 
+ * 解锁器
  */
 static role_ret hub4g_unlock_do (struct role **pp_role, void *p_arg)
 {
@@ -1020,7 +1161,7 @@ static role_ret hub4g_unlock_do (struct role **pp_role, void *p_arg)
     return AW_OK;
 }
 
-/*=============================¼==========================================*/
+/*=============================事件驱动==========================================*/
 void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
 {
     EVT_TO_HUG4G(p_this, p_evt);
@@ -1034,6 +1175,7 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
     uint8_t           *p_blk_dat     = NULL;
     billing_mode_t    *p_billing_mod = NULL;
     pile_time_price_t *p_tm          = NULL ;
+    charge_sched_info_t *p_sched_info = NULL;
     uint16_t           temp;
     billing_dat_t     *p_billing_dat = NULL;
     ammeter_dat_t     *p_ammeter_dat = NULL;
@@ -1043,13 +1185,13 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
 
     switch (event) {
 
-    case CARD_WAIT_KEY: /* ȴԿ   p_arg ΪƬID  */
+    case CARD_WAIT_KEY: /* 等待密钥   p_arg 为：卡片ID  */
         hub4g_card_id_set(p_this, (uint8_t *)p_arg, 4);
         hub4g_dev_lock(p_this);
-        /* Կ־ */
+        /* 清除密钥保存标志 */
         p_this->super.rm_signal_reg.charger_stat[0].charger_stat1.stat1_bit.key_store_ok = 0;
         p_this->super.rm_signal_reg.charger_stat[0].charger_stat1.stat1_bit.charger_allow_stat = 0;
-        /* ˢ־λΪ1ʼȴ·key */
+        /* 置刷卡标志位为1，起始等待集中器下发key */
         p_this->super.rm_signal_reg.charger_stat[0].charging_stop_cause.cause_bit.card_swing_ok1 = 1;
         p_this->super.rm_signal_reg.charger_stat[0].charger_stat1.stat1_bit.card_swing_ok2 = 0;
         AW_SEMB_INIT(p_this->p_pile_sem->hub4g_key_sem, AW_SEM_EMPTY, AW_SEM_Q_PRIORITY);
@@ -1063,9 +1205,9 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
     case CARD_AUTH_ID:
         hub4g_card_id_set(p_this, (uint8_t *)p_arg, 4);
         hub4g_dev_lock(p_this);
-        /* Կ־ */
+        /* 清除密钥保存标志 */
         p_this->super.rm_signal_reg.charger_stat[0].charger_stat1.stat1_bit.charger_allow_stat = 0;
-        /* ˢ־λΪ1ʼȴ·key */
+        /* 置刷卡标志位为1，起始等待集中器下发key */
         p_this->super.rm_signal_reg.charger_stat[0].charging_stop_cause.cause_bit.card_swing_ok1 = 1;
         p_this->super.rm_signal_reg.charger_stat[0].charger_stat1.stat1_bit.card_swing_ok2 = 0;
         hub4g_dev_unlock(p_this);
@@ -1082,17 +1224,17 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
         break;
 
     case CARD_SWING_OK:
-        p_blk_dat = (uint8_t *)p_arg; /*  */
-        /* д */
+        p_blk_dat = (uint8_t *)p_arg; /* 卡扇区数据 */
+        /* 向集中器点表填写卡扇区数据 */
         hub4g_dev_lock(p_this);
         AW_SEMB_INIT(p_this->p_pile_sem->hub4g_auth_sem, AW_SEM_EMPTY, AW_SEM_Q_PRIORITY);
         AW_SEMB_INIT(p_this->p_pile_sem->hub4g_cctrl_sem, AW_SEM_EMPTY, AW_SEM_Q_PRIORITY);
         hub4g_card_blk_dat_set(p_this, &p_blk_dat[0],  1);
         hub4g_card_blk_dat_set(p_this, &p_blk_dat[16],  2);
         hub4g_card_blk_dat_set(p_this, &p_blk_dat[32],  3);
-        /* ˢɹ־λ1 */
+        /* 刷卡成功标志位置1 */
         p_this->super.rm_signal_reg.charger_stat[0].charger_stat1.stat1_bit.card_swing_ok2 = 1;
-//        /* Կ־ */
+//        /* 清除密钥保存标志 */
 //        p_this->super.rm_signal_reg.charger_stat[0].charger_stat1.stat1_bit.key_store_ok = 0;
         hub4g_dev_unlock(p_this);
 
@@ -1175,12 +1317,13 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
         AW_MUTEX_UNLOCK(p_this->role_lock);
         break;
 
-    case BILLING_ING: /* Ʒ */
+    case BILLING_ING: /* 计费中 */
         p_billing_dat = (billing_dat_t  *)p_arg;
         hub4g_charge_data_set(p_this,
                               p_billing_dat->used_energy,
                               p_billing_dat->used_amount,
                               p_billing_dat->used_time);
+        LAT_HIST_END(LAT_HIST_BILL_MB);
         break;
 
     case AMETER_MEASURE:
@@ -1219,6 +1362,34 @@ void static event_driver(struct event_node *p_evt, event_t event, void *p_arg)
         p_tm->now_price = hub4g_charge_price_get(p_this, p_tm->tm.tm_hour);
         break;
 
+    case CHARGE_CURR_LIMIT:
+        hub4g_dev_lock(p_this);
+        p_this->super.rm_adjust_reg.load_ctrl.now_curr = (uint32_t)p_arg;
+        hub4g_dev_unlock(p_this);
+        break;
+
+    case CHARGE_SCHED_INFO:
+        p_sched_info = (charge_sched_info_t *)p_arg;
+        hub4g_dev_lock(p_this);
+        p_this->super.rm_adjust_reg.sched_ctrl.state       = p_sched_info->state;
+        p_this->super.rm_adjust_reg.sched_ctrl.start_delay = p_sched_info->start_delay;
+        p_this->super.rm_adjust_reg.sched_ctrl.plan_curr   = p_sched_info->plan_curr;
+        p_this->super.rm_adjust_reg.sched_ctrl.plan_cost   = p_sched_info->cost > 0xFFFF ?
+                                                             0xFFFF : p_sched_info->cost;
+        if (CHARGE_SCHED_STATE_OFF == p_sched_info->state) {
+            p_this->super.rm_adjust_reg.sched_ctrl.sched_enable = RM_CTRL_DATA_VAL_RESET;
+        }
+        hub4g_dev_unlock(p_this);
+        break;
+
+    case SCHED_PRICE_GET:
+        hub4g_dev_lock(p_this);
+        memcpy(p_arg,
+               p_this->super.rm_measure_reg.charger_data.time_invl_price,
+               sizeof(uint16_t) * RM_ADJ_TIME_INVL_NUM);
+        hub4g_dev_unlock(p_this);
+        break;
+
     case PILE_ALARM:
         hub4g_dev_lock(p_this);
         p_this->pile_alarm = (uint32_t)p_arg;
@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief ʵ
+ * \brief 集中器实例声明
  *
  * \internal
  * \par modification history:
@@ -31,34 +31,34 @@
 #include "dugs.h"
 #include "mb/ac_modbus_reg_map.h"
 /**
- * ʵ
+ * 集中器实例声明
  */
 typedef struct hub4g {
-    struct modbus_reg_map  super;      /*  */
-    player_t          player;              /*  */
-    event_node_t      evt_node;            /* ¼ӿ */
+    struct modbus_reg_map  super;      /* 串口屏数据 */
+    player_t          player;              /* 扮演者 */
+    event_node_t      evt_node;            /* 事件接口 */
 
-    role_t           *p_hub4g_auth_usr;     /* ɰݵĽɫ  - Ȩû */
-    role_t           *p_hub4g_charge_ctrl;  /* ɰݵĽɫ  -  */
-    role_t           *p_hub4g_billing;      /* ɰݵĽɫ  -  */
-    role_t           *p_hub4g_settings;     /* ɰݵĽɫ  -  */
-    role_t           *p_hub4g_auth_key;     /* ɰݵĽɫ  - Կ· */
-    role_t           *p_hub4g_allow_charge; /* ɰݵĽɫ  - Կ· */
-    role_t           *p_hub4g_unlock;       /* ɰݵĽɫ  - Ļ */
+    role_t           *p_hub4g_auth_usr;     /* 可扮演的角色  - 鉴权用户余额控制器 */
+    role_t           *p_hub4g_charge_ctrl;  /* 可扮演的角色  - 充电控制器 */
+    role_t           *p_hub4g_billing;      /* 可扮演的角色  - 结算控制器 */
+    role_t           *p_hub4g_settings;     /* 可扮演的角色  - 参数设置器 */
+    role_t           *p_hub4g_auth_key;     /* 可扮演的角色  - 密钥下发控制器 */
+    role_t           *p_hub4g_allow_charge; /* 可扮演的角色  - 密钥下发控制器 */
+    role_t           *p_hub4g_unlock;       /* 可扮演的角色  - 屏幕解锁器 */
 
-    AW_MUTEX_DECL(role_lock);               /**< \brief ɫ  */
+    AW_MUTEX_DECL(role_lock);               /**< \brief 角色锁  */
 
-    pile_sem_t       *p_pile_sem;           /* źͬ */
+    pile_sem_t       *p_pile_sem;           /* 信号量同步 */
     uint32_t          pile_alarm;
 }hub4g_t;
 
-/** \brief д  */
+/** \brief 串口屏读写操作上锁  */
 aw_static_inline void hub4g_dev_lock(hub4g_t *p_this)
 {
     modbus_reg_map_lock(&(p_this->super));
 }
 
-/** \brief д  */
+/** \brief 串口屏读写操作解锁  */
 aw_static_inline void hub4g_dev_unlock(hub4g_t *p_this)
 {
     modbus_reg_map_unlock(&(p_this->super));
@@ -67,11 +67,16 @@ aw_static_inline void hub4g_dev_unlock(hub4g_t *p_this)
 
 
 /**
- * ʵʼ
+ * 集中器实例初始化
  */
 void hub4g_inst_init(hub4g_t      *p_hub4g,
                     modbus_info_t *p_mb_info,
                     pile_sem_t    *p_pile_sem,
                     bool_t         key_vaild);
 
+/**
+ * 同步离线卡名单版本号及卡数寄存器
+ */
+void hub4g_card_wl_sync (hub4g_t *p_this);
+
 #endif
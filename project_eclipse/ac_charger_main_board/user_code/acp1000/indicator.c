@@ -0,0 +1,246 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 指示灯及蜂鸣器模式引擎
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-04  xjc, first implementation
+ * - 1.01 16-10-18  xjc, 按步骤单次定时， 蜂鸣器音调改为PWM输出
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include "string.h"
+#include "ac_charge_prj_cfg.h"
+
+#if ACP1000_INDICATOR
+
+#include "aw_gpio.h"
+#include "aw_int.h"
+#include "aw_timer.h"
+#include "aw_pwm.h"
+#include "aw_system.h"
+#include "acp1000_dout.h"
+#include "indicator.h"
+
+/******************************************************************************/
+static const ind_step_t __g_idle_steps[] = {
+    {IND_OUT_GREEN, 1000},
+};
+
+static const ind_step_t __g_charging_steps[] = {
+    {IND_OUT_GREEN | IND_OUT_YELLOW | IND_OUT_STRIP, 1000},
+    {IND_OUT_GREEN | IND_OUT_STRIP,                  1000},
+};
+
+static const ind_step_t __g_fault_steps[] = {
+    {IND_OUT_GREEN | IND_OUT_RED, 1000},
+};
+
+static const ind_step_t __g_fault_charging_steps[] = {
+    {IND_OUT_GREEN | IND_OUT_RED | IND_OUT_YELLOW | IND_OUT_STRIP, 1000},
+};
+
+static const ind_step_t __g_beep_steps[] = {
+    {IND_OUT_BEEP, 100},
+};
+
+const ind_pattern_t g_ind_idle           = {__g_idle_steps,           AW_NELEMENTS(__g_idle_steps),           0};
+const ind_pattern_t g_ind_charging       = {__g_charging_steps,       AW_NELEMENTS(__g_charging_steps),       0};
+const ind_pattern_t g_ind_fault          = {__g_fault_steps,          AW_NELEMENTS(__g_fault_steps),          0};
+const ind_pattern_t g_ind_fault_charging = {__g_fault_charging_steps, AW_NELEMENTS(__g_fault_charging_steps), 0};
+const ind_pattern_t g_ind_beep           = {__g_beep_steps,           AW_NELEMENTS(__g_beep_steps),           1};
+
+/******************************************************************************/
+/**
+ * 通道运行情况
+ */
+typedef struct ind_chan {
+    const ind_pattern_t *p_slot[IND_PRIO_NUM];  /* 各优先级的模式 */
+
+    const ind_pattern_t *p_now;                 /* 正在播放的模式 */
+    uint8_t              prio;                  /* 正在播放的优先级 */
+    uint8_t              step;
+    uint8_t              loop;
+    uint8_t              out;                   /* 当前输出 */
+    aw_timer_t           timer;                 /* 当前步骤超时（单次） */
+}ind_chan_t;
+
+static ind_chan_t __g_chan[IND_CHAN_NUM];
+
+/**
+ * \brief 更新指示灯输出（仅在步骤切换时调用）
+ */
+static void __led_out (uint8_t out)
+{
+    aw_gpio_set(ACP1000_LED_RED,    (out & IND_OUT_RED)    ? 1 : 0);
+    aw_gpio_set(ACP1000_YELLOW_LED, (out & IND_OUT_YELLOW) ? 1 : 0);
+    aw_gpio_set(ACP1000_GREEN_LED,  (out & IND_OUT_GREEN)  ? 1 : 0);
+    aw_gpio_set(ACP1000_DOUT_LEDS,  (out & IND_OUT_STRIP)  ? 1 : 0);
+}
+
+/**
+ * \brief 更新蜂鸣器输出
+ *
+ * PWM1各通道共用周期， 只修改占空比， 不禁用通道， 以免影响CP输出
+ */
+static void __beep_out (uint8_t out)
+{
+    aw_pwm_config(ACP1000_IND_BEEP_PWM,
+                  (out & IND_OUT_BEEP) ? ACP1000_IND_BEEP_PERIOD / 2 : 0,
+                  ACP1000_IND_BEEP_PERIOD);
+}
+
+static void __step_enter (int ch)
+{
+    ind_chan_t       *p_chan = &__g_chan[ch];
+    const ind_step_t *p_step = NULL;
+    uint8_t           out    = 0;
+    aw_tick_t         ticks;
+
+    if (NULL != p_chan->p_now) {
+        p_step = &p_chan->p_now->p_steps[p_chan->step];
+        out    = p_step->out;
+    }
+
+    if (out != p_chan->out) {
+        if (IND_CHAN_LED == ch) {
+            __led_out(out);
+        } else {
+            __beep_out(out);
+        }
+    }
+    p_chan->out = out;
+
+    /* 无模式或循环播放的单步模式， 输出不再变化， 不启动定时器 */
+    if ((NULL == p_step) ||
+        ((1 == p_chan->p_now->nums) && (0 == p_chan->p_now->repeat))) {
+        aw_timer_stop(&p_chan->timer);
+        return;
+    }
+    ticks = aw_ms_to_ticks(p_step->ms);
+    aw_timer_start(&p_chan->timer, ticks ? ticks : 1);
+}
+
+/**
+ * \brief 选择优先级最高的模式， 与正在播放的不同时从头开始
+ */
+static void __chan_select (int ch)
+{
+    ind_chan_t          *p_chan = &__g_chan[ch];
+    const ind_pattern_t *p_sel  = NULL;
+    int                  prio;
+
+    for (prio = IND_PRIO_NUM - 1; prio >= 0; prio--) {
+        if (NULL != p_chan->p_slot[prio]) {
+            p_sel = p_chan->p_slot[prio];
+            break;
+        }
+    }
+
+    if ((p_sel == p_chan->p_now) && ((NULL == p_sel) || (prio == p_chan->prio))) {
+        return;
+    }
+
+    p_chan->p_now = p_sel;
+    p_chan->prio  = (prio < 0) ? 0 : prio;
+    p_chan->step  = 0;
+    p_chan->loop  = 0;
+    __step_enter(ch);
+}
+
+/**
+ * \brief 步骤超时， 切换到下一步骤（定时器回调， 中断上下文）
+ */
+static void __step_timeout (void *p_arg)
+{
+    int         ch     = (int)p_arg;
+    ind_chan_t *p_chan = &__g_chan[ch];
+
+    if (NULL == p_chan->p_now) {
+        return;
+    }
+
+    if (++p_chan->step >= p_chan->p_now->nums) {
+        p_chan->step = 0;
+        if (p_chan->p_now->repeat && (++p_chan->loop >= p_chan->p_now->repeat)) {
+            /* 有限次模式结束， 恢复低优先级模式 */
+            p_chan->p_slot[p_chan->prio] = NULL;
+            __chan_select(ch);
+            return;
+        }
+    }
+    __step_enter(ch);
+}
+
+/******************************************************************************/
+aw_err_t indicator_init (void)
+{
+    int ch;
+
+    memset(__g_chan, 0, sizeof(__g_chan));
+    for (ch = 0; ch < IND_CHAN_NUM; ch++) {
+        aw_timer_init(&__g_chan[ch].timer, __step_timeout, (void *)ch);
+    }
+
+    /* 占空比为0时静音， 之后只修改占空比 */
+    if (AW_OK != aw_pwm_config(ACP1000_IND_BEEP_PWM, 0, ACP1000_IND_BEEP_PERIOD)) {
+        return -AW_ENODEV;
+    }
+    return aw_pwm_enable(ACP1000_IND_BEEP_PWM);
+}
+
+void indicator_play (int chan, int prio, const ind_pattern_t *p_pattern)
+{
+    AW_INT_CPU_LOCK_DECL(key);
+
+    if ((chan < 0) || (chan >= IND_CHAN_NUM) ||
+        (prio < 0) || (prio >= IND_PRIO_NUM) ||
+        (NULL == p_pattern) || (0 == p_pattern->nums)) {
+        return;
+    }
+
+    AW_INT_CPU_LOCK(key);
+    if (__g_chan[chan].p_slot[prio] != p_pattern) {
+        __g_chan[chan].p_slot[prio] = p_pattern;
+        __chan_select(chan);
+    } else if (p_pattern->repeat &&
+               (__g_chan[chan].p_now == p_pattern) &&
+               (__g_chan[chan].prio  == prio)) {
+        /* 有限次模式正在播放时再次请求， 从头播放 */
+        __g_chan[chan].p_now = NULL;
+        __chan_select(chan);
+    }
+    AW_INT_CPU_UNLOCK(key);
+}
+
+void indicator_stop (int chan, int prio)
+{
+    AW_INT_CPU_LOCK_DECL(key);
+
+    if ((chan < 0) || (chan >= IND_CHAN_NUM) ||
+        (prio < 0) || (prio >= IND_PRIO_NUM)) {
+        return;
+    }
+
+    AW_INT_CPU_LOCK(key);
+    if (NULL != __g_chan[chan].p_slot[prio]) {
+        __g_chan[chan].p_slot[prio] = NULL;
+        __chan_select(chan);
+    }
+    AW_INT_CPU_UNLOCK(key);
+}
+
+#endif /* ACP1000_INDICATOR */
@@ -0,0 +1,113 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 指示灯及蜂鸣器模式引擎
+ *
+ * 闪烁、鸣响以步骤表描述， 每个步骤由单次定时器超时切换到下一步骤，
+ * 输出不再变化的模式（循环播放的单步模式）不启动定时器， 任务只需选择模式。
+ * 蜂鸣器音调由PWM输出， 定时器只在鸣响开始和结束时修改占空比。
+ * 指示灯和蜂鸣器为两个独立通道， 每个通道按优先级各有一个模式槽，
+ * 输出优先级最高的模式， 高优先级的有限次模式结束后自动恢复低优先级模式。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-04  xjc, first implementation
+ * - 1.01 16-10-18  xjc, 按步骤单次定时， 蜂鸣器音调改为PWM输出
+ * \endinternal
+ */
+
+#ifndef __INDICATOR_H
+#define __INDICATOR_H
+
+#include "apollo.h"
+#include "ac_charge_prj_cfg.h"
+
+/**
+ * \brief 指示灯通道输出位
+ * @{
+ */
+#define IND_OUT_RED         (1u << 0)   /**< \brief 红灯（异常） */
+#define IND_OUT_YELLOW      (1u << 1)   /**< \brief 黄灯（充电） */
+#define IND_OUT_GREEN       (1u << 2)   /**< \brief 绿灯（电源） */
+#define IND_OUT_STRIP       (1u << 3)   /**< \brief 灯带 */
+/** @} */
+
+/** \brief 蜂鸣器通道输出位 */
+#define IND_OUT_BEEP        (1u << 0)
+
+/**
+ * \brief 通道
+ * @{
+ */
+#define IND_CHAN_LED        0
+#define IND_CHAN_BUZZER     1
+#define IND_CHAN_NUM        2
+/** @} */
+
+/**
+ * \brief 优先级（数值大的抢占数值小的）
+ * @{
+ */
+#define IND_PRIO_IDLE       0           /**< \brief 空闲 */
+#define IND_PRIO_CHARGE     1           /**< \brief 充电、 刷卡提示 */
+#define IND_PRIO_FAULT      2           /**< \brief 故障 */
+#define IND_PRIO_NUM        3
+/** @} */
+
+/**
+ * 步骤： 输出保持的时间
+ */
+typedef struct ind_step {
+    uint8_t   out;          /* 输出位图 */
+    uint16_t  ms;           /* 保持时间（ms） */
+}ind_step_t;
+
+/**
+ * 模式
+ */
+typedef struct ind_pattern {
+    const ind_step_t *p_steps;
+    uint8_t           nums;     /* 步骤数 */
+    uint8_t           repeat;   /* 播放次数， 0为循环 */
+}ind_pattern_t;
+
+/**
+ * \brief 预定义模式
+ * @{
+ */
+extern const ind_pattern_t g_ind_idle;            /**< \brief 空闲： 绿灯 */
+extern const ind_pattern_t g_ind_charging;        /**< \brief 充电： 黄灯1s闪烁、 灯带亮 */
+extern const ind_pattern_t g_ind_fault;           /**< \brief 故障： 红灯 */
+extern const ind_pattern_t g_ind_fault_charging;  /**< \brief 故障且接触器闭合： 红灯、 黄灯、 灯带 */
+extern const ind_pattern_t g_ind_beep;            /**< \brief 刷卡提示音 */
+/** @} */
+
+/**
+ * \brief 初始化各通道的步骤定时器及蜂鸣器PWM（静音）
+ * \retval AW_OK       : 成功
+ * \retval -AW_ENODEV  : 蜂鸣器PWM不可用
+ */
+aw_err_t indicator_init (void);
+
+/**
+ * \brief 在通道的某个优先级播放模式（与正在该优先级播放的模式相同时不重新开始）
+ */
+void indicator_play (int chan, int prio, const ind_pattern_t *p_pattern);
+
+/**
+ * \brief 停止通道某个优先级的模式
+ */
+void indicator_stop (int chan, int prio);
+
+#endif
@@ -0,0 +1,282 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 关键路径延迟直方图
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-14  xjc, first implementation
+ * - 1.01 16-10-18  xjc, add lat_hist_cancel()
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include "string.h"
+#include "ac_charge_prj_cfg.h"
+
+#if ACP1000_LAT_HIST
+
+#include "aw_int.h"
+#include "aw_task.h"
+#include "aw_delay.h"
+#include "lat_hist.h"
+#if ACP1000_LAT_HIST_MB
+#include "mb/ac_modbus_reg_map.h"
+#if ACP1000_PERIODIC
+#include "periodic.h"
+#endif
+#endif
+
+static lat_hist_t  __g_hist[LAT_HIST_PATH_NUMS];
+static uint32_t    __g_start[LAT_HIST_PATH_NUMS];
+static bool_t      __g_pending[LAT_HIST_PATH_NUMS];
+
+static const char *__g_name[LAT_HIST_PATH_NUMS] = {
+    "cp_role",
+    "scram_ac",
+    "card_auth",
+    "mb_req",
+    "bill_mb",
+};
+
+/**
+ * \brief 延迟所在的桶
+ */
+static int __bucket_get (uint32_t us)
+{
+    int k = 0;
+
+    us >>= 3;
+    while ((0 != us) && (k < LAT_HIST_BUCKETS - 1)) {
+        us >>= 1;
+        k++;
+    }
+    return k;
+}
+
+/* 持有中断锁时调用 */
+static void __record (lat_hist_t *p_hist, uint32_t us)
+{
+    if ((0 == p_hist->cnt) || (us < p_hist->min_us)) {
+        p_hist->min_us = us;
+    }
+    if (us > p_hist->max_us) {
+        p_hist->max_us = us;
+    }
+    p_hist->cnt++;
+    p_hist->sum_us += us;
+    p_hist->bucket[__bucket_get(us)]++;
+}
+
+void lat_hist_start (int path)
+{
+    AW_INT_CPU_LOCK_DECL(key);
+
+    if ((path < 0) || (path >= LAT_HIST_PATH_NUMS)) {
+        return;
+    }
+    AW_INT_CPU_LOCK(key);
+    __g_start[path]   = aw_timestamp_get();
+    __g_pending[path] = TRUE;
+    AW_INT_CPU_UNLOCK(key);
+}
+
+void lat_hist_end (int path)
+{
+    uint32_t us;
+    AW_INT_CPU_LOCK_DECL(key);
+
+    if ((path < 0) || (path >= LAT_HIST_PATH_NUMS) || !__g_pending[path]) {
+        return;
+    }
+    AW_INT_CPU_LOCK(key);
+    if (__g_pending[path]) {
+        __g_pending[path] = FALSE;
+        us = aw_timestamps_to_us(aw_timestamp_get() - __g_start[path]);
+        if (us > LAT_HIST_STALE_MS * 1000) {
+            __g_hist[path].stale++;
+        } else {
+            __record(&__g_hist[path], us);
+        }
+    }
+    AW_INT_CPU_UNLOCK(key);
+}
+
+void lat_hist_cancel (int path)
+{
+    if ((path < 0) || (path >= LAT_HIST_PATH_NUMS)) {
+        return;
+    }
+    __g_pending[path] = FALSE;
+}
+
+void lat_hist_add (int path, uint32_t stamps)
+{
+    uint32_t us = aw_timestamps_to_us(stamps);
+    AW_INT_CPU_LOCK_DECL(key);
+
+    if ((path < 0) || (path >= LAT_HIST_PATH_NUMS)) {
+        return;
+    }
+    AW_INT_CPU_LOCK(key);
+    __record(&__g_hist[path], us);
+    AW_INT_CPU_UNLOCK(key);
+}
+
+aw_err_t lat_hist_get (int path, lat_hist_t *p_hist)
+{
+    AW_INT_CPU_LOCK_DECL(key);
+
+    if ((path < 0) || (path >= LAT_HIST_PATH_NUMS)) {
+        return -AW_EINVAL;
+    }
+    AW_INT_CPU_LOCK(key);
+    *p_hist = __g_hist[path];
+    AW_INT_CPU_UNLOCK(key);
+    return AW_OK;
+}
+
+const char *lat_hist_name (int path)
+{
+    if ((path < 0) || (path >= LAT_HIST_PATH_NUMS)) {
+        return "?";
+    }
+    return __g_name[path];
+}
+
+uint32_t lat_hist_bucket_us (int bucket)
+{
+    if (bucket >= LAT_HIST_BUCKETS - 1) {
+        return 0xFFFFFFFF;
+    }
+    return 8ul << bucket;
+}
+
+uint32_t lat_hist_pct_us (const lat_hist_t *p_hist, int pct)
+{
+    uint32_t need, sum = 0;
+    uint32_t us;
+    int      k;
+
+    if (0 == p_hist->cnt) {
+        return 0;
+    }
+    need = (uint32_t)(((uint64_t)p_hist->cnt * pct + 99) / 100);
+    for (k = 0; k < LAT_HIST_BUCKETS; k++) {
+        sum += p_hist->bucket[k];
+        if (sum >= need) {
+            break;
+        }
+    }
+    us = lat_hist_bucket_us(k);
+    return (us < p_hist->max_us) ? us : p_hist->max_us;
+}
+
+void lat_hist_clr (void)
+{
+    AW_INT_CPU_LOCK_DECL(key);
+
+    AW_INT_CPU_LOCK(key);
+    memset(__g_hist, 0, sizeof(__g_hist));
+    memset(__g_pending, 0, sizeof(__g_pending));
+    AW_INT_CPU_UNLOCK(key);
+}
+
+/******************************************************************************/
+#if ACP1000_LAT_HIST_MB
+
+#define LAT_HIST_MB_PERIOD_MS   1000
+
+static struct modbus_reg_map *__gp_mb_map;
+
+static uint16_t __sat16 (uint32_t val)
+{
+    return (val > 0xFFFF) ? 0xFFFF : (uint16_t)val;
+}
+
+/**
+ * \brief 更新寄存器表（计数超过65535时为65535， 总次数和最大值为32位）
+ */
+static void __mb_update (void *p_arg)
+{
+    struct aw_lat_hist_data *p_reg;
+    lat_hist_t               hist;
+    int                      i, k;
+
+    if (NULL == __gp_mb_map) {
+        return;
+    }
+
+    for (i = 0; (i < LAT_HIST_PATH_NUMS) && (i < RM_MEASURE_LAT_HIST_PATHS); i++) {
+        lat_hist_get(i, &hist);
+
+        modbus_reg_map_lock(__gp_mb_map);
+        p_reg = &__gp_mb_map->rm_measure_reg.lat_hist.path[i];
+        p_reg->cnt[0]    = hist.cnt >> 16;
+        p_reg->cnt[1]    = hist.cnt & 0xFFFF;
+        p_reg->max_us[0] = hist.max_us >> 16;
+        p_reg->max_us[1] = hist.max_us & 0xFFFF;
+        for (k = 0; (k < LAT_HIST_BUCKETS) && (k < RM_MEASURE_LAT_HIST_BUCKETS); k++) {
+            p_reg->bucket[k] = __sat16(hist.bucket[k]);
+        }
+        modbus_reg_map_unlock(__gp_mb_map);
+    }
+}
+
+void lat_hist_mb_bind (struct modbus_reg_map *p_map)
+{
+    __gp_mb_map = p_map;
+}
+
+#if ACP1000_PERIODIC
+static periodic_job_t __g_lat_hist_job;
+#else
+#define LAT_HIST_TASK_PRIO     6       /* 低于各应用任务 */
+#define LAT_HIST_TACK_SIZE     512
+AW_TASK_DECL_STATIC(lat_hist_task, LAT_HIST_TACK_SIZE);
+
+static void __task_entry (void *p_arg)
+{
+    while (1) {
+        aw_mdelay(LAT_HIST_MB_PERIOD_MS);
+        __mb_update(p_arg);
+    }
+}
+#endif
+
+void lat_hist_mb_startup (void)
+{
+#if ACP1000_PERIODIC
+    periodic_job_init(&__g_lat_hist_job,
+                      "lat_hist",
+                      __mb_update,
+                      NULL,
+                      LAT_HIST_MB_PERIOD_MS,
+                      LAT_HIST_MB_PERIOD_MS,
+                      0);
+    periodic_job_add(&__g_lat_hist_job);
+#else
+    AW_TASK_INIT(lat_hist_task,          /* 任务实体 */
+                 "lat_hist_task",        /* 任务名字 */
+                 LAT_HIST_TASK_PRIO,     /* 任务优先级 */
+                 LAT_HIST_TACK_SIZE,     /* 任务堆栈大小 */
+                 __task_entry,           /* 任务入口函数 */
+                 NULL);                  /* 任务入口参数 */
+    AW_TASK_STARTUP(lat_hist_task);
+#endif
+}
+
+#endif /* ACP1000_LAT_HIST_MB */
+
+#endif /* ACP1000_LAT_HIST */
@@ -0,0 +1,152 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 关键路径延迟直方图
+ *
+ * 以时间戳（aw_timestamp）测量路径延迟， 按对数分桶计数：
+ *  - 桶0为 [0, 8) us， 桶k（0 < k < 19）为 [2^(k+2), 2^(k+3)) us，
+ *    桶19为 2^21 us（约2.1s）以上。
+ *
+ * 跨模块的路径由起点 LAT_HIST_START() 记下时刻， 终点 LAT_HIST_END() 计入，
+ * 每条路径只保留最近一次的起点， 终点无起点或起点已超过 LAT_HIST_STALE_MS 时
+ * 不计入（计为 stale）。 起点的事件被否定时（如防抖未确认）用 LAT_HIST_CANCEL()
+ * 丢弃起点。 同一函数内的路径用 LAT_HIST_BEGIN()/LAT_HIST_ADD()。
+ * ACP1000_LAT_HIST 为 0 时宏为空。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-14  xjc, first implementation
+ * - 1.01 16-10-18  xjc, add LAT_HIST_CANCEL()
+ * \endinternal
+ */
+
+#ifndef __LAT_HIST_H
+#define __LAT_HIST_H
+
+#include "apollo.h"
+#include "aw_timestamp.h"
+#include "ac_charge_prj_cfg.h"
+
+/**
+ * \brief 路径
+ * \anchor grp_lat_hist_path
+ * @{
+ */
+#define LAT_HIST_CP_ROLE     0  /**< \brief CP电压变化（防抖前， 未确认时取消） -> 充电控制角色切换 */
+#define LAT_HIST_SCRAM_AC    1  /**< \brief 急停输入检出 -> 接触器反馈断开 */
+#define LAT_HIST_CARD_AUTH   2  /**< \brief 刷卡 -> 鉴权结果（CARD_AUTH_SUS/FAIL/SUS_ORDER） */
+#define LAT_HIST_MB          3  /**< \brief Modbus寄存器读写请求处理（回调进入 -> 返回） */
+#define LAT_HIST_BILL_MB     4  /**< \brief 计费数据发布（BILLING_ING） -> 寄存器表更新 */
+#define LAT_HIST_PATH_NUMS   5
+/** @} */
+
+#define LAT_HIST_BUCKETS     20
+#define LAT_HIST_STALE_MS    10000  /* 起点超过该时间未到终点时丢弃 */
+
+/**
+ * 直方图
+ */
+typedef struct lat_hist {
+    uint32_t cnt;
+    uint32_t stale;                     /* 丢弃的终点 */
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t sum_us;
+    uint32_t bucket[LAT_HIST_BUCKETS];
+}lat_hist_t;
+
+#if ACP1000_LAT_HIST
+
+#define LAT_HIST_START(path)     lat_hist_start(path)
+#define LAT_HIST_END(path)       lat_hist_end(path)
+#define LAT_HIST_CANCEL(path)    lat_hist_cancel(path)
+#define LAT_HIST_DECL(t)         uint32_t t
+#define LAT_HIST_BEGIN(t)        ((t) = aw_timestamp_get())
+#define LAT_HIST_ADD(path, t)    lat_hist_add((path), aw_timestamp_get() - (t))
+
+#else
+
+#define LAT_HIST_START(path)
+#define LAT_HIST_END(path)
+#define LAT_HIST_CANCEL(path)
+#define LAT_HIST_DECL(t)
+#define LAT_HIST_BEGIN(t)
+#define LAT_HIST_ADD(path, t)
+
+#endif
+
+/**
+ * \brief 记下路径起点（可在中断中调用）
+ * \param[in] path : 路径 \ref grp_lat_hist_path
+ */
+void lat_hist_start (int path);
+
+/**
+ * \brief 路径终点， 有起点时计入一次延迟（可在中断中调用）
+ */
+void lat_hist_end (int path);
+
+/**
+ * \brief 丢弃路径起点， 之后的终点不计入（可在中断中调用）
+ */
+void lat_hist_cancel (int path);
+
+/**
+ * \brief 计入一次延迟
+ * \param[in] stamps : 延迟（时间戳计数）
+ */
+void lat_hist_add (int path, uint32_t stamps);
+
+/**
+ * \brief 获取直方图
+ * \return AW_OK： 成功  -AW_EINVAL： 路径无效
+ */
+aw_err_t lat_hist_get (int path, lat_hist_t *p_hist);
+
+/**
+ * \brief 路径名字
+ */
+const char *lat_hist_name (int path);
+
+/**
+ * \brief 桶的上限（us）， 最后一个桶返回 0xFFFFFFFF
+ */
+uint32_t lat_hist_bucket_us (int bucket);
+
+/**
+ * \brief 估计百分位数（所在桶的上限， 不超过最大值）
+ * \param[in] pct : 1~100
+ */
+uint32_t lat_hist_pct_us (const lat_hist_t *p_hist, int pct);
+
+/**
+ * \brief 清除全部直方图
+ */
+void lat_hist_clr (void);
+
+#if ACP1000_LAT_HIST_MB
+struct modbus_reg_map;
+
+/**
+ * \brief 绑定Modbus寄存器表， 每秒更新遥测的延迟直方图寄存器
+ */
+void lat_hist_mb_bind (struct modbus_reg_map *p_map);
+
+/**
+ * \brief 启动寄存器更新（ACP1000_PERIODIC 时为周期作业， 否则为独立任务）
+ */
+void lat_hist_mb_startup (void);
+#endif
+
+#endif
@@ -0,0 +1,153 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief NTC阻值与温度换算（原 pile_temp_task.c 中的计算方式）
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-18  xjc, first implementation
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include "ntc.h"
+
+/**
+ * \brief 列表中对应的温度值依次是-40~85℃，步进1℃。
+ */
+static const uint32_t g_temp_res_val[] = {
+    /* -40~-31℃ */
+    248277, 233136, 219036, 205897, 193648, 182221, 171556, 161596, 152290, 143590,
+    /* -30~-21℃ */
+    135452, 127837, 120707, 114028, 107768, 101898, 96391, 91222, 86369, 81809,
+    /* -20~-11℃ */
+    77523, 73492, 69701, 66132, 62771, 59606, 56623, 53810, 51157, 48654,
+    /* -10~-1℃ */
+    46290, 44058, 41950, 39957, 38072, 36290, 34603, 33006, 31494, 30062,
+    /* 0~9℃ */
+    28704, 27417, 26197, 25039, 23940, 22897, 21906, 20964, 20070, 19219,
+    /* 10~19℃ */
+    18410, 17641, 16909, 16212, 15548, 14916, 14313, 13739, 13192, 12669,
+    /* 20~29℃ */
+    12171, 11696, 11242, 10809, 10395, 10000, 9622, 9261, 8916, 8585,
+    /* 30~39℃ */
+    8269, 7967, 7678, 7400, 7135, 6881, 6637, 6403, 6179, 5965,
+    /* 40~49℃ */
+    5759, 5561, 5372, 5189, 5015, 4847, 4686, 4531, 4382, 4239,
+    /* 50~59℃ */
+    4101, 3969, 3842, 3719, 3601, 3488, 3379, 3274, 3172, 3075,
+    /* 60~69℃ */
+    2981, 2890, 2803, 2719, 2638, 2559, 2484, 2411, 2341, 2273,
+    /* 70~79℃ */
+    2207, 2144, 2083, 2024, 1967, 1912, 1858, 1807, 1757, 1709,
+    /* 80~85℃ */
+    1662, 1617, 1574, 1532, 1491, 1451
+};
+
+static const int g_res_val_num = sizeof(g_temp_res_val) / sizeof(g_temp_res_val[0]);
+static const int g_temp_start  =  -40;    /* 表格中起始温度为-20℃ */
+
+
+/**
+ * \brief 热敏电阻阻值计算公式
+ * Rv = (Vref - Vadc) *Rm / Vadc
+ * 请参照电路图可知Vref = 3300, Vadc = AD = vol采集的电压，单位mv
+ * Rm = 10000Ω
+ * \param[in] adc_handle : ADC标准服务句柄
+ * \return 电阻值（热敏电阻的阻值）
+ */
+uint32_t ntc_res_get (uint32_t vol)
+{
+    return (3300 - vol) * 10000 / vol;
+}
+
+/**
+ * \brief 温度误差在1℃之内通过算法取最合理值
+ *
+ * \param[in] t1 : 左边界温度
+ * \param[in] t1 : 右边界温度
+ *
+ * \return temp : 温度值
+ */
+static inline int16_t __ntc_temp_get_from_range (int t1,int t2, uint32_t res)
+{
+    int r1 = g_temp_res_val[t1 - g_temp_start];  /* 得到温度1对应的阻值 */
+    int r2 = g_temp_res_val[t2 - g_temp_start];  /* 得到温度2对应的阻值 */
+
+    int r  = res;
+    int temp;
+
+    /* 为避免小数计算扩大了256倍（左移8位） */
+    temp =  (((t2 - t1) * (r - r1)) << 8) / (r2 - r1) + (t1 << 8);
+
+    return temp;
+}
+
+/**
+ * \brief 二分法查表并返回相应的温度值
+ * \param[in]  res : 电阻阻值
+ *
+ * \return temp: 温度值
+ */
+int16_t ntc_res_to_temp (uint32_t res)
+{
+    int16_t   temp;
+    int low, high, mid;     /* 二分法查表的三个下标     */
+    int t1,t2;              /* 区间的两个温度值 t1 ~ t2 */
+
+    low  = 0;               /* 初始表上边界为第一个     */
+    high = g_res_val_num - 1; /* 初始表下边界为最后一个   */
+
+    while(1) {
+
+        /* 右移一位，等效于 (low + high)/2 */
+        mid = (low + high) >> 1;
+
+        /* 如果恰好相等 */
+        if (res == g_temp_res_val[mid]) {
+            /* 整数温度值，扩大256倍 */
+            temp = (mid + g_temp_start) << 8;
+            break;
+        }
+
+        /* 阻值大于中间值，则搜索范围为前半部分，更新high值 */
+        if (res > g_temp_res_val[mid]) {
+            high = mid;
+        } else {
+            /* 阻值小于中间值，则搜索范围为后半部分，更新low值 */
+            low = mid;
+        }
+
+        /* 搜索范围确定至1℃内，找到温度所处范围 */
+        if (high - low == 1) {
+
+            /* 阻值高于-39℃的阻值， 按-40℃（t1 将超出表格） */
+            if (0 == low) {
+                temp = g_temp_start << 8;
+                break;
+            }
+
+            /* 右边界温度值 */
+            t2 = high + g_temp_start;
+            /* 左边界温度值 */
+            t1 = low - 1 + g_temp_start;
+            /* 计算最佳温度值 */
+            temp = __ntc_temp_get_from_range(t1, t2, res);
+
+            break;
+        }
+    }
+
+    return temp;
+}
@@ -0,0 +1,45 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief NTC阻值与温度换算（原 pile_temp_task.c 中的计算方式）
+ *
+ * 查表方式（ntc_lut.c）的表格由本换算离线生成（host/gen_ntc_lut.c）， 参考电压
+ * 或位数与表格不符时测温任务仍使用本换算。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-18  xjc, first implementation
+ * \endinternal
+ */
+
+#ifndef __NTC_H
+#define __NTC_H
+
+#include "apollo.h"
+
+/**
+ * \brief 由分压电压计算NTC阻值（分压电阻10K接3300mV）
+ * \param[in] vol : ADC采集的电压， 单位mV， 不能为0
+ * \return 阻值， 单位Ω
+ */
+uint32_t ntc_res_get (uint32_t vol);
+
+/**
+ * \brief 阻值转温度（二分查表后插值）
+ * \param[in] res : 阻值， 单位Ω
+ * \return 温度， 单位1/256℃， 低于-40℃时为-40℃， 高于85℃时为外推值
+ */
+int16_t ntc_res_to_temp (uint32_t res);
+
+#endif
@@ -0,0 +1,602 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief NTC温度查表（按ADC码值直接索引）
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-09-29  xjc, first implementation
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include "ntc_lut.h"
+
+#if ACP1000_TEMP_LUT
+
+/**
+ * 温度表（单位1/256℃）， -40℃以下按-40℃， 85℃以上为原算法外推值
+ */
+#if ACP1000_TEMP_LUT == 2
+/* 每16个码值一个点， 共257点（最后一点为码值4095） */
+static const int16_t g_ntc_lut_16[257] = {
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240,  -9845,  -9459,  -9103,  -8793,  -8478,
+     -8169,  -7882,  -7628,  -7365,  -7112,  -6869,  -6634,  -6431,
+     -6210,  -5995,  -5787,  -5601,  -5411,  -5217,  -5029,  -4846,
+     -4686,  -4509,  -4338,  -4174,  -4020,  -3865,  -3703,  -3545,
+     -3396,  -3254,  -3111,  -2961,  -2823,  -2687,  -2545,  -2409,
+     -2271,  -2139,  -2013,  -1884,  -1751,  -1625,  -1505,  -1381,
+     -1253,  -1132,  -1007,   -896,   -780,   -655,   -541,   -427,
+      -314,   -194,    -81,     36,    139,    248,    365,    474,
+       580,    688,    801,    909,   1013,   1119,   1223,   1334,
+      1439,   1533,   1645,   1747,   1857,   1959,   2059,   2162,
+      2262,   2370,   2464,   2570,   2671,   2771,   2870,   2971,
+      3069,   3176,   3276,   3373,   3473,   3571,   3678,   3769,
+      3873,   3973,   4071,   4177,   4268,   4373,   4473,   4571,
+      4669,   4768,   4872,   4973,   5071,   5169,   5270,   5368,
+      5475,   5567,   5673,   5774,   5874,   5981,   6075,   6181,
+      6284,   6384,   6485,   6587,   6696,   6799,   6902,   7004,
+      7108,   7217,   7323,   7419,   7532,   7637,   7750,   7857,
+      7961,   8070,   8178,   8293,   8393,   8509,   8621,   8737,
+      8850,   8953,   9073,   9186,   9307,   9413,   9534,   9650,
+      9774,   9893,  10008,  10129,  10255,  10378,  10489,  10621,
+     10745,  10877,  11002,  11129,  11256,  11392,  11530,  11653,
+     11792,  11928,  12070,  12208,  12342,  12484,  12632,  12776,
+     12917,  13068,  13221,  13375,  13516,  13677,  13838,  14000,
+     14167,  14317,  14489,  14662,  14833,  14998,  15180,  15360,
+     15546,  15736,  15915,  16107,  16306,  16508,  16703,  16909,
+     17120,  17343,  17567,  17778,  18009,  18250,  18491,  18723,
+     18980,  19239,  19507,  19780,  20046,  20334,  20630,  20939,
+     21235,  21564,  21892,  22215,  22537,  22828,  23144,  23460,
+     23770,  24054,  24357,  24661,  24958,  25255,  25527,  25818,
+     26108,  26399,  26658,  26943,  27221,  27499,  27777,  28030,
+     28302,  28567,  28839,  29079,  29345,  29604,  29863,  30122,
+     30356
+};
+#else
+/* 每个码值一个点 */
+static const int16_t g_ntc_lut[4096] = {
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240, -10240, -10240, -10240, -10240, -10240,
+    -10240, -10240, -10240,  -9967,  -9936,  -9905,  -9905,  -9875,
+     -9845,  -9816,  -9787,  -9787,  -9759,  -9731,  -9692,  -9663,
+     -9663,  -9634,  -9605,  -9577,  -9550,  -9550,  -9522,  -9495,
+     -9459,  -9431,  -9431,  -9403,  -9376,  -9348,  -9322,  -9322,
+     -9295,  -9269,  -9243,  -9218,  -9218,  -9182,  -9155,  -9129,
+     -9103,  -9103,  -9077,  -9051,  -9026,  -9002,  -9002,  -8977,
+     -8943,  -8918,  -8892,  -8892,  -8867,  -8842,  -8818,  -8793,
+     -8793,  -8769,  -8746,  -8722,  -8690,  -8690,  -8665,  -8641,
+     -8617,  -8593,  -8593,  -8569,  -8546,  -8523,  -8500,  -8500,
+     -8478,  -8455,  -8424,  -8400,  -8400,  -8377,  -8354,  -8331,
+     -8309,  -8309,  -8287,  -8265,  -8243,  -8221,  -8221,  -8200,
+     -8169,  -8146,  -8124,  -8124,  -8102,  -8080,  -8059,  -8038,
+     -8038,  -8016,  -7995,  -7975,  -7954,  -7954,  -7925,  -7903,
+     -7882,  -7861,  -7861,  -7840,  -7819,  -7798,  -7798,  -7778,
+     -7757,  -7737,  -7717,  -7717,  -7698,  -7669,  -7649,  -7628,
+     -7628,  -7608,  -7588,  -7568,  -7548,  -7548,  -7528,  -7509,
+     -7489,  -7470,  -7470,  -7451,  -7432,  -7404,  -7385,  -7385,
+     -7365,  -7345,  -7326,  -7307,  -7307,  -7288,  -7269,  -7250,
+     -7232,  -7232,  -7213,  -7195,  -7177,  -7150,  -7150,  -7131,
+     -7112,  -7093,  -7075,  -7075,  -7056,  -7038,  -7020,  -7002,
+     -7002,  -6984,  -6966,  -6949,  -6931,  -6931,  -6914,  -6887,
+     -6869,  -6851,  -6851,  -6833,  -6815,  -6797,  -6780,  -6780,
+     -6762,  -6745,  -6728,  -6711,  -6711,  -6694,  -6677,  -6660,
+     -6634,  -6634,  -6617,  -6599,  -6582,  -6565,  -6565,  -6548,
+     -6531,  -6514,  -6497,  -6497,  -6480,  -6464,  -6448,  -6431,
+     -6431,  -6415,  -6391,  -6374,  -6357,  -6357,  -6340,  -6323,
+     -6307,  -6290,  -6290,  -6274,  -6258,  -6242,  -6226,  -6226,
+     -6210,  -6194,  -6178,  -6163,  -6163,  -6147,  -6123,  -6107,
+     -6090,  -6090,  -6074,  -6058,  -6042,  -6027,  -6027,  -6011,
+     -5995,  -5980,  -5964,  -5964,  -5949,  -5934,  -5919,  -5904,
+     -5904,  -5889,  -5865,  -5849,  -5849,  -5833,  -5818,  -5803,
+     -5787,  -5787,  -5772,  -5757,  -5742,  -5727,  -5727,  -5712,
+     -5697,  -5682,  -5668,  -5668,  -5653,  -5639,  -5616,  -5601,
+     -5601,  -5586,  -5570,  -5556,  -5541,  -5541,  -5526,  -5511,
+     -5497,  -5482,  -5482,  -5468,  -5453,  -5439,  -5425,  -5425,
+     -5411,  -5397,  -5383,  -5360,  -5360,  -5346,  -5331,  -5316,
+     -5302,  -5302,  -5288,  -5273,  -5259,  -5245,  -5245,  -5231,
+     -5217,  -5203,  -5189,  -5189,  -5175,  -5162,  -5148,  -5135,
+     -5135,  -5121,  -5099,  -5085,  -5071,  -5071,  -5057,  -5043,
+     -5029,  -5015,  -5015,  -5001,  -4988,  -4974,  -4960,  -4960,
+     -4947,  -4934,  -4920,  -4907,  -4907,  -4894,  -4881,  -4868,
+     -4846,  -4846,  -4832,  -4819,  -4805,  -4792,  -4792,  -4778,
+     -4765,  -4751,  -4738,  -4738,  -4725,  -4712,  -4699,  -4686,
+     -4686,  -4673,  -4660,  -4647,  -4634,  -4634,  -4622,  -4609,
+     -4588,  -4575,  -4575,  -4561,  -4548,  -4535,  -4522,  -4522,
+     -4509,  -4496,  -4483,  -4471,  -4471,  -4458,  -4445,  -4433,
+     -4420,  -4420,  -4408,  -4395,  -4383,  -4370,  -4370,  -4358,
+     -4338,  -4325,  -4312,  -4312,  -4299,  -4286,  -4274,  -4274,
+     -4261,  -4249,  -4236,  -4224,  -4224,  -4211,  -4199,  -4187,
+     -4174,  -4174,  -4162,  -4150,  -4138,  -4126,  -4126,  -4114,
+     -4102,  -4082,  -4070,  -4070,  -4057,  -4045,  -4032,  -4020,
+     -4020,  -4008,  -3996,  -3983,  -3971,  -3971,  -3959,  -3947,
+     -3935,  -3923,  -3923,  -3912,  -3900,  -3888,  -3876,  -3876,
+     -3865,  -3853,  -3842,  -3822,  -3822,  -3810,  -3798,  -3786,
+     -3774,  -3774,  -3762,  -3750,  -3738,  -3726,  -3726,  -3714,
+     -3703,  -3691,  -3679,  -3679,  -3668,  -3656,  -3645,  -3633,
+     -3633,  -3622,  -3611,  -3599,  -3588,  -3588,  -3569,  -3557,
+     -3545,  -3534,  -3534,  -3522,  -3510,  -3499,  -3487,  -3487,
+     -3476,  -3464,  -3453,  -3441,  -3441,  -3430,  -3419,  -3408,
+     -3396,  -3396,  -3385,  -3374,  -3363,  -3352,  -3352,  -3341,
+     -3330,  -3311,  -3300,  -3300,  -3288,  -3277,  -3266,  -3254,
+     -3254,  -3243,  -3232,  -3220,  -3209,  -3209,  -3198,  -3187,
+     -3176,  -3165,  -3165,  -3154,  -3143,  -3132,  -3122,  -3122,
+     -3111,  -3100,  -3089,  -3079,  -3079,  -3060,  -3049,  -3038,
+     -3027,  -3027,  -3016,  -3005,  -2994,  -2994,  -2983,  -2972,
+     -2961,  -2950,  -2950,  -2939,  -2929,  -2918,  -2907,  -2907,
+     -2896,  -2886,  -2875,  -2865,  -2865,  -2854,  -2844,  -2833,
+     -2823,  -2823,  -2805,  -2794,  -2783,  -2772,  -2772,  -2762,
+     -2751,  -2740,  -2729,  -2729,  -2719,  -2708,  -2697,  -2687,
+     -2687,  -2676,  -2666,  -2655,  -2645,  -2645,  -2635,  -2624,
+     -2614,  -2604,  -2604,  -2593,  -2583,  -2573,  -2563,  -2563,
+     -2545,  -2534,  -2524,  -2513,  -2513,  -2503,  -2492,  -2482,
+     -2471,  -2471,  -2461,  -2451,  -2440,  -2430,  -2430,  -2420,
+     -2409,  -2399,  -2389,  -2389,  -2379,  -2369,  -2359,  -2349,
+     -2349,  -2339,  -2329,  -2319,  -2309,  -2309,  -2291,  -2281,
+     -2271,  -2260,  -2260,  -2250,  -2240,  -2229,  -2219,  -2219,
+     -2209,  -2199,  -2189,  -2179,  -2179,  -2169,  -2159,  -2149,
+     -2139,  -2139,  -2129,  -2119,  -2109,  -2099,  -2099,  -2089,
+     -2080,  -2070,  -2060,  -2060,  -2051,  -2033,  -2023,  -2013,
+     -2013,  -2003,  -1993,  -1983,  -1973,  -1973,  -1963,  -1953,
+     -1943,  -1933,  -1933,  -1923,  -1913,  -1904,  -1894,  -1894,
+     -1884,  -1874,  -1865,  -1855,  -1855,  -1845,  -1836,  -1826,
+     -1826,  -1817,  -1807,  -1798,  -1781,  -1781,  -1771,  -1761,
+     -1751,  -1741,  -1741,  -1732,  -1722,  -1712,  -1702,  -1702,
+     -1692,  -1683,  -1673,  -1664,  -1664,  -1654,  -1644,  -1635,
+     -1625,  -1625,  -1616,  -1606,  -1597,  -1587,  -1587,  -1578,
+     -1569,  -1559,  -1550,  -1550,  -1541,  -1524,  -1514,  -1505,
+     -1505,  -1495,  -1485,  -1476,  -1466,  -1466,  -1456,  -1447,
+     -1437,  -1428,  -1428,  -1418,  -1409,  -1399,  -1390,  -1390,
+     -1381,  -1371,  -1362,  -1353,  -1353,  -1344,  -1334,  -1325,
+     -1316,  -1316,  -1307,  -1298,  -1289,  -1272,  -1272,  -1263,
+     -1253,  -1244,  -1234,  -1234,  -1225,  -1215,  -1206,  -1197,
+     -1197,  -1187,  -1178,  -1169,  -1159,  -1159,  -1150,  -1141,
+     -1132,  -1123,  -1123,  -1113,  -1104,  -1095,  -1086,  -1086,
+     -1077,  -1068,  -1059,  -1050,  -1050,  -1041,  -1032,  -1016,
+     -1007,  -1007,   -997,   -988,   -979,   -969,   -969,   -960,
+      -951,   -942,   -933,   -933,   -923,   -914,   -905,   -896,
+      -896,   -887,   -878,   -869,   -860,   -860,   -851,   -842,
+      -833,   -824,   -824,   -815,   -807,   -798,   -798,   -789,
+      -780,   -771,   -755,   -755,   -746,   -737,   -728,   -719,
+      -719,   -709,   -700,   -691,   -682,   -682,   -673,   -664,
+      -655,   -646,   -646,   -637,   -629,   -620,   -611,   -611,
+      -602,   -593,   -584,   -576,   -576,   -567,   -558,   -550,
+      -541,   -541,   -532,   -524,   -515,   -499,   -499,   -490,
+      -481,   -472,   -463,   -463,   -454,   -445,   -436,   -427,
+      -427,   -418,   -410,   -401,   -392,   -392,   -383,   -374,
+      -366,   -357,   -357,   -348,   -340,   -331,   -322,   -322,
+      -314,   -305,   -297,   -288,   -288,   -279,   -271,   -263,
+      -247,   -247,   -238,   -229,   -221,   -212,   -212,   -203,
+      -194,   -185,   -176,   -176,   -168,   -159,   -150,   -142,
+      -142,   -133,   -124,   -116,   -107,   -107,    -99,    -90,
+       -81,    -73,    -73,    -65,    -56,    -48,    -39,    -39,
+       -31,    -22,    -14,     -6,     -6,     10,     19,     27,
+        36,     36,     45,     53,     62,     71,     71,     79,
+        88,     97,    105,    105,    114,    122,    131,    139,
+       139,    148,    156,    165,    173,    173,    181,    190,
+       198,    198,    206,    215,    223,    231,    231,    239,
+       248,    263,    272,    272,    280,    289,    297,    306,
+       306,    314,    323,    332,    340,    340,    349,    357,
+       365,    374,    374,    382,    391,    399,    407,    407,
+       416,    424,    432,    441,    441,    449,    457,    465,
+       474,    474,    482,    490,    498,    506,    506,    521,
+       530,    538,    547,    547,    555,    564,    572,    580,
+       580,    589,    597,    606,    614,    614,    622,    631,
+       639,    647,    647,    655,    664,    672,    680,    680,
+       688,    696,    705,    713,    713,    721,    729,    737,
+       745,    745,    753,    761,    776,    784,    784,    793,
+       801,    810,    818,    818,    826,    835,    843,    851,
+       851,    859,    868,    876,    884,    884,    892,    901,
+       909,    917,    917,    925,    933,    941,    949,    949,
+       957,    965,    973,    981,    981,    989,    997,   1005,
+      1013,   1013,   1021,   1036,   1045,   1053,   1053,   1061,
+      1069,   1078,   1086,   1086,   1094,   1102,   1111,   1111,
+      1119,   1127,   1135,   1143,   1143,   1151,   1159,   1167,
+      1175,   1175,   1183,   1191,   1199,   1207,   1207,   1215,
+      1223,   1231,   1239,   1239,   1247,   1255,   1263,   1271,
+      1271,   1279,   1293,   1302,   1310,   1310,   1318,   1326,
+      1334,   1342,   1342,   1351,   1359,   1367,   1375,   1375,
+      1383,   1391,   1399,   1407,   1407,   1415,   1423,   1431,
+      1439,   1439,   1447,   1455,   1463,   1471,   1471,   1479,
+      1486,   1494,   1502,   1502,   1510,   1518,   1526,   1533,
+      1533,   1548,   1556,   1564,   1572,   1572,   1580,   1589,
+      1597,   1605,   1605,   1613,   1621,   1629,   1637,   1637,
+      1645,   1653,   1661,   1669,   1669,   1677,   1684,   1692,
+      1700,   1700,   1708,   1716,   1724,   1732,   1732,   1739,
+      1747,   1755,   1763,   1763,   1770,   1778,   1786,   1800,
+      1800,   1809,   1817,   1825,   1832,   1832,   1841,   1849,
+      1857,   1865,   1865,   1873,   1880,   1889,   1896,   1896,
+      1904,   1912,   1920,   1928,   1928,   1936,   1944,   1952,
+      1959,   1959,   1967,   1975,   1983,   1990,   1990,   1998,
+      2006,   2013,   2013,   2021,   2029,   2037,   2044,   2044,
+      2059,   2066,   2074,   2083,   2083,   2090,   2098,   2106,
+      2114,   2114,   2122,   2130,   2138,   2146,   2146,   2154,
+      2162,   2169,   2177,   2177,   2185,   2193,   2201,   2208,
+      2208,   2216,   2224,   2232,   2239,   2239,   2247,   2255,
+      2262,   2270,   2270,   2278,   2285,   2293,   2301,   2301,
+      2315,   2323,   2331,   2339,   2339,   2347,   2355,   2362,
+      2370,   2370,   2378,   2386,   2394,   2402,   2402,   2410,
+      2417,   2425,   2433,   2433,   2441,   2448,   2456,   2464,
+      2464,   2472,   2479,   2487,   2495,   2495,   2502,   2510,
+      2518,   2525,   2525,   2533,   2540,   2548,   2555,   2555,
+      2570,   2578,   2585,   2593,   2593,   2601,   2609,   2617,
+      2625,   2625,   2633,   2640,   2648,   2656,   2656,   2664,
+      2671,   2679,   2687,   2687,   2695,   2703,   2710,   2718,
+      2718,   2726,   2733,   2741,   2748,   2748,   2756,   2764,
+      2771,   2779,   2779,   2786,   2794,   2802,   2809,   2809,
+      2823,   2831,   2839,   2847,   2847,   2855,   2862,   2870,
+      2870,   2878,   2886,   2893,   2901,   2901,   2909,   2917,
+      2924,   2932,   2932,   2940,   2948,   2955,   2963,   2963,
+      2971,   2978,   2986,   2993,   2993,   3001,   3009,   3016,
+      3024,   3024,   3031,   3039,   3047,   3054,   3054,   3062,
+      3069,   3083,   3091,   3091,   3099,   3106,   3114,   3122,
+      3122,   3130,   3138,   3145,   3153,   3153,   3161,   3169,
+      3176,   3184,   3184,   3192,   3199,   3207,   3215,   3215,
+      3222,   3230,   3238,   3245,   3245,   3253,   3260,   3268,
+      3276,   3276,   3283,   3291,   3298,   3306,   3306,   3313,
+      3320,   3334,   3342,   3342,   3350,   3358,   3365,   3373,
+      3373,   3381,   3389,   3397,   3404,   3404,   3412,   3419,
+      3427,   3435,   3435,   3442,   3450,   3458,   3465,   3465,
+      3473,   3481,   3488,   3496,   3496,   3503,   3511,   3519,
+      3526,   3526,   3534,   3541,   3549,   3556,   3556,   3564,
+      3571,   3579,   3593,   3593,   3600,   3608,   3616,   3624,
+      3624,   3631,   3639,   3647,   3655,   3655,   3662,   3670,
+      3678,   3685,   3685,   3693,   3701,   3708,   3716,   3716,
+      3723,   3731,   3739,   3739,   3746,   3754,   3761,   3769,
+      3769,   3777,   3784,   3792,   3799,   3799,   3806,   3814,
+      3821,   3829,   3829,   3836,   3850,   3858,   3865,   3865,
+      3873,   3881,   3889,   3897,   3897,   3904,   3912,   3920,
+      3927,   3927,   3935,   3943,   3950,   3958,   3958,   3966,
+      3973,   3981,   3989,   3989,   3996,   4003,   4011,   4019,
+      4019,   4026,   4034,   4041,   4049,   4049,   4056,   4064,
+      4071,   4079,   4079,   4086,   4093,   4107,   4115,   4115,
+      4123,   4131,   4138,   4146,   4146,   4154,   4162,   4169,
+      4177,   4177,   4185,   4192,   4200,   4208,   4208,   4215,
+      4223,   4231,   4238,   4238,   4246,   4253,   4261,   4268,
+      4268,   4276,   4284,   4291,   4298,   4298,   4306,   4314,
+      4321,   4328,   4328,   4336,   4343,   4351,   4365,   4365,
+      4373,   4381,   4388,   4396,   4396,   4404,   4411,   4419,
+      4427,   4427,   4434,   4442,   4450,   4457,   4457,   4465,
+      4473,   4481,   4488,   4488,   4496,   4503,   4511,   4518,
+      4518,   4526,   4534,   4541,   4549,   4549,   4556,   4564,
+      4571,   4571,   4579,   4586,   4593,   4601,   4601,   4614,
+      4622,   4630,   4638,   4638,   4645,   4653,   4661,   4669,
+      4669,   4676,   4684,   4692,   4699,   4699,   4707,   4715,
+      4722,   4730,   4730,   4738,   4745,   4753,   4761,   4761,
+      4768,   4775,   4783,   4791,   4791,   4798,   4806,   4813,
+      4821,   4821,   4829,   4836,   4843,   4851,   4851,   4858,
+      4872,   4880,   4888,   4888,   4895,   4903,   4911,   4919,
+      4919,   4926,   4934,   4942,   4950,   4950,   4958,   4965,
+      4973,   4981,   4981,   4988,   4996,   5003,   5011,   5011,
+      5019,   5026,   5034,   5041,   5041,   5049,   5056,   5064,
+      5071,   5071,   5079,   5086,   5094,   5101,   5101,   5109,
+      5116,   5130,   5138,   5138,   5146,   5154,   5161,   5169,
+      5169,   5177,   5185,   5192,   5200,   5200,   5208,   5216,
+      5223,   5231,   5231,   5239,   5247,   5254,   5262,   5262,
+      5270,   5277,   5285,   5292,   5292,   5300,   5308,   5316,
+      5323,   5323,   5330,   5338,   5346,   5353,   5353,   5361,
+      5368,   5376,   5390,   5390,   5397,   5405,   5413,   5420,
+      5420,   5428,   5436,   5444,   5444,   5452,   5460,   5467,
+      5475,   5475,   5483,   5490,   5498,   5506,   5506,   5514,
+      5521,   5529,   5537,   5537,   5544,   5552,   5559,   5567,
+      5567,   5575,   5582,   5590,   5597,   5597,   5605,   5613,
+      5620,   5628,   5628,   5642,   5650,   5657,   5665,   5665,
+      5673,   5681,   5689,   5696,   5696,   5705,   5712,   5720,
+      5728,   5728,   5736,   5743,   5751,   5759,   5759,   5766,
+      5774,   5782,   5789,   5789,   5797,   5805,   5812,   5821,
+      5821,   5828,   5836,   5843,   5851,   5851,   5859,   5866,
+      5874,   5881,   5881,   5894,   5903,   5911,   5919,   5919,
+      5926,   5934,   5942,   5950,   5950,   5958,   5966,   5974,
+      5981,   5981,   5989,   5997,   6004,   6012,   6012,   6020,
+      6028,   6036,   6044,   6044,   6052,   6059,   6067,   6075,
+      6075,   6082,   6090,   6098,   6105,   6105,   6113,   6121,
+      6128,   6136,   6136,   6144,   6158,   6165,   6174,   6174,
+      6181,   6189,   6197,   6205,   6205,   6213,   6221,   6229,
+      6237,   6237,   6244,   6253,   6260,   6268,   6268,   6276,
+      6284,   6291,   6291,   6300,   6307,   6315,   6323,   6323,
+      6331,   6338,   6346,   6354,   6354,   6362,   6369,   6377,
+      6384,   6384,   6392,   6400,   6414,   6422,   6422,   6430,
+      6438,   6446,   6453,   6453,   6461,   6469,   6477,   6485,
+      6485,   6493,   6501,   6509,   6517,   6517,   6525,   6533,
+      6540,   6548,   6548,   6556,   6564,   6572,   6580,   6580,
+      6587,   6595,   6603,   6611,   6611,   6619,   6626,   6634,
+      6642,   6642,   6650,   6663,   6672,   6679,   6679,   6688,
+      6696,   6704,   6712,   6712,   6720,   6728,   6736,   6744,
+      6744,   6751,   6760,   6767,   6776,   6776,   6783,   6792,
+      6799,   6808,   6808,   6815,   6824,   6831,   6839,   6839,
+      6847,   6855,   6862,   6871,   6871,   6878,   6886,   6894,
+      6902,   6902,   6909,   6923,   6932,   6940,   6940,   6948,
+      6956,   6964,   6972,   6972,   6980,   6988,   6996,   7004,
+      7004,   7012,   7020,   7028,   7036,   7036,   7044,   7052,
+      7060,   7068,   7068,   7076,   7084,   7092,   7100,   7100,
+      7108,   7116,   7124,   7132,   7132,   7140,   7148,   7156,
+      7163,   7163,   7177,   7185,   7193,   7193,   7202,   7210,
+      7217,   7226,   7226,   7234,   7242,   7250,   7258,   7258,
+      7267,   7274,   7283,   7291,   7291,   7299,   7307,   7315,
+      7323,   7323,   7331,   7339,   7347,   7355,   7355,   7363,
+      7371,   7379,   7387,   7387,   7395,   7403,   7411,   7419,
+      7419,   7433,   7441,   7449,   7458,   7458,   7466,   7475,
+      7482,   7490,   7490,   7499,   7507,   7515,   7524,   7524,
+      7532,   7539,   7548,   7556,   7556,   7564,   7573,   7581,
+      7588,   7588,   7596,   7605,   7613,   7621,   7621,   7629,
+      7637,   7645,   7653,   7653,   7661,   7669,   7677,   7691,
+      7691,   7699,   7708,   7716,   7725,   7725,   7733,   7742,
+      7750,   7758,   7758,   7766,   7775,   7783,   7791,   7791,
+      7800,   7808,   7816,   7824,   7824,   7832,   7840,   7849,
+      7857,   7857,   7865,   7873,   7882,   7890,   7890,   7897,
+      7906,   7914,   7922,   7922,   7931,   7944,   7952,   7961,
+      7961,   7970,   7978,   7986,   7995,   7995,   8004,   8011,
+      8020,   8029,   8029,   8036,   8045,   8054,   8062,   8062,
+      8070,   8079,   8087,   8087,   8095,   8103,   8112,   8120,
+      8120,   8128,   8137,   8145,   8153,   8153,   8161,   8170,
+      8178,   8186,   8186,   8199,   8208,   8216,   8224,   8224,
+      8233,   8242,   8251,   8259,   8259,   8267,   8276,   8284,
+      8293,   8293,   8301,   8309,   8318,   8326,   8326,   8335,
+      8344,   8352,   8360,   8360,   8368,   8377,   8385,   8393,
+      8393,   8401,   8410,   8419,   8427,   8427,   8435,   8443,
+      8458,   8467,   8467,   8475,   8484,   8492,   8501,   8501,
+      8509,   8519,   8527,   8536,   8536,   8544,   8553,   8561,
+      8570,   8570,   8578,   8587,   8595,   8604,   8604,   8612,
+      8621,   8629,   8637,   8637,   8646,   8654,   8663,   8671,
+      8671,   8680,   8688,   8697,   8711,   8711,   8719,   8728,
+      8737,   8745,   8745,   8754,   8763,   8772,   8780,   8780,
+      8789,   8798,   8807,   8815,   8815,   8823,   8832,   8841,
+      8850,   8850,   8858,   8867,   8876,   8885,   8885,   8892,
+      8901,   8910,   8918,   8918,   8927,   8936,   8944,   8953,
+      8953,   8967,   8975,   8984,   8993,   8993,   9002,   9011,
+      9019,   9028,   9028,   9037,   9046,   9055,   9055,   9063,
+      9073,   9081,   9090,   9090,   9098,   9108,   9116,   9125,
+      9125,   9133,   9143,   9151,   9160,   9160,   9168,   9176,
+      9186,   9194,   9194,   9203,   9211,   9225,   9235,   9235,
+      9243,   9253,   9262,   9270,   9270,   9280,   9288,   9297,
+      9307,   9307,   9315,   9324,   9332,   9342,   9342,   9350,
+      9359,   9368,   9377,   9377,   9386,   9394,   9403,   9413,
+      9413,   9421,   9430,   9438,   9447,   9447,   9457,   9465,
+      9479,   9488,   9488,   9497,   9506,   9515,   9525,   9525,
+      9534,   9543,   9552,   9561,   9561,   9570,   9579,   9588,
+      9597,   9597,   9606,   9615,   9624,   9632,   9632,   9641,
+      9650,   9659,   9668,   9668,   9677,   9686,   9695,   9704,
+      9704,   9713,   9722,   9737,   9746,   9746,   9756,   9765,
+      9774,   9784,   9784,   9792,   9801,   9810,   9820,   9820,
+      9829,   9839,   9848,   9856,   9856,   9865,   9875,   9884,
+      9893,   9893,   9903,   9911,   9920,   9930,   9930,   9939,
+      9947,   9957,   9966,   9966,   9975,   9984,   9998,  10008,
+     10008,  10016,  10026,  10036,  10036,  10046,  10054,  10064,
+     10074,  10074,  10082,  10092,  10101,  10110,  10110,  10120,
+     10129,  10138,  10148,  10148,  10157,  10166,  10175,  10185,
+     10185,  10193,  10203,  10213,  10221,  10221,  10231,  10240,
+     10255,  10264,  10264,  10274,  10283,  10293,  10302,  10302,
+     10312,  10321,  10331,  10340,  10340,  10350,  10359,  10368,
+     10378,  10378,  10387,  10397,  10406,  10414,  10414,  10425,
+     10433,  10444,  10452,  10452,  10461,  10471,  10480,  10489,
+     10489,  10505,  10515,  10524,  10535,  10535,  10544,  10553,
+     10564,  10573,  10573,  10582,  10593,  10602,  10611,  10611,
+     10621,  10631,  10640,  10650,  10650,  10659,  10669,  10679,
+     10688,  10688,  10697,  10707,  10717,  10726,  10726,  10736,
+     10745,  10758,  10768,  10768,  10779,  10789,  10798,  10808,
+     10808,  10818,  10827,  10837,  10846,  10846,  10856,  10867,
+     10877,  10886,  10886,  10896,  10906,  10915,  10925,  10925,
+     10935,  10944,  10954,  10963,  10963,  10973,  10983,  10992,
+     11002,  11002,  11018,  11028,  11038,  11048,  11048,  11058,
+     11068,  11078,  11089,  11089,  11099,  11109,  11119,  11119,
+     11129,  11139,  11147,  11157,  11157,  11167,  11177,  11187,
+     11198,  11198,  11208,  11218,  11226,  11236,  11236,  11246,
+     11256,  11271,  11281,  11281,  11290,  11301,  11311,  11322,
+     11322,  11332,  11343,  11352,  11362,  11362,  11373,  11383,
+     11392,  11403,  11403,  11413,  11424,  11433,  11443,  11443,
+     11454,  11464,  11473,  11484,  11484,  11494,  11503,  11514,
+     11530,  11530,  11539,  11550,  11561,  11570,  11570,  11581,
+     11592,  11601,  11612,  11612,  11623,  11632,  11643,  11653,
+     11653,  11663,  11674,  11684,  11695,  11695,  11704,  11715,
+     11724,  11735,  11735,  11746,  11755,  11766,  11776,  11776,
+     11792,  11801,  11813,  11822,  11822,  11834,  11844,  11855,
+     11865,  11865,  11876,  11886,  11897,  11907,  11907,  11918,
+     11928,  11939,  11949,  11949,  11960,  11970,  11980,  11991,
+     11991,  12001,  12012,  12022,  12032,  12032,  12048,  12058,
+     12070,  12080,  12080,  12090,  12102,  12112,  12122,  12122,
+     12134,  12144,  12156,  12166,  12166,  12176,  12186,  12198,
+     12208,  12208,  12218,  12230,  12240,  12240,  12250,  12262,
+     12272,  12282,  12282,  12298,  12310,  12321,  12331,  12331,
+     12342,  12354,  12365,  12375,  12375,  12386,  12398,  12408,
+     12419,  12419,  12430,  12440,  12452,  12463,  12463,  12473,
+     12484,  12494,  12505,  12505,  12517,  12528,  12538,  12554,
+     12554,  12564,  12575,  12586,  12599,  12599,  12610,  12621,
+     12632,  12643,  12643,  12654,  12665,  12676,  12687,  12687,
+     12697,  12710,  12721,  12732,  12732,  12743,  12754,  12765,
+     12776,  12776,  12787,  12798,  12815,  12826,  12826,  12837,
+     12849,  12860,  12872,  12872,  12883,  12894,  12906,  12917,
+     12917,  12928,  12940,  12951,  12963,  12963,  12974,  12985,
+     12997,  13008,  13008,  13019,  13029,  13040,  13052,  13052,
+     13068,  13080,  13092,  13104,  13104,  13116,  13128,  13140,
+     13149,  13149,  13161,  13173,  13185,  13197,  13197,  13209,
+     13221,  13230,  13242,  13242,  13254,  13266,  13278,  13290,
+     13290,  13300,  13312,  13328,  13340,  13340,  13352,  13363,
+     13375,  13387,  13387,  13400,  13412,  13422,  13434,  13434,
+     13447,  13459,  13469,  13481,  13481,  13494,  13504,  13516,
+     13516,  13529,  13541,  13551,  13563,  13563,  13581,  13592,
+     13605,  13617,  13617,  13630,  13641,  13654,  13666,  13666,
+     13677,  13690,  13702,  13713,  13713,  13726,  13736,  13749,
+     13762,  13762,  13773,  13785,  13798,  13809,  13809,  13821,
+     13838,  13851,  13865,  13865,  13876,  13889,  13900,  13913,
+     13913,  13927,  13938,  13951,  13962,  13962,  13975,  13986,
+     14000,  14011,  14011,  14024,  14037,  14048,  14062,  14062,
+     14073,  14091,  14103,  14116,  14116,  14128,  14142,  14153,
+     14167,  14167,  14179,  14193,  14204,  14216,  14216,  14229,
+     14241,  14255,  14266,  14266,  14280,  14292,  14306,  14317,
+     14317,  14331,  14347,  14359,  14374,  14374,  14386,  14400,
+     14412,  14424,  14424,  14438,  14450,  14465,  14477,  14477,
+     14489,  14503,  14515,  14527,  14527,  14541,  14553,  14565,
+     14580,  14580,  14592,  14610,  14622,  14635,  14635,  14647,
+     14662,  14674,  14687,  14687,  14702,  14714,  14726,  14741,
+     14741,  14754,  14766,  14778,  14793,  14793,  14805,  14818,
+     14833,  14845,  14845,  14864,  14877,  14893,  14893,  14905,
+     14918,  14931,  14947,  14947,  14959,  14972,  14985,  14998,
+     14998,  15013,  15026,  15039,  15052,  15052,  15065,  15080,
+     15093,  15110,  15110,  15124,  15137,  15153,  15166,  15166,
+     15180,  15193,  15207,  15220,  15220,  15234,  15250,  15263,
+     15276,  15276,  15290,  15303,  15317,  15330,  15330,  15343,
+     15360,  15377,  15391,  15391,  15405,  15419,  15433,  15447,
+     15447,  15461,  15474,  15488,  15502,  15502,  15519,  15532,
+     15546,  15560,  15560,  15574,  15588,  15602,  15616,  15616,
+     15636,  15650,  15664,  15679,  15679,  15693,  15708,  15722,
+     15736,  15736,  15751,  15765,  15779,  15794,  15794,  15808,
+     15823,  15837,  15851,  15851,  15866,  15885,  15900,  15915,
+     15915,  15930,  15945,  15960,  15975,  15975,  15990,  16002,
+     16017,  16032,  16032,  16047,  16062,  16077,  16092,  16092,
+     16107,  16122,  16141,  16157,  16157,  16172,  16185,  16200,
+     16216,  16216,  16231,  16247,  16262,  16278,  16278,  16294,
+     16306,  16321,  16337,  16337,  16352,  16368,  16384,  16403,
+     16403,  16416,  16432,  16448,  16464,  16464,  16480,  16492,
+     16508,  16508,  16524,  16540,  16556,  16569,  16569,  16585,
+     16601,  16617,  16633,  16633,  16653,  16669,  16686,  16703,
+     16703,  16719,  16733,  16749,  16766,  16766,  16782,  16796,
+     16812,  16829,  16829,  16842,  16859,  16876,  16892,  16892,
+     16909,  16927,  16944,  16961,  16961,  16975,  16992,  17010,
+     17024,  17024,  17041,  17058,  17072,  17089,  17089,  17107,
+     17120,  17138,  17160,  17160,  17175,  17193,  17211,  17225,
+     17225,  17243,  17261,  17275,  17293,  17293,  17311,  17325,
+     17343,  17361,  17361,  17375,  17393,  17408,  17430,  17430,
+     17448,  17463,  17482,  17497,  17497,  17515,  17534,  17548,
+     17567,  17567,  17582,  17600,  17619,  17634,  17634,  17652,
+     17671,  17690,  17706,  17706,  17725,  17744,  17759,  17778,
+     17778,  17793,  17813,  17828,  17847,  17847,  17862,  17881,
+     17897,  17916,  17916,  17937,  17957,  17973,  17993,  17993,
+     18009,  18029,  18045,  18064,  18064,  18080,  18100,  18116,
+     18136,  18136,  18152,  18172,  18192,  18213,  18213,  18229,
+     18250,  18266,  18287,  18287,  18304,  18320,  18341,  18341,
+     18357,  18378,  18394,  18415,  18415,  18432,  18453,  18474,
+     18491,  18491,  18513,  18530,  18551,  18568,  18568,  18585,
+     18606,  18624,  18641,  18641,  18662,  18679,  18705,  18723,
+     18723,  18740,  18763,  18780,  18798,  18798,  18820,  18838,
+     18860,  18877,  18877,  18895,  18917,  18935,  18957,  18957,
+     18980,  18998,  19017,  19040,  19040,  19058,  19076,  19099,
+     19117,  19117,  19136,  19158,  19177,  19195,  19195,  19216,
+     19239,  19258,  19277,  19277,  19300,  19319,  19338,  19357,
+     19357,  19380,  19399,  19418,  19441,  19441,  19468,  19487,
+     19507,  19531,  19531,  19551,  19570,  19590,  19614,  19614,
+     19633,  19653,  19672,  19692,  19692,  19719,  19739,  19760,
+     19780,  19780,  19805,  19826,  19846,  19866,  19866,  19886,
+     19912,  19932,  19952,  19952,  19978,  19999,  20025,  20046,
+     20046,  20067,  20088,  20109,  20129,  20129,  20156,  20176,
+     20197,  20218,  20218,  20242,  20264,  20291,  20312,  20312,
+     20334,  20356,  20377,  20399,  20399,  20420,  20442,  20469,
+     20496,  20496,  20518,  20541,  20563,  20585,  20585,  20608,
+     20630,  20652,  20652,  20680,  20702,  20724,  20753,  20753,
+     20776,  20800,  20823,  20846,  20846,  20869,  20893,  20916,
+     20939,  20939,  20968,  20992,  21019,  21043,  21043,  21067,
+     21091,  21115,  21139,  21139,  21163,  21187,  21211,  21235,
+     21235,  21263,  21288,  21312,  21337,  21337,  21362,  21386,
+     21411,  21436,  21436,  21460,  21485,  21513,  21538,  21538,
+     21564,  21589,  21614,  21639,  21639,  21665,  21690,  21715,
+     21741,  21741,  21766,  21791,  21816,  21842,  21842,  21867,
+     21892,  21918,  21943,  21943,  21968,  21993,  22019,  22044,
+     22044,  22069,  22095,  22113,  22139,  22139,  22164,  22189,
+     22215,  22240,  22240,  22265,  22290,  22316,  22341,  22341,
+     22366,  22392,  22411,  22436,  22436,  22461,  22486,  22512,
+     22537,  22537,  22562,  22588,  22613,  22638,  22638,  22657,
+     22682,  22708,  22733,  22733,  22758,  22784,  22809,  22828,
+     22828,  22853,  22878,  22904,  22929,  22929,  22954,  22979,
+     22998,  23024,  23024,  23049,  23074,  23100,  23125,  23125,
+     23144,  23169,  23194,  23220,  23220,  23245,  23264,  23289,
+     23289,  23314,  23340,  23365,  23384,  23384,  23409,  23435,
+     23460,  23485,  23485,  23504,  23529,  23555,  23580,  23580,
+     23605,  23624,  23649,  23675,  23675,  23700,  23719,  23744,
+     23770,  23770,  23795,  23814,  23839,  23864,  23864,  23890,
+     23909,  23934,  23959,  23959,  23984,  24003,  24029,  24054,
+     24054,  24079,  24098,  24124,  24149,  24149,  24168,  24193,
+     24218,  24244,  24244,  24263,  24288,  24313,  24332,  24332,
+     24357,  24383,  24402,  24427,  24427,  24452,  24471,  24496,
+     24522,  24522,  24541,  24566,  24591,  24610,  24610,  24636,
+     24661,  24680,  24705,  24705,  24730,  24749,  24775,  24800,
+     24800,  24819,  24844,  24869,  24888,  24888,  24914,  24939,
+     24958,  24983,  24983,  25002,  25027,  25053,  25072,  25072,
+     25097,  25122,  25141,  25167,  25167,  25185,  25211,  25236,
+     25255,  25255,  25280,  25299,  25325,  25350,  25350,  25369,
+     25394,  25413,  25438,  25438,  25464,  25483,  25508,  25527,
+     25527,  25552,  25571,  25596,  25622,  25622,  25641,  25666,
+     25685,  25710,  25710,  25729,  25754,  25773,  25799,  25799,
+     25818,  25843,  25868,  25868,  25887,  25912,  25931,  25957,
+     25957,  25976,  26001,  26020,  26045,  26045,  26064,  26089,
+     26108,  26134,  26134,  26153,  26178,  26197,  26222,  26222,
+     26241,  26266,  26285,  26311,  26311,  26330,  26355,  26374,
+     26399,  26399,  26418,  26443,  26462,  26488,  26488,  26507,
+     26532,  26551,  26576,  26576,  26595,  26614,  26639,  26658,
+     26658,  26684,  26703,  26728,  26747,  26747,  26772,  26791,
+     26810,  26835,  26835,  26854,  26880,  26898,  26924,  26924,
+     26943,  26962,  26987,  27006,  27006,  27031,  27050,  27075,
+     27094,  27094,  27113,  27139,  27158,  27183,  27183,  27202,
+     27221,  27246,  27265,  27265,  27290,  27309,  27328,  27354,
+     27354,  27373,  27392,  27417,  27436,  27436,  27461,  27480,
+     27499,  27524,  27524,  27543,  27562,  27587,  27606,  27606,
+     27632,  27651,  27670,  27695,  27695,  27714,  27733,  27758,
+     27777,  27777,  27796,  27821,  27840,  27859,  27859,  27885,
+     27904,  27922,  27948,  27948,  27967,  27986,  28011,  28030,
+     28030,  28049,  28074,  28093,  28112,  28112,  28131,  28156,
+     28175,  28175,  28194,  28220,  28239,  28257,  28257,  28283,
+     28302,  28321,  28340,  28340,  28365,  28384,  28403,  28428,
+     28428,  28447,  28466,  28485,  28510,  28510,  28529,  28548,
+     28567,  28592,  28592,  28611,  28630,  28649,  28675,  28675,
+     28694,  28713,  28732,  28757,  28757,  28776,  28795,  28814,
+     28839,  28839,  28858,  28877,  28896,  28921,  28921,  28940,
+     28959,  28978,  28997,  28997,  29022,  29041,  29060,  29079,
+     29079,  29104,  29123,  29142,  29161,  29161,  29180,  29206,
+     29225,  29244,  29244,  29263,  29281,  29300,  29326,  29326,
+     29345,  29364,  29383,  29402,  29402,  29427,  29446,  29465,
+     29484,  29484,  29503,  29522,  29547,  29566,  29566,  29585,
+     29604,  29623,  29642,  29642,  29667,  29686,  29705,  29724,
+     29724,  29743,  29762,  29781,  29806,  29806,  29825,  29844,
+     29863,  29882,  29882,  29901,  29920,  29945,  29964,  29964,
+     29983,  30002,  30021,  30040,  30040,  30059,  30078,  30097,
+     30122,  30122,  30141,  30160,  30179,  30198,  30198,  30217,
+     30236,  30255,  30274,  30274,  30293,  30318,  30337,  30356
+};
+#endif
+
+/******************************************************************************/
+int16_t ntc_lut_temp_get (uint16_t code)
+{
+#if ACP1000_TEMP_LUT == 2
+    int32_t t1, t2;
+
+    code &= 0x0FFF;
+    t1 = g_ntc_lut_16[code >> 4];
+    t2 = g_ntc_lut_16[(code >> 4) + 1];
+
+    return t1 + (((t2 - t1) * (int32_t)(code & 0x0F)) >> 4);
+#else
+    return g_ntc_lut[code & 0x0FFF];
+#endif
+}
+
+#endif
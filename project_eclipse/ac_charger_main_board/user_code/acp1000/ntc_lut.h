@@ -0,0 +1,45 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief NTC温度查表（按ADC码值直接索引）
+ *
+ * 表格离线生成： 对每个12位码值按原有算法（码值->mV->阻值->二分查表插值， 见ntc.h）
+ * 计算温度， 因此整表查表与原算法结果完全一致， 16步压缩表在两点间线性插值。
+ * 表格对应 Vref = 3270mV， 分压电阻10K接3300mV， 硬件参数变化时需重新生成
+ * （host/gen_ntc_lut.c）， 并由 host/test_ntc_lut.c 检查。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-09-29  xjc, first implementation
+ * - 1.01 16-10-18  xjc, conversion moved to ntc.c, table generator and host test
+ * \endinternal
+ */
+
+#ifndef __NTC_LUT_H
+#define __NTC_LUT_H
+
+#include "apollo.h"
+#include "ac_charge_prj_cfg.h"
+
+#define NTC_LUT_VREF_MV     3270    /* 生成表格时的ADC参考电压 */
+#define NTC_LUT_BITS        12      /* 生成表格时的ADC位数 */
+
+/**
+ * \brief ADC码值转温度
+ * \param[in] code : 12位ADC码值
+ * \return 温度， 单位1/256℃（与原算法 ntc_res_to_temp() 一致）
+ */
+int16_t ntc_lut_temp_get (uint16_t code);
+
+#endif
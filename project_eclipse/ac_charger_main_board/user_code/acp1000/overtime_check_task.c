@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief ACP1000 Ȩʱ
+ * \brief ACP1000 鉴权超时检测
  *
  * \internal
  * \par modification history:
@@ -22,15 +22,15 @@
 #include "aw_delayed_work.h"
 #include "aw_vdebug.h"
 #include "event_node.h"
-static struct aw_delayed_work g_overtime_check_work; /* Ȩ޲ʱ⹤  */
+static struct aw_delayed_work g_overtime_check_work; /* 鉴权后无操作超时检测工作  */
 /*
- *  ˢ3޿ʼ磨¼Ȩ
- *  óʱӦôڲǹʱ䣬Լȴʱ֮
+ *  刷卡后3分钟无开始充电（会重新鉴权）
+ *  该超时应该大于插枪的最大允许时间，以及等待汽车就绪时间之和
  * */
 #define OVERTIME_NO_OPS         180000
 
 /**
- * Ȩ޲ʱ
+ * 鉴权后无操作超时检测任务
  */
 static void overtime_check_work (void *p_arg)
 {
@@ -40,7 +40,7 @@ static void overtime_check_work (void *p_arg)
 }
 
 /**
-  * \brief ʱ
+  * \brief 重新启动超时检测
   */
 void acp1000_overtime_check_restart()
 {
@@ -49,7 +49,7 @@ void acp1000_overtime_check_restart()
 }
 
 /**
-  * \brief ȡʱ
+  * \brief 取消超时检测
   */
 void acp1000_overtime_check_cancle()
 {
@@ -57,7 +57,7 @@ void acp1000_overtime_check_cancle()
 }
 
 /**
-  * \brief Ȩ޲ʱ
+  * \brief 鉴权后无操作超时检测
   */
 void acp1000_overtime_task_startup (struct event_manager *p_this)
 {
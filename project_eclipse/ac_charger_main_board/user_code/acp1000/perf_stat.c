@@ -0,0 +1,123 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 运行耗时统计
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-12  xjc, first implementation
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include "string.h"
+#include "ac_charge_prj_cfg.h"
+
+#if ACP1000_PERF_STAT
+
+#include "aw_int.h"
+#include "perf_stat.h"
+
+static perf_stat_item_t __g_evt_stat[EVENT_NUMS];
+static perf_stat_item_t __g_pt_stat[PERF_STAT_PT_NUMS];
+
+static const char *__g_pt_name[PERF_STAT_PT_NUMS] = {
+    "history_save",
+    "card_wl_write",
+};
+
+static void __item_add (perf_stat_item_t *p_item, uint32_t stamps)
+{
+    AW_INT_CPU_LOCK_DECL(key);
+
+    AW_INT_CPU_LOCK(key);
+    p_item->cnt++;
+    p_item->sum += stamps;
+    if (stamps > p_item->max) {
+        p_item->max = stamps;
+    }
+    AW_INT_CPU_UNLOCK(key);
+}
+
+static void __item_get (perf_stat_item_t *p_item, perf_stat_item_t *p_out)
+{
+    AW_INT_CPU_LOCK_DECL(key);
+
+    AW_INT_CPU_LOCK(key);
+    *p_out = *p_item;
+    AW_INT_CPU_UNLOCK(key);
+}
+
+void perf_stat_evt_add (event_t event, uint32_t stamps)
+{
+    if ((uint32_t)event < EVENT_NUMS) {
+        __item_add(&__g_evt_stat[event], stamps);
+    }
+}
+
+void perf_stat_pt_add (int id, uint32_t stamps)
+{
+    if ((id >= 0) && (id < PERF_STAT_PT_NUMS)) {
+        __item_add(&__g_pt_stat[id], stamps);
+    }
+}
+
+aw_err_t perf_stat_evt_get (int event, perf_stat_item_t *p_item)
+{
+    if ((event < 0) || (event >= EVENT_NUMS)) {
+        return -AW_EINVAL;
+    }
+    __item_get(&__g_evt_stat[event], p_item);
+    return AW_OK;
+}
+
+aw_err_t perf_stat_pt_get (int id, perf_stat_item_t *p_item)
+{
+    if ((id < 0) || (id >= PERF_STAT_PT_NUMS)) {
+        return -AW_EINVAL;
+    }
+    __item_get(&__g_pt_stat[id], p_item);
+    return AW_OK;
+}
+
+const char *perf_stat_pt_name (int id)
+{
+    if ((id < 0) || (id >= PERF_STAT_PT_NUMS)) {
+        return "?";
+    }
+    return __g_pt_name[id];
+}
+
+uint32_t perf_stat_ns (uint64_t stamps)
+{
+    uint64_t freq = aw_timestamp_freq_get();
+
+    if (0 == freq) {
+        return 0;
+    }
+    return (uint32_t)((stamps / freq) * 1000000000ull +
+                      ((stamps % freq) * 1000000000ull) / freq);
+}
+
+void perf_stat_clr (void)
+{
+    AW_INT_CPU_LOCK_DECL(key);
+
+    AW_INT_CPU_LOCK(key);
+    memset(__g_evt_stat, 0, sizeof(__g_evt_stat));
+    memset(__g_pt_stat,  0, sizeof(__g_pt_stat));
+    AW_INT_CPU_UNLOCK(key);
+}
+
+#endif /* ACP1000_PERF_STAT */
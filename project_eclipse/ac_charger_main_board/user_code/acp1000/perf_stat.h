@@ -0,0 +1,112 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 运行耗时统计
+ *
+ * 以时间戳（aw_timestamp）统计：
+ *  - 每种事件的分发耗时（event_manager 依次调用各节点处理函数的总时间，
+ *    处理函数中再次广播的事件计入外层）；
+ *  - 测量点的耗时（EEPROM/Flash 写入等）。
+ *
+ * 每项记录次数、 累计和最大耗时， 单位为时间戳计数， 显示时换算为 ns。
+ * ACP1000_PERF_STAT 为 0 时埋点宏为空。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-12  xjc, first implementation
+ * \endinternal
+ */
+
+#ifndef __PERF_STAT_H
+#define __PERF_STAT_H
+
+#include "apollo.h"
+#include "aw_timestamp.h"
+#include "event_node.h"
+#include "ac_charge_prj_cfg.h"
+
+/**
+ * \brief 测量点
+ * \anchor grp_perf_stat_pt
+ * @{
+ */
+#define PERF_STAT_HISTORY_SAVE   0  /**< \brief 充电记录保存（EEPROM） */
+#define PERF_STAT_CARD_WL_WRITE  1  /**< \brief 离线卡名单写一页（SPI Flash） */
+#define PERF_STAT_PT_NUMS        2
+/** @} */
+
+/**
+ * 统计项
+ */
+typedef struct perf_stat_item {
+    uint32_t  cnt;      /* 次数 */
+    uint32_t  max;      /* 最大耗时（时间戳计数） */
+    uint64_t  sum;      /* 累计耗时（时间戳计数） */
+}perf_stat_item_t;
+
+#if ACP1000_PERF_STAT
+
+#define PERF_STAT_DECL(t)          uint32_t t
+#define PERF_STAT_BEGIN(t)         ((t) = aw_timestamp_get())
+#define PERF_STAT_EVT_END(evt, t)  perf_stat_evt_add((evt), aw_timestamp_get() - (t))
+#define PERF_STAT_END(id, t)       perf_stat_pt_add((id), aw_timestamp_get() - (t))
+
+#else
+
+#define PERF_STAT_DECL(t)
+#define PERF_STAT_BEGIN(t)
+#define PERF_STAT_EVT_END(evt, t)
+#define PERF_STAT_END(id, t)
+
+#endif
+
+/**
+ * \brief 记录一次事件分发耗时
+ */
+void perf_stat_evt_add (event_t event, uint32_t stamps);
+
+/**
+ * \brief 记录一次测量点耗时
+ * \param[in] id : 测量点 \ref grp_perf_stat_pt
+ */
+void perf_stat_pt_add (int id, uint32_t stamps);
+
+/**
+ * \brief 获取事件分发统计
+ * \return AW_OK： 成功  -AW_EINVAL： 事件无效
+ */
+aw_err_t perf_stat_evt_get (int event, perf_stat_item_t *p_item);
+
+/**
+ * \brief 获取测量点统计
+ * \return AW_OK： 成功  -AW_EINVAL： 测量点无效
+ */
+aw_err_t perf_stat_pt_get (int id, perf_stat_item_t *p_item);
+
+/**
+ * \brief 测量点名字
+ */
+const char *perf_stat_pt_name (int id);
+
+/**
+ * \brief 时间戳计数换算为 ns
+ */
+uint32_t perf_stat_ns (uint64_t stamps);
+
+/**
+ * \brief 清除全部统计
+ */
+void perf_stat_clr (void);
+
+#endif
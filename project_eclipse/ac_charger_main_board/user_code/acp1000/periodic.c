@@ -0,0 +1,225 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 周期作业调度
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-07  xjc, first implementation
+ * - 1.01 16-10-15  xjc, 调度任务登记心跳监视
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include "string.h"
+#include "ac_charge_prj_cfg.h"
+
+#if ACP1000_PERIODIC
+
+#include "aw_task.h"
+#include "aw_system.h"
+#include "periodic.h"
+#include "task_wdt.h"
+
+#define PERIODIC_TASK_PRIO      1
+#define PERIODIC_TACK_SIZE      4096    /* 需满足最深的作业（充电控制） */
+AW_TASK_DECL_STATIC(periodic_task, PERIODIC_TACK_SIZE);
+
+static periodic_job_t *__gp_jobs;
+static uint32_t        __g_slot;          /* 当前时隙 */
+static uint32_t        __g_slot_ticks;    /* 时隙长度（系统节拍） */
+static uint32_t        __g_start_ticks;
+static uint32_t        __g_wakeups;
+static uint32_t        __g_overruns;
+TASK_WDT_DECL(__g_wdt_node);
+
+static uint32_t __ms_to_slots (uint32_t ms)
+{
+    return (ms + ACP1000_PERIODIC_TICK_MS / 2) / ACP1000_PERIODIC_TICK_MS;
+}
+
+/**
+ * \brief 运行到期作业
+ * \return 距下一个作业到期的时隙数
+ */
+static uint32_t __jobs_run (void)
+{
+    periodic_job_t *p_job;
+    uint32_t        left = 0xFFFFFFFF;
+    uint32_t        late;
+    uint32_t        t0, exec;
+
+    for (p_job = __gp_jobs; NULL != p_job; p_job = p_job->p_next) {
+        if ((int32_t)(__g_slot - p_job->due) >= 0) {
+            late = __g_slot - p_job->due;
+            if (late) {
+                p_job->misses++;
+                p_job->skips += late / p_job->period;
+            }
+
+            t0 = aw_sys_tick_get();
+#if ACP1000_TASK_WDT
+            __g_wdt_node.p_where = p_job->name;     /* 互锁时记录所在作业 */
+#endif
+            p_job->pfn_job(p_job->p_arg);
+#if ACP1000_TASK_WDT
+            __g_wdt_node.p_where = NULL;
+#endif
+            exec = aw_ticks_to_ms(aw_sys_tick_get() - t0);
+            if (exec > p_job->exec_max) {
+                p_job->exec_max = exec;
+            }
+            p_job->runs++;
+
+            /* 保持原相位， 错过的周期不补 */
+            p_job->due += p_job->period * (late / p_job->period + 1);
+        }
+        if ((p_job->due - __g_slot) < left) {
+            left = p_job->due - __g_slot;
+        }
+    }
+    return (0xFFFFFFFF == left) ? 1 : left;
+}
+
+static void __task_entry (void *p_arg)
+{
+    uint32_t next = aw_sys_tick_get();      /* 当前时隙的开始时刻 */
+    uint32_t now;
+    uint32_t left;
+
+    while (1) {
+        __g_wakeups++;
+        left  = __jobs_run();
+        TASK_WDT_BEAT(__g_wdt_node);
+
+        /* 直接跳到下一个有作业到期的时隙 */
+        __g_slot += left;
+        next     += left * __g_slot_ticks;
+
+        now = aw_sys_tick_get();
+        if ((int32_t)(next - now) > 0) {
+            aw_task_delay(next - now);
+        } else {
+            /* 本轮运行超过了下一到期时隙， 追到当前时隙， 到期作业计为超时 */
+            __g_overruns++;
+            left      = (now - next) / __g_slot_ticks;
+            __g_slot += left;
+            next     += left * __g_slot_ticks;
+        }
+    }
+}
+
+/******************************************************************************/
+void periodic_job_init (periodic_job_t *p_job,
+                        const char     *name,
+                        void          (*pfn_job) (void *p_arg),
+                        void           *p_arg,
+                        uint32_t        period_ms,
+                        uint32_t        phase_ms,
+                        uint32_t        stack)
+{
+    if (0 == period_ms) {
+        period_ms = ACP1000_PERIODIC_TICK_MS;
+    }
+
+    memset(p_job, 0, sizeof(*p_job));
+    p_job->name      = name;
+    p_job->pfn_job   = pfn_job;
+    p_job->p_arg     = p_arg;
+    p_job->period_ms = period_ms;
+    p_job->period    = __ms_to_slots(period_ms);
+    p_job->due       = __ms_to_slots(phase_ms);
+    p_job->stack     = stack;
+    if (0 == p_job->period) {
+        p_job->period = 1;
+    }
+}
+
+void periodic_job_add (periodic_job_t *p_job)
+{
+    periodic_job_t **pp_job = &__gp_jobs;
+
+    /* 按登记顺序运行 */
+    while (NULL != *pp_job) {
+        pp_job = &(*pp_job)->p_next;
+    }
+    p_job->p_next = NULL;
+    *pp_job       = p_job;
+}
+
+void periodic_startup (void)
+{
+    __g_slot_ticks = aw_ms_to_ticks(ACP1000_PERIODIC_TICK_MS);
+    if (0 == __g_slot_ticks) {
+        __g_slot_ticks = 1;
+    }
+    __g_slot        = 0;
+    __g_start_ticks = aw_sys_tick_get();
+
+#if ACP1000_TASK_WDT
+    {
+        periodic_job_t *p_job;
+        uint32_t        period = 0;
+
+        /* 每次唤醒心跳， 期限按最长的作业周期 */
+        for (p_job = __gp_jobs; NULL != p_job; p_job = p_job->p_next) {
+            if (p_job->period_ms > period) {
+                period = p_job->period_ms;
+            }
+        }
+        TASK_WDT_ADD(__g_wdt_node, "periodic_task", period + TASK_WDT_SLACK_MS);
+    }
+#endif
+
+    AW_TASK_INIT(periodic_task,       /* 任务实体 */
+                 "periodic_task",     /* 任务名字 */
+                 PERIODIC_TASK_PRIO,  /* 任务优先级 */
+                 PERIODIC_TACK_SIZE,  /* 任务堆栈大小 */
+                 __task_entry,        /* 任务入口函数 */
+                 NULL);               /* 任务入口参数 */
+    /* 启动任务 */
+    AW_TASK_STARTUP(periodic_task);
+}
+
+periodic_job_t *periodic_job_get (int idx)
+{
+    periodic_job_t *p_job = __gp_jobs;
+
+    while ((NULL != p_job) && (idx-- > 0)) {
+        p_job = p_job->p_next;
+    }
+    return p_job;
+}
+
+void periodic_stat_get (periodic_stat_t *p_stat)
+{
+    periodic_job_t *p_job;
+    uint32_t        stack = 0;
+
+    memset(p_stat, 0, sizeof(*p_stat));
+    for (p_job = __gp_jobs; NULL != p_job; p_job = p_job->p_next) {
+        p_stat->jobs++;
+        p_stat->task_wakeups_x10 += 10000 / p_job->period_ms;
+        stack                    += p_job->stack;
+    }
+    p_stat->stack_saved = (stack > PERIODIC_TACK_SIZE) ? (stack - PERIODIC_TACK_SIZE) : 0;
+    p_stat->wakeups     = __g_wakeups;
+    p_stat->overruns    = __g_overruns;
+    p_stat->run_ms      = aw_ticks_to_ms(aw_sys_tick_get() - __g_start_ticks);
+    if (p_stat->run_ms) {
+        p_stat->wakeups_x10 = (uint32_t)((uint64_t)p_stat->wakeups * 10000 / p_stat->run_ms);
+    }
+}
+
+#endif /* ACP1000_PERIODIC */
@@ -0,0 +1,108 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 周期作业调度
+ *
+ * 各模块原来各自建任务、 以aw_mdelay循环的短小周期工作登记为作业，
+ * 由一个任务按统一时隙（ACP1000_PERIODIC_TICK_MS）调度：
+ *  - 周期和相位按时隙取整， 同一时隙到期的作业一次唤醒依次运行；
+ *  - 无作业到期的时隙不唤醒；
+ *  - 作业晚于到期时隙运行计为超时， 整周期错过计为丢失， 之后按原相位继续。
+ *
+ * 作业在调度任务中运行， 不能长时间阻塞（串口通信、 等待信号量的工作仍使用独立任务）。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-07  xjc, first implementation
+ * \endinternal
+ */
+
+#ifndef __PERIODIC_H
+#define __PERIODIC_H
+
+#include "apollo.h"
+#include "ac_charge_prj_cfg.h"
+
+/**
+ * 周期作业（由调用者静态分配）
+ */
+typedef struct periodic_job {
+    const char           *name;
+    void                (*pfn_job) (void *p_arg);
+    void                 *p_arg;
+    uint16_t              period_ms;    /* 登记的周期 */
+    uint16_t              period;       /* 周期， 时隙数 */
+    uint32_t              due;          /* 下次到期的时隙 */
+    uint32_t              stack;        /* 原独立任务的堆栈大小（统计用） */
+
+    uint32_t              runs;         /* 运行次数 */
+    uint32_t              misses;       /* 晚于到期时隙运行的次数 */
+    uint32_t              skips;        /* 丢失的周期数 */
+    uint32_t              exec_max;     /* 最长运行时间（ms） */
+
+    struct periodic_job  *p_next;
+}periodic_job_t;
+
+/**
+ * 调度统计
+ */
+typedef struct periodic_stat {
+    uint32_t wakeups;           /* 调度任务唤醒次数 */
+    uint32_t overruns;          /* 一轮作业运行超过下一到期时隙的次数 */
+    uint32_t run_ms;            /* 统计时长 */
+    uint32_t wakeups_x10;       /* 每秒唤醒次数 x10 */
+    uint32_t task_wakeups_x10;  /* 各作业使用独立任务时的每秒唤醒次数 x10（按周期估算） */
+    uint32_t stack_saved;       /* 省去的任务堆栈（字节， 按原任务堆栈大小估算） */
+    uint32_t jobs;
+}periodic_stat_t;
+
+/**
+ * \brief 初始化作业
+ * \param[in] p_job     : 作业
+ * \param[in] name      : 名字
+ * \param[in] pfn_job   : 每周期调用一次的作业函数
+ * \param[in] p_arg     : 作业函数参数
+ * \param[in] period_ms : 周期， 按时隙取整
+ * \param[in] phase_ms  : 首次运行相对调度启动的延时， 用于错开较重的作业
+ * \param[in] stack     : 该工作原使用的任务堆栈大小（仅用于统计）
+ */
+void periodic_job_init (periodic_job_t *p_job,
+                        const char     *name,
+                        void          (*pfn_job) (void *p_arg),
+                        void           *p_arg,
+                        uint32_t        period_ms,
+                        uint32_t        phase_ms,
+                        uint32_t        stack);
+
+/**
+ * \brief 登记作业（在 periodic_startup() 之前调用）
+ */
+void periodic_job_add (periodic_job_t *p_job);
+
+/**
+ * \brief 启动调度任务
+ */
+void periodic_startup (void);
+
+/**
+ * \brief 获取第idx个作业， 不存在时返回NULL
+ */
+periodic_job_t *periodic_job_get (int idx);
+
+/**
+ * \brief 获取调度统计
+ */
+void periodic_stat_get (periodic_stat_t *p_stat);
+
+#endif
@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief ׮ʵ
+ * \brief 桩实例
  *
  * \internal
  * \par modification history:
@@ -34,6 +34,9 @@
 #include "acp1000_dout.h"
 #include "mb/aw_mb_dgus_regmap.h"
 #include "aw_nvram.h"
+#include "periodic.h"
+#include "lat_hist.h"
+#include "task_wdt.h"
 
 #define EVT_TO_PILE(p_this, p_evt) \
     struct pile *p_this = AW_CONTAINER_OF(p_evt, struct pile, evt_node)
@@ -41,8 +44,8 @@
 static void  event_driver(struct event_node *p_evt, event_t event, void *p_arg);
 
 /**
- *  \brief ģʵʼ
- *  param [in]   p_this        : ʵ
+ *  \brief 充电模块实例初始化
+ *  param [in]   p_this        : 整机实例
  *  */
 void pile_inst_init(pile_t *p_this)
 {
@@ -57,7 +60,7 @@ void pile_inst_init(pile_t *p_this)
     AW_SEMB_INIT(p_this->pile_sem.hub4g_cctrl_sem, AW_SEM_EMPTY, AW_SEM_Q_PRIORITY);
     AW_SEMB_INIT(p_this->pile_sem.charge_gun_sem, AW_SEM_EMPTY, AW_SEM_Q_PRIORITY);
 
-    p_this->pile_dat.gun_lock = TRUE; /* ĬϵǹѾס */
+    p_this->pile_dat.gun_lock = TRUE; /* 默认上电枪已经被锁住 */
 
 #if ACP1000_EEPROM_HUB4G_ADDR_GET
     if(AW_OK == aw_nvram_get(ACP1000_EEPROM_NAME, 2, &addr, 0, 1)) {
@@ -204,7 +207,7 @@ static void event_driver(struct event_node *p_evt, event_t event, void *p_arg)
         }
         break;
 
-    /* յ  */
+    /* 接收电表的数据  */
     case AMETER_MEASURE:
         p_ammeter_dat = (ammeter_dat_t *)p_arg;
         pile_dev_lock(p_this);
@@ -257,7 +260,7 @@ static void event_driver(struct event_node *p_evt, event_t event, void *p_arg)
         }
         break;
 
-    case ERR_HUB4G_COMM: /* ͨŹ*/
+    case ERR_HUB4G_COMM: /* 集中器通信故障*/
         if (arg) {
             pile_dev_lock(p_this);
             p_this->pile_alarm.alarm_mask |= PILE_ALARM_HUB4G_COM;
@@ -270,7 +273,7 @@ static void event_driver(struct event_node *p_evt, event_t event, void *p_arg)
             pile_dev_unlock(p_this);
         }
         break;
-    case ERR_HUB4G:   /* 4GͨŹ*/
+    case ERR_HUB4G:   /* 4G通信故障*/
         if (arg) {
             pile_dev_lock(p_this);
             p_this->pile_dat.bg_state |= 0x1;
@@ -296,79 +299,110 @@ static void event_driver(struct event_node *p_evt, event_t event, void *p_arg)
 #define PILE_TASK_PRIO       2
 #define PILE_TACK_SIZE       1024
 #define PILE_DETECT_PERIOD   15
-AW_TASK_DECL_STATIC(pile_task, PILE_TACK_SIZE);
 
 /**
- * ׮쳣
+ * 桩异常检测（每周期执行一次）
  */
-static void pile_task_entry (void *p_arg)
+static void pile_job (void *p_arg)
 {
     pile_t *p_this = (pile_t *)p_arg;
     static  int cnt = 0;
     uint32_t level;
 
-    if (NULL == p_this) {
-        return ;
+    cnt--;
+    if (cnt <= 0) {
+        cnt = 0;
     }
 
-    while (1) {
-
-        cnt--;
-        if (cnt <= 0) {
-            cnt = 0;
-        }
-
 #if ACP1000_SCRAM_DETECT
-        /* ؼ */
-        level = aw_gpio_get(ACP1000_DIN_SCREEM);
-        if (0 == level) {
-           /* ʱһʱ䣬ؼ  */
-           cnt = 30000 / PILE_DETECT_PERIOD;
-           aw_gpio_set(ACP1000_DOUT_AC, FALSE);
-           if (!p_this->pile_dat.scram_state) {
-               p_this->pile_dat.scram_state = TRUE;
-               event_node_tell_all(&p_this->evt_node, ERR_SCRAM, TRUE);
-           }
-        } else {
-           if (cnt == 0) {
-               if (p_this->pile_dat.scram_state) {
-                   p_this->pile_dat.scram_state = FALSE;
-                   //event_node_tell_all(&p_this->evt_node, ERR_SCRAM, FALSE);
-                   //2016.6.21ΣԱΪӲλ¿ʼ
-               }
+    /* 紧急开关检测 */
+    level = aw_gpio_get(ACP1000_DIN_SCREEM);
+    if (0 == level) {
+       /* 延时一段时间，再做紧急开关检测  */
+       cnt = 30000 / PILE_DETECT_PERIOD;
+#if ACP1000_LAT_HIST
+       if (!p_this->pile_dat.scram_state && (0 == aw_gpio_get(ACP1000_DIN_AC1))) {
+           LAT_HIST_START(LAT_HIST_SCRAM_AC);  /* 接触器闭合时计时到反馈断开 */
+       }
+#endif
+       aw_gpio_set(ACP1000_DOUT_AC, FALSE);
+       if (!p_this->pile_dat.scram_state) {
+           p_this->pile_dat.scram_state = TRUE;
+           event_node_tell_all(&p_this->evt_node, ERR_SCRAM, TRUE);
+       }
+    } else {
+       if (cnt == 0) {
+           if (p_this->pile_dat.scram_state) {
+               p_this->pile_dat.scram_state = FALSE;
+               //event_node_tell_all(&p_this->evt_node, ERR_SCRAM, FALSE);
+               //2016.6.21屏蔽，以便人为硬件复位才能重新开始充电
            }
-        }
+       }
+    }
 #endif
 
 #if ACP1000_LIGHT_ERR_DETECT
-        /* ؼ */
-        level = aw_gpio_get(ACP1000_DIN_LIGHT);
-        if (0 == level) {
-            if (!p_this->pile_dat.light_state) {
-               p_this->pile_dat.light_state = TRUE;
-               event_node_tell_all(&p_this->evt_node, ERR_LIGHT, TRUE);
-            }
-        } else {
-            if (p_this->pile_dat.light_state) {
-               p_this->pile_dat.light_state = FALSE;
-               event_node_tell_all(&p_this->evt_node, ERR_LIGHT, FALSE);
-            }
+    /* 防雷器开关检测 */
+    level = aw_gpio_get(ACP1000_DIN_LIGHT);
+    if (0 == level) {
+        if (!p_this->pile_dat.light_state) {
+           p_this->pile_dat.light_state = TRUE;
+           event_node_tell_all(&p_this->evt_node, ERR_LIGHT, TRUE);
+        }
+    } else {
+        if (p_this->pile_dat.light_state) {
+           p_this->pile_dat.light_state = FALSE;
+           event_node_tell_all(&p_this->evt_node, ERR_LIGHT, FALSE);
         }
+    }
 #endif
-    aw_mdelay(PILE_DETECT_PERIOD);
+}
+
+#if ACP1000_PERIODIC
+static periodic_job_t __g_pile_job;
+#else
+AW_TASK_DECL_STATIC(pile_task, PILE_TACK_SIZE);
+TASK_WDT_DECL(__g_pile_wdt);
+
+/**
+ * 桩异常检测任务
+ */
+static void pile_task_entry (void *p_arg)
+{
+    if (NULL == p_arg) {
+        return ;
+    }
+
+    while (1) {
+        TASK_WDT_BEAT(__g_pile_wdt);
+        pile_job(p_arg);
+        aw_mdelay(PILE_DETECT_PERIOD);
     }
 }
+#endif
 
 void pile_task_startup (pile_t *p_this)
 {
-    AW_TASK_INIT(pile_task,           /* ʵ */
-                 "pile_task",         /*  */
-                 PILE_DETECT_PERIOD,  /* ȼ */
-                 PILE_TACK_SIZE,      /* ջС */
-                 pile_task_entry,     /* ں */
-                 (void *)p_this);     /* ڲ */
-    /*  */
+#if ACP1000_PERIODIC
+    periodic_job_init(&__g_pile_job,
+                      "pile",
+                      pile_job,
+                      (void *)p_this,
+                      PILE_DETECT_PERIOD,
+                      0,
+                      PILE_TACK_SIZE);
+    periodic_job_add(&__g_pile_job);
+#else
+    TASK_WDT_ADD(__g_pile_wdt, "pile_task", PILE_DETECT_PERIOD + TASK_WDT_SLACK_MS);
+    AW_TASK_INIT(pile_task,           /* 任务实体 */
+                 "pile_task",         /* 任务名字 */
+                 PILE_DETECT_PERIOD,  /* 任务优先级 */
+                 PILE_TACK_SIZE,      /* 任务堆栈大小 */
+                 pile_task_entry,     /* 任务入口函数 */
+                 (void *)p_this);     /* 任务入口参数 */
+    /* 启动任务 */
     AW_TASK_STARTUP(pile_task);
+#endif
 }
 
 
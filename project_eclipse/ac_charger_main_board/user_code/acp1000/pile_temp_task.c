@@ -13,207 +13,54 @@
 #include "aw_gpio.h"
 #include "event_node.h"
 #include "ac_charge_prj_cfg.h"
+#include "adc_sample.h"
+#include "ntc.h"
+#include "ntc_lut.h"
+#include "thermal.h"
+#include "task_wdt.h"
 
-#define TEMP_MAX      75        /* Ĺ¶ */
-#define TEMP_MIN     -30        /* СĹ¶ */
-
-#define N_SAMPLES    10       //Ϊ10
-#define CHANNEL      0         //תͨΪͨ2
-
-struct adc_state {
-    AW_SEMB_DECL(convert_sem);   /**< ת ź  */
-    int num;                     /**< תɵĲ */
-};
-
-static struct adc_state     g_adc_sta;
-
-static void adc_callback (void *p_arg, int state)
-{
-     int num = (int)p_arg;
-
-     if (state != AW_OK ) {
-         //תʧܣлԶȡٴת
-         //жϼصʱӦþ̣ܶٴ˿ʹźϢ
-         //תʧܵĹ
-         g_adc_sta.num = 2;
-         AW_SEMB_GIVE(g_adc_sta.convert_sem);
-     } else {
-         //תɹ
-         //жϼصʱӦþ̣ܶٴ˿ʹźϢ
-         //ݵĹ
-         g_adc_sta.num = num;
-         AW_SEMB_GIVE(g_adc_sta.convert_sem);
-     }
-}
+#define TEMP_MAX      75        /* 最大的工作温度 */
+#define TEMP_MIN     -30        /* 最小的工作温度 */
 
 /**
- * ȡƽֵ
+ * 测温点配置， 0号为环境温度（发布PILE_TEMP）
+ * 各测温点使用相同型号的NTC及分压电路， 差异通过偏移和增益校准
  */
-static inline uint16_t aver_get(uint16_t *p_buf, uint32_t len)
-{
-    uint32_t m  = 0;
-    uint32_t sum = 0;
-
-    if (0 == len) {
-        return 0;
-    }
-
-    for (m = 0; m < len; m++) {
-        sum += p_buf[m];
-    }
-    sum /= len;
-
-    return sum;
-}
-
-/*******************************************************************************
- *  ȫֱ
-********************************************************************************/
-/**
- * \brief бжӦ¶ֵ-40~85棬1档
- */
-static const uint32_t g_temp_res_val[] = {
-    /* -40~-31 */
-    248277, 233136, 219036, 205897, 193648, 182221, 171556, 161596, 152290, 143590,
-    /* -30~-21 */
-    135452, 127837, 120707, 114028, 107768, 101898, 96391, 91222, 86369, 81809,
-    /* -20~-11 */
-    77523, 73492, 69701, 66132, 62771, 59606, 56623, 53810, 51157, 48654,
-    /* -10~-1 */
-    46290, 44058, 41950, 39957, 38072, 36290, 34603, 33006, 31494, 30062,
-    /* 0~9 */
-    28704, 27417, 26197, 25039, 23940, 22897, 21906, 20964, 20070, 19219,
-    /* 10~19 */
-    18410, 17641, 16909, 16212, 15548, 14916, 14313, 13739, 13192, 12669,
-    /* 20~29 */
-    12171, 11696, 11242, 10809, 10395, 10000, 9622, 9261, 8916, 8585,
-    /* 30~39 */
-    8269, 7967, 7678, 7400, 7135, 6881, 6637, 6403, 6179, 5965,
-    /* 40~49 */
-    5759, 5561, 5372, 5189, 5015, 4847, 4686, 4531, 4382, 4239,
-    /* 50~59 */
-    4101, 3969, 3842, 3719, 3601, 3488, 3379, 3274, 3172, 3075,
-    /* 60~69 */
-    2981, 2890, 2803, 2719, 2638, 2559, 2484, 2411, 2341, 2273,
-    /* 70~79 */
-    2207, 2144, 2083, 2024, 1967, 1912, 1858, 1807, 1757, 1709,
-    /* 80~85 */
-    1662, 1617, 1574, 1532, 1491, 1451
+static const thermal_chan_cfg_t g_thermal_cfg[ACP1000_THERMAL_CHANS] = {
+    /* 名称         通道  偏移  增益   降额  跳闸       过低       回差  温升℃/min */
+    {"ambient",     0,    0,    1024,  65,   TEMP_MAX,  TEMP_MIN,        3,    0},
+    {"socket",      1,    0,    1024,  70,   90,        THERMAL_NO_LOW,  5,    10},
 };
 
-static const int g_res_val_num = sizeof(g_temp_res_val) / sizeof(g_temp_res_val[0]);
-static const int g_temp_start  =  -40;    /* ʼ¶Ϊ-20 */
-
-
-/**
- * \brief ֵ㹫ʽ
- * Rv = (Vref - Vadc) *Rm / Vadc
- * յ·ͼ֪Vref = 3300, Vadc = AD = volɼĵѹλmv
- * Rm = 10000
- * \param[in] adc_handle : ADC׼
- * \return ֵֵ
- */
-static inline uint32_t ntc_res_get(uint32_t vol )
-{
-    return (3300 - vol) * 10000 / vol;
-}
-
 /**
- * \brief ¶1֮ͨ㷨ȡֵ
- *
- * \param[in] t1 : ߽¶
- * \param[in] t1 : ұ߽¶
- *
- * \return temp : ¶ֵ
+ * 温度采样及监测（调试壳读取统计信息）
  */
-static inline int16_t __ntc_temp_get_from_range (int t1,int t2, uint32_t res)
-{
-    int r1 = g_temp_res_val[t1 - g_temp_start];  /* õ¶1Ӧֵ */
-    int r2 = g_temp_res_val[t2 - g_temp_start];  /* õ¶2Ӧֵ */
-
-    int r  = res;
-    int temp;
-
-    /* ΪС2568λ */
-    temp =  (((t2 - t1) * (r - r1)) << 8) / (r2 - r1) + (t1 << 8);
-
-    return temp;
-}
-
-/**
- * \brief ַӦ¶ֵ
- * \param[in]  res : ֵ
- *
- * \return temp: ¶ֵ
- */
-static int16_t ntc_res_to_temp (uint32_t res)
-{
-    int16_t   temp;
-    int low, high, mid;     /* ַ±     */
-    int t1,t2;              /* ¶ֵ t1 ~ t2 */
-
-    low  = 0;               /* ʼϱ߽Ϊһ     */
-    high = g_res_val_num - 1; /* ʼ±߽Ϊһ   */
-
-    while(1) {
-
-        /* һλЧ (low + high)/2 */
-        mid = (low + high) >> 1;
-
-        /* ǡ */
-        if (res == g_temp_res_val[mid]) {
-            /* ¶ֵ256 */
-            temp = (mid + g_temp_start) << 8;
-            break;
-        }
-
-        /* ֵмֵΧΪǰ벿֣highֵ */
-        if (res > g_temp_res_val[mid]) {
-            high = mid;
-        } else {
-            /* ֵСмֵΧΪ벿֣lowֵ */
-            low = mid;
-        }
-
-        /* Χȷ1ڣҵ¶Χ */
-        if (high - low == 1) {
-
-            /* ұ߽¶ֵ */
-            t2 = high + g_temp_start;
-            /* ߽¶ֵ */
-            t1 = low - 1 + g_temp_start;
-            /* ¶ֵ */
-            temp = __ntc_temp_get_from_range(t1, t2, res);
-
-            break;
-        }
-    }
-
-    return temp;
-}
-
+adc_sample_t g_temp_adc[ACP1000_THERMAL_CHANS];
+thermal_t    g_thermal;
 
 /* ========================================================================= */
 #define TEMP_TASK_PRIO       5
 #define TEMP_TACK_SIZE       1024
 #define TEMP_DETECT_PERIOD   15
 AW_TASK_DECL_STATIC(temp_task, TEMP_TACK_SIZE);
+TASK_WDT_DECL(__g_temp_wdt);
 
 /**
- * ¶ȼ
+ * 温度检测任务入口
  */
 static void temp_task_entry(void *p_arg)
 {
     pile_t *p_this = (pile_t *)p_arg;
-    uint16_t  aver = 0;
-
-    uint16_t  adc_val[N_SAMPLES]; // ٶλΪ12λΪuint16_t
+    uint16_t  code = 0;          /* 滤波后的码值 */
     uint32_t  ref_mv;
     uint32_t  sample_mv;
     uint32_t  bits;
-    uint32_t  res;     /* NTCֵ */
-    int16_t   temp;    /* ǰ¶ */
-    aw_err_t  ret;
+    uint32_t  res;     /* NTC阻值 */
+    int16_t   temp;    /* 当前温度， 单位1/256℃ */
+    int       i;
+#if ACP1000_TEMP_LUT
+    bool_t    lut_valid;
+#endif
 
     if (NULL == p_this) {
         return ;
@@ -222,51 +69,61 @@ static void temp_task_entry(void *p_arg)
     aw_gpio_pin_cfg(PIO0_23, PIO0_23_AD0_0 | AW_GPIO_FLOAT | PIO0_23_ADMODE_ANALOG);
     aw_gpio_pin_cfg(PIO0_24, PIO0_24_AD0_1 | AW_GPIO_FLOAT | PIO0_24_ADMODE_ANALOG);
 
-    ref_mv = aw_adc_vref_get(CHANNEL);
-    bits   = aw_adc_bits_get(CHANNEL);
+    ref_mv = aw_adc_vref_get(g_thermal_cfg[0].ch);
+    bits   = aw_adc_bits_get(g_thermal_cfg[0].ch);
+#if ACP1000_TEMP_LUT
+    /* 表格按固定的参考电压和位数生成， 与实际不符时使用计算方式 */
+    lut_valid = (NTC_LUT_VREF_MV == ref_mv) && (NTC_LUT_BITS == bits);
+#endif
     bits = (1 << bits) - 1;
 
+    thermal_init(&g_thermal, g_thermal_cfg);
+    for (i = 0; i < ACP1000_THERMAL_CHANS; i++) {
+        adc_sample_init(&g_temp_adc[i], g_thermal_cfg[i].ch, ACP1000_TEMP_ADC_RATE);
+    }
+
     while (1) {
-           //ͬȡת󷵻
-           ret = aw_adc_sync_read(CHANNEL, adc_val, N_SAMPLES, FALSE);
-           aver = aver_get(adc_val, N_SAMPLES);
-           sample_mv = aver * ref_mv / bits;
-//           AW_INFOF(("sample_mv : %d mv\r\n", sample_mv));
-           res  = ntc_res_get(sample_mv);    /* ȡֵ         */
-//           AW_INFOF(("res : %d m\r\n", res));
-           temp = ntc_res_to_temp(res);      /* ת¶Ȳ   */
-           temp /= 256;
-//           AW_INFOF(("the temperature is %d \r\n", temp));
-           event_node_tell_all(&p_this->evt_node,
-                               PILE_TEMP,
-                               temp);
-#if ACP1000_TEMP_ERR_DETECT
-           if (temp > TEMP_MAX) {
-               event_node_tell_all(&p_this->evt_node,
-                                   ERR_TEMP,
-                                   1);
-           } else if (temp < TEMP_MIN) {
-               event_node_tell_all(&p_this->evt_node,
-                                   ERR_TEMP,
-                                   2);
-           } else {
-               event_node_tell_all(&p_this->evt_node,
-                                   ERR_TEMP,
-                                   0);
-           }
+        TASK_WDT_BEAT(__g_temp_wdt);
+        for (i = 0; i < ACP1000_THERMAL_CHANS; i++) {
+            //采集一块并滤波，失败时本周期不更新该测温点
+            if (AW_OK != adc_sample_get(&g_temp_adc[i], &code, 100)) {
+                continue;
+            }
+#if ACP1000_TEMP_LUT
+            if (lut_valid) {
+                temp = ntc_lut_temp_get(code);    /* 按码值直接查表 */
+            } else
 #endif
-           aw_mdelay(2000);
+            {
+                sample_mv = code * ref_mv / bits;
+                if (0 == sample_mv) {
+                    continue;                     /* 开路 */
+                }
+                res  = ntc_res_get(sample_mv);    /* 计算读取电阻值         */
+                temp = ntc_res_to_temp(res);      /* 将电阻转换成温度参数   */
+            }
+            thermal_chan_update(&g_thermal, i, temp);
+        }
+
+        /* 仅在温度明显变化或状态变化时发布事件 */
+        thermal_publish(&g_thermal, &p_this->evt_node);
+
+        aw_mdelay(ACP1000_THERMAL_PERIOD);
     }
 }
 
 void pile_temp_task_startup (pile_t *p_this)
 {
-    AW_TASK_INIT(temp_task,           /* ʵ */
-                 "temp_task",         /*  */
-                 TEMP_DETECT_PERIOD,  /* ȼ */
-                 TEMP_TACK_SIZE,      /* ջС */
-                 temp_task_entry,     /* ں */
-                 (void *)p_this);     /* ڲ */
-    /*  */
+    /* 每个测温点采样最长等待100ms */
+    TASK_WDT_ADD(__g_temp_wdt,
+                 "temp_task",
+                 ACP1000_THERMAL_PERIOD + ACP1000_THERMAL_CHANS * 100 + TASK_WDT_SLACK_MS);
+    AW_TASK_INIT(temp_task,           /* 任务实体 */
+                 "temp_task",         /* 任务名字 */
+                 TEMP_DETECT_PERIOD,  /* 任务优先级 */
+                 TEMP_TACK_SIZE,      /* 任务堆栈大小 */
+                 temp_task_entry,     /* 任务入口函数 */
+                 (void *)p_this);     /* 任务入口参数 */
+    /* 启动任务 */
     AW_TASK_STARTUP(temp_task);
 }
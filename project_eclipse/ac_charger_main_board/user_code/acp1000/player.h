@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief 
+ * \brief 扮演者类声明
  *
  * \internal
  * \par modification history:
@@ -25,7 +25,7 @@
 #include "apollo.h"
 #include "role.h"
 
-typedef  role_ret (*pfn_play_t)(role_t **pp_role, void *p_arg);  /* ݽӿ */
+typedef  role_ret (*pfn_play_t)(role_t **pp_role, void *p_arg);  /* 扮演接口 */
 
 typedef struct player{
     pfn_play_t pfn_play;
@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief ɫ
+ * \brief 角色类声明
  *
  * \internal
  * \par modification history:
@@ -23,14 +23,14 @@
 #ifndef __ROLE_H
 #define __ROLE_H
 
-typedef uint32_t role_type; /* ɫ */
-typedef uint32_t role_ret;  /* ֵ */
+typedef uint32_t role_type; /* 定义角色类型 */
+typedef uint32_t role_ret;  /* 返回值 */
 
 struct role;
-typedef  role_ret (*pfn_role_do_t)(struct role **pp_this, void *p_arg);  /* ɫ */
+typedef  role_ret (*pfn_role_do_t)(struct role **pp_this, void *p_arg);  /* 角色工作 */
 
 typedef struct role{
-    pfn_role_do_t pfn_role_do;   /* ɫ */
+    pfn_role_do_t pfn_role_do;   /* 角色工作 */
 }role_t;
 
 static inline void role_build (role_t       *p_this,
@@ -0,0 +1,193 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 延迟格式化的日志
+ *
+ * 输出任务从读位置起取已提交的记录： 提交序号等于读位置 + 1 时有效， 复制后再比较
+ * 一次序号， 期间被覆盖的记录计为丢失； 序号仍是上一轮的记录尚未写完， 下次再取。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-17  xjc, first implementation
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include "ac_charge_prj_cfg.h"
+
+#if ACP1000_SLOG
+
+#include "aw_task.h"
+#include "aw_delay.h"
+#include "aw_vdebug.h"
+#include "slog.h"
+
+#define SLOG_TASK_PRIO         6       /* 低于各应用任务 */
+#define SLOG_TACK_SIZE         1024
+#define SLOG_OUT_PERIOD_MS     50      /* 输出周期 */
+AW_TASK_DECL_STATIC(slog_task, SLOG_TACK_SIZE);
+
+slog_ring_t g_slog_ring;
+uint8_t     g_slog_level[SLOG_MOD_NUMS] = {
+    ACP1000_SLOG_LEVEL,
+    ACP1000_SLOG_LEVEL,
+    ACP1000_SLOG_LEVEL,
+    ACP1000_SLOG_LEVEL,
+    ACP1000_SLOG_LEVEL,
+};
+
+static uint32_t __g_tail;               /* 读位置 */
+static uint32_t __g_lost;
+static uint32_t __g_lost_shown;
+
+static const char *__g_mod_name[SLOG_MOD_NUMS] = {
+    "evt",
+    "cp",
+    "charger",
+    "meter",
+    "mb",
+};
+
+static const char *__g_lvl_name[] = {
+    "off",
+    "err",
+    "warn",
+    "info",
+    "dbg",
+};
+
+static void __rec_print (const slog_rec_t *p_rec)
+{
+    uint32_t ms = aw_ticks_to_ms(p_rec->ticks);
+
+    aw_kprintf("[%u.%03u] %s %s: ",
+               ms / 1000,
+               ms % 1000,
+               __g_mod_name[p_rec->mod],
+               __g_lvl_name[p_rec->lvl]);
+    aw_kprintf(p_rec->p_fmt,
+               p_rec->arg[0],
+               p_rec->arg[1],
+               p_rec->arg[2],
+               p_rec->arg[3]);
+    aw_kprintf("\r\n");
+}
+
+/**
+ * \brief 输出已提交的记录
+ */
+static void __flush (void)
+{
+    slog_rec_t *p_rec;
+    slog_rec_t  rec;
+    uint32_t    head;
+    uint32_t    seq;
+
+    while (1) {
+        head = g_slog_ring.head;
+        if (head == __g_tail) {
+            break;
+        }
+        if (head - __g_tail > SLOG_RING_NUMS) {
+            __g_lost += head - __g_tail - SLOG_RING_NUMS;   /* 已被覆盖 */
+            __g_tail  = head - SLOG_RING_NUMS;
+        }
+
+        p_rec = &g_slog_ring.rec[__g_tail & (SLOG_RING_NUMS - 1)];
+        seq   = p_rec->seq;
+        if (seq != __g_tail + 1) {
+            if ((int32_t)(seq - (__g_tail + 1)) < 0) {
+                break;                  /* 尚未写完 */
+            }
+            __g_lost++;                 /* 已被新记录覆盖 */
+            __g_tail++;
+            continue;
+        }
+
+        rec = *p_rec;
+        __sync_synchronize();
+        __g_tail++;
+        if (p_rec->seq != seq) {
+            __g_lost++;                 /* 复制时被覆盖 */
+            continue;
+        }
+        __rec_print(&rec);
+    }
+
+    if (__g_lost != __g_lost_shown) {
+        aw_kprintf("slog: %u lost\r\n", __g_lost - __g_lost_shown);
+        __g_lost_shown = __g_lost;
+    }
+}
+
+static void __task_entry (void *p_arg)
+{
+    while (1) {
+        __flush();
+        aw_mdelay(SLOG_OUT_PERIOD_MS);
+    }
+}
+
+/******************************************************************************/
+void slog_startup (void)
+{
+    AW_TASK_INIT(slog_task,              /* 任务实体 */
+                 "slog_task",            /* 任务名字 */
+                 SLOG_TASK_PRIO,         /* 任务优先级 */
+                 SLOG_TACK_SIZE,         /* 任务堆栈大小 */
+                 __task_entry,           /* 任务入口函数 */
+                 NULL);                  /* 任务入口参数 */
+    AW_TASK_STARTUP(slog_task);
+}
+
+aw_err_t slog_level_set (int mod, int lvl)
+{
+    if ((mod < 0) || (mod >= SLOG_MOD_NUMS) || (lvl < SLOG_OFF) || (lvl > SLOG_DBG)) {
+        return -AW_EINVAL;
+    }
+    g_slog_level[mod] = lvl;
+    return AW_OK;
+}
+
+int slog_level_get (int mod)
+{
+    if ((mod < 0) || (mod >= SLOG_MOD_NUMS)) {
+        return -AW_EINVAL;
+    }
+    return g_slog_level[mod];
+}
+
+const char *slog_mod_name (int mod)
+{
+    if ((mod < 0) || (mod >= SLOG_MOD_NUMS)) {
+        return NULL;
+    }
+    return __g_mod_name[mod];
+}
+
+const char *slog_lvl_name (int lvl)
+{
+    if ((lvl < SLOG_OFF) || (lvl > SLOG_DBG)) {
+        return NULL;
+    }
+    return __g_lvl_name[lvl];
+}
+
+void slog_stat_get (uint32_t *p_written, uint32_t *p_lost)
+{
+    *p_written = g_slog_ring.head;
+    *p_lost    = __g_lost;
+}
+
+#endif /* ACP1000_SLOG */
@@ -0,0 +1,177 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 延迟格式化的日志
+ *
+ * SLOG() 在调用处只比较模块的当前级别， 记下格式串地址（即格式串ID）、 节拍和
+ * 最多4个原始参数， 写入无锁的记录环（原子递增取位置， 写完后置提交序号），
+ * 由低优先级的输出任务格式化后经 aw_kprintf 输出， 调用处不占用格式化的栈和时间。
+ *  - 格式串须为字符串常量， 不带换行（输出时添加）；
+ *  - 参数为不超过32位的整数或指针， %s 只能用于常量字符串（输出时才读取）；
+ *  - 环满时覆盖最旧的记录， 输出任务统计丢失的条数；
+ *  - 各模块的级别可由 slog_level_set() 或 shell 命令 slog 运行时修改。
+ *
+ * ACP1000_SLOG 为 0 时， 不高于 ACP1000_SLOG_LEVEL 的日志直接由 AW_INFOF 输出。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-17  xjc, first implementation
+ * \endinternal
+ */
+
+#ifndef __SLOG_H
+#define __SLOG_H
+
+#include "apollo.h"
+#include "aw_system.h"
+#include "aw_vdebug.h"
+#include "ac_charge_prj_cfg.h"
+
+/**
+ * \brief 模块
+ * @{
+ */
+#define SLOG_MOD_EVT       0    /**< \brief 事件分发 */
+#define SLOG_MOD_CP        1    /**< \brief 检测点1 */
+#define SLOG_MOD_CHARGER   2    /**< \brief 充电控制 */
+#define SLOG_MOD_METER     3    /**< \brief 电表 */
+#define SLOG_MOD_MB        4    /**< \brief Modbus */
+#define SLOG_MOD_NUMS      5
+/** @} */
+
+/**
+ * \brief 级别（模块级别为0时全部关闭）
+ * @{
+ */
+#define SLOG_OFF           0
+#define SLOG_ERR           1
+#define SLOG_WARN          2
+#define SLOG_INFO          3
+#define SLOG_DBG           4
+/** @} */
+
+#define SLOG_RING_NUMS     64   /* 记录环大小（2的幂） */
+#define SLOG_ARG_NUMS      4
+
+/**
+ * 记录
+ */
+typedef struct slog_rec {
+    const char         *p_fmt;          /* 格式串， 兼作ID */
+    uint32_t            ticks;
+    volatile uint32_t   seq;            /* 提交序号（写入位置 + 1）， 写完最后设置 */
+    uint8_t             mod;
+    uint8_t             lvl;
+    uint16_t            reserved;
+    uintptr_t           arg[SLOG_ARG_NUMS];
+}slog_rec_t;
+
+/**
+ * 记录环
+ */
+typedef struct slog_ring {
+    volatile uint32_t   head;           /* 下一个写入位置（不回绕） */
+    slog_rec_t          rec[SLOG_RING_NUMS];
+}slog_ring_t;
+
+#if ACP1000_SLOG
+
+extern slog_ring_t g_slog_ring;
+extern uint8_t     g_slog_level[SLOG_MOD_NUMS];
+
+/**
+ * \brief 记录日志
+ * \param[in] mod : 模块（SLOG_MOD_*）
+ * \param[in] lvl : 级别（SLOG_ERR ~ SLOG_DBG）
+ * \param[in] ... : 格式串及最多4个参数
+ */
+#define SLOG(mod, lvl, ...)                                      \
+    do {                                                         \
+        if ((lvl) <= g_slog_level[(mod)]) {                      \
+            __SLOG_WRITE((mod), (lvl), __VA_ARGS__, 0, 0, 0, 0, 0); \
+        }                                                        \
+    } while (0)
+
+#define __SLOG_WRITE(mod, lvl, p_fmt, a0, a1, a2, a3, ...)       \
+    slog_write((mod), (lvl), (p_fmt),                            \
+               (uintptr_t)(a0), (uintptr_t)(a1),                 \
+               (uintptr_t)(a2), (uintptr_t)(a3))
+
+/**
+ * \brief 写入一条记录（可在任何任务中调用， 不加锁）
+ */
+static inline void slog_write (int         mod,
+                               int         lvl,
+                               const char *p_fmt,
+                               uintptr_t   a0,
+                               uintptr_t   a1,
+                               uintptr_t   a2,
+                               uintptr_t   a3)
+{
+    uint32_t    idx   = __sync_fetch_and_add(&g_slog_ring.head, 1);
+    slog_rec_t *p_rec = &g_slog_ring.rec[idx & (SLOG_RING_NUMS - 1)];
+
+    p_rec->p_fmt  = p_fmt;
+    p_rec->ticks  = aw_sys_tick_get();
+    p_rec->mod    = mod;
+    p_rec->lvl    = lvl;
+    p_rec->arg[0] = a0;
+    p_rec->arg[1] = a1;
+    p_rec->arg[2] = a2;
+    p_rec->arg[3] = a3;
+    __sync_synchronize();
+    p_rec->seq    = idx + 1;
+}
+
+#else
+
+#define SLOG(mod, lvl, fmt, ...)                                 \
+    do {                                                         \
+        if ((lvl) <= ACP1000_SLOG_LEVEL) {                       \
+            AW_INFOF((fmt "\r\n", ##__VA_ARGS__));               \
+        }                                                        \
+    } while (0)
+
+#endif
+
+/**
+ * \brief 启动输出任务
+ */
+void slog_startup (void);
+
+/**
+ * \brief 设置模块的级别
+ * \return AW_OK： 成功  -AW_EINVAL： 模块或级别无效
+ */
+aw_err_t slog_level_set (int mod, int lvl);
+
+/**
+ * \brief 获取模块的级别， 模块无效时返回 -AW_EINVAL
+ */
+int slog_level_get (int mod);
+
+/**
+ * \brief 名字（模块、 级别）， 无效时返回NULL
+ */
+const char *slog_mod_name (int mod);
+const char *slog_lvl_name (int lvl);
+
+/**
+ * \brief 获取统计
+ * \param[out] p_written : 已写入的条数
+ * \param[out] p_lost    : 未输出即被覆盖的条数
+ */
+void slog_stat_get (uint32_t *p_written, uint32_t *p_lost);
+
+#endif
@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief ڣ
+ * \brief 工程入口，启动配置
  *
  * \internal
  * \par modification history:
@@ -37,6 +37,14 @@
 #include "dubug_shell.h"
 #include "aw_vdebug.h"
 #include "amhw_iap.h"
+#include "indicator.h"
+#include "contactor.h"
+#include "periodic.h"
+#include "task_prof.h"
+#include "lat_hist.h"
+#include "task_wdt.h"
+#include "blackbox.h"
+#include "slog.h"
 
 aw_local charger_t      g_charger;
 aw_local dugs_t         g_dugs;
@@ -63,43 +71,43 @@ aw_local modbus_info_t g_hub4g_info = {
 
 
 /**
- * ZLG600A
+ * ZLG600A读卡器传输类
  */
 aw_local aw_iccreader_transfer_t __g_aw_card_reader_transfer_zlg600a = {
-    .uart_num    = ACP1000_CARDREADER_COM,  /* ôں  */
-    .uart_buad   = 57600,                   /* ͨŲ */
-    .uart_format = CLOCAL | CREAD | CS8,    /* ͨŸʽ */
+    .uart_num    = ACP1000_CARDREADER_COM,  /* 设置串口号  */
+    .uart_buad   = 57600,                   /* 设置通信波特率 */
+    .uart_format = CLOCAL | CREAD | CS8,    /* 通信格式 */
     .rs485_en    = FALSE,
 };
 
-/** \brief  */
+/** \brief 周立功读卡器 */
 static aw_iccreader_t __g_aw_card_reader_zlg;
 
 
-/* DL45Эͨŵַ */
+/* DL45协议通信地址 */
 //aw_local uint8_t __g_dl645_addr[6] = {0x11, 0x11, 0x11, 0x11, 0x11, 0x11};
 aw_local uint8_t __g_dl645_addr[6] = {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA};
 
 
-/* DL45ЭͨʵЭ07Լ */
+/* DL45协议通信实例（协议符合07年规约） */
 aw_local aw_ammeter_transfer_dl645_t __g_aw_ammeter_transfer_dl645 = {
     {
         .p_addr   = __g_dl645_addr,
         .addr_len = 6,
         .protocol = AW_AMMETER_TRANSFER_PROTOCOL_DL645_07,
     },
-    .uart_num    = ACP1000_AMMETER_COM,           /* ôں  */
-    .uart_buad   = 2400,                          /* ͨŲ */
-    .uart_format = PARENB | CLOCAL | CREAD | CS8, /* ͨŸʽ, 8E1 */
-    .rs485_en    = TRUE,                          /* ʹRS485 */
+    .uart_num    = ACP1000_AMMETER_COM,           /* 设置串口号  */
+    .uart_buad   = 2400,                          /* 设置通信波特率 */
+    .uart_format = PARENB | CLOCAL | CREAD | CS8, /* 通信格式, 8E1 */
+    .rs485_en    = TRUE,                          /* 使能RS485方向控制 */
 };
 
-/* ֱʵ */
+/* 直流电表实例 */
 aw_local aw_ammeter_dc_t __g_aw_ammeter_dc = {
     {
         .type   = AW_AMMETER_TYPE_DC,
     },
-    .p_transfer    = &(__g_aw_ammeter_transfer_dl645.super), /* ͨ  */
+    .p_transfer    = &(__g_aw_ammeter_transfer_dl645.super), /* 依赖的通信类  */
 };
 
 
@@ -116,9 +124,27 @@ void acp_main_startup (void)
     aw_kprintf ("Software version: V%d.%02d\r\n", ACP1000_VERSION_MAJOR, ACP1000_VERSION_MINOR);
 
 
-    /*-------------------------------ģʼ---------------------------------*/
+#if ACP1000_TASK_PROF
+    /* 须在各模块初始化任务之前 */
+    task_prof_init();
+#endif
+
+#if ACP1000_BLACKBOX
+    /* 取出上次复位前的记录， 须在各模块初始化之前 */
+    blackbox_init();
+#endif
+
+#if ACP1000_TASK_WDT
+    /* 输出上次监视复位的记录 */
+    task_wdt_init();
+#endif
+
+    /*-------------------------------模块初始化---------------------------------*/
     acp1000_din_init();
     acp1000_dout_init();
+#if ACP1000_INDICATOR
+    indicator_init();
+#endif
 
     pile_inst_init(&g_pile);
 
@@ -142,8 +168,12 @@ void acp_main_startup (void)
     ammeter_inst_init(&g_ammeter, &__g_aw_ammeter_dc.super, ACP1000_PILE_MAX_CURR);
 #endif
 
+#if ACP1000_BLACKBOX
+    blackbox_bind(&g_charger, &g_billing, &g_ammeter);
+#endif
+
     if (am_gpio_get(ACP1000_DIN_FAC) == 0) {
-        /* ͵ƽܵ,ΪFALSEĬTRUE */
+        /* 低电平不是能电流检测,为FALSE，默认TRUE */
         g_ammeter.enable_curr_check = FALSE;
     }
 
@@ -156,7 +186,7 @@ void acp_main_startup (void)
     dubug_shell_inst_init(&g_dubug_shell, NULL, &g_billing, &g_charger, &g_dugs, &g_hub4g, &g_pile);
 #endif
 
-    /*-------------------------------¼ע---------------------------------*/
+    /*-------------------------------事件注册---------------------------------*/
     event_manager_init(&g_event_manager);
     event_manager_add(&g_event_manager, &g_charger.evt_node);
 
@@ -182,7 +212,23 @@ void acp_main_startup (void)
     event_manager_add(&g_event_manager, &g_hub4g.evt_node);
 #endif
 
-    /*----------------------------------------------------------------*/
+#if ACP1000_HUB4G_TASK && ACP1000_CARD_WL
+    hub4g_card_wl_sync(&g_hub4g);
+#endif
+
+#if ACP1000_HUB4G_TASK && ACP1000_TASK_PROF && ACP1000_TASK_PROF_MB
+    task_prof_mb_bind(&g_hub4g.super);
+#endif
+
+#if ACP1000_HUB4G_TASK && ACP1000_LAT_HIST && ACP1000_LAT_HIST_MB
+    lat_hist_mb_bind(&g_hub4g.super);
+#endif
+
+#if ACP1000_HUB4G_TASK && ACP1000_BLACKBOX && ACP1000_BLACKBOX_MB
+    blackbox_mb_bind(&g_hub4g.super);
+#endif
+
+    /*-------------------------------任务启动---------------------------------*/
 #if ACP1000_VTP1_DETECT_TASK
     acp1000_tp1_vol_detect_task_startup(&g_charger);
 #endif
@@ -195,6 +241,10 @@ void acp_main_startup (void)
     ammeter_task_startup(&g_ammeter);
 #endif
 
+#if ACP1000_CONTACTOR_MON
+    contactor_task_startup();
+#endif
+
 #if ACP1000_CHARGE_TASK
     charger_task_startup(&g_charger);
 #endif
@@ -223,5 +273,31 @@ void acp_main_startup (void)
     pile_temp_task_startup(&g_pile);
 #endif
 
+#if ACP1000_TASK_PROF
+    task_prof_startup();
+#endif
+
+#if ACP1000_LAT_HIST && ACP1000_LAT_HIST_MB
+    lat_hist_mb_startup();
+#endif
+
+#if ACP1000_BLACKBOX
+    blackbox_startup();
+#endif
+
+#if ACP1000_SLOG
+    slog_startup();
+#endif
+
+#if ACP1000_PERIODIC
+    /* 以上登记的周期作业开始调度 */
+    periodic_startup();
+#endif
+
+#if ACP1000_TASK_WDT
+    /* 各任务已登记心跳， 开始监视喂狗 */
+    task_wdt_startup();
+#endif
+
 
 }
@@ -0,0 +1,352 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 任务运行剖析
+ *
+ * 钩子在任务切入（START_EXEC）时记下时间戳， 切出（STOP_EXEC）时累计到当前
+ * 窗口。 采样每个窗口取走各任务的累计值， 正在运行的任务先结算到采样时刻。
+ * 钩子调用原来的钩子（rtk_cpu_usage 等）， 不影响平台的统计。
+ * 钩子通过 rtk_task_event_default_hook_set() 安装， 只对之后初始化的任务生效。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-13  xjc, first implementation
+ * - 1.01 16-10-18  xjc, only the default hook, task_event_hook_set() is not in
+ *                  the target kernel
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include "string.h"
+#include "ac_charge_prj_cfg.h"
+
+#if ACP1000_TASK_PROF
+
+#include "rtk.h"
+#include "aw_int.h"
+#include "aw_task.h"
+#include "aw_delay.h"
+#include "aw_timestamp.h"
+#include "task_prof.h"
+#if ACP1000_PERIODIC
+#include "periodic.h"
+#endif
+#if ACP1000_TASK_PROF_MB
+#include "mb/ac_modbus_reg_map.h"
+#endif
+
+struct __prof_slot {
+    struct rtk_task       *task;
+    rtk_task_event_hook_t  prev;          /* 原钩子 */
+    uint32_t               start;         /* 本次切入时间戳 */
+    bool_t                 running;
+    bool_t                 dead;
+
+    uint32_t               win_stamps;    /* 本窗口累计运行时间戳 */
+    uint32_t               run_max;       /* 单次最长运行（时间戳） */
+    uint32_t               runs;
+
+    uint32_t               cpu_x10;
+    uint32_t               cpu_peak_x10;
+    uint32_t               stack_total;
+    uint32_t               stack_used;
+};
+
+static struct __prof_slot     __g_slots[TASK_PROF_NUMS];
+static int                    __g_nums;
+static int                    __g_last;          /* 上次命中的槽 */
+static rtk_task_event_hook_t  __g_prev_default;
+static task_prof_stat_t       __g_stat;
+static uint32_t               __g_win_start;
+
+#if ACP1000_TASK_PROF_MB
+static struct modbus_reg_map *__gp_mb_map;
+#endif
+
+static struct __prof_slot *__slot_find (struct rtk_task *task)
+{
+    int i;
+
+    if ((__g_last < __g_nums) && (__g_slots[__g_last].task == task)) {
+        return &__g_slots[__g_last];
+    }
+    for (i = 0; i < __g_nums; i++) {
+        if (__g_slots[i].task == task) {
+            __g_last = i;
+            return &__g_slots[i];
+        }
+    }
+    return NULL;
+}
+
+static struct __prof_slot *__slot_add (struct rtk_task       *task,
+                                       rtk_task_event_hook_t  prev)
+{
+    struct __prof_slot *p_slot = NULL;
+    AW_INT_CPU_LOCK_DECL(key);
+
+    AW_INT_CPU_LOCK(key);
+    if (__g_nums < TASK_PROF_NUMS) {
+        p_slot = &__g_slots[__g_nums];
+        memset(p_slot, 0, sizeof(*p_slot));
+        p_slot->task = task;
+        p_slot->prev = prev;
+        __g_nums++;
+    } else {
+        __g_stat.lost++;
+    }
+    AW_INT_CPU_UNLOCK(key);
+    return p_slot;
+}
+
+static void __task_hook (struct rtk_task *task, int event, va_list va)
+{
+    struct __prof_slot    *p_slot = __slot_find(task);
+    rtk_task_event_hook_t  prev   = __g_prev_default;
+    uint32_t               now;
+    AW_INT_CPU_LOCK_DECL(key);
+
+    switch (event) {
+
+    case RTK_TASK_EVENT_ON_TASK_INIT:
+        if (NULL == p_slot) {
+            p_slot = __slot_add(task, __g_prev_default);
+        }
+        break;
+
+    case RTK_TASK_EVENT_ON_TASK_START_EXEC:
+        if ((NULL == p_slot) && (__g_nums < TASK_PROF_NUMS)) {
+            p_slot = __slot_add(task, __g_prev_default);   /* 未收到初始化事件 */
+        }
+        if (NULL != p_slot) {
+            AW_INT_CPU_LOCK(key);
+            p_slot->start   = aw_timestamp_get();
+            p_slot->running = TRUE;
+            AW_INT_CPU_UNLOCK(key);
+        }
+        break;
+
+    case RTK_TASK_EVENT_ON_TASK_STOP_EXEC:
+        if ((NULL != p_slot) && p_slot->running) {
+            AW_INT_CPU_LOCK(key);
+            now = aw_timestamp_get() - p_slot->start;
+            p_slot->win_stamps += now;
+            if (now > p_slot->run_max) {
+                p_slot->run_max = now;
+            }
+            p_slot->runs++;
+            p_slot->running = FALSE;
+            AW_INT_CPU_UNLOCK(key);
+        }
+        break;
+
+    case RTK_TASK_EVENT_ON_EXIT:
+        if (NULL != p_slot) {
+            p_slot->running = FALSE;
+            p_slot->dead    = TRUE;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    if (NULL != p_slot) {
+        prev = p_slot->prev;
+    }
+    if (NULL != prev) {
+        prev(task, event, va);
+    }
+}
+
+void task_prof_init (void)
+{
+    /* 平台库只提供默认钩子， 调用者（主任务）已初始化， 计入“其它” */
+    __g_prev_default = rtk_task_event_default_hook_set(__task_hook);
+    __g_win_start    = aw_timestamp_get();
+}
+
+#if ACP1000_TASK_PROF_MB
+static void __mb_update (void)
+{
+    struct aw_remote_measure_task_prof *p_reg;
+    struct __prof_slot                 *p_slot;
+    uint32_t                            us;
+    int                                 i, j;
+
+    if (NULL == __gp_mb_map) {
+        return;
+    }
+    p_reg = &__gp_mb_map->rm_measure_reg.task_prof;
+
+    modbus_reg_map_lock(__gp_mb_map);
+    memset(p_reg, 0, sizeof(*p_reg));
+    p_reg->cpu = __g_stat.cpu_x10;
+    for (i = 0; (i < __g_nums) && (i < RM_MEASURE_TASK_PROF_NUMS); i++) {
+        p_slot = &__g_slots[i];
+        for (j = 0; (j < 8) && (NULL != p_slot->task->name) && p_slot->task->name[j]; j++) {
+            p_reg->task[i].name[j >> 1] |= (uint8_t)p_slot->task->name[j] << ((j & 1) ? 0 : 8);
+        }
+        us = aw_timestamps_to_us(p_slot->run_max);
+        p_reg->task[i].cpu         = p_slot->cpu_x10;
+        p_reg->task[i].cpu_peak    = p_slot->cpu_peak_x10;
+        p_reg->task[i].run_max     = (us > 0xFFFF) ? 0xFFFF : us;
+        p_reg->task[i].stack_total = (p_slot->stack_total > 0xFFFF) ? 0xFFFF : p_slot->stack_total;
+        p_reg->task[i].stack_used  = (p_slot->stack_used > 0xFFFF) ? 0xFFFF : p_slot->stack_used;
+    }
+    p_reg->task_nums = i;
+    modbus_reg_map_unlock(__gp_mb_map);
+}
+
+void task_prof_mb_bind (struct modbus_reg_map *p_map)
+{
+    __gp_mb_map = p_map;
+}
+#endif
+
+/**
+ * \brief 结束一个统计窗口
+ */
+static void __sample (void *p_arg)
+{
+    struct __prof_slot *p_slot;
+    uint32_t            now, win, stamps;
+    uint32_t            cpu_sum = 0;
+    unsigned int        total, free;
+    int                 i, nums = __g_nums;
+    AW_INT_CPU_LOCK_DECL(key);
+
+    now           = aw_timestamp_get();
+    win           = now - __g_win_start;
+    __g_win_start = now;
+    if (0 == win) {
+        return;
+    }
+
+    for (i = 0; i < nums; i++) {
+        p_slot = &__g_slots[i];
+
+        AW_INT_CPU_LOCK(key);
+        if (p_slot->running) {             /* 正在运行（至少是采样者自己） */
+            now                 = aw_timestamp_get();
+            p_slot->win_stamps += now - p_slot->start;
+            p_slot->start       = now;
+        }
+        stamps             = p_slot->win_stamps;
+        p_slot->win_stamps = 0;
+        AW_INT_CPU_UNLOCK(key);
+
+        p_slot->cpu_x10 = (uint32_t)(((uint64_t)stamps * 1000 + win / 2) / win);
+        if (p_slot->cpu_x10 > p_slot->cpu_peak_x10) {
+            p_slot->cpu_peak_x10 = p_slot->cpu_x10;
+        }
+        cpu_sum += p_slot->cpu_x10;
+
+        if (!p_slot->dead &&
+            (0 == task_stack_check(p_slot->task, &total, &free)) &&
+            (total >= free)) {
+            p_slot->stack_total = total;
+            if ((total - free) > p_slot->stack_used) {
+                p_slot->stack_used = total - free;
+            }
+        }
+    }
+
+    __g_stat.windows++;
+    __g_stat.cpu_x10 = cpu_sum;
+    __g_stat.tasks   = nums;
+
+#if ACP1000_TASK_PROF_MB
+    __mb_update();
+#endif
+}
+
+#if ACP1000_PERIODIC
+static periodic_job_t __g_task_prof_job;
+#else
+#define TASK_PROF_TASK_PRIO     6       /* 低于各应用任务 */
+#define TASK_PROF_TACK_SIZE     512
+AW_TASK_DECL_STATIC(task_prof_task, TASK_PROF_TACK_SIZE);
+
+static void __task_entry (void *p_arg)
+{
+    while (1) {
+        aw_mdelay(TASK_PROF_PERIOD_MS);
+        __sample(p_arg);
+    }
+}
+#endif
+
+void task_prof_startup (void)
+{
+#if ACP1000_PERIODIC
+    periodic_job_init(&__g_task_prof_job,
+                      "task_prof",
+                      __sample,
+                      NULL,
+                      TASK_PROF_PERIOD_MS,
+                      TASK_PROF_PERIOD_MS,    /* 第一个窗口也为完整周期 */
+                      0);
+    periodic_job_add(&__g_task_prof_job);
+#else
+    AW_TASK_INIT(task_prof_task,         /* 任务实体 */
+                 "task_prof_task",       /* 任务名字 */
+                 TASK_PROF_TASK_PRIO,    /* 任务优先级 */
+                 TASK_PROF_TACK_SIZE,    /* 任务堆栈大小 */
+                 __task_entry,           /* 任务入口函数 */
+                 NULL);                  /* 任务入口参数 */
+    AW_TASK_STARTUP(task_prof_task);
+#endif
+}
+
+aw_err_t task_prof_get (int idx, task_prof_info_t *p_info)
+{
+    struct __prof_slot *p_slot;
+
+    if ((idx < 0) || (idx >= __g_nums)) {
+        return -AW_EINVAL;
+    }
+    p_slot = &__g_slots[idx];
+
+    p_info->name         = p_slot->task->name ? p_slot->task->name : "?";
+    p_info->prio         = p_slot->task->current_priority;
+    p_info->cpu_x10      = p_slot->cpu_x10;
+    p_info->cpu_peak_x10 = p_slot->cpu_peak_x10;
+    p_info->runs         = p_slot->runs;
+    p_info->run_max_us   = aw_timestamps_to_us(p_slot->run_max);
+    p_info->stack_total  = p_slot->stack_total;
+    p_info->stack_used   = p_slot->stack_used;
+    return AW_OK;
+}
+
+void task_prof_stat_get (task_prof_stat_t *p_stat)
+{
+    *p_stat = __g_stat;
+}
+
+void task_prof_clr (void)
+{
+    int i;
+    AW_INT_CPU_LOCK_DECL(key);
+
+    AW_INT_CPU_LOCK(key);
+    for (i = 0; i < __g_nums; i++) {
+        __g_slots[i].run_max      = 0;
+        __g_slots[i].runs         = 0;
+        __g_slots[i].cpu_peak_x10 = 0;
+    }
+    AW_INT_CPU_UNLOCK(key);
+}
+
+#endif /* ACP1000_TASK_PROF */
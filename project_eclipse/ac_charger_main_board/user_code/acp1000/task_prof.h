@@ -0,0 +1,100 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 任务运行剖析
+ *
+ * 通过 rtk 任务事件钩子记录每个任务每次被调度运行的时间：
+ *  - 每个统计窗口（1s）的 CPU 占用及其峰值；
+ *  - 单次运行（从切入到切出）的最长时间；
+ *  - 堆栈高水位（task_stack_check， 每窗口检查一次）。
+ *
+ * 只统计 task_prof_init() 之后初始化的任务， 之前由平台创建的任务（shell 等）、
+ * 调用 task_prof_init() 的主任务和空闲任务计入“其它”。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-13  xjc, first implementation
+ * - 1.01 16-10-18  xjc, the calling task is no longer profiled
+ * \endinternal
+ */
+
+#ifndef __TASK_PROF_H
+#define __TASK_PROF_H
+
+#include "apollo.h"
+#include "ac_charge_prj_cfg.h"
+
+#define TASK_PROF_NUMS        24      /* 最多统计的任务数 */
+#define TASK_PROF_PERIOD_MS   1000    /* 统计窗口 */
+
+/**
+ * 任务统计
+ */
+typedef struct task_prof_info {
+    const char *name;
+    uint32_t    prio;
+    uint32_t    cpu_x10;        /* 上一窗口 CPU 占用（0.1%） */
+    uint32_t    cpu_peak_x10;   /* 窗口 CPU 占用峰值（0.1%） */
+    uint32_t    runs;           /* 运行次数 */
+    uint32_t    run_max_us;     /* 单次运行最长时间（us） */
+    uint32_t    stack_total;    /* 堆栈大小（字节） */
+    uint32_t    stack_used;     /* 堆栈高水位（字节） */
+}task_prof_info_t;
+
+/**
+ * 整体统计
+ */
+typedef struct task_prof_stat {
+    uint32_t windows;           /* 已统计的窗口数 */
+    uint32_t cpu_x10;           /* 上一窗口被统计任务的 CPU 占用之和（0.1%） */
+    uint32_t tasks;             /* 被统计的任务数 */
+    uint32_t lost;              /* 表满未能统计的任务数 */
+}task_prof_stat_t;
+
+/**
+ * \brief 安装任务事件钩子， 须在各模块初始化任务之前调用
+ */
+void task_prof_init (void);
+
+/**
+ * \brief 启动周期采样（ACP1000_PERIODIC 时为周期作业， 否则为独立任务）
+ */
+void task_prof_startup (void);
+
+/**
+ * \brief 获取第idx个任务的统计
+ * \return AW_OK： 成功  -AW_EINVAL： 不存在
+ */
+aw_err_t task_prof_get (int idx, task_prof_info_t *p_info);
+
+/**
+ * \brief 获取整体统计
+ */
+void task_prof_stat_get (task_prof_stat_t *p_stat);
+
+/**
+ * \brief 清除峰值、 最长运行时间及运行次数（堆栈高水位保留）
+ */
+void task_prof_clr (void);
+
+#if ACP1000_TASK_PROF_MB
+struct modbus_reg_map;
+
+/**
+ * \brief 绑定Modbus寄存器表， 每个窗口更新遥测的任务剖析寄存器
+ */
+void task_prof_mb_bind (struct modbus_reg_map *p_map);
+#endif
+
+#endif
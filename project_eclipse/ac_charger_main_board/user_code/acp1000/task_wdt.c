@@ -0,0 +1,230 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 任务心跳监视
+ *
+ * 监视任务的优先级高于各应用任务， 应用任务互锁或被饿死都能检出。 超时记录
+ * 放在 .noinit 段（启动代码不清零）， 以魔数和校验判断是否有效。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-15  xjc, first implementation
+ * - 1.01 16-10-16  xjc, 超时时记录黑匣子
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include "string.h"
+#include "stddef.h"
+#include "ac_charge_prj_cfg.h"
+
+#if ACP1000_TASK_WDT
+
+#include "aw_int.h"
+#include "aw_task.h"
+#include "aw_delay.h"
+#include "aw_wdt.h"
+#include "aw_vdebug.h"
+#include "task_wdt.h"
+#include "blackbox.h"
+
+#define TASK_WDT_TASK_PRIO     0       /* 高于各应用任务 */
+#define TASK_WDT_TACK_SIZE     1024
+AW_TASK_DECL_STATIC(task_wdt_task, TASK_WDT_TACK_SIZE);
+
+#define __NOINIT_MAGIC         0x57445431   /* "WDT1" */
+
+/* 复位后保留的记录 */
+struct __wdt_noinit {
+    uint32_t        magic;
+    uint32_t        pending;        /* 已记录超时， 尚未在上电时取走 */
+    task_wdt_rec_t  rec;
+    uint32_t        check;
+};
+
+static struct __wdt_noinit  __g_noinit __attribute__((section(".noinit")));
+
+static task_wdt_node_t     *__gp_nodes;
+static struct awbl_wdt      __g_wdt;
+static bool_t               __g_tripped;
+static task_wdt_rec_t       __g_last;
+static bool_t               __g_last_valid;
+
+static uint32_t __noinit_check (void)
+{
+    const uint32_t *p   = (const uint32_t *)&__g_noinit;
+    uint32_t        sum = 0x5AA5C33C;
+    int             i;
+
+    for (i = 0; i < (int)(offsetof(struct __wdt_noinit, check) / 4); i++) {
+        sum = (sum << 1 | sum >> 31) ^ p[i];
+    }
+    return sum;
+}
+
+static void __name_copy (char *p_dst, const char *p_src, int size)
+{
+    if (NULL == p_src) {
+        p_src = "";
+    }
+    strncpy(p_dst, p_src, size - 1);
+    p_dst[size - 1] = '\0';
+}
+
+/**
+ * \brief 检查一次
+ * \return TRUE： 全部任务在期限内
+ */
+static bool_t __check (void)
+{
+    task_wdt_node_t *p_node;
+    task_wdt_node_t *p_worst = NULL;
+    uint32_t         now     = aw_sys_tick_get();
+    uint32_t         age, over;
+    uint32_t         worst   = 0;
+    const char      *p_where = NULL;
+
+    for (p_node = __gp_nodes; NULL != p_node; p_node = p_node->p_next) {
+        age = now - p_node->last_ticks;
+        age = ((int32_t)age > 0) ? aw_ticks_to_ms(age) : 0;
+        if (age > p_node->age_max_ms) {
+            p_node->age_max_ms = age;
+        }
+        if (age > p_node->deadline_ms) {
+            over = age - p_node->deadline_ms;
+            if ((NULL == p_worst) || (over > worst)) {
+                p_worst = p_node;
+                worst   = over;
+                p_where = p_node->p_where;
+            }
+        }
+    }
+
+    if (NULL == p_worst) {
+        return TRUE;
+    }
+
+    __g_noinit.pending = TRUE;
+    __g_noinit.rec.resets++;
+    __name_copy(__g_noinit.rec.name, p_worst->name, sizeof(__g_noinit.rec.name));
+    __name_copy(__g_noinit.rec.where, p_where, sizeof(__g_noinit.rec.where));
+    __g_noinit.rec.deadline_ms = p_worst->deadline_ms;
+    __g_noinit.rec.overrun_ms  = worst;
+    __g_noinit.rec.uptime_s    = aw_ticks_to_ms(now) / 1000;
+    __g_noinit.check           = __noinit_check();
+
+#if ACP1000_BLACKBOX
+    blackbox_snap(BLACKBOX_CAUSE_TASK_WDT, __g_noinit.rec.name);
+#endif
+
+    aw_kprintf("task_wdt: %s missed %u ms deadline by %u ms (in %s), stop feeding\r\n",
+               __g_noinit.rec.name,
+               __g_noinit.rec.deadline_ms,
+               __g_noinit.rec.overrun_ms,
+               __g_noinit.rec.where[0] ? __g_noinit.rec.where : "-");
+    return FALSE;
+}
+
+static void __task_entry (void *p_arg)
+{
+    while (1) {
+        aw_mdelay(TASK_WDT_CHECK_MS);
+        if (__g_tripped) {
+            continue;                   /* 等待看门狗复位 */
+        }
+        if (__check()) {
+            aw_wdt_feed(&__g_wdt);
+        } else {
+            __g_tripped = TRUE;
+        }
+    }
+}
+
+/******************************************************************************/
+void task_wdt_init (void)
+{
+    if ((__NOINIT_MAGIC != __g_noinit.magic) ||
+        (__noinit_check() != __g_noinit.check)) {
+        memset(&__g_noinit, 0, sizeof(__g_noinit));     /* 上电或记录损坏 */
+        __g_noinit.magic = __NOINIT_MAGIC;
+    } else if (__g_noinit.pending) {
+        __g_last       = __g_noinit.rec;
+        __g_last_valid = TRUE;
+        aw_kprintf("task_wdt: last reset by %s, %u ms over %u ms deadline (in %s), uptime %u s, resets %u\r\n",
+                   __g_last.name,
+                   __g_last.overrun_ms,
+                   __g_last.deadline_ms,
+                   __g_last.where[0] ? __g_last.where : "-",
+                   __g_last.uptime_s,
+                   __g_last.resets);
+    }
+    __g_noinit.pending = FALSE;
+    __g_noinit.check   = __noinit_check();
+}
+
+void task_wdt_add (task_wdt_node_t *p_node, const char *name, uint32_t deadline_ms)
+{
+    AW_INT_CPU_LOCK_DECL(key);
+
+    memset(p_node, 0, sizeof(*p_node));
+    p_node->name        = name;
+    p_node->deadline_ms = deadline_ms;
+    p_node->last_ticks  = aw_sys_tick_get();
+
+    AW_INT_CPU_LOCK(key);
+    p_node->p_next = __gp_nodes;
+    __gp_nodes     = p_node;
+    AW_INT_CPU_UNLOCK(key);
+}
+
+void task_wdt_startup (void)
+{
+    task_wdt_node_t *p_node;
+    uint32_t         wdt_ms = TASK_WDT_CHECK_MS * 2;
+
+    for (p_node = __gp_nodes; NULL != p_node; p_node = p_node->p_next) {
+        if (p_node->deadline_ms > wdt_ms) {
+            wdt_ms = p_node->deadline_ms;
+        }
+    }
+    aw_wdt_add(&__g_wdt, wdt_ms);
+
+    AW_TASK_INIT(task_wdt_task,          /* 任务实体 */
+                 "task_wdt_task",        /* 任务名字 */
+                 TASK_WDT_TASK_PRIO,     /* 任务优先级 */
+                 TASK_WDT_TACK_SIZE,     /* 任务堆栈大小 */
+                 __task_entry,           /* 任务入口函数 */
+                 NULL);                  /* 任务入口参数 */
+    AW_TASK_STARTUP(task_wdt_task);
+}
+
+task_wdt_node_t *task_wdt_node_get (int idx)
+{
+    task_wdt_node_t *p_node = __gp_nodes;
+
+    while ((NULL != p_node) && (idx-- > 0)) {
+        p_node = p_node->p_next;
+    }
+    return p_node;
+}
+
+bool_t task_wdt_last_get (task_wdt_rec_t *p_rec)
+{
+    if (__g_last_valid) {
+        *p_rec = __g_last;
+    }
+    return __g_last_valid;
+}
+
+#endif /* ACP1000_TASK_WDT */
@@ -0,0 +1,116 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 任务心跳监视
+ *
+ * 各周期性任务登记心跳期限， 每轮循环调用 TASK_WDT_BEAT()。 监视任务每
+ * TASK_WDT_CHECK_MS 检查一次， 全部任务在期限内有心跳时才喂看门狗（aw_wdt），
+ * 否则记下超时最多的任务及超出的时间（保存在复位不清除的RAM中， 下次上电
+ * 输出）， 停止喂狗， 由看门狗复位。
+ *  - 任务停止心跳后最迟在 期限 + TASK_WDT_CHECK_MS 内检出；
+ *  - 看门狗时间取登记的最大期限， 监视任务本身停止时也在该时间内复位。
+ *
+ * 心跳只是一次节拍计数的写入， 可在任何任务中调用。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-10-15  xjc, first implementation
+ * \endinternal
+ */
+
+#ifndef __TASK_WDT_H
+#define __TASK_WDT_H
+
+#include "apollo.h"
+#include "aw_system.h"
+#include "ac_charge_prj_cfg.h"
+
+#define TASK_WDT_CHECK_MS     100     /* 检查周期 */
+#define TASK_WDT_SLACK_MS     1000    /* 周期之外允许的阻塞时间（锁等待、 EEPROM写入等） */
+
+/**
+ * 被监视的任务（由调用者静态分配）
+ */
+typedef struct task_wdt_node {
+    const char             *name;
+    uint32_t                deadline_ms;  /* 两次心跳的最长间隔 */
+    volatile uint32_t       last_ticks;   /* 最近一次心跳 */
+    const char *volatile    p_where;      /* 正在执行的工作（可选， 如周期调度的作业名） */
+    uint32_t                age_max_ms;   /* 检查时见到的最长心跳间隔 */
+    struct task_wdt_node   *p_next;
+}task_wdt_node_t;
+
+/**
+ * 超时记录
+ */
+typedef struct task_wdt_rec {
+    char     name[16];          /* 超时的任务 */
+    char     where[16];         /* 超时时正在执行的工作 */
+    uint32_t deadline_ms;
+    uint32_t overrun_ms;        /* 检出时超出期限的时间 */
+    uint32_t uptime_s;          /* 检出时的运行时间 */
+    uint32_t resets;            /* 累计监视复位次数 */
+}task_wdt_rec_t;
+
+#if ACP1000_TASK_WDT
+
+#define TASK_WDT_DECL(node)              static task_wdt_node_t node
+#define TASK_WDT_ADD(node, name, ms)     task_wdt_add(&(node), (name), (ms))
+#define TASK_WDT_BEAT(node)              task_wdt_beat(&(node))
+
+#else
+
+#define TASK_WDT_DECL(node)
+#define TASK_WDT_ADD(node, name, ms)
+#define TASK_WDT_BEAT(node)
+
+#endif
+
+/**
+ * \brief 心跳
+ */
+static inline void task_wdt_beat (task_wdt_node_t *p_node)
+{
+    p_node->last_ticks = aw_sys_tick_get();
+}
+
+/**
+ * \brief 检查上次的监视复位记录， 在 acp_main_startup() 开始时调用
+ */
+void task_wdt_init (void);
+
+/**
+ * \brief 登记被监视的任务， 登记时视为有一次心跳
+ * \param[in] deadline_ms : 两次心跳的最长间隔
+ * \note 看门狗时间在 task_wdt_startup() 时按已登记的最大期限确定
+ */
+void task_wdt_add (task_wdt_node_t *p_node, const char *name, uint32_t deadline_ms);
+
+/**
+ * \brief 启动监视任务并开始喂狗（在各任务启动之后调用）
+ */
+void task_wdt_startup (void);
+
+/**
+ * \brief 获取第idx个被监视的任务， 不存在时返回NULL
+ */
+task_wdt_node_t *task_wdt_node_get (int idx);
+
+/**
+ * \brief 获取上次监视复位的记录
+ * \return TRUE： 上次复位由监视引起  FALSE： 无
+ */
+bool_t task_wdt_last_get (task_wdt_rec_t *p_rec);
+
+#endif
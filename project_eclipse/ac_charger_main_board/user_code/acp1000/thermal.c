@@ -0,0 +1,223 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 多通道温度监测（校准、回差、温升速率、降额）
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-09-30  xjc, first implementation
+ * \endinternal
+ */
+
+#include "apollo.h"
+#include "string.h"
+#include "thermal.h"
+
+#define __DEG(t)        ((int32_t)(t) << 8)             /* ℃ 转 1/256℃ */
+#define __MAX_CURR      (ACP1000_PILE_MAX_CURR / 10)    /* 单位0.01A */
+#define __MIN_CURR      ACP1000_LOAD_MIN_CURR
+
+/* 回差已在发布前处理， 整度变化即发布 */
+static const evt_pub_field_t __g_temp_pub_field = {0, sizeof(int32_t), TRUE, 0};
+
+static int16_t __clamp16 (int32_t v)
+{
+    if (v > 32767) {
+        return 32767;
+    }
+    if (v < -32768) {
+        return -32768;
+    }
+    return (int16_t)v;
+}
+
+static int32_t __abs32 (int32_t v)
+{
+    return (v < 0) ? -v : v;
+}
+
+/**
+ * 温升速率： 最新点与最早点之差换算为每分钟
+ */
+static void __ror_update (thermal_chan_t *p_chan)
+{
+    int32_t oldest;
+
+    p_chan->hist[p_chan->hist_pos] = p_chan->temp;
+    p_chan->hist_pos = (p_chan->hist_pos + 1) % THERMAL_ROR_NUMS;
+    if (p_chan->hist_nums < THERMAL_ROR_NUMS) {
+        p_chan->hist_nums++;
+    }
+    if (p_chan->hist_nums < THERMAL_ROR_NUMS) {
+        /* 历史不足时不判断， 避免上电时误报 */
+        p_chan->ror = 0;
+        return;
+    }
+
+    /* 写满后hist_pos指向最早的点 */
+    oldest      = p_chan->hist[p_chan->hist_pos];
+    p_chan->ror = (p_chan->temp - oldest) * 600 /
+                  ((THERMAL_ROR_NUMS - 1) * ACP1000_THERMAL_PERIOD / 100);
+}
+
+/**
+ * 状态及电流上限
+ */
+static void __state_update (thermal_chan_t *p_chan)
+{
+    const thermal_chan_cfg_t *p_cfg = p_chan->p_cfg;
+    int32_t                   hyst  = __DEG(p_cfg->hyst);
+    int32_t                   t     = p_chan->temp;
+    int32_t                   span;
+
+    /* 降额用温度： 上升立即跟随， 下降超过回差才跟随 */
+    if (t > p_chan->derate_temp) {
+        p_chan->derate_temp = t;
+    } else if (t < p_chan->derate_temp - hyst) {
+        p_chan->derate_temp = t + hyst;
+    }
+
+    /* 跳闸后降到跳闸点减回差以下才恢复 */
+    if ((t >= __DEG(p_cfg->trip_temp)) ||
+        ((THERMAL_STATE_TRIP == p_chan->state) && (t > __DEG(p_cfg->trip_temp) - hyst))) {
+        p_chan->state = THERMAL_STATE_TRIP;
+        p_chan->limit = __MIN_CURR;
+        return;
+    }
+
+    if ((THERMAL_NO_LOW != p_cfg->low_temp) &&
+        ((t < __DEG(p_cfg->low_temp)) ||
+         ((THERMAL_STATE_LOW == p_chan->state) && (t < __DEG(p_cfg->low_temp) + hyst)))) {
+        p_chan->state = THERMAL_STATE_LOW;
+        p_chan->limit = 0;
+        return;
+    }
+
+    /* 温升过快： 超过限值进入， 降到一半以下退出 */
+    if (p_cfg->ror_limit &&
+        ((p_chan->ror > __DEG(p_cfg->ror_limit)) ||
+         ((THERMAL_STATE_ROR == p_chan->state) && (p_chan->ror > __DEG(p_cfg->ror_limit) / 2)))) {
+        p_chan->state = THERMAL_STATE_ROR;
+        p_chan->limit = __MIN_CURR;
+        return;
+    }
+
+    if (p_chan->derate_temp > __DEG(p_cfg->derate_temp)) {
+        /* 降额点到跳闸点之间从额定电流线性降到最小电流 */
+        span = __DEG(p_cfg->trip_temp - p_cfg->derate_temp);
+        p_chan->state = THERMAL_STATE_DERATE;
+        p_chan->limit = __MAX_CURR -
+                        (p_chan->derate_temp - __DEG(p_cfg->derate_temp)) *
+                        (__MAX_CURR - __MIN_CURR) / span;
+        if (p_chan->limit < __MIN_CURR) {
+            p_chan->limit = __MIN_CURR;
+        }
+        return;
+    }
+
+    p_chan->state = THERMAL_STATE_NORMAL;
+    p_chan->limit = 0;
+}
+
+/******************************************************************************/
+void thermal_init (thermal_t *p_this, const thermal_chan_cfg_t *p_cfg)
+{
+    int i;
+
+    memset(p_this, 0, sizeof(*p_this));
+    p_this->nums = ACP1000_THERMAL_CHANS;
+    for (i = 0; i < p_this->nums; i++) {
+        p_this->chan[i].p_cfg = &p_cfg[i];
+    }
+    evt_pub_init(&p_this->temp_pub,
+                 "pile_temp",
+                 PILE_TEMP,
+                 &__g_temp_pub_field,
+                 1,
+                 sizeof(int32_t),
+                 ACP1000_PUB_TEMP_KEEP);
+}
+
+void thermal_chan_update (thermal_t *p_this, int idx, int16_t raw_temp)
+{
+    thermal_chan_t *p_chan;
+
+    if ((idx < 0) || (idx >= p_this->nums)) {
+        return;
+    }
+    p_chan = &p_this->chan[idx];
+
+    p_chan->temp = __clamp16((((int32_t)raw_temp * p_chan->p_cfg->gain) >> 10) +
+                             p_chan->p_cfg->offset);
+    if (!p_chan->valid) {
+        p_chan->derate_temp = p_chan->temp;
+        p_chan->valid       = TRUE;
+    }
+
+    __ror_update(p_chan);
+    __state_update(p_chan);
+}
+
+void thermal_publish (thermal_t *p_this, event_node_t *p_node)
+{
+    thermal_chan_t *p_chan;
+    uint32_t        limit = 0;
+    uint8_t         err   = 0;
+    int             i;
+
+    for (i = 0; i < p_this->nums; i++) {
+        p_chan = &p_this->chan[i];
+        if (!p_chan->valid) {
+            continue;
+        }
+        if (THERMAL_STATE_TRIP == p_chan->state) {
+            err = 1;
+        } else if ((THERMAL_STATE_LOW == p_chan->state) && (0 == err)) {
+            err = 2;
+        }
+        if (p_chan->limit && ((0 == limit) || (p_chan->limit < limit))) {
+            limit = p_chan->limit;
+        }
+    }
+
+    /* 环境温度变化超过设定值（再加半度回差）才更新， 由temp_pub去重及保活 */
+    p_chan = &p_this->chan[0];
+    if (p_chan->valid &&
+        ((!p_this->pub_valid) ||
+         (__abs32(p_chan->temp - p_this->pub_temp) >= __DEG(ACP1000_THERMAL_PUB_DELTA) + 128))) {
+        p_this->pub_temp  = p_chan->temp;
+        p_this->pub_valid = TRUE;
+    }
+    if (p_this->pub_valid) {
+        evt_pub_tell_val(&p_this->temp_pub, p_node, p_this->pub_temp / 256);
+    }
+
+#if ACP1000_THERMAL_DERATE
+    /* 电流变化不足一个步进不发布， 进出降额总是发布 */
+    if ((limit != p_this->pub_limit) &&
+        ((0 == limit) || (0 == p_this->pub_limit) ||
+         (__abs32(limit - p_this->pub_limit) >= ACP1000_THERMAL_CURR_STEP) ||
+         (__MIN_CURR == limit))) {
+        p_this->pub_limit = limit;
+        event_node_tell_all(p_node, TEMP_DERATE, (void *)limit);
+    }
+#endif
+
+#if ACP1000_TEMP_ERR_DETECT
+    if (err != p_this->pub_err) {
+        p_this->pub_err = err;
+        event_node_tell_all(p_node, ERR_TEMP, (void *)(int)err);
+    }
+#endif
+}
@@ -0,0 +1,113 @@
+/*******************************************************************************
+*                                 Apollo
+*                       ---------------------------
+*                       innovating embedded platform
+*
+* Copyright (c) 2001-2016 Guangzhou ZHIYUAN Electronics Stock Co., Ltd.
+* All rights reserved.
+*
+* Contact information:
+* web site:    http://www.zlg.cn/
+* e-mail:      apollo.support@zlg.cn
+*******************************************************************************/
+/**
+ * \file
+ * \brief 多通道温度监测（校准、回差、温升速率、降额）
+ *
+ * 每个通道独立校准， 温度超过降额点后按线性比例降低CP电流， 到达跳闸点才
+ * 停止充电； 温升速率超限时直接降到最小电流。事件只在状态变化或温度变化
+ * 明显时发布。
+ *
+ * \internal
+ * \par modification history:
+ * - 1.00 16-09-30  xjc, first implementation
+ * \endinternal
+ */
+
+#ifndef __THERMAL_H
+#define __THERMAL_H
+
+#include "apollo.h"
+#include "event_node.h"
+#include "evt_pub.h"
+#include "ac_charge_prj_cfg.h"
+
+#define THERMAL_ROR_NUMS     16     /* 温升速率计算的历史点数 */
+#define THERMAL_NO_LOW       -128   /* 不检测过低温度 */
+
+/**
+ * \brief 通道状态
+ * \anchor grp_thermal_state
+ * @{
+ */
+#define THERMAL_STATE_NORMAL  0     /**< \brief 正常    */
+#define THERMAL_STATE_DERATE  1     /**< \brief 降额    */
+#define THERMAL_STATE_ROR     2     /**< \brief 温升过快， 按最小电流    */
+#define THERMAL_STATE_TRIP    3     /**< \brief 过温停止充电    */
+#define THERMAL_STATE_LOW     4     /**< \brief 温度过低    */
+/** @} */
+
+/**
+ * 通道配置（温度单位℃）
+ */
+typedef struct thermal_chan_cfg {
+    const char *name;          /* 测温点名称 */
+    int         ch;            /* ADC通道 */
+    int16_t     offset;        /* 校准偏移， 单位1/256℃ */
+    uint16_t    gain;          /* 校准增益， 1024为1.0 */
+    int8_t      derate_temp;   /* 开始降额温度 */
+    int8_t      trip_temp;     /* 停止充电温度 */
+    int8_t      low_temp;      /* 过低温度， THERMAL_NO_LOW为不检测 */
+    uint8_t     hyst;          /* 回差 */
+    uint8_t     ror_limit;     /* 温升速率告警值， 单位℃/min， 0为不检测 */
+}thermal_chan_cfg_t;
+
+/**
+ * 通道运行情况（温度单位1/256℃）
+ */
+typedef struct thermal_chan {
+    const thermal_chan_cfg_t *p_cfg;
+    bool_t    valid;                    /* 是否已有温度 */
+    int16_t   temp;                     /* 校准后的温度 */
+    int16_t   derate_temp;              /* 降额计算用温度（下降时带回差） */
+    int16_t   hist[THERMAL_ROR_NUMS];   /* 历史温度 */
+    uint8_t   hist_pos;
+    uint8_t   hist_nums;
+    int32_t   ror;                      /* 温升速率， 单位1/256℃/min */
+    uint8_t   state;                    /* 通道状态 \ref grp_thermal_state */
+    uint32_t  limit;                    /* 通道要求的电流上限， 单位0.01A， 0为不限制 */
+}thermal_chan_t;
+
+/**
+ * 温度监测
+ */
+typedef struct thermal {
+    thermal_chan_t  chan[ACP1000_THERMAL_CHANS];
+    int             nums;
+
+    /* 已发布的内容 */
+    uint8_t   pub_err;        /* ERR_TEMP */
+    uint32_t  pub_limit;      /* TEMP_DERATE */
+    int16_t   pub_temp;       /* PILE_TEMP， 单位1/256℃ */
+    bool_t    pub_valid;
+    evt_pub_t temp_pub;       /* PILE_TEMP去重及保活 */
+}thermal_t;
+
+/**
+ * \brief 初始化
+ * \param[in] p_cfg : 通道配置， 个数为ACP1000_THERMAL_CHANS
+ */
+void thermal_init (thermal_t *p_this, const thermal_chan_cfg_t *p_cfg);
+
+/**
+ * \brief 更新一个通道的温度（每ACP1000_THERMAL_PERIOD调用一次）
+ * \param[in] raw_temp : 未校准的温度， 单位1/256℃
+ */
+void thermal_chan_update (thermal_t *p_this, int idx, int16_t raw_temp);
+
+/**
+ * \brief 按需发布PILE_TEMP（0号通道）、 TEMP_DERATE、 ERR_TEMP事件
+ */
+void thermal_publish (thermal_t *p_this, event_node_t *p_node);
+
+#endif
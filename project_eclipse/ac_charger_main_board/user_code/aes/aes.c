@@ -0,0 +1,247 @@
+#include <string.h>
+#include "aes.h"
+
+/*
+ * Compact AES-128 (FIPS-197).
+ *
+ * Byte oriented with only the two 256-byte S-box tables, both const so
+ * they stay in flash. Used for data at rest (card key), where code size
+ * and RAM matter more than raw throughput.
+ */
+
+static const uint8_t __g_sbox[256] = {
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+    0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+    0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+    0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+    0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+    0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+    0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+    0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+    0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+    0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+    0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16
+};
+
+static const uint8_t __g_inv_sbox[256] = {
+    0x52, 0x09, 0x6a, 0xd5, 0x30, 0x36, 0xa5, 0x38, 0xbf, 0x40, 0xa3, 0x9e, 0x81, 0xf3, 0xd7, 0xfb,
+    0x7c, 0xe3, 0x39, 0x82, 0x9b, 0x2f, 0xff, 0x87, 0x34, 0x8e, 0x43, 0x44, 0xc4, 0xde, 0xe9, 0xcb,
+    0x54, 0x7b, 0x94, 0x32, 0xa6, 0xc2, 0x23, 0x3d, 0xee, 0x4c, 0x95, 0x0b, 0x42, 0xfa, 0xc3, 0x4e,
+    0x08, 0x2e, 0xa1, 0x66, 0x28, 0xd9, 0x24, 0xb2, 0x76, 0x5b, 0xa2, 0x49, 0x6d, 0x8b, 0xd1, 0x25,
+    0x72, 0xf8, 0xf6, 0x64, 0x86, 0x68, 0x98, 0x16, 0xd4, 0xa4, 0x5c, 0xcc, 0x5d, 0x65, 0xb6, 0x92,
+    0x6c, 0x70, 0x48, 0x50, 0xfd, 0xed, 0xb9, 0xda, 0x5e, 0x15, 0x46, 0x57, 0xa7, 0x8d, 0x9d, 0x84,
+    0x90, 0xd8, 0xab, 0x00, 0x8c, 0xbc, 0xd3, 0x0a, 0xf7, 0xe4, 0x58, 0x05, 0xb8, 0xb3, 0x45, 0x06,
+    0xd0, 0x2c, 0x1e, 0x8f, 0xca, 0x3f, 0x0f, 0x02, 0xc1, 0xaf, 0xbd, 0x03, 0x01, 0x13, 0x8a, 0x6b,
+    0x3a, 0x91, 0x11, 0x41, 0x4f, 0x67, 0xdc, 0xea, 0x97, 0xf2, 0xcf, 0xce, 0xf0, 0xb4, 0xe6, 0x73,
+    0x96, 0xac, 0x74, 0x22, 0xe7, 0xad, 0x35, 0x85, 0xe2, 0xf9, 0x37, 0xe8, 0x1c, 0x75, 0xdf, 0x6e,
+    0x47, 0xf1, 0x1a, 0x71, 0x1d, 0x29, 0xc5, 0x89, 0x6f, 0xb7, 0x62, 0x0e, 0xaa, 0x18, 0xbe, 0x1b,
+    0xfc, 0x56, 0x3e, 0x4b, 0xc6, 0xd2, 0x79, 0x20, 0x9a, 0xdb, 0xc0, 0xfe, 0x78, 0xcd, 0x5a, 0xf4,
+    0x1f, 0xdd, 0xa8, 0x33, 0x88, 0x07, 0xc7, 0x31, 0xb1, 0x12, 0x10, 0x59, 0x27, 0x80, 0xec, 0x5f,
+    0x60, 0x51, 0x7f, 0xa9, 0x19, 0xb5, 0x4a, 0x0d, 0x2d, 0xe5, 0x7a, 0x9f, 0x93, 0xc9, 0x9c, 0xef,
+    0xa0, 0xe0, 0x3b, 0x4d, 0xae, 0x2a, 0xf5, 0xb0, 0xc8, 0xeb, 0xbb, 0x3c, 0x83, 0x53, 0x99, 0x61,
+    0x17, 0x2b, 0x04, 0x7e, 0xba, 0x77, 0xd6, 0x26, 0xe1, 0x69, 0x14, 0x63, 0x55, 0x21, 0x0c, 0x7d
+};
+
+static const uint8_t __g_rcon[10] = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36
+};
+
+#define __XTIME(x)  ((uint8_t)(((x) << 1) ^ (((x) & 0x80) ? 0x1b : 0x00)))
+
+static void __add_round_key (uint8_t* s, const uint8_t* rk)
+{
+    int i;
+
+    for (i = 0; i < AES128_BLOCK_SIZE; i++) {
+        s[i] ^= rk[i];
+    }
+}
+
+/* SubBytes and ShiftRows in one pass, the state is column major */
+static void __sub_shift (uint8_t* s)
+{
+    uint8_t t;
+
+    s[0]  = __g_sbox[s[0]];  s[4]  = __g_sbox[s[4]];
+    s[8]  = __g_sbox[s[8]];  s[12] = __g_sbox[s[12]];
+
+    t     = __g_sbox[s[1]];  s[1]  = __g_sbox[s[5]];
+    s[5]  = __g_sbox[s[9]];  s[9]  = __g_sbox[s[13]];  s[13] = t;
+
+    t     = __g_sbox[s[2]];  s[2]  = __g_sbox[s[10]];  s[10] = t;
+    t     = __g_sbox[s[6]];  s[6]  = __g_sbox[s[14]];  s[14] = t;
+
+    t     = __g_sbox[s[15]]; s[15] = __g_sbox[s[11]];
+    s[11] = __g_sbox[s[7]];  s[7]  = __g_sbox[s[3]];   s[3]  = t;
+}
+
+static void __inv_sub_shift (uint8_t* s)
+{
+    uint8_t t;
+
+    s[0]  = __g_inv_sbox[s[0]];  s[4]  = __g_inv_sbox[s[4]];
+    s[8]  = __g_inv_sbox[s[8]];  s[12] = __g_inv_sbox[s[12]];
+
+    t     = __g_inv_sbox[s[13]]; s[13] = __g_inv_sbox[s[9]];
+    s[9]  = __g_inv_sbox[s[5]];  s[5]  = __g_inv_sbox[s[1]];   s[1]  = t;
+
+    t     = __g_inv_sbox[s[2]];  s[2]  = __g_inv_sbox[s[10]];  s[10] = t;
+    t     = __g_inv_sbox[s[6]];  s[6]  = __g_inv_sbox[s[14]];  s[14] = t;
+
+    t     = __g_inv_sbox[s[3]];  s[3]  = __g_inv_sbox[s[7]];
+    s[7]  = __g_inv_sbox[s[11]]; s[11] = __g_inv_sbox[s[15]];  s[15] = t;
+}
+
+static void __mix_columns (uint8_t* s)
+{
+    uint8_t a, b, c, d, e;
+    int     i;
+
+    for (i = 0; i < AES128_BLOCK_SIZE; i += 4) {
+        a = s[i]; b = s[i + 1]; c = s[i + 2]; d = s[i + 3];
+        e = a ^ b ^ c ^ d;
+        s[i]     ^= e ^ __XTIME(a ^ b);
+        s[i + 1] ^= e ^ __XTIME(b ^ c);
+        s[i + 2] ^= e ^ __XTIME(c ^ d);
+        s[i + 3] ^= e ^ __XTIME(d ^ a);
+    }
+}
+
+static void __inv_mix_columns (uint8_t* s)
+{
+    uint8_t u, v;
+    int     i;
+
+    /* InvMixColumns = MixColumns after a cheap pre-multiplication */
+    for (i = 0; i < AES128_BLOCK_SIZE; i += 4) {
+        u = __XTIME(__XTIME(s[i] ^ s[i + 2]));
+        v = __XTIME(__XTIME(s[i + 1] ^ s[i + 3]));
+        s[i]     ^= u;
+        s[i + 1] ^= v;
+        s[i + 2] ^= u;
+        s[i + 3] ^= v;
+    }
+    __mix_columns(s);
+}
+
+void aes128_key_setup(aes128_ctx* ctx, const uint8_t* key)
+{
+    uint8_t* w = &ctx->rk[0][0];
+    uint8_t  t[4];
+    int      i;
+
+    memcpy(w, key, AES128_KEY_SIZE);
+
+    for (i = 4; i < 44; i++) {
+        memcpy(t, &w[(i - 1) * 4], 4);
+        if (0 == (i & 3)) {
+            uint8_t k = t[0];
+
+            t[0] = __g_sbox[t[1]] ^ __g_rcon[(i >> 2) - 1];
+            t[1] = __g_sbox[t[2]];
+            t[2] = __g_sbox[t[3]];
+            t[3] = __g_sbox[k];
+        }
+        w[i * 4]     = w[(i - 4) * 4]     ^ t[0];
+        w[i * 4 + 1] = w[(i - 4) * 4 + 1] ^ t[1];
+        w[i * 4 + 2] = w[(i - 4) * 4 + 2] ^ t[2];
+        w[i * 4 + 3] = w[(i - 4) * 4 + 3] ^ t[3];
+    }
+}
+
+void aes128_block_encrypt(const aes128_ctx* ctx, const uint8_t* in, uint8_t* out)
+{
+    uint8_t s[AES128_BLOCK_SIZE];
+    int     r;
+
+    memcpy(s, in, AES128_BLOCK_SIZE);
+    __add_round_key(s, ctx->rk[0]);
+    for (r = 1; r < 10; r++) {
+        __sub_shift(s);
+        __mix_columns(s);
+        __add_round_key(s, ctx->rk[r]);
+    }
+    __sub_shift(s);
+    __add_round_key(s, ctx->rk[10]);
+    memcpy(out, s, AES128_BLOCK_SIZE);
+}
+
+void aes128_block_decrypt(const aes128_ctx* ctx, const uint8_t* in, uint8_t* out)
+{
+    uint8_t s[AES128_BLOCK_SIZE];
+    int     r;
+
+    memcpy(s, in, AES128_BLOCK_SIZE);
+    __add_round_key(s, ctx->rk[10]);
+    for (r = 9; r > 0; r--) {
+        __inv_sub_shift(s);
+        __add_round_key(s, ctx->rk[r]);
+        __inv_mix_columns(s);
+    }
+    __inv_sub_shift(s);
+    __add_round_key(s, ctx->rk[0]);
+    memcpy(out, s, AES128_BLOCK_SIZE);
+}
+
+void aes128_ctr_crypt(const aes128_ctx* ctx, uint8_t* iv,
+                      const uint8_t* in, uint8_t* out, uint32_t len)
+{
+    uint8_t  ks[AES128_BLOCK_SIZE];
+    uint32_t i, n;
+    int      j;
+
+    while (len > 0) {
+        aes128_block_encrypt(ctx, iv, ks);
+        n = (len < AES128_BLOCK_SIZE) ? len : AES128_BLOCK_SIZE;
+        for (i = 0; i < n; i++) {
+            out[i] = in[i] ^ ks[i];
+        }
+        for (j = AES128_BLOCK_SIZE - 1; j >= AES128_BLOCK_SIZE - 4; j--) {
+            if (++iv[j] != 0) {
+                break;
+            }
+        }
+        in  += n;
+        out += n;
+        len -= n;
+    }
+}
+
+void aes128_cbc_encrypt(const aes128_ctx* ctx, uint8_t* iv,
+                        const uint8_t* in, uint8_t* out, uint32_t len)
+{
+    int i;
+
+    for (; len >= AES128_BLOCK_SIZE; len -= AES128_BLOCK_SIZE) {
+        for (i = 0; i < AES128_BLOCK_SIZE; i++) {
+            iv[i] ^= in[i];
+        }
+        aes128_block_encrypt(ctx, iv, iv);
+        memcpy(out, iv, AES128_BLOCK_SIZE);
+        in  += AES128_BLOCK_SIZE;
+        out += AES128_BLOCK_SIZE;
+    }
+}
+
+void aes128_cbc_decrypt(const aes128_ctx* ctx, uint8_t* iv,
+                        const uint8_t* in, uint8_t* out, uint32_t len)
+{
+    uint8_t c[AES128_BLOCK_SIZE];
+    int     i;
+
+    for (; len >= AES128_BLOCK_SIZE; len -= AES128_BLOCK_SIZE) {
+        memcpy(c, in, AES128_BLOCK_SIZE);
+        aes128_block_decrypt(ctx, c, out);
+        for (i = 0; i < AES128_BLOCK_SIZE; i++) {
+            out[i] ^= iv[i];
+        }
+        memcpy(iv, c, AES128_BLOCK_SIZE);
+        in  += AES128_BLOCK_SIZE;
+        out += AES128_BLOCK_SIZE;
+    }
+}
@@ -0,0 +1,36 @@
+#ifndef _AES_H_
+#define _AES_H_
+
+#include <stdint.h>
+
+#define AES128_BLOCK_SIZE   16
+#define AES128_KEY_SIZE     16
+
+/**
+ * AES-128 context: round keys are expanded once per key.
+ */
+typedef struct {
+    uint8_t rk[11][AES128_BLOCK_SIZE];  /* round keys */
+} aes128_ctx;
+
+/* Expand the round keys */
+void aes128_key_setup(aes128_ctx* ctx, const uint8_t* key);
+
+/* Encrypt or decrypt one 16-byte block, in and out may overlap */
+void aes128_block_encrypt(const aes128_ctx* ctx, const uint8_t* in, uint8_t* out);
+void aes128_block_decrypt(const aes128_ctx* ctx, const uint8_t* in, uint8_t* out);
+
+/* CTR mode, encryption and decryption are the same operation.
+ * iv is the initial counter block, the low 32 bits (big-endian) are
+ * incremented per block and iv is left pointing at the next block */
+void aes128_ctr_crypt(const aes128_ctx* ctx, uint8_t* iv,
+                      const uint8_t* in, uint8_t* out, uint32_t len);
+
+/* CBC mode, len must be a multiple of AES128_BLOCK_SIZE.
+ * iv is updated to the last cipher block */
+void aes128_cbc_encrypt(const aes128_ctx* ctx, uint8_t* iv,
+                        const uint8_t* in, uint8_t* out, uint32_t len);
+void aes128_cbc_decrypt(const aes128_ctx* ctx, uint8_t* iv,
+                        const uint8_t* in, uint8_t* out, uint32_t len);
+
+#endif
@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief  ʵ
+ * \brief  电表操作实现
  *
  * \internal
  * \par modification history:
@@ -26,46 +26,46 @@
 #include "aw_delay.h"
 
 #include "aw_vdebug.h"
-#include "aw_task.h"                    /*  */
+#include "aw_task.h"                    /* 多任务服务 */
 #include <string.h>
 
-#define __DL645_RX_BYTE_TIMEOUT_CFG    100   /* յֽڳʱãλms */
-#define __DL645_RX_FRAME_TIMEOUT_CFG   1000 /* ֡ʱʱãλms */
+#define __DL645_RX_BYTE_TIMEOUT_CFG    100   /* 最大允许接收单字节超时配置，单位ms */
+#define __DL645_RX_FRAME_TIMEOUT_CFG   1000 /* 最大允许接收帧超时超时配置，单位ms */
 
 
-#define __DL645_GUIDE_CODE  (0xFEu)  /* DL645Э */
-#define __DL645_START_CODE  (0x68u)  /* DL645ʼ     */
-#define __DL645_END_CODE    (0x16u)  /* DL645     */
-#define __DL645_ADDR_LEN    (6)      /* ַȣλֽ */
+#define __DL645_GUIDE_CODE  (0xFEu)  /* DL645协议引导码 */
+#define __DL645_START_CODE  (0x68u)  /* DL645起始符     */
+#define __DL645_END_CODE    (0x16u)  /* DL645结束符     */
+#define __DL645_ADDR_LEN    (6)      /* 地址长度，单位字节 */
 
-#define __DL645_07_CTRL_CODE_DATGET    (0x11u)        /* ȡݿ(07汾) */
-#define __DL645_07_DATAID_ENERGY       (0x00010000u)  /* ȡʶ(07汾) */
-#define __DL645_07_DATAID_A_CURR       (0x02020100u)  /* Aʶ(07汾) */
-#define __DL645_07_DATAID_A_VOL        (0x02010100u)  /* Aѹʶ(07汾) */
-#define __DL645_07_DATAID_POWER        (0x02030000u)  /* ˲ʱйʱʶ(07汾) */
+#define __DL645_07_CTRL_CODE_DATGET    (0x11u)        /* 读取数据控制码(07年版本) */
+#define __DL645_07_DATAID_ENERGY       (0x00010000u)  /* 电量读取标识(07年版本) */
+#define __DL645_07_DATAID_A_CURR       (0x02020100u)  /* A相电流标识(07年版本) */
+#define __DL645_07_DATAID_A_VOL        (0x02010100u)  /* A相电压标识(07年版本) */
+#define __DL645_07_DATAID_POWER        (0x02030000u)  /* 瞬时有功功率标识(07年版本) */
 
-#define __DL645_97_CTRL_CODE_DATGET    (0x01u)        /* ȡݿ(97汾) */
-#define __DL645_97_DATAID_ENERGY       (0x9010u)     /* ȡʶ(97汾) */
-#define __DL645_97_DATAID_A_CURR       (0xB621u)     /* Aʶ(97汾) */
-#define __DL645_97_DATAID_A_VOL        (0xB611u)     /* Aѹʶ(97汾) */
-#define __DL645_97_DATAID_POWER        (0xB630u)     /* ˲ʱйʱʶ(97汾) */
+#define __DL645_97_CTRL_CODE_DATGET    (0x01u)        /* 读取数据控制码(97年版本) */
+#define __DL645_97_DATAID_ENERGY       (0x9010u)     /* 电量读取标识(97年版本) */
+#define __DL645_97_DATAID_A_CURR       (0xB621u)     /* A相电流标识(97年版本) */
+#define __DL645_97_DATAID_A_VOL        (0xB611u)     /* A相电压标识(97年版本) */
+#define __DL645_97_DATAID_POWER        (0xB630u)     /* 瞬时有功功率标识(97年版本) */
 
 
-#define __DL645_PROTOCOL_LENGTH 12    /**< \brief ͨѶ֡Эֽ */
-#define __DL645_INFO_MAX_LENGTH 200   /**< \brief ͨѶֽ֡ */
-/** \brief ͨѶ֡ϢСֽ֡ʽ */
+#define __DL645_PROTOCOL_LENGTH 12    /**< \brief 通讯帧协议字节数 */
+#define __DL645_INFO_MAX_LENGTH 200   /**< \brief 通讯帧最大字节数 */
+/** \brief 通讯帧信息最小字节数（新帧格式） */
 #define __DL645_PACKET_MIN_SIZE (__DL645_PROTOCOL_LENGTH)
-/** \brief ͨѶ֡Ϣֽ֡ʽ*/
+/** \brief 通讯帧信息最大字节数（新帧格式）*/
 #define __DL645_PACKET_MAX_SIZE (__DL645_PROTOCOL_LENGTH + \
                                  __DL645_INFO_MAX_LENGTH)
 
-/** \brief ֧DL645 07Э  */
+/** \brief 驱动支持DL645 07年协议  */
 #define __DL645_07_SUPPORT   1
 
-/** \brief ֧DL645 97Э  */
+/** \brief 驱动支持DL645 97年协议  */
 #define __DL645_97_SUPPORT   0
 
-/** \brief ֧modbusЭ  */
+/** \brief 驱动支持modbus协议  */
 #define __MODBUS_SUPPORT     0
 
 #if __MODBUS_SUPPORT
@@ -74,44 +74,44 @@
 /*******************************************************************************
   macro operate
 *******************************************************************************/
-/** \brief ɵָתɵֱ */
+/** \brief 由电表父类指针转成到直流电表子类 */
 #define __AMETER_DC_DECL(p_ammeter_dc, handle) \
                    aw_ammeter_dc_t *p_ammeter_dc = (aw_ammeter_dc_t *)((handle))
 
-/** \brief ָุͨתɵDL645ͨ */
+/** \brief 由通信类父类指针转成到DL645通信子类 */
 #define __AMETER_TRANSFER_DL645_DECL(p_ammeter_transfer_dl645, handle) \
                    aw_ammeter_transfer_dl645_t *p_ammeter_transfer_dl645 = \
                                       (aw_ammeter_transfer_dl645_t *)((handle))
 
 
-/** \brief ָุͨתɵmodbus-rtuͨ */
+/** \brief 由通信类父类指针转成到modbus-rtu通信子类 */
 #define __AMETER_TRANSFER_MB_DECL(p_ammeter_transfer_mb, handle) \
                    aw_ammeter_transfer_mb_t *p_ammeter_transfer_mb = \
                                       (aw_ammeter_transfer_mb_t *)((handle))
 
 /**
- * \brief ͨʵʼ
- * \param[in]  handle  : ָָ
- * \return AW_OK       : ʼɹ
- * \return -AW_EINVAL  : 
+ * \brief 通信实例初始化
+ * \param[in]  handle  : 指向电表的指针
+ * \return AW_OK       : 初始化成功
+ * \return -AW_EINVAL  : 参数错误
  */
 aw_err_t aw_ammeter_transfer_inst_init (aw_ammeter_transfer_t* handle);
 
 #if __DL645_07_SUPPORT || __DL645_97_SUPPORT
 /** 
- * \brief DL645Э鷢
- * \param [in] handle  : ͨŴʵ
- * \param [in] p_txbuf : ݻ
- *                       p_txbuf[0] ̶ڿʹ
- * \param [in] nbytes  : ֽ
- *                       nbytes 0Ϊһ룩
+ * \brief 按DL645协议发送数据
+ * \param [in] handle  : 电表通信传输的实例
+ * \param [in] p_txbuf : 发送数据缓冲区
+ *                       p_txbuf[0] 固定用于控制码使用
+ * \param [in] nbytes  : 发送字节数
+ *                       nbytes 比须大于0（因为至少有一个控制码）
  *
- * \return AW_OK      : ͨųɹ
- * \return -AW_EINVAL : 
- * \return -AW_EIO    : ӲͨIOʹ
+ * \return AW_OK      : 通信成功
+ * \return -AW_EINVAL : 参数错误
+ * \return -AW_EIO    : 硬件通信IO发送错误
  * 
- * \note DL/T 645Э ͨ÷ͽӿڣԶ֡ͷַԼУϢ
- *      ûֻĴ͵Ŀ룬Լݱʶ򣩼
+ * \note DL/T 645协议 数据通用发送接口，函数自动添加帧头、地址以及校验信息，
+ *      用户只需关心待发送的控制码，以及数据标识（数据域）即可
  */
 aw_local aw_err_t __dl645_send(struct aw_ammeter_transfer* handle,
                                const uint8_t              *p_txbuf,
@@ -122,8 +122,8 @@ aw_local aw_err_t __dl645_send(struct aw_ammeter_transfer* handle,
                                 __DL645_GUIDE_CODE, __DL645_GUIDE_CODE,
                                 __DL645_START_CODE};
     uint32_t i   = 0;
-    uint8_t  sum = 0;  /* 8λУ */
-    uint8_t  dat_num;  /* ȥ */
+    uint8_t  sum = 0;  /* 8位校验和 */
+    uint8_t  dat_num;  /* 去除控制码后的数据数 */
     
     aw_tick_t start_ticks, end_ticks;
     uint32_t  timeout_ms;
@@ -132,36 +132,36 @@ aw_local aw_err_t __dl645_send(struct aw_ammeter_transfer* handle,
 
     if ((NULL == p_ammeter_transfer_dl645)     ||
         (NULL == handle->p_addr)               ||
-        (__DL645_ADDR_LEN != handle->addr_len) || /* DL T645 ֧6ֽڵĵַ */
-        (nbytes < 1) || (nbytes > 51)) {          /* дʱ50ֽ */
+        (__DL645_ADDR_LEN != handle->addr_len) || /* DL T645 仅支持6字节的地址 */
+        (nbytes < 1) || (nbytes > 51)) {          /* 写数据时，数据域最长允许50个字节 */
         return -AW_EINVAL;
     }
    
     dat_num  = nbytes - 1;
     
-    /* ַ */
+    /* 填充地址 */
     for (i = 0; i < __DL645_ADDR_LEN; i++) {
         tx_data[i + 5] = handle->p_addr[i];
     }
-    tx_data[__DL645_ADDR_LEN + 5] = __DL645_START_CODE; /* ڶ֡ʼ */
-    tx_data[__DL645_ADDR_LEN + 6] = p_txbuf[0];         /*  */
-    tx_data[__DL645_ADDR_LEN + 7] = dat_num;           /*  򳤶 */
-    /*  򳤶 */
+    tx_data[__DL645_ADDR_LEN + 5] = __DL645_START_CODE; /* 第二个帧起始符 */
+    tx_data[__DL645_ADDR_LEN + 6] = p_txbuf[0];         /* 控制码 */
+    tx_data[__DL645_ADDR_LEN + 7] = dat_num;           /*  数据域长度 */
+    /*  数据域长度 */
     for (i = 1; i < nbytes; i++) {
         tx_data[__DL645_ADDR_LEN + 7 + i] = p_txbuf[i] + 0x33u;
     }
-    /* У */
+    /* 计算校验和 */
     sum = 0;
     for (i = 4; i < nbytes + 13; i++) {
         sum += tx_data[i];
     }
     
-    /*  */
+    /* 检验码 */
     tx_data[__DL645_ADDR_LEN + 7 + nbytes]     = sum;
-    /*  */
+    /* 结束码 */
     tx_data[__DL645_ADDR_LEN + 7 + nbytes + 1] = __DL645_END_CODE;
     
-    /* ֡ */
+    /* 发送数据帧 */
 //    start_ticks = aw_sys_tick_get();
 
 //    if ((nbytes + 15) != aw_serial_write(p_ammeter_transfer_dl645->uart_num,
@@ -180,17 +180,17 @@ aw_local aw_err_t __dl645_send(struct aw_ammeter_transfer* handle,
 
 
 /**
- * \brief Ӵжȡ
- * \param [in] handle    : ͨŴʵ
- * \param [out] p_rxbuf  : 洢ݵָ
- * \param [in]  nbytes   : ո
- * \param [in]  timeout  : ʱʱ䣬λms
+ * \brief 从串口中读取数据
+ * \param [in] handle    : 电表通信传输的实例
+ * \param [out] p_rxbuf  : 存储数据的指针
+ * \param [in]  nbytes   : 接收个数
+ * \param [in]  timeout  : 最大允许超时时间，单位ms
  *
- * \return   >0          : ʵʶȡֽ
- * \return -AW_ETIMEDOUT : ʱ
- * \return -AW_ENOMEM    : ջp_rxbufռ䲻
+ * \return   >0          : 实际读取的字节数
+ * \return -AW_ETIMEDOUT : 超时错误
+ * \return -AW_ENOMEM    : 接收缓冲区p_rxbuf空间不足
  *
- * \note ճɹp_rxbuf[nbytes-1]ΪյĿ
+ * \note 若接收成功，p_rxbuf[nbytes-1]为接收的控制码
  */
 aw_local int __dl645_recevie_timeout (struct aw_ammeter_transfer* handle,
                                       uint8_t  *p_rxbuf,
@@ -198,14 +198,14 @@ aw_local int __dl645_recevie_timeout (struct aw_ammeter_transfer* handle,
                                       uint32_t  timeout)
 
 {
-#define __DL645_STATE_START_CODE_FIND   0  /* Эͷ */
-#define __DL645_STATE_CTRL_CODE_GET     1  /* ȡ  */
-#define __DL645_STATE_DAT_GET           2  /* ȡ УԼ */
+#define __DL645_STATE_START_CODE_FIND   0  /* 查找协议头 */
+#define __DL645_STATE_CTRL_CODE_GET     1  /* 获取控制吗  */
+#define __DL645_STATE_DAT_GET           2  /* 获取数据域 和校验和以及结束符 */
 
     __AMETER_TRANSFER_DL645_DECL(p_ammeter_transfer_dl645, handle);
     uint32_t uart_num;
     int      state = __DL645_STATE_START_CODE_FIND;
-    int      cnt   = 0; /* ĿǰЭݵļ */
+    int      cnt   = 0; /* 目前协议数据的计数 */
     uint8_t rx_data[__DL645_PACKET_MAX_SIZE], sum;
     aw_tick_t start_ticks, end_ticks;
     uint32_t  timeout_ms;
@@ -223,7 +223,7 @@ aw_local int __dl645_recevie_timeout (struct aw_ammeter_transfer* handle,
             return -AW_ETIMEDOUT;
         }
 
-        /* ȡ֡ʼ͵ַһ֡12ֽ */
+        /* 读取帧起始符和地址，一帧至少是12个字节 */
         if (0 >= (rlen_tmp = aw_serial_read(uart_num, (char *)p_rbuf, rlen))) {
             state  = __DL645_STATE_START_CODE_FIND;
             rlen   = 1;
@@ -252,7 +252,7 @@ aw_local int __dl645_recevie_timeout (struct aw_ammeter_transfer* handle,
                 rlen   = 1;
                 break;
             }
-            /* жϵַǷһֱ */
+            /* 判断地址是否一直 */
             for (cnt = 0; cnt < __DL645_ADDR_LEN; cnt++) {
                 if (rx_data[1+cnt] != handle->p_addr[cnt]) {
                     p_rbuf = &rx_data[0];
@@ -261,7 +261,7 @@ aw_local int __dl645_recevie_timeout (struct aw_ammeter_transfer* handle,
                 }
             }
             if ((rx_data[9] <= __DL645_INFO_MAX_LENGTH) &&
-                (rx_data[9] == (nbytes - 1))) { /* жݳǷΪЧ */
+                (rx_data[9] == (nbytes - 1))) { /* 判断数据长度是否为有效 */
                p_rbuf = &rx_data[10];
                rlen   = rx_data[9]+2;
                state  = __DL645_STATE_DAT_GET;
@@ -280,7 +280,7 @@ aw_local int __dl645_recevie_timeout (struct aw_ammeter_transfer* handle,
                 break;
             }
 
-            /* У */
+            /* 计算校验和 */
             sum  = 0;
             for (cnt = 0; cnt < rx_data[9]+10; cnt++) {
                 sum += rx_data[cnt];
@@ -290,12 +290,12 @@ aw_local int __dl645_recevie_timeout (struct aw_ammeter_transfer* handle,
                 if ((rx_data[9] + 1) < nbytes) {
                     return -AW_ENOMEM;
                 }
-                /* ݽ */
-                p_rxbuf[rx_data[9]] = rx_data[8]; /*  */
+                /* 数据接收完毕 */
+                p_rxbuf[rx_data[9]] = rx_data[8]; /* 保存控制码 */
                 for (cnt = 0; cnt < rx_data[9]; cnt++) {
                     p_rxbuf[cnt] = rx_data[cnt+10] - 0x33u;
                 }
-                return rx_data[9] + 1; /* + */
+                return rx_data[9] + 1; /* 控制码+数据 */
             }
             break;
 
@@ -305,21 +305,21 @@ aw_local int __dl645_recevie_timeout (struct aw_ammeter_transfer* handle,
     return AW_ERROR;
 }
 /** 
- * \brief DL645Э
- * \param [in] handle  : ͨŴʵ
- * \param [in] p_rxbuf : ݻ
- * \param [in] nbytes  : ֽ
+ * \brief 按DL645协议接收数据
+ * \param [in] handle  : 电表通信传输的实例
+ * \param [in] p_rxbuf : 接收数据缓冲区
+ * \param [in] nbytes  : 接收字节数
  *
- * \return   >0          : ʵʶȡֽ
- * \return -AW_EINVAL : 
- * \return -AW_ETIMEDOUT : ʱ
+ * \return   >0          : 实际读取的字节数
+ * \return -AW_EINVAL : 参数错误
+ * \return -AW_ETIMEDOUT : 超时错误
  *
- * \note DL/T 645Э ͨýսӿڣʶ֡ͷַԼУϢ
- *      ûֻĽյĿ룬Լݣݱʶ.
- *    ճɹp_rxbuf[nbytes-1]ΪյĿ
- *    ݸʽ
- *    07  ݱʶ4ֽڣ |  | 루1ֽڣ
- *    97  ݱʶ2ֽڣ |  | 루1ֽڣ
+ * \note DL/T 645协议 数据通用接收接口，函数复制识别帧头，地址以及校验信息，
+ *      用户只需关心接收到的控制码，以及数据（包括数据标识）即可.
+ *    若接收成功，p_rxbuf[nbytes-1]为接收的控制码
+ *    返回数据格式
+ *    07年 ： 数据标识（4字节） | 数据域 | 控制码（1字节）
+ *    97年 ： 数据标识（2字节） | 数据域 | 控制码（1字节）
  *
  */
 aw_local int __dl645_receive(struct aw_ammeter_transfer* handle,
@@ -330,8 +330,8 @@ aw_local int __dl645_receive(struct aw_ammeter_transfer* handle,
 
     if ((NULL == p_ammeter_transfer_dl645)     ||
         (NULL == handle->p_addr)               ||
-        (__DL645_ADDR_LEN != handle->addr_len) || /* DL T645 ֧6ֽڵĵַ */
-        (nbytes < 1) || (nbytes > 200)) {         /* ʱ200ֽ */
+        (__DL645_ADDR_LEN != handle->addr_len) || /* DL T645 仅支持6字节的地址 */
+        (nbytes < 1) || (nbytes > 200)) {         /* 读数据时，数据域最长允许200个字节 */
         return -AW_EINVAL;
     }
 
@@ -339,12 +339,12 @@ aw_local int __dl645_receive(struct aw_ammeter_transfer* handle,
 }
 
 /**
- * \brief ȡǰλ0.01 KWh(DTL645 07Эȡ)
- * \param[in]  handle   : ָʵ
- * \param[out] p_energy : ָŵı
+ * \brief 获取当前电量，单位0.01 KWh(DTL645 07年协议获取)
+ * \param[in]  handle   : 指向电表的实例
+ * \param[out] p_energy : 指向存放电量的变量
  *
- * \return AW_OK    : ȡɹ
- * \return AW_ERROR : ȡʧ
+ * \return AW_OK    : 获取成功
+ * \return AW_ERROR : 获取失败
  */
 aw_local aw_err_t __dl645_07_active_energy_get(struct aw_ammeter* handle,
                                                uint32_t          *p_energy)
@@ -364,13 +364,13 @@ aw_local aw_err_t __dl645_07_active_energy_get(struct aw_ammeter* handle,
     buf[2] = (uint8_t)(__DL645_07_DATAID_ENERGY >> 8);
     buf[3] = (uint8_t)(__DL645_07_DATAID_ENERGY >> 16);
     buf[4] = (uint8_t)(__DL645_07_DATAID_ENERGY >> 24);
-    /*  */
+    /* 发送请求 */
     if (AW_OK != p_ammeter_dc->p_transfer->pfn_send(p_ammeter_dc->p_transfer,
                                                     buf,
                                                     5)) {
         return  AW_ERROR;
     }
-    /* ȡ */
+    /* 读取数据 */
     if (0 > (len = p_ammeter_dc->p_transfer->pfn_receive(p_ammeter_dc->p_transfer,
                                                          buf,
                                                          sizeof(buf)))) {
@@ -380,8 +380,8 @@ aw_local aw_err_t __dl645_07_active_energy_get(struct aw_ammeter* handle,
     if (9 != len) {
         return AW_ERROR;
     }
-    /* buf[0-3] 洢4ֽڵݱ־
-     * buf[4-7] 洢дݵĵݣʽΪ XXXXXX.XX KWh (LSBʽ) */
+    /* buf[0-3] 存储着4个字节的数据标志
+     * buf[4-7] 存储着写个数据的电量数据，格式为 XXXXXX.XX KWh (LSB格式存放) */
     p_ammeter_dc->super.energy = (AW_BCD_TO_HEX(buf[7]) * 1000000) +
                                 (AW_BCD_TO_HEX(buf[6]) * 10000)   +
                                 (AW_BCD_TO_HEX(buf[5]) * 100)     +
@@ -394,12 +394,12 @@ aw_local aw_err_t __dl645_07_active_energy_get(struct aw_ammeter* handle,
 }
 #if __DL645_97_SUPPORT
 /**
- * \brief ȡǰλ0.01 KWh(DTL645 97Эȡ)
- * \param[in]  handle   : ָʵ
- * \param[out] p_energy : ָŵı
+ * \brief 获取当前电量，单位0.01 KWh(DTL645 97年协议获取)
+ * \param[in]  handle   : 指向电表的实例
+ * \param[out] p_energy : 指向存放电量的变量
  *
- * \return AW_OK    : ȡɹ
- * \return AW_ERROR : ȡʧ
+ * \return AW_OK    : 获取成功
+ * \return AW_ERROR : 获取失败
  */
 aw_local aw_err_t __dl645_97_active_energy_get(struct aw_ammeter* handle,
                                                uint32_t          *p_energy)
@@ -417,13 +417,13 @@ aw_local aw_err_t __dl645_97_active_energy_get(struct aw_ammeter* handle,
     buf[0] = (uint8_t) __DL645_97_CTRL_CODE_DATGET;
     buf[1] = (uint8_t)__DL645_97_DATAID_ENERGY ;
     buf[2] = (uint8_t)(__DL645_97_DATAID_ENERGY >> 8);
-    /*  */
+    /* 发送请求 */
     if (AW_OK != p_ammeter_dc->p_transfer->pfn_send(p_ammeter_dc->p_transfer,
                                                     buf,
                                                     3)) {
         return  AW_ERROR;                    
     }
-    /* ȡ */
+    /* 读取数据 */
     if (0 > (len = p_ammeter_dc->p_transfer->pfn_receive(p_ammeter_dc->p_transfer,
                                                          buf,
                                                          sizeof(buf)))) {
@@ -447,13 +447,13 @@ aw_local aw_err_t __dl645_97_active_energy_get(struct aw_ammeter* handle,
 #endif
 
 /**
- * \brief ȡA07汾
- * \param[in]  handle   : ָʵ
- * \param[in]  phase    : ȡ࣬0-A࣬1-B࣬2-C
- * \param[out] p_curr   : ָŵıλ0.001A
+ * \brief 获取A相电流（07年版本）
+ * \param[in]  handle   : 指向电表的实例
+ * \param[in]  phase    : 获取的相，0-A相，1-B相，2-C相
+ * \param[out] p_curr   : 指向存放电流的变量，单位0.001A
  *
- * \return AW_OK    : ȡɹ
- * \return AW_ERROR : ȡʧ
+ * \return AW_OK    : 获取成功
+ * \return AW_ERROR : 获取失败
  */
 aw_local aw_err_t __dl645_07_current_get(struct aw_ammeter* handle,
                                            uint8_t            phase,
@@ -474,13 +474,13 @@ aw_local aw_err_t __dl645_07_current_get(struct aw_ammeter* handle,
     buf[2] = (uint8_t)(__DL645_07_DATAID_A_CURR >> 8) + phase;
     buf[3] = (uint8_t)(__DL645_07_DATAID_A_CURR >> 16);
     buf[4] = (uint8_t)(__DL645_07_DATAID_A_CURR >> 24);
-    /*  */
+    /* 发送请求 */
     if (AW_OK != p_ammeter_dc->p_transfer->pfn_send(p_ammeter_dc->p_transfer,
                                                     buf,
                                                     5)) {
         return  AW_ERROR;
     }
-    /* ȡ */
+    /* 读取数据 */
     if (0 > (len = p_ammeter_dc->p_transfer->pfn_receive(p_ammeter_dc->p_transfer,
                                                          buf,
                                                          sizeof(buf)))) {
@@ -500,13 +500,13 @@ aw_local aw_err_t __dl645_07_current_get(struct aw_ammeter* handle,
 }
 
 /**
- * \brief ȡAѹ07汾
- * \param[in]  handle   : ָʵ
- * \param[in]  phase    : ȡ࣬0-A࣬1-B࣬2-C
- * \param[out] p_vol    : ָѹıλ0.1V
+ * \brief 获取A相电压（07年版本）
+ * \param[in]  handle   : 指向电表的实例
+ * \param[in]  phase    : 获取的相，0-A相，1-B相，2-C相
+ * \param[out] p_vol    : 指向存放压的变量，单位0.1V
  *
- * \return AW_OK    : ȡɹ
- * \return AW_ERROR : ȡʧ
+ * \return AW_OK    : 获取成功
+ * \return AW_ERROR : 获取失败
  */
 aw_local aw_err_t __dl645_07_vol_get(struct aw_ammeter* handle,
                                        uint8_t            phase,
@@ -527,13 +527,13 @@ aw_local aw_err_t __dl645_07_vol_get(struct aw_ammeter* handle,
     buf[2] = (uint8_t)(__DL645_07_DATAID_A_VOL >> 8) + phase;
     buf[3] = (uint8_t)(__DL645_07_DATAID_A_VOL >> 16);
     buf[4] = (uint8_t)(__DL645_07_DATAID_A_VOL >> 24);
-    /*  */
+    /* 发送请求 */
     if (AW_OK != p_ammeter_dc->p_transfer->pfn_send(p_ammeter_dc->p_transfer,
                                                     buf,
                                                     5)) {
         return  AW_ERROR;
     }
-    /* ȡ */
+    /* 读取数据 */
     if (0 > (len = p_ammeter_dc->p_transfer->pfn_receive(p_ammeter_dc->p_transfer,
                                                          buf,
                                                          sizeof(buf)))) {
@@ -552,12 +552,12 @@ aw_local aw_err_t __dl645_07_vol_get(struct aw_ammeter* handle,
 }
 
 /**
- * \brief ȡ˲ʱʣ07汾
- * \param[in]  handle   : ָʵ
- * \param[out] p_power  : ָŹʵıλkW
+ * \brief 获取瞬时功率（07年版本）
+ * \param[in]  handle   : 指向电表的实例
+ * \param[out] p_power  : 指向存放功率的变量，单位kW
  *
- * \return AW_OK    : ȡɹ
- * \return AW_ERROR : ȡʧ
+ * \return AW_OK    : 获取成功
+ * \return AW_ERROR : 获取失败
  */
 aw_local aw_err_t __dl645_07_power_get(struct aw_ammeter* handle,
                                        uint32_t          *p_power)
@@ -577,13 +577,13 @@ aw_local aw_err_t __dl645_07_power_get(struct aw_ammeter* handle,
     buf[2] = (uint8_t)(__DL645_07_DATAID_POWER >> 8);
     buf[3] = (uint8_t)(__DL645_07_DATAID_POWER >> 16);
     buf[4] = (uint8_t)(__DL645_07_DATAID_POWER >> 24);
-    /*  */
+    /* 发送请求 */
     if (AW_OK != p_ammeter_dc->p_transfer->pfn_send(p_ammeter_dc->p_transfer,
                                                     buf,
                                                     5)) {
         return  AW_ERROR;
     }
-    /* ȡ */
+    /* 读取数据 */
     if (0 > (len = p_ammeter_dc->p_transfer->pfn_receive(p_ammeter_dc->p_transfer,
                                                          buf,
                                                          sizeof(buf)))) {
@@ -604,13 +604,13 @@ aw_local aw_err_t __dl645_07_power_get(struct aw_ammeter* handle,
 
 #if __DL645_97_SUPPORT
 /**
- * \brief ȡA(97汾)
- * \param[in]  handle   : ָʵ
- * \param[in]  phase    : ȡ࣬0-A࣬1-B࣬2-C
- * \param[out] p_curr   : ָŵıλ0.01A
+ * \brief 获取A相电流(97年版本)
+ * \param[in]  handle   : 指向电表的实例
+ * \param[in]  phase    : 获取的相，0-A相，1-B相，2-C相
+ * \param[out] p_curr   : 指向存放电流的变量，单位0.01A
  *
- * \return AW_OK    : ȡɹ
- * \return AW_ERROR : ȡʧ
+ * \return AW_OK    : 获取成功
+ * \return AW_ERROR : 获取失败
  */
 aw_local aw_err_t __dl645_97_current_get(struct aw_ammeter* handle,
                                            uint8_t            phase,
@@ -629,13 +629,13 @@ aw_local aw_err_t __dl645_97_current_get(struct aw_ammeter* handle,
     buf[0] = (uint8_t) __DL645_97_CTRL_CODE_DATGET;
     buf[1] = (uint8_t)__DL645_97_DATAID_A_CURR + phase;
     buf[2] = (uint8_t)(__DL645_97_DATAID_A_CURR >> 8);
-    /*  */
+    /* 发送请求 */
     if (AW_OK != p_ammeter_dc->p_transfer->pfn_send(p_ammeter_dc->p_transfer,
                                                     buf,
                                                     3)) {
         return  AW_ERROR;
     }
-    /* ȡ */
+    /* 读取数据 */
     if (0 > (len = p_ammeter_dc->p_transfer->pfn_receive(p_ammeter_dc->p_transfer,
                                                          buf,
                                                          sizeof(buf)))) {
@@ -654,13 +654,13 @@ aw_local aw_err_t __dl645_97_current_get(struct aw_ammeter* handle,
 }
 
 /**
- * \brief ȡAѹ97汾
- * \param[in]  handle   : ָʵ
- * \param[in]  phase    : ȡ࣬0-A࣬1-B࣬2-C
- * \param[out] p_vol    : ָѹıλV
+ * \brief 获取A相电压（97年版本）
+ * \param[in]  handle   : 指向电表的实例
+ * \param[in]  phase    : 获取的相，0-A相，1-B相，2-C相
+ * \param[out] p_vol    : 指向存放压的变量，单位V
  *
- * \return AW_OK    : ȡɹ
- * \return AW_ERROR : ȡʧ
+ * \return AW_OK    : 获取成功
+ * \return AW_ERROR : 获取失败
  */
 aw_local aw_err_t __dl645_97_vol_get(struct aw_ammeter* handle,
                                      uint8_t            phase,
@@ -679,13 +679,13 @@ aw_local aw_err_t __dl645_97_vol_get(struct aw_ammeter* handle,
     buf[0] = (uint8_t) __DL645_97_CTRL_CODE_DATGET;
     buf[1] = (uint8_t)__DL645_97_DATAID_A_VOL + phase;
     buf[2] = (uint8_t)(__DL645_97_DATAID_A_VOL >> 8);
-    /*  */
+    /* 发送请求 */
     if (AW_OK != p_ammeter_dc->p_transfer->pfn_send(p_ammeter_dc->p_transfer,
                                                     buf,
                                                     3)) {
         return  AW_ERROR;
     }
-    /* ȴӦ */
+    /* 等待响应 */
     if (0 > (len = p_ammeter_dc->p_transfer->pfn_receive(p_ammeter_dc->p_transfer,
                                                          buf,
                                                          sizeof(buf)))) {
@@ -704,12 +704,12 @@ aw_local aw_err_t __dl645_97_vol_get(struct aw_ammeter* handle,
 }
 
 /**
- * \brief ȡ˲ʱʣ97汾
- * \param[in]  handle   : ָʵ
- * \param[out] p_power  : ָŹʵıλkW
+ * \brief 获取瞬时功率（97年版本）
+ * \param[in]  handle   : 指向电表的实例
+ * \param[out] p_power  : 指向存放功率的变量，单位kW
  *
- * \return AW_OK    : ȡɹ
- * \return AW_ERROR : ȡʧ
+ * \return AW_OK    : 获取成功
+ * \return AW_ERROR : 获取失败
  */
 aw_local aw_err_t __dl645_97_power_get(struct aw_ammeter* handle,
                                        uint32_t          *p_power)
@@ -727,13 +727,13 @@ aw_local aw_err_t __dl645_97_power_get(struct aw_ammeter* handle,
     buf[0] = (uint8_t)__DL645_97_CTRL_CODE_DATGET;
     buf[1] = (uint8_t)__DL645_97_DATAID_POWER ;
     buf[2] = (uint8_t)(__DL645_97_DATAID_POWER >> 8);
-    /*  */
+    /* 发送请求 */
     if (AW_OK != p_ammeter_dc->p_transfer->pfn_send(p_ammeter_dc->p_transfer,
                                                     buf,
                                                     3)) {
         return  AW_ERROR;
     }
-    /* ȡ */
+    /* 读取数据 */
     if (0 > (len = p_ammeter_dc->p_transfer->pfn_receive(p_ammeter_dc->p_transfer,
                                                          buf,
                                                          sizeof(buf)))) {
@@ -754,10 +754,10 @@ aw_local aw_err_t __dl645_97_power_get(struct aw_ammeter* handle,
 #endif
 
 /**
- * \brief DL645Эͨʵʼ
- * \param[in]  handle  : ָʵ
- * \return AW_OK       : ʼɹ
- * \return -AW_EINVAL  : 
+ * \brief DL645协议通信实例初始化
+ * \param[in]  handle  : 指向电表的实例
+ * \return AW_OK       : 初始化成功
+ * \return -AW_EINVAL  : 参数错误
  */
 aw_err_t aw_ammeter_transfer_dl645_inst_init (aw_ammeter_transfer_t* handle)
 {
@@ -773,20 +773,20 @@ aw_err_t aw_ammeter_transfer_dl645_inst_init (aw_ammeter_transfer_t* handle)
     p_ammeter_transfer_dl645->super.pfn_send    = __dl645_send;
     p_ammeter_transfer_dl645->super.pfn_receive = __dl645_receive;
     
-    /* ڳʼ, 粨 115200 */
+    /* 串口初始化配置, 如波特率 115200 */
     aw_serial_ioctl(uart_num,
                     SIO_BAUD_SET, 
                    (void *)(p_ammeter_transfer_dl645->uart_buad));
-    /* ڲ 磺8 λ 1 ֹͣλżУ */
+    /* 串口参数 如：8 个数据位 1 个停止位，无奇偶校验 */
     aw_serial_ioctl(uart_num,
                     SIO_HW_OPTS_SET,
                     (void *)(p_ammeter_transfer_dl645->uart_format));
 
-    /* öȡʱʱ */
+    /* 设置读取超时时间 */
     aw_serial_ioctl(uart_num, AW_TIOCRDTIMEOUT, (void *)__DL645_RX_BYTE_TIMEOUT_CFG);
 
 
-    /* ǷʹRS485 */
+    /* 设置是否使能RS485 */
     aw_serial_ioctl(uart_num, AM_UART_RS485_ENABLE_SET, (void *)(
             (p_ammeter_transfer_dl645->rs485_en ? RS485_ENABLE:RS485_DISABLE)));
 
@@ -798,12 +798,12 @@ aw_err_t aw_ammeter_transfer_dl645_inst_init (aw_ammeter_transfer_t* handle)
 #if __MODBUS_SUPPORT
 
 /**
- * \brief ȡǰйܣλ0.01 KWh (modbusЭʵֻȡ)
- * \param[in]  handle   : ָʵ
- * \param[out] p_energy : ָŵı
+ * \brief 获取当前正向有功电能，单位0.01 KWh (modbus协议实现获取)
+ * \param[in]  handle   : 指向电表的实例
+ * \param[out] p_energy : 指向存放电量的变量
  *
- * \return AW_OK    : ȡɹ
- * \return AW_ERROR : ȡʧ
+ * \return AW_OK    : 获取成功
+ * \return AW_ERROR : 获取失败
  */
 aw_local aw_err_t __dc_md_active_energy_get(struct aw_ammeter* handle,
                                             uint32_t          *p_energy)
@@ -813,7 +813,7 @@ aw_local aw_err_t __dc_md_active_energy_get(struct aw_ammeter* handle,
     aw_mb_err_t err     = AW_MB_ERR_NOERR;
     uint16_t    rbuf[2];
 
-    /* ּĴ---ӵַ1000ʼȡ20ּĴȡݷrd_buf */
+    /* 读保持寄存器---从地址1000开始，读取20个保持寄存器，读取数据放入rd_buf缓冲区 */
     err = aw_mb_holding_reg_read(p_ammeter_transfer_mb->master,
                                  p_ammeter_dc->p_transfer->p_addr[0],
                                  0x2000,
@@ -834,12 +834,12 @@ aw_local aw_err_t __dc_md_active_energy_get(struct aw_ammeter* handle,
 }
 
 /**
- * \brief ȡǰѹλ0.01V (modbusЭʵֻȡ)
- * \param[in]  handle   : ָʵ
- * \param[out] p_vol    : ָŵѹı
+ * \brief 获取当前电压，单位0.01V (modbus协议实现获取)
+ * \param[in]  handle   : 指向电表的实例
+ * \param[out] p_vol    : 指向存放电压的变量
  *
- * \return AW_OK    : ȡɹ
- * \return AW_ERROR : ȡʧ
+ * \return AW_OK    : 获取成功
+ * \return AW_ERROR : 获取失败
  */
 aw_local aw_err_t __dc_md_voltage_get(struct aw_ammeter* handle,
                                       int32_t           *p_vol)
@@ -849,7 +849,7 @@ aw_local aw_err_t __dc_md_voltage_get(struct aw_ammeter* handle,
     aw_mb_err_t err     = AW_MB_ERR_NOERR;
     uint16_t    rbuf[2];
 
-    /* ּĴ---ӵַ1000ʼȡ20ּĴȡݷrd_buf */
+    /* 读保持寄存器---从地址1000开始，读取20个保持寄存器，读取数据放入rd_buf缓冲区 */
     err = aw_mb_holding_reg_read(p_ammeter_transfer_mb->master,
                                  p_ammeter_dc->p_transfer->p_addr[0],
                                  0x1000,
@@ -866,7 +866,7 @@ aw_local aw_err_t __dc_md_voltage_get(struct aw_ammeter* handle,
 }
 
 /**
- * \brief վ߳
+ * \brief 主站接收线程
  */
 aw_local void __aw_ammeter_task_modbus_poll (aw_mb_master_t master)
 {
@@ -883,11 +883,11 @@ aw_local void __aw_ammeter_task_modbus_poll (aw_mb_master_t master)
 }
 
 /**
- * \brief modbusЭͨʵʼ
- * \param[in]  handle  : ָʵ
- * \return AW_OK       : ʼɹ
- * \return -AW_EINVAL  : 
- * \return  AW_ERROR   : ʼʧ
+ * \brief 电表modbus协议通信实例初始化
+ * \param[in]  handle  : 指向电表的实例
+ * \return AW_OK       : 初始化成功
+ * \return -AW_EINVAL  : 参数错误
+ * \return  AW_ERROR   : 初始化失败
  */
 aw_err_t aw_ammeter_transfer_mb_inst_init (aw_ammeter_transfer_t* handle)
 {
@@ -907,24 +907,24 @@ aw_err_t aw_ammeter_transfer_mb_inst_init (aw_ammeter_transfer_t* handle)
         AW_ERRF(("Modbus Master Create Failed\r\n"));
         return AW_ERROR;
     }
-    /* վΪRTUģʽôϢ */
+    /* 主站配置为RTU模式，配置串口信息 */
     err = aw_mb_master_config(master, AW_MB_RTU, p_ammeter_transfer_mb->p_ser_params);
     if (err != AW_MB_ERR_NOERR) {
         AW_ERRF(("Modbus Master Config Failed, err: %d!\r\n", err));
-        aw_mb_master_delete(master);  /* ʧܣɾվ */
+        aw_mb_master_delete(master);  /* 配置失败，删除主站 */
         return AW_ERROR;
     }
-    /* վ  */
+    /* 启动主站  */
     err = aw_mb_master_start(master);
     if (err != AW_MB_ERR_NOERR) {
         AW_ERRF(("Modbus Master Start Failed, err: %d\r\n", err));
         return AW_ERROR;
     }
-    tid = aw_task_create("task_modbus_poll",              /*  */
-                          26,                             /* ȼ */
-                          1024,                           /* ջС */
-                          __aw_ammeter_task_modbus_poll,  /* ں */
-                          (void *)master);                /* ڲ */
+    tid = aw_task_create("task_modbus_poll",              /* 任务名字 */
+                          26,                             /* 任务优先级 */
+                          1024,                           /* 任务堆栈大小 */
+                          __aw_ammeter_task_modbus_poll,  /* 任务入口函数 */
+                          (void *)master);                /* 任务入口参数 */
 
     p_ammeter_transfer_mb->master = master;
     p_ammeter_transfer_mb->tid    = tid;
@@ -933,12 +933,12 @@ aw_err_t aw_ammeter_transfer_mb_inst_init (aw_ammeter_transfer_t* handle)
 #endif
 
 /**
- * \brief ȡǰλ0.01 KWh
- * \param[in]  handle   : ָʵ
- * \param[out] p_energy : ָŵı
+ * \brief 获取当前电量，单位0.01 KWh
+ * \param[in]  handle   : 指向电表的实例
+ * \param[out] p_energy : 指向存放电量的变量
  *
- * \return AW_OK    : ȡɹ
- * \return AW_ERROR : ȡʧ
+ * \return AW_OK    : 获取成功
+ * \return AW_ERROR : 获取失败
  */
 aw_local aw_err_t __dc_active_energy_get(struct aw_ammeter* handle,
                                          uint32_t          *p_energy)
@@ -971,15 +971,15 @@ aw_local aw_err_t __dc_active_energy_get(struct aw_ammeter* handle,
 }
 
 /**
- * \brief ȡA
- * \param[in]  handle   : ָʵ
- * \param[in]  phase    : ȡ࣬0-A࣬1-B࣬2-C
- * \param[out] p_curr   : ָŵı
- *                        07汾λΪ0.001A
- *                        97汾λΪ0.01A
+ * \brief 获取A相电流
+ * \param[in]  handle   : 指向电表的实例
+ * \param[in]  phase    : 获取的相，0-A相，1-B相，2-C相
+ * \param[out] p_curr   : 指向存放电流的变量
+ *                        对于07年版本，单位为0.001A
+ *                        对于97年版本，单位为0.01A
  *
- * \return AW_OK    : ȡɹ
- * \return AW_ERROR : ȡʧ
+ * \return AW_OK    : 获取成功
+ * \return AW_ERROR : 获取失败
  */
 aw_local aw_err_t __dc_current_get(struct aw_ammeter* handle,
                                      uint8_t            phase,
@@ -1013,14 +1013,14 @@ aw_local aw_err_t __dc_current_get(struct aw_ammeter* handle,
 }
 
 /**
- * \brief ȡAѹ07汾
- * \param[in]  handle   : ָʵ
- * \param[in]  phase    : ȡ࣬0-A࣬1-B࣬2-C
- * \param[out] p_vol    : ָѹı
- * *                      07汾λΪ0.1V
- *                        97汾λΪV
- * \return AW_OK    : ȡɹ
- * \return AW_ERROR : ȡʧ
+ * \brief 获取A相电压（07年版本）
+ * \param[in]  handle   : 指向电表的实例
+ * \param[in]  phase    : 获取的相，0-A相，1-B相，2-C相
+ * \param[out] p_vol    : 指向存放压的变量
+ * *                      对于07年版本，单位为0.1V
+ *                        对于97年版本，单位为V
+ * \return AW_OK    : 获取成功
+ * \return AW_ERROR : 获取失败
  */
 aw_local aw_err_t __dc_vol_get(struct aw_ammeter* handle,
                                uint8_t            phase,
@@ -1056,10 +1056,10 @@ aw_local aw_err_t __dc_vol_get(struct aw_ammeter* handle,
 
 
 /**
- * \brief ͨʵʼ
- * \param[in]  handle  : ָָ
- * \return AW_OK       : ʼɹ
- * \return -AW_EINVAL  : 
+ * \brief 通信实例初始化
+ * \param[in]  handle  : 指向电表的指针
+ * \return AW_OK       : 初始化成功
+ * \return -AW_EINVAL  : 参数错误
  */
 aw_err_t aw_ammeter_transfer_inst_init (aw_ammeter_transfer_t* handle)
 {
@@ -1073,11 +1073,11 @@ aw_err_t aw_ammeter_transfer_inst_init (aw_ammeter_transfer_t* handle)
 
 
 /**
- * \brief һͨŸʽʼӦͨŶ
- * \param[in]  handle  : ָʵ
- * \return AW_OK       : ʼɹ
- * \return -AW_EINVAL  : 
- * \return -AW_ENOTSUP : Э鲻֧
+ * \brief 按照一定通信格式初始化对应通信对象
+ * \param[in]  handle  : 指向电表的实例
+ * \return AW_OK       : 初始化成功
+ * \return -AW_EINVAL  : 参数错误
+ * \return -AW_ENOTSUP : 协议不支持
  */
 aw_local aw_err_t __ammeter_transfer_factory (aw_ammeter_transfer_t* handle)
 {
@@ -1105,9 +1105,9 @@ aw_local aw_err_t __ammeter_transfer_factory (aw_ammeter_transfer_t* handle)
 }
 
 /**
- * \brief ʼ
- * \return AW_OK       : ʼɹ
- * \return -AW_EINVAL  : 
+ * \brief 电表初始化
+ * \return AW_OK       : 初始化成功
+ * \return -AW_EINVAL  : 参数错误
  */
 aw_err_t aw_ammeter_inst_init (aw_ammeter_t* handle)
 {
@@ -1120,9 +1120,9 @@ aw_err_t aw_ammeter_inst_init (aw_ammeter_t* handle)
 }
 
 /**
- * \brief ֱʼ
- * \return AW_OK       : ʼɹ
- * \return -AW_EINVAL  : 
+ * \brief 直流电表初始化
+ * \return AW_OK       : 初始化成功
+ * \return -AW_EINVAL  : 参数错误
  */
 aw_err_t aw_ammeter_dc_inst_init (aw_ammeter_t* handle)
 {
@@ -1134,14 +1134,14 @@ aw_err_t aw_ammeter_dc_inst_init (aw_ammeter_t* handle)
     aw_ammeter_inst_init(&(p_ammeter_dc->super));
     
     p_ammeter_dc->super.pfn_active_energy_get = __dc_active_energy_get;
-    /* ʼӦͨʵϢ */
+    /* 初始化对应的通信实例信息 */
     return  __ammeter_transfer_factory(p_ammeter_dc->p_transfer);
 }
 
 /**
- * \brief ֱȥʼ
- * \return AW_OK       : ʼɹ
- * \return -AW_EINVAL  : 
+ * \brief 直流电表去初始化
+ * \return AW_OK       : 初始化成功
+ * \return -AW_EINVAL  : 参数错误
  */
 aw_err_t aw_ammeter_dc_inst_deinit (aw_ammeter_t* handle)
 {
@@ -1153,29 +1153,29 @@ aw_err_t aw_ammeter_dc_inst_deinit (aw_ammeter_t* handle)
         return -AW_EINVAL;
     }
 #if __MODBUS_SUPPORT
-    /* ʹmodbusЭ飬ɾ߳Դ */
+    /* 如果使用modbus协议，删除线程资源 */
     if (p_ammeter_dc->p_transfer->protocol ==  AW_AMMETER_TRANSFER_PROTOCOL_MODBUS_RTU) {
 
         p_ammeter_transfer_mb = (aw_ammeter_transfer_mb_t *)(p_ammeter_dc->p_transfer);
         aw_task_terminate(p_ammeter_transfer_mb->tid);
     }
 #endif
-    /* ʼӦͨʵϢ */
+    /* 初始化对应的通信实例信息 */
     return  AW_OK;
 }
 
 
 
 /**
- * \brief ȡǰλ0.01 KWh
- * \param[in]  handle   : ָʵ
- * \param[out] p_energy : ָŵı
+ * \brief 获取当前电量，单位0.01 KWh
+ * \param[in]  handle   : 指向电表的实例
+ * \param[out] p_energy : 指向存放电量的变量
  *
- * \return AW_OK       : ȡɹ
- * \return AW_ERROR    : ȡʧ
- * \return -AW_EINVAL  : 
+ * \return AW_OK       : 获取成功
+ * \return AW_ERROR    : 获取失败
+ * \return -AW_EINVAL  : 参数错误
  *
- * \note ȡʧܣͨʧ1sڷأ3.Էֵʱ򲢲ܼʱӦ.
+ * \note 建议如果读取失败（如电表通信失败则在1s内返回），建议重试3次.测试发现电表有时候并不能及时作出回应.
  */
 aw_err_t aw_ammeter_active_energy_get(struct aw_ammeter* handle, uint32_t *p_energy)
 {
@@ -1188,14 +1188,14 @@ aw_err_t aw_ammeter_active_energy_get(struct aw_ammeter* handle, uint32_t *p_ene
 
 
 /**
- * \brief ȡѹλ0.1V
- * \param[in]  handle  : ָʵ
- * \param[in]  phase    : ȡ࣬0-A࣬1-B࣬2-C
- * \param[out] p_vol   : ָŵı
+ * \brief 获取电压，单位0.1V
+ * \param[in]  handle  : 指向电表的实例
+ * \param[in]  phase    : 获取的相，0-A相，1-B相，2-C相
+ * \param[out] p_vol   : 指向存放电量的变量
  *
- * \return AW_OK       : ȡɹ
- * \return AW_ERROR    : ȡʧ
- * \return -AW_EINVAL  : 
+ * \return AW_OK       : 获取成功
+ * \return AW_ERROR    : 获取失败
+ * \return -AW_EINVAL  : 参数错误
  */
 aw_err_t aw_ammeter_voltage_get(struct aw_ammeter* handle,
                                 uint8_t            phase,
@@ -1206,15 +1206,15 @@ aw_err_t aw_ammeter_voltage_get(struct aw_ammeter* handle,
 
 
 /**
- * \brief ȡA
- * \param[in]  handle  : ָʵ
- * \param[in]  phase    : ȡ࣬0-A࣬1-B࣬2-C
- * \param[out] p_curr  : ָŵı
- *                        07汾λΪ0.001A
- *                        97汾λΪ0.01A
+ * \brief 获取A相电流
+ * \param[in]  handle  : 指向电表的实例
+ * \param[in]  phase    : 获取的相，0-A相，1-B相，2-C相
+ * \param[out] p_curr  : 指向存放电流的变量
+ *                        对于07年版本，单位为0.001A
+ *                        对于97年版本，单位为0.01A
  *
- * \return AW_OK    : ȡɹ
- * \return AW_ERROR : ȡʧ
+ * \return AW_OK    : 获取成功
+ * \return AW_ERROR : 获取失败
  */
 aw_err_t aw_ammeter_current_get(struct aw_ammeter* handle,
                                 uint8_t            phase,
@@ -1225,11 +1225,11 @@ aw_err_t aw_ammeter_current_get(struct aw_ammeter* handle,
 
 
 /**
- * \brief ȡ
- * \param[in]  handle   : ָʵ
- * \param[out] p_power    : ָѹıλkW
- * \return AW_OK    : ȡɹ
- * \return AW_ERROR : ȡʧ
+ * \brief 获取功率
+ * \param[in]  handle   : 指向电表的实例
+ * \param[out] p_power    : 指向存放压的变量，单位kW
+ * \return AW_OK    : 获取成功
+ * \return AW_ERROR : 获取失败
  */
 aw_err_t aw_ammeter_power_get(struct aw_ammeter* handle, uint32_t *p_power)
 {
@@ -13,7 +13,7 @@
 
 /**
  * \file
- * \brief ͨѶ׼ӿ
+ * \brief 串口通讯标准接口
  *
  * \internal
  * \par modification history
@@ -34,6 +34,14 @@ extern "C" {
 #define  INTO_UPDATE_FLAG_ADDR          (LPC1778_IMAGE_VALID_ADDR + LPC1778_IMAGE_VALID_SIZE)
 #define  INTO_UPDATE_FLAG_SIZE          (1024 * 4)
 
+#define  CARD_WL_NVRAM_NAME             "CARD_WL"
+#define  CARD_WL_NVRAM_ADDR             (INTO_UPDATE_FLAG_ADDR + INTO_UPDATE_FLAG_SIZE)
+#define  CARD_WL_NVRAM_SIZE             (1024 * 4 * 8)
+
+#define  BLACKBOX_NVRAM_NAME            "BLACKBOX"
+#define  BLACKBOX_NVRAM_ADDR            (CARD_WL_NVRAM_ADDR + CARD_WL_NVRAM_SIZE)
+#define  BLACKBOX_NVRAM_SIZE            (1024 * 4 * 4)
+
 
 
 typedef  enum  device_id{
@@ -44,7 +52,7 @@ typedef  enum  device_id{
 
 
 #define  APP_RUN_START_BLK_NUM      18
-#define  APP_RUN_END_BLK_NUM        28          /* һ飬ڼ */
+#define  APP_RUN_END_BLK_NUM        28          /* 保留最后一个块，用于加密 */
 #define  APP_RUN_START_BLK_ADDR     0x00020000
 #define  APP_RUN_ADDR               APP_RUN_START_BLK_ADDR
 #define  APP_RUN_ADDR_SP            "0x20000"
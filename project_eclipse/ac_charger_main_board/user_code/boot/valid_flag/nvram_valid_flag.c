@@ -17,7 +17,7 @@
 
 #define  NVRAM_BUF_SIZE  (256)
 
-/*  SPI FLASH Ҫд 256 ֽڣҪһ */
+/* 由于 SPI FLASH 需要写 256 字节，所以需要开辟一个缓冲区 */
 aw_local char  __g_valid_buf[NVRAM_BUF_SIZE] = {0};
 
 aw_local aw_err_t  __nvram_valid_flag_set(struct valid_flag *p_valid, bool_t  is_valid)
@@ -35,7 +35,7 @@ aw_local aw_err_t  __nvram_valid_flag_set(struct valid_flag *p_valid, bool_t  is
         buf_size = NVRAM_BUF_SIZE;
     }
 
-    /* дЧλ */
+    /* 写有效位 */
     if (is_valid) {
         valid_key = VALID_FLAG_KEY;
     } else {
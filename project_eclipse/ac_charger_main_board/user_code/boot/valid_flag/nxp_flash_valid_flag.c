@@ -24,7 +24,7 @@ aw_local aw_err_t  __nxp_flash_valid_flag_get(struct valid_flag *p_valid, bool_t
 
     struct nxp_flash_valid_flag *p_nxp_flash_valid = (struct nxp_flash_valid_flag *)p_valid;
 
-    /* Сģʽ */
+    /* 小端模式 */
     valid_key |= ((p_nxp_flash_valid->copy_buf)[0] << 0);
     valid_key |= ((p_nxp_flash_valid->copy_buf)[1] << 8);
     valid_key |= ((p_nxp_flash_valid->copy_buf)[2] << 16);
@@ -55,7 +55,7 @@ aw_local aw_err_t  __nxp_flash_valid_flag_set(struct valid_flag *p_valid, bool_t
                                  g_system_clkfreq);
     AW_INT_CPU_UNLOCK(key);
 
-    /* дЧλ */
+    /* 写有效位 */
     if (is_valid) {
         valid_key = VALID_FLAG_KEY;
     } else {
@@ -64,7 +64,7 @@ aw_local aw_err_t  __nxp_flash_valid_flag_set(struct valid_flag *p_valid, bool_t
 
     AW_INT_CPU_LOCK(key);
 
-    /* Сģʽ */
+    /* 小端模式 */
     (p_nxp_flash_valid->copy_buf)[0] = valid_key&0xFF;
     (p_nxp_flash_valid->copy_buf)[1] = (valid_key>>8)&0xFF;
     (p_nxp_flash_valid->copy_buf)[2] = (valid_key>>16)&0xFF;
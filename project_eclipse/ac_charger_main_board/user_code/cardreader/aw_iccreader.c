@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief  ʵ
+ * \brief  电表操作实现
  *
  * \internal
  * \par modification history:
@@ -26,62 +26,63 @@
 #include "aw_delay.h"
 
 #include "aw_vdebug.h"
-#include "aw_task.h"                    /*  */
+#include "aw_task.h"                    /* 多任务服务 */
 #include <string.h>
 
-#define __ICC_RX_BYTE_TIMEOUT_CFG    5    /* յֽڳʱãλms */
-#define __ICC_RX_FRAME_TIMEOUT_CFG   1000 /* ֡ʱʱãλms */
+#define __ICC_RX_BYTE_TIMEOUT_CFG    5    /* 最大允许接收单字节超时配置，单位ms */
+#define __ICC_RX_FRAME_TIMEOUT_CFG   1000 /* 最大允许接收帧超时超时配置，单位ms */
 
 
-#define __ICC_START_CODE  (0x02u)  /* Эʼ     */
-#define __ICC_END_CODE    (0x03u)  /* Э     */
+#define __ICC_START_CODE  (0x02u)  /* 协议起始符     */
+#define __ICC_END_CODE    (0x03u)  /* 协议结束符     */
 
 
-#define __ICC_PROTOCOL_LENGTH 5     /**< \brief ͨѶ֡Эֽ */
-#define __ICC_INFO_MAX_LENGTH 265   /**< \brief ͨѶ֡ݵԪֽ(δAPDUֽҪ) */
-/** \brief ͨѶ֡ϢСֽ֡ʽ */
+#define __ICC_PROTOCOL_LENGTH 5     /**< \brief 通讯帧协议控制字节数 */
+#define __ICC_INFO_MAX_LENGTH 265   /**< \brief 通讯帧数据单元最大字节数(符合所有未被拉长处理的APDU包字节要求) */
+/** \brief 通讯帧信息最小字节数（新帧格式） */
 #define __ICC_PACKET_MIN_SIZE (__ICC_PROTOCOL_LENGTH)
-/** \brief ͨѶ֡Ϣֽ֡ʽ*/
+/** \brief 通讯帧信息最大字节数（新帧格式）*/
 #define __ICC_PACKET_MAX_SIZE (__ICC_PROTOCOL_LENGTH + __ICC_INFO_MAX_LENGTH)
 
 #define __ICC_CMD_EXE_STATE(rbuf, rlen) \
                             ((rbuf[rlen - 2] == 0) && \
                              (rbuf[rlen - 1] == 0))
 
-#define __CMD_S50S70_KEY_AUTH   0x0246 /* ֱԿ֤ */
-#define __CMD_S50S70_BLK_READ   0x0247 /*  */
-#define __CMD_S50S70_BLK_WRITE  0x0248 /* д */
-#define __CMD_S50S70_VAL_OPT    0x024A /* ֵ */
-#define __CMD_S50S70_VAL_SET    0x0250 /* ֵ */
-#define __CMD_S50S70_VAL_GET    0x0251 /* ֵȡ */
+#define __CMD_S50S70_KEY_AUTH   0x0246 /* 直接密钥认证 */
+#define __CMD_S50S70_BLK_READ   0x0247 /* 块读 */
+#define __CMD_S50S70_BLK_WRITE  0x0248 /* 块写 */
+#define __CMD_S50S70_VAL_OPT    0x024A /* 值操作 */
+#define __CMD_S50S70_VAL_SET    0x0250 /* 值设置 */
+#define __CMD_S50S70_VAL_GET    0x0251 /* 值获取 */
+#define __CMD_AUTO_DETECT       0x024E /* 自动检测 */
 
-#define __CMD_CTRL_BAUD_SET     0x3001 /*  */
-#define __CMD_CTRL_INFO_GET     0x3111 /* Ϣȡ */
-#define __CMD_CTRL_BUZZER_SET   0x3113 /*  */
-#define __CMD_CTRL_LED_SET      0x3114 /* LED */
-#define __CMD_CTRL_RF_OPEN      0x3190 /* Ƶ */
-#define __CMD_CTRL_RF_CLOSE     0x3191 /* رƵ */
+#define __CMD_CTRL_BAUD_SET     0x3001 /* 波特率设置 */
+#define __CMD_CTRL_INFO_GET     0x3111 /* 信息获取 */
+#define __CMD_CTRL_BUZZER_SET   0x3113 /* 蜂鸣器设置 */
+#define __CMD_CTRL_LED_SET      0x3114 /* LED设置 */
+#define __CMD_CTRL_RF_OPEN      0x3190 /* 打开射频 */
+#define __CMD_CTRL_RF_CLOSE     0x3191 /* 关闭射频 */
 
-#define __CMD_CARD_POWER_ON     0x3222 /* Ӵϵ */
-#define __CMD_CARD_POWER_OFF    0x3223 /* Ӵ */
-#define __CMD_CARD_ACTIVE       0x3224 /* ǽӴ */
-#define __CMD_CARD_APDU         0x3226 /* APDU */
+#define __CMD_CARD_POWER_ON     0x3222 /* 接触卡上电 */
+#define __CMD_CARD_POWER_OFF    0x3223 /* 接触卡掉电 */
+#define __CMD_CARD_ACTIVE       0x3224 /* 激活非接触卡 */
+#define __CMD_CARD_APDU         0x3226 /* APDU命令传输 */
 
 
 /** 
- * \brief ͨڷ
- * \param [in] handle  : ʵ
- * \param [in] p_txbuf : ݻ
- *                       p_txbuf[0] ̶ڿʹ
- * \param [in] nbytes  : ֽ
- *                       nbytes 0Ϊһ룩
+ * \brief 通过串口发送数据
+ * \param [in] handle  : 读卡器实例
+ * \param [in] p_txbuf : 发送数据缓冲区
+ *                       p_txbuf[0] 固定用于控制码使用
+ * \param [in] nbytes  : 发送字节数
+ *                       nbytes 比须大于0（因为至少有一个控制码）
  *
- * \return AW_OK      : ͨųɹ
- * \return -AW_EINVAL : 
- * \return -AW_EIO    : ӲͨIOʹ
+ * \return AW_OK      : 通信成功
+ * \return -AW_EINVAL : 参数错误
+ * \return -AW_EIO    : 硬件通信IO发送错误
  * 
- * \note Эͨ÷ͽӿڣԶ֡ͷַԼУϢ
- *      ûֻĴ͵Ŀ룬Լݱʶ򣩼
+ * \note 协议数据通用发送接口，函数自动添加帧头、地址以及校验信息，
+ *      用户只需关心待发送的控制码，以及数据标识（数据域）即可
  */
 aw_local aw_err_t __serial_send(struct aw_iccreader* handle,
                                 const uint8_t       *p_txbuf,
@@ -89,7 +90,7 @@ aw_local aw_err_t __serial_send(struct aw_iccreader* handle,
 {
     uint8_t tx_data[__ICC_PACKET_MAX_SIZE];
     uint32_t i   = 0;
-    uint8_t  sum = 0;  /* 8λУ */
+    uint8_t  sum = 0;  /* 8位校验和 */
     
     if ((NULL == handle)||
         (NULL == handle->p_transfer) ||
@@ -111,7 +112,7 @@ aw_local aw_err_t __serial_send(struct aw_iccreader* handle,
     tx_data[5 + (nbytes-2)] = sum;
     tx_data[5 + (nbytes-2) + 1] = __ICC_END_CODE;
     
-    /* ֡ */
+    /* 发送数据帧 */
     if ((nbytes + 5) != aw_serial_poll_write(handle->p_transfer->uart_num,
                                               (char *)tx_data,
                                               nbytes + 5)) {
@@ -122,17 +123,17 @@ aw_local aw_err_t __serial_send(struct aw_iccreader* handle,
 
 
 /**
- * \brief Ӵжȡ
- * \param [in] handle    : ʵ
- * \param [out] p_rxbuf  : 洢ݵָ
- * \param [in]  nbytes   : ո
- * \param [in]  timeout  : ʱʱ䣬λms
+ * \brief 从串口中读取数据
+ * \param [in] handle    : 读卡器实例
+ * \param [out] p_rxbuf  : 存储数据的指针
+ * \param [in]  nbytes   : 接收个数
+ * \param [in]  timeout  : 最大允许超时时间，单位ms
  *
- * \return   >0          : ʵʶȡֽ
- * \return -AW_ETIMEDOUT : ʱ
- * \return -AW_ENOMEM    : ջp_rxbufռ䲻
+ * \return   >0          : 实际读取的字节数
+ * \return -AW_ETIMEDOUT : 超时错误
+ * \return -AW_ENOMEM    : 接收缓冲区p_rxbuf空间不足
  *
- * \note ճɹp_rxbuf[nbytes-1],p_rxbuf[nbytes-2]Ϊյ״̬
+ * \note 若接收成功，p_rxbuf[nbytes-1],p_rxbuf[nbytes-2]为接收的状态字
  */
 aw_local int __recevie_timeout (struct aw_iccreader* handle,
                                  uint8_t  *p_rxbuf,
@@ -140,13 +141,13 @@ aw_local int __recevie_timeout (struct aw_iccreader* handle,
                                  uint32_t  timeout)
 
 {
-#define __ICC_STATE_START_CODE_FIND   0  /* Эͷ */
-#define __ICC_STATE_CTRL_CODE_GET     1  /* ȡ  */
-#define __ICC_STATE_DAT_GET           2  /* ȡ УԼ */
+#define __ICC_STATE_START_CODE_FIND   0  /* 查找协议头 */
+#define __ICC_STATE_CTRL_CODE_GET     1  /* 获取控制吗  */
+#define __ICC_STATE_DAT_GET           2  /* 获取数据域 和校验和以及结束符 */
 
     uint32_t uart_num;
     int      state = __ICC_STATE_START_CODE_FIND;
-    int      cnt   = 0; /* ĿǰЭݵļ */
+    int      cnt   = 0; /* 目前协议数据的计数 */
     uint8_t rx_data[__ICC_PACKET_MAX_SIZE], sum;
     aw_tick_t start_ticks, end_ticks;
     uint32_t  timeout_ms;
@@ -159,18 +160,22 @@ aw_local int __recevie_timeout (struct aw_iccreader* handle,
     while (1) {
 
         if (__ICC_STATE_START_CODE_FIND == state) {
-            /* ֡ʼʱҪӦʱ*/
+            /* 帧起始时，要检测回应超时*/
             end_ticks  = aw_sys_tick_get();
             timeout_ms = aw_ticks_to_ms(end_ticks - start_ticks);
             if (timeout_ms > timeout) {
                 return -AW_ETIMEDOUT;
             }
+            /* 在串口接收中断中等待帧起始，而非按字节超时轮询 */
+            aw_serial_ioctl(uart_num,
+                            AW_TIOCRDTIMEOUT,
+                            (void *)(timeout - timeout_ms + 1));
         }
 
-        /* ȡ֡ʼ͵ַһ֡12ֽ */
+        /* 读取帧起始符和地址，一帧至少是12个字节 */
         if (0 >= (rlen_tmp = aw_serial_read(uart_num, (char *)p_rbuf, rlen))) {
             if (__ICC_STATE_START_CODE_FIND != state) {
-                /* ֡ʼҪֽڳʱ*/
+                /* 帧起始后，要检测字节超时*/
                 return -AW_ETIMEDOUT;
             }
             continue;
@@ -183,6 +188,9 @@ aw_local int __recevie_timeout (struct aw_iccreader* handle,
         switch (state) {
         case __ICC_STATE_START_CODE_FIND:
              if (rx_data[0] == __ICC_START_CODE) {
+                 aw_serial_ioctl(uart_num,
+                                 AW_TIOCRDTIMEOUT,
+                                 (void *)__ICC_RX_BYTE_TIMEOUT_CFG);
                  rlen = 4;
                  p_rbuf = &rx_data[1];
                  state = __ICC_STATE_CTRL_CODE_GET;
@@ -201,21 +209,21 @@ aw_local int __recevie_timeout (struct aw_iccreader* handle,
         case __ICC_STATE_DAT_GET:
             rlen = (rx_data[1] << 8) | (rx_data[2]);
             if (__ICC_END_CODE != rx_data[rlen + 4]) {
-                return AW_ERROR; /* ֡ʽ */
+                return AW_ERROR; /* 帧格式错误 */
             }
 
 //            if (rlen != nbytes) {
-//                return AW_ERROR; /* ֡ʽ */
+//                return AW_ERROR; /* 帧格式错误 */
 //            }
 
-            /* У */
+            /* 计算校验和 */
             sum  = rx_data[3];
             for (cnt = 1; cnt < rlen; cnt++) {
                 sum ^= rx_data[3 + cnt];
             }
 
             if (sum != rx_data[rlen + 3]) {
-                return AW_ERROR;  /* ֡ʽ */
+                return AW_ERROR;  /* 帧格式错误 */
             }
 
             memcpy(p_rxbuf, &rx_data[5], rlen-2);
@@ -230,20 +238,20 @@ aw_local int __recevie_timeout (struct aw_iccreader* handle,
     return AW_ERROR;
 }
 /** 
- * \brief 
- * \param [in] handle  : ʵ
- * \param [in] p_rxbuf : ݻ
- * \param [in] nbytes  : ֽ
+ * \brief 接收数据
+ * \param [in] handle  : 读卡器实例
+ * \param [in] p_rxbuf : 接收数据缓冲区
+ * \param [in] nbytes  : 接收字节数
  *
- * \return   >0          : ʵʶȡֽ
- * \return -AW_EINVAL : 
- * \return -AW_ETIMEDOUT : ʱ
+ * \return   >0          : 实际读取的字节数
+ * \return -AW_EINVAL : 参数错误
+ * \return -AW_ETIMEDOUT : 超时错误
  *
- * \note ͨýսӿڣʶ֡ͷַԼУϢ
- *      ûֻĽյĿ룬Լݣݱʶ.
- *    ճɹp_rxbuf[nbytes-2], p_rxbuf[nbytes-1]Ϊյ״̬
- *    ݸʽ
- *      | ״̬֣2ֽڣ
+ * \note 数据通用接收接口，函数复制识别帧头，地址以及校验信息，
+ *      用户只需关心接收到的控制码，以及数据（包括数据标识）即可.
+ *    若接收成功，p_rxbuf[nbytes-2], p_rxbuf[nbytes-1]为接收的状态字
+ *    返回数据格式
+ *     数据域 | 状态字（2字节）
  *
  */
 aw_local int __serial_receive(struct aw_iccreader* handle,
@@ -262,18 +270,18 @@ aw_local int __serial_receive(struct aw_iccreader* handle,
 
 
 /**
- * \brief 
- * \param[in]  handle   : ָʵ
- * \param[in]  cmd      : 
- * \param[in]  p_txbuf  : ͻ
- * \param[in]  tlen     : ͻ
- * \param[out] p_rxbuf  : ջ
- * \param[in]  rlen     : ջ
+ * \brief 传输数据
+ * \param[in]  handle   : 指向读卡器的实例
+ * \param[in]  cmd      : 命令类型
+ * \param[in]  p_txbuf  : 发送缓冲器
+ * \param[in]  tlen     : 发送缓冲器长度
+ * \param[out] p_rxbuf  : 接收缓冲器
+ * \param[in]  rlen     : 接收缓冲器长度
  *
- * \return AW_OK       : ȡɹ
- * \return AW_ERROR    : ȡʧ
- * \return -AW_EINVAL  : 
- * \return -AW_EPERM   : 豸Ӧ쳣֡
+ * \return AW_OK       : 获取成功
+ * \return AW_ERROR    : 获取失败
+ * \return -AW_EINVAL  : 参数错误
+ * \return -AW_EPERM   : 操作不允许（设备回应了异常帧）
  */
 aw_err_t aw_iccreader_transfer(struct aw_iccreader* handle,
                                uint32_t  cmd,
@@ -300,17 +308,17 @@ aw_err_t aw_iccreader_transfer(struct aw_iccreader* handle,
     buf[0] = (uint8_t)(cmd >> 8);
     buf[1] = (uint8_t)(cmd >> 0);
     memcpy(&buf[2], p_txbuf, tlen);
-    /*  */
+    /* 发送请求 */
     if (AW_OK != handle->pfn_send(handle, buf, 2+tlen)) {
         return  AW_ERROR;
     }
-    /* ȡ */
+    /* 读取数据 */
     if (0 > (len = handle->pfn_receive(handle, buf, 2+rlen))) {
         return  AW_ERROR;
     }
 
     if (!__ICC_CMD_EXE_STATE(buf, len)) {
-        /* 쳣Ӧ֡ */
+        /* 异常回应帧 */
         //memcpy(p_rxbuf, &buf[len-2], 2);
         return -AW_EPERM;
     }
@@ -319,19 +327,19 @@ aw_err_t aw_iccreader_transfer(struct aw_iccreader* handle,
 }
 
 /**
- * \brief öģͨŲ
- * \param[in]  handle    : ָʵ
- * \param[in]  baud_code : ʴ
+ * \brief 设置读卡器模块通信波特率
+ * \param[in]  handle    : 指向读卡器的实例
+ * \param[in]  baud_code : 波特率代号
  *                         0x00 : 9600
  *                         0x01 : 19200
  *                         0x02 : 38400
  *                         0x03 : 57600
  *                         0x04 : 115200
  *
- * \return AW_OK       : ȡɹ
- * \return AW_ERROR    : ȡʧ
- * \return -AW_EINVAL  : 
- * \return -AW_EPERM   : 豸Ӧ쳣֡
+ * \return AW_OK       : 获取成功
+ * \return AW_ERROR    : 获取失败
+ * \return -AW_EINVAL  : 参数错误
+ * \return -AW_EPERM   : 操作不允许（设备回应了异常帧）
  */
 aw_err_t aw_iccreader_baud_set (struct aw_iccreader* handle, uint8_t baud_code)
 {
@@ -339,15 +347,15 @@ aw_err_t aw_iccreader_baud_set (struct aw_iccreader* handle, uint8_t baud_code)
 }
 
 /**
- * \brief ȡ汾Ϣ
- * \param[in]  handle    : ָʵ
- * \param[in]  p_rxbuf   : Ű汾ϢĻ
- * \param[in]  rlen      : ȡ汾Ϣֽ
+ * \brief 获取读卡器版本信息
+ * \param[in]  handle    : 指向读卡器的实例
+ * \param[in]  p_rxbuf   : 存放版本信息的缓冲器
+ * \param[in]  rlen      : 读取版本信息的字节数
  *
- * \return AW_OK       : ȡɹ
- * \return AW_ERROR    : ȡʧ
- * \return -AW_EINVAL  : 
- * \return -AW_EPERM   : 豸Ӧ쳣֡
+ * \return AW_OK       : 获取成功
+ * \return AW_ERROR    : 获取失败
+ * \return -AW_EINVAL  : 参数错误
+ * \return -AW_EPERM   : 操作不允许（设备回应了异常帧）
  */
 aw_err_t aw_iccreader_info_get (struct aw_iccreader* handle, void *p_rxbuf, uint32_t rlen)
 {
@@ -355,15 +363,15 @@ aw_err_t aw_iccreader_info_get (struct aw_iccreader* handle, void *p_rxbuf, uint
 }
 
 /**
- * \brief ȡ汾Ϣ
- * \param[in]  handle    : ָʵ
- * \param[in]  dlytime   : ʱ
- * \param[in]  times     : 
+ * \brief 获取读卡器版本信息
+ * \param[in]  handle    : 指向读卡器的实例
+ * \param[in]  dlytime   : 蜂鸣器鸣响时间
+ * \param[in]  times     : 蜂鸣器鸣响次数
  *
- * \return AW_OK       : ȡɹ
- * \return AW_ERROR    : ȡʧ
- * \return -AW_EINVAL  : 
- * \return -AW_EPERM   : 豸Ӧ쳣֡
+ * \return AW_OK       : 获取成功
+ * \return AW_ERROR    : 获取失败
+ * \return -AW_EINVAL  : 参数错误
+ * \return -AW_EPERM   : 操作不允许（设备回应了异常帧）
  */
 aw_err_t aw_iccreader_buzzer_set (struct aw_iccreader* handle, uint16_t dlytime, uint8_t times)
 {
@@ -373,15 +381,15 @@ aw_err_t aw_iccreader_buzzer_set (struct aw_iccreader* handle, uint16_t dlytime,
 }
 
 /**
- * \brief LED״̬
- * \param[in]  handle    : ָʵ
- * \param[in]  led1_en   :LED1ƣTRUE-ƣFALSE-
- * \param[in]  led2_en   :LED2ƣTRUE-ƣFALSE-
+ * \brief 控制LED状态
+ * \param[in]  handle    : 指向读卡器的实例
+ * \param[in]  led1_en   :LED1控制：TRUE-亮灯，FALSE-灭灯
+ * \param[in]  led2_en   :LED2控制：TRUE-亮灯，FALSE-灭灯
  *
- * \return AW_OK       : ȡɹ
- * \return AW_ERROR    : ȡʧ
- * \return -AW_EINVAL  : 
- * \return -AW_EPERM   : 豸Ӧ쳣֡
+ * \return AW_OK       : 获取成功
+ * \return AW_ERROR    : 获取失败
+ * \return -AW_EINVAL  : 参数错误
+ * \return -AW_EPERM   : 操作不允许（设备回应了异常帧）
  */
 aw_err_t aw_iccreader_led_set (struct aw_iccreader* handle, bool_t led1_en, bool_t led2_en)
 {
@@ -391,49 +399,67 @@ aw_err_t aw_iccreader_led_set (struct aw_iccreader* handle, bool_t led1_en, bool
 }
 
 /**
- * \brief Ƶ
- * \param[in]  handle    : ָʵ
+ * \brief 打开射频
+ * \param[in]  handle    : 指向读卡器的实例
  *
- * \return AW_OK       : ȡɹ
- * \return AW_ERROR    : ȡʧ
- * \return -AW_EINVAL  : 
- * \return -AW_EPERM   : 豸Ӧ쳣֡
+ * \return AW_OK       : 获取成功
+ * \return AW_ERROR    : 获取失败
+ * \return -AW_EINVAL  : 参数错误
+ * \return -AW_EPERM   : 操作不允许（设备回应了异常帧）
  */
 aw_err_t aw_iccreader_rf_open (struct aw_iccreader* handle)
 {
-    return aw_iccreader_transfer(handle, __CMD_CTRL_RF_OPEN, NULL, 0, NULL, 0);
+    aw_err_t ret;
+
+    if ((NULL != handle) && handle->rf_on) {
+        return AW_OK;
+    }
+    ret = aw_iccreader_transfer(handle, __CMD_CTRL_RF_OPEN, NULL, 0, NULL, 0);
+    if (AW_OK == ret) {
+        handle->rf_on = TRUE;
+    }
+    return ret;
 }
 
 
 /**
- * \brief رƵ
- * \param[in]  handle    : ָʵ
+ * \brief 关闭射频
+ * \param[in]  handle    : 指向读卡器的实例
  *
- * \return AW_OK       : ȡɹ
- * \return AW_ERROR    : ȡʧ
- * \return -AW_EINVAL  : 
- * \return -AW_EPERM   : 豸Ӧ쳣֡
+ * \return AW_OK       : 获取成功
+ * \return AW_ERROR    : 获取失败
+ * \return -AW_EINVAL  : 参数错误
+ * \return -AW_EPERM   : 操作不允许（设备回应了异常帧）
  */
 aw_err_t aw_iccreader_rf_close (struct aw_iccreader* handle)
 {
-    return aw_iccreader_transfer(handle, __CMD_CTRL_RF_CLOSE, NULL, 0, NULL, 0);
+    aw_err_t ret;
+
+    if ((NULL != handle) && !handle->rf_on) {
+        return AW_OK;
+    }
+    ret = aw_iccreader_transfer(handle, __CMD_CTRL_RF_CLOSE, NULL, 0, NULL, 0);
+    if (AW_OK == ret) {
+        handle->rf_on = FALSE;
+    }
+    return ret;
 }
 
 /**
- * \brief ֱԿ֤
- * \param [in] handle   : ָʵ
- * \param [in] key_type : Կͣ ԿA #AW_ICCREADER_KEY_AUTH_KEYTYPE_KEYA
- *                                 ԿB #AW_ICCREADER_KEY_AUTH_KEYTYPE_KEYB
- * \param [in] p_uid    : UID
- * \param [in] uid_len  : UIDĳ( ֻ4ֽ)
- * \param [in] p_uid    : Կ
- * \param [in] uid_len  : Կĳ( ֻ616ֽ)
- * \param [in] block    : ֤
+ * \brief 卡直接密钥验证
+ * \param [in] handle   : 指向读卡器的实例
+ * \param [in] key_type : 密钥类型， 密钥A #AW_ICCREADER_KEY_AUTH_KEYTYPE_KEYA
+ *                                 密钥B #AW_ICCREADER_KEY_AUTH_KEYTYPE_KEYB
+ * \param [in] p_uid    : 卡的UID缓冲区
+ * \param [in] uid_len  : 卡的UID的长度( 只能是4个字节)
+ * \param [in] p_uid    : 密钥
+ * \param [in] uid_len  : 密钥的长度( 只能是6或16个字节)
+ * \param [in] block    : 验证块
  *
- * \return AW_OK       : ȡɹ
- * \return AW_ERROR    : ȡʧ
- * \return -AW_EINVAL  : 
- * \return -AW_EPERM   : 豸Ӧ쳣֡
+ * \return AW_OK       : 获取成功
+ * \return AW_ERROR    : 获取失败
+ * \return -AW_EINVAL  : 参数错误
+ * \return -AW_EPERM   : 操作不允许（设备回应了异常帧）
  */
 aw_err_t aw_iccreader_key_auth (struct aw_iccreader* handle,
                                 uint8_t              key_type,
@@ -454,15 +480,15 @@ aw_err_t aw_iccreader_key_auth (struct aw_iccreader* handle,
 }
 
 /**
- * \brief ȡĳ
- * \param [in] handle   : ICʵ
- * \param [in] block    : ֤
- * \param [out] p_buf   : ǿĳȣ16ֽڣ
+ * \brief 读取某块的数据
+ * \param [in] handle   : IC卡读卡器的实例
+ * \param [in] block    : 验证块
+ * \param [out] p_buf   : 缓冲区，长度是块的长度（16字节）
  *
- * \return AW_OK       : ȡɹ
- * \return AW_ERROR    : ȡʧ
- * \return -AW_EINVAL  : 
- * \return -AW_EPERM   : 豸Ӧ쳣֡
+ * \return AW_OK       : 获取成功
+ * \return AW_ERROR    : 获取失败
+ * \return -AW_EINVAL  : 参数错误
+ * \return -AW_EPERM   : 操作不允许（设备回应了异常帧）
  */
 aw_err_t aw_iccreader_block_read (struct aw_iccreader *handle,
                                   uint8_t             *p_buf,
@@ -472,15 +498,15 @@ aw_err_t aw_iccreader_block_read (struct aw_iccreader *handle,
 }
 
 /**
- * \brief дĳ
- * \param [in] handle   : ICʵ
- * \param [in] block    : ֤
- * \param [out] p_buf   : ǿĳȣ16ֽڣ
+ * \brief 写某块的数据
+ * \param [in] handle   : IC卡读卡器的实例
+ * \param [in] block    : 验证块
+ * \param [out] p_buf   : 缓冲区，长度是块的长度（16字节）
  *
- * \return AW_OK       : ȡɹ
- * \return AW_ERROR    : ȡʧ
- * \return -AW_EINVAL  : 
- * \return -AW_EPERM   : 豸Ӧ쳣֡
+ * \return AW_OK       : 获取成功
+ * \return AW_ERROR    : 获取失败
+ * \return -AW_EINVAL  : 参数错误
+ * \return -AW_EPERM   : 操作不允许（设备回应了异常帧）
  */
 aw_err_t aw_iccreader_block_write (struct aw_iccreader *handle,
                                    uint8_t             *p_buf,
@@ -494,14 +520,14 @@ aw_err_t aw_iccreader_block_write (struct aw_iccreader *handle,
 }
 
 /**
- * \brief s50s70
- * \param [in] handle   : ICʵ
- * \param [in] aw_iccreader_s50s70_ci_t    : Ϣ
+ * \brief 激活s50s70卡
+ * \param [in] handle   : IC卡读卡器的实例
+ * \param [in] aw_iccreader_s50s70_ci_t    : 激活卡的信息
  *
- * \return AW_OK       : ȡɹ
- * \return AW_ERROR    : ȡʧ
- * \return -AW_EINVAL  : 
- * \return -AW_EPERM   : 豸Ӧ쳣֡
+ * \return AW_OK       : 获取成功
+ * \return AW_ERROR    : 获取失败
+ * \return -AW_EINVAL  : 参数错误
+ * \return -AW_EPERM   : 操作不允许（设备回应了异常帧）
  */
 aw_err_t aw_iccreader_s50s70_active (struct aw_iccreader      *handle,
                                      aw_iccreader_s50s70_ci_t *p_card)
@@ -512,10 +538,10 @@ aw_err_t aw_iccreader_s50s70_active (struct aw_iccreader      *handle,
 
 
 /**
- * \brief S50S70
- * \param[in]  handle  : ָICʵ
- * \return AW_OK       : ʼɹ
- * \return -AW_EINVAL  : 
+ * \brief S50S70卡挂起
+ * \param[in]  handle  : 指向IC卡的实例
+ * \return AW_OK       : 初始化成功
+ * \return -AW_EINVAL  : 参数错误
  */
 aw_err_t aw_iccreader_halt(struct aw_iccreader *handle)
 {
@@ -524,17 +550,118 @@ aw_err_t aw_iccreader_halt(struct aw_iccreader *handle)
 }
 
 /**
- * \brief Ӵϵ
- * \param [in] handle   : ICʵ
- * \param [in] card_no  : ţû 00H~0FH PSAM 10H~1FH
- * \param [in] dly_time : ȴ忨ʱ(ms)0 ȴ޿ֱӷأ
- * \param [in] dly_time : ȴ忨ʱ(ms)0 ȴ޿ֱӷأ
- * \param [in] p_info   : Ϣ
+ * \brief S50/S70卡多块读取
+ * \param [in]  handle   : IC卡读卡器的实例
+ * \param [in]  key_type : 密钥类型
+ * \param [in]  p_uid    : 4字节卡UID
+ * \param [in]  p_key    : 6字节密钥
+ * \param [in]  p_blocks : 块号列表
+ * \param [in]  nblocks  : 块数
+ * \param [out] p_buf    : 数据缓冲区， 长度为 nblocks * 16
+ * \param [in]  retry    : 最多重试次数
+ * \param [out] p_stat   : 统计信息， 可为NULL
  *
- * \return AW_OK       : ȡɹ
- * \return AW_ERROR    : ȡʧ
- * \return -AW_EINVAL  : 
- * \return -AW_EPERM   : 豸Ӧ쳣֡
+ * \return AW_OK       : 读取成功
+ * \return AW_ERROR    : 读取失败
+ * \return -AW_EINVAL  : 参数错误
+ */
+aw_err_t aw_iccreader_s50s70_blocks_read (struct aw_iccreader      *handle,
+                                          uint8_t                   key_type,
+                                          uint8_t                  *p_uid,
+                                          uint8_t                  *p_key,
+                                          const uint8_t            *p_blocks,
+                                          uint8_t                   nblocks,
+                                          uint8_t                  *p_buf,
+                                          uint8_t                   retry,
+                                          aw_iccreader_read_stat_t *p_stat)
+{
+#define __SECTOR_NONE   0xFF   /* 未验证任何扇区 */
+#define __SECTOR_GET(blk) ((blk) < 128 ? ((blk) >> 2) : (32 + (((blk) - 128) >> 4)))
+
+    aw_iccreader_read_stat_t stat;
+    aw_iccreader_s50s70_ci_t ci;
+    uint8_t                  sector = __SECTOR_NONE;
+    uint8_t                  tries  = 0;
+    uint8_t                  i      = 0;
+    aw_tick_t                tick;
+    aw_err_t                 ret;
+
+    if ((NULL == p_uid) || (NULL == p_key) ||
+        (NULL == p_blocks) || (NULL == p_buf)) {
+        return -AW_EINVAL;
+    }
+
+    memset(&stat, 0, sizeof(stat));
+    stat.reads = 1;
+
+    while (i < nblocks) {
+
+        /* 新扇区验证密钥， 同一扇区只验证一次 */
+        if (__SECTOR_GET(p_blocks[i]) != sector) {
+            tick = aw_sys_tick_get();
+            ret  = aw_iccreader_key_auth(handle, key_type, p_uid, 4, p_key, 6, p_blocks[i]);
+            stat.auth_ms += aw_ticks_to_ms(aw_sys_tick_get() - tick);
+            stat.frames++;
+            if (AW_OK == ret) {
+                sector = __SECTOR_GET(p_blocks[i]);
+            }
+        } else {
+            tick = aw_sys_tick_get();
+            ret  = aw_iccreader_block_read(handle, &p_buf[i * 16], p_blocks[i]);
+            stat.read_ms += aw_ticks_to_ms(aw_sys_tick_get() - tick);
+            stat.frames++;
+            if (AW_OK == ret) {
+                i++;
+                continue;
+            }
+        }
+
+        if (AW_OK != ret) {
+            /* 失败后重新激活， 并重新验证当前扇区， 已读取的块保留 */
+            if (++tries > retry) {
+                break;
+            }
+            stat.retries++;
+            sector = __SECTOR_NONE;
+
+            tick = aw_sys_tick_get();
+            aw_iccreader_s50s70_active(handle, &ci);
+            stat.active_ms += aw_ticks_to_ms(aw_sys_tick_get() - tick);
+            stat.frames++;
+        }
+    }
+
+    if (i < nblocks) {
+        stat.fails = 1;
+    }
+    if (NULL != p_stat) {
+        p_stat->reads     += stat.reads;
+        p_stat->fails     += stat.fails;
+        p_stat->frames    += stat.frames;
+        p_stat->retries   += stat.retries;
+        p_stat->active_ms += stat.active_ms;
+        p_stat->auth_ms   += stat.auth_ms;
+        p_stat->read_ms   += stat.read_ms;
+    }
+
+    return (i < nblocks) ? AW_ERROR : AW_OK;
+
+#undef __SECTOR_NONE
+#undef __SECTOR_GET
+}
+
+/**
+ * \brief 给接触卡上电
+ * \param [in] handle   : IC卡读卡器的实例
+ * \param [in] card_no  : 卡座号（用户卡： 00H~0FH， PSAM 卡：10H~1FH）
+ * \param [in] dly_time : 等待插卡时间(ms)（0 无需等待，无卡直接返回）
+ * \param [in] dly_time : 等待插卡时间(ms)（0 无需等待，无卡直接返回）
+ * \param [in] p_info   : 卡信息
+ *
+ * \return AW_OK       : 获取成功
+ * \return AW_ERROR    : 获取失败
+ * \return -AW_EINVAL  : 参数错误
+ * \return -AW_EPERM   : 操作不允许（设备回应了异常帧）
  */
 aw_err_t aw_iccreader_samc_power_on(struct aw_iccreader *handle,
                                     uint8_t card_no,
@@ -550,14 +677,14 @@ aw_err_t aw_iccreader_samc_power_on(struct aw_iccreader *handle,
 }
 
 /**
- * \brief Ӵµ
- * \param [in] handle   : ICʵ
- * \param [in] card_no  : ţû 00H~0FH PSAM 10H~1FH
+ * \brief 给接触卡下电
+ * \param [in] handle   : IC卡读卡器的实例
+ * \param [in] card_no  : 卡座号（用户卡： 00H~0FH， PSAM 卡：10H~1FH）
  *
- * \return AW_OK       : ȡɹ
- * \return AW_ERROR    : ȡʧ
- * \return -AW_EINVAL  : 
- * \return -AW_EPERM   : 豸Ӧ쳣֡
+ * \return AW_OK       : 获取成功
+ * \return AW_ERROR    : 获取失败
+ * \return -AW_EINVAL  : 参数错误
+ * \return -AW_EPERM   : 操作不允许（设备回应了异常帧）
  */
 aw_err_t aw_iccreader_samc_power_off(struct aw_iccreader *handle,
                                     uint8_t               card_no)
@@ -566,10 +693,112 @@ aw_err_t aw_iccreader_samc_power_off(struct aw_iccreader *handle,
 }
 
 /**
- * \brief ʼ
- * \param[in]  handle  : ָICʵ
- * \return AW_OK       : ʼɹ
- * \return -AW_EINVAL  : 
+ * \brief 进入自动检测模式
+ * \param [in] handle   : IC卡读卡器的实例
+ * \param [in] p_cfg    : 自动检测配置
+ *
+ * \return AW_OK       : 获取成功
+ * \return AW_ERROR    : 获取失败
+ * \return -AW_EINVAL  : 参数错误
+ * \return -AW_EPERM   : 操作不允许（设备回应了异常帧）
+ */
+aw_err_t aw_iccreader_auto_detect_start (struct aw_iccreader                  *handle,
+                                         const aw_iccreader_auto_detect_cfg_t *p_cfg)
+{
+    uint8_t buf[11] = {0};
+
+    if ((NULL == handle) || (NULL == p_cfg)) {
+        return -AW_EINVAL;
+    }
+
+    handle->rf_on = FALSE;               /* 自动检测期间射频由模块控制 */
+
+    buf[0] = 0x01;                       /* 检测到卡后主动发送 */
+    buf[1] = 0x00;                       /* 天线交替驱动 */
+    buf[2] = p_cfg->req_code;
+    if (p_cfg->auth_en) {
+        buf[3] = 'F';                    /* 直接密钥验证 */
+        buf[4] = p_cfg->key_type;
+        memcpy(&buf[5], p_cfg->key, 6);
+        buf[10] = p_cfg->block;
+        return aw_iccreader_transfer(handle, __CMD_AUTO_DETECT, buf, 11, NULL, 0);
+    }
+    buf[3] = 0;                          /* 不验证 */
+    return aw_iccreader_transfer(handle, __CMD_AUTO_DETECT, buf, 4, NULL, 0);
+}
+
+/**
+ * \brief 退出自动检测模式
+ * \param [in] handle   : IC卡读卡器的实例
+ *
+ * \return AW_OK       : 获取成功
+ * \return AW_ERROR    : 获取失败
+ * \return -AW_EINVAL  : 参数错误
+ * \return -AW_EPERM   : 操作不允许（设备回应了异常帧）
+ */
+aw_err_t aw_iccreader_auto_detect_stop (struct aw_iccreader *handle)
+{
+    uint8_t mode = 0x00;                 /* 模式为0时退出自动检测 */
+
+    return aw_iccreader_transfer(handle, __CMD_AUTO_DETECT, &mode, 1, NULL, 0);
+}
+
+/**
+ * \brief 等待自动检测上报的卡信息
+ * \param [in]  handle   : IC卡读卡器的实例
+ * \param [out] p_info   : 卡信息
+ * \param [in]  timeout  : 最长等待时间， 单位ms
+ *
+ * \return AW_OK         : 检测到卡
+ * \return -AW_ETIMEDOUT : 超时无卡
+ * \return AW_ERROR      : 帧错误
+ * \return -AW_EINVAL    : 参数错误
+ *
+ * \note 上报帧数据域： ATQ(2) | SAK(1) | UID长度(1) | UID | 数据块(16, 验证读取时)
+ */
+aw_err_t aw_iccreader_auto_detect_wait (struct aw_iccreader             *handle,
+                                        aw_iccreader_auto_detect_info_t *p_info,
+                                        uint32_t                         timeout)
+{
+    uint8_t buf[__ICC_PACKET_MAX_SIZE];
+    int     len;
+    uint8_t uid_len;
+
+    if ((NULL == handle) || (NULL == handle->p_transfer) || (NULL == p_info)) {
+        return -AW_EINVAL;
+    }
+
+    len = __recevie_timeout(handle, buf, 4 + 10 + 16 + 2, timeout);
+    if (len == -AW_ETIMEDOUT) {
+        return -AW_ETIMEDOUT;
+    }
+    if ((len < 2 + 4) || !__ICC_CMD_EXE_STATE(buf, len)) {
+        return AW_ERROR;
+    }
+    len -= 2;   /* 去掉状态字 */
+
+    uid_len = buf[3];
+    if ((uid_len < 4) || ((4 + uid_len) > len)) {
+        return AW_ERROR;
+    }
+
+    memset(p_info, 0, sizeof(*p_info));
+    p_info->atq        = (buf[0] << 8) | buf[1];
+    p_info->sak        = buf[2];
+    p_info->ci.uid_len = 4;
+    memcpy(p_info->ci.uid, &buf[4], 4);
+    if ((4 + uid_len + 16) <= len) {
+        memcpy(p_info->blk_dat, &buf[4 + uid_len], 16);
+        p_info->blk_valid = TRUE;
+    }
+    return AW_OK;
+}
+
+/**
+ * \brief 读卡器初始化
+ * \param[in]  handle  : 指向IC卡的实例
+ * \return AW_OK       : 初始化成功
+ * \return -AW_EINVAL  : 参数错误
  */
  aw_err_t aw_iccreader_inst_init (struct aw_iccreader           *handle,
                                   const aw_iccreader_transfer_t *p_transfer)
@@ -585,16 +814,17 @@ aw_err_t aw_iccreader_samc_power_off(struct aw_iccreader *handle,
     handle->pfn_send    = __serial_send;
     handle->pfn_receive = __serial_receive;
     handle->p_transfer  = p_transfer;
+    handle->rf_on       = FALSE;
 
-    /* ڳʼ, 粨 115200 */
+    /* 串口初始化配置, 如波特率 115200 */
     aw_serial_ioctl(uart_num,
                     SIO_BAUD_SET,
                    (void *)(p_transfer->uart_buad));
-    /* ڲ 磺8 λ 1 ֹͣλżУ */
+    /* 串口参数 如：8 个数据位 1 个停止位，无奇偶校验 */
     aw_serial_ioctl(uart_num,
                     SIO_HW_OPTS_SET,
                     (void *)(p_transfer->uart_format));
-    /* öȡʱʱ */
+    /* 设置读取超时时间 */
     aw_serial_ioctl(uart_num, AW_TIOCRDTIMEOUT, (void *)__ICC_RX_BYTE_TIMEOUT_CFG);
 
     return AW_OK;
@@ -12,7 +12,7 @@
 *******************************************************************************/
 /**
  * \file
- * \brief  淶ͷļ
+ * \brief  读卡器（国网规范）声明头文件
  *
  * \internal
  * \par modification history:
@@ -24,92 +24,129 @@
 #ifndef __AW_ICCREADER_H
 #define __AW_ICCREADER_H
 
-#define AW_ICCREADER_KEY_AUTH_KEYTYPE_KEYA   (0x60u) /**< \brief ԿA */
-#define AW_ICCREADER_KEY_AUTH_KEYTYPE_KEYB   (0x61u) /**< \brief ԿB */
+#define AW_ICCREADER_KEY_AUTH_KEYTYPE_KEYA   (0x60u) /**< \brief 密钥A */
+#define AW_ICCREADER_KEY_AUTH_KEYTYPE_KEYB   (0x61u) /**< \brief 密钥B */
 
 typedef struct aw_iccreader_info {
-    uint8_t cpu_interface[8];  /**< Ķ淶汾Ϣ*/
-    uint8_t acq_interface[8];  /**< İ汾Ϣ */
-    uint8_t manu_len;          /**< ԶϢ */
-    uint8_t manu_info[50];     /**< ԶϢ */
-    uint8_t reserv[2];         /**<  */
+    uint8_t cpu_interface[8];  /**< 由银联定义的读卡器规范版本信息*/
+    uint8_t acq_interface[8];  /**< 由受理方定义的版本信息 */
+    uint8_t manu_len;          /**< 厂商自定义数据信息长度 */
+    uint8_t manu_info[50];     /**< 厂家自定义信息 */
+    uint8_t reserv[2];         /**< 保留 */
 }aw_iccreader_info_t;
 
 
 typedef struct aw_iccreader_s50s70_ci {
-    uint8_t key_type;    /**<  */
-    uint8_t uid_len;     /**< UID */
-    uint8_t uid[4];      /**< UID */
+    uint8_t key_type;    /**< 卡类型 */
+    uint8_t uid_len;     /**< 卡UID长度 */
+    uint8_t uid[4];      /**< 卡UID */
 }aw_iccreader_s50s70_ci_t;
 
 
+/**
+ * \brief 自动检测模式配置
+ */
+typedef struct aw_iccreader_auto_detect_cfg {
+    uint8_t req_code;    /**< 请求代码， 0x26： IDLE， 0x52： ALL */
+    uint8_t auth_en;     /**< 检测到卡后是否验证密钥并读取数据块 */
+    uint8_t key_type;    /**< 密钥类型 #AW_ICCREADER_KEY_AUTH_KEYTYPE_KEYA */
+    uint8_t key[6];      /**< 密钥 */
+    uint8_t block;       /**< 读取的数据块 */
+}aw_iccreader_auto_detect_cfg_t;
+
+/**
+ * \brief 自动检测上报的卡信息
+ */
+typedef struct aw_iccreader_auto_detect_info {
+    uint16_t                 atq;          /**< 请求应答 */
+    uint8_t                  sak;          /**< 选择应答 */
+    aw_iccreader_s50s70_ci_t ci;           /**< 卡UID */
+    bool_t                   blk_valid;    /**< 数据块是否有效 */
+    uint8_t                  blk_dat[16];  /**< 数据块 */
+}aw_iccreader_auto_detect_info_t;
+
+/**
+ * \brief 多块读取的统计信息（各项在多次读取间累加， 由调用者清零）
+ */
+typedef struct aw_iccreader_read_stat {
+    uint32_t reads;       /**< 读取次数 */
+    uint32_t fails;       /**< 失败次数 */
+    uint32_t frames;      /**< 串口命令交互次数 */
+    uint32_t retries;     /**< 重试次数 */
+    uint32_t active_ms;   /**< 激活卡耗时， 单位ms */
+    uint32_t auth_ms;     /**< 密钥验证耗时， 单位ms */
+    uint32_t read_ms;     /**< 块读取耗时， 单位ms */
+}aw_iccreader_read_stat_t;
+
 /** 
- *  \brief ͨŴϢ
+ *  \brief 通信传输信息配置
  */
 typedef struct aw_iccreader_transfer {
-    uint32_t              uart_num;    /**< \brief ͨʱʹõĴں */
-    uint32_t              uart_buad;   /**< \brief ͨ */
-    uint32_t              uart_format; /**< \brief ͨŸʽ */
-    bool_t                rs485_en;    /**< \brief RS485ʹ */
+    uint32_t              uart_num;    /**< \brief 通信时使用的串口号 */
+    uint32_t              uart_buad;   /**< \brief 通信速率 */
+    uint32_t              uart_format; /**< \brief 串口通信格式 */
+    bool_t                rs485_en;    /**< \brief RS485使能 */
 }aw_iccreader_transfer_t;
 
 /**
- *  \brief 
+ *  \brief 读卡器
  */
 typedef struct aw_iccreader {
-    const aw_iccreader_transfer_t *p_transfer;    /**< \brief Ϣ */
+    const aw_iccreader_transfer_t *p_transfer;    /**< \brief 传输信息配置 */
     /** 
-     * \brief 
-     * \param [in] handle  : ʵ
-     * \param [in] p_txbuf : ݻ
-     * \param [in] nbytes  : ֽ
-     * \return 룺 AW_OKʱʾͨųɹ
+     * \brief 发送数据
+     * \param [in] handle  : 读卡器的实例
+     * \param [in] p_txbuf : 发送数据缓冲区
+     * \param [in] nbytes  : 发送字节数
+     * \return 错误码： 返回AW_OK时，表示通信成功。
      */
     aw_err_t (*pfn_send)(struct aw_iccreader* handle,
                          const uint8_t       *p_txbuf,
                          uint32_t             nbytes);
     /** 
-     * \brief 
-     * \param [in] handle  : ʵ
-     * \param [in] p_rxbuf : ݻ
-     * \param [in] nbytes  : ֽ
-     * \return 룺 AW_OKʱʾͨųɹ
+     * \brief 接收数据
+     * \param [in] handle  : 读卡器的实例
+     * \param [in] p_rxbuf : 接收数据缓冲区
+     * \param [in] nbytes  : 接收字节数
+     * \return 错误码： 返回AW_OK时，表示通信成功。
      */
     int (*pfn_receive)(struct aw_iccreader* handle,
                        uint8_t             *p_rxbuf,
                        uint32_t              nbytes);
+
+    bool_t rf_on;   /**< \brief 射频已打开， 重复打开或关闭时不再发送命令 */
 }aw_iccreader_t;
 
 /**
- * CPUƬϵ縴λӦϢ
+ * CPU卡片上电复位回应信息
  */
 typedef struct aw_iccreader_samc_info {
     uint8_t   ptl;         /**< PTL */
-    uint8_t  atr[50];      /**< ATR */
-    uint16_t status;       /**<  ״̬Ϣ */
+    uint8_t  atr[50];      /**< ATR不定长 */
+    uint16_t status;       /**<  状态信息 */
 }aw_iccreader_samc_info_t;
 
 /**
- * \brief ICʵʼ
- * \return AW_OK       : ʼɹ
- * \return -AW_EINVAL  : 
+ * \brief IC卡读卡器实例初始化
+ * \return AW_OK       : 初始化成功
+ * \return -AW_EINVAL  : 参数错误
  */
 aw_err_t aw_iccreader_inst_init (struct aw_iccreader           *handle,
                                  const aw_iccreader_transfer_t *p_transfer);
 
 
 /**
- * \brief 
- * \param[in]  handle   : ָʵ
- * \param[in]  cmd      : 
- * \param[in]  p_txbuf  : ͻ
- * \param[in]  tlen     : ͻ
- * \param[out] p_rxbuf  : ջ
- * \param[in]  rlen     : ջ
+ * \brief 传输数据
+ * \param[in]  handle   : 指向读卡器的实例
+ * \param[in]  cmd      : 命令类型
+ * \param[in]  p_txbuf  : 发送缓冲器
+ * \param[in]  tlen     : 发送缓冲器长度
+ * \param[out] p_rxbuf  : 接收缓冲器
+ * \param[in]  rlen     : 接收缓冲器长度
  *
- * \return AW_OK       : ȡɹ
- * \return AW_ERROR    : ȡʧ
- * \return -AW_EINVAL  : 
+ * \return AW_OK       : 获取成功
+ * \return AW_ERROR    : 获取失败
+ * \return -AW_EINVAL  : 参数错误
  */
 aw_err_t aw_iccreader_transfer(struct aw_iccreader* handle,
                                uint32_t  cmd,
@@ -149,6 +186,36 @@ aw_err_t aw_iccreader_s50s70_active (struct aw_iccreader      *handle,
 
 aw_err_t aw_iccreader_halt(struct aw_iccreader *handle);
 
+/**
+ * \brief S50/S70卡多块读取
+ *
+ * 每个扇区只验证一次密钥， 依次读取所有块。某一步失败时重新激活卡并验证当前扇区，
+ * 从失败的块继续读取， 已读取的块不再重读。
+ *
+ * \param[in]  handle   : 指向读卡器的实例
+ * \param[in]  key_type : 密钥类型 #AW_ICCREADER_KEY_AUTH_KEYTYPE_KEYA
+ * \param[in]  p_uid    : 4字节卡UID
+ * \param[in]  p_key    : 6字节密钥
+ * \param[in]  p_blocks : 块号列表， 同一扇区的块应相邻
+ * \param[in]  nblocks  : 块数
+ * \param[out] p_buf    : 数据缓冲区， 长度为 nblocks * 16
+ * \param[in]  retry    : 最多重试次数
+ * \param[out] p_stat   : 统计信息， 可为NULL
+ *
+ * \return AW_OK       : 读取成功
+ * \return AW_ERROR    : 重试后仍失败
+ * \return -AW_EINVAL  : 参数错误
+ */
+aw_err_t aw_iccreader_s50s70_blocks_read (struct aw_iccreader      *handle,
+                                          uint8_t                   key_type,
+                                          uint8_t                  *p_uid,
+                                          uint8_t                  *p_key,
+                                          const uint8_t            *p_blocks,
+                                          uint8_t                   nblocks,
+                                          uint8_t                  *p_buf,
+                                          uint8_t                   retry,
+                                          aw_iccreader_read_stat_t *p_stat);
+
 aw_err_t aw_iccreader_samc_power_on(struct aw_iccreader *handle,
                                     uint8_t card_no,
                                     uint16_t dly_time,
@@ -156,4 +223,29 @@ aw_err_t aw_iccreader_samc_power_on(struct aw_iccreader *handle,
 
 aw_err_t aw_iccreader_samc_power_off(struct aw_iccreader *handle,
                                     uint8_t               card_no);
+
+/**
+ * \brief 进入自动检测模式
+ *
+ * 模块自行寻卡， 检测到卡后主动发送卡信息帧， 由 aw_iccreader_auto_detect_wait()
+ * 接收， 此后模块退出自动检测模式。自动检测期间不应发送其他命令。
+ */
+aw_err_t aw_iccreader_auto_detect_start (struct aw_iccreader                  *handle,
+                                         const aw_iccreader_auto_detect_cfg_t *p_cfg);
+
+/**
+ * \brief 退出自动检测模式
+ */
+aw_err_t aw_iccreader_auto_detect_stop (struct aw_iccreader *handle);
+
+/**
+ * \brief 等待自动检测上报的卡信息（串口中断接收， 等待期间不占用CPU）
+ * \param[in]  timeout : 最长等待时间， 单位ms
+ * \return AW_OK         : 检测到卡
+ * \return -AW_ETIMEDOUT : 超时无卡
+ * \return AW_ERROR      : 帧错误
+ */
+aw_err_t aw_iccreader_auto_detect_wait (struct aw_iccreader             *handle,
+                                        aw_iccreader_auto_detect_info_t *p_info,
+                                        uint32_t                         timeout);
 #endif
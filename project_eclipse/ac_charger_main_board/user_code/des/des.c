@@ -1,423 +1,301 @@
-#include <stdio.h>
-#include <stdlib.h>
 #include <string.h>
-#include "aw_vdebug.h"
 #include "des.h"
 
-int initial_key_permutaion[] = {57, 49,  41, 33,  25,  17,  9,
-                                 1, 58,  50, 42,  34,  26, 18,
-                                10,  2,  59, 51,  43,  35, 27,
-                                19, 11,   3, 60,  52,  44, 36,
-                                63, 55,  47, 39,  31,  23, 15,
-                                 7, 62,  54, 46,  38,  30, 22,
-                                14,  6,  61, 53,  45,  37, 29,
-                                21, 13,   5, 28,  20,  12,  4};
-
-int initial_message_permutation[] =	   {58, 50, 42, 34, 26, 18, 10, 2,
-                                        60, 52, 44, 36, 28, 20, 12, 4,
-                                        62, 54, 46, 38, 30, 22, 14, 6,
-                                        64, 56, 48, 40, 32, 24, 16, 8,
-                                        57, 49, 41, 33, 25, 17,  9, 1,
-                                        59, 51, 43, 35, 27, 19, 11, 3,
-                                        61, 53, 45, 37, 29, 21, 13, 5,
-                                        63, 55, 47, 39, 31, 23, 15, 7};
-
-int key_shift_sizes[] = {-1, 1, 1, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 1};
-
-int sub_key_permutation[] =    {14, 17, 11, 24,  1,  5,
-                                 3, 28, 15,  6, 21, 10,
-                                23, 19, 12,  4, 26,  8,
-                                16,  7, 27, 20, 13,  2,
-                                41, 52, 31, 37, 47, 55,
-                                30, 40, 51, 45, 33, 48,
-                                44, 49, 39, 56, 34, 53,
-                                46, 42, 50, 36, 29, 32};
-
-int message_expansion[] =  {32,  1,  2,  3,  4,  5,
-                             4,  5,  6,  7,  8,  9,
-                             8,  9, 10, 11, 12, 13,
-                            12, 13, 14, 15, 16, 17,
-                            16, 17, 18, 19, 20, 21,
-                            20, 21, 22, 23, 24, 25,
-                            24, 25, 26, 27, 28, 29,
-                            28, 29, 30, 31, 32,  1};
-
-int S1[] = {14,  4, 13,  1,  2, 15, 11,  8,  3, 10,  6, 12,  5,  9,  0,  7,
-             0, 15,  7,  4, 14,  2, 13,  1, 10,  6, 12, 11,  9,  5,  3,  8,
-             4,  1, 14,  8, 13,  6,  2, 11, 15, 12,  9,  7,  3, 10,  5,  0,
-            15, 12,  8,  2,  4,  9,  1,  7,  5, 11,  3, 14, 10,  0,  6, 13};
-
-int S2[] = {15,  1,  8, 14,  6, 11,  3,  4,  9,  7,  2, 13, 12,  0,  5, 10,
-             3, 13,  4,  7, 15,  2,  8, 14, 12,  0,  1, 10,  6,  9, 11,  5,
-             0, 14,  7, 11, 10,  4, 13,  1,  5,  8, 12,  6,  9,  3,  2, 15,
-            13,  8, 10,  1,  3, 15,  4,  2, 11,  6,  7, 12,  0,  5, 14,  9};
-
-int S3[] = {10,  0,  9, 14,  6,  3, 15,  5,  1, 13, 12,  7, 11,  4,  2,  8,
-            13,  7,  0,  9,  3,  4,  6, 10,  2,  8,  5, 14, 12, 11, 15,  1,
-            13,  6,  4,  9,  8, 15,  3,  0, 11,  1,  2, 12,  5, 10, 14,  7,
-             1, 10, 13,  0,  6,  9,  8,  7,  4, 15, 14,  3, 11,  5,  2, 12};
-
-int S4[] = { 7, 13, 14,  3,  0,  6,  9, 10,  1,  2,  8,  5, 11, 12,  4, 15,
-            13,  8, 11,  5,  6, 15,  0,  3,  4,  7,  2, 12,  1, 10, 14,  9,
-            10,  6,  9,  0, 12, 11,  7, 13, 15,  1,  3, 14,  5,  2,  8,  4,
-             3, 15,  0,  6, 10,  1, 13,  8,  9,  4,  5, 11, 12,  7,  2, 14};
-
-int S5[] = { 2, 12,  4,  1,  7, 10, 11,  6,  8,  5,  3, 15, 13,  0, 14,  9,
-            14, 11,  2, 12,  4,  7, 13,  1,  5,  0, 15, 10,  3,  9,  8,  6,
-             4,  2,  1, 11, 10, 13,  7,  8, 15,  9, 12,  5,  6,  3,  0, 14,
-            11,  8, 12,  7,  1, 14,  2, 13,  6, 15,  0,  9, 10,  4,  5,  3};
-
-int S6[] = {12,  1, 10, 15,  9,  2,  6,  8,  0, 13,  3,  4, 14,  7,  5, 11,
-            10, 15,  4,  2,  7, 12,  9,  5,  6,  1, 13, 14,  0, 11,  3,  8,
-             9, 14, 15,  5,  2,  8, 12,  3,  7,  0,  4, 10,  1, 13, 11,  6,
-             4,  3,  2, 12,  9,  5, 15, 10, 11, 14,  1,  7,  6,  0,  8, 13};
-
-int S7[] = { 4, 11,  2, 14, 15,  0,  8, 13,  3, 12,  9,  7,  5, 10,  6,  1,
-            13,  0, 11,  7,  4,  9,  1, 10, 14,  3,  5, 12,  2, 15,  8,  6,
-             1,  4, 11, 13, 12,  3,  7, 14, 10, 15,  6,  8,  0,  5,  9,  2,
-             6, 11, 13,  8,  1,  4, 10,  7,  9,  5,  0, 15, 14,  2,  3, 12};
+/*
+ * Table-driven DES.
+ *
+ * All tables are const and live in flash. The S-boxes and the P permutation
+ * are combined into eight 64-entry SP tables indexed directly by the 6-bit
+ * S-box input, so a round is eight lookups. The initial and final
+ * permutations are done with a fixed sequence of delta swaps on the two
+ * 32-bit halves instead of moving individual bits.
+ */
+
+static const unsigned char __g_pc1[56] = {
+    57, 49, 41, 33, 25, 17,  9,  1, 58, 50, 42, 34, 26, 18,
+    10,  2, 59, 51, 43, 35, 27, 19, 11,  3, 60, 52, 44, 36,
+    63, 55, 47, 39, 31, 23, 15,  7, 62, 54, 46, 38, 30, 22,
+    14,  6, 61, 53, 45, 37, 29, 21, 13,  5, 28, 20, 12,  4
+};
+
+static const unsigned char __g_pc2[48] = {
+    14, 17, 11, 24,  1,  5,  3, 28, 15,  6, 21, 10,
+    23, 19, 12,  4, 26,  8, 16,  7, 27, 20, 13,  2,
+    41, 52, 31, 37, 47, 55, 30, 40, 51, 45, 33, 48,
+    44, 49, 39, 56, 34, 53, 46, 42, 50, 36, 29, 32
+};
+
+static const unsigned char __g_key_shift[16] = {
+    1, 1, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 1
+};
+
+/* S-box i output permuted by P, indexed by the raw 6-bit S-box input */
+static const uint32_t __g_des_sp[8][64] = {
+    {
+        0x00808200UL, 0x00000000UL, 0x00008000UL, 0x00808202UL,
+        0x00808002UL, 0x00008202UL, 0x00000002UL, 0x00008000UL,
+        0x00000200UL, 0x00808200UL, 0x00808202UL, 0x00000200UL,
+        0x00800202UL, 0x00808002UL, 0x00800000UL, 0x00000002UL,
+        0x00000202UL, 0x00800200UL, 0x00800200UL, 0x00008200UL,
+        0x00008200UL, 0x00808000UL, 0x00808000UL, 0x00800202UL,
+        0x00008002UL, 0x00800002UL, 0x00800002UL, 0x00008002UL,
+        0x00000000UL, 0x00000202UL, 0x00008202UL, 0x00800000UL,
+        0x00008000UL, 0x00808202UL, 0x00000002UL, 0x00808000UL,
+        0x00808200UL, 0x00800000UL, 0x00800000UL, 0x00000200UL,
+        0x00808002UL, 0x00008000UL, 0x00008200UL, 0x00800002UL,
+        0x00000200UL, 0x00000002UL, 0x00800202UL, 0x00008202UL,
+        0x00808202UL, 0x00008002UL, 0x00808000UL, 0x00800202UL,
+        0x00800002UL, 0x00000202UL, 0x00008202UL, 0x00808200UL,
+        0x00000202UL, 0x00800200UL, 0x00800200UL, 0x00000000UL,
+        0x00008002UL, 0x00008200UL, 0x00000000UL, 0x00808002UL
+    },
+    {
+        0x40084010UL, 0x40004000UL, 0x00004000UL, 0x00084010UL,
+        0x00080000UL, 0x00000010UL, 0x40080010UL, 0x40004010UL,
+        0x40000010UL, 0x40084010UL, 0x40084000UL, 0x40000000UL,
+        0x40004000UL, 0x00080000UL, 0x00000010UL, 0x40080010UL,
+        0x00084000UL, 0x00080010UL, 0x40004010UL, 0x00000000UL,
+        0x40000000UL, 0x00004000UL, 0x00084010UL, 0x40080000UL,
+        0x00080010UL, 0x40000010UL, 0x00000000UL, 0x00084000UL,
+        0x00004010UL, 0x40084000UL, 0x40080000UL, 0x00004010UL,
+        0x00000000UL, 0x00084010UL, 0x40080010UL, 0x00080000UL,
+        0x40004010UL, 0x40080000UL, 0x40084000UL, 0x00004000UL,
+        0x40080000UL, 0x40004000UL, 0x00000010UL, 0x40084010UL,
+        0x00084010UL, 0x00000010UL, 0x00004000UL, 0x40000000UL,
+        0x00004010UL, 0x40084000UL, 0x00080000UL, 0x40000010UL,
+        0x00080010UL, 0x40004010UL, 0x40000010UL, 0x00080010UL,
+        0x00084000UL, 0x00000000UL, 0x40004000UL, 0x00004010UL,
+        0x40000000UL, 0x40080010UL, 0x40084010UL, 0x00084000UL
+    },
+    {
+        0x00000104UL, 0x04010100UL, 0x00000000UL, 0x04010004UL,
+        0x04000100UL, 0x00000000UL, 0x00010104UL, 0x04000100UL,
+        0x00010004UL, 0x04000004UL, 0x04000004UL, 0x00010000UL,
+        0x04010104UL, 0x00010004UL, 0x04010000UL, 0x00000104UL,
+        0x04000000UL, 0x00000004UL, 0x04010100UL, 0x00000100UL,
+        0x00010100UL, 0x04010000UL, 0x04010004UL, 0x00010104UL,
+        0x04000104UL, 0x00010100UL, 0x00010000UL, 0x04000104UL,
+        0x00000004UL, 0x04010104UL, 0x00000100UL, 0x04000000UL,
+        0x04010100UL, 0x04000000UL, 0x00010004UL, 0x00000104UL,
+        0x00010000UL, 0x04010100UL, 0x04000100UL, 0x00000000UL,
+        0x00000100UL, 0x00010004UL, 0x04010104UL, 0x04000100UL,
+        0x04000004UL, 0x00000100UL, 0x00000000UL, 0x04010004UL,
+        0x04000104UL, 0x00010000UL, 0x04000000UL, 0x04010104UL,
+        0x00000004UL, 0x00010104UL, 0x00010100UL, 0x04000004UL,
+        0x04010000UL, 0x04000104UL, 0x00000104UL, 0x04010000UL,
+        0x00010104UL, 0x00000004UL, 0x04010004UL, 0x00010100UL
+    },
+    {
+        0x80401000UL, 0x80001040UL, 0x80001040UL, 0x00000040UL,
+        0x00401040UL, 0x80400040UL, 0x80400000UL, 0x80001000UL,
+        0x00000000UL, 0x00401000UL, 0x00401000UL, 0x80401040UL,
+        0x80000040UL, 0x00000000UL, 0x00400040UL, 0x80400000UL,
+        0x80000000UL, 0x00001000UL, 0x00400000UL, 0x80401000UL,
+        0x00000040UL, 0x00400000UL, 0x80001000UL, 0x00001040UL,
+        0x80400040UL, 0x80000000UL, 0x00001040UL, 0x00400040UL,
+        0x00001000UL, 0x00401040UL, 0x80401040UL, 0x80000040UL,
+        0x00400040UL, 0x80400000UL, 0x00401000UL, 0x80401040UL,
+        0x80000040UL, 0x00000000UL, 0x00000000UL, 0x00401000UL,
+        0x00001040UL, 0x00400040UL, 0x80400040UL, 0x80000000UL,
+        0x80401000UL, 0x80001040UL, 0x80001040UL, 0x00000040UL,
+        0x80401040UL, 0x80000040UL, 0x80000000UL, 0x00001000UL,
+        0x80400000UL, 0x80001000UL, 0x00401040UL, 0x80400040UL,
+        0x80001000UL, 0x00001040UL, 0x00400000UL, 0x80401000UL,
+        0x00000040UL, 0x00400000UL, 0x00001000UL, 0x00401040UL
+    },
+    {
+        0x00000080UL, 0x01040080UL, 0x01040000UL, 0x21000080UL,
+        0x00040000UL, 0x00000080UL, 0x20000000UL, 0x01040000UL,
+        0x20040080UL, 0x00040000UL, 0x01000080UL, 0x20040080UL,
+        0x21000080UL, 0x21040000UL, 0x00040080UL, 0x20000000UL,
+        0x01000000UL, 0x20040000UL, 0x20040000UL, 0x00000000UL,
+        0x20000080UL, 0x21040080UL, 0x21040080UL, 0x01000080UL,
+        0x21040000UL, 0x20000080UL, 0x00000000UL, 0x21000000UL,
+        0x01040080UL, 0x01000000UL, 0x21000000UL, 0x00040080UL,
+        0x00040000UL, 0x21000080UL, 0x00000080UL, 0x01000000UL,
+        0x20000000UL, 0x01040000UL, 0x21000080UL, 0x20040080UL,
+        0x01000080UL, 0x20000000UL, 0x21040000UL, 0x01040080UL,
+        0x20040080UL, 0x00000080UL, 0x01000000UL, 0x21040000UL,
+        0x21040080UL, 0x00040080UL, 0x21000000UL, 0x21040080UL,
+        0x01040000UL, 0x00000000UL, 0x20040000UL, 0x21000000UL,
+        0x00040080UL, 0x01000080UL, 0x20000080UL, 0x00040000UL,
+        0x00000000UL, 0x20040000UL, 0x01040080UL, 0x20000080UL
+    },
+    {
+        0x10000008UL, 0x10200000UL, 0x00002000UL, 0x10202008UL,
+        0x10200000UL, 0x00000008UL, 0x10202008UL, 0x00200000UL,
+        0x10002000UL, 0x00202008UL, 0x00200000UL, 0x10000008UL,
+        0x00200008UL, 0x10002000UL, 0x10000000UL, 0x00002008UL,
+        0x00000000UL, 0x00200008UL, 0x10002008UL, 0x00002000UL,
+        0x00202000UL, 0x10002008UL, 0x00000008UL, 0x10200008UL,
+        0x10200008UL, 0x00000000UL, 0x00202008UL, 0x10202000UL,
+        0x00002008UL, 0x00202000UL, 0x10202000UL, 0x10000000UL,
+        0x10002000UL, 0x00000008UL, 0x10200008UL, 0x00202000UL,
+        0x10202008UL, 0x00200000UL, 0x00002008UL, 0x10000008UL,
+        0x00200000UL, 0x10002000UL, 0x10000000UL, 0x00002008UL,
+        0x10000008UL, 0x10202008UL, 0x00202000UL, 0x10200000UL,
+        0x00202008UL, 0x10202000UL, 0x00000000UL, 0x10200008UL,
+        0x00000008UL, 0x00002000UL, 0x10200000UL, 0x00202008UL,
+        0x00002000UL, 0x00200008UL, 0x10002008UL, 0x00000000UL,
+        0x10202000UL, 0x10000000UL, 0x00200008UL, 0x10002008UL
+    },
+    {
+        0x00100000UL, 0x02100001UL, 0x02000401UL, 0x00000000UL,
+        0x00000400UL, 0x02000401UL, 0x00100401UL, 0x02100400UL,
+        0x02100401UL, 0x00100000UL, 0x00000000UL, 0x02000001UL,
+        0x00000001UL, 0x02000000UL, 0x02100001UL, 0x00000401UL,
+        0x02000400UL, 0x00100401UL, 0x00100001UL, 0x02000400UL,
+        0x02000001UL, 0x02100000UL, 0x02100400UL, 0x00100001UL,
+        0x02100000UL, 0x00000400UL, 0x00000401UL, 0x02100401UL,
+        0x00100400UL, 0x00000001UL, 0x02000000UL, 0x00100400UL,
+        0x02000000UL, 0x00100400UL, 0x00100000UL, 0x02000401UL,
+        0x02000401UL, 0x02100001UL, 0x02100001UL, 0x00000001UL,
+        0x00100001UL, 0x02000000UL, 0x02000400UL, 0x00100000UL,
+        0x02100400UL, 0x00000401UL, 0x00100401UL, 0x02100400UL,
+        0x00000401UL, 0x02000001UL, 0x02100401UL, 0x02100000UL,
+        0x00100400UL, 0x00000000UL, 0x00000001UL, 0x02100401UL,
+        0x00000000UL, 0x00100401UL, 0x02100000UL, 0x00000400UL,
+        0x02000001UL, 0x02000400UL, 0x00000400UL, 0x00100001UL
+    },
+    {
+        0x08000820UL, 0x00000800UL, 0x00020000UL, 0x08020820UL,
+        0x08000000UL, 0x08000820UL, 0x00000020UL, 0x08000000UL,
+        0x00020020UL, 0x08020000UL, 0x08020820UL, 0x00020800UL,
+        0x08020800UL, 0x00020820UL, 0x00000800UL, 0x00000020UL,
+        0x08020000UL, 0x08000020UL, 0x08000800UL, 0x00000820UL,
+        0x00020800UL, 0x00020020UL, 0x08020020UL, 0x08020800UL,
+        0x00000820UL, 0x00000000UL, 0x00000000UL, 0x08020020UL,
+        0x08000020UL, 0x08000800UL, 0x00020820UL, 0x00020000UL,
+        0x00020820UL, 0x00020000UL, 0x08020800UL, 0x00000800UL,
+        0x00000020UL, 0x08020020UL, 0x00000800UL, 0x00020820UL,
+        0x08000800UL, 0x00000020UL, 0x08000020UL, 0x08020000UL,
+        0x08020020UL, 0x08000000UL, 0x00020000UL, 0x08000820UL,
+        0x00000000UL, 0x08020820UL, 0x00020020UL, 0x08000020UL,
+        0x08020000UL, 0x08000800UL, 0x08000820UL, 0x00000000UL,
+        0x08020820UL, 0x00020800UL, 0x00020800UL, 0x00000820UL,
+        0x00000820UL, 0x00020020UL, 0x08000000UL, 0x08020800UL
+    }
+};
 
-int S8[] = {13,  2,  8,  4,  6, 15, 11,  1, 10,  9,  3, 14,  5,  0, 12,  7,
-             1, 15, 13,  8, 10,  3,  7,  4, 12,  5,  6, 11,  0, 14,  9,  2,
-             7, 11,  4,  1,  9, 12, 14,  2,  0,  6, 10, 13, 15,  3,  5,  8,
-             2,  1, 14,  7,  4, 10,  8, 13, 15, 12,  9,  0,  3,  5,  6, 11};
 
-int right_sub_message_permutation[] =    {16,  7, 20, 21,
-                                    29, 12, 28, 17,
-                                     1, 15, 23, 26,
-                                     5, 18, 31, 10,
-                                     2,  8, 24, 14,
-                                    32, 27,  3,  9,
-                                    19, 13, 30,  6,
-                                    22, 11,  4, 25};
+#define __GET_UINT32(p)     (((uint32_t)(p)[0] << 24) | ((uint32_t)(p)[1] << 16) | \
+                             ((uint32_t)(p)[2] <<  8) |  (uint32_t)(p)[3])
 
-int final_message_permutation[] =  {40,  8, 48, 16, 56, 24, 64, 32,
-                                    39,  7, 47, 15, 55, 23, 63, 31,
-                                    38,  6, 46, 14, 54, 22, 62, 30,
-                                    37,  5, 45, 13, 53, 21, 61, 29,
-                                    36,  4, 44, 12, 52, 20, 60, 28,
-                                    35,  3, 43, 11, 51, 19, 59, 27,
-                                    34,  2, 42, 10, 50, 18, 58, 26,
-                                    33,  1, 41,  9, 49, 17, 57, 25};
+#define __PUT_UINT32(v, p)  do { (p)[0] = (unsigned char)((v) >> 24); \
+                                 (p)[1] = (unsigned char)((v) >> 16); \
+                                 (p)[2] = (unsigned char)((v) >>  8); \
+                                 (p)[3] = (unsigned char)(v); } while (0)
 
+/* Swap the bits of a selected by mask m with the bits of b n positions lower */
+#define __DELTA_SWAP(a, b, n, m)  do { uint32_t t = (((a) >> (n)) ^ (b)) & (m); \
+                                       (b) ^= t; (a) ^= (t << (n)); } while (0)
 
-void des_char_as_binary_print(char input) {
-    int i;
-    for (i=0; i<8; i++) {
-        char shift_byte = 0x01 << (7-i);
-        if (shift_byte & input) {
-            aw_kprintf("1");
-        } else {
-            aw_kprintf("0");
-        }
-    }
+static void __des_ip (uint32_t* l, uint32_t* r)
+{
+    __DELTA_SWAP(*l, *r,  4, 0x0F0F0F0FUL);
+    __DELTA_SWAP(*l, *r, 16, 0x0000FFFFUL);
+    __DELTA_SWAP(*r, *l,  2, 0x33333333UL);
+    __DELTA_SWAP(*r, *l,  8, 0x00FF00FFUL);
+    __DELTA_SWAP(*l, *r,  1, 0x55555555UL);
 }
 
-void des_key_generate(unsigned char* key) {
-    int i;
-    for (i=0; i<8; i++) {
-        key[i] = rand()%255;
-    }
+static void __des_fp (uint32_t* l, uint32_t* r)
+{
+    __DELTA_SWAP(*l, *r,  1, 0x55555555UL);
+    __DELTA_SWAP(*r, *l,  8, 0x00FF00FFUL);
+    __DELTA_SWAP(*r, *l,  2, 0x33333333UL);
+    __DELTA_SWAP(*l, *r, 16, 0x0000FFFFUL);
+    __DELTA_SWAP(*l, *r,  4, 0x0F0F0F0FUL);
 }
 
-void des_key_set_print(key_set key_set){
-    int i;
-    aw_kprintf("K: \n");
-    for (i=0; i<8; i++) {
-        aw_kprintf("%02X : ", key_set.k[i]);
-        des_char_as_binary_print(key_set.k[i]);
-        aw_kprintf("\n");
-    }
-    aw_kprintf("\nC: \n");
-
-    for (i=0; i<4; i++) {
-        aw_kprintf("%02X : ", key_set.c[i]);
-        des_char_as_binary_print(key_set.c[i]);
-        aw_kprintf("\n");
-    }
-    aw_kprintf("\nD: \n");
-
-    for (i=0; i<4; i++) {
-        aw_kprintf("%02X : ", key_set.d[i]);
-        des_char_as_binary_print(key_set.d[i]);
-        aw_kprintf("\n");
-    }
-    aw_kprintf("\n");
+static uint32_t __rotl32 (uint32_t v, int n)
+{
+    n &= 31;
+    return n ? ((v << n) | (v >> (32 - n))) : v;
 }
 
-void des_sub_keys_generate(unsigned char* main_key, key_set* key_sets) {
-    int i, j;
-    int shift_size;
-    unsigned char shift_byte, first_shift_bits, second_shift_bits, third_shift_bits, fourth_shift_bits;
-
-    for (i=0; i<8; i++) {
-        key_sets[0].k[i] = 0;
-    }
-
-    for (i=0; i<56; i++) {
-        shift_size = initial_key_permutaion[i];
-        shift_byte = 0x80 >> ((shift_size - 1)%8);
-        shift_byte &= main_key[(shift_size - 1)/8];
-        shift_byte <<= ((shift_size - 1)%8);
-
-        key_sets[0].k[i/8] |= (shift_byte >> i%8);
-    }
-
-    for (i=0; i<3; i++) {
-        key_sets[0].c[i] = key_sets[0].k[i];
-    }
-
-    key_sets[0].c[3] = key_sets[0].k[3] & 0xF0;
+/* Round function: E expansion, key mixing and the combined SP lookup */
+static uint32_t __des_f (uint32_t r, const unsigned char* k)
+{
+    uint32_t f = 0;
+    int      i;
 
-    for (i=0; i<3; i++) {
-        key_sets[0].d[i] = (key_sets[0].k[i+3] & 0x0F) << 4;
-        key_sets[0].d[i] |= (key_sets[0].k[i+4] & 0xF0) >> 4;
+    /* S-box i takes bits 4i .. 4i+5 of R (1-based, wrapping around) */
+    for (i = 0; i < 8; i++) {
+        f |= __g_des_sp[i][((__rotl32(r, 4 * i - 1) >> 26) ^ k[i]) & 0x3F];
     }
+    return f;
+}
 
-    key_sets[0].d[3] = (key_sets[0].k[6] & 0x0F) << 4;
-
-
-    for (i=1; i<17; i++) {
-        for (j=0; j<4; j++) {
-            key_sets[i].c[j] = key_sets[i-1].c[j];
-            key_sets[i].d[j] = key_sets[i-1].d[j];
-        }
-
-        shift_size = key_shift_sizes[i];
-        if (shift_size == 1){
-            shift_byte = 0x80;
-        } else {
-            shift_byte = 0xC0;
-        }
-
-        // Process C
-        first_shift_bits = shift_byte & key_sets[i].c[0];
-        second_shift_bits = shift_byte & key_sets[i].c[1];
-        third_shift_bits = shift_byte & key_sets[i].c[2];
-        fourth_shift_bits = shift_byte & key_sets[i].c[3];
-
-        key_sets[i].c[0] <<= shift_size;
-        key_sets[i].c[0] |= (second_shift_bits >> (8 - shift_size));
-
-        key_sets[i].c[1] <<= shift_size;
-        key_sets[i].c[1] |= (third_shift_bits >> (8 - shift_size));
-
-        key_sets[i].c[2] <<= shift_size;
-        key_sets[i].c[2] |= (fourth_shift_bits >> (8 - shift_size));
-
-        key_sets[i].c[3] <<= shift_size;
-        key_sets[i].c[3] |= (first_shift_bits >> (4 - shift_size));
-
-        // Process D
-        first_shift_bits = shift_byte & key_sets[i].d[0];
-        second_shift_bits = shift_byte & key_sets[i].d[1];
-        third_shift_bits = shift_byte & key_sets[i].d[2];
-        fourth_shift_bits = shift_byte & key_sets[i].d[3];
-
-        key_sets[i].d[0] <<= shift_size;
-        key_sets[i].d[0] |= (second_shift_bits >> (8 - shift_size));
-
-        key_sets[i].d[1] <<= shift_size;
-        key_sets[i].d[1] |= (third_shift_bits >> (8 - shift_size));
-
-        key_sets[i].d[2] <<= shift_size;
-        key_sets[i].d[2] |= (fourth_shift_bits >> (8 - shift_size));
-
-        key_sets[i].d[3] <<= shift_size;
-        key_sets[i].d[3] |= (first_shift_bits >> (4 - shift_size));
-
-        for (j=0; j<48; j++) {
-            shift_size = sub_key_permutation[j];
-            if (shift_size <= 28) {
-                shift_byte = 0x80 >> ((shift_size - 1)%8);
-                shift_byte &= key_sets[i].c[(shift_size - 1)/8];
-                shift_byte <<= ((shift_size - 1)%8);
+void des_key_setup(des_ctx* ctx, const unsigned char* key)
+{
+    uint32_t c = 0, d = 0, cd;
+    uint64_t k48;
+    int      i, j, n;
+
+    /* PC1: 28-bit halves C and D, bit 1 of each half in bit 27 */
+    for (i = 0; i < 56; i++) {
+        n = __g_pc1[i] - 1;
+        if (key[n >> 3] & (0x80 >> (n & 7))) {
+            if (i < 28) {
+                c |= 1UL << (27 - i);
             } else {
-                shift_byte = 0x80 >> ((shift_size - 29)%8);
-                shift_byte &= key_sets[i].d[(shift_size - 29)/8];
-                shift_byte <<= ((shift_size - 29)%8);
+                d |= 1UL << (55 - i);
             }
-
-            key_sets[i].k[j/8] |= (shift_byte >> j%8);
         }
     }
-}
-
-void des_message_process(unsigned char* message_piece, unsigned char* processed_piece, key_set* key_sets, int mode) {
-    int i, k;
-    int shift_size;
-    unsigned char shift_byte;
-
-    unsigned char initial_permutation[8];
-    memset(initial_permutation, 0, 8);
-    memset(processed_piece, 0, 8);
-
-    for (i=0; i<64; i++) {
-        shift_size = initial_message_permutation[i];
-        shift_byte = 0x80 >> ((shift_size - 1)%8);
-        shift_byte &= message_piece[(shift_size - 1)/8];
-        shift_byte <<= ((shift_size - 1)%8);
-
-        initial_permutation[i/8] |= (shift_byte >> i%8);
-    }
-
-    unsigned char l[4], r[4];
-    for (i=0; i<4; i++) {
-        l[i] = initial_permutation[i];
-        r[i] = initial_permutation[i+4];
-    }
-
-    unsigned char ln[4], rn[4], er[6], ser[4];
-
-    int key_index;
-    for (k=1; k<=16; k++) {
-        memcpy(ln, r, 4);
-
-        memset(er, 0, 6);
-
-        for (i=0; i<48; i++) {
-            shift_size = message_expansion[i];
-            shift_byte = 0x80 >> ((shift_size - 1)%8);
-            shift_byte &= r[(shift_size - 1)/8];
-            shift_byte <<= ((shift_size - 1)%8);
-
-            er[i/8] |= (shift_byte >> i%8);
-        }
-
-        if (mode == DECRYPTION_MODE) {
-            key_index = 17 - k;
-        } else {
-            key_index = k;
-        }
-
-        for (i=0; i<6; i++) {
-            er[i] ^= key_sets[key_index].k[i];
-        }
-
-        unsigned char row, column;
-
-        for (i=0; i<4; i++) {
-            ser[i] = 0;
-        }
-
-        // 0000 0000 0000 0000 0000 0000
-        // rccc crrc cccr rccc crrc cccr
-
-        // Byte 1
-        row = 0;
-        row |= ((er[0] & 0x80) >> 6);
-        row |= ((er[0] & 0x04) >> 2);
-
-        column = 0;
-        column |= ((er[0] & 0x78) >> 3);
-
-        ser[0] |= ((unsigned char)S1[row*16+column] << 4);
-
-        row = 0;
-        row |= (er[0] & 0x02);
-        row |= ((er[1] & 0x10) >> 4);
-
-        column = 0;
-        column |= ((er[0] & 0x01) << 3);
-        column |= ((er[1] & 0xE0) >> 5);
-
-        ser[0] |= (unsigned char)S2[row*16+column];
-
-        // Byte 2
-        row = 0;
-        row |= ((er[1] & 0x08) >> 2);
-        row |= ((er[2] & 0x40) >> 6);
 
-        column = 0;
-        column |= ((er[1] & 0x07) << 1);
-        column |= ((er[2] & 0x80) >> 7);
-
-        ser[1] |= ((unsigned char)S3[row*16+column] << 4);
-
-        row = 0;
-        row |= ((er[2] & 0x20) >> 4);
-        row |= (er[2] & 0x01);
-
-        column = 0;
-        column |= ((er[2] & 0x1E) >> 1);
-
-        ser[1] |= (unsigned char)S4[row*16+column];
-
-        // Byte 3
-        row = 0;
-        row |= ((er[3] & 0x80) >> 6);
-        row |= ((er[3] & 0x04) >> 2);
-
-        column = 0;
-        column |= ((er[3] & 0x78) >> 3);
-
-        ser[2] |= ((unsigned char)S5[row*16+column] << 4);
-
-        row = 0;
-        row |= (er[3] & 0x02);
-        row |= ((er[4] & 0x10) >> 4);
-
-        column = 0;
-        column |= ((er[3] & 0x01) << 3);
-        column |= ((er[4] & 0xE0) >> 5);
-
-        ser[2] |= (unsigned char)S6[row*16+column];
-
-        // Byte 4
-        row = 0;
-        row |= ((er[4] & 0x08) >> 2);
-        row |= ((er[5] & 0x40) >> 6);
-
-        column = 0;
-        column |= ((er[4] & 0x07) << 1);
-        column |= ((er[5] & 0x80) >> 7);
-
-        ser[3] |= ((unsigned char)S7[row*16+column] << 4);
-
-        row = 0;
-        row |= ((er[5] & 0x20) >> 4);
-        row |= (er[5] & 0x01);
-
-        column = 0;
-        column |= ((er[5] & 0x1E) >> 1);
-
-        ser[3] |= (unsigned char)S8[row*16+column];
-
-        for (i=0; i<4; i++) {
-            rn[i] = 0;
+    for (i = 0; i < 16; i++) {
+        n = __g_key_shift[i];
+        c = ((c << n) | (c >> (28 - n))) & 0x0FFFFFFFUL;
+        d = ((d << n) | (d >> (28 - n))) & 0x0FFFFFFFUL;
+
+        /* PC2 picks 48 of the 56 bits of C:D */
+        k48 = 0;
+        for (j = 0; j < 48; j++) {
+            n  = __g_pc2[j];
+            cd = (n <= 28) ? (c >> (28 - n)) : (d >> (56 - n));
+            k48 |= (uint64_t)(cd & 1) << (47 - j);
         }
-
-        for (i=0; i<32; i++) {
-            shift_size = right_sub_message_permutation[i];
-            shift_byte = 0x80 >> ((shift_size - 1)%8);
-            shift_byte &= ser[(shift_size - 1)/8];
-            shift_byte <<= ((shift_size - 1)%8);
-
-            rn[i/8] |= (shift_byte >> i%8);
+        for (j = 0; j < 8; j++) {
+            ctx->sk[i][j] = (unsigned char)((k48 >> (42 - 6 * j)) & 0x3F);
         }
+    }
 
-        for (i=0; i<4; i++) {
-            rn[i] ^= l[i];
-        }
+    memcpy(ctx->key, key, 8);
+    ctx->valid = 1;
+}
 
-        for (i=0; i<4; i++) {
-            l[i] = ln[i];
-            r[i] = rn[i];
-        }
+int des_key_setup_cached(des_ctx* ctx, const unsigned char* key)
+{
+    if (ctx->valid && (0 == memcmp(ctx->key, key, 8))) {
+        return 1;
     }
+    des_key_setup(ctx, key);
+    return 0;
+}
 
-    unsigned char pre_end_permutation[8];
-    for (i=0; i<4; i++) {
-        pre_end_permutation[i] = r[i];
-        pre_end_permutation[4+i] = l[i];
+void des_block_process(const des_ctx* ctx,
+                       const unsigned char* in,
+                       unsigned char* out,
+                       int mode)
+{
+    uint32_t l = __GET_UINT32(in);
+    uint32_t r = __GET_UINT32(in + 4);
+    uint32_t t;
+    int      i;
+
+    __des_ip(&l, &r);
+
+    for (i = 0; i < 16; i++) {
+        t = l ^ __des_f(r, ctx->sk[(mode == DECRYPTION_MODE) ? (15 - i) : i]);
+        l = r;
+        r = t;
     }
 
-    for (i=0; i<64; i++) {
-        shift_size = final_message_permutation[i];
-        shift_byte = 0x80 >> ((shift_size - 1)%8);
-        shift_byte &= pre_end_permutation[(shift_size - 1)/8];
-        shift_byte <<= ((shift_size - 1)%8);
+    /* the halves are not swapped after the last round */
+    __des_fp(&r, &l);
 
-        processed_piece[i/8] |= (shift_byte >> i%8);
-    }
+    __PUT_UINT32(r, out);
+    __PUT_UINT32(l, out + 4);
 }
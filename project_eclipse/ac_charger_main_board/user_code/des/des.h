@@ -1,17 +1,32 @@
 #ifndef _DES_H_
 #define _DES_H_
 
+#include <stdint.h>
+
 #define ENCRYPTION_MODE 1
 #define DECRYPTION_MODE 0
 
+/**
+ * DES context: the key schedule is expanded once and reused for every block
+ * processed with the same key.
+ */
 typedef struct {
-    unsigned char k[8];
-    unsigned char c[4];
-    unsigned char d[4];
-} key_set;
+    unsigned char key[8];       /* key the schedule was generated from */
+    unsigned char valid;        /* schedule holds the sub keys of key[] */
+    unsigned char sk[16][8];    /* 16 rounds x 8 six-bit sub keys */
+} des_ctx;
+
+/* Expand the key schedule */
+void des_key_setup(des_ctx* ctx, const unsigned char* key);
+
+/* Expand the key schedule only when key differs from the cached one,
+ * returns 1 if the cached schedule was reused */
+int des_key_setup_cached(des_ctx* ctx, const unsigned char* key);
 
-void des_key_generate(unsigned char* key);
-void des_sub_keys_generate(unsigned char* main_key, key_set* key_sets);
-void des_message_process(unsigned char* message_piece, unsigned char* processed_piece, key_set* key_sets, int mode);
+/* Encrypt or decrypt one 8-byte block, in and out may overlap */
+void des_block_process(const des_ctx* ctx,
+                       const unsigned char* in,
+                       unsigned char* out,
+                       int mode);
 
 #endif
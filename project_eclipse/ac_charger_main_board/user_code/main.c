@@ -11,13 +11,13 @@
 * e-mail:      apollo.support@zlg.cn
 *******************************************************************************/
 
-#include "apollo.h"                     /* ͷļ뱻Ȱ  */
-#include "main.h"                       /* ûͷļ        */
+#include "apollo.h"                     /* 此头文件必须被首先包含  */
+#include "main.h"                       /* 用户程序主头文件        */
 
-/* õ· */
-#include "aw_task.h"                    /*  */
-#include "aw_delay.h"                   /* ʱ */
-#include "aw_led.h"                     /* LED */
+/* 本程序用到了以下服务 */
+#include "aw_task.h"                    /* 多任务服务 */
+#include "aw_delay.h"                   /* 延时服务 */
+#include "aw_led.h"                     /* LED服务 */
 #include "aw_vdebug.h"
 #include "aw_serial.h"
 
@@ -18,10 +18,10 @@
 extern "C" {
 #endif
 
-/* todo: ûãûͷļûĺ궨 */
+/* todo: 在这里进行用户的配置，包括引入用户程序所需头文件、用户的宏定义等 */
 
 /*******************************************************************************
-  LEDŶ
+  LED编号定义
 *******************************************************************************/
 #define LED0          0
 #define LED1          1
@@ -1,10 +1,15 @@
 /**
  * \file
- * \brief ׮ƼƷѵԪ뼯пModbusͨѶЭݴ
+ * \brief 交流桩控制计费单元与集中控制器Modbus通讯协议数据处理
  *
  * \internal
  * \par modification history
  * - 1.00 2016-04-26 cod, first implementation
+ * - 1.01 2016-10-08 xjc, 读写寄存器遇到非法地址时退出循环（原为死循环）
+ * - 1.02 2016-10-13 xjc, 增加遥测任务剖析寄存器读取
+ * - 1.03 2016-10-14 xjc, 增加遥测延迟直方图寄存器读取， 统计读写寄存器处理时间
+ * - 1.04 2016-10-16 xjc, 增加遥测黑匣子寄存器读取
+ * - 1.05 2016-10-17 xjc, 轮询及升级帧错误改为延迟格式化日志
  * \endinternal
  */
 #include "ac_modbus_reg_map.h"
@@ -16,20 +21,22 @@
 #include "aw_int.h"
 #include "aw_ioctl.h"
 #include "acp1000/ac_charge_prj_cfg.h"
+#include "acp1000/lat_hist.h"
+#include "acp1000/slog.h"
 /******************************************************************************/
-#define MB_SLAVE_ADDR      0x01            /**< \brief ModbusͨѶַ   */
-#define MB_SERIAL_COM      1               /**< \brief ModbusͨѶ          */
-#define MB_COM_BAUD_RATE   19200            /**< \brief ModbusͨѶڲ          */
-#define MB_COM_PARITY      AW_MB_PAR_NONE  /**< \brief ModbusͨѶУ鷽ʽ          */
+#define MB_SLAVE_ADDR      0x01            /**< \brief Modbus通讯本机地址   */
+#define MB_SERIAL_COM      1               /**< \brief Modbus通讯串口          */
+#define MB_COM_BAUD_RATE   19200            /**< \brief Modbus通讯串口波特率          */
+#define MB_COM_PARITY      AW_MB_PAR_NONE  /**< \brief Modbus通讯串口校验方式          */
 
-#define MB_POLL_TASK_PRI       5           /**< \brief ѯȼ         */
-#define MB_TASK_STACK_SIZE     4096        /**< \brief ModbusվջС         */
+#define MB_POLL_TASK_PRI       5           /**< \brief 轮询函数任务优先级         */
+#define MB_TASK_STACK_SIZE     4096        /**< \brief Modbus从站任务栈大小         */
 
 /******************************************************************************/
-aw_local struct modbus_reg_map  *gp_mb_reg_map;  /**< \brief modbusĴ  */
+aw_local struct modbus_reg_map  *gp_mb_reg_map;  /**< \brief 保存modbus寄存器表  */
 /******************************************************************************/
 
-/* ң---Ĵ  */
+/* 遥信---读寄存器  */
 aw_local aw_mb_exception_t remote_signal_reg_read (uint8_t  *p_buf,
                                                    uint16_t  addr,
                                                    uint16_t  num)
@@ -44,15 +51,15 @@ aw_local aw_mb_exception_t remote_signal_reg_read (uint8_t  *p_buf,
         return AW_MB_EXP_ILLEGAL_DATA_VALUE;
     }
 
-    modbus_reg_map_lock(gp_mb_reg_map); /* ȡ  */
+    modbus_reg_map_lock(gp_mb_reg_map); /* 读取保护  */
     aw_mb_regcpy(p_buf, p_regbuf + index, num);
-    modbus_reg_map_unlock(gp_mb_reg_map); /* ȡ  */
+    modbus_reg_map_unlock(gp_mb_reg_map); /* 读取保护  */
 #endif
 
     return AW_MB_EXP_NONE;
 }
 
-/* ң---Ĵ  */
+/* 遥信---读寄存器  */
 aw_local
 aw_mb_exception_t remote_measure_charge_dat_reg_read (uint8_t  *p_buf,
                                                       uint16_t  addr,
@@ -67,14 +74,14 @@ aw_mb_exception_t remote_measure_charge_dat_reg_read (uint8_t  *p_buf,
     return AW_MB_EXP_ILLEGAL_DATA_VALUE;
     }
 
-    modbus_reg_map_lock(gp_mb_reg_map); /* ȡ  */
+    modbus_reg_map_lock(gp_mb_reg_map); /* 读取保护  */
     aw_mb_regcpy(p_buf, p_regbuf + index, num);
-    modbus_reg_map_unlock(gp_mb_reg_map); /* ȡ  */
+    modbus_reg_map_unlock(gp_mb_reg_map); /* 读取保护  */
 
     return AW_MB_EXP_NONE;
 }
 
-/* ң---Ĵ  */
+/* 遥信---读寄存器  */
 aw_local
 aw_mb_exception_t remote_measure_charge_usr_reg_read (uint8_t  *p_buf,
                                                       uint16_t  addr,
@@ -90,14 +97,14 @@ aw_mb_exception_t remote_measure_charge_usr_reg_read (uint8_t  *p_buf,
         return AW_MB_EXP_ILLEGAL_DATA_VALUE;
     }
 
-    modbus_reg_map_lock(gp_mb_reg_map); /* ȡ  */
+    modbus_reg_map_lock(gp_mb_reg_map); /* 读取保护  */
     aw_mb_regcpy(p_buf, p_regbuf + index, num);
-    modbus_reg_map_unlock(gp_mb_reg_map); /* ȡ  */
+    modbus_reg_map_unlock(gp_mb_reg_map); /* 读取保护  */
 
     return AW_MB_EXP_NONE;
 }
 
-/* ң---  */
+/* 遥信---整机数据  */
 aw_local
 aw_mb_exception_t remote_measure_charge_pile_reg_read (uint8_t  *p_buf,
                                                       uint16_t  addr,
@@ -113,15 +120,15 @@ aw_mb_exception_t remote_measure_charge_pile_reg_read (uint8_t  *p_buf,
         return AW_MB_EXP_ILLEGAL_DATA_VALUE;
     }
 
-    modbus_reg_map_lock(gp_mb_reg_map); /* ȡ  */
+    modbus_reg_map_lock(gp_mb_reg_map); /* 读取保护  */
     aw_mb_regcpy(p_buf, p_regbuf + index, num);
-    modbus_reg_map_unlock(gp_mb_reg_map); /* ȡ  */
+    modbus_reg_map_unlock(gp_mb_reg_map); /* 读取保护  */
 
     return AW_MB_EXP_NONE;
 }
 
 
-/* ң---Ĵ  */
+/* 遥信---卡寄存器  */
 aw_local
 aw_mb_exception_t remote_measure_charge_card_reg_read (uint8_t  *p_buf,
                                                        uint16_t  addr,
@@ -136,16 +143,147 @@ aw_mb_exception_t remote_measure_charge_card_reg_read (uint8_t  *p_buf,
         return AW_MB_EXP_ILLEGAL_DATA_VALUE;
     }
 
-    modbus_reg_map_lock(gp_mb_reg_map); /* ȡ  */
+    modbus_reg_map_lock(gp_mb_reg_map); /* 读取保护  */
     aw_mb_regcpy(p_buf, p_regbuf + index, num);
-    modbus_reg_map_unlock(gp_mb_reg_map); /* ȡ  */
+    modbus_reg_map_unlock(gp_mb_reg_map); /* 读取保护  */
 
     return AW_MB_EXP_NONE;
 }
 
+#if ACP1000_TASK_PROF && ACP1000_TASK_PROF_MB
+/* 遥测---任务剖析寄存器读取  */
+aw_local
+aw_mb_exception_t remote_measure_task_prof_reg_read (uint8_t  *p_buf,
+                                                     uint16_t  addr,
+                                                     uint16_t  num)
+{
+    struct aw_remote_measure_task_prof *p_prof_reg = &gp_mb_reg_map->rm_measure_reg.task_prof;
+    uint16_t                           *p_regbuf   = (uint16_t *)p_prof_reg;
+    uint16_t                            index      = addr - RM_MEASURE_TASK_PROF_REG_ADDR;
+
+    if ((addr + num) > (RM_MEASURE_TASK_PROF_REG_ADDR + RM_MEASURE_TASK_PROF_REG_NUM)) {
+        return AW_MB_EXP_ILLEGAL_DATA_VALUE;
+    }
+
+    modbus_reg_map_lock(gp_mb_reg_map); /* 读取保护  */
+    aw_mb_regcpy(p_buf, p_regbuf + index, num);
+    modbus_reg_map_unlock(gp_mb_reg_map); /* 读取保护  */
+
+    return AW_MB_EXP_NONE;
+}
+#endif
+
+#if ACP1000_LAT_HIST && ACP1000_LAT_HIST_MB
+/* 遥测---延迟直方图寄存器读取  */
+aw_local
+aw_mb_exception_t remote_measure_lat_hist_reg_read (uint8_t  *p_buf,
+                                                    uint16_t  addr,
+                                                    uint16_t  num)
+{
+    struct aw_remote_measure_lat_hist *p_hist_reg = &gp_mb_reg_map->rm_measure_reg.lat_hist;
+    uint16_t                          *p_regbuf   = (uint16_t *)p_hist_reg;
+    uint16_t                           index      = addr - RM_MEASURE_LAT_HIST_REG_ADDR;
+
+    if ((addr + num) > (RM_MEASURE_LAT_HIST_REG_ADDR + RM_MEASURE_LAT_HIST_REG_NUM)) {
+        return AW_MB_EXP_ILLEGAL_DATA_VALUE;
+    }
+
+    modbus_reg_map_lock(gp_mb_reg_map); /* 读取保护  */
+    aw_mb_regcpy(p_buf, p_regbuf + index, num);
+    modbus_reg_map_unlock(gp_mb_reg_map); /* 读取保护  */
+
+    return AW_MB_EXP_NONE;
+}
+#endif
+
+#if ACP1000_BLACKBOX && ACP1000_BLACKBOX_MB
+/* 遥测---黑匣子寄存器读取  */
+aw_local
+aw_mb_exception_t remote_measure_blackbox_reg_read (uint8_t  *p_buf,
+                                                    uint16_t  addr,
+                                                    uint16_t  num)
+{
+    struct aw_remote_measure_blackbox *p_bb_reg = &gp_mb_reg_map->rm_measure_reg.blackbox;
+    uint16_t                          *p_regbuf = (uint16_t *)p_bb_reg;
+    uint16_t                           index    = addr - RM_MEASURE_BLACKBOX_REG_ADDR;
+
+    if ((addr + num) > (RM_MEASURE_BLACKBOX_REG_ADDR + RM_MEASURE_BLACKBOX_REG_NUM)) {
+        return AW_MB_EXP_ILLEGAL_DATA_VALUE;
+    }
+
+    modbus_reg_map_lock(gp_mb_reg_map); /* 读取保护  */
+    aw_mb_regcpy(p_buf, p_regbuf + index, num);
+    modbus_reg_map_unlock(gp_mb_reg_map); /* 读取保护  */
+
+    return AW_MB_EXP_NONE;
+}
+#endif
+
+/* 遥调---负荷管理寄存器读取  */
+aw_local
+aw_mb_exception_t remote_adj_load_reg_read (uint8_t  *p_buf,
+                                            uint16_t  addr,
+                                            uint16_t  num)
+{
+    struct aw_remote_adjust_load_ctrl *p_load_reg = &gp_mb_reg_map->rm_adjust_reg.load_ctrl;
+    uint16_t                          *p_regbuf   = (uint16_t *)p_load_reg;
+    uint16_t                           index      = addr - RM_ADJ_LOAD_REG_ADDR;
+
+    if ((addr + num) > (RM_ADJ_LOAD_REG_ADDR + RM_ADJ_LOAD_REG_NUM)) {
+        return AW_MB_EXP_ILLEGAL_DATA_VALUE;
+    }
+
+    modbus_reg_map_lock(gp_mb_reg_map); /* 读取保护  */
+    aw_mb_regcpy(p_buf, p_regbuf + index, num);
+    modbus_reg_map_unlock(gp_mb_reg_map); /* 读取保护  */
+
+    return AW_MB_EXP_NONE;
+}
+
+/* 遥调---智能充电规划寄存器读取  */
+aw_local
+aw_mb_exception_t remote_adj_sched_reg_read (uint8_t  *p_buf,
+                                             uint16_t  addr,
+                                             uint16_t  num)
+{
+    struct aw_remote_adjust_sched_ctrl *p_sched_reg = &gp_mb_reg_map->rm_adjust_reg.sched_ctrl;
+    uint16_t                           *p_regbuf    = (uint16_t *)p_sched_reg;
+    uint16_t                            index       = addr - RM_ADJ_SCHED_REG_ADDR;
+
+    if ((addr + num) > (RM_ADJ_SCHED_REG_ADDR + RM_ADJ_SCHED_REG_NUM)) {
+        return AW_MB_EXP_ILLEGAL_DATA_VALUE;
+    }
+
+    modbus_reg_map_lock(gp_mb_reg_map); /* 读取保护  */
+    aw_mb_regcpy(p_buf, p_regbuf + index, num);
+    modbus_reg_map_unlock(gp_mb_reg_map); /* 读取保护  */
+
+    return AW_MB_EXP_NONE;
+}
+
+/* 遥调---离线卡名单寄存器读取  */
+aw_local
+aw_mb_exception_t remote_adj_card_wl_reg_read (uint8_t  *p_buf,
+                                               uint16_t  addr,
+                                               uint16_t  num)
+{
+    struct aw_remote_adjust_card_wl *p_wl_reg = &gp_mb_reg_map->rm_adjust_reg.card_wl;
+    uint16_t                        *p_regbuf = (uint16_t *)p_wl_reg;
+    uint16_t                         index    = addr - RM_ADJ_CARD_WL_REG_ADDR;
+
+    if ((addr + num) > (RM_ADJ_CARD_WL_REG_ADDR + RM_ADJ_CARD_WL_REG_NUM)) {
+        return AW_MB_EXP_ILLEGAL_DATA_VALUE;
+    }
+
+    modbus_reg_map_lock(gp_mb_reg_map); /* 读取保护  */
+    aw_mb_regcpy(p_buf, p_regbuf + index, num);
+    modbus_reg_map_unlock(gp_mb_reg_map); /* 读取保护  */
+
+    return AW_MB_EXP_NONE;
+}
 
 /******************************************************************************/
-/* ң---ʱж */
+/* 遥调---时间设置判断 */
 aw_local int remote_adj_time_judge (const uint8_t *p_buf, uint16_t num)
 {
     uint8_t   i;
@@ -204,7 +342,7 @@ __exit:
     }
 }
 
-/* ң---ʱ  */
+/* 遥调---对时数据设置  */
 aw_local aw_mb_exception_t remote_adj_time_reg_write (uint8_t  *p_buf,
                                                       uint16_t  addr,
                                                       uint16_t  num)
@@ -216,7 +354,7 @@ aw_local aw_mb_exception_t remote_adj_time_reg_write (uint8_t  *p_buf,
     uint16_t                           index       = 0;
     uint8_t                            i           = 0;
 
-    /* ʱ  */
+    /* 设置时间  */
     struct aw_charger_time time;
     struct mb_func_cb_structure *p_func_cb = \
                     modbus_func_cb_get(gp_mb_reg_map, TIME_SET_FUNC);
@@ -238,16 +376,16 @@ aw_local aw_mb_exception_t remote_adj_time_reg_write (uint8_t  *p_buf,
         }
     }
 
-    modbus_reg_map_lock(gp_mb_reg_map); /* ȡ  */
+    modbus_reg_map_lock(gp_mb_reg_map); /* 读取保护  */
     aw_mb_regcpy(p_regbuf + index, p_buf, num);
     aw_mb_regcpy(&gp_mb_reg_map->rm_measure_reg.charger_data.local_time, p_buf, 6);
 
-    modbus_reg_map_unlock(gp_mb_reg_map); /* ȡ  */
+    modbus_reg_map_unlock(gp_mb_reg_map); /* 读取保护  */
 
     return exception;
 
 }
-/* ң---׮  */
+/* 遥调---整桩数据设置  */
 aw_local aw_mb_exception_t remote_adj_pile_reg_write (uint8_t  *p_buf,
                                                       uint16_t  addr,
                                                       uint16_t  num)
@@ -260,11 +398,11 @@ aw_local aw_mb_exception_t remote_adj_pile_reg_write (uint8_t  *p_buf,
 
     num = num > RM_ADJ_PILE_REG_NUM ? RM_ADJ_PILE_REG_NUM : num;
 
-    modbus_reg_map_lock(gp_mb_reg_map); /* ȡ  */
+    modbus_reg_map_lock(gp_mb_reg_map); /* 读取保护  */
     aw_mb_regcpy(p_regbuf + index, p_buf, num);
-    modbus_reg_map_unlock(gp_mb_reg_map); /* ȡ  */
+    modbus_reg_map_unlock(gp_mb_reg_map); /* 读取保护  */
 
-    /* ң */
+    /* 电价遥调 */
     if (addr <= (RM_ADJ_CHARGE_PRICE_ADDR) &&
         (addr + num) >= (RM_ADJ_CHARGE_PRICE_ADDR + RM_ADJ_CHARGE_PRICE_NUM)) {
 
@@ -279,7 +417,7 @@ aw_local aw_mb_exception_t remote_adj_pile_reg_write (uint8_t  *p_buf,
         }
     }
 
-    /* ׮ID */
+    /* 桩ID */
     if (addr <= (RM_ADJ_PILE_ID_ADDR) &&
         (addr + num) >= (RM_ADJ_PILE_ID_ADDR + RM_ADJ_PILE_ID_NUM)) {
 
@@ -297,7 +435,7 @@ aw_local aw_mb_exception_t remote_adj_pile_reg_write (uint8_t  *p_buf,
     return exception;
 }
 
-/* ң---׮  */
+/* 遥调---整桩数据设置  */
 aw_local aw_mb_exception_t remote_adj_usr_reg_write (uint8_t  *p_buf,
                                                      uint16_t  addr,
                                                      uint16_t  num)
@@ -310,11 +448,11 @@ aw_local aw_mb_exception_t remote_adj_usr_reg_write (uint8_t  *p_buf,
 
     num = num > RM_ADJ_USR_REG_NUM ? RM_ADJ_USR_REG_NUM : num;
 
-    modbus_reg_map_lock(gp_mb_reg_map); /* ȡ  */
+    modbus_reg_map_lock(gp_mb_reg_map); /* 读取保护  */
     aw_mb_regcpy(p_regbuf + index, p_buf, num);
-    modbus_reg_map_unlock(gp_mb_reg_map); /* ȡ  */
+    modbus_reg_map_unlock(gp_mb_reg_map); /* 读取保护  */
 
-    /* ӿڱ־ */
+    /* 充电接口标志 */
     if (addr <= (RM_ADJ_USR_CHARGE_INTERFACE_ADDR) &&
         (addr + num) >= (RM_ADJ_USR_CHARGE_INTERFACE_ADDR + RM_ADJ_USR_CHARGE_INTERFACE_NUM)) {
 
@@ -403,10 +541,151 @@ aw_local aw_mb_exception_t remote_adj_usr_reg_write (uint8_t  *p_buf,
     return exception;
 }
 
+/* 遥调---负荷管理设置  */
+aw_local aw_mb_exception_t remote_adj_load_reg_write (uint8_t  *p_buf,
+                                                      uint16_t  addr,
+                                                      uint16_t  num)
+{
+    aw_mb_exception_t                  exception   = AW_MB_EXP_NONE;
+    struct aw_remote_adjust_load_ctrl *p_load_data = \
+                                        &gp_mb_reg_map->rm_adjust_reg.load_ctrl;
+    struct aw_remote_adjust_load_ctrl  load_data;
+    struct mb_func_cb_structure       *p_func_cb   = NULL;
+    uint16_t                          *p_regbuf    = (uint16_t *)p_load_data;
+    uint16_t                           index       = addr - RM_ADJ_LOAD_REG_ADDR;
+    uint16_t                           enable;
+
+    /* 当前电流及保留区只读 */
+    if ((addr + num) > (RM_ADJ_LOAD_REG_ADDR + RM_ADJ_LOAD_WR_NUM)) {
+        return AW_MB_EXP_ILLEGAL_DATA_ADDRESS;
+    }
+
+    /* 负荷管理使能值判断  */
+    if (addr == RM_ADJ_LOAD_REG_ADDR) {
+        enable = (p_buf[0] << 8) | p_buf[1];
+        if ((enable != RM_CTRL_DATA_VAL_RESET) &&
+            (enable != RM_CTRL_DATA_VAL_SET)) {
+            return AW_MB_EXP_ILLEGAL_DATA_VALUE;
+        }
+    }
+
+    modbus_reg_map_lock(gp_mb_reg_map); /* 读取保护  */
+    aw_mb_regcpy(p_regbuf + index, p_buf, num);
+    load_data = *p_load_data;
+    modbus_reg_map_unlock(gp_mb_reg_map); /* 读取保护  */
+
+    /* 每次写入都视为集中器刷新了分配电流 */
+    p_func_cb = modbus_func_cb_get(gp_mb_reg_map, LOAD_CTRL_FUNC);
+    if ((NULL != p_func_cb) && (p_func_cb->mb_func_cb)) {
+        if (AW_OK != p_func_cb->mb_func_cb(p_func_cb->p_arg,
+                                           (void *)&load_data,
+                                           0,
+                                           NULL)) {
+            exception = AW_MB_EXP_SLAVE_DEVICE_FAILURE;
+        }
+    }
+
+    return exception;
+}
+
+/* 遥调---智能充电规划设置  */
+aw_local aw_mb_exception_t remote_adj_sched_reg_write (uint8_t  *p_buf,
+                                                       uint16_t  addr,
+                                                       uint16_t  num)
+{
+    aw_mb_exception_t                   exception    = AW_MB_EXP_NONE;
+    struct aw_remote_adjust_sched_ctrl *p_sched_data = \
+                                        &gp_mb_reg_map->rm_adjust_reg.sched_ctrl;
+    struct aw_remote_adjust_sched_ctrl  sched_data;
+    struct mb_func_cb_structure        *p_func_cb    = NULL;
+    uint16_t                           *p_regbuf     = (uint16_t *)p_sched_data;
+    uint16_t                            index        = addr - RM_ADJ_SCHED_REG_ADDR;
+    uint16_t                            enable;
+
+    /* 规划结果只读 */
+    if ((addr + num) > (RM_ADJ_SCHED_REG_ADDR + RM_ADJ_SCHED_WR_NUM)) {
+        return AW_MB_EXP_ILLEGAL_DATA_ADDRESS;
+    }
+
+    /* 规划使能值判断  */
+    if (addr == RM_ADJ_SCHED_REG_ADDR) {
+        enable = (p_buf[0] << 8) | p_buf[1];
+        if ((enable != RM_CTRL_DATA_VAL_RESET) &&
+            (enable != RM_CTRL_DATA_VAL_SET)) {
+            return AW_MB_EXP_ILLEGAL_DATA_VALUE;
+        }
+    }
+
+    modbus_reg_map_lock(gp_mb_reg_map); /* 读取保护  */
+    sched_data = *p_sched_data;
+    aw_mb_regcpy((uint16_t *)&sched_data + index, p_buf, num);
+
+    /* 离开时间判断 */
+    if ((sched_data.depart_hour > 23) || (sched_data.depart_min > 59)) {
+        modbus_reg_map_unlock(gp_mb_reg_map);
+        return AW_MB_EXP_ILLEGAL_DATA_VALUE;
+    }
+    aw_mb_regcpy(p_regbuf + index, p_buf, num);
+    modbus_reg_map_unlock(gp_mb_reg_map); /* 读取保护  */
+
+    p_func_cb = modbus_func_cb_get(gp_mb_reg_map, SCHED_CTRL_FUNC);
+    if ((NULL != p_func_cb) && (p_func_cb->mb_func_cb)) {
+        if (AW_OK != p_func_cb->mb_func_cb(p_func_cb->p_arg,
+                                           (void *)&sched_data,
+                                           0,
+                                           NULL)) {
+            exception = AW_MB_EXP_SLAVE_DEVICE_FAILURE;
+        }
+    }
+
+    return exception;
+}
+
+/* 遥调---离线卡名单操作  */
+aw_local aw_mb_exception_t remote_adj_card_wl_reg_write (uint8_t  *p_buf,
+                                                         uint16_t  addr,
+                                                         uint16_t  num)
+{
+    aw_mb_exception_t                exception = AW_MB_EXP_NONE;
+    struct aw_remote_adjust_card_wl *p_wl_data = &gp_mb_reg_map->rm_adjust_reg.card_wl;
+    struct aw_remote_adjust_card_wl  wl_data;
+    struct mb_func_cb_structure     *p_func_cb = NULL;
+    uint16_t                         cmd;
+
+    /* 操作命令、卡ID及版本号须一次写入 */
+    if ((addr != RM_ADJ_CARD_WL_REG_ADDR) || (num != RM_ADJ_CARD_WL_WR_NUM)) {
+        return AW_MB_EXP_ILLEGAL_DATA_ADDRESS;
+    }
+
+    cmd = (p_buf[0] << 8) | p_buf[1];
+    if ((cmd != RM_CARD_WL_CMD_ADD) &&
+        (cmd != RM_CARD_WL_CMD_DEL) &&
+        (cmd != RM_CARD_WL_CMD_CLR)) {
+        return AW_MB_EXP_ILLEGAL_DATA_VALUE;
+    }
+
+    modbus_reg_map_lock(gp_mb_reg_map); /* 读取保护  */
+    aw_mb_regcpy((uint16_t *)p_wl_data, p_buf, num);
+    wl_data = *p_wl_data;
+    modbus_reg_map_unlock(gp_mb_reg_map); /* 读取保护  */
+
+    p_func_cb = modbus_func_cb_get(gp_mb_reg_map, CARD_WL_FUNC);
+    if ((NULL != p_func_cb) && (p_func_cb->mb_func_cb)) {
+        if (AW_OK != p_func_cb->mb_func_cb(p_func_cb->p_arg,
+                                           (void *)&wl_data,
+                                           0,
+                                           NULL)) {
+            exception = AW_MB_EXP_SLAVE_DEVICE_FAILURE;
+        }
+    }
+
+    return exception;
+}
+
 /******************************************************************************/
 
 /******************************************************************************/
-/* ң---ǹ  */
+/* 遥控---枪控制  */
 aw_local aw_mb_exception_t remote_ctrl_gun_reg_write (uint8_t  *p_buf,
                                                       uint16_t  addr,
                                                       uint16_t  num,
@@ -420,17 +699,17 @@ aw_local aw_mb_exception_t remote_ctrl_gun_reg_write (uint8_t  *p_buf,
     int                               err        = 0;
     uint16_t                          index;
 
-    /* ȡǹϢĴַ  */
+    /* 获取枪信息寄存器基地址  */
     index     = addr - RM_CTRL_REG_ADDR;
 
-//todo ĿǰΪдĴ˴ж
-//    /* ʵַΧж */
+//todo 目前设置为写单个寄存器，此处无需判断
+//    /* 访问地址范围判断 */
 //    if ((num > RM_CTRL_GUN_REG_NUM) ||
 //        ((addr + num) > (base_addr + RM_CTRL_GUN_REG_NUM))) {
 //        return AW_MB_EXP_ILLEGAL_DATA_VALUE;
 //    }
 
-    /* ֵж  */
+    /* 值判断  */
     if ((p_buf[1] != RM_CTRL_DATA_VAL_RESET) && \
         (p_buf[1] != RM_CTRL_DATA_VAL_SET)) {
         return AW_MB_EXP_ILLEGAL_DATA_VALUE;
@@ -438,33 +717,33 @@ aw_local aw_mb_exception_t remote_ctrl_gun_reg_write (uint8_t  *p_buf,
 
     switch (index) {
 
-    /** ң--   */
+    /** 遥控--允许充电控制   */
     case RM_CTRL_ALLOW_CHARGING_ADDR_OFFSET:
         p_mb_func = modbus_func_cb_get(gp_mb_reg_map, ALLOW_CHARGING_FUNC);
         break;
 
-    /** ң--   */
+    /** 遥控--启动充电   */
     case RM_CTRL_CHARGING_STARTUP_ADDR_OFFSET:
         p_mb_func = modbus_func_cb_get(gp_mb_reg_map, CHARGING_STARTUP_FUNC);
         break;
 
-    /** ң--Ļ  */
+    /** 遥控--解锁屏幕  */
     case RM_CTRL_UNLOCK_SCREEN_ADDR_OFFSET:
         p_mb_func = modbus_func_cb_get(gp_mb_reg_map, UNLOCK_SCREEN_FUNC);
         break;
 
-    /** ң--4GͨѶ״̬  */
+    /** 遥控--4G通讯状态  */
     case RM_CTRL_COMM_4G_STAT_ADDR_OFFSET:
         p_mb_func = modbus_func_cb_get(gp_mb_reg_map, COMM_4G_STAT_FUNC);
         break;
 
-    /** ң--ԤԼ  */
+    /** 遥控--预约充电  */
     case RM_CTRL_ORDER_CHARGING_ADDR_OFFSET:
         p_mb_func = modbus_func_cb_get(gp_mb_reg_map, ORDER_CHARGING_FUNC);
         break;
 
     default:
-//        aw_assert(0);  //todo 
+//        aw_assert(0);  //todo 保留区不操作
         break;
     }
 
@@ -478,9 +757,9 @@ aw_local aw_mb_exception_t remote_ctrl_gun_reg_write (uint8_t  *p_buf,
     if (err != AW_OK) {
         exception = AW_MB_EXP_SLAVE_DEVICE_FAILURE;
     } else {
-        modbus_reg_map_lock(gp_mb_reg_map); /* ȡ  */
+        modbus_reg_map_lock(gp_mb_reg_map); /* 读取保护  */
         aw_mb_regcpy(p_regbuf + index, p_buf, num);
-        modbus_reg_map_unlock(gp_mb_reg_map); /* ȡ  */
+        modbus_reg_map_unlock(gp_mb_reg_map); /* 读取保护  */
     }
 
     return exception;
@@ -488,7 +767,7 @@ aw_local aw_mb_exception_t remote_ctrl_gun_reg_write (uint8_t  *p_buf,
 
 /******************************************************************************/
 /**
- * \brief дĴ
+ * \brief 写寄存器
 */
 aw_local aw_mb_exception_t wr_reg_func_callback (aw_mb_slave_t slave,
                                                  uint8_t      *p_buf,
@@ -498,30 +777,53 @@ aw_local aw_mb_exception_t wr_reg_func_callback (aw_mb_slave_t slave,
     aw_mb_exception_t exception = AW_MB_EXP_NONE;
     uint16_t          cur_addr  = addr;
     uint16_t          index     = num;
+    LAT_HIST_DECL(stamp);
 
+    LAT_HIST_BEGIN(stamp);
     while (cur_addr < (addr + index)) {
 
-        /* ʱ */
+        /* 对时 */
         if (cur_addr == RM_ADJ_TIME_REG_ADDR) {
             exception = remote_adj_time_reg_write(p_buf, cur_addr, num);
             cur_addr += RM_ADJ_TIME_REG_NUM;
             num      -= RM_ADJ_TIME_REG_NUM;
 
-        /* ׮ */
+        /* 电价与桩编号 */
         } else if ((cur_addr >= RM_ADJ_PILE_REG_ADDR) &&
                  ((cur_addr + num) <= (RM_ADJ_PILE_REG_ADDR + RM_ADJ_PILE_REG_NUM)) ) {
             exception = remote_adj_pile_reg_write(p_buf, cur_addr, num);
             cur_addr += RM_ADJ_PILE_REG_NUM;
             num      -= RM_ADJ_PILE_REG_NUM;
 
-        /* ûID û  */
+        /* 用户ID 用户余额， 充电电量等 */
         } else if ((cur_addr >= RM_ADJ_USR_REG_ADDR) &&
                   ((cur_addr + num) <= (RM_ADJ_USR_REG_ADDR + RM_ADJ_USR_REG_NUM)) ) {
             exception = remote_adj_usr_reg_write(p_buf, cur_addr, num);
             cur_addr += RM_ADJ_USR_REG_NUM;
             num      -= RM_ADJ_USR_REG_NUM;
 
-        /* ҡ */
+        /* 负荷管理 */
+        } else if ((cur_addr >= RM_ADJ_LOAD_REG_ADDR) &&
+                  ((cur_addr + num) <= (RM_ADJ_LOAD_REG_ADDR + RM_ADJ_LOAD_REG_NUM)) ) {
+            exception = remote_adj_load_reg_write(p_buf, cur_addr, num);
+            cur_addr += RM_ADJ_LOAD_REG_NUM;
+            num      -= RM_ADJ_LOAD_REG_NUM;
+
+        /* 智能充电规划 */
+        } else if ((cur_addr >= RM_ADJ_SCHED_REG_ADDR) &&
+                  ((cur_addr + num) <= (RM_ADJ_SCHED_REG_ADDR + RM_ADJ_SCHED_REG_NUM)) ) {
+            exception = remote_adj_sched_reg_write(p_buf, cur_addr, num);
+            cur_addr += RM_ADJ_SCHED_REG_NUM;
+            num      -= RM_ADJ_SCHED_REG_NUM;
+
+        /* 离线卡名单 */
+        } else if ((cur_addr >= RM_ADJ_CARD_WL_REG_ADDR) &&
+                  ((cur_addr + num) <= (RM_ADJ_CARD_WL_REG_ADDR + RM_ADJ_CARD_WL_REG_NUM)) ) {
+            exception = remote_adj_card_wl_reg_write(p_buf, cur_addr, num);
+            cur_addr += RM_ADJ_CARD_WL_REG_NUM;
+            num      -= RM_ADJ_CARD_WL_REG_NUM;
+
+        /* 摇控 */
         } else if ((cur_addr >= RM_CTRL_REG_ADDR) &&
                 ((cur_addr + num) <= (RM_CTRL_REG_ADDR + RM_CTRL_GUN_REG_NUM)) ) {
             exception = remote_ctrl_gun_reg_write(p_buf, cur_addr, num, 1);
@@ -530,13 +832,15 @@ aw_local aw_mb_exception_t wr_reg_func_callback (aw_mb_slave_t slave,
 
         } else {
             exception = AW_MB_EXP_ILLEGAL_DATA_ADDRESS;
+            break;          /* 地址不在任何区内， 不能再前进 */
         }
     }
+    LAT_HIST_ADD(LAT_HIST_MB, stamp);
     return exception;
 }
 
 /**
- * \brief Ĵ
+ * \brief 读寄存器
 */
 aw_local aw_mb_exception_t rd_reg_func_callback (aw_mb_slave_t slave,
                                                  uint8_t      *p_buf,
@@ -548,9 +852,11 @@ aw_local aw_mb_exception_t rd_reg_func_callback (aw_mb_slave_t slave,
     uint16_t          index     = num;
     uint8_t          *p_cur_buf = p_buf;
     struct mb_func_cb_structure      *p_mb_func  = NULL;
+    LAT_HIST_DECL(stamp);
 
+    LAT_HIST_BEGIN(stamp);
     while (cur_addr < (addr + index)) {
-       /* ʱ */
+       /* 对时 */
        if ((cur_addr >= RM_SIGNAL_REG_ADDR) &&
            ((cur_addr + num) <= (RM_SIGNAL_REG_ADDR + RM_SIGNAL_REG_NUM))) {
            exception = remote_signal_reg_read(p_cur_buf, cur_addr, num);
@@ -586,6 +892,33 @@ aw_local aw_mb_exception_t rd_reg_func_callback (aw_mb_slave_t slave,
            num       -= RM_MEASURE_CHARGING_WDAT_REG_NUM;
            p_cur_buf += ((RM_MEASURE_CHARGING_WDAT_REG_NUM) << 1);
 
+       } else if ((cur_addr >= RM_ADJ_LOAD_REG_ADDR) &&
+               ((cur_addr + num) <= (RM_ADJ_LOAD_REG_ADDR +
+                                    RM_ADJ_LOAD_REG_NUM))) {
+
+           exception = remote_adj_load_reg_read(p_cur_buf, cur_addr, num);
+           cur_addr  += RM_ADJ_LOAD_REG_NUM;
+           num       -= RM_ADJ_LOAD_REG_NUM;
+           p_cur_buf += ((RM_ADJ_LOAD_REG_NUM) << 1);
+
+       } else if ((cur_addr >= RM_ADJ_SCHED_REG_ADDR) &&
+               ((cur_addr + num) <= (RM_ADJ_SCHED_REG_ADDR +
+                                    RM_ADJ_SCHED_REG_NUM))) {
+
+           exception = remote_adj_sched_reg_read(p_cur_buf, cur_addr, num);
+           cur_addr  += RM_ADJ_SCHED_REG_NUM;
+           num       -= RM_ADJ_SCHED_REG_NUM;
+           p_cur_buf += ((RM_ADJ_SCHED_REG_NUM) << 1);
+
+       } else if ((cur_addr >= RM_ADJ_CARD_WL_REG_ADDR) &&
+               ((cur_addr + num) <= (RM_ADJ_CARD_WL_REG_ADDR +
+                                    RM_ADJ_CARD_WL_REG_NUM))) {
+
+           exception = remote_adj_card_wl_reg_read(p_cur_buf, cur_addr, num);
+           cur_addr  += RM_ADJ_CARD_WL_REG_NUM;
+           num       -= RM_ADJ_CARD_WL_REG_NUM;
+           p_cur_buf += ((RM_ADJ_CARD_WL_REG_NUM) << 1);
+
        } else if ((cur_addr >= RM_MEASURE_CHARGING_CARD_REG_ADDR) &&
                ((cur_addr + num) <=
       (RM_MEASURE_CHARGING_CARD_REG_ADDR + RM_MEASURE_CHARGING_CARD_REG_NUM))) {
@@ -595,29 +928,63 @@ aw_local aw_mb_exception_t rd_reg_func_callback (aw_mb_slave_t slave,
            num       -= RM_MEASURE_CHARGING_CARD_REG_NUM;
            p_cur_buf += (RM_MEASURE_CHARGING_CARD_REG_NUM << 1);
 
+#if ACP1000_TASK_PROF && ACP1000_TASK_PROF_MB
+       } else if ((cur_addr >= RM_MEASURE_TASK_PROF_REG_ADDR) &&
+               ((cur_addr + num) <=
+      (RM_MEASURE_TASK_PROF_REG_ADDR + RM_MEASURE_TASK_PROF_REG_NUM))) {
+
+           exception = remote_measure_task_prof_reg_read(p_cur_buf, cur_addr, num);
+           cur_addr  += RM_MEASURE_TASK_PROF_REG_NUM;
+           num       -= RM_MEASURE_TASK_PROF_REG_NUM;
+           p_cur_buf += (RM_MEASURE_TASK_PROF_REG_NUM << 1);
+#endif
+
+#if ACP1000_LAT_HIST && ACP1000_LAT_HIST_MB
+       } else if ((cur_addr >= RM_MEASURE_LAT_HIST_REG_ADDR) &&
+               ((cur_addr + num) <=
+      (RM_MEASURE_LAT_HIST_REG_ADDR + RM_MEASURE_LAT_HIST_REG_NUM))) {
+
+           exception = remote_measure_lat_hist_reg_read(p_cur_buf, cur_addr, num);
+           cur_addr  += RM_MEASURE_LAT_HIST_REG_NUM;
+           num       -= RM_MEASURE_LAT_HIST_REG_NUM;
+           p_cur_buf += (RM_MEASURE_LAT_HIST_REG_NUM << 1);
+#endif
+
+#if ACP1000_BLACKBOX && ACP1000_BLACKBOX_MB
+       } else if ((cur_addr >= RM_MEASURE_BLACKBOX_REG_ADDR) &&
+               ((cur_addr + num) <=
+      (RM_MEASURE_BLACKBOX_REG_ADDR + RM_MEASURE_BLACKBOX_REG_NUM))) {
+
+           exception = remote_measure_blackbox_reg_read(p_cur_buf, cur_addr, num);
+           cur_addr  += RM_MEASURE_BLACKBOX_REG_NUM;
+           num       -= RM_MEASURE_BLACKBOX_REG_NUM;
+           p_cur_buf += (RM_MEASURE_BLACKBOX_REG_NUM << 1);
+#endif
 
        } else {
            exception = AW_MB_EXP_ILLEGAL_DATA_ADDRESS;
+           break;          /* 地址不在任何区内， 不能再前进 */
        }
     }
     if (AW_MB_EXP_NONE == exception) {
         p_mb_func = modbus_func_cb_get(gp_mb_reg_map, HUB4G_COMM_STATE);
         p_mb_func->mb_func_cb(p_mb_func->p_arg, NULL, 0, NULL);
     }
+    LAT_HIST_ADD(LAT_HIST_MB, stamp);
 
     return exception;
 }
 /******************************************************************************/
 /**
- * \brief Modubsվݴ
+ * \brief Modubs从站数据处理任务
 */
 aw_local void __mb_hdl_poll (aw_mb_slave_t slave)
 {
     aw_mb_err_t err;
     AW_FOREVER {
-        /* ӻѯ, ǰΪӿ  */
+        /* 从机轮询操作, 当前设置为阻塞接口  */
         if ((err = aw_mb_slave_poll(slave)) != AW_MB_ERR_NOERR) {
-            AW_INFOF(("Modbus Slave Poll Failed! mb_err = %d\r\n", err));
+            SLOG(SLOG_MOD_MB, SLOG_WARN, "Modbus Slave Poll Failed! mb_err = %d", err);
         }
     }
 }
@@ -638,8 +1005,8 @@ aw_err_t ac_modbus_slave_set_addr (uint8_t addr)
 #include "boot/boot_cfg.h"
 #include "boot/valid_flag/nvram_valid_flag.h"
 
-#define IMG_UPDATE_FUNC_CODE  0x60 /* ʱʹõĹ */
-#define IMG_VERSION_FUNC_CODE 0x61 /* ڰ汾ʱʹõĹ */
+#define IMG_UPDATE_FUNC_CODE  0x60 /* 升级时使用的功能码 */
+#define IMG_VERSION_FUNC_CODE 0x61 /* 后期版本号时使用的功能码 */
 
 aw_err_t  app_into_boot(void)
 {
@@ -665,7 +1032,7 @@ aw_err_t  app_into_boot(void)
 }
 
 /**
- * ʱص
+ * 升级时回调参数
  */
 static struct upgrade_cb_item g_upgrade_cb_item;
 
@@ -688,25 +1055,25 @@ aw_mb_exception_t ac_modbus_update_dat_handle (aw_mb_slave_t slave,
         return AW_ERROR;
     }
 
-    /* жǷϷ */
+    /* 判断数据量是否合法 */
     if (*p_pdulen < 8) {
         mb_exp =  AW_MB_EXP_ILLEGAL_DATA_VALUE;
-        AW_ERRF(("MODBUS_SLAVE_FRAME_LEN err: %d\n", *p_pdulen));
+        SLOG(SLOG_MOD_MB, SLOG_ERR, "MODBUS_SLAVE_FRAME_LEN err: %d", *p_pdulen);
         goto  __boot_modbus_call_end;
     }
 
-    /* ȡ루ǰ֡ĵ0ֽ  */
+    /* 获取功能码（当前帧的第0个字节 ） */
     if (p_pdubuf[0] != IMG_UPDATE_FUNC_CODE) {
         mb_exp =  AW_MB_EXP_ILLEGAL_DATA_VALUE;
-        AW_ERRF(("MODBUS_FUN_CODE err: %02x\n", p_pdubuf[0]));
+        SLOG(SLOG_MOD_MB, SLOG_ERR, "MODBUS_FUN_CODE err: %02x", p_pdubuf[0]);
         goto  __boot_modbus_call_end;
     }
 
-    /* ȡǰ̼ݰַǰ֡ĵ1,2ֽ ģʽ */
+    /* 获取当前固件数据包地址（当前帧的第1,2两个字节 ）大端模式 */
     curr_addr = ((p_pdubuf[1]<<8) | p_pdubuf[2]);
     if (curr_addr != 1024) {
         mb_exp =  AW_MB_EXP_ILLEGAL_DATA_ADDRESS;
-        AW_ERRF(("MODBUS_FUN_CODE err: %02x\n", p_pdubuf[0]));
+        SLOG(SLOG_MOD_MB, SLOG_ERR, "MODBUS_FUN_CODE err: %02x", p_pdubuf[0]);
         goto  __boot_modbus_call_end;
     }
 
@@ -759,7 +1126,7 @@ aw_mb_exception_t ac_modbus_version_dat_handle (aw_mb_slave_t slave,
     return mb_exp;
 }
 /**
- * \brief Modbusվʼ
+ * \brief Modbus从站处理初始化
 */
 int ac_modbus_slave_hdl_init (struct modbus_reg_map *p_mb_reg_map,
                               uint8_t                   slave_addr,
@@ -774,39 +1141,39 @@ int ac_modbus_slave_hdl_init (struct modbus_reg_map *p_mb_reg_map,
     params.port       = com;
     params.slave_addr = slave_addr;
 
-    gp_mb_reg_map = p_mb_reg_map;  /* ModbusĴб  */
+    gp_mb_reg_map = p_mb_reg_map;  /* 保存Modbus寄存器列表  */
 
     gp_slave = aw_mb_slave_init(AW_MB_RTU, &params, NULL);
     if (gp_slave == NULL) {
         AW_INFOF(("Modbus Slave Init Failed!\r\n"));
         return AW_ERROR;
     }
-    /* ǷʹRS485 */
+    /* 设置是否使能RS485 */
 //    aw_serial_ioctl(com, AM_UART_RS485_ENABLE_SET, (void *)(1));
     aw_serial_ioctl(com, AM_UART_RS485_ENABLE_SET, RS485_ENABLE);
 
-    /* Ĵص  */
+    /* 读寄存器回调  */
     (void)aw_mb_slave_register_callback(gp_slave,
                                         AW_MB_FUNC_HOLDREGISTERS_CALLBACK,
                                         AW_MB_FUNC_CALLBACK_READ,
                                         rd_reg_func_callback);
 
-    /* дĴص  */
+    /* 写寄存器回调  */
     (void)aw_mb_slave_register_callback(gp_slave,
                                         AW_MB_FUNC_HOLDREGISTERS_CALLBACK,
                                         AW_MB_FUNC_CALLBACK_WRITE,
                                         wr_reg_func_callback);
 
-    /* ע̼ */
+    /* 注册固件升级命令 */
      aw_mb_slave_register_handler(gp_slave, IMG_UPDATE_FUNC_CODE, ac_modbus_update_dat_handle);
      aw_mb_slave_register_handler(gp_slave, IMG_VERSION_FUNC_CODE, ac_modbus_version_dat_handle);
 
-    /* ʼ*/
+    /* 开始运行*/
     if (aw_mb_slave_start(gp_slave) != AW_MB_ERR_NOERR) {
         return AW_ERROR;
     }
 
-    /* ʼѯ */
+    /* 初始化轮询任务 */
     AW_TASK_INIT(modbus_task,
                  "modbbus_task",
                  3,
@@ -814,7 +1181,7 @@ int ac_modbus_slave_hdl_init (struct modbus_reg_map *p_mb_reg_map,
                  __mb_hdl_poll,
                  (void *)gp_slave);
 
-    /* ѯ  */
+    /* 启动轮询任务  */
     AW_TASK_STARTUP(modbus_task);
 
     return AW_OK;
@@ -1,6 +1,6 @@
 /**
  * \file
- * \brief (׮)ƼƷѵԪ뼯пModbusͨѶЭʵ
+ * \brief (交流桩)控制计费单元与集中控制器Modbus通讯协议实现
  *
  * \internal
  * \par modification history
@@ -13,268 +13,411 @@
 #include "aw_sem.h"
 #include "aw_timer.h"
 
-#define CHARGING_GUN_NUM           1  /**< \brief ǹĿ          */
+#define CHARGING_GUN_NUM           1  /**< \brief 充电枪数目          */
 
-#define GUN1  1  /**< \brief ǹ1          */
-#define GUN2  2  /**< \brief ǹ2          */
+#define GUN1  1  /**< \brief 充电枪1          */
+#define GUN2  2  /**< \brief 充电枪2          */
 
-/** \brief ȡṹModbusĴ          */
+/** \brief 获取结构体的Modbus寄存器数          */
 #define MB_REG_NUM_GET(structure)   (sizeof(structure) / sizeof(uint16_t))
 
-/** \brief ȡĴṹƫƸ          */
+/** \brief 获取寄存器结构体偏移个数          */
 #define MB_REG_OFFSET_GET(structure, mem)  (AW_OFFSET(structure, mem) / sizeof(uint16_t))
 /******************************************************************************
- * ң
+ * 遥信数据
  ******************************************************************************/
-/** \brief ״̬1λ״̬ */
+/** \brief 充电机状态1位状态 */
 struct aw_charger_stat_bit {
-    //todo Ԥˢ
-    uint8_t key_store_ok           : 1;  /**< \brief Կɹ 0ûбɹ1Կɹ ÿˢʱ */
-    uint8_t card_swing_ok2         : 1;  /**< \brief ˢɹ 0ˢɹ1ˢɹ , յȨʱøñ־λ */
-    uint8_t charger_allow_stat     : 1;  /**< \brief Ƿ״̬0磬1*/
-    uint8_t charger_stat           : 1;  /**< \brief ״̬0磬1*/
-    uint8_t screen_lock_stat       : 1;  /**< \brief ״̬0 1*/
-    uint8_t g4_comm_stat           : 1;  /**< \brief 4gͨѶ״̬0 1*/
-    uint8_t pile_order_stat        : 1;  /**< \brief ׮ԤԼ״̬0ԤԼ1ԤԼ*/
-    uint8_t light_pro_alm          : 1;  /**< \brief ϸ澯  */
-
-    uint8_t charger_overtemp_alm   : 1;  /**< \brief ׮¹ϸ澯  */
-    uint8_t flood_alm              : 1;  /**< \brief ˮϸ澯  */
-    uint8_t contactor_fault_alm    : 1;  /**< \brief Ӵϸ澯  */
-    uint8_t door_switch_alm        : 1;  /**< \brief Žظ澯, 0ţ1 */
-    uint8_t ammeter_alm            : 1;  /**< \brief ͨѶ澯  */
-    uint8_t cardreader_alm         : 1;  /**< \brief ˢͨѶ澯  */
-    uint8_t ac_in_undervolt_alm    : 1;  /**< \brief Ƿѹ澯  */
-    uint8_t ac_in_overvolt_alm     : 1;  /**< \brief ѹ澯  */
+    //todo 添加了预刷卡
+    uint8_t key_store_ok           : 1;  /**< \brief 密钥保存成功 ，0没有保存成功，1密钥保存成功 每次刷卡时清零 */
+    uint8_t card_swing_ok2         : 1;  /**< \brief 刷卡成功 ，0刷卡不成功，1刷卡成功 , 收到鉴权结果时置该标志位 */
+    uint8_t charger_allow_stat     : 1;  /**< \brief 是否允许充电状态，0不允许充电，1允许充电*/
+    uint8_t charger_stat           : 1;  /**< \brief 充电状态，0不充电，1充电*/
+    uint8_t screen_lock_stat       : 1;  /**< \brief 锁屏状态，0锁屏。 1不锁屏*/
+    uint8_t g4_comm_stat           : 1;  /**< \brief 4g通讯状态，0正常。 1故障*/
+    uint8_t pile_order_stat        : 1;  /**< \brief 桩预约状态，0无预约，1预约*/
+    uint8_t light_pro_alm          : 1;  /**< \brief 防雷器故障告警  */
+
+    uint8_t charger_overtemp_alm   : 1;  /**< \brief 充电桩过温故障告警  */
+    uint8_t flood_alm              : 1;  /**< \brief 水浸故障告警  */
+    uint8_t contactor_fault_alm    : 1;  /**< \brief 接触器故障告警  */
+    uint8_t door_switch_alm        : 1;  /**< \brief 门禁开关告警, 0关门，1开门 */
+    uint8_t ammeter_alm            : 1;  /**< \brief 电表通讯告警  */
+    uint8_t cardreader_alm         : 1;  /**< \brief 刷卡机通讯告警  */
+    uint8_t ac_in_undervolt_alm    : 1;  /**< \brief 交流输入欠压告警  */
+    uint8_t ac_in_overvolt_alm     : 1;  /**< \brief 交流输入过压告警  */
 };
 
 
 
-/**< \brief ״̬1 */
+/**< \brief 充电机状态1 */
 union aw_charger_stat1 {
-    struct aw_charger_stat_bit stat1_bit;  /**< \brief ״̬1λ״̬ */
-    uint16_t                   stat1;      /**< \brief ״̬1λ״̬ */
+    struct aw_charger_stat_bit stat1_bit;  /**< \brief 充电机状态1位状态 */
+    uint16_t                   stat1;      /**< \brief 充电机状态1位状态 */
 };
 /******************************************************************************/
 struct aw_charging_stop_cause_bit {
-    uint8_t manual_stop              : 1;  /**< \brief ˹ֹ */
-    uint8_t guide_test_fail          : 1;  /**< \brief Բͨ   */
-    uint8_t batvolt_chk_unusal       : 1;  /**< \brief ѹ쳣ֹ   */
-    uint8_t door_switch_alm          : 1;  /**< \brief Ž쳣ֹ   */
-    uint8_t elect_lock_alm           : 1;  /**< \brief 쳣ֹ   */
-    uint8_t gun_contact_alm          : 1;  /**< \brief ǹӴֹ */
-    uint8_t light_pro_unusal_stop    : 1;  /**< \brief 쳣ֹ  */
-    uint8_t measure_per_unusal_stop  : 1;  /**< \brief Ԫ쳣ֹ   */
-
-    uint8_t pos_charge_unusal_stop   : 1;  /**< \brief ˢ쳣ֹ   */
-    uint8_t background_stop          : 1;  /**< \brief ֹ̨   */
-    uint8_t banlance_notenough_stop  : 1;  /**< \brief ֹ   */
-    uint8_t ac_in_undervolt_stop     : 1;  /**< \brief Ƿѹֹ  */
-    uint8_t ac_in_overvolt_stop      : 1;  /**< \brief ѹֹ  */
-    uint8_t ac_in_overcurr_stop      : 1;  /**< \brief ֹ  */
-    uint8_t card_swing_ok1           : 1;  /**< \brief Ԥˢɹ ⵽ƬΪɹ */
-    uint8_t reserved                 : 1;  /**< \brief   */
+    uint8_t manual_stop              : 1;  /**< \brief 充电机人工终止充电 */
+    uint8_t guide_test_fail          : 1;  /**< \brief 充电机引导测试不通过   */
+    uint8_t batvolt_chk_unusal       : 1;  /**< \brief 充电机检测充电电压检测异常终止   */
+    uint8_t door_switch_alm          : 1;  /**< \brief 充电机门禁检测异常终止   */
+    uint8_t elect_lock_alm           : 1;  /**< \brief 电子锁异常终止   */
+    uint8_t gun_contact_alm          : 1;  /**< \brief 枪接触终止 */
+    uint8_t light_pro_unusal_stop    : 1;  /**< \brief 防雷异常终止  */
+    uint8_t measure_per_unusal_stop  : 1;  /**< \brief 计量单元异常终止   */
+
+    uint8_t pos_charge_unusal_stop   : 1;  /**< \brief 充电机刷卡外设异常终止   */
+    uint8_t background_stop          : 1;  /**< \brief 充电机后台终止充电   */
+    uint8_t banlance_notenough_stop  : 1;  /**< \brief 余额不足终止充电   */
+    uint8_t ac_in_undervolt_stop     : 1;  /**< \brief 交流输入欠压终止  */
+    uint8_t ac_in_overvolt_stop      : 1;  /**< \brief 交流输入过压终止  */
+    uint8_t ac_in_overcurr_stop      : 1;  /**< \brief 交流输入过流终止  */
+    uint8_t card_swing_ok1           : 1;  /**< \brief 预刷卡成功 ，检测到卡片置为成功 */
+    uint8_t reserved                 : 1;  /**< \brief 保留  */
 };
 
-/**< \brief ֹͣԭ  */
+/**< \brief 充电停止原因  */
 union aw_charging_stop_cause {
-    struct aw_charging_stop_cause_bit cause_bit;  /**< \brief ֹͣԭλ   */
-    uint16_t                          cause;      /**< \brief ֹͣԭ */
+    struct aw_charging_stop_cause_bit cause_bit;  /**< \brief 充电停止原因位   */
+    uint16_t                          cause;      /**< \brief 充电停止原因 */
 };
 /******************************************************************************/
-/**< \brief ǹ״̬Ϣ   */
+/**< \brief 枪状态信息   */
 struct aw_charging_gun_stat {
-    union aw_charger_stat1       charger_stat1;       /**< \brief ״̬1   */
-    union aw_charging_stop_cause charging_stop_cause; /**< \brief ֹͣԭ   */
+    union aw_charger_stat1       charger_stat1;       /**< \brief 充电机状态1   */
+    union aw_charging_stop_cause charging_stop_cause; /**< \brief 充电停止原因   */
 };
 
-/**< \brief ң   */
+/**< \brief 遥信数据   */
 struct aw_remote_signal_reg {
-   struct aw_charging_gun_stat charger_stat[CHARGING_GUN_NUM];  /**< \brief ǹ״̬Ϣ   */
+   struct aw_charging_gun_stat charger_stat[CHARGING_GUN_NUM];  /**< \brief 枪状态信息   */
 };
 /******************************************************************************/
-#define RM_SIGNAL_REG_ADDR       1   /**< \brief ңŵַ          */
+#define RM_SIGNAL_REG_ADDR       1   /**< \brief 遥信地址          */
 
-/** \brief ңżĴ          */
+/** \brief 遥信寄存器个数          */
 #define RM_SIGNAL_REG_NUM       MB_REG_NUM_GET(struct aw_remote_signal_reg)
 
 #define RM_SIGNAL_REG_END_ADDR  (RM_SIGNAL_REG_ADDR + RM_SIGNAL_REG_NUM)
 /******************************************************************************
- * ң
+ * 遥测数据
  ******************************************************************************/
-/** \brief       */
+/** \brief 整机数据      */
 struct aw_charger_whole_data {
-    uint16_t charger_interface;        /**< \brief ӿڷʽǹ       */
-    uint16_t charger_out_volt;         /**< \brief ѹ       */
-    uint16_t charger_out_curr;         /**< \brief        */
-    uint16_t charger_ambient_temp;     /**< \brief ¶       */
-    uint16_t now_charge_energy;        /**< \brief γ      */
-    uint16_t now_charge_amount;        /**< \brief γ      */
-    uint16_t now_charge_time;          /**< \brief γʱ      */
-    uint16_t auth_fail_reason;         /**< \brief Ȩʧԭ      */
-    uint16_t meter_rtval_hi_word;      /**< \brief ʵʱֽ      */
-    uint16_t meter_rtval_lo_word;      /**< \brief ʵʱֽ      */
+    uint16_t charger_interface;        /**< \brief 充电机接口方式（枪的数量）       */
+    uint16_t charger_out_volt;         /**< \brief 充电机输出电压       */
+    uint16_t charger_out_curr;         /**< \brief 充电机输出电流       */
+    uint16_t charger_ambient_temp;     /**< \brief 充电机环境温度       */
+    uint16_t now_charge_energy;        /**< \brief 本次充电电量      */
+    uint16_t now_charge_amount;        /**< \brief 本次充电金额      */
+    uint16_t now_charge_time;          /**< \brief 本次充电时间      */
+    uint16_t auth_fail_reason;         /**< \brief 鉴权失败原因      */
+    uint16_t meter_rtval_hi_word;      /**< \brief 电表实时读数高字节      */
+    uint16_t meter_rtval_lo_word;      /**< \brief 电表实时读数低字节      */
 };
 
 
-/**< \brief ܿIDϢ   */
+/**< \brief 加密卡ID信息   */
 struct aw_s50_card {
-    uint16_t card_id[2];           /**< \brief ܿIDŸֽ       */
-    uint16_t card_dat[24];         /**< \brief ܿ       */
-//    uint16_t card_id_hi_word;  /**< \brief ܿIDŸֽ       */
-//    uint16_t card_id_lo_word;  /**< \brief ܿIDŵֽ       */
-//todo 4.22޸
-//    uint16_t section0_1_1;     /**< \brief 0-1-1       */
-//    uint16_t section0_1_2;     /**< \brief 0-1-2       */
-//    uint16_t section0_1_3;     /**< \brief 0-1-3       */
-//    uint16_t section0_1_4;     /**< \brief 0-1-4       */
-//    uint16_t section0_1_5;     /**< \brief 0-1-5       */
-//    uint16_t section0_1_6;     /**< \brief 0-1-6       */
-//    uint16_t section0_1_7;     /**< \brief 0-1-7       */
-//    uint16_t section0_1_8;     /**< \brief 0-1-8       */
+    uint16_t card_id[2];           /**< \brief 加密卡ID号高字节       */
+    uint16_t card_dat[24];         /**< \brief 加密卡数据       */
+//    uint16_t card_id_hi_word;  /**< \brief 加密卡ID号高字节       */
+//    uint16_t card_id_lo_word;  /**< \brief 加密卡ID号低字节       */
+//todo 4.22修改
+//    uint16_t section0_1_1;     /**< \brief 扇区0-1-1       */
+//    uint16_t section0_1_2;     /**< \brief 扇区0-1-2       */
+//    uint16_t section0_1_3;     /**< \brief 扇区0-1-3       */
+//    uint16_t section0_1_4;     /**< \brief 扇区0-1-4       */
+//    uint16_t section0_1_5;     /**< \brief 扇区0-1-5       */
+//    uint16_t section0_1_6;     /**< \brief 扇区0-1-6       */
+//    uint16_t section0_1_7;     /**< \brief 扇区0-1-7       */
+//    uint16_t section0_1_8;     /**< \brief 扇区0-1-8       */
 //
-//    uint16_t section0_2_1;     /**< \brief 0-2-1       */
-//    uint16_t section0_2_2;     /**< \brief 0-2-2       */
-//    uint16_t section0_2_3;     /**< \brief 0-2-3       */
-//    uint16_t section0_2_4;     /**< \brief 0-2-4       */
-//    uint16_t section0_2_5;     /**< \brief 0-2-5       */
-//    uint16_t section0_2_6;     /**< \brief 0-2-6       */
-//    uint16_t section0_2_7;     /**< \brief 0-2-7       */
-//    uint16_t section0_2_8;     /**< \brief 0-2-8       */
+//    uint16_t section0_2_1;     /**< \brief 扇区0-2-1       */
+//    uint16_t section0_2_2;     /**< \brief 扇区0-2-2       */
+//    uint16_t section0_2_3;     /**< \brief 扇区0-2-3       */
+//    uint16_t section0_2_4;     /**< \brief 扇区0-2-4       */
+//    uint16_t section0_2_5;     /**< \brief 扇区0-2-5       */
+//    uint16_t section0_2_6;     /**< \brief 扇区0-2-6       */
+//    uint16_t section0_2_7;     /**< \brief 扇区0-2-7       */
+//    uint16_t section0_2_8;     /**< \brief 扇区0-2-8       */
 //
-//    uint16_t section0_3_1;     /**< \brief 0-3-1       */
-//    uint16_t section0_3_2;     /**< \brief 0-3-2       */
-//    uint16_t section0_3_3;     /**< \brief 0-3-3       */
-//    uint16_t section0_3_4;     /**< \brief 0-3-4       */
-//    uint16_t section0_3_5;     /**< \brief 0-3-5       */
-//    uint16_t section0_3_6;     /**< \brief 0-3-6       */
-//    uint16_t section0_3_7;     /**< \brief 0-3-7       */
-//    uint16_t section0_3_8;     /**< \brief 0-3-8       */
+//    uint16_t section0_3_1;     /**< \brief 扇区0-3-1       */
+//    uint16_t section0_3_2;     /**< \brief 扇区0-3-2       */
+//    uint16_t section0_3_3;     /**< \brief 扇区0-3-3       */
+//    uint16_t section0_3_4;     /**< \brief 扇区0-3-4       */
+//    uint16_t section0_3_5;     /**< \brief 扇区0-3-5       */
+//    uint16_t section0_3_6;     /**< \brief 扇区0-3-6       */
+//    uint16_t section0_3_7;     /**< \brief 扇区0-3-7       */
+//    uint16_t section0_3_8;     /**< \brief 扇区0-3-8       */
 };
 
-/**< \brief ʱʱ  */
+/**< \brief 充电机对时时间  */
 struct aw_charger_time {
-    uint16_t  year;          /**< \brief  : 2010~2099  */
+    uint16_t  year;          /**< \brief 年 : 2010~2099  */
 #define CUR_TIME_SET_YEAR_MAX  2099
 #define CUR_TIME_SET_YEAR_MIN  2010
-    uint16_t  month;         /**< \brief  : 1~12  */
-    uint16_t  day;           /**< \brief  : 1~31  */
-    uint16_t  hour;          /**< \brief ʱ : 1~23 */
-    uint16_t  minute;        /**< \brief  : 0~59 */
-    uint16_t  second;        /**< \brief  : 0~59  */
+    uint16_t  month;         /**< \brief 月 : 1~12  */
+    uint16_t  day;           /**< \brief 日 : 1~31  */
+    uint16_t  hour;          /**< \brief 时 : 1~23 */
+    uint16_t  minute;        /**< \brief 分 : 0~59 */
+    uint16_t  second;        /**< \brief 秒 : 0~59  */
 };
 
-/**< \brief ûϢ   */
+/**< \brief 用户信息   */
 struct aw_charging_usr_info {
-    /** \brief ûIDռС  */
-#define RM_ADJ_GUN_USER_ID_NUM   8   //׮ûIDδ޸
-    uint16_t user_id[RM_ADJ_GUN_USER_ID_NUM];    /**< \brief ûID  */
-    uint16_t user_balance[2];        /**< \brief ûID16λ0.01Ԫ */
+    /** \brief 用户ID所占大小  */
+#define RM_ADJ_GUN_USER_ID_NUM   8   //交流桩用户ID未修改
+    uint16_t user_id[RM_ADJ_GUN_USER_ID_NUM];    /**< \brief 用户ID  */
+    uint16_t user_balance[2];        /**< \brief 用户ID余额高16位：0.01元 */
 
 };
 
-/**< \brief    */
+/**< \brief 充电机数据   */
 struct aw_charger_data {
-    struct aw_charger_time        local_time;           /**< brief RTCʱ */
+    struct aw_charger_time        local_time;           /**< brief RTC时间 */
 
-#define RM_ADJ_TIME_INVL_NUM     24    /**< \brief ʱ */
-#define RM_ADJ_ELECT_MAX_PRICE   65535 /**< \brief ۸ֵ    */
-#define RM_ADJ_ELECT_MIN_PRICE   10000 /**< \brief ۸Сֵ    */
-    /** \brief ʱγ۸λΪ0~1㣬 λΪ0.01Ԫ    */
+#define RM_ADJ_TIME_INVL_NUM     24    /**< \brief 时间间隔段数 */
+#define RM_ADJ_ELECT_MAX_PRICE   65535 /**< \brief 电量价格最大值    */
+#define RM_ADJ_ELECT_MIN_PRICE   10000 /**< \brief 电量价格最小值    */
+    /** \brief 时间段充电价格：最低位为0~1点， 单位为0.01元    */
     uint16_t                      time_invl_price[RM_ADJ_TIME_INVL_NUM];
 
-#define RM_ADJ_CHARGER_PILE_ID_NUM   4     /**< \brief ׮ λڵֵַ ˷ʽ   */
+#define RM_ADJ_CHARGER_PILE_ID_NUM   4     /**< \brief 充电桩编号 高位在地址值 大端方式   */
     uint16_t                      pile_id[RM_ADJ_CHARGER_PILE_ID_NUM];
 };
+
+/**< \brief 单个任务的剖析数据  */
+struct aw_task_prof_data {
+    uint16_t name[4];       /**< \brief 任务名前8个字符， 高字节在前  */
+    uint16_t cpu;           /**< \brief 上一统计窗口CPU占用， 单位0.1%  */
+    uint16_t cpu_peak;      /**< \brief 窗口CPU占用峰值， 单位0.1%  */
+    uint16_t run_max;       /**< \brief 单次运行最长时间， 单位us， 超过65535时为65535  */
+    uint16_t stack_total;   /**< \brief 堆栈大小， 单位字节  */
+    uint16_t stack_used;    /**< \brief 堆栈高水位， 单位字节  */
+    uint16_t reserved;      /**< \brief 保留  */
+};
+
+/**< \brief 任务剖析信息（只读， 每秒更新）  */
+struct aw_remote_measure_task_prof {
+#define RM_MEASURE_TASK_PROF_NUMS   12  /**< \brief 上送的任务数  */
+    uint16_t                  task_nums;  /**< \brief 有效任务数  */
+    uint16_t                  cpu;        /**< \brief 被统计任务CPU占用之和， 单位0.1%  */
+    struct aw_task_prof_data  task[RM_MEASURE_TASK_PROF_NUMS];
+};
+
+/**< \brief 单条路径的延迟直方图  */
+struct aw_lat_hist_data {
+#define RM_MEASURE_LAT_HIST_BUCKETS 20  /**< \brief 桶数  */
+    uint16_t cnt[2];        /**< \brief 次数， 高位在前  */
+    uint16_t max_us[2];     /**< \brief 最大延迟， 单位us， 高位在前  */
+    /** \brief 桶0为0~7us， 桶k为2^(k+2)~2^(k+3)-1us， 最后一桶无上限， 超过65535时为65535  */
+    uint16_t bucket[RM_MEASURE_LAT_HIST_BUCKETS];
+};
+
+/**< \brief 关键路径延迟直方图（只读， 每秒更新）  */
+struct aw_remote_measure_lat_hist {
+#define RM_MEASURE_LAT_HIST_PATHS   5   /**< \brief 路径数： CP、 急停、 刷卡、 Modbus、 计费上送  */
+    struct aw_lat_hist_data   path[RM_MEASURE_LAT_HIST_PATHS];
+};
+
+/**< \brief 黑匣子记录中的事件  */
+struct aw_blackbox_evt {
+    uint16_t event;         /**< \brief 事件号  */
+    uint16_t age_ms;        /**< \brief 距记录时刻， 单位ms， 超过65535时为65535  */
+};
+
+/**< \brief 黑匣子最新记录（只读， 上电保存记录后及擦除后更新）  */
+struct aw_remote_measure_blackbox {
+#define RM_MEASURE_BLACKBOX_EVTS    16  /**< \brief 事件数  */
+    uint16_t rec_nums;      /**< \brief Flash中的记录数， 为0时以下无效  */
+    uint16_t seq[2];        /**< \brief 记录序号， 高位在前  */
+    uint16_t cause;         /**< \brief 1： 硬件异常  2： 任务心跳超时  3： 其它热复位  */
+    uint16_t reset_src;     /**< \brief 复位源（RSID）  */
+    uint16_t uptime_s[2];   /**< \brief 运行时间， 单位s， 高位在前  */
+    uint16_t task[8];       /**< \brief 任务名， 高字节在前  */
+    uint16_t pc[2];         /**< \brief 以下寄存器均为高位在前  */
+    uint16_t lr[2];
+    uint16_t cfsr[2];
+    uint16_t hfsr[2];
+    uint16_t fault_addr[2]; /**< \brief CFSR中地址有效时为MMFAR或BFAR  */
+    uint16_t role;          /**< \brief 高字节充电控制角色， 低字节计费角色， 0xFF为无  */
+    uint16_t meter_vol;     /**< \brief 电压， 单位0.1V  */
+    uint16_t meter_curr[2]; /**< \brief 电流， 单位0.001A  */
+    uint16_t meter_energy[2]; /**< \brief 电量， 单位0.01度  */
+    uint16_t evt_nums;      /**< \brief 有效事件数， 由旧到新  */
+    struct aw_blackbox_evt    evt[RM_MEASURE_BLACKBOX_EVTS];
+};
 /******************************************************************************/
-/**< \brief ңĴ   */
+/**< \brief 遥测寄存器   */
 struct aw_remote_measure_reg {
-    struct aw_charger_data        charger_data;          /**< \brief    */
-    struct aw_charging_usr_info   usr_info;              /**< \brief ûϢ      */
-    struct aw_charger_whole_data  charger_wdata;         /**< \brief        */
-    struct aw_s50_card            s50_card;              /**< \brief ܿIDϢ   */
+    struct aw_charger_data        charger_data;          /**< \brief 充电机数据   */
+    struct aw_charging_usr_info   usr_info;              /**< \brief 用户信息      */
+    struct aw_charger_whole_data  charger_wdata;         /**< \brief 整机数据       */
+    struct aw_s50_card            s50_card;              /**< \brief 加密卡ID信息   */
+    struct aw_remote_measure_task_prof task_prof;        /**< \brief 任务剖析信息   */
+    struct aw_remote_measure_lat_hist  lat_hist;         /**< \brief 延迟直方图   */
+    struct aw_remote_measure_blackbox  blackbox;         /**< \brief 黑匣子   */
 };
 /******************************************************************************
- * ңĴַĿ
+ * 遥测寄存器地址、数目
  ******************************************************************************/
-/** \brief ң---ϢĴַֻѹ¶ȣ */
+/** \brief 遥测---充电信息寄存器地址（只包含输出电压、电流、环境温度） */
 #define RM_MEASURE_CHARGING_DAT_REG_ADDR   100
-/** \brief ң---ϢĴֻѹ¶ȣ */
+/** \brief 遥测---充电信息寄存器数（只包含输出电压、电流、环境温度） */
 #define RM_MEASURE_CHARGING_DAT_REG_NUM    MB_REG_NUM_GET(struct aw_charger_data)
 
-/** \brief ң---ϢĴַֻѹ¶ȣ */
+/** \brief 遥测---充电信息寄存器地址（只包含输出电压、电流、环境温度） */
 #define RM_MEASURE_CHARGING_USR_REG_ADDR   180
-/** \brief ң---ϢĴֻѹ¶ȣ */
+/** \brief 遥测---充电信息寄存器数（只包含输出电压、电流、环境温度） */
 #define RM_MEASURE_CHARGING_USR_REG_NUM    MB_REG_NUM_GET(struct aw_charging_usr_info)
 
-/** \brief ң---ϢĴַֻѹ¶ȣ */
+/** \brief 遥测---充电信息寄存器地址（只包含输出电压、电流、环境温度） */
 #define RM_MEASURE_CHARGING_WDAT_REG_ADDR   200
-/** \brief ң---ϢĴֻѹ¶ȣ */
+/** \brief 遥测---充电信息寄存器数（只包含输出电压、电流、环境温度） */
 #define RM_MEASURE_CHARGING_WDAT_REG_NUM    MB_REG_NUM_GET(struct aw_charger_whole_data)
 
-/** \brief ң---ϢĴַֻѹ¶ȣ */
+/** \brief 遥测---充电信息寄存器地址（只包含输出电压、电流、环境温度） */
 #define RM_MEASURE_CHARGING_CARD_REG_ADDR   2000
-/** \brief ң---ϢĴֻѹ¶ȣ */
+/** \brief 遥测---充电信息寄存器数（只包含输出电压、电流、环境温度） */
 #define RM_MEASURE_CHARGING_CARD_REG_NUM    MB_REG_NUM_GET(struct aw_s50_card)
 
+/** \brief 遥测---任务剖析寄存器地址 */
+#define RM_MEASURE_TASK_PROF_REG_ADDR       2100
+/** \brief 遥测---任务剖析寄存器数 */
+#define RM_MEASURE_TASK_PROF_REG_NUM        MB_REG_NUM_GET(struct aw_remote_measure_task_prof)
+
+/** \brief 遥测---延迟直方图寄存器地址 */
+#define RM_MEASURE_LAT_HIST_REG_ADDR        2300
+/** \brief 遥测---延迟直方图寄存器数 */
+#define RM_MEASURE_LAT_HIST_REG_NUM         MB_REG_NUM_GET(struct aw_remote_measure_lat_hist)
+
+/** \brief 遥测---黑匣子寄存器地址 */
+#define RM_MEASURE_BLACKBOX_REG_ADDR        2500
+/** \brief 遥测---黑匣子寄存器数 */
+#define RM_MEASURE_BLACKBOX_REG_NUM         MB_REG_NUM_GET(struct aw_remote_measure_blackbox)
+
 /******************************************************************************
- * ң
+ * 遥调数据
  ******************************************************************************/
-/** \brief ׮   */
+/** \brief 整桩数据   */
 struct aw_remote_adjust_pile_data {
-    /** \brief ʱγ۸λΪ0~1㣬 λΪ0.01Ԫ    */
+    /** \brief 时间段充电价格：最低位为0~1点， 单位为0.01元    */
     uint16_t                time_invl_price[RM_ADJ_TIME_INVL_NUM];
 
-#define RM_ADJ_CHARGER_PILE_ID_NUM   4     /**< \brief ׮IDĴ   */
+#define RM_ADJ_CHARGER_PILE_ID_NUM   4     /**< \brief 桩ID寄存器书数   */
     uint16_t                           pile_id[RM_ADJ_CHARGER_PILE_ID_NUM];
 } ;
-/**< \brief ңĴҵϢ  */
+/**< \brief 遥调寄存器业务控制信息  */
 struct aw_remote_adjust_usr_ctrl {
-    uint16_t                           charger_interface;   /**< \brief ӿڷʽǹ       */
+    uint16_t                           charger_interface;   /**< \brief 充电机接口方式（枪的数量）       */
 
-    struct aw_charging_usr_info        usr_info;            /**< \brief ûϢ      */
+    struct aw_charging_usr_info        usr_info;            /**< \brief 用户信息      */
 
-    uint16_t                           now_charge_amount;   /**< \brief γ      */
-    uint16_t                           now_charge_energy;   /**< \brief γ      */
+    uint16_t                           now_charge_amount;   /**< \brief 本次充电金额      */
+    uint16_t                           now_charge_energy;   /**< \brief 本次充电电量      */
 
 #define RM_ADJ_GUN_CARD_SECRET_KEY_NUM   3
-    /**< \brief ԿλΪֽ  */
+    /**< \brief 卡密钥，低位为高字节  */
     uint16_t                           card_secret_key[RM_ADJ_GUN_CARD_SECRET_KEY_NUM];
-    uint16_t                           auth_fail_reason;      /**< \brief Ȩʧԭ   */
-    uint16_t                           reserved[6];           /**< \brief     */
+    uint16_t                           auth_fail_reason;      /**< \brief 鉴权失败原因   */
+    uint16_t                           reserved[6];           /**< \brief 保留    */
+};
+
+/**< \brief 遥调寄存器负荷管理信息  */
+struct aw_remote_adjust_load_ctrl {
+    uint16_t                           load_enable;   /**< \brief 负荷管理， 退出：0x0055, 进入：0x00AA  */
+    uint16_t                           curr_limit;    /**< \brief 集中器分配的充电电流， 单位0.01A  */
+    uint16_t                           ramp_rate;     /**< \brief 电流上升速率， 单位0.01A/s， 0为不限制  */
+    uint16_t                           min_curr;      /**< \brief 最小充电电流， 单位0.01A  */
+    uint16_t                           failsafe_curr; /**< \brief 失联后的安全电流， 单位0.01A  */
+    uint16_t                           now_curr;      /**< \brief 当前CP下发的电流（只读）， 单位0.01A  */
+    uint16_t                           reserved[2];   /**< \brief 保留    */
 };
 
-/**< \brief ңĴ   */
+/**< \brief 遥调寄存器智能充电规划信息  */
+struct aw_remote_adjust_sched_ctrl {
+    uint16_t                           sched_enable;  /**< \brief 智能充电规划， 取消：0x0055, 启用：0x00AA  */
+    uint16_t                           energy;        /**< \brief 目标充电量， 单位0.01kWh  */
+    uint16_t                           depart_hour;   /**< \brief 离开时间 时 0 - 23  */
+    uint16_t                           depart_min;    /**< \brief 离开时间 分 0 - 59  */
+    uint16_t                           state;         /**< \brief 规划状态（只读）， 0未启用 1等待低价时段 2按规划充电 3已达到目标 4全速充电  */
+    uint16_t                           start_delay;   /**< \brief 距离开始充电的分钟数（只读）  */
+    uint16_t                           plan_curr;     /**< \brief 当前时段规划电流（只读）， 单位0.01A  */
+    uint16_t                           plan_cost;     /**< \brief 预计电费（只读）， 单位0.01元  */
+};
+
+/**< \brief 遥调寄存器离线卡名单信息  */
+struct aw_remote_adjust_card_wl {
+    uint16_t                           wl_cmd;        /**< \brief 名单操作， 增加：0x00AA, 撤销：0x0055, 清空：0x00CC  */
+    uint16_t                           card_id[2];    /**< \brief 卡ID， 格式同刷卡卡号  */
+    uint16_t                           version[2];    /**< \brief 操作后的名单版本号， 高字在前  */
+    uint16_t                           wl_version[2]; /**< \brief 当前名单版本号（只读）， 高字在前  */
+    uint16_t                           wl_nums;       /**< \brief 名单中允许充电的卡数（只读）  */
+};
+
+#define RM_CARD_WL_CMD_ADD      0x00AA  /**< \brief 名单增加卡  */
+#define RM_CARD_WL_CMD_DEL      0x0055  /**< \brief 名单撤销卡  */
+#define RM_CARD_WL_CMD_CLR      0x00CC  /**< \brief 清空名单  */
+
+/**< \brief 遥调寄存器   */
 struct aw_remote_adjust_reg {
-    /**< \brief ʱʱ    */
+    /**< \brief 对时时间    */
     struct aw_charger_time             time;
-    /** \brief ׮   */
+    /** \brief 整桩数据   */
     struct aw_remote_adjust_pile_data  pile_data;
-    /** \brief ûϢ   */
+    /** \brief 用户控制信息   */
     struct aw_remote_adjust_usr_ctrl   usr_ctrl;
+    /** \brief 负荷管理信息   */
+    struct aw_remote_adjust_load_ctrl  load_ctrl;
+    /** \brief 智能充电规划信息   */
+    struct aw_remote_adjust_sched_ctrl sched_ctrl;
+    /** \brief 离线卡名单信息   */
+    struct aw_remote_adjust_card_wl    card_wl;
 };
 /******************************************************************************
- * ң---ĴַĿ
+ * 遥调---寄存器地址、数目
  ******************************************************************************/
-#define RM_ADJ_TIME_REG_ADDR      1000    /**< \brief ңʱַ   */
-/** \brief ңʱĴ   */
+#define RM_ADJ_TIME_REG_ADDR      1000    /**< \brief 遥调时间基地址   */
+/** \brief 遥调时间寄存器数   */
 #define RM_ADJ_TIME_REG_NUM       MB_REG_NUM_GET(struct aw_charger_time)
 
-#define RM_ADJ_PILE_REG_ADDR      1006    /**< \brief ң׮ַ   */
-/** \brief ң׮Ĵ   */
+#define RM_ADJ_PILE_REG_ADDR      1006    /**< \brief 遥调整桩基地址   */
+/** \brief 遥调整桩寄存器数   */
 #define RM_ADJ_PILE_REG_NUM       MB_REG_NUM_GET(struct aw_remote_adjust_pile_data)
 
-/** \brief ûĴ   */
+/** \brief 用户寄存器机制   */
 #define RM_ADJ_USR_REG_ADDR       1100
-/** \brief ңûĴ   */
+/** \brief 遥调用户寄存器数   */
 #define RM_ADJ_USR_REG_NUM        MB_REG_NUM_GET(struct aw_remote_adjust_usr_ctrl)
 
-/** \brief ʱĴ   */
+/** \brief 负荷管理寄存器基地址   */
+#define RM_ADJ_LOAD_REG_ADDR      1200
+/** \brief 遥调负荷管理寄存器数   */
+#define RM_ADJ_LOAD_REG_NUM       MB_REG_NUM_GET(struct aw_remote_adjust_load_ctrl)
+/** \brief 集中器可写的负荷管理寄存器数（当前电流及保留区只读）   */
+#define RM_ADJ_LOAD_WR_NUM        MB_REG_OFFSET_GET(struct aw_remote_adjust_load_ctrl, now_curr)
+
+/** \brief 智能充电规划寄存器基地址   */
+#define RM_ADJ_SCHED_REG_ADDR     1210
+/** \brief 遥调智能充电规划寄存器数   */
+#define RM_ADJ_SCHED_REG_NUM      MB_REG_NUM_GET(struct aw_remote_adjust_sched_ctrl)
+/** \brief 可写的智能充电规划寄存器数（规划结果只读）   */
+#define RM_ADJ_SCHED_WR_NUM       MB_REG_OFFSET_GET(struct aw_remote_adjust_sched_ctrl, state)
+
+/** \brief 离线卡名单寄存器基地址   */
+#define RM_ADJ_CARD_WL_REG_ADDR   1220
+/** \brief 遥调离线卡名单寄存器数   */
+#define RM_ADJ_CARD_WL_REG_NUM    MB_REG_NUM_GET(struct aw_remote_adjust_card_wl)
+/** \brief 可写的离线卡名单寄存器数（须一次写入）   */
+#define RM_ADJ_CARD_WL_WR_NUM     MB_REG_OFFSET_GET(struct aw_remote_adjust_card_wl, wl_version)
+
+/** \brief 时间寄存器机制   */
 #define RM_ADJ_ELECT_PRICE_INVL_REG_ADDR   (RM_ADJ_TIME_REG_ADDR + RM_ADJ_TIME_REG_NUM)
-/** \brief ʱγ۸Ĵ   */
-#define RM_ADJ_ELECT_PRICE_INVL_REG_NUM    RM_ADJ_TIME_INVL_NUM    /**< \brief ң۸ʱ   */
+/** \brief 时间段充电价格寄存器数   */
+#define RM_ADJ_ELECT_PRICE_INVL_REG_NUM    RM_ADJ_TIME_INVL_NUM    /**< \brief 遥调电量价格时段数   */
 
-/* ʱĴƫ */
+/* 时间寄存器偏移 */
 #define RM_ADJ_TIME_YEAR_REG_OFFSET   0
 #define RM_ADJ_TIME_MONTH_REG_OFFSET  1
 #define RM_ADJ_TIME_DAY_REG_OFFSET    2
@@ -308,73 +451,76 @@ struct aw_remote_adjust_reg {
 #define RM_ADJ_PILE_ID_NUM            4
 
 /******************************************************************************
- * ң
+ * 遥控数据
  ******************************************************************************/
-/**< \brief ǹ  */
+/**< \brief 枪控制数据  */
 struct aw_charg_gun_ctrl_data {
-    uint16_t allow_charging;        /**< \brief 磬ֹ磺0x0055, 磺 0x00AA   */
-    uint16_t charging_startup;      /**< \brief , ֹͣ0x0055,  0x00AA  */
-    uint16_t unlock_screen;         /**< \brief Ļ  0x0055,  0x00AA   */
-    uint16_t comm_4g_stat;          /**< \brief 4GͨѶ״̬, ͨѶ쳣 0x0055, ͨѶ0x00AA    */
-    uint16_t order_charging;        /**< \brief ԤԼ, ԤԼ 0x0055, ԤԼ0x00AA */
-    uint16_t reserved[6];           /**< \brief   */
+    uint16_t allow_charging;        /**< \brief 允许充电，禁止充电：0x0055, 允许充电： 0x00AA   */
+    uint16_t charging_startup;      /**< \brief 启动充电, 停止：0x0055, 启动： 0x00AA  */
+    uint16_t unlock_screen;         /**< \brief 解锁屏幕， 锁屏： 0x0055, 解锁： 0x00AA   */
+    uint16_t comm_4g_stat;          /**< \brief 4G通讯状态, 通讯异常： 0x0055, 通讯正常：0x00AA    */
+    uint16_t order_charging;        /**< \brief 预约充电, 无预约： 0x0055, 有预约：0x00AA */
+    uint16_t reserved[6];           /**< \brief 保留  */
 };
 
-/**< \brief ңϢ   */
+/**< \brief 遥控信息   */
 struct aw_remote_ctrl_reg {
-    struct aw_charg_gun_ctrl_data gun_ctrl_data[CHARGING_GUN_NUM];  /**< \brief ǹϢ    */
+    struct aw_charg_gun_ctrl_data gun_ctrl_data[CHARGING_GUN_NUM];  /**< \brief 枪控制信息    */
 };
 /******************************************************************************/
-#define RM_CTRL_REG_ADDR        1500                    /**< \brief ңؼĴַ   */
-#define RM_CTRL_GUN1_REG_ADDR   RM_CTRL_REG_ADDR        /**< \brief ңؼĴǹ1ַ   */
+#define RM_CTRL_REG_ADDR        1500                    /**< \brief 遥控寄存器基地址   */
+#define RM_CTRL_GUN1_REG_ADDR   RM_CTRL_REG_ADDR        /**< \brief 遥控寄存器枪1地址   */
 
 #define RM_CTRL_GUN_REG_NUM     MB_REG_NUM_GET(struct aw_charg_gun_ctrl_data)
 
-#define RM_CTRL_ALLOW_CHARGING_ADDR_OFFSET     0   /**< \brief ң--Ƶַƫ   */
-#define RM_CTRL_CHARGING_STARTUP_ADDR_OFFSET   1   /**< \brief ң--ַƫ   */
-#define RM_CTRL_UNLOCK_SCREEN_ADDR_OFFSET      2   /**< \brief ң--Ļַƫ   */
-#define RM_CTRL_COMM_4G_STAT_ADDR_OFFSET       3   /**< \brief ң--4GͨѶ״ַ̬ƫ   */
-#define RM_CTRL_ORDER_CHARGING_ADDR_OFFSET     4   /**< \brief ң--ԤԼַƫ   */
+#define RM_CTRL_ALLOW_CHARGING_ADDR_OFFSET     0   /**< \brief 遥控--允许充电控制地址偏移   */
+#define RM_CTRL_CHARGING_STARTUP_ADDR_OFFSET   1   /**< \brief 遥控--启动充电地址偏移   */
+#define RM_CTRL_UNLOCK_SCREEN_ADDR_OFFSET      2   /**< \brief 遥控--解锁屏幕地址偏移   */
+#define RM_CTRL_COMM_4G_STAT_ADDR_OFFSET       3   /**< \brief 遥控--4G通讯状态地址偏移   */
+#define RM_CTRL_ORDER_CHARGING_ADDR_OFFSET     4   /**< \brief 遥控--预约充电地址偏移   */
 
-#define RM_CTRL_DATA_VAL_SET     0x00AA  /**< \brief ң--ֵ  */
-#define RM_CTRL_DATA_VAL_RESET   0x0055  /**< \brief ң--λֵ   */
+#define RM_CTRL_DATA_VAL_SET     0x00AA  /**< \brief 遥控--设置值  */
+#define RM_CTRL_DATA_VAL_RESET   0x0055  /**< \brief 遥控--复位值   */
 /******************************************************************************
- * Modbus ĴϢ
+ * Modbus 寄存器表信息
  ******************************************************************************/
-/** \brief modbusĴص   */
+/** \brief modbus寄存器回调类型   */
 enum mb_func_cb_type {
-    TIME_SET_FUNC         = 0,  /**< \brief ʱûصصдΪaw_charger_time   */
-    ALLOW_CHARGING_FUNC   = 1,  /**< \brief 磬дΪ0x00550x00aa   */
-    CHARGING_STARTUP_FUNC = 2,  /**< \brief  ,дΪ0x00550x00aa */
-    UNLOCK_SCREEN_FUNC    = 3,  /**< \brief Ļ,дΪ0x00550x00aa   */
-    COMM_4G_STAT_FUNC     = 4,  /**< \brief 4GͨѶ쳣 дΪ0x00550x00aa  */
-    ORDER_CHARGING_FUNC   = 5,  /**< \brief ԤԼ  дΪ0x00550x00aa  */
-    CARD_KEY_LOAD_FUNC    = 6,  /**< \brief key·¼  */
-    USR_ID_SAVE_FUNC      = 7,  /**< \brief ûID·¼  */
-    USR_ID_BALANCE_FUNC   = 8,  /**< \brief û·¼  */
-    CHARGE_INTERFACE_FUNC = 9,  /**< \brief ӿڱ־  */
-    CHARGE_PRICE_FUNC     = 10, /**< \brief ң  */
-    PILE_ID_FUNC          = 11, /**< \brief ׮ID  */
-    CHARGE_ENERGY_FUNC    = 12, /**< \brief   û */
-    HUB4G_COMM_STATE      = 13, /**< \brief ͨص  */
-    AUTH_FAILE_REASON     = 14, /**< \brief Ȩʧԭص */
-    MAX_FUNC_NUM          = 15  /**< \brief ЧͣӦø   */
+    TIME_SET_FUNC         = 0,  /**< \brief 时间设置回调，回调函数中写入类型为aw_charger_time   */
+    ALLOW_CHARGING_FUNC   = 1,  /**< \brief 允许充电，写入为0x0055或0x00aa   */
+    CHARGING_STARTUP_FUNC = 2,  /**< \brief 启动充电 ,写入为0x0055或0x00aa */
+    UNLOCK_SCREEN_FUNC    = 3,  /**< \brief 解锁屏幕,写入为0x0055或0x00aa   */
+    COMM_4G_STAT_FUNC     = 4,  /**< \brief 4G通讯异常 ，写入为0x0055或0x00aa  */
+    ORDER_CHARGING_FUNC   = 5,  /**< \brief 预约充电  ，写入为0x0055或0x00aa  */
+    CARD_KEY_LOAD_FUNC    = 6,  /**< \brief 卡key下发事件  */
+    USR_ID_SAVE_FUNC      = 7,  /**< \brief 用户ID下发事件  */
+    USR_ID_BALANCE_FUNC   = 8,  /**< \brief 用户余额下发事件  */
+    CHARGE_INTERFACE_FUNC = 9,  /**< \brief 充电接口标志  */
+    CHARGE_PRICE_FUNC     = 10, /**< \brief 电价遥调  */
+    PILE_ID_FUNC          = 11, /**< \brief 桩ID  */
+    CHARGE_ENERGY_FUNC    = 12, /**< \brief 充电电量接收  用户结算 */
+    HUB4G_COMM_STATE      = 13, /**< \brief 集中器通信正常回调  */
+    AUTH_FAILE_REASON     = 14, /**< \brief 鉴权失败原因回调 */
+    LOAD_CTRL_FUNC        = 15, /**< \brief 负荷管理遥调，回调p_reg为aw_remote_adjust_load_ctrl */
+    SCHED_CTRL_FUNC       = 16, /**< \brief 智能充电规划遥调，回调p_reg为aw_remote_adjust_sched_ctrl */
+    CARD_WL_FUNC          = 17, /**< \brief 离线卡名单遥调，回调p_reg为aw_remote_adjust_card_wl */
+    MAX_FUNC_NUM          = 18  /**< \brief 无效类型，不应该设置该类型   */
 };
 
 /**
- * \brief ModbusĴ
+ * \brief Modbus寄存器表
  *
- * \param[in] *p_arg  : ûԶ
- * \param[in] *p_reg  : Ĵ,ΪNULLҪû
- * \param[in] gun_num : ǹ, 1Ϊǹ1,2Ϊǹ2
- * \param[in] *val    : дĴֵ
+ * \param[in] *p_arg  : 用户自定义参数
+ * \param[in] *p_reg  : 待操作寄存器,可为NULL，即不需要用户更新
+ * \param[in] gun_num : 充电枪编号, 1为枪1,2为枪2
+ * \param[in] *val    : 写入寄存器值
  *
- * \retval AW_OK    : óɹ
- * \retval AW_ERROR : ʧ
+ * \retval AW_OK    : 设置成功
+ * \retval AW_ERROR : 设置失败
  */
 typedef int (*mb_func_cb_t) (void *p_arg, void *p_reg, uint8_t gun_num, void *val);
 
-/** \brief modbusĴ»ص   */
+/** \brief modbus寄存器更新回调   */
 struct mb_func_cb_structure {
     enum mb_func_cb_type fun_type;
     mb_func_cb_t         mb_func_cb;
@@ -383,37 +529,37 @@ struct mb_func_cb_structure {
 
 
 /**
- * \brief յʱĻص
+ * \brief 收到升级命令时发生的回调函数
  *
- * \param[in] *p_arg  : ûԶ
+ * \param[in] *p_arg  : 用户自定义参数
  */
 typedef int (*pfunc_upgrade_cb_t) (void *p_arg);
 
-/** \brief ʱص   */
+/** \brief 升级时回调   */
 struct upgrade_cb_item {
     pfunc_upgrade_cb_t    pfunc_cb;
     void                 *p_arg;
 };
 
-/** \brief ModbusĴ    */
+/** \brief Modbus寄存器表    */
 struct modbus_reg_map {
-    struct aw_remote_signal_reg  rm_signal_reg;  /**< \brief ңżĴ    */
-    struct aw_remote_measure_reg rm_measure_reg; /**< \brief ңĴ    */
-    struct aw_remote_adjust_reg  rm_adjust_reg;  /**< \brief ңĴ    */
-    struct aw_remote_ctrl_reg    rm_ctrl_reg;    /**< \brief ңؼĴ   */
+    struct aw_remote_signal_reg  rm_signal_reg;  /**< \brief 遥信寄存器    */
+    struct aw_remote_measure_reg rm_measure_reg; /**< \brief 遥测寄存器    */
+    struct aw_remote_adjust_reg  rm_adjust_reg;  /**< \brief 遥调寄存器    */
+    struct aw_remote_ctrl_reg    rm_ctrl_reg;    /**< \brief 遥控寄存器   */
 
-    struct mb_func_cb_structure  mb_func_cb[MAX_FUNC_NUM]; /**< \brief ص   */
+    struct mb_func_cb_structure  mb_func_cb[MAX_FUNC_NUM]; /**< \brief 回调函数表   */
 
-    AW_MUTEX_DECL(lock);                         /**< \brief дĴ  */
+    AW_MUTEX_DECL(lock);                         /**< \brief 读写寄存器保护锁  */
 
-//todo Modbusվʼ⣬һʱûλ.
+//todo Modbus主站访问监测，在一定时间内没访问则引起复位或其他操作.
 //    aw_timer_t     monitor_timer;
 //    aw_pfuncvoid_t monitor_func_cb;
 //    void          *p_arg;
 };
 
 
-/** \brief ׮ModbusĴʼ  */
+/** \brief 充电桩Modbus寄存器表初始化  */
 aw_static_inline void modbus_reg_map_init(struct modbus_reg_map *p_this)
 {
     uint8_t i = 0;
@@ -424,38 +570,38 @@ aw_static_inline void modbus_reg_map_init(struct modbus_reg_map *p_this)
     }
 }
 
-/** \brief Modbusд  */
+/** \brief Modbus读写操作上锁  */
 aw_static_inline void modbus_reg_map_lock(struct modbus_reg_map *p_this)
 {
     AW_MUTEX_LOCK(p_this->lock, AW_SEM_WAIT_FOREVER);
 }
 
-/** \brief Modbusд  */
+/** \brief Modbus读写操作解锁  */
 aw_static_inline void modbus_reg_map_unlock(struct modbus_reg_map *p_this)
 {
     AW_MUTEX_UNLOCK(p_this->lock);
 }
 
-/** \brief עһmodbusĴûص */
+/** \brief 注册一个modbus寄存器设置回调 */
 int modbus_func_cb_register (struct modbus_reg_map *p_this,
                              enum mb_func_cb_type   type,
                              mb_func_cb_t           func_cb,
                              void                  *p_arg);
 
-/** \brief ȡһmodbusĴصṹ  */
+/** \brief 获取一个modbus寄存器回调结构  */
 struct mb_func_cb_structure *modbus_func_cb_get (struct modbus_reg_map *p_this,
                                                  enum mb_func_cb_type   type);
 
 /**
- *  \brief Modbus վʼӿ
+ *  \brief Modbus 从站处理初始化接口
  *
- *  \param[in] p_mb_reg_map : ModbusĴָ
- *  \param[in] com          : Modbusʹôں
- *  \param[in] baudrate     : 
- *  \param[in] parity       : У飺 0У飬 1У飬 2żУ
+ *  \param[in] p_mb_reg_map : Modbus寄存器表指针
+ *  \param[in] com          : Modbus使用串口号
+ *  \param[in] baudrate     : 波特率
+ *  \param[in] parity       : 校验： 0无校验， 1奇校验， 2偶校验
  *
- *  \retval AW_OK    : ʼɹ
- *  \retval AW_ERROR : ʧ
+ *  \retval AW_OK    : 初始化成功
+ *  \retval AW_ERROR : 失败
  *
  **/
 int modbus_slave_hdl_init (struct modbus_reg_map *p_mb_reg_map,
@@ -471,7 +617,7 @@ int ac_modbus_slave_hdl_init (struct modbus_reg_map *p_mb_reg_map,
                               uint8_t                   parity);
 
 /**
- * ôӻַ
+ * 设置从机地址
  */
 aw_err_t ac_modbus_slave_set_addr (uint8_t addr);
 
@@ -13,11 +13,13 @@
 
 /**
  * \file
- * \brief DGUSModbusͨЭݴ
+ * \brief 控制器与DGUS串口屏Modbus通信协议数据处理
  *
  * \internal
  * \par modification history:
  * - 1.00 16-04-26  lnk, first implementation
+ * - 1.01 16-10-03  xjc, 读数据区变化跟踪， 读寄存器直接拷贝大端镜像
+ * - 1.02 16-10-17  xjc, 轮询错误改为延迟格式化日志
  * \endinternal
  */
  
@@ -28,28 +30,29 @@
 #include "mb/aw_mb_dgus_regmap.h"
 #include "aw_task.h"
 #include "aw_vdebug.h"
+#include "acp1000/slog.h"
 
 /**
- * \brief Modbus  
+ * \brief 本地Modbus 配置 
  * @{
  */
-#define __MB_DGUS_SLAVE_ADDR      0x01            /**< \brief ModbusͨѶַ   */
-#define __MB_DGUS_SERIAL_COM      1               /**< \brief ModbusͨѶ       */
-#define __MB_DGUS_COM_BAUD_RATE   9600            /**< \brief ModbusͨѶڲ */
-#define __MB_DGUS_COM_PARITY      AW_MB_PAR_NONE  /**< \brief ModbusͨѶУ鷽ʽ  */
+#define __MB_DGUS_SLAVE_ADDR      0x01            /**< \brief Modbus通讯本机地址   */
+#define __MB_DGUS_SERIAL_COM      1               /**< \brief Modbus通讯串口       */
+#define __MB_DGUS_COM_BAUD_RATE   9600            /**< \brief Modbus通讯串口波特率 */
+#define __MB_DGUS_COM_PARITY      AW_MB_PAR_NONE  /**< \brief Modbus通讯串口校验方式  */
 
-#define __MB_DGUS_POLL_TASK_PRI       2           /**< \brief ѯȼ */
-#define __MB_DGUS_TASK_STACK_SIZE     4096        /**< \brief ModbusվջС  */
+#define __MB_DGUS_POLL_TASK_PRI       2           /**< \brief 轮询函数任务优先级 */
+#define __MB_DGUS_TASK_STACK_SIZE     4096        /**< \brief Modbus从站任务栈大小  */
 /** @}*/
 
-/**< \brief modbusĴ  */
+/**< \brief 保存modbus寄存器表  */
 aw_local struct aw_mb_dgus_reg_map  *gp_mb_reg_map;  
 
 /*******************************************************************************
 forward define 
 *******************************************************************************/
 /**
- * \brief дĴ
+ * \brief 写寄存器
 */
 aw_local aw_mb_exception_t __wr_reg_func_callback (aw_mb_slave_t slave,
                                                    uint8_t      *p_buf,
@@ -57,7 +60,7 @@ aw_local aw_mb_exception_t __wr_reg_func_callback (aw_mb_slave_t slave,
                                                    uint16_t      num);
 
 /**
- * \brief Ĵ
+ * \brief 读寄存器
 */
 aw_local aw_mb_exception_t __rd_reg_func_callback (aw_mb_slave_t slave,
                                                    uint8_t      *p_buf,
@@ -67,21 +70,21 @@ aw_local aw_mb_exception_t __rd_reg_func_callback (aw_mb_slave_t slave,
 implement 
 *******************************************************************************/                                              
 /**
- * \brief Modubsվݴ
+ * \brief Modubs从站数据处理任务
 */
 aw_local void __mb_dgus_hdl_poll (aw_mb_slave_t slave)
 {
     aw_mb_err_t err;
     AW_FOREVER {
-        /* ӻѯ, ǰΪӿ  */
+        /* 从机轮询操作, 当前设置为阻塞接口  */
         if ((err = aw_mb_slave_poll(slave)) != AW_MB_ERR_NOERR) {
-            AW_INFOF(("Modbus Slave Poll Failed! mb_err = %d\r\n", err));
+            SLOG(SLOG_MOD_MB, SLOG_WARN, "Modbus Slave Poll Failed! mb_err = %d", err);
         }
     }
 }
 
 /**
- * \brief Modbusվʼ
+ * \brief Modbus从站处理初始化
 */
 int aw_mb_dgus_slave_hdl_init (struct aw_mb_dgus_reg_map *p_mb_reg_map,
                                uint8_t                    slave_addr,
@@ -92,7 +95,7 @@ int aw_mb_dgus_slave_hdl_init (struct aw_mb_dgus_reg_map *p_mb_reg_map,
     AW_TASK_DECL_STATIC(modbus_dgus_task, __MB_DGUS_TASK_STACK_SIZE);
     aw_mb_slave_t             slave;
     
-    /*  */
+    /* 本地配置 */
 //    struct aw_mb_serial_param params = {MB_SLAVE_ADDR,
 //                                        MB_COM_PARITY,
 //                                        MB_SERIAL_COM,
@@ -104,7 +107,7 @@ int aw_mb_dgus_slave_hdl_init (struct aw_mb_dgus_reg_map *p_mb_reg_map,
     params.port       = com;
     params.slave_addr = slave_addr;
 
-    gp_mb_reg_map = p_mb_reg_map;  /* ModbusĴб  */
+    gp_mb_reg_map = p_mb_reg_map;  /* 保存Modbus寄存器列表  */
 
     aw_mb_err_t err;
     slave = aw_mb_slave_init(AW_MB_RTU, &params, &err);
@@ -113,24 +116,24 @@ int aw_mb_dgus_slave_hdl_init (struct aw_mb_dgus_reg_map *p_mb_reg_map,
         return AW_ERROR;
     }
 
-    /* Ĵص  */
+    /* 读寄存器回调  */
     (void)aw_mb_slave_register_callback(slave,
                                         AW_MB_FUNC_HOLDREGISTERS_CALLBACK,
                                         AW_MB_FUNC_CALLBACK_READ,
                                         __rd_reg_func_callback);
 
-    /* дĴص  */
+    /* 写寄存器回调  */
     (void)aw_mb_slave_register_callback(slave,
                                         AW_MB_FUNC_HOLDREGISTERS_CALLBACK,
                                         AW_MB_FUNC_CALLBACK_WRITE,
                                         __wr_reg_func_callback);
 
-    /* ʼ*/
+    /* 开始运行*/
     if (aw_mb_slave_start(slave) != AW_MB_ERR_NOERR) {
         return AW_ERROR;
     }
 
-    /* ʼѯ */
+    /* 初始化轮询任务 */
     AW_TASK_INIT(modbus_dgus_task,
                  "modbus_dgus_task",
                  __MB_DGUS_POLL_TASK_PRI,
@@ -138,14 +141,14 @@ int aw_mb_dgus_slave_hdl_init (struct aw_mb_dgus_reg_map *p_mb_reg_map,
                  __mb_dgus_hdl_poll,
                  (void *)slave);
 
-    /* ѯ  */
+    /* 启动轮询任务  */
     AW_TASK_STARTUP(modbus_dgus_task);
 
     return AW_OK;
 }
 
 /**
- * \brief дĴ
+ * \brief 写寄存器
 */
 aw_local aw_mb_exception_t __wr_reg_func_callback (aw_mb_slave_t slave,
                                                    uint8_t      *p_buf,
@@ -163,15 +166,15 @@ aw_local aw_mb_exception_t __wr_reg_func_callback (aw_mb_slave_t slave,
     if ((addr >= AW_MB_DGUS_WRITE_START_ADDR) && 
         (addr < (AW_MB_DGUS_WRITE_START_ADDR + AW_MB_DGUS_WRITE_MAX_NUM))) {
             
-        /* num ж */
+        /* num 判断 */
         if (num != 1) {
-            /* 0x06*/
+            /* 0x06功能*/
             return AW_MB_EXP_ILLEGAL_DATA_VALUE;
         }
         
         index = addr - AW_MB_DGUS_WRITE_START_ADDR;
         
-        /* ִлص */
+        /* 执行回调 */
         switch (index) {
         
         case FUNC_CHARGE_CTRL:  
@@ -225,9 +228,9 @@ aw_local aw_mb_exception_t __wr_reg_func_callback (aw_mb_slave_t slave,
         }
         
         if (err == 0) {
-            aw_mb_dugs_reg_map_lock(gp_mb_reg_map); /* ȡ  */
-            aw_mb_regcpy(p_regbuf + index, p_buf, num); /* fix it ΪСˣmemcpy */
-            aw_mb_dugs_reg_map_unlock(gp_mb_reg_map); /* ȡ  */
+            aw_mb_dugs_reg_map_lock(gp_mb_reg_map); /* 读取保护  */
+            aw_mb_regcpy(p_regbuf + index, p_buf, num); /* fix it 若为小端，用memcpy */
+            aw_mb_dugs_reg_map_unlock(gp_mb_reg_map); /* 读取保护  */
         }
     } else {
         return AW_MB_EXP_ILLEGAL_DATA_ADDRESS;
@@ -236,8 +239,65 @@ aw_local aw_mb_exception_t __wr_reg_func_callback (aw_mb_slave_t slave,
     return exception;
 }
 
+#if ACP1000_DGUS_DIRTY
 /**
- * \brief Ĵ
+ * \brief 提交读数据区的修改（调用前需已上锁）
+ */
+void aw_mb_dgus_rd_commit (struct aw_mb_dgus_reg_map *p_this)
+{
+    const uint16_t *p_reg   = (const uint16_t *)&p_this->rd_reg;
+    bool_t          changed = FALSE;
+    uint16_t        i;
+
+    p_this->commit_cnt++;
+    for (i = 0; i < AW_MB_DGUS_READ_MAX_NUM; i++) {
+        if (p_reg[i] != p_this->rd_shadow[i]) {
+            p_this->rd_shadow[i]      = p_reg[i];
+            p_this->rd_wire[i * 2]     = p_reg[i] >> 8;
+            p_this->rd_wire[i * 2 + 1] = p_reg[i] & 0xFF;
+            p_this->dirty[i >> 5]     |= 1UL << (i & 0x1F);
+            changed = TRUE;
+        }
+    }
+    if (changed) {
+        p_this->change_cnt++;
+    }
+}
+
+/**
+ * \brief 生成状态块并清除变化标志（调用前需已上锁）
+ */
+aw_local void __stat_reg_fill (struct aw_mb_dgus_reg_map  *p_this,
+                               struct aw_mb_dgus_stat_reg *p_stat)
+{
+    uint16_t i;
+    uint16_t last = 0;
+
+    p_stat->change_cnt    = p_this->change_cnt;
+    p_stat->dirty_first   = 0;
+    p_stat->dirty_num     = 0;
+    p_stat->dirty_mask[0] = p_this->dirty[0] & 0xFFFF;
+    p_stat->dirty_mask[1] = p_this->dirty[0] >> 16;
+    p_stat->dirty_mask[2] = p_this->dirty[1] & 0xFFFF;
+    p_stat->dirty_mask[3] = p_this->dirty[1] >> 16;
+
+    for (i = 0; i < AW_MB_DGUS_READ_MAX_NUM; i++) {
+        if (p_this->dirty[i >> 5] & (1UL << (i & 0x1F))) {
+            if (0 == p_stat->dirty_num) {
+                p_stat->dirty_first = i;
+            }
+            last              = i;
+            p_stat->dirty_num = last - p_stat->dirty_first + 1;
+        }
+    }
+
+    p_this->dirty[0] = 0;
+    p_this->dirty[1] = 0;
+}
+#endif
+
+/**
+ * \brief 读寄存器
 */
 aw_local aw_mb_exception_t __rd_reg_func_callback (aw_mb_slave_t slave,
                                                    uint8_t      *p_buf,
@@ -245,18 +305,49 @@ aw_local aw_mb_exception_t __rd_reg_func_callback (aw_mb_slave_t slave,
                                                    uint16_t      num)
 {
     aw_mb_exception_t exception = AW_MB_EXP_NONE;
+#if !ACP1000_DGUS_DIRTY
     struct aw_mb_dgus_rd_reg *p_rd_reg = &gp_mb_reg_map->rd_reg;
     uint16_t             *p_regbuf     = (uint16_t *)p_rd_reg;
+#else
+    struct aw_mb_dgus_stat_reg stat;
+#endif
     uint16_t              index        = 0;
     struct aw_mb_dgus_func_cb_block *pfunc_cb_block = NULL;
 
     pfunc_cb_block = aw_mb_dgus_func_cb_get(gp_mb_reg_map, FUNC_DUGS_COMM_STATE);
-    
-    /* addr ж */
+
+#if ACP1000_DGUS_DIRTY
+    /* 变化状态块 */
+    if ((addr >= AW_MB_DGUS_STAT_START_ADDR) &&
+        (addr < (AW_MB_DGUS_STAT_START_ADDR + AW_MB_DGUS_STAT_NUM))) {
+
+        if ((addr + num) > (AW_MB_DGUS_STAT_START_ADDR + AW_MB_DGUS_STAT_NUM)) {
+            return AW_MB_EXP_ILLEGAL_DATA_VALUE;
+        }
+
+        index = addr - AW_MB_DGUS_STAT_START_ADDR;
+
+        /* 直接使用互斥锁， 读取不需要提交 */
+        AW_MUTEX_LOCK(gp_mb_reg_map->lock, AW_SEM_WAIT_FOREVER);
+        __stat_reg_fill(gp_mb_reg_map, &stat);
+        gp_mb_reg_map->stat_cnt++;
+        AW_MUTEX_UNLOCK(gp_mb_reg_map->lock);
+
+        aw_mb_regcpy(p_buf, (uint16_t *)&stat + index, num);
+
+        if (pfunc_cb_block->pfn_mb_dgus_cb) {
+            pfunc_cb_block->pfn_mb_dgus_cb(pfunc_cb_block->p_arg,
+                    (p_buf[0] << 8 | p_buf[1]));
+        }
+        return exception;
+    }
+#endif
+
+    /* addr 判断 */
     if ((addr >= AW_MB_DGUS_READ_START_ADDR) && 
         (addr < (AW_MB_DGUS_READ_START_ADDR + AW_MB_DGUS_READ_MAX_NUM))) {
         
-        /* num ж */
+        /* num 判断 */
         if ((num > AW_MB_DGUS_READ_MAX_NUM) || \
             ((addr + num) > (AW_MB_DGUS_READ_START_ADDR + AW_MB_DGUS_READ_MAX_NUM))) {
             return AW_MB_EXP_ILLEGAL_DATA_VALUE;
@@ -264,13 +355,22 @@ aw_local aw_mb_exception_t __rd_reg_func_callback (aw_mb_slave_t slave,
         
         index = addr - AW_MB_DGUS_READ_START_ADDR;
         
-        aw_mb_dugs_reg_map_lock(gp_mb_reg_map); /* ȡ  */
-        aw_mb_regcpy(p_buf, p_regbuf + index, num); /* fix it ΪСˣmemcpy */
-        aw_mb_dugs_reg_map_unlock(gp_mb_reg_map); /* ȡ  */
+#if ACP1000_DGUS_DIRTY
+        /* 镜像已是大端， 直接拷贝 */
+        AW_MUTEX_LOCK(gp_mb_reg_map->lock, AW_SEM_WAIT_FOREVER);
+        memcpy(p_buf, &gp_mb_reg_map->rd_wire[index * 2], num * 2);
+        gp_mb_reg_map->rd_cnt++;
+        AW_MUTEX_UNLOCK(gp_mb_reg_map->lock);
+#else
+        aw_mb_dugs_reg_map_lock(gp_mb_reg_map); /* 读取保护  */
+        aw_mb_regcpy(p_buf, p_regbuf + index, num); /* fix it 若为小端，用memcpy */
+        aw_mb_dugs_reg_map_unlock(gp_mb_reg_map); /* 读取保护  */
+#endif
 
         if (pfunc_cb_block->pfn_mb_dgus_cb) {
-           /* ʱͨص */
-           pfunc_cb_block->pfn_mb_dgus_cb(pfunc_cb_block->p_arg, p_buf);
+           /* 定时调用通信正常回调 */
+           pfunc_cb_block->pfn_mb_dgus_cb(pfunc_cb_block->p_arg,
+                   (p_buf[0] << 8 | p_buf[1]));
        }
 
     } else {
@@ -282,14 +382,14 @@ aw_local aw_mb_exception_t __rd_reg_func_callback (aw_mb_slave_t slave,
 
 
 /**
- * \brief עһmodbusĴûص
+ * \brief 注册一个modbus寄存器设置回调
  *
- * \param[in] p_this  ָModusbusĴָ
- * \param[in] type    עص
- * \param[in] func_cb ָָ
- * \param[in] p_arg   ص
+ * \param[in] p_this  指向Modusbus寄存器的指针
+ * \param[in] type    注册回调函数关联的索引
+ * \param[in] func_cb 指向函数的指针
+ * \param[in] p_arg   回调函数参数
  *
- * return 0-ɹ
+ * return 0-成功
  */
 int aw_mb_dgus_func_cb_register (struct aw_mb_dgus_reg_map *p_this,
                                  aw_mb_dugs_func_cb_type_t  type,
@@ -310,12 +410,12 @@ int aw_mb_dgus_func_cb_register (struct aw_mb_dgus_reg_map *p_this,
 }
 
 /**
- * \brief ȡһmodbusĴصṹ
+ * \brief 获取一个modbus寄存器回调结构
  *
- * \param[in] p_this ָModusbusĴָ
- * \param[in] type   עص
+ * \param[in] p_this 指向Modusbus寄存器的指针
+ * \param[in] type   注册回调函数关联的索引
  *
- * \return صϢָ
+ * \return 保存回调函数信息的指针
  */
 struct aw_mb_dgus_func_cb_block *aw_mb_dgus_func_cb_get (
     struct aw_mb_dgus_reg_map *p_this,
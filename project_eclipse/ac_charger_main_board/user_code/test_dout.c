@@ -8,7 +8,7 @@
 AW_TASK_DECL_STATIC(switch_task, SWITCH_TACK_SIZE);
 
 /**
- * ׮쳣
+ * 桩异常检测任务
  */
 static void switch_task_entry (void *p_arg)
 {
@@ -48,12 +48,12 @@ static void switch_task_entry (void *p_arg)
 
 void test_switch_startup (void)
 {
-    AW_TASK_INIT(switch_task,           /* ʵ */
-                 "switch_task",         /*  */
-                 SWITCH_TASK_PRIO,      /* ȼ */
-                 SWITCH_TACK_SIZE,      /* ջС */
-                 switch_task_entry,     /* ں */
-                 (void *)NULL);     /* ڲ */
-    /*  */
+    AW_TASK_INIT(switch_task,           /* 任务实体 */
+                 "switch_task",         /* 任务名字 */
+                 SWITCH_TASK_PRIO,      /* 任务优先级 */
+                 SWITCH_TACK_SIZE,      /* 任务堆栈大小 */
+                 switch_task_entry,     /* 任务入口函数 */
+                 (void *)NULL);     /* 任务入口参数 */
+    /* 启动任务 */
     AW_TASK_STARTUP(switch_task);
 }
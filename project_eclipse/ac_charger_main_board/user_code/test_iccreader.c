@@ -200,9 +200,9 @@ static const struct aw_shell_cmd __g_test_icc_cmds[] = {
 
 static aw_iccreader_t g_iccreader;
 static struct aw_iccreader_transfer g_transfer = {
-    .uart_num    = COM3,  /* ôں  */
-    .uart_buad   = 57600,                   /* ͨŲ */
-    .uart_format = CLOCAL | CREAD | CS8,    /* ͨŸʽ */
+    .uart_num    = COM3,  /* 设置串口号  */
+    .uart_buad   = 57600,                   /* 设置通信波特率 */
+    .uart_format = CLOCAL | CREAD | CS8,    /* 通信格式 */
     .rs485_en    = FALSE,
 };
 
@@ -13,23 +13,23 @@ AW_TASK_DECL_STATIC(uart1_task, UART1_TACK_SIZE);
 
 static uint8_t g_test_wbuf[200] = {0};
 /**
- * ̽
+ * 卡探测任务
  */
 static void uart1_task_entry (void *p_arg)
 {
     int com = COM1;
 
     aw_serial_ioctl(com, SIO_BAUD_SET, (void *)2400);
-    /* Ϊ8λ  */
+    /* 设置为8个数据位  */
     aw_serial_ioctl(com,
                    SIO_HW_OPTS_SET,
                    (void *)( CLOCAL | CREAD | CS8 ));
 
-    /* öȡʱʱΪ20ms */
+    /* 设置读取超时时间为20ms */
     aw_serial_ioctl(com, AW_TIOCRDTIMEOUT, (void *)20);
 
 
-    /* ǷʹRS485 */
+    /* 设置是否使能RS485 */
      aw_serial_ioctl(com, AM_UART_RS485_ENABLE_SET, 1);
 
     while (1) {
@@ -43,13 +43,13 @@ static void uart1_task_entry (void *p_arg)
 
 static void uart1_task_startup (void)
 {
-    AW_TASK_INIT(uart1_task,           /* ʵ */
-                 "uart1_task",            /*  */
-                 UART1_TASK_PRIO,      /* ȼ */
-                 UART1_TACK_SIZE,      /* ջС */
-                 uart1_task_entry,     /* ں */
-                 NULL);        /* ڲ */
-    /*  */
+    AW_TASK_INIT(uart1_task,           /* 任务实体 */
+                 "uart1_task",            /* 任务名字 */
+                 UART1_TASK_PRIO,      /* 任务优先级 */
+                 UART1_TACK_SIZE,      /* 任务堆栈大小 */
+                 uart1_task_entry,     /* 任务入口函数 */
+                 NULL);        /* 任务入口参数 */
+    /* 启动任务 */
     AW_TASK_STARTUP(uart1_task);
 }
 
@@ -61,7 +61,7 @@ AW_TASK_DECL_STATIC(uart4_task, UART4_TACK_SIZE);
 
 static uint8_t g_test_rbuf[10] = {0};
 /**
- * ̽
+ * 卡探测任务
  */
 static void uart4_task_entry (void *p_arg)
 {
@@ -70,16 +70,16 @@ static void uart4_task_entry (void *p_arg)
     int com = COM4;
 
     aw_serial_ioctl(com, SIO_BAUD_SET, (void *)19200);
-    /* Ϊ8λ  */
+    /* 设置为8个数据位  */
     aw_serial_ioctl(com,
                    SIO_HW_OPTS_SET,
                    (void *)( CLOCAL | CREAD | CS8 ));
 
-    /* öȡʱʱΪ20ms */
+    /* 设置读取超时时间为20ms */
     aw_serial_ioctl(com, AW_TIOCRDTIMEOUT, (void *)20);
 
 
-    /* ǷʹRS485 */
+    /* 设置是否使能RS485 */
      aw_serial_ioctl(com, AM_UART_RS485_ENABLE_SET, 1);
 
     while (1) {
@@ -105,13 +105,13 @@ static void uart4_task_entry (void *p_arg)
 
 static void uart4_task_startup (void)
 {
-    AW_TASK_INIT(uart4_task,           /* ʵ */
-                 "uart4_task",            /*  */
-                 UART4_TASK_PRIO,      /* ȼ */
-                 UART4_TACK_SIZE,      /* ջС */
-                 uart4_task_entry,     /* ں */
-                 NULL);        /* ڲ */
-    /*  */
+    AW_TASK_INIT(uart4_task,           /* 任务实体 */
+                 "uart4_task",            /* 任务名字 */
+                 UART4_TASK_PRIO,      /* 任务优先级 */
+                 UART4_TACK_SIZE,      /* 任务堆栈大小 */
+                 uart4_task_entry,     /* 任务入口函数 */
+                 NULL);        /* 任务入口参数 */
+    /* 启动任务 */
     AW_TASK_STARTUP(uart4_task);
 }
 
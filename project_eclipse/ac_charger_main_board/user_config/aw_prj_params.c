@@ -1,7 +1,7 @@
 
 /*
- *  ļù޸ġ
- *  Ϊһӡ
+ *  此文件由配置工具生产，请勿修改。
+ *  现在作为一个例子。
  */
 #undef  AW_IMG_PRJ_BUILD
 #define AW_IMG_PRJ_BUILD
@@ -57,6 +57,10 @@ extern void aw_cplusplus_runtime_init(void);
 
 #include "awbl_digitron_if.h"
 
+#ifdef AW_CFG_TIMESTAMP_TIMER_UNIT
+#include "driver/timer/awbl_ametal_timer.h"
+#endif
+
 
 static void awbl_group_init( void )
 {
@@ -264,6 +268,11 @@ void aw_prj_task_level_init( void )
     /* AWBus init phase 3 */
     awbl_dev_connect();
 
+#ifdef AW_CFG_TIMESTAMP_TIMER_UNIT
+    /* 时间戳绑定硬件定时器（任务剖析、 延迟直方图、 性能统计使用） */
+    awbl_timestamp_lib_init(AWBL_AMETAL_TIMER_NAME, AW_CFG_TIMESTAMP_TIMER_UNIT, 0);
+#endif
+
 #ifdef AW_COM_AWBL_SERIAL
     aw_serial_init();
 #endif  /* AW_COM_AWBL_SERIAL */
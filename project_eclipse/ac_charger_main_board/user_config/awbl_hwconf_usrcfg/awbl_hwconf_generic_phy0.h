@@ -22,26 +22,26 @@
  */
 #ifdef AW_DEV_GENERIC_PHY0
 #include "aw_gpio.h"
-#include "aw_delay.h"                   /* ʱ */
+#include "aw_delay.h"                   /* 延时服务 */
 
 #include "driver/phy/awbl_generic_phy.h"
 
 #define  PHY0_ADDR         			0x05   /* phy addr */
 
-/* ƽ̨سʼ */
+/* 平台相关初始化 */
 aw_local void __generic_phy0_plfm_init (void)
 {
-	/* λܽ */
+	/* 复位管脚 */
 }
 
-/* 豸Ϣ */
+/* 设备信息 */
 aw_local aw_const struct awbl_generic_phy_devinfo __g_gen_phy0_devinfo = {
 	PHY0_ADDR,                  /* phy addr */
 	AWBL_PHY_LINK_AUTONEG,      /* PHY mode */
-	__generic_phy0_plfm_init,   /* ƽ̨سʼ */
+	__generic_phy0_plfm_init,   /* 平台相关初始化 */
 };
 
-/* 豸ʵڴ澲̬ */
+/* 设备实例内存静态分配 */
 aw_local struct awbl_generic_phy_dev __g_gen_phy0_dev;
 
 
@@ -19,21 +19,21 @@
 #include "aw_gpio.h"
 #include "driver/busctlr/awbl_gpio_spi.h"
 
-/* 豸Ϣ */
+/* 设备信息 */
 aw_local aw_const awbl_gpio_spi_devinfo_t __g_gpio_spi0_devinfo = {
     {
-        GPIO_SPI0_BUSID,        /* ߱ */
+        GPIO_SPI0_BUSID,        /* 总线编号 */
     },
-    PIO1_19,                     /* sckź */
-    PIO0_13,                     /* mosiź */
-    PIO0_12,                     /* misoź */
-    0xFF,                       /* ʱMOSIֵ */
-    NULL,                       /* ṩGPIOṩ(NULL)ʹϵͳĬϽӿ */
-    10,                         /* ȼ */
-    NULL,                       /* ƽ̨سʼ */
+    PIO1_19,                     /* sck引脚号 */
+    PIO0_13,                     /* mosi引脚号 */
+    PIO0_12,                     /* miso引脚号 */
+    0xFF,                       /* 接收数据时，MOSI输出值 */
+    NULL,                       /* 提供GPIO输出函数，不提供(NULL)则使用系统默认接口 */
+    10,                         /* 驱动传输任务优先级 */
+    NULL,                       /* 平台相关初始化 */
 };
 
-/* 豸ʵڴ澲̬ */
+/* 设备实例内存静态分配 */
 aw_local awbl_gpio_spi_dev_t __g_gpio_spi0_dev;
 
 #define AWBL_HWCONF_GPIO_SPI0                   \
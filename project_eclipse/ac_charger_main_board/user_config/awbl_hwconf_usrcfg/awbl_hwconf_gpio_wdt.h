@@ -13,9 +13,9 @@
 
 /**
  * \file
- * \brief AWBus ʹGPIOιӲ豸
+ * \brief AWBus 定义使用GPIO喂狗的硬件设备
  *
- * ʹñģҪͷļ
+ * 使用本模块需要包含以下头文件：
  * \code
  * #include "awbl_hwconf_gpio_wdt.h"
  * \endcode
@@ -38,12 +38,12 @@
 
 #ifdef  AW_DEV_GPIO_WDT
 
-/* GPIOι豸Ϣ */
+/* GPIO喂狗设备信息 */
 aw_local aw_const struct gpio_wdt_param __g_gpio_wdt_param = {
     PIO5_0, 600
 };
 
-/* ֱ豸ʵڴ澲̬ */
+/* 直流蜂鸣器设备实例内存静态分配 */
 aw_local struct gpio_wdt_device __g_gpio_wdt_dev;
 
 #define  AWBL_HWCONF_GPIO_WDT   \
@@ -12,19 +12,19 @@
 *******************************************************************************/
 
 /*******************************************************************************
-    LEDϢ
+    LED配置信息
 *******************************************************************************/
 #ifdef AW_DEV_LED_GPIO
 
 #include "driver/led/awbl_gpio_led.h"
 #include "aw_gpio.h"
 
-/* LED豸GPIOϢ */
+/* LED设备GPIO信息 */
 aw_local aw_const uint16_t __g_led_gpios[] = {
         PIO4_4,
 };
 
-/* LED豸Ϣ */
+/* LED设备信息 */
 aw_local aw_const struct awbl_led_gpio_param __g_led_data = {
     /* led_gpio, num_leds, base_num, active_low */
     __g_led_gpios, 
@@ -36,7 +36,7 @@ aw_local aw_const struct awbl_led_gpio_param __g_led_data = {
     TRUE,
 };
 
-/* LED豸ʵڴ澲̬ */
+/* LED设备实例内存静态分配 */
 aw_local struct awbl_led_gpio_dev __g_led_dev;
 
 
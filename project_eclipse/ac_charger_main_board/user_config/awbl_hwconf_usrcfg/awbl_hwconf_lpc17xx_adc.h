@@ -16,7 +16,7 @@
 #include "awbus_lite.h"
 
 /*******************************************************************************
-  ADC Ϣ
+  ADC 配置信息
 *******************************************************************************/
 #ifdef AW_DEV_LPC17XX_ADC
 
@@ -56,7 +56,7 @@ void amdr_plfm_adc_deinit (void)
 
 }
 
-/* ADC0 豸Ϣ */
+/* ADC0 设备信息 */
 aw_local aw_const struct awbl_ametal_adc_param __g_awbl_adc_param = {
     &g_adc_devinfo,
 
@@ -68,7 +68,7 @@ aw_local aw_const struct awbl_ametal_adc_param __g_awbl_adc_param = {
     amdr_plfm_adc_init
 };
 
-/* ADC 豸ʵڴ澲̬*/
+/* ADC 设备实例内存静态分配*/
 aw_local struct awbl_ametal_adc_dev __g_awbl_adc_dev;
 
 #define AWBL_HWCONF_LPC17XX_ADC      \
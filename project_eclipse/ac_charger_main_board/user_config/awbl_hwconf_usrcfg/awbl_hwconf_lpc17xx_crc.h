@@ -22,24 +22,24 @@
 
 /* The CRC device information */
 const amdr_crc_devinfo_t  g_crc_devinfo = {
-	AMHW_CRC,                /** \brief ָCRCĴָ */
+	AMHW_CRC,                /** \brief 指向CRC寄存器块的指针 */
 };
 
 /* Define the device for CRC  */
 amdr_crc_dev_t            g_crc_dev;
 
 
-/** \brief CRCƽ̨ʼ */
+/** \brief CRC平台初始化 */
 void amhw_plfm_crc_init (void)
 {
 }
 
-/** \brief CRCƽ̨ʼ */
+/** \brief 解除CRC平台初始化 */
 void amhw_plfm_crc_deinit (void)
 {
 }
 
-/* 豸Ϣ */
+/* 设备信息 */
 aw_local aw_const struct awbl_ametal_crc_param  __g_ametal_crc_param = {
     &g_crc_dev,
     &g_crc_devinfo,
@@ -47,7 +47,7 @@ aw_local aw_const struct awbl_ametal_crc_param  __g_ametal_crc_param = {
     amhw_plfm_crc_init,
 };
 
-/* 豸ʵڴ澲̬ */
+/* 设备实例内存静态分配 */
 aw_local struct  awbl_ametal_crc_dev __g_ametal_crc_dev;
 
 #define AWBL_HWCONF_LPC17XX_CRC   \
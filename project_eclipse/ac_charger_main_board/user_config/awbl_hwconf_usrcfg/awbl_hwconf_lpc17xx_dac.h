@@ -16,27 +16,27 @@
 #include "awbus_lite.h"
 
 /*******************************************************************************
-  ADC Ϣ
+  ADC 配置信息
 *******************************************************************************/
 #ifdef AW_DEV_LPC17XX_DAC
 
 #include "driver/dac/awbl_ametal_dac.h"
 #include "ametal.h"
 
-/** \brief DAC 豸Ϣ */
+/** \brief DAC 设备信息 */
 const amdr_dac_devinfo_t  g_dac_devinfo = {
-    AMHW_DAC,                 /* ָDACĴָ */
-    10,                       /* DAC   10bits  */
-    3300                      /* οѹ 3.3V        */
+    AMHW_DAC,                 /* 指向DAC寄存器块的指针 */
+    10,                       /* DAC采样精度   10bits  */
+    3300                      /* 参考电压 3.3V        */
 };
 
-/** \brief DAC豸ʵ  */
+/** \brief DAC设备实例  */
 amdr_dac_dev_t            g_dac_dev;
 
-/** \brief DACƽ̨ʼ */
+/** \brief DAC平台初始化 */
 void amhw_plfm_dac_init (void)
 {
-	/* GPIOŹ , δʹDAC*/
+	/* 配置GPIO引脚功能 , 未使能DAC*/
 	am_gpio_pin_cfg(PIO0_26,
 					PIO0_26_AOUT  |
 					PIO0_26_FLOAT |
@@ -44,17 +44,17 @@ void amhw_plfm_dac_init (void)
 
 }
 
-/** \brief DAC ƽ̨ʼ */
+/** \brief 解除DAC 平台初始化 */
 void amhw_plfm_dac_deinit (void)
 {
-	/* DACܽΪģʽDAC */
+	/* DAC管脚设置为数字模式，DAC禁能 */
 	am_gpio_pin_cfg(PIO0_26,
 					PIO0_26_GPIO |
 					PIO0_26_ADMODE_DIGITAL |
 					PIO0_26_DAC_DISABLE);
 }
 
-/* DAC0 豸Ϣ */
+/* DAC0 设备信息 */
 aw_local aw_const struct awbl_ametal_dac_param __g_awbl_dac_param = {
     &g_dac_dev,
     &g_dac_devinfo,
@@ -68,7 +68,7 @@ aw_local aw_const struct awbl_ametal_dac_param __g_awbl_dac_param = {
     amhw_plfm_dac_init
 };
 
-/* ADC 豸ʵڴ澲̬*/
+/* ADC 设备实例内存静态分配*/
 aw_local struct awbl_ametal_dac_dev __g_awbl_dac_dev;
 
 #define AWBL_HWCONF_LPC17XX_DAC      \
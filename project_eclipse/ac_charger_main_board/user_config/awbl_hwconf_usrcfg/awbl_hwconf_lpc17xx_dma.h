@@ -12,56 +12,56 @@
 *******************************************************************************/
 
 /*******************************************************************************
- DMAϢ
+ DMA控制器配置信息
 *******************************************************************************/
 #ifdef AW_DEV_LPC17XX_DMA
 
 #include "driver/dma/awbl_lpc17xx_dma.h"
 #include "ametal.h"
 
-/** \brief DMA 豸Ϣ */
+/** \brief DMA 设备信息 */
 const amdr_dma_devinfo_t g_dma_devinfo = {
 
-    AMHW_GPDMA,                    /**< \brief ָDMAĴָ          */
+    AMHW_GPDMA,                    /**< \brief 指向DMA寄存器块的指针          */
 
-	AMHW_SYSCON,				   /** \brief ָϵͳƼĴָ		  */
+	AMHW_SYSCON,				   /** \brief 指向系统控制寄存器块的指针		  */
 
-	AMHW_DMA_LITTLE_ENDIAN,		   /**< \brief AHBֽ˳ Сģʽ       */
+	AMHW_DMA_LITTLE_ENDIAN,		   /**< \brief AHB主机字节顺序 小端模式       */
 
-    INUM_GPDMA                     /**< \brief DMAжϺ                      */
+    INUM_GPDMA                     /**< \brief DMA中断号                      */
 };
 
-/** \brief DMA豸ʵ */
+/** \brief DMA设备实例 */
 amdr_dma_dev_t g_dma_dev;
 
 /** 
- * \brief DMA ƽ̨ʼ
+ * \brief DMA 平台初始化。
  */
 void amhw_plfm_dma_init (void)
 {
-    /* GPDMAϵ */
+    /* GPDMA上电 */
     amhw_power_periph_up(AMHW_POWER_GPDMA);
 
 }
 
 /** 
- * \brief DMA ƽ̨ȥʼ
+ * \brief DMA 平台去初始化。
  */
 void amhw_plfm_dma_deinit (void)
 {
-	/* GPDMAϵ */
+	/* GPDMA断电 */
     amhw_power_periph_down(AMHW_POWER_GPDMA);
 }
 
-/* 豸Ϣ */
+/* 设备信息 */
 aw_local aw_const struct awbl_lpc17xx_dma_param __g_lpc17xx_dma_param = {
-    &g_dma_dev,                           /* DMA 豸               */
-    &g_dma_devinfo,                       /* DMA 豸Ϣʱ         */
-    (pfunc_dma_init_t)amdr_dma_init,      /* DMA ʼ         */
-    amhw_plfm_dma_init                    /* DMA ƽ̨سʼ */
+    &g_dma_dev,                           /* DMA 设备               */
+    &g_dma_devinfo,                       /* DMA 设备信息时         */
+    (pfunc_dma_init_t)amdr_dma_init,      /* DMA 初始化函数         */
+    amhw_plfm_dma_init                    /* DMA 平台相关初始化函数 */
 };
 
-/* 豸ʵڴ澲̬ */
+/* 设备实例内存静态分配 */
 aw_local struct awbl_lpc17xx_dma_dev __g_lpc17xx_dma_dev;
 
 #define AWBL_HWCONF_LPC17XX_DMA                     \
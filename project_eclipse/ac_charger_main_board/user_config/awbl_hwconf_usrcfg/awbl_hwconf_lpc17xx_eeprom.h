@@ -12,7 +12,7 @@
 *******************************************************************************/
 
 /*******************************************************************************
-  EEPROMϢ
+  EEPROM控制器配置信息
 *******************************************************************************/
 #ifdef AW_DEV_LPC17XX_EEPROM
 
@@ -22,52 +22,52 @@
 typedef int (* pfunc_eeprom_init_t)(void *, void *);
 
 /**
- * \brief EEPROM жϸ
+ * \brief EEPROM 中断个数
  */
 #define EEPROM_INT_COUNT    2
 
-/** \brief ŴϢڴ */
+/** \brief 引脚触发信息内存 */
 static amdr_eeprom_intcb_info_t __g_eeprom_intcb_infos[EEPROM_INT_COUNT];
 
 /**
- * \brief ڲEEPROM 洢б
+ * \brief 内部EEPROM 存储段配置列表
  */
 aw_local aw_const struct awbl_nvram_segment __g_lpc17xx_eeprom_seglst[] = {
-    /* һ洢Σ洢, Ԫ, ʼַ */
-    {"lpc17_eeprom", 0, 0, 64*64},        /* EEPROM洢ռ */
-    {"lpc17_eeprom", 1, 0, 8},            /* ׮ID */
-    {"lpc17_eeprom", 2, 8, 1},            /* ַ */
-    {"lpc17_eeprom", 3, 9, 48},           /* ַ */
-    {"lpc17_eeprom", 4, 62, 2},           /* ĿϢ */
-    {"lpc17_eeprom", 5, 64, 90*44},       /* Ŀ */
-    {"lpc17_eeprom", 6, 64 + 90*44, 72},  /* Կ */
+    /* 定义一个存储段：存储段名称, 单元号, 起始地址，长度 */
+    {"lpc17_eeprom", 0, 0, 64*64},        /* 整个EEPROM存储空间 */
+    {"lpc17_eeprom", 1, 0, 8},            /* 桩ID */
+    {"lpc17_eeprom", 2, 8, 1},            /* 集中器地址 */
+    {"lpc17_eeprom", 3, 9, 48},           /* 集中器地址 */
+    {"lpc17_eeprom", 4, 62, 2},           /* 总条目信息 */
+    {"lpc17_eeprom", 5, 64, 90*44},       /* 条目数据 */
+    {"lpc17_eeprom", 6, 64 + 90*44, 72},  /* 密钥 */
 };
 
-/** \brief EEPROM 豸Ϣ */
+/** \brief EEPROM 设备信息 */
 const amdr_eeprom_devinfo_t g_eeprom_devinfo = {
 
-	AMHW_EEPROM,              /**< \brief EEPROMĻַ                  */
+	AMHW_EEPROM,              /**< \brief EEPROM的基地址                  */
 
-	__g_eeprom_intcb_infos,   /**< \brief ŴϢڴ              */
+	__g_eeprom_intcb_infos,   /**< \brief 引脚触发信息内存              */
 
-	INUM_EEPROM,              /**< \brief EEPROMжϺ             */
+	INUM_EEPROM,              /**< \brief EEPROM中断号             */
 
-	EEPROM_INT_COUNT,         /**< \brief ʹõĹܽжĿ          */
+	EEPROM_INT_COUNT,         /**< \brief 使用到的管脚中断数目          */
 };
 
-/** \brief EEPROM豸ʵ */
+/** \brief EEPROM设备实例 */
 amdr_eeprom_dev_t g_eeprom_dev;
 
-/* 豸Ϣ */
+/* 设备信息 */
 aw_local aw_const struct awbl_lpc17xx_eeprom_param __g_lpc17xx_eeprom_param = {
 	&__g_lpc17xx_eeprom_seglst[0],
 	AW_NELEMENTS(__g_lpc17xx_eeprom_seglst),
-    &g_eeprom_dev,                           /* EEPROM 豸               */
-    &g_eeprom_devinfo,                       /* EEPROM 豸Ϣʱ         */
-    (pfunc_eeprom_init_t)amdr_eeprom_init,   /* EEPROM ʼ         */
+    &g_eeprom_dev,                           /* EEPROM 设备               */
+    &g_eeprom_devinfo,                       /* EEPROM 设备信息时         */
+    (pfunc_eeprom_init_t)amdr_eeprom_init,   /* EEPROM 初始化函数         */
 };
 
-/* 豸ʵڴ澲̬ */
+/* 设备实例内存静态分配 */
 aw_local struct awbl_lpc17xx_eeprom_dev __g_lpc17xx_eeprom_dev;
 
 #define AWBL_HWCONF_LPC17XX_EEPROM                  \
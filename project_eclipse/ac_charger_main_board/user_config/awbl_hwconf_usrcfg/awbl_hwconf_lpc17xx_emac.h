@@ -12,7 +12,7 @@
 *******************************************************************************/
 
 /*******************************************************************************
-  lpc17xx EMAC Ϣ
+  lpc17xx EMAC 配置信息
 *******************************************************************************/
 #ifdef AW_DEV_LPC17XX_EMAC
 
@@ -20,10 +20,10 @@
 #include "ametal.h"
 
 
-/** \brief ƽ̨ʼ */
+/** \brief 平台初始化函数 */
 void amhw_plfm_emac_init (void)
 {
-    /* GPIOŹ */
+    /* 配置GPIO引脚功能 */
     am_gpio_pin_cfg(PIO1_0,  PIO1_0_ENET_TXD0);
     am_gpio_pin_cfg(PIO1_1,  PIO1_1_ENET_TXD1);
     am_gpio_pin_cfg(PIO1_4,  PIO1_4_ENET_TX_EN);
@@ -34,35 +34,35 @@ void amhw_plfm_emac_init (void)
     am_gpio_pin_cfg(PIO1_15, PIO1_15_ENET_REF_CLK);
     am_gpio_pin_cfg(PIO1_16, PIO1_16_ENET_MDC);
     am_gpio_pin_cfg(PIO1_17, PIO1_17_ENET_MDIO);
-    /* Դ */
+    /* 开启电源 */
     amhw_power_periph_up(AMHW_POWER_ENET);
 }
 
-/** \brief ƽ̨ʼ */
+/** \brief 解除平台初始化函数 */
 void amhw_plfm_emac_deinit (void)
 {
-    /* رյԴ */
+    /* 关闭电源 */
 	amhw_power_periph_down(AMHW_POWER_ENET);
 }
 
 
 
 
-/** \brief 豸Ϣ */
+/** \brief 设备信息 */
 aw_local aw_const struct awbl_17xx_emac_devinfo __g_17xx_emac_devinfo = {
 	0,					   /* emac unit0*/
 	"otp_zy_mac",          /* MAC address nvram name*/
 
-	AMHW_EMAC,             /* emacĴַ */
-	INUM_ENET,             /* жϱ    */
+	AMHW_EMAC,             /* emac寄存器基地址 */
+	INUM_ENET,             /* 中断编号    */
 
-	LPC17XX_MII0_BUSID,   /* EMACMII bus */
-	LPC17XX_MII0_BUSID,   /* EMACӵPHYʹõMII bus */
+	LPC17XX_MII0_BUSID,   /* 此EMAC创建的MII bus编号 */
+	LPC17XX_MII0_BUSID,   /* 此EMAC链接的PHY使用的MII bus编号 */
     AWBL_17XXPHY_RMII_MODE,    /* PHY MODE */
-    amhw_plfm_emac_init,       /* ƽ̨سʼ */
+    amhw_plfm_emac_init,       /* 平台相关初始化 */
 };
 
-/** \brief 豸ʵڴ澲̬ */
+/** \brief 设备实例内存静态分配 */
 aw_local struct awbl_17xx_emac_dev __g_17xx_emac_dev;
 
 #define AWBL_HWCONF_LPC17XX_EMAC   \
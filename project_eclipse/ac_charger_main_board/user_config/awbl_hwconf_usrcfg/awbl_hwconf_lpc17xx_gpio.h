@@ -12,7 +12,7 @@
 *******************************************************************************/
 
 /*******************************************************************************
-  LPC5410x GPIO Ϣ  
+  LPC5410x GPIO 配置信息  
 *******************************************************************************/
 
 #ifdef AW_DEV_LPC17XX_GPIO
@@ -27,66 +27,66 @@
 #include "ametal.h"
 
 /**
- * \brief 100ŵķװPIO0 + PIO2 = 28 + 14 = 42,ܽжĿΪ42
- * 80ŵķװPIO0 + PIO2 = 19 + 11 = 30,ܽжĿΪ30Ϊʡ
- * ռ䣬ԽֵΪʵõĹܽжĿ10ҲҪֵ
+ * \brief 对于100脚的封装，PIO0 + PIO2 = 28 + 14 = 42,即最大管脚中断数目为42，
+ * 对于80脚的封装，PIO0 + PIO2 = 19 + 11 = 30,即最大管脚中断数目为30，为节省
+ * 空间，可以将该值设置为实际用到的管脚中断数目（如10），且不要超过上限值。
  */
 #define GPIO_INT_COUNT    64
 
-/** \brief ŴϢڴ */
+/** \brief 引脚触发信息内存 */
 static struct amdr_gpio_trigger_info g_gpio_triginfos[GPIO_INT_COUNT];
 
-/** \brief GPIO豸Ϣ */
+/** \brief GPIO设备信息 */
 const amdr_gpio_devinfo_t g_gpio_devinfo = {
 
-    AMHW_GPIO_BASE,    /**< \brief GPIOĻַ                  */
-    AMHW_PINCON,       /**< \brief ָPin connectĴָ  */
-    AMHW_GPIOINT,      /**< \brief ָжϼĴָ     */
+    AMHW_GPIO_BASE,    /**< \brief GPIO的基地址                  */
+    AMHW_PINCON,       /**< \brief 指向Pin connect寄存器块的指针  */
+    AMHW_GPIOINT,      /**< \brief 指向引脚中断寄存器块的指针     */
 
-    INUM_GPIO,        /**< \brief GPIOжϺ             */
+    INUM_GPIO,        /**< \brief GPIO中断号             */
 
-    GPIO_INT_COUNT,    /**< \brief ʹõĹܽжĿ          */
+    GPIO_INT_COUNT,    /**< \brief 使用到的管脚中断数目          */
     
-    g_gpio_triginfos   /**< \brief ŴϢڴ              */
+    g_gpio_triginfos   /**< \brief 引脚触发信息内存              */
 };
 
-/** \brief GPIO豸ʵ */
+/** \brief GPIO设备实例 */
 amdr_gpio_dev_t g_gpio_dev;
 
-/** \brief GPIOƽ̨ʼ */
+/** \brief GPIO平台初始化 */
 void amhw_plfm_gpio_init (void)
 {
-    /* GPIOϵ */
+    /* GPIO上电 */
     amhw_power_periph_up(AMHW_POWER_GPIO);
 }
 
-/** \brief GPIOƽ̨ȥʼ */
+/** \brief GPIO平台去初始化 */
 void amhw_plfm_gpio_deinit (void)
 {
-    /* GPIOرյԴ */
+    /* GPIO关闭电源 */
     amhw_power_periph_down(AMHW_POWER_GPIO);
 }
 
-/** \brief GPIO 豸Ϣ */
+/** \brief GPIO 设备信息 */
 aw_local struct awbl_ametal_gpio_param __g_lpc17xx_gpio_param = {
     &g_gpio_dev,
     &g_gpio_devinfo,
     
     {
-        PIO0_0,            /**< \brief ֵ֧Сű     */
-        PIO5_4,           /**< \brief ֵ֧ű     */
+        PIO0_0,            /**< \brief 支持的最小引脚编号     */
+        PIO5_4,           /**< \brief 支持的最大引脚编号     */
     },
     
     {
-        INUM_PIO0_0,       /**< \brief ֵ֧Сжϱ */
-        INUM_PIO5_4       /**< \brief ֵ֧Сжϱ */
+        INUM_PIO0_0,       /**< \brief 支持的最小引脚中断编号 */
+        INUM_PIO5_4       /**< \brief 支持的最小引脚中断编号 */
     },
     
     (pfunc_gpio_init_t)(&amdr_gpio_init),
     &amhw_plfm_gpio_init
 };
 
-/** \brief GPIO 豸ʵڴ澲̬ */
+/** \brief GPIO 设备实例内存静态分配 */
 awbl_ametal_gpio_dev_t __g_ametal_gpio_dev;
 
 
@@ -12,7 +12,7 @@
 *******************************************************************************/
 
 /*******************************************************************************
-  lpc17xx I2C0 Ϣ
+  lpc17xx I2C0 配置信息
 *******************************************************************************/
 #ifdef AW_DEV_LPC17XX_I2C_0
 
@@ -23,17 +23,17 @@
 #define BUS_SPEED_I2C0     (20000)
 
 /**
- * \brief I2C0 豸Ϣ
+ * \brief I2C0 设备信息
  */
 const  struct amdr_i2c_devinfo  g_i2c0_devinfo = {
-	BUS_SPEED_I2C0,							/**< \brief I2Cʱ */
-    AMHW_I2C0,                              /**< \brief ָI2C0Ĵָ */
-    INUM_I2C0,                              /**< \brief I2C0 жϱ          */
+	BUS_SPEED_I2C0,							/**< \brief I2C时钟 */
+    AMHW_I2C0,                              /**< \brief 指向I2C0寄存器块的指针 */
+    INUM_I2C0,                              /**< \brief I2C0 中断编号          */
 };
-amdr_i2c_dev_t    g_i2c0_dev;               /**< \brief I2C0 豸ʵ          */
+amdr_i2c_dev_t    g_i2c0_dev;               /**< \brief I2C0 设备实例          */
 
 
-/** \brief I2C0 ƽ̨ʼ */
+/** \brief I2C0 平台初始化函数 */
 void amhw_plfm_i2c0_init (void)
 {
 	am_gpio_pin_cfg(PIO1_30, PIO1_30_SDA0);
@@ -42,7 +42,7 @@ void amhw_plfm_i2c0_init (void)
 	amhw_power_periph_up(AMHW_POWER_I2C0);
 }
 
-/** \brief I2C0 ƽ̨ʼ */
+/** \brief 解除I2C0 平台初始化函数 */
 void amhw_plfm_i2c0_deinit (void)
 {
 	amhw_power_periph_down(AMHW_POWER_I2C0);
@@ -55,9 +55,9 @@ void amhw_plfm_i2c0_deinit (void)
  */
 am_local const struct awbl_ametal_i2c_devinfo  __g_ametal_i2c0_devinfo = {
     {
-		LPC17XX_I2C0_BUSID,         /* Ӧ߱  */
-        BUS_SPEED_I2C0,             /* ٶ          */
-        AWBL_I2C_WAITFOREVER        /* ʱ                   */
+		LPC17XX_I2C0_BUSID,         /* 控制器所对应的总线编号  */
+        BUS_SPEED_I2C0,             /* 控制器总线速度          */
+        AWBL_I2C_WAITFOREVER        /* 超时                   */
     },
     
     &g_i2c0_dev,
@@ -68,7 +68,7 @@ am_local const struct awbl_ametal_i2c_devinfo  __g_ametal_i2c0_devinfo = {
 };   
 
 
-/* I2C0 豸ʵڴ澲̬ */
+/* I2C0 设备实例内存静态分配 */
 aw_local struct awbl_ametal_i2c_dev __g_ametal_i2c0_dev;
 
 
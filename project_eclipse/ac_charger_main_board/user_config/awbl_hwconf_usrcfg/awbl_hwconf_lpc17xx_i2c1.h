@@ -12,7 +12,7 @@
 *******************************************************************************/
 
 /*******************************************************************************
-  lpc17xx I2C1 Ϣ
+  lpc17xx I2C1 配置信息
 *******************************************************************************/
 #ifdef AW_DEV_LPC17XX_I2C_1
 
@@ -22,16 +22,16 @@
 #define BUS_SPEED_I2C1     (400000)
 
 /**
- * \brief I2C1 豸Ϣ
+ * \brief I2C1 设备信息
  */
 const  struct amdr_i2c_devinfo  g_i2c1_devinfo = {
-	BUS_SPEED_I2C1,					 		/**< \brief I2Cʱ */
-    AMHW_I2C1,                              /**< \brief ָI2C1Ĵָ */
-    INUM_I2C1,                              /**< \brief I2C1 жϱ */
+	BUS_SPEED_I2C1,					 		/**< \brief I2C时钟 */
+    AMHW_I2C1,                              /**< \brief 指向I2C1寄存器块的指针 */
+    INUM_I2C1,                              /**< \brief I2C1 中断编号 */
 };
-amdr_i2c_dev_t    g_i2c1_dev;                  /**< \brief I2C1 豸ʵ */
+amdr_i2c_dev_t    g_i2c1_dev;                  /**< \brief I2C1 设备实例 */
 
-/** \brief I2C1 ƽ̨ʼ */
+/** \brief I2C1 平台初始化函数 */
 void amhw_plfm_i2c1_init (void)
 {
 	am_gpio_pin_cfg(PIO0_19, PIO0_19_SDA1 | PIO0_19_OD_ENABLE);
@@ -40,7 +40,7 @@ void amhw_plfm_i2c1_init (void)
 	amhw_power_periph_up(AMHW_POWER_I2C1);
 }
 
-/** \brief I2C1 ƽ̨ʼ */
+/** \brief 解除I2C1 平台初始化函数 */
 void amhw_plfm_i2c1_deinit (void)
 {
 	amhw_power_periph_down(AMHW_POWER_I2C1);
@@ -53,9 +53,9 @@ void amhw_plfm_i2c1_deinit (void)
  */
 am_local const struct awbl_ametal_i2c_devinfo  __g_ametal_i2c1_devinfo = {
     {
-		LPC17XX_I2C1_BUSID,         /* Ӧ߱  */
-        BUS_SPEED_I2C1,             /* ٶ          */
-        AWBL_I2C_WAITFOREVER        /* ʱ                   */
+		LPC17XX_I2C1_BUSID,         /* 控制器所对应的总线编号  */
+        BUS_SPEED_I2C1,             /* 控制器总线速度          */
+        AWBL_I2C_WAITFOREVER        /* 超时                   */
     },
     
     &g_i2c1_dev,
@@ -66,7 +66,7 @@ am_local const struct awbl_ametal_i2c_devinfo  __g_ametal_i2c1_devinfo = {
 };   
 
 
-/* I2C1 豸ʵڴ澲̬ */
+/* I2C1 设备实例内存静态分配 */
 aw_local struct awbl_ametal_i2c_dev __g_ametal_i2c1_dev;
 
 
@@ -12,7 +12,7 @@
 *******************************************************************************/
 
 /*******************************************************************************
-  lpc17xx I2C2 Ϣ
+  lpc17xx I2C2 配置信息
 *******************************************************************************/
 #ifdef AW_DEV_LPC17XX_I2C_2
 
@@ -22,17 +22,17 @@
 #define BUS_SPEED_I2C2     (400000)
 
 /**
- * \brief I2C2 豸Ϣ
+ * \brief I2C2 设备信息
  */
 const  struct amdr_i2c_devinfo  g_i2c2_devinfo = {
-	BUS_SPEED_I2C0,							/**< \brief I2Cʱ */
-    AMHW_I2C2,                              /**< \brief ָI2C2Ĵָ */
-    INUM_I2C2,                              /**< \brief I2C2 жϱ          */
+	BUS_SPEED_I2C0,							/**< \brief I2C时钟 */
+    AMHW_I2C2,                              /**< \brief 指向I2C2寄存器块的指针 */
+    INUM_I2C2,                              /**< \brief I2C2 中断编号          */
 };
-amdr_i2c_dev_t    g_i2c2_dev;               /**< \brief I2C2 豸ʵ          */
+amdr_i2c_dev_t    g_i2c2_dev;               /**< \brief I2C2 设备实例          */
 
 
-/** \brief I2C2 ƽ̨ʼ */
+/** \brief I2C2 平台初始化函数 */
 void amhw_plfm_i2c2_init (void)
 {
 	am_gpio_pin_cfg(PIO2_30, PIO2_30_SDA2 | PIO2_30_OD_DISABLE);
@@ -41,7 +41,7 @@ void amhw_plfm_i2c2_init (void)
 	amhw_power_periph_up(AMHW_POWER_I2C2);
 }
 
-/** \brief I2C2 ƽ̨ʼ */
+/** \brief 解除I2C2 平台初始化函数 */
 void amhw_plfm_i2c2_deinit (void)
 {
 	amhw_power_periph_down(AMHW_POWER_I2C2);
@@ -54,9 +54,9 @@ void amhw_plfm_i2c2_deinit (void)
  */
 am_local const struct awbl_ametal_i2c_devinfo  __g_ametal_i2c2_devinfo = {
     {
-		LPC17XX_I2C2_BUSID,                          /* Ӧ߱  */
-        BUS_SPEED_I2C2,             /* ٶ          */
-        AWBL_I2C_WAITFOREVER        /* ʱ                   */
+		LPC17XX_I2C2_BUSID,                          /* 控制器所对应的总线编号  */
+        BUS_SPEED_I2C2,             /* 控制器总线速度          */
+        AWBL_I2C_WAITFOREVER        /* 超时                   */
     },
     
     &g_i2c2_dev,
@@ -67,7 +67,7 @@ am_local const struct awbl_ametal_i2c_devinfo  __g_ametal_i2c2_devinfo = {
 };   
 
 
-/* I2C0 豸ʵڴ澲̬ */
+/* I2C0 设备实例内存静态分配 */
 aw_local struct awbl_ametal_i2c_dev __g_ametal_i2c2_dev;
 
 
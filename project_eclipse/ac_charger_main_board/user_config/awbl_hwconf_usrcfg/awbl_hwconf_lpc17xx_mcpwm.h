@@ -12,7 +12,7 @@
 *******************************************************************************/
 
 /*******************************************************************************
-    lpc5410x ׼ʱϢ
+    lpc5410x 标准定时器配置信息
 *******************************************************************************/
 
 #include "ametal.h"
@@ -25,7 +25,7 @@
 
 #ifdef AW_DEV_LPC17XX_MCPWM
 
-/*   ܽ */
+/*   管脚配置 */
 amdr_mcpwm_ioinfo_t __g_mcpwm_ioinfo_list[] = {
 	{PIO1_19, PIO1_19_MCOA0, PIO1_19_GPIO},
 	{PIO1_22, PIO1_22_MCOB0, PIO1_22_GPIO},
@@ -35,29 +35,29 @@ amdr_mcpwm_ioinfo_t __g_mcpwm_ioinfo_list[] = {
 	{PIO1_29, PIO1_29_MCOB2, PIO1_29_GPIO},
 };
 
-/** \brief mcpwmܵ豸Ϣ */
+/** \brief mcpwm功能的设备信息 */
 const amdr_mcpwm_devinfo_t  g_mcpwm_devinfo = {
-	AMHW_MCPWM,                 /**< \brief ָMCPWMĴָ */
-	INUM_MCPWM,                 /**< \brief PWMжϱ           */
+	AMHW_MCPWM,                 /**< \brief 指向MCPWM寄存器块的指针 */
+	INUM_MCPWM,                 /**< \brief PWM中断编号           */
     &__g_mcpwm_ioinfo_list[0],
-    3,                          /* 3ͨ    */
+    3,                          /* 3个通道    */
 };
 
 
-/** \brief mcpwmܵ豸 */
+/** \brief mcpwm功能的设备定义 */
 amdr_mcpwm_dev_t  g_mcpwm_dev;
 
-/** \brief mcpwmܵƽ̨ʼ */
+/** \brief mcpwm功能的平台初始化 */
 void  amhw_plfm_mcpwm_init (void)
 {
-    /* MCPWMԴ */
+    /* 开启MCPWM电源 */
 	amhw_power_periph_up(AMHW_POWER_MCPWM);
 }
 
-/** \brief  ƽ̨ʼ */
+/** \brief  解除平台初始化 */
 void amhw_plfm_mcpwm_deinit (void)
 {
-    /* رMCPWMԴ */
+    /* 关闭MCPWM电源 */
 	amhw_power_periph_down(AMHW_POWER_MCPWM);
 }
 
@@ -73,7 +73,7 @@ aw_local aw_const struct awbl_ametal_pwm_param __g_awbl_mcpwm_param = {
     amhw_plfm_mcpwm_init            /* pfunc_plfm_init */
 };
 
-/* 豸ʵڴ澲̬ */
+/* 设备实例内存静态分配 */
 aw_local struct awbl_ametal_pwm_dev __g_awbl_mcpwm_dev;
 
 #define AWBL_HWCONF_LPC17XX_MCPWM           \
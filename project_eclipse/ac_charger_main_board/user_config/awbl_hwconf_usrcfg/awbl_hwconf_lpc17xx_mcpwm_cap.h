@@ -22,7 +22,7 @@
 
 #ifdef AW_DEV_LPC17XX_MCPWM_CAP
 
-/** \brief   ܽ */
+/** \brief  捕获 管脚配置 */
 amdr_mcpwm_cap_ioinfo_t __g_mcpwm_cap_ioinfo_list[] = {
 	{PIO1_20, PIO1_20_MCI0, PIO1_20_GPIO},
 	{PIO1_23, PIO1_23_MCI1, PIO1_23_GPIO},
@@ -30,33 +30,33 @@ amdr_mcpwm_cap_ioinfo_t __g_mcpwm_cap_ioinfo_list[] = {
 };
 
 
-/** \brief mcpwmܵ豸Ϣ */
+/** \brief mcpwm功能的设备信息 */
 const amdr_mcpwm_cap_devinfo_t  g_mcpwm_cap_devinfo = {
-	AMHW_MCPWM,                 /**< \brief ָPWMĴָ */
-	INUM_MCPWM,                 /**< \brief PWMжϱ           */
+	AMHW_MCPWM,                 /**< \brief 指向PWM寄存器块的指针 */
+	INUM_MCPWM,                 /**< \brief PWM中断编号           */
     &__g_mcpwm_cap_ioinfo_list[0],
-    3,                         /**< \brief 3ͨ    */
+    3,                         /**< \brief 3个通道    */
 };
 
-/** \brief mcpwmڲܵ豸 */
+/** \brief mcpwm用于捕获功能的设备定义 */
 amdr_mcpwm_cap_dev_t  g_mcpwm_cap_dev;
 
 /**
- * \brief mcpwmܵƽ̨ʼ
- * \param[in] channel    : ͨ0-2
- * \return    -AM_EINVAL AM_OK
+ * \brief mcpwm功能的平台初始化
+ * \param[in] channel    : 通道0-2
+ * \return    -AM_EINVAL 、AM_OK
  */
 void  amhw_plfm_mcpwm_cap_init (void)
 {
-    /* MCPWMԴ */
+    /* 开启MCPWM电源 */
 	amhw_power_periph_up(AMHW_POWER_MCPWM);
 
 }
 
-/** \brief  ƽ̨ʼ */
+/** \brief  解除平台初始化 */
 void amhw_plfm_mcpwm_cap_deinit (void)
 {
-    /* رMCPWMԴ */
+    /* 关闭MCPWM电源 */
 	amhw_power_periph_down(AMHW_POWER_MCPWM);
 }
 
@@ -72,7 +72,7 @@ aw_local aw_const struct awbl_ametal_cap_param __g_awbl_mcpwm_cap_param = {
     amhw_plfm_mcpwm_cap_init      /* pfunc_plfm_init */
 };
 
-/*  豸ʵڴ澲̬ */
+/*  设备实例内存静态分配 */
 aw_local struct awbl_ametal_cap_dev __g_awbl_mcpwm_cap_dev;
 
 #define AWBL_HWCONF_LPC17XX_MCPWM_CAP       \
@@ -12,7 +12,7 @@
 *******************************************************************************/
 
 /*******************************************************************************
-  жϿϢ
+  中断控制器配置信息
 *******************************************************************************/
 #include "driver/intctlr/awbl_armcm_nvic.h"
 #include "ametal.h"
@@ -20,35 +20,35 @@
 #ifdef AW_DEV_LPC17XX_NVIC
 
 /*******************************************************************************
-  ARM Cortex-M NVIC Ϣ
+  ARM Cortex-M NVIC 配置信息
 *******************************************************************************/
 
-/* ISR Ϣӳڴ澲̬ */
+/* ISR 信息映射内存静态分配 */
 aw_local uint8_t __g_armcm_nvic_infomap[INUM_INTERNAL_COUNT];
 
-/* ISR Ϣڴ澲̬ */
+/* ISR 信息内存静态分配 */
 aw_local struct awbl_armcm_nvic_isrinfo
     __g_armcm_nvic_isrinfos[AW_CFG_ARMCM_NVIC_ISRINFO_COUNT];
 
-/* NVIC 豸Ϣ */
+/* NVIC 设备信息 */
 aw_local aw_const struct awbl_armcm_nvic_devinfo __g_armcm_nvic_devinfo = {
     
     16,
     
     {
-        INUM_WWDT,                     /* ֵ֧ʼжϺ */
-        INUM_EEPROM,                 /* ֵ֧ĽжϺ */
+        INUM_WWDT,                     /* 支持的起始中断号 */
+        INUM_EEPROM,                 /* 支持的结束中断号 */
     },
 
-    INUM_INTERNAL_COUNT,              /* жϸ */
+    INUM_INTERNAL_COUNT,              /* 中断个数 */
 
-    &__g_armcm_nvic_infomap[0],       /* ISR ӳϢڴ(Сinput_cnt) */
+    &__g_armcm_nvic_infomap[0],       /* ISR 映射信息内存(大小等于input_cnt) */
 
-    AW_CFG_ARMCM_NVIC_ISRINFO_COUNT,  /* ISR Ϣ */
-    &__g_armcm_nvic_isrinfos[0],      /* ISR Ϣڴ(Сisrinfo_cnt) */
+    AW_CFG_ARMCM_NVIC_ISRINFO_COUNT,  /* ISR 信息条数 */
+    &__g_armcm_nvic_isrinfos[0],      /* ISR 信息槽内存(大小等于isrinfo_cnt) */
 };
 
-/* NVIC 豸ʵڴ澲̬*/
+/* NVIC 设备实例内存静态分配*/
 aw_local struct awbl_armcm_nvic_dev __g_armcm_nvic_dev;
 
 #define AWBL_HWCONF_LPC17XX_NVIC   \
@@ -12,7 +12,7 @@
 *******************************************************************************/
 
 /*******************************************************************************
-    lpc5410x ׼ʱϢ
+    lpc5410x 标准定时器配置信息
 *******************************************************************************/
 
 #include "ametal.h"
@@ -25,7 +25,7 @@
 
 #ifdef AW_DEV_LPC17XX_PWM0
 
-/* The PWM0 ~ PWM5 ܽ */
+/* The PWM0 ~ PWM5 管脚配置 */
 amdr_pwm_ioinfo_t __g_pwm0_ioinfo_list[] = {
 	{PIO1_2,  PIO1_2_PWM0_1,  PIO1_2_GPIO},
 	{PIO1_3,  PIO1_3_PWM0_2,  PIO1_3_GPIO},
@@ -35,28 +35,28 @@ amdr_pwm_ioinfo_t __g_pwm0_ioinfo_list[] = {
 	{PIO1_11, PIO1_11_PWM0_6, PIO1_11_GPIO},
 };
 
-/** \brief pwmܵ豸Ϣ */
+/** \brief pwm功能的设备信息 */
 const amdr_pwm_devinfo_t  g_pwm0_devinfo = {
-    AMHW_PWM0,                 /**< \brief ָPWMĴָ */
-    INUM_PWM0,                 /**< \brief PWMжϱ           */
+    AMHW_PWM0,                 /**< \brief 指向PWM寄存器块的指针 */
+    INUM_PWM0,                 /**< \brief PWM中断编号           */
     &__g_pwm0_ioinfo_list[0],
-    6,                         /* 6ͨ    */
+    6,                         /* 6个通道    */
 };
 
-/** \brief pwmܵ豸 */
+/** \brief pwm功能的设备定义 */
 amdr_pwm_dev_t  g_pwm0_dev;
 
-/** \brief pwmܵƽ̨ʼ */
+/** \brief pwm功能的平台初始化 */
 void  amhw_plfm_pwm0_init (void)
 {
-    /* PWMԴ */
+    /* 开启PWM电源 */
 	amhw_power_periph_up(AMHW_POWER_PWM0);
 }
 
-/** \brief  ƽ̨ʼ */
+/** \brief  解除平台初始化 */
 void amhw_plfm_pwm0_deinit (void)
 {
-    /* رMCPWMԴ */
+    /* 关闭MCPWM电源 */
 	amhw_power_periph_down(AMHW_POWER_PWM0);
 }
 
@@ -72,7 +72,7 @@ aw_local aw_const struct awbl_ametal_pwm_param __g_awbl_pwm0_param = {
     amhw_plfm_pwm0_init           /* pfunc_plfm_init */
 };
 
-/* 豸ʵڴ澲̬ */
+/* 设备实例内存静态分配 */
 aw_local struct awbl_ametal_pwm_dev __g_awbl_pwm0_dev;
 
 #define AWBL_HWCONF_LPC17XX_PWM0            \
@@ -12,7 +12,7 @@
 *******************************************************************************/
 
 /*******************************************************************************
-    lpc5410x ׼ʱϢ
+    lpc5410x 标准定时器配置信息
 *******************************************************************************/
 
 #include "ametal.h"
@@ -25,38 +25,38 @@
 
 #ifdef AW_DEV_LPC17XX_PWM1
 
-/* The PWM0 ~ PWM5 ܽ */
+/* The PWM0 ~ PWM5 管脚配置 */
 amdr_pwm_ioinfo_t __g_pwm1_ioinfo_list[] = {
     {PIO3_24, PIO3_24_PWM1_1, PIO3_24_GPIO},
-	{PIO3_25, PIO3_25_PWM1_2, PIO3_25_GPIO},
+	{PIO2_1,  PIO2_1_PWM1_2,  PIO2_1_GPIO},     /* 蜂鸣器 */
 	{PIO3_26, PIO3_26_PWM1_3, PIO3_26_GPIO},
 	{PIO2_3, PIO2_3_PWM1_4, PIO2_3_GPIO},
 	{PIO2_4, PIO2_4_PWM1_5, PIO2_4_GPIO},
 	{PIO2_5, PIO2_5_PWM1_6, PIO2_5_GPIO},
 };
 
-/** \brief pwmܵ豸Ϣ */
+/** \brief pwm功能的设备信息 */
 const amdr_pwm_devinfo_t  g_pwm1_devinfo = {
-    AMHW_PWM1,                 /**< \brief ָPWMĴָ */
-    INUM_PWM1,                 /**< \brief PWMжϱ           */
+    AMHW_PWM1,                 /**< \brief 指向PWM寄存器块的指针 */
+    INUM_PWM1,                 /**< \brief PWM中断编号           */
     &__g_pwm1_ioinfo_list[0],
-    6,                         /* 6ͨ    */
+    6,                         /* 6个通道    */
 };
 
-/** \brief pwmܵ豸 */
+/** \brief pwm功能的设备定义 */
 amdr_pwm_dev_t  g_pwm1_dev;
 
-/** \brief pwmܵƽ̨ʼ */
+/** \brief pwm功能的平台初始化 */
 void  amhw_plfm_pwm1_init (void)
 {
-    /* PWMԴ */
+    /* 开启PWM电源 */
 	amhw_power_periph_up(AMHW_POWER_PWM1);
 }
 
-/** \brief  ƽ̨ʼ */
+/** \brief  解除平台初始化 */
 void amhw_plfm_pwm1_deinit (void)
 {
-    /* رMCPWMԴ */
+    /* 关闭MCPWM电源 */
 	amhw_power_periph_down(AMHW_POWER_PWM1);
 }
 
@@ -72,7 +72,7 @@ aw_local aw_const struct awbl_ametal_pwm_param __g_awbl_pwm1_param = {
     amhw_plfm_pwm1_init           /* pfunc_plfm_init */
 };
 
-/* 豸ʵڴ澲̬ */
+/* 设备实例内存静态分配 */
 aw_local struct awbl_ametal_pwm_dev __g_awbl_pwm1_dev;
 
 #define AWBL_HWCONF_LPC17XX_PWM1             \
@@ -22,35 +22,35 @@
 
 #ifdef AW_DEV_LPC17XX_PWM1_CAP
 
-/** \brief   ܽ */
+/** \brief  捕获 管脚配置 */
 amdr_pwm_cap_ioinfo_t __g_pwm1_cap_ioinfo_list[] = {
 	{PIO1_28, PIO1_28_PCAP1_0, PIO1_28_GPIO},
 	{PIO1_29, PIO1_29_PCAP1_1, PIO1_29_GPIO},
 };
 
 
-/** \brief pwmܵ豸Ϣ */
+/** \brief pwm功能的设备信息 */
 const amdr_pwm_cap_devinfo_t  g_pwm1_cap_devinfo = {
-    AMHW_PWM1,                 /**< \brief ָPWMĴָ */
-    INUM_PWM1,                 /**< \brief PWMжϱ           */
+    AMHW_PWM1,                 /**< \brief 指向PWM寄存器块的指针 */
+    INUM_PWM1,                 /**< \brief PWM中断编号           */
     &__g_pwm1_cap_ioinfo_list[0],
-    2,                         /* 2ͨ    */
+    2,                         /* 2个通道    */
 };
 
-/** \brief pwmܵ豸 */
+/** \brief pwm功能的设备定义 */
 amdr_pwm_cap_dev_t  g_pwm1_cap_dev;
 
-/** \brief pwmܵƽ̨ʼ */
+/** \brief pwm功能的平台初始化 */
 void  amhw_plfm_pwm1_cap_init (void)
 {
-    /* PWMԴ */
+    /* 开启PWM电源 */
 	amhw_power_periph_up(AMHW_POWER_PWM1);
 }
 
-/** \brief  ƽ̨ʼ */
+/** \brief  解除平台初始化 */
 void amhw_plfm_pwm1_cap_deinit (void)
 {
-    /* رMCPWMԴ */
+    /* 关闭MCPWM电源 */
 	amhw_power_periph_down(AMHW_POWER_PWM1);
 }
 
@@ -66,7 +66,7 @@ aw_local aw_const struct awbl_ametal_cap_param __g_awbl_pwm1_cap_param = {
     amhw_plfm_pwm1_cap_init      /* pfunc_plfm_init */
 };
 
-/* 豸ʵڴ澲̬ */
+/* 设备实例内存静态分配 */
 aw_local struct awbl_ametal_cap_dev __g_awbl_pwm1_cap_dev;
 
 #define AWBL_HWCONF_LPC17XX_PWM1_CAP        \
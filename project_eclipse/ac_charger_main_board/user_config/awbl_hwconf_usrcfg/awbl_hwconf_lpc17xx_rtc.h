@@ -19,29 +19,29 @@
 
 #ifdef AW_DEV_LPC17XX_RTC
 
-/** \brief RTC 豸Ϣ */
+/** \brief RTC 设备信息 */
 const amdr_rtc_devinfo_t  g_rtc_devinfo = {
     AMHW_RTC,                /**< \brief RTC */
     INUM_RTC
 };
 
-/** \brief RTC 豸ʵ */
+/** \brief RTC 设备实例 */
 amdr_rtc_dev_t            g_rtc_dev;
 
-/** \brief RTCƽ̨ʼ */
+/** \brief RTC平台初始化 */
 void amhw_plfm_rtc_init (void)
 {
     amhw_power_periph_up(AMHW_POWER_RTC);
     
 }
 
-/** \brief RTCƽ̨ʼ */
+/** \brief 解除RTC平台初始化 */
 void amhw_plfm_rtc_deinit (void)
 {
     amhw_power_periph_down(AMHW_POWER_RTC);
 }
 
-/* 豸Ϣ */
+/* 设备信息 */
 aw_local aw_const struct awbl_ametal_rtc_param  __g_ametal_rtc_param = {
    {
         LPC17XX_RTC_ID                        /* RTC_ID  */
@@ -52,7 +52,7 @@ aw_local aw_const struct awbl_ametal_rtc_param  __g_ametal_rtc_param = {
    amhw_plfm_rtc_init,
 };
 
-/* 豸ʵڴ澲̬ */
+/* 设备实例内存静态分配 */
 aw_local struct awbl_ametal_rtc_dev __g_ametal_rtc_dev;
 
 #define AWBL_HWCONF_LPC17XX_RTC   \
@@ -12,7 +12,7 @@
 *******************************************************************************/
 
 /*******************************************************************************
-  lpc17xx SDIO Ϣ
+  lpc17xx SDIO 配置信息
 *******************************************************************************/
 
 #ifndef __AWBL_HWCONF_LPC17XX_SDIO_H
@@ -28,38 +28,38 @@
 #include "driver/dma/awbl_lpc17xx_dma.h"
 #include "driver/sdio/awbl_lpc17xx_sdio.h"
 
-/* 豸ʵڴ澲̬ */
+/* 设备实例内存静态分配 */
 aw_local awbl_lpc17xx_sdio_dev_t __g_lpc17xx_sdio_dev;
 
 aw_local awbl_sdio_slot_t __g_lpc17xx_slot0;
 
-/* ṩһ̬ڴžĿ豸ʵ */
+/* 提供一个静态内存存放具体的卡设备实体 */
 static uint8_t card_buf[sizeof(awbl_sdcard_dev_t)];
 
-/** \brief ŴϢڴ */
+/** \brief 引脚触发信息内存 */
 static struct amdr_mci_intcb_info __g_mci_intcb_infos[AMHW_MCI_INT_TYPE_COUNT];
 
-#define __SDIO_DMA_MCIFIFO     0x400C0080      /* SDIO ӿFIFO             */
-#define __SDIO_DMA_CHN         0               /* дݵDMA ͨ */
-#define __SDIO_TASK_PRIO       6               /* SDIOȼ */
+#define __SDIO_DMA_MCIFIFO     0x400C0080      /* SDIO 接口FIFO入口             */
+#define __SDIO_DMA_CHN         0               /* 写数据的DMA 通道 */
+#define __SDIO_TASK_PRIO       6               /* SDIO任务优先级 */
 
-/** \brief MCI豸Ϣ */
+/** \brief MCI设备信息 */
 const amdr_mci_devinfo_t g_mci_devinfo = {
 
-    AMHW_SDC,               /**< \brief MCIĻַ  */
+    AMHW_SDC,               /**< \brief MCI的基地址  */
 
-    AMHW_SYSCON,            /**< \brief SYSCONĻַ  */
+    AMHW_SYSCON,            /**< \brief SYSCON的基地址  */
 
-    __g_mci_intcb_infos,    /**< \brief MCIжϻص  */
+    __g_mci_intcb_infos,    /**< \brief MCI的中断回调  */
 
-    INUM_SDC,               /**< \brief MCIжϺ  */
+    INUM_SDC,               /**< \brief MCI中断号  */
 
-    PIO2_19,                /**< \brief MCI SD_INSERT  */
+    PIO2_19,                /**< \brief MCI SD_INSERT引脚  */
 
-    PIO2_21                 /**< \brief MCI SD_WP  */
+    PIO2_21                 /**< \brief MCI SD_WP引脚  */
 };
 
-/** \brief MCI豸ʵ */
+/** \brief MCI设备实例 */
 amdr_mci_dev_t g_mci_dev;
 
 static bool_t __sdio_detect (awbl_sdio_slot_t *p_slot)
@@ -78,13 +78,13 @@ static bool_t __sdio_detect (awbl_sdio_slot_t *p_slot)
 	return TRUE;
 }
 
-/** \brief MCIƽ̨ʼ */
+/** \brief MCI平台初始化 */
 void amhw_plfm_mci_init (void)
 {
-    /* MCIϵ */
+    /* MCI上电 */
     amhw_power_periph_up(AMHW_POWER_SDC);
 
-    /* MCIӿڸ */
+    /* 配置MCI接口各功能引脚 */
     aw_gpio_pin_cfg(PIO1_5, PIO1_5_SD_PWR);
     aw_gpio_pin_cfg(PIO1_2, PIO1_2_SD_CLK);
     aw_gpio_pin_cfg(PIO1_3, PIO1_3_SD_CMD);
@@ -93,10 +93,10 @@ void amhw_plfm_mci_init (void)
     aw_gpio_pin_cfg(PIO1_11, PIO1_11_SD_DAT2);
     aw_gpio_pin_cfg(PIO1_12, PIO1_12_SD_DAT3);
 
-    /* ÿ */
+    /* 配置卡插入检测引脚 */
     aw_gpio_pin_cfg(PIO2_19, PIO2_19_INPUT);
 
-    /* ÿд */
+    /* 配置卡写保护检测引脚 */
     aw_gpio_pin_cfg(PIO2_21, PIO2_21_INPUT);
 
 
@@ -110,15 +110,15 @@ void amhw_plfm_mci_init (void)
 
 }
 
-/** \brief MCIƽ̨ȥʼ */
+/** \brief MCI平台去初始化 */
 void amhw_plfm_mci_deinit (void)
 {
-    /* MCIرյԴ */
+    /* MCI关闭电源 */
     amhw_power_periph_down(AMHW_POWER_SDC);
 }
 
 
-/* 豸Ϣ */
+/* 设备信息 */
 aw_local aw_const awbl_lpc17xx_sdio_dev_info_t __g_lpc17xx_sdio_devinfo = {
 	{
 		LPC17XX_SDIO_BUSID,
@@ -129,15 +129,15 @@ aw_local aw_const awbl_lpc17xx_sdio_dev_info_t __g_lpc17xx_sdio_devinfo = {
 		 SDIO_SPI_CRC_DISABLE
 	},
 
-    TRUE,							/* ʹDMA */
-    __SDIO_DMA_CHN,				    /* DMAͨ */
-    __SDIO_DMA_MCIFIFO,				/* SDIO FIFOַ */
-    __SDIO_TASK_PRIO,               /* ȼ */
+    TRUE,							/* 使能DMA传输 */
+    __SDIO_DMA_CHN,				    /* DMA通道号 */
+    __SDIO_DMA_MCIFIFO,				/* SDIO FIFO地址 */
+    __SDIO_TASK_PRIO,               /* 传输任务优先级 */
 
-    &g_mci_dev,						/* 豸ʵ */
-    &g_mci_devinfo,					/* 豸Ϣ */
-    (pfunc_mci_init_t)amdr_mci_init,/* 豸ʼ */
-    amhw_plfm_mci_init,   	        /* ƽ̨سʼ */
+    &g_mci_dev,						/* 设备实例 */
+    &g_mci_devinfo,					/* 设备信息 */
+    (pfunc_mci_init_t)amdr_mci_init,/* 设备初始化 */
+    amhw_plfm_mci_init,   	        /* 平台相关初始化 */
 };
 
 #define AWBL_HWCONF_LPC17XX_SDIO    \
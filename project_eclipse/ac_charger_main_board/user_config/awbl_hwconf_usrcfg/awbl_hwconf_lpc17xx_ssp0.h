@@ -11,7 +11,7 @@
 * e-mail:      anywhere.support@zlg.cn
 *******************************************************************************/
 /*******************************************************************************
-  lpc54xxx SSP0 Ϣ
+  lpc54xxx SSP0 配置信息
 *******************************************************************************/
 #include "aw_int.h"
 #include "aw_spi.h"
@@ -22,7 +22,7 @@
 
 #include "driver/spi/awbl_ametal_spi.h"
 
-/** \brief SSP0 豸Ϣ */
+/** \brief SSP0 设备信息 */
 const amdr_ssp_devinfo_t  g_ssp0_devinfo = {
     AMHW_SSP0,                  /**< \brief SSP base addr   */
     INUM_SSP0,                  /**< \brief interrupt num   */
@@ -31,10 +31,10 @@ const amdr_ssp_devinfo_t  g_ssp0_devinfo = {
     30000000                    /**< \brief speed           */
 };
 
-/** \brief SSP0 豸ʵ */
+/** \brief SSP0 设备实例 */
 amdr_ssp_dev_t            g_ssp0_dev;
 
-/** \brief SSP0 ƽ̨ʼ */
+/** \brief SSP0 平台初始化 */
 void amhw_plfm_ssp0_init (void)
 {
     amhw_power_periph_up(AMHW_POWER_SSP0);
@@ -45,13 +45,13 @@ void amhw_plfm_ssp0_init (void)
     am_gpio_pin_cfg(PIO0_16, PIO0_16_GPIO | PIO0_16_PULLUP);
 }
 
-/** \brief SSP0 ƽ̨ʼ */
+/** \brief 解除SSP0 平台初始化 */
 void amhw_plfm_ssp0_deinit (void)
 {
     amhw_power_periph_down(AMHW_POWER_SSP0);
 }
 
-/* 豸Ϣ */
+/* 设备信息 */
 aw_local aw_const struct awbl_ametal_spi_devinfo __g_ametal_ssp0_devinfo = {
     {
     	LPC17XX_SSP0_BUSID,                                   /* SPI BUS ID   */
@@ -63,7 +63,7 @@ aw_local aw_const struct awbl_ametal_spi_devinfo __g_ametal_ssp0_devinfo = {
 };
 
 
-/* 豸ʵڴ澲̬ */
+/* 设备实例内存静态分配 */
 aw_local struct awbl_ametal_spi_dev __g_ametal_ssp0_dev;
 
 
@@ -11,7 +11,7 @@
 * e-mail:      anywhere.support@zlg.cn
 *******************************************************************************/
 /*******************************************************************************
-  lpc54xxx SSP1 Ϣ
+  lpc54xxx SSP1 配置信息
 *******************************************************************************/
 #include "aw_int.h"
 #include "aw_spi.h"
@@ -30,10 +30,10 @@ const amdr_ssp_devinfo_t  g_ssp1_devinfo = {
     1000000                     /**< \brief speed           */
 };
 
-/** \brief SSP1 豸ʵ */
+/** \brief SSP1 设备实例 */
 amdr_ssp_dev_t            g_ssp1_dev;
 
-/** \brief SSP1 ƽ̨ʼ */
+/** \brief SSP1 平台初始化 */
 void amhw_plfm_ssp1_init (void)
 {
     amhw_power_periph_up(AMHW_POWER_SSP1);
@@ -43,13 +43,13 @@ void amhw_plfm_ssp1_init (void)
     am_gpio_pin_cfg(PIO0_7, PIO0_7_SCK1  | PIO0_7_PULLUP);
 }
 
-/** \brief SSP1 ƽ̨ʼ */
+/** \brief 解除SSP1 平台初始化 */
 void amhw_plfm_ssp1_deinit (void)
 {
     amhw_power_periph_down(AMHW_POWER_SSP1);
 }
 
-/* 豸Ϣ */
+/* 设备信息 */
 aw_local aw_const struct awbl_ametal_spi_devinfo __g_ametal_ssp1_devinfo = {
     {
 		LPC17XX_SSP1_BUSID,                                   /* SPI BUS ID   */
@@ -61,7 +61,7 @@ aw_local aw_const struct awbl_ametal_spi_devinfo __g_ametal_ssp1_devinfo = {
 };
 
 
-/* 豸ʵڴ澲̬ */
+/* 设备实例内存静态分配 */
 aw_local struct awbl_ametal_spi_dev __g_ametal_ssp1_dev;
 
 
@@ -11,7 +11,7 @@
 * e-mail:      anywhere.support@zlg.cn
 *******************************************************************************/
 /*******************************************************************************
-  lpc17xx SSP2 Ϣ
+  lpc17xx SSP2 配置信息
 *******************************************************************************/
 #include "aw_int.h"
 #include "aw_spi.h"
@@ -29,10 +29,10 @@ const amdr_ssp_devinfo_t  g_ssp2_devinfo = {
     1000000                     /**< \brief speed           */
 };
 
-/** \brief SSP2 豸ʵ */
+/** \brief SSP2 设备实例 */
 amdr_ssp_dev_t            g_ssp2_dev;
 
-/** \brief SSP2 ƽ̨ʼ */
+/** \brief SSP2 平台初始化 */
 void amhw_plfm_ssp2_init (void)
 {
     amhw_power_periph_up(AMHW_POWER_SSP2);
@@ -42,13 +42,13 @@ void amhw_plfm_ssp2_init (void)
 	am_gpio_pin_cfg(PIO1_0, PIO1_0_SCK2  | PIO1_0_PULLUP);
 }
 
-/** \brief SSP2 ƽ̨ʼ */
+/** \brief 解除SSP2 平台初始化 */
 void amhw_plfm_ssp2_deinit (void)
 {
     amhw_power_periph_down(AMHW_POWER_SSP2);
 }
 
-/* 豸Ϣ */
+/* 设备信息 */
 aw_local aw_const struct awbl_ametal_spi_devinfo __g_ametal_ssp2_devinfo = {
     {
 		LPC17XX_SSP2_BUSID,                                   /* SPI BUS ID   */
@@ -60,7 +60,7 @@ aw_local aw_const struct awbl_ametal_spi_devinfo __g_ametal_ssp2_devinfo = {
 };
 
 
-/* 豸ʵڴ澲̬ */
+/* 设备实例内存静态分配 */
 aw_local struct awbl_ametal_spi_dev __g_ametal_ssp2_dev;
 
 
@@ -12,7 +12,7 @@
 *******************************************************************************/
 
 /*******************************************************************************
-    lpc5410x ׼ʱϢ
+    lpc5410x 标准定时器配置信息
 *******************************************************************************/
 
 #include "aw_int.h"
@@ -26,22 +26,22 @@
 *******************************************************************************/
 #ifdef AW_DEV_LPC17XX_TIMER0_TIMING
 
-/** \brief ʱ0豸Ϣ */
+/** \brief 定时器0设备信息 */
 const amdr_timer_timing_devinfo_t  g_timer0_timing_devinfo = {
-    AMHW_TIMER0,                /**< \brief ָʱ0Ĵָ  */
-    INUM_TIMER0,                /**< \brief ʱ0жϺ */
+    AMHW_TIMER0,                /**< \brief 指向定时器0寄存器块的指针  */
+    INUM_TIMER0,                /**< \brief 定时器0中断号 */
 };
 
-/** \brief ʱ0豸 */
+/** \brief 定时器0设备 */
 amdr_timer_timing_dev_t  g_timer0_timing_dev;
 
-/** \brief ʱ0ƽ̨ʼ */
+/** \brief 定时器0平台初始化 */
 void amhw_plfm_timer0_timing_init (void)
 {
     amhw_power_periph_up(AMHW_POWER_TIMER0);
 }
 
-/** \brief ʱ0ƽ̨ʼ */
+/** \brief 解除定时器0平台初始化 */
 void amhw_plfm_timer0_timing_deinit (void)
 {
     amhw_power_periph_down(AMHW_POWER_TIMER0);
@@ -56,12 +56,12 @@ aw_local aw_const struct awbl_ametal_timer_param __g_awbl_timer0_timing_param =
     &g_timer0_timing_dev,
     &g_timer0_timing_devinfo,
     &__g_awbl_timer0_timing_chan[0],
-    AW_HWTIMER_CHAN_ALLOC_BY_NAME(0),
+    AW_HWTIMER_CHAN_ALLOC_BY_NAME(0),     /* 留给时间戳（AW_CFG_TIMESTAMP_TIMER_UNIT） */
     (pfunc_timer_init_t)amdr_timer_timing_init,
     amhw_plfm_timer0_timing_init          /* pfunc_plfm_init */
 };
 
-/* 32 bit timer 0 豸ʵڴ澲̬ */
+/* 32 bit timer 0 设备实例内存静态分配 */
 aw_local struct awbl_ametal_timer_dev __g_awbl_timer0_timing_dev;
 
 #define AWBL_HWCONF_LPC17XX_TIMER0_TIMING   \
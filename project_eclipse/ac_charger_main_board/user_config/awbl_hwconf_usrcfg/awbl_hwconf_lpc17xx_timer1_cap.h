@@ -27,30 +27,30 @@
 
 #ifdef AW_DEV_LPC17XX_TIMER1_CAP
 
-/** \brief ʱ1ڲ IOϢ */
+/** \brief 定时器1用于捕获 IO配置信息 */
 amdr_timer_cap_ioinfo_t __g_timer1_cap_ioinfo_list[] = {
-    {PIO1_18,  PIO1_18_CAP1_0, PIO1_18_GPIO | PIO1_18_INPUT}, /**< \brief ͨ 0, IOϢ */
-    {PIO1_19,  PIO1_19_CAP1_1, PIO1_19_GPIO | PIO1_19_INPUT}, /**< \brief ͨ 1, IOϢ */
+    {PIO1_18,  PIO1_18_CAP1_0, PIO1_18_GPIO | PIO1_18_INPUT}, /**< \brief 通道 0, IO配置信息 */
+    {PIO1_19,  PIO1_19_CAP1_1, PIO1_19_GPIO | PIO1_19_INPUT}, /**< \brief 通道 1, IO配置信息 */
 };
 
-/** \brief ʱ1ڲܵ豸Ϣ */
+/** \brief 定时器1用于捕获功能的设备信息 */
 const amdr_timer_cap_devinfo_t  g_timer1_cap_devinfo = {
-    AMHW_TIMER1,               /**< \brief ָʱ1Ĵָ */
-    INUM_TIMER1,               /**< \brief ʱ1 жϱ */
-    2,                         /**< \brief 4ͨ      */
+    AMHW_TIMER1,               /**< \brief 指向定时器1寄存器块的指针 */
+    INUM_TIMER1,               /**< \brief 定时器1 中断编号 */
+    2,                         /**< \brief 4个捕获通道      */
     &__g_timer1_cap_ioinfo_list[0],
 };
 
-/** \brief ʱ1ڲܵ豸 */
+/** \brief 定时器1用于捕获功能的设备定义 */
 amdr_timer_cap_dev_t  g_timer1_cap_dev;
 
-/** \brief ʱ1ڲƽ̨ʼ */
+/** \brief 定时器1用于捕获功能平台初始化 */
 void amhw_plfm_timer1_cap_init (void)
 {
     amhw_power_periph_up(AMHW_POWER_TIMER1);
 }
 
-/** \brief ʱ1ڲƽ̨ʼ */
+/** \brief 解除定时器1用于捕获功能平台初始化 */
 void amhw_plfm_timer1_cap_deinit (void)
 {
     amhw_power_periph_down(AMHW_POWER_TIMER1);
@@ -68,7 +68,7 @@ aw_local aw_const struct awbl_ametal_cap_param __g_awbl_timer1_cap_param = {
     amhw_plfm_timer1_cap_init      /* pfunc_plfm_init */
 };
 
-/* 32 bit timer 1 豸ʵڴ澲̬ */
+/* 32 bit timer 1 设备实例内存静态分配 */
 aw_local struct awbl_ametal_cap_dev __g_awbl_timer1_cap_dev;
 
 #define AWBL_HWCONF_LPC17XX_TIMER1_CAP      \
@@ -27,30 +27,30 @@
 
 #ifdef AW_DEV_LPC17XX_TIMER2_CAP
 
-/** \brief ʱ2ڲ IOϢ */
+/** \brief 定时器2用于捕获 IO配置信息 */
 amdr_timer_cap_ioinfo_t __g_timer2_cap_ioinfo_list[] = {
-    {PIO0_4,  PIO0_4_CAP2_0, PIO0_4_GPIO | PIO0_4_INPUT}, /**< \brief ͨ 0, IOϢ */
-    {PIO0_5,  PIO0_5_CAP2_1, PIO0_5_GPIO | PIO0_5_INPUT}, /**< \brief ͨ 1, IOϢ */
+    {PIO0_4,  PIO0_4_CAP2_0, PIO0_4_GPIO | PIO0_4_INPUT}, /**< \brief 通道 0, IO配置信息 */
+    {PIO0_5,  PIO0_5_CAP2_1, PIO0_5_GPIO | PIO0_5_INPUT}, /**< \brief 通道 1, IO配置信息 */
 };
 
-/** \brief ʱ2ڲܵ豸Ϣ */
+/** \brief 定时器2用于捕获功能的设备信息 */
 const amdr_timer_cap_devinfo_t  g_timer2_cap_devinfo = {
-    AMHW_TIMER2,               /**< \brief ָʱ2Ĵָ */
-    INUM_TIMER2,               /**< \brief ʱ2 жϱ */
-    2,                         /**< \brief 3ͨ      */
+    AMHW_TIMER2,               /**< \brief 指向定时器2寄存器块的指针 */
+    INUM_TIMER2,               /**< \brief 定时器2 中断编号 */
+    2,                         /**< \brief 3个捕获通道      */
     &__g_timer2_cap_ioinfo_list[0],
 };
 
-/** \brief ʱ2ڲܵ豸 */
+/** \brief 定时器2用于捕获功能的设备定义 */
 amdr_timer_cap_dev_t  g_timer2_cap_dev;
 
-/** \brief ʱ2ڲƽ̨ʼ */
+/** \brief 定时器2用于捕获功能平台初始化 */
 void amhw_plfm_timer2_cap_init (void)
 {
     amhw_power_periph_up(AMHW_POWER_TIMER2);
 }
 
-/** \brief ʱ2ڲƽ̨ʼ */
+/** \brief 解除定时器2用于捕获功能平台初始化 */
 void amhw_plfm_timer2_cap_deinit (void)
 {
     amhw_power_periph_down(AMHW_POWER_TIMER2);
@@ -68,7 +68,7 @@ aw_local aw_const struct awbl_ametal_cap_param __g_awbl_timer2_cap_param = {
     amhw_plfm_timer2_cap_init      /* pfunc_plfm_init */
 };
 
-/* 32 bit timer 2 豸ʵڴ澲̬ */
+/* 32 bit timer 2 设备实例内存静态分配 */
 aw_local struct awbl_ametal_cap_dev __g_awbl_timer2_cap_dev;
 
 #define AWBL_HWCONF_LPC17XX_TIMER2_CAP     \
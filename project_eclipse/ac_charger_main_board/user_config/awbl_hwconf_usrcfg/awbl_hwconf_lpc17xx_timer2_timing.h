@@ -12,7 +12,7 @@
 *******************************************************************************/
 
 /*******************************************************************************
-    lpc5410x ׼ʱϢ
+    lpc5410x 标准定时器配置信息
 *******************************************************************************/
 
 #include "aw_int.h"
@@ -26,22 +26,22 @@
 *******************************************************************************/
 #ifdef AW_DEV_LPC17XX_TIMER2_TIMING
 
-/** \brief ʱ2豸Ϣ */
+/** \brief 定时器2设备信息 */
 const amdr_timer_timing_devinfo_t  g_timer2_timing_devinfo = {
-    AMHW_TIMER2,                /**< \brief ָʱ2Ĵָ  */
-    INUM_TIMER2,                /**< \brief ʱ2жϺ */
+    AMHW_TIMER2,                /**< \brief 指向定时器2寄存器块的指针  */
+    INUM_TIMER2,                /**< \brief 定时器2中断号 */
 };
 
-/** \brief ʱ2豸 */
+/** \brief 定时器2设备 */
 amdr_timer_timing_dev_t  g_timer2_timing_dev;
 
-/** \brief ʱ2ƽ̨ʼ */
+/** \brief 定时器2平台初始化 */
 void amhw_plfm_timer2_timing_init (void)
 {
     amhw_power_periph_up(AMHW_POWER_TIMER2);
 }
 
-/** \brief ʱ2ƽ̨ʼ */
+/** \brief 解除定时器2平台初始化 */
 void amhw_plfm_timer2_timing_deinit (void)
 {
     amhw_power_periph_down(AMHW_POWER_TIMER2);
@@ -61,7 +61,7 @@ aw_local aw_const struct awbl_ametal_timer_param __g_awbl_timer2_timing_param =
     amhw_plfm_timer2_timing_init          /* pfunc_plfm_init */
 };
 
-/* 32 bit timer 2 豸ʵڴ澲̬ */
+/* 32 bit timer 2 设备实例内存静态分配 */
 aw_local struct awbl_ametal_timer_dev __g_awbl_timer2_timing_dev;
 
 #define AWBL_HWCONF_LPC17XX_TIMER2_TIMING   \
@@ -27,30 +27,30 @@
 
 #ifdef AW_DEV_LPC17XX_TIMER3_CAP
 
-/** \brief ʱ1ڲ IOϢ */
+/** \brief 定时器1用于捕获 IO配置信息 */
 amdr_timer_cap_ioinfo_t __g_timer3_cap_ioinfo_list[] = {
-    {PIO0_23,  PIO0_23_CAP3_0, PIO0_23_GPIO | PIO0_23_INPUT}, /**< \brief ͨ 0, IOϢ */
-    {PIO0_24,  PIO0_24_CAP3_1, PIO0_24_GPIO | PIO0_24_INPUT}, /**< \brief ͨ 1, IOϢ */
+    {PIO0_23,  PIO0_23_CAP3_0, PIO0_23_GPIO | PIO0_23_INPUT}, /**< \brief 通道 0, IO配置信息 */
+    {PIO0_24,  PIO0_24_CAP3_1, PIO0_24_GPIO | PIO0_24_INPUT}, /**< \brief 通道 1, IO配置信息 */
 };
 
-/** \brief ʱ3ڲܵ豸Ϣ */
+/** \brief 定时器3用于捕获功能的设备信息 */
 const amdr_timer_cap_devinfo_t  g_timer3_cap_devinfo = {
-    AMHW_TIMER3,               /**< \brief ָʱ3Ĵָ */
-    INUM_TIMER3,               /**< \brief ʱ3 жϱ */
-    1,                         /**< \brief 1ͨ      */
+    AMHW_TIMER3,               /**< \brief 指向定时器3寄存器块的指针 */
+    INUM_TIMER3,               /**< \brief 定时器3 中断编号 */
+    1,                         /**< \brief 1个捕获通道      */
     &__g_timer3_cap_ioinfo_list[0],
 };
 
-/** \brief ʱ3ڲܵ豸 */
+/** \brief 定时器3用于捕获功能的设备定义 */
 amdr_timer_cap_dev_t  g_timer3_cap_dev;
 
-/** \brief ʱ3ڲƽ̨ʼ */
+/** \brief 定时器3用于捕获功能平台初始化 */
 void amhw_plfm_timer3_cap_init (void)
 {
     amhw_power_periph_up(AMHW_POWER_TIMER3);
 }
 
-/** \brief ʱ3ڲƽ̨ʼ */
+/** \brief 解除定时器3用于捕获功能平台初始化 */
 void amhw_plfm_timer3_cap_deinit (void)
 {
     amhw_power_periph_down(AMHW_POWER_TIMER3);
@@ -68,7 +68,7 @@ aw_local aw_const struct awbl_ametal_cap_param __g_awbl_timer3_cap_param = {
     amhw_plfm_timer3_cap_init      /* pfunc_plfm_init */
 };
 
-/* 32 bit timer 1 豸ʵڴ澲̬ */
+/* 32 bit timer 1 设备实例内存静态分配 */
 aw_local struct awbl_ametal_cap_dev __g_awbl_timer3_cap_dev;
 
 #define AWBL_HWCONF_LPC17XX_TIMER3_CAP      \
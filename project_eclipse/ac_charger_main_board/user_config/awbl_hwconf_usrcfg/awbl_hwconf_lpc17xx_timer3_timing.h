@@ -12,7 +12,7 @@
 *******************************************************************************/
 
 /*******************************************************************************
-    lpc5410x ׼ʱϢ
+    lpc5410x 标准定时器配置信息
 *******************************************************************************/
 
 #include "aw_int.h"
@@ -26,22 +26,22 @@
 *******************************************************************************/
 #ifdef AW_DEV_LPC17XX_TIMER3_TIMING
 
-/** \brief ʱ3豸Ϣ */
+/** \brief 定时器3设备信息 */
 const amdr_timer_timing_devinfo_t  g_timer3_timing_devinfo = {
-    AMHW_TIMER3,                /**< \brief ָʱ3Ĵָ  */
-    INUM_TIMER3,                /**< \brief ʱ3жϺ */
+    AMHW_TIMER3,                /**< \brief 指向定时器3寄存器块的指针  */
+    INUM_TIMER3,                /**< \brief 定时器3中断号 */
 };
 
-/** \brief ʱ3豸 */
+/** \brief 定时器3设备 */
 amdr_timer_timing_dev_t  g_timer3_timing_dev;
 
-/** \brief ʱ3ƽ̨ʼ */
+/** \brief 定时器3平台初始化 */
 void amhw_plfm_timer3_timing_init (void)
 {
     amhw_power_periph_up(AMHW_POWER_TIMER3);
 }
 
-/** \brief ʱ3ƽ̨ʼ */
+/** \brief 解除定时器3平台初始化 */
 void amhw_plfm_timer3_timing_deinit (void)
 {
     amhw_power_periph_down(AMHW_POWER_TIMER3);
@@ -61,7 +61,7 @@ aw_local aw_const struct awbl_ametal_timer_param __g_awbl_timer3_timing_param =
     amhw_plfm_timer3_timing_init          /* pfunc_plfm_init */
 };
 
-/* 32 bit timer 3 豸ʵڴ澲̬ */
+/* 32 bit timer 3 设备实例内存静态分配 */
 aw_local struct awbl_ametal_timer_dev __g_awbl_timer3_timing_dev;
 
 #define AWBL_HWCONF_LPC17XX_TIMER3_TIMING   \
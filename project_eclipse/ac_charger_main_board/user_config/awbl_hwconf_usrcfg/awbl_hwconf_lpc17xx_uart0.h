@@ -21,14 +21,14 @@
 
 
 /*******************************************************************************
-    UART 0 Ϣ
+    UART 0 配置信息
 *******************************************************************************/
 #ifdef AW_DEV_LPC17XX_UART0
 
 static struct aw_delayed_work g_dir_clr_work;
-#define       UART_RS485_DIR_DLY   20         /* ʱ */
+#define       UART_RS485_DIR_DLY   20         /* 方向控制延时 */
 /**
- * Ȩ޲ʱ
+ * 鉴权后无操作超时检测任务
  */
 static void dir_clr_work (void *p_arg)
 {
@@ -36,7 +36,7 @@ static void dir_clr_work (void *p_arg)
     aw_gpio_set(PIO4_3, p_info->rs485_ctrl & AMHW_USART_RS485_OINV1 ? 0 : 1);
 }
 /**
-  * \brief ʱ
+  * \brief 重新启动超时检测
   */
 //static
 void dir_clr_work_restart()
@@ -59,30 +59,30 @@ aw_local void __lpc17xx_uart0_rs485_dir (uint8_t dir)
 /** \brief The USART0 device information */
 const amdr_usart_devinfo_t g_usart0_devinfo = {
 
-	AMHW_USART0,                    /**< \brief ָUSART0Ĵָ         */
-	INUM_UART0,                     /**< \brief USART0жϺ                      */
+	AMHW_USART0,                    /**< \brief 指向USART0寄存器块的指针         */
+	INUM_UART0,                     /**< \brief USART0中断号                      */
 
-	AMHW_USART_LCR_8BIT      |      /**< \brief 8-bitλ                      */
-	AMHW_USART_LCR_PARITY_NO |      /**< \brief У                                   */
-	AMHW_USART_LCR_STOP_1,          /**< \brief 1-bitֹͣλ                      */
+	AMHW_USART_LCR_8BIT      |      /**< \brief 8-bit数据位                      */
+	AMHW_USART_LCR_PARITY_NO |      /**< \brief 无校验                                   */
+	AMHW_USART_LCR_STOP_1,          /**< \brief 1-bit停止位                      */
 
-	0,                              /**< \brief ޿Ʊ־                       */
+	0,                              /**< \brief 无控制标志                       */
 
-	115200,                         /**< \brief                            */
+	115200,                         /**< \brief 波特率                           */
 
-	AMHW_USART_RX_TRILEVEL3,        /**< \brief FIFOΪ314ֽڴ  */
+	AMHW_USART_RX_TRILEVEL3,        /**< \brief FIFO触发级别为3（14个字节触发）  */
 
-	15,                             /**< \brief FIFOСΪ15Byte ʹRS485ʱ
-                                                MCU485ҪFIFOΪ15  */
-    AMHW_USART_RS485_OINV0,         /* ߼Ϊ1 */
+	15,                             /**< \brief FIFO大小为15Byte， 使用RS485时，
+                                                MCU上485互发则需要将FIFO设置为15  */
+    AMHW_USART_RS485_OINV0,         /* 驱动逻辑为1 */
 
-    UART_RS485_DIR_DLY,             /**< \brief RS485ʱʱ  */
+    UART_RS485_DIR_DLY,             /**< \brief RS485方向控制延时时间  */
 
-	__lpc17xx_uart0_rs485_dir,      /**< \brief GPIOģRS485ƹܽŷӿ */
+	__lpc17xx_uart0_rs485_dir,      /**< \brief GPIO模拟RS485控制管脚方向接口 */
 
-	0,                              /**< \brief Ӳƹ  */
+	0,                              /**< \brief 无硬件流控制功能  */
 
-	0,                              /**< \brief ж                       */
+	0,                              /**< \brief 无其他中断                       */
 };
 
 amdr_usart_dev_t  g_usart0_dev;     /**< \brief define space for USART0          */
@@ -99,11 +99,11 @@ void amhw_plfm_usart0_init (void)
     /* Configure the PIO0_3 operate as UART0_RXD */
     am_gpio_pin_cfg(PIO0_1, PIO0_1_RXD0 | AM_GPIO_PULLUP);
 
-#if 0  /* ӲRS485zʱ¹ܽ */
+#if 0  /* 硬件RS485z控制时，配置以下管脚 */
     /* Configure the PIO5_4 operate as RS485 UART0 OE */
     am_gpio_pin_cfg(PIO5_4, PIO5_4_OE0);
 #else
-    /* GPIO ģRS485ʱ¹ܽ */
+    /* GPIO 模拟RS485方向脚时，配置以下管脚 */
     am_gpio_pin_cfg(PIO4_3, AM_GPIO_OUTPUT_INIT_HIGH | AM_GPIO_PULLUP);
     aw_gpio_set(PIO4_3, 1);
     aw_delayed_work_init(&g_dir_clr_work,
@@ -120,7 +120,7 @@ void amhw_plfm_usart0_deinit (void)
     amhw_power_periph_down(AMHW_POWER_UART0);
 }
 
-/* UART 0 豸Ϣ */
+/* UART 0 设备信息 */
 aw_local aw_const struct awbl_ametal_uart_param __g_ametal_uart0_info = {
     &g_usart0_dev,
     &g_usart0_devinfo,                  /* The hardware device information  */
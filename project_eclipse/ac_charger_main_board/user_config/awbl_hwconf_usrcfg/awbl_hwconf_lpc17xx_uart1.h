@@ -20,23 +20,23 @@
 #include "aw_delayed_work.h"
 
 /*******************************************************************************
-    UART 1 Ϣ
+    UART 1 配置信息
 *******************************************************************************/
 
 #ifdef AW_DEV_LPC17XX_UART1
 
 static struct aw_delayed_work g_uart1_dir_clr_work;
-#define       UART1_RS485_DIR_DLY   10              /* ʱ */
+#define       UART1_RS485_DIR_DLY   10              /* 方向控制延时 */
 #define       UART1_RS485_DIR_PIN   PIO4_8
 /**
- * Ȩ޲ʱ
+ * 鉴权后无操作超时检测任务
  */
 static void uart1_dir_clr_work (void *p_arg)
 {
     aw_gpio_set(UART1_RS485_DIR_PIN, p_arg ? 1 : 0);
 }
 /**
-  * \brief ʱ
+  * \brief 重新启动超时检测
   */
 static void uart1_dir_clr_work_restart()
 {
@@ -58,35 +58,35 @@ aw_local void __lpc17xx_uart1_rs485_dir (uint8_t dir)
 /** \brief The USART1 device information */
 const amdr_usart_devinfo_t g_usart1_devinfo = {
 
-	AMHW_USART1,                    /**< \brief ָUSART1Ĵָ         */
-	INUM_UART1,                     /**< \brief USART1жϺ                     */
+	AMHW_USART1,                    /**< \brief 指向USART1寄存器块的指针         */
+	INUM_UART1,                     /**< \brief USART1中断号                     */
 
-	AMHW_USART_LCR_8BIT      |      /**< \brief 8-bitλ                      */
-	AMHW_USART_LCR_PARITY_NO |      /**< \brief У                           */
-	AMHW_USART_LCR_STOP_1,          /**< \brief 1-bitֹͣλ                      */
+	AMHW_USART_LCR_8BIT      |      /**< \brief 8-bit数据位                      */
+	AMHW_USART_LCR_PARITY_NO |      /**< \brief 无校验                           */
+	AMHW_USART_LCR_STOP_1,          /**< \brief 1-bit停止位                      */
 
-	0,                              /**< \brief ޿Ʊ־                       */
+	0,                              /**< \brief 无控制标志                       */
 
-	115200,                         /**< \brief                            */
+	115200,                         /**< \brief 波特率                           */
 
-	AMHW_USART_RX_TRILEVEL0,        /**< \brief FIFOΪ314ֽڴ  */
+	AMHW_USART_RX_TRILEVEL0,        /**< \brief FIFO触发级别为3（14个字节触发）  */
 
-	15,                             /**< \brief FIFOСΪ15Byte ʹRS485ʱ
-                                                MCU485ҪFIFOΪ15  */
+	15,                             /**< \brief FIFO大小为15Byte， 使用RS485时，
+                                                MCU上485互发则需要将FIFO设置为15  */
 
-	AMHW_USART_RS485_OINV0,         /* ߼Ϊ0òΪӲRS485ƣ
-                                                                                                  ʹGPIOģ485ƹܽţڴ˴߼*/
+	AMHW_USART_RS485_OINV0,         /* 驱动逻辑为0，该参数配置为硬件RS485控制，
+                                                                                                  若使用GPIO模拟485控制管脚，亦可在此处配置驱动逻辑*/
 
-	UART1_RS485_DIR_DLY,             /**< \brief RS485ʱʱ  */
+	UART1_RS485_DIR_DLY,             /**< \brief RS485方向控制延时时间  */
 
-	__lpc17xx_uart1_rs485_dir,      /**< \brief GPIOģRS485ƹܽŷӿ */
+	__lpc17xx_uart1_rs485_dir,      /**< \brief GPIO模拟RS485控制管脚方向接口 */
 
-	AMHW_USART_MCR_RTS   |          /**< \brief ӲϢ  */
+	AMHW_USART_MCR_RTS   |          /**< \brief 硬件流配置信息  */
 	AMHW_USART_MCR_RTSEN |
 	AMHW_USART_MCR_CTSEN,
 
 
-	0,                              /**< \brief ж                       */
+	0,                              /**< \brief 无其他中断                       */
 };
 
 amdr_usart_dev_t  g_usart1_dev;     /**< \brief define space for USART1          */
@@ -103,11 +103,11 @@ void amhw_plfm_usart1_init (void)
 	/* Configure the PIO0_16 operate as UART1_RXD */
     am_gpio_pin_cfg(PIO0_16,PIO0_16_RXD1 | AM_GPIO_PULLUP);
 
-#if 0  /* ӲRS485zʱ¹ܽ */
+#if 0  /* 硬件RS485z控制时，配置以下管脚 */
     /* RTS1(OE) */
 //    am_gpio_pin_cfg(PIO0_22, PIO0_22_RTS1);
 #else
-    /* GPIO ģRS485ʱ¹ܽ */
+    /* GPIO 模拟RS485方向脚时，配置以下管脚 */
     am_gpio_pin_cfg(UART1_RS485_DIR_PIN, AM_GPIO_OUTPUT_INIT_LOW);
     aw_gpio_set(UART1_RS485_DIR_PIN, 0);
     aw_delayed_work_init(&g_uart1_dir_clr_work,
@@ -128,7 +128,7 @@ void amhw_plfm_usart1_deinit (void)
     amhw_power_periph_down(AMHW_POWER_UART1);
 }
 
-/* UART 1 豸Ϣ */
+/* UART 1 设备信息 */
 aw_local aw_const struct awbl_ametal_uart_param __g_ametal_uart1_info = {
     &g_usart1_dev,
     &g_usart1_devinfo,                  /* The hardware device information  */
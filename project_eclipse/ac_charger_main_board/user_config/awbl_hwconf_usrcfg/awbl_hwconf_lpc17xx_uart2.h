@@ -19,7 +19,7 @@
 #include "ametal.h"
 
 /*******************************************************************************
-    UART 2 Ϣ
+    UART 2 配置信息
 *******************************************************************************/
 
 #ifdef AW_DEV_LPC17XX_UART2
@@ -43,19 +43,19 @@ const amdr_usart_devinfo_t g_usart2_devinfo = {
 
     115200,                         /**< \brief The baud rate to set             */
     
-    AMHW_USART_RX_TRILEVEL0,        /**< \brief FIFOΪ314ֽڴ  */
+    AMHW_USART_RX_TRILEVEL0,        /**< \brief FIFO触发级别为3（14个字节触发）  */
 
-    1,                             /**< \brief FIFOСΪ15Byte ʹRS485ʱ
-                                                MCU485ҪFIFOΪ15  */
+    1,                             /**< \brief FIFO大小为15Byte， 使用RS485时，
+                                                MCU上485互发则需要将FIFO设置为15  */
 
-	AMHW_USART_RS485_OINV0,         /* ߼Ϊ0òΪӲRS485ƣ
-	                                                                                        ʹGPIOģ485ƹܽţڴ˴߼*/
+	AMHW_USART_RS485_OINV0,         /* 驱动逻辑为0，该参数配置为硬件RS485控制，
+	                                                                                        若使用GPIO模拟485控制管脚，亦可在此处配置驱动逻辑*/
 
-	20,                             /**< \brief RS485ʱʱ  */
+	20,                             /**< \brief RS485方向控制延时时间  */
 
-	__lpc17xx_uart2_rs485_dir,      /**< \brief GPIOģRS485ƹܽŷӿ */
+	__lpc17xx_uart2_rs485_dir,      /**< \brief GPIO模拟RS485控制管脚方向接口 */
 
-	0,                              /**< \brief Ӳ  */
+	0,                              /**< \brief 无硬件流控制  */
 
     0,                              /**< \brief No other interrupt need          */
 };
@@ -74,10 +74,10 @@ void amhw_plfm_usart2_init (void)
 	  /* Configure the PIO2_9 operate as UART2_RXD */
     am_gpio_pin_cfg(PIO2_9,PIO2_9_RXD2 | AM_GPIO_PULLUP);
 
-#if 0  /* ӲRS485zʱ¹ܽ */
+#if 0  /* 硬件RS485z控制时，配置以下管脚 */
     /* Configure the PIO2_6 operate as UART1 RS485 RTS1(OE) */
     am_gpio_pin_cfg(PIO2_6,PIO2_6_OE2);
-#else  /* GPIO ģRS485ʱ¹ܽ */
+#else  /* GPIO 模拟RS485方向脚时，配置以下管脚 */
     am_gpio_pin_cfg(PIO4_9, AM_GPIO_OUTPUT_INIT_HIGH);
     aw_gpio_set(PIO4_9, 1);
 #endif
@@ -89,7 +89,7 @@ void amhw_plfm_usart2_deinit (void)
     amhw_power_periph_down(AMHW_POWER_UART2);
 }
 
-/* UART 2 豸Ϣ */
+/* UART 2 设备信息 */
 aw_local aw_const struct awbl_ametal_uart_param __g_ametal_uart2_info = {
     &g_usart2_dev,
     &g_usart2_devinfo,                  /* The hardware device information  */
@@ -19,7 +19,7 @@
 #include "ametal.h"
 
 /*******************************************************************************
-    UART 4 Ϣ
+    UART 4 配置信息
 *******************************************************************************/
 
 #ifdef AW_DEV_LPC17XX_UART4
@@ -32,30 +32,30 @@ aw_local void __lpc17xx_uart4_rs485_dir (uint8_t dir)
 /** \brief The USART4 device information */
 const amdr_usart_devinfo_t g_usart4_devinfo = {
 
-	AMHW_USART4,                    /**< \brief ָUSART4Ĵָ         */
-	INUM_UART4,                     /**< \brief USART4жϺ                     */
+	AMHW_USART4,                    /**< \brief 指向USART4寄存器块的指针         */
+	INUM_UART4,                     /**< \brief USART4中断号                     */
 
-	AMHW_USART_LCR_8BIT      |      /**< \brief 8-bitλ                      */
-	AMHW_USART_LCR_PARITY_NO |      /**< \brief У                           */
-	AMHW_USART_LCR_STOP_1,          /**< \brief 1-bitֹͣλ                      */
+	AMHW_USART_LCR_8BIT      |      /**< \brief 8-bit数据位                      */
+	AMHW_USART_LCR_PARITY_NO |      /**< \brief 无校验                           */
+	AMHW_USART_LCR_STOP_1,          /**< \brief 1-bit停止位                      */
 
-	0,                              /**< \brief ޿Ʊ־                       */
+	0,                              /**< \brief 无控制标志                       */
 
-	115200,                         /**< \brief                            */
+	115200,                         /**< \brief 波特率                           */
 
-	AMHW_USART_RX_TRILEVEL0,        /**< \brief FIFOΪ314ֽڴ  */
+	AMHW_USART_RX_TRILEVEL0,        /**< \brief FIFO触发级别为3（14个字节触发）  */
 
-	15,                             /**< \brief FIFOСΪ16Byte  */
+	15,                             /**< \brief FIFO大小为16Byte  */
 
-	AMHW_USART_RS485_OINV0,         /* ߼Ϊ1 */
+	AMHW_USART_RS485_OINV0,         /* 驱动逻辑为1 */
 
-	20,                             /**< \brief RS485ʱʱ  */
+	20,                             /**< \brief RS485方向控制延时时间  */
 
-	__lpc17xx_uart4_rs485_dir,      /**< \brief GPIOģRS485ƹܽŷӿ */
+	__lpc17xx_uart4_rs485_dir,      /**< \brief GPIO模拟RS485控制管脚方向接口 */
 
-	0,                              /**< \brief Ӳ  */
+	0,                              /**< \brief 无硬件流控制  */
 
-	0,                              /**< \brief ж                       */
+	0,                              /**< \brief 无其他中断                       */
 };
 
 amdr_usart_dev_t  g_usart4_dev;     /**< \brief define space for USART4          */
@@ -66,17 +66,17 @@ void amhw_plfm_usart4_init (void)
 	  /* Power up the peripheral UART4 */
     amhw_power_periph_up(AMHW_POWER_UART4);
 
-    /*  UART4_TXDܽ */
+    /* 配置 UART4_TXD管脚 */
     am_gpio_pin_cfg(PIO1_29, PIO1_29_TXD4 | AM_GPIO_PULLUP);
 
-    /*  UART4_RXDܽ */
+    /* 配置 UART4_RXD管脚 */
     am_gpio_pin_cfg(PIO5_3, PIO5_3_RXD4 | AM_GPIO_PULLUP);
 #if 0
-    /*  UART4 OEܽ */
+    /* 配置 UART4 OE管脚 */
     am_gpio_pin_cfg(PIO0_21, PIO0_21_OE4);
 #else
-    /* GPIO ģRS485ʱ¹ܽ */
-    /*  UART4 OEܽ */
+    /* GPIO 模拟RS485方向脚时，配置以下管脚 */
+    /* 配置 UART4 OE管脚 */
     am_gpio_pin_cfg(PIO3_23, AM_GPIO_OUTPUT_INIT_HIGH);
 //    aw_gpio_set(PIO3_23, 1);
 #endif
@@ -88,7 +88,7 @@ void amhw_plfm_usart4_deinit (void)
     amhw_power_periph_down(AMHW_POWER_UART4);
 }
 
-/* UART 4 豸Ϣ */
+/* UART 4 设备信息 */
 aw_local aw_const struct awbl_ametal_uart_param __g_ametal_uart4_info = {
     &g_usart4_dev,
     &g_usart4_devinfo,                  /* The hardware device information  */
@@ -12,7 +12,7 @@
 *******************************************************************************/
 
 /*******************************************************************************
- DMAϢ
+ DMA控制器配置信息
 *******************************************************************************/
 #ifdef AW_DEV_LPC17XX_USBD
 
@@ -25,39 +25,39 @@
 #define __OTG_CLK_EN        (1 << 3)
 #define __AHB_CLK_EN        (1 << 4)
 
-/* USBDؼĴ  */
+/* USBD相关寄存器  */
 #ifdef AW_LPC177X_8X
-/** \brief USBD豸ַ  */
+/** \brief USBD设备基址  */
 #define __USBD_REGADDR_BASE   (0x2008C200UL)
 
-/** \brief USB˿ѡĴ  */
+/** \brief USB端口选择寄存器  */
 #define __USB_PORTSEL_REG    (*(volatile uint32_t *)(0x2008C110))
 
-/** \brief USBʱӿƼĴ */
+/** \brief USB时钟控制寄存器 */
 #define __USB_CLK_CTRL_REG   (*(volatile uint32_t *)(0x2008CFF4))
 
-/** \brief USBʱ״̬Ĵ */
+/** \brief USB时钟状态寄存器 */
 #define __USB_CLK_ST_REG     (*(volatile uint32_t *)(0x2008CFF8))
 
 #else
 #define __USBD_REGADDR_BASE   (0x5000C200UL)
 
-/** \brief USBʱӿƼĴ */
+/** \brief USB时钟控制寄存器 */
 #define __USB_CLK_CTRL_REG   (*(volatile uint32_t *)(0x5000CFF4))
 
-/** \brief USBʱ״̬Ĵ */
+/** \brief USB时钟状态寄存器 */
 #define __USB_CLK_ST_REG     (*(volatile uint32_t *)(0x5000CFF8))
 
 #endif
 
-/** \brief DMAĿ  */
+/** \brief DMA描述符数目  */
 #define __USBD_DMA_DESC_NUM  8
 
-/** \brief ʹõ˵  */
+/** \brief 使用的物理端点个数  */
 #define __USED_EP_NUM        10
 
 /**
- * \brief USB Deviceƽ̨ʼ
+ * \brief USB Device平台初始化
  */
 void amhw_plfm_usbd_init (void)
 {
@@ -66,13 +66,13 @@ void amhw_plfm_usbd_init (void)
     uint32_t clkctrl = __DEV_CLK_EN     | __I2C_CLK_EN | \
                        __PORTSEL_CLK_EN | __AHB_CLK_EN;
 
-    /* ʹPLL1ΪUSBʱ, USBʱӲƵ */
+    /* 使用PLL1作为USB时钟, USB时钟不分频 */
     amhw_clock_usbclk_set(AMHW_CLOCK_USBSRC_PLL1, 1);
 
-    /* PLL148Mʱ  */
+    /* PLL1输出48M时钟  */
     amhw_pll1_config(48000000);
 
-    /* SmartM31788Ӳй  */
+    /* 跟SmartM31788硬件设计有关  */
     am_gpio_pin_cfg(PIO2_0, AM_GPIO_OUTPUT_INIT_LOW);
 
     amhw_power_periph_up(AMHW_POWER_USB);
@@ -81,7 +81,7 @@ void amhw_plfm_usbd_init (void)
 
     while ((__USB_CLK_ST_REG & clkctrl) != clkctrl);
 
-    __USB_PORTSEL_REG &= ~0x03;   /* USB˿ѡ0 */
+    __USB_PORTSEL_REG &= ~0x03;   /* USB端口选择0 */
 
     __USB_CLK_CTRL_REG &= ~__PORTSEL_CLK_EN;
 
@@ -99,13 +99,13 @@ void amhw_plfm_usbd_init (void)
 
     uint32_t clkctrl = __DEV_CLK_EN | __AHB_CLK_EN;
 
-    /* PLLʱ 48MHz */
+    /* PLL时钟配置 48MHz */
     amhw_pll1_config();
 
-    /* USBʹ */
+    /* USB使能 */
     amhw_power_periph_up(AMHW_POWER_USB);
 
-    /* ʹUSB豸ʱ */
+    /* 使能USB设备时钟 */
     __USB_CLK_CTRL_REG = clkctrl;
     while ((__USB_CLK_ST_REG & clkctrl) != clkctrl);
 
@@ -118,37 +118,37 @@ void amhw_plfm_usbd_init (void)
 }
 
 /**
- * \brief USB Deviceƽ̨ȥʼ
+ * \brief USB Device平台去初始化。
  */
 void amhw_plfm_usbd_deinit (void)
 {
     amhw_power_periph_down(AMHW_POWER_USB);
 }
 
-/* DMA RAM (128ֽڶ)ƬRAM  */
+/* 开辟DMA RAM (必须128字节对齐)，存放在片上RAM  */
 static uint32_t g_udca[32] __attribute__((aligned(128))) \
                            __attribute__((section(".ahb_bss")));
 
-/* DMAƬRAM   */
+/* 定义DMA描述符，存放在片上RAM   */
 struct awbl_lpc17xx_usbd_dma_desc g_usbd_dma_desc[__USBD_DMA_DESC_NUM] \
     __attribute__((aligned(4))) __attribute__((section(".ahb_bss")));
 
-/* 豸Ϣ */
+/* 设备信息 */
 aw_local aw_const struct awbl_lpc17xx_usbd_info __g_lpc17xx_usbd_info = {
     {
         "/dev/usbd0",
         AWBL_USBD_CFG_SELF_POWERED
-    },                                 /* USB豸Ϣ               */
-    __USBD_REGADDR_BASE,               /* USB豸Ĵַ         */
-    INUM_USB,                          /* USBжϱ         */
-    (void *)&g_udca[0],                /* USB豸ͨ       */
-    __USED_EP_NUM,                     /* ʹõ˵       */
-    g_usbd_dma_desc,                   /* DMA         */
-    __USBD_DMA_DESC_NUM,               /* DMAĿ         */
-    amhw_plfm_usbd_init                /* USB豸 ƽ̨سʼ */
+    },                                 /* USB设备信息               */
+    __USBD_REGADDR_BASE,               /* USB设备寄存器基地址         */
+    INUM_USB,                          /* USB中断编号         */
+    (void *)&g_udca[0],                /* USB设备通信域       */
+    __USED_EP_NUM,                     /* 使用的物理端点数       */
+    g_usbd_dma_desc,                   /* DMA描述符         */
+    __USBD_DMA_DESC_NUM,               /* DMA描述符数目         */
+    amhw_plfm_usbd_init                /* USB设备 平台相关初始化函数 */
 };
 
-/* 豸ʵڴ澲̬ */
+/* 设备实例内存静态分配 */
 aw_local struct awbl_lpc17xx_usbd __g_lpc17xx_usbd_dev __attribute__((section(".ahb_bss")));
 
 #define AWBL_HWCONF_LPC17XX_USBD                       \
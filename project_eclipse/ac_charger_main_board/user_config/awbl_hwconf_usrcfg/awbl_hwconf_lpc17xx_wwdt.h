@@ -13,25 +13,25 @@
 
 #ifdef AW_DEV_LPC17XX_WDT
 
-/** \brief WWDT 豸Ϣ */
+/** \brief WWDT 设备信息 */
 const amdr_wwdt_devinfo_t  g_wwdt_devinfo = {
-    AMHW_WWDT,       /* ָWWDTĴָ */
+    AMHW_WWDT,       /* 指向WWDT寄存器块的指针 */
 };
 
-/** \brief WWDT豸ʵ  */
+/** \brief WWDT设备实例  */
 amdr_wwdt_dev_t            g_wwdt_dev;
 
-/** \brief WWDT ƽ̨ʼ */
+/** \brief WWDT 平台初始化 */
 void amhw_plfm_wwdt_init (void)
 {
 }
 
-/** \brief WWDT ƽ̨ʼ */
+/** \brief 解除WWDT 平台初始化 */
 void amhw_plfm_wwdt_deinit (void)
 {
 }
 
-/* 豸Ϣ */
+/* 设备信息 */
 aw_local aw_const struct awbl_ametal_wdt_param  __g_ametal_wdt_param = {
     1000,                           /* The time out is 12s  */
     &g_wwdt_dev,
@@ -40,7 +40,7 @@ aw_local aw_const struct awbl_ametal_wdt_param  __g_ametal_wdt_param = {
     amhw_plfm_wwdt_init,
 };
 
-/* 豸ʵڴ澲̬ */
+/* 设备实例内存静态分配 */
 aw_local struct awbl_ametal_wdt_dev __g_ametal_wdt_dev;
 
 #define AWBL_HWCONF_LPC17XX_WDT    \
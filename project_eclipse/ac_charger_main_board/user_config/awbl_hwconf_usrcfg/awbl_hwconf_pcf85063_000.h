@@ -12,7 +12,7 @@
 *******************************************************************************/
 
 /*******************************************************************************
-  RTC PCF85063 0 Ϣ
+  RTC PCF85063 0 配置信息
 *******************************************************************************/
 #define AW_DRV_AWBL_PCF85063
 #ifdef AW_DRV_AWBL_PCF85063
@@ -24,15 +24,15 @@
  * @{
  */
 
-/* PCF85063 豸Ϣ */
+/* PCF85063 设备信息 */
 aw_local aw_const struct awbl_pcf85063_devinfo __g_pcf85063_0_devinfo = {
     {
-        1     /* RTC 豸 */
+        1     /* RTC 设备编号 */
     },
-    0xA2                    /* I2C ӻַ */
+    0xA2                    /* I2C 从机地址 */
 };
 
-/* PCF85063 豸ʵڴ澲̬ */
+/* PCF85063 设备实例内存静态分配 */
 aw_local struct awbl_pcf85063_dev __g_pcf85063_0_dev;
 
 #define AWBL_HWCONF_PCF85063_0   \
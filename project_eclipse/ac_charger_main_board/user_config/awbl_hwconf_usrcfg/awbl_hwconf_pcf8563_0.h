@@ -13,7 +13,7 @@
 
 /** 
  * \file 
- * \brief RTC PCF8563 ļ
+ * \brief RTC PCF8563 配置文件
  * 
  * \par
  * \internal 
@@ -31,15 +31,15 @@
  * @{
  */
 
-/* PCF8563 豸Ϣ */
+/* PCF8563 设备信息 */
 aw_local aw_const struct awbl_pcf8563_devinfo __g_pcf8563_0_devinfo = {
     {
-        2     /* RTC 豸 */
+        2     /* RTC 设备编号 */
     },
-    0xA2      /* I2C ӻַ */
+    0xA2      /* I2C 从机地址 */
 };
 
-/* PCF8563 豸ʵڴ澲̬ */
+/* PCF8563 设备实例内存静态分配 */
 aw_local struct awbl_pcf8563_dev __g_pcf8563_0_dev;
 
 #define AWBL_HWCONF_PCF8563_0   \
@@ -19,9 +19,9 @@
 #include "driver/buzzer/awbl_buzzer_pwm.h"
 
 aw_local aw_const awbl_pwm_buzzer_param_t __g_pwm_buzzer_param = {
-    10,           /* PWMͨID */
-    1000000,      /* PWM(λ: ) */
-    80            /* ʼ 80% */
+    10,           /* PWM通道ID */
+    1000000,      /* PWM波形输出周期(单位: 纳秒) */
+    80            /* 初始响度 80% */
 };
 
 aw_local awbl_pwm_buzzer_t __g_pwm_buzzer;
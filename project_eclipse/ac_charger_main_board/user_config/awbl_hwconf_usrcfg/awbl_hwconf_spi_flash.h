@@ -23,18 +23,20 @@
 #include "boot/boot_cfg.h"
 
 aw_local struct awbl_nvram_segment __g_spiflash_seglst[] = {
-    /* 洢, Ԫ, ʼַ */
+    /* 存储段名称, 单元号, 起始地址，长度 */
     {"spi_flash_nvram",  0, 0, 2*1024*1024},
 
-    /* 洢, Ԫ, ʼַ */
+    /* 存储段名称, 单元号, 起始地址，长度 */
     {"spi_flash_nvram",  0, 0, 2*1024*1024},
     {LPC1778_IMAGE_NAME,  0,  LPC1778_IMAGE_ADDR,  LPC1778_IMAGE_SIZE},
     {LPC1778_UPDATE_IMAGE_VALID,  0,  LPC1778_UPDATE_IMAGE_ADDR,  LPC1778_UPDATE_IMAGE_SIZE},
     {LPC1778_IMAGE_VALID, 0, LPC1778_IMAGE_VALID_ADDR, LPC1778_IMAGE_VALID_SIZE},
     {INTO_UPDATE_FLAG, 0, INTO_UPDATE_FLAG_ADDR, INTO_UPDATE_FLAG_SIZE},
+    {CARD_WL_NVRAM_NAME, 0, CARD_WL_NVRAM_ADDR, CARD_WL_NVRAM_SIZE},
+    {BLACKBOX_NVRAM_NAME, 0, BLACKBOX_NVRAM_ADDR, BLACKBOX_NVRAM_SIZE},
 };
 
-/* ƽ̨سʼ */
+/* 平台相关初始化 */
 aw_local void __spi_flash_plfm_init (void)
 {
     aw_gpio_pin_cfg(PIO0_14, AW_GPIO_OUTPUT | AW_GPIO_PULL_UP);
@@ -42,21 +44,21 @@ aw_local void __spi_flash_plfm_init (void)
     aw_gpio_set(PIO0_14, 1);
 };
 
-/* ʹ NVRAM ӿڶдSPI Flash ʱҪĿ黺棬ӦСһ*/
+/* 使用 NVRAM 接口读写SPI Flash 时，需要的块缓存，容量应与块大小一致*/
 //aw_local uint8_t __g_block_buf[4096] = {0};
 
 aw_local aw_const awbl_spi_flash_devinfo_t __g_spi_flash_devinfo0 = {
-    &__g_spiflash_seglst[0],            /* ʧԴ洢б */
-    AW_NELEMENTS(__g_spiflash_seglst),  /* ʧԴ洢бĿ */
+    &__g_spiflash_seglst[0],            /* 非易失性存储段配置列表 */
+    AW_NELEMENTS(__g_spiflash_seglst),  /* 非易失性存储段配置列表条目数 */
     NULL, //__g_block_buf,
-    "/sflash0",                         /* flash עɿ豸 */
-    4096,                               /* flash ĿС */
-    512,                                /* flash Ӧ */
-    256,                                /* flash дҳС */
-    0,                                  /* 0飬0MBĿռ */
-    AW_SPI_MODE_0,                      /* ӿʱģʽ */
-    PIO0_14,                             /* Ƭѡ */
-    30000000,                           /* SPIʱ */
+    "/sflash0",                         /* flash 注册成块设备的名字 */
+    4096,                               /* flash 擦除操作的块大小 */
+    512,                                /* flash 对应块数量 */
+    256,                                /* flash 写操作的页大小 */
+    0,                                  /* 保留0个块，即0MB的空间 */
+    AW_SPI_MODE_0,                      /* 接口时序模式 */
+    PIO0_14,                             /* 片选引脚 */
+    30000000,                           /* SPI总线时钟 */
     __spi_flash_plfm_init,
 };
 
@@ -526,7 +526,7 @@ aw_local aw_err_t __spiflash_nvram_set (struct awbl_dev *p_dev,
                 return  -ENXIO;
             }
 
-            /* 㵱ǰĴ洢ַ */
+            /* 计算当前的存储地址 */
             current_addr = p_seg->seg_addr + offset;
             if (current_addr%p_devinfo->page_size != 0) {
                 return  -AW_EPERM;
@@ -535,7 +535,7 @@ aw_local aw_err_t __spiflash_nvram_set (struct awbl_dev *p_dev,
             block_curr_addr = current_addr/p_devinfo->block_size*p_devinfo->block_size;
 
             if (current_addr%p_devinfo->block_size == 0) {
-                /*   */
+                /* 擦除块区  */
                 ret = __spi_flash_erase_sector ((awbl_spi_flash_dev_t *)p_dev,
                         block_curr_addr);
                 if (ret != AW_OK) {
@@ -546,7 +546,7 @@ aw_local aw_err_t __spiflash_nvram_set (struct awbl_dev *p_dev,
             for (curr_copy_size = 0; curr_copy_size < copylen; ) {
 
                 if (current_addr - block_curr_addr == p_devinfo->block_size) {
-                    /*   */
+                    /* 擦除块区  */
                     ret = __spi_flash_erase_sector ((awbl_spi_flash_dev_t *)p_dev,
                             block_curr_addr);
                     if (ret != AW_OK) {
@@ -576,6 +576,54 @@ aw_local aw_err_t __spiflash_nvram_set (struct awbl_dev *p_dev,
     return -ENXIO;
 }
 
+/******************************************************************************/
+aw_err_t awbl_spi_flash_nvram_erase (char *p_name, int unit, int offset, int len)
+{
+    struct awbl_dev                 *p_dev;
+    const struct awbl_nvram_segment *p_seg;
+    uint32_t                         addr;
+    int                              dev_unit;
+    int                              i;
+    aw_err_t                         ret;
+
+    for (dev_unit = 0;
+         NULL != (p_dev = awbl_dev_find_by_name(AWBL_SPI_FLASH_NAME, dev_unit));
+         dev_unit++) {
+
+        __SPI_FLASH_DEVINFO_DECL(p_devinfo, p_dev);
+
+        p_seg = p_devinfo->p_seglst;
+        for (i = 0; i < p_devinfo->seglst_count; i++, p_seg++) {
+            if ((p_seg->unit != unit) || (strcmp(p_seg->p_name, p_name) != 0)) {
+                continue;
+            }
+
+            /* 只擦除整块 */
+            addr = p_seg->seg_addr + offset;
+            if ((offset < 0) || (len < 0) ||
+                (offset + len > p_seg->seg_size) ||
+                (addr % p_devinfo->block_size != 0) ||
+                (len % p_devinfo->block_size != 0)) {
+                return -AW_EINVAL;
+            }
+            if (addr + len > p_devinfo->block_size * p_devinfo->nblocks) {
+                return -ENXIO;
+            }
+
+            for (; len > 0; len -= p_devinfo->block_size) {
+                ret = __spi_flash_erase_sector((awbl_spi_flash_dev_t *)p_dev, addr);
+                if (ret != AW_OK) {
+                    return ret;
+                }
+                addr += p_devinfo->block_size;
+            }
+            return AW_OK;
+        }
+    }
+
+    return -ENXIO;
+}
+
 /******************************************************************************/
 AWBL_METHOD_IMPORT(awbl_nvram_get);
 AWBL_METHOD_IMPORT(awbl_nvram_set);
@@ -13,7 +13,7 @@
 
 /**
  * \file
- * \brief EasyARM-54000M4 AWBus-lite Ӳļ
+ * \brief EasyARM-54000M4 AWBus-lite 硬件配置文件
  *
  * \internal
  * \par modification history
@@ -90,7 +90,7 @@
 *******************************************************************************/
 
 /*
- * lpc17xx Ӳ豸б {
+ * lpc17xx 硬件设备列表 {
  *     p_name,
  *     unit,
  *     bus_type,